@@ -0,0 +1,297 @@
+#include "Benchmark.h"
+#include <algorithm> // std::sort
+#include <cctype> // isalnum, toupper
+#include <cmath> // sqrt
+#include <cstdlib> // atoi, atof
+#include <cstdio> // snprintf
+#include <fstream> // Scripts and recordings
+#include <iostream> // For outputting errors and messages
+#include <sstream> // Script lines
+#include <string> // Script tokens
+#include <vector> // Events and frame times
+
+static const int BENCHMARK_WARMUP_FRAMES = 10; // Left out of the statistics (shader compiles, first uploads)
+
+enum InputMode
+{
+    INPUT_LIVE, // GLFW only
+    INPUT_RECORD, // GLFW, logged to a script
+    INPUT_PLAYBACK // Script and virtual clock only
+};
+
+enum InputEventType
+{
+    INPUT_EVENT_KEY,
+    INPUT_EVENT_BUTTON,
+    INPUT_EVENT_MOUSE
+};
+
+struct InputEvent
+{
+    int frame; // Applied at the start of this frame
+    InputEventType type;
+    int code; // Key or mouse button
+    bool down;
+    double x, y; // Cursor position
+};
+
+static InputMode inputMode = INPUT_LIVE;
+static GLFWwindow* inputWindow = nullptr;
+static int inputFrame = 0; // Frames begun so far
+static double frameSeconds = 1.0 / 60.0; // Virtual clock step
+static std::vector<InputEvent> scriptEvents; // Sorted by frame
+static size_t nextEvent = 0; // First event not applied yet
+static int scriptFrames = 0;
+static bool scriptedKeys[GLFW_KEY_LAST + 1]; // Key state during playback
+static bool recordedKeys[GLFW_KEY_LAST + 1]; // Last key state written to the recording
+static GLFWcursorposfun liveCursorCallback = nullptr; // The application's callbacks, driven by the script or wrapped by the recorder
+static GLFWmousebuttonfun liveButtonCallback = nullptr;
+static std::ofstream recordFile;
+static std::vector<double> frameTimes; // CPU ms per frame
+
+static std::string keyName(int key)
+{
+    if (key >= 0 && key < 128 && isalnum(key))
+        return std::string(1, (char)key);
+    return std::to_string(key);
+}
+
+static int parseKey(const std::string& name)
+{
+    if (name.size() == 1 && isalnum((unsigned char)name[0]))
+        return toupper((unsigned char)name[0]); // GLFW_KEY_A..Z and GLFW_KEY_0..9 are their ASCII codes
+    return atoi(name.c_str());
+}
+
+static bool loadInputScript(const char* path)
+{
+    std::ifstream in(path);
+    if (!in)
+    {
+        std::cout << "Failed to open input script: " << path << std::endl;
+        return false;
+    }
+
+    scriptEvents.clear();
+    scriptFrames = 0;
+    frameSeconds = 1.0 / 60.0;
+    int declaredFrames = 0, lineNumber = 0;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        lineNumber++;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos)
+            line.erase(comment);
+        std::istringstream tokens(line);
+        std::string first;
+        if (!(tokens >> first))
+            continue;
+
+        if (first == "dt")
+        {
+            tokens >> frameSeconds;
+            continue;
+        }
+        if (first == "frames")
+        {
+            tokens >> declaredFrames;
+            continue;
+        }
+
+        InputEvent event = {};
+        event.frame = atoi(first.c_str());
+        std::string type, a, b;
+        tokens >> type >> a >> b;
+        if (type == "key" || type == "button")
+        {
+            event.type = type == "key" ? INPUT_EVENT_KEY : INPUT_EVENT_BUTTON;
+            event.code = type == "key" ? parseKey(a) : atoi(a.c_str());
+            event.down = b == "down";
+        }
+        else if (type == "mouse")
+        {
+            event.type = INPUT_EVENT_MOUSE;
+            event.x = atof(a.c_str());
+            event.y = atof(b.c_str());
+        }
+        else
+        {
+            std::cout << path << ":" << lineNumber << ": unknown event '" << type << "'" << std::endl;
+            return false;
+        }
+        if (event.code < 0 || event.code > GLFW_KEY_LAST || event.frame < 0)
+        {
+            std::cout << path << ":" << lineNumber << ": value out of range" << std::endl;
+            return false;
+        }
+        scriptEvents.push_back(event);
+    }
+
+    std::stable_sort(scriptEvents.begin(), scriptEvents.end(), [](const InputEvent& a, const InputEvent& b) { return a.frame < b.frame; });
+    scriptFrames = declaredFrames > 0 ? declaredFrames : (scriptEvents.empty() ? 1 : scriptEvents.back().frame + 1);
+    if (frameSeconds <= 0.0)
+        frameSeconds = 1.0 / 60.0;
+    return true;
+}
+
+// Recording wrappers: log, then hand the event to the application as usual
+static void recordCursorPos(GLFWwindow* window, double x, double y)
+{
+    char line[96];
+    snprintf(line, sizeof(line), "%d mouse %.17g %.17g\n", inputFrame, x, y);
+    recordFile << line;
+    if (liveCursorCallback)
+        liveCursorCallback(window, x, y);
+}
+
+static void recordMouseButton(GLFWwindow* window, int button, int action, int mods)
+{
+    if (action != GLFW_REPEAT)
+        recordFile << inputFrame << " button " << button << (action == GLFW_PRESS ? " down" : " up") << "\n";
+    if (liveButtonCallback)
+        liveButtonCallback(window, button, action, mods);
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+bool startInputPlayback(GLFWwindow* window, const char* path)
+{
+    if (!loadInputScript(path))
+        return false;
+    inputMode = INPUT_PLAYBACK;
+    inputWindow = window;
+    inputFrame = 0;
+    nextEvent = 0;
+    std::fill(std::begin(scriptedKeys), std::end(scriptedKeys), false);
+    frameTimes.clear();
+    frameTimes.reserve(scriptFrames);
+    // Real mouse input would make the run depend on the user; keep the callbacks for scripted events only
+    liveCursorCallback = glfwSetCursorPosCallback(window, NULL);
+    liveButtonCallback = glfwSetMouseButtonCallback(window, NULL);
+    std::cout << "Playing back " << path << ": " << scriptEvents.size() << " events over " << scriptFrames << " frames, "
+              << frameSeconds * 1000.0 << " ms per virtual frame" << std::endl;
+    return true;
+}
+
+bool startInputRecording(GLFWwindow* window, const char* path)
+{
+    recordFile.open(path, std::ios::trunc);
+    if (!recordFile)
+    {
+        std::cout << "Failed to create input recording: " << path << std::endl;
+        return false;
+    }
+    inputMode = INPUT_RECORD;
+    inputWindow = window;
+    inputFrame = 0;
+    std::fill(std::begin(recordedKeys), std::end(recordedKeys), false);
+    recordFile << "# Recorded input; replays on a fixed virtual clock\n";
+    recordFile << "dt " << frameSeconds << "\n";
+    liveCursorCallback = glfwSetCursorPosCallback(window, recordCursorPos);
+    liveButtonCallback = glfwSetMouseButtonCallback(window, recordMouseButton);
+    std::cout << "Recording input to " << path << std::endl;
+    return true;
+}
+
+void stopInput()
+{
+    if (inputMode == INPUT_RECORD)
+    {
+        recordFile << "frames " << inputFrame << "\n";
+        recordFile.close();
+        glfwSetCursorPosCallback(inputWindow, liveCursorCallback);
+        glfwSetMouseButtonCallback(inputWindow, liveButtonCallback);
+        std::cout << "Recorded " << inputFrame << " frames of input" << std::endl;
+    }
+    else if (inputMode == INPUT_PLAYBACK && !frameTimes.empty())
+    {
+        size_t skip = frameTimes.size() > (size_t)BENCHMARK_WARMUP_FRAMES * 2 ? BENCHMARK_WARMUP_FRAMES : 0;
+        std::vector<double> times(frameTimes.begin() + skip, frameTimes.end());
+        double sum = 0.0, squares = 0.0;
+        for (double t : times)
+        {
+            sum += t;
+            squares += t * t;
+        }
+        double mean = sum / times.size();
+        double deviation = sqrt(std::max(squares / times.size() - mean * mean, 0.0));
+        std::sort(times.begin(), times.end());
+        auto percentile = [&](double p) { return times[std::min(times.size() - 1, (size_t)(p * (times.size() - 1) + 0.5))]; };
+        std::cout << "Benchmark: " << times.size() << " frames (" << skip << " warm-up skipped), CPU frame time mean "
+                  << mean << " ms, stddev " << deviation << ", min " << times.front() << ", median " << percentile(0.5)
+                  << ", p95 " << percentile(0.95) << ", p99 " << percentile(0.99) << ", max " << times.back() << std::endl;
+    }
+    inputMode = INPUT_LIVE;
+}
+
+bool isInputPlayback()
+{
+    return inputMode == INPUT_PLAYBACK;
+}
+
+int inputScriptFrames()
+{
+    return scriptFrames;
+}
+
+double beginInputFrame()
+{
+    if (inputMode != INPUT_PLAYBACK)
+        return glfwGetTime();
+
+    for (; nextEvent < scriptEvents.size() && scriptEvents[nextEvent].frame <= inputFrame; nextEvent++)
+    {
+        const InputEvent& event = scriptEvents[nextEvent];
+        if (event.type == INPUT_EVENT_KEY)
+            scriptedKeys[event.code] = event.down;
+        else if (event.type == INPUT_EVENT_BUTTON && liveButtonCallback)
+            liveButtonCallback(inputWindow, event.code, event.down ? GLFW_PRESS : GLFW_RELEASE, 0);
+        else if (event.type == INPUT_EVENT_MOUSE && liveCursorCallback)
+            liveCursorCallback(inputWindow, event.x, event.y);
+    }
+    return (inputFrame + 1) * frameSeconds;
+}
+
+bool inputKeyDown(GLFWwindow* window, int key)
+{
+    if (inputMode == INPUT_PLAYBACK)
+        return key >= 0 && key <= GLFW_KEY_LAST && scriptedKeys[key];
+
+    bool down = glfwGetKey(window, key) == GLFW_PRESS;
+    if (inputMode == INPUT_RECORD && key >= 0 && key <= GLFW_KEY_LAST && down != recordedKeys[key])
+    {
+        recordFile << inputFrame << " key " << keyName(key) << (down ? " down" : " up") << "\n";
+        recordedKeys[key] = down;
+    }
+    return down;
+}
+
+void endInputFrame(double frameMs)
+{
+    if (inputMode == INPUT_PLAYBACK)
+        frameTimes.push_back(frameMs);
+    inputFrame++; // Events arriving from here on (glfwPollEvents) belong to the next frame
+}
+
+uint64_t checksumBytes(const void* data, size_t size, uint64_t seed)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull; // FNV-1a prime
+    }
+    return hash;
+}
+
+uint64_t checksumFramebuffer(int width, int height)
+{
+    std::vector<unsigned char> pixels((size_t)width * height * 4);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    return checksumBytes(pixels.data(), pixels.size());
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <glad/glad.h> // Must precede GLFW
+#include <GLFW/glfw3.h> // Window, key codes and callback types
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+
+// Deterministic benchmark runs. Input either comes live from GLFW, is recorded while coming live, or is played
+// back from a script; time comes from a virtual clock during playback, so camera motion, toggles and animations
+// are identical on every run. Script format, one entry per line ('#' starts a comment):
+//   dt 0.0166667            virtual seconds per frame (default 1/60)
+//   frames 600              length of the run (default: last event + 1)
+//   <frame> key W down      key state change; letters and digits by name, other keys by GLFW code
+//   <frame> key 2 up
+//   <frame> button 0 down   mouse button state change (0 = left)
+//   <frame> mouse 412 300   cursor position in window coordinates
+// Events apply at the start of their frame, before input is processed.
+
+// Play back a script: live mouse callbacks are unhooked and only called with scripted events
+bool startInputPlayback(GLFWwindow* window, const char* path);
+
+// Record the live session to path in the script format above
+bool startInputRecording(GLFWwindow* window, const char* path);
+
+// Write out and close a recording; prints the frame-time statistics of a playback
+void stopInput();
+
+bool isInputPlayback();
+
+// Frames in the loaded script
+int inputScriptFrames();
+
+// Apply this frame's scripted events; returns the frame's time (virtual in playback, glfwGetTime otherwise)
+double beginInputFrame();
+
+// Replaces glfwGetKey(window, key) == GLFW_PRESS
+bool inputKeyDown(GLFWwindow* window, int key);
+
+// Close the frame; frameMs is the measured CPU time of the frame, kept for the statistics
+void endInputFrame(double frameMs);
+
+// FNV-1a hash of the current read framebuffer (call before the swap)
+uint64_t checksumFramebuffer(int width, int height);
+
+// FNV-1a hash of arbitrary bytes, chained through seed
+uint64_t checksumBytes(const void* data, size_t size, uint64_t seed = 14695981039346656037ull);
@@ -0,0 +1,45 @@
+#include "Camera.h"
+
+void setCameraPosition(Camera& camera, const glm::vec3& position)
+{
+    if (position == camera.position)
+        return;
+    camera.position = position;
+    camera.viewDirty = true;
+}
+
+void setCameraOrientation(Camera& camera, const glm::quat& orientation)
+{
+    if (orientation == camera.orientation)
+        return;
+    camera.orientation = orientation;
+    camera.viewDirty = true;
+}
+
+void setCameraProjection(Camera& camera, const glm::mat4& projection)
+{
+    if (projection == camera.projection)
+        return;
+    camera.projection = projection;
+    camera.projectionDirty = true;
+}
+
+bool updateCamera(Camera& camera)
+{
+    if (!camera.viewDirty && !camera.projectionDirty)
+        return false;
+
+    if (camera.viewDirty)
+    {
+        // Camera to world is [R | p]; world to camera is [R^T | -R^T p]
+        glm::mat3 transposed = glm::transpose(glm::mat3_cast(camera.orientation));
+        glm::vec3 translation = -(transposed * camera.position);
+        camera.view = glm::mat4(transposed);
+        camera.view[3] = glm::vec4(translation, 1.0f);
+    }
+    camera.viewProjection = camera.projection * camera.view;
+    camera.viewDirty = false;
+    camera.projectionDirty = false;
+    camera.rebuilds++;
+    return true;
+}
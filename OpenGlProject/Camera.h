@@ -0,0 +1,35 @@
+#pragma once
+#include <glm/glm.hpp> // Vectors and matrices
+#include <glm/gtc/quaternion.hpp> // Orientation
+#include <cstdint> // Statistics
+
+// A camera stored as position + unit quaternion. The view matrix is built straight from the rotation (the
+// transposed rotation and a translation, no normalizes, cross products or matrix inverse). view and
+// viewProjection are cached and only rebuilt by updateCamera after the pose or projection changed; any number of
+// cameras (split-screen views, shadow views) can coexist, and a static one costs a flag test per frame.
+struct Camera
+{
+    glm::vec3 position = glm::vec3(0.0f);
+    glm::quat orientation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f); // Identity looks along -Z with +Y up
+    glm::mat4 projection = glm::mat4(1.0f);
+
+    // Derived, valid after updateCamera
+    glm::mat4 view = glm::mat4(1.0f); // World to camera
+    glm::mat4 viewProjection = glm::mat4(1.0f); // projection * view, the scene shader's one camera uniform
+    bool viewDirty = true; // Pose changed since the last update
+    bool projectionDirty = true; // Projection changed since the last update
+    uint64_t rebuilds = 0; // updateCamera calls that did work
+};
+
+// Setters only mark the camera dirty when the value actually changes
+void setCameraPosition(Camera& camera, const glm::vec3& position);
+void setCameraOrientation(Camera& camera, const glm::quat& orientation); // Must be unit length
+void setCameraProjection(Camera& camera, const glm::mat4& projection);
+
+// Rebuild the cached matrices if anything changed; returns true if it did
+bool updateCamera(Camera& camera);
+
+// Camera axes in world space, from the orientation
+inline glm::vec3 cameraForward(const Camera& camera) { return camera.orientation * glm::vec3(0.0f, 0.0f, -1.0f); }
+inline glm::vec3 cameraRight(const Camera& camera) { return camera.orientation * glm::vec3(1.0f, 0.0f, 0.0f); }
+inline glm::vec3 cameraUpAxis(const Camera& camera) { return camera.orientation * glm::vec3(0.0f, 1.0f, 0.0f); }
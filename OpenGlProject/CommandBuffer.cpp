@@ -0,0 +1,314 @@
+#include "CommandBuffer.h"
+#include "FrameAllocator.h" // Packet and group memory
+#include <algorithm> // std::sort
+#include <cstring> // memcpy
+
+static const size_t COMMAND_CHUNK_BYTES = 16 * 1024; // Packets are written into chunks of this size
+static const unsigned COMMAND_TEXTURE_UNITS = 16; // Units tracked for redundant binds
+
+struct CmdJump { CommandHeader header; const unsigned char* next; };
+struct CmdUseProgram { CommandHeader header; GLuint program; };
+struct CmdBindVertexArray { CommandHeader header; GLuint vertexArray; };
+struct CmdBindTexture { CommandHeader header; GLuint unit; GLuint texture; };
+struct CmdUniformMatrix4 { CommandHeader header; GLint location; float value[16]; };
+struct CmdUniformInt { CommandHeader header; GLint location; GLint value; };
+struct CmdUniformFloat { CommandHeader header; GLint location; GLfloat value; };
+struct CmdUniformVec4 { CommandHeader header; GLint location; float value[4]; };
+struct CmdDrawArrays { CommandHeader header; GLenum mode; GLint first; GLsizei count; };
+struct CmdDrawElements { CommandHeader header; GLenum mode; GLsizei count; GLenum type; uint64_t offset; };
+struct CmdBufferSubData { CommandHeader header; GLenum target; GLuint buffer; GLintptr offset; GLsizeiptr size; const void* data; };
+
+static size_t packetSize(size_t bytes)
+{
+    return (bytes + 7) & ~(size_t)7;
+}
+
+// Room for size bytes in the current chunk, chaining a new one with a jump when it is full
+static void* allocatePacket(CommandBuffer& buffer, CommandType type, size_t size)
+{
+    size = packetSize(size);
+    if (!buffer.cursor || buffer.cursor + size > buffer.chunkEnd)
+    {
+        size_t chunkBytes = std::max(COMMAND_CHUNK_BYTES, size + packetSize(sizeof(CmdJump)));
+        unsigned char* chunk = (unsigned char*)frameAllocate(chunkBytes, 8);
+        if (buffer.cursor)
+        {
+            CmdJump* jump = (CmdJump*)buffer.cursor;
+            jump->header.type = CMD_JUMP;
+            jump->header.size = (uint16_t)packetSize(sizeof(CmdJump));
+            jump->next = chunk;
+        }
+        buffer.cursor = chunk;
+        buffer.chunkEnd = chunk + chunkBytes - packetSize(sizeof(CmdJump)); // A jump always fits after the last packet
+    }
+
+    if (buffer.groupCount == 0)
+        beginCommandGroup(buffer, 0); // Recording without a group: one group with key 0
+    CommandGroup& group = buffer.groups[buffer.groupCount - 1];
+    if (!group.first)
+        group.first = (const CommandHeader*)buffer.cursor;
+
+    CommandHeader* header = (CommandHeader*)buffer.cursor;
+    header->type = type;
+    header->size = (uint16_t)size;
+    buffer.cursor += size;
+    if (type != CMD_END)
+    {
+        buffer.packetCount++;
+        buffer.groupOpen = true;
+    }
+    return header;
+}
+
+static void closeGroup(CommandBuffer& buffer)
+{
+    if (!buffer.groupOpen)
+        return;
+    allocatePacket(buffer, CMD_END, sizeof(CommandHeader));
+    buffer.groupOpen = false;
+}
+
+void beginCommandGroup(CommandBuffer& buffer, uint64_t key)
+{
+    closeGroup(buffer);
+    if (buffer.groupCount == buffer.groupCapacity)
+    {
+        size_t capacity = buffer.groupCapacity ? buffer.groupCapacity * 2 : 64;
+        CommandGroup* groups = frameAllocateArray<CommandGroup>(capacity);
+        if (buffer.groupCount)
+            memcpy(groups, buffer.groups, buffer.groupCount * sizeof(CommandGroup));
+        buffer.groups = groups;
+        buffer.groupCapacity = capacity;
+    }
+    CommandGroup& group = buffer.groups[buffer.groupCount++];
+    group.key = key;
+    group.first = nullptr; // Set by the first packet
+}
+
+// ---------------------------------------------------------------------------
+// Recording
+// ---------------------------------------------------------------------------
+
+void cmdUseProgram(CommandBuffer& buffer, GLuint program)
+{
+    CmdUseProgram* packet = (CmdUseProgram*)allocatePacket(buffer, CMD_USE_PROGRAM, sizeof(CmdUseProgram));
+    packet->program = program;
+}
+
+void cmdBindVertexArray(CommandBuffer& buffer, GLuint vertexArray)
+{
+    CmdBindVertexArray* packet = (CmdBindVertexArray*)allocatePacket(buffer, CMD_BIND_VERTEX_ARRAY, sizeof(CmdBindVertexArray));
+    packet->vertexArray = vertexArray;
+}
+
+void cmdBindTexture(CommandBuffer& buffer, unsigned unit, GLuint texture)
+{
+    CmdBindTexture* packet = (CmdBindTexture*)allocatePacket(buffer, CMD_BIND_TEXTURE, sizeof(CmdBindTexture));
+    packet->unit = unit;
+    packet->texture = texture;
+}
+
+void cmdUniformMatrix4(CommandBuffer& buffer, GLint location, const float* value)
+{
+    CmdUniformMatrix4* packet = (CmdUniformMatrix4*)allocatePacket(buffer, CMD_UNIFORM_MATRIX4, sizeof(CmdUniformMatrix4));
+    packet->location = location;
+    memcpy(packet->value, value, sizeof(packet->value));
+}
+
+void cmdUniformInt(CommandBuffer& buffer, GLint location, GLint value)
+{
+    CmdUniformInt* packet = (CmdUniformInt*)allocatePacket(buffer, CMD_UNIFORM_INT, sizeof(CmdUniformInt));
+    packet->location = location;
+    packet->value = value;
+}
+
+void cmdUniformFloat(CommandBuffer& buffer, GLint location, GLfloat value)
+{
+    CmdUniformFloat* packet = (CmdUniformFloat*)allocatePacket(buffer, CMD_UNIFORM_FLOAT, sizeof(CmdUniformFloat));
+    packet->location = location;
+    packet->value = value;
+}
+
+void cmdUniformVec4(CommandBuffer& buffer, GLint location, const float* value)
+{
+    CmdUniformVec4* packet = (CmdUniformVec4*)allocatePacket(buffer, CMD_UNIFORM_VEC4, sizeof(CmdUniformVec4));
+    packet->location = location;
+    memcpy(packet->value, value, sizeof(packet->value));
+}
+
+void cmdDrawArrays(CommandBuffer& buffer, GLenum mode, GLint first, GLsizei count)
+{
+    CmdDrawArrays* packet = (CmdDrawArrays*)allocatePacket(buffer, CMD_DRAW_ARRAYS, sizeof(CmdDrawArrays));
+    packet->mode = mode;
+    packet->first = first;
+    packet->count = count;
+}
+
+void cmdDrawElements(CommandBuffer& buffer, GLenum mode, GLsizei count, GLenum type, size_t offset)
+{
+    CmdDrawElements* packet = (CmdDrawElements*)allocatePacket(buffer, CMD_DRAW_ELEMENTS, sizeof(CmdDrawElements));
+    packet->mode = mode;
+    packet->count = count;
+    packet->type = type;
+    packet->offset = offset;
+}
+
+void cmdBufferSubData(CommandBuffer& buffer, GLenum target, GLuint bufferObject, GLintptr offset, GLsizeiptr size, const void* data)
+{
+    void* copy = frameAllocate((size_t)size, 16);
+    memcpy(copy, data, (size_t)size);
+    CmdBufferSubData* packet = (CmdBufferSubData*)allocatePacket(buffer, CMD_BUFFER_SUB_DATA, sizeof(CmdBufferSubData));
+    packet->target = target;
+    packet->buffer = bufferObject;
+    packet->offset = offset;
+    packet->size = size;
+    packet->data = copy;
+}
+
+// ---------------------------------------------------------------------------
+// Replay
+// ---------------------------------------------------------------------------
+
+// What replay last bound; ~0 = unknown, so the first bind of a submit always goes through
+struct ReplayState
+{
+    GLuint program = ~0u;
+    GLuint vertexArray = ~0u;
+    GLuint activeUnit = ~0u;
+    GLuint textures[COMMAND_TEXTURE_UNITS];
+};
+
+struct SortedGroup
+{
+    uint64_t key;
+    size_t buffer; // Tie-breaks keep recording order
+    size_t index;
+    const CommandHeader* first;
+};
+
+static void replayGroup(const CommandHeader* packet, ReplayState& state, CommandStats& stats)
+{
+    for (;;)
+    {
+        switch (packet->type)
+        {
+        case CMD_END:
+            return;
+        case CMD_JUMP:
+            packet = (const CommandHeader*)((const CmdJump*)packet)->next;
+            continue;
+        case CMD_USE_PROGRAM:
+        {
+            const CmdUseProgram* p = (const CmdUseProgram*)packet;
+            if (p->program == state.program)
+                stats.skippedBinds++;
+            else
+                glUseProgram(state.program = p->program);
+            break;
+        }
+        case CMD_BIND_VERTEX_ARRAY:
+        {
+            const CmdBindVertexArray* p = (const CmdBindVertexArray*)packet;
+            if (p->vertexArray == state.vertexArray)
+                stats.skippedBinds++;
+            else
+                glBindVertexArray(state.vertexArray = p->vertexArray);
+            break;
+        }
+        case CMD_BIND_TEXTURE:
+        {
+            const CmdBindTexture* p = (const CmdBindTexture*)packet;
+            bool tracked = p->unit < COMMAND_TEXTURE_UNITS;
+            if (tracked && state.textures[p->unit] == p->texture)
+            {
+                stats.skippedBinds++;
+                break;
+            }
+            if (p->unit != state.activeUnit)
+                glActiveTexture(GL_TEXTURE0 + (state.activeUnit = p->unit));
+            glBindTexture(GL_TEXTURE_2D, p->texture);
+            if (tracked)
+                state.textures[p->unit] = p->texture;
+            break;
+        }
+        case CMD_UNIFORM_MATRIX4:
+        {
+            const CmdUniformMatrix4* p = (const CmdUniformMatrix4*)packet;
+            glUniformMatrix4fv(p->location, 1, GL_FALSE, p->value);
+            break;
+        }
+        case CMD_UNIFORM_INT:
+        {
+            const CmdUniformInt* p = (const CmdUniformInt*)packet;
+            glUniform1i(p->location, p->value);
+            break;
+        }
+        case CMD_UNIFORM_FLOAT:
+        {
+            const CmdUniformFloat* p = (const CmdUniformFloat*)packet;
+            glUniform1f(p->location, p->value);
+            break;
+        }
+        case CMD_UNIFORM_VEC4:
+        {
+            const CmdUniformVec4* p = (const CmdUniformVec4*)packet;
+            glUniform4fv(p->location, 1, p->value);
+            break;
+        }
+        case CMD_DRAW_ARRAYS:
+        {
+            const CmdDrawArrays* p = (const CmdDrawArrays*)packet;
+            glDrawArrays(p->mode, p->first, p->count);
+            stats.draws++;
+            break;
+        }
+        case CMD_DRAW_ELEMENTS:
+        {
+            const CmdDrawElements* p = (const CmdDrawElements*)packet;
+            glDrawElements(p->mode, p->count, p->type, (const void*)(uintptr_t)p->offset);
+            stats.draws++;
+            break;
+        }
+        case CMD_BUFFER_SUB_DATA:
+        {
+            const CmdBufferSubData* p = (const CmdBufferSubData*)packet;
+            glBindBuffer(p->target, p->buffer);
+            glBufferSubData(p->target, p->offset, p->size, p->data);
+            break;
+        }
+        }
+        stats.packets++;
+        packet = (const CommandHeader*)((const unsigned char*)packet + packet->size);
+    }
+}
+
+CommandStats submitCommandBuffers(CommandBuffer* buffers, size_t bufferCount)
+{
+    CommandStats stats;
+    size_t total = 0;
+    for (size_t b = 0; b < bufferCount; b++)
+    {
+        closeGroup(buffers[b]);
+        total += buffers[b].groupCount;
+    }
+
+    SortedGroup* sorted = frameAllocateArray<SortedGroup>(total);
+    size_t count = 0;
+    for (size_t b = 0; b < bufferCount; b++)
+        for (size_t g = 0; g < buffers[b].groupCount; g++)
+            if (buffers[b].groups[g].first)
+                sorted[count++] = { buffers[b].groups[g].key, b, g, buffers[b].groups[g].first };
+    std::sort(sorted, sorted + count, [](const SortedGroup& a, const SortedGroup& b) {
+        if (a.key != b.key)
+            return a.key < b.key;
+        return a.buffer != b.buffer ? a.buffer < b.buffer : a.index < b.index;
+    });
+
+    ReplayState state;
+    for (GLuint& texture : state.textures)
+        texture = ~0u;
+    for (size_t i = 0; i < count; i++)
+        replayGroup(sorted[i].first, state, stats);
+    stats.groups = count;
+    return stats;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <glad/glad.h> // GL types
+#include <cstddef> // size_t
+#include <cstdint> // Packet fields and sort keys
+
+// Deferred GL command buffers. Any thread records POD packets (binds, uniforms, draws, buffer updates) into
+// frame-arena memory; the GL thread replays them. Recording is grouped: beginCommandGroup starts a
+// self-contained sequence (typically one draw with its state) with a 64-bit sort key, and submitCommandBuffers
+// replays the groups of all buffers in key order, dropping binds of the program, vertex array or texture that
+// is already bound. Each recording thread uses its own CommandBuffer; memory lives until the frame arena
+// buffer is recycled, so buffers are recorded and submitted within a frame.
+
+enum CommandType : uint16_t
+{
+    CMD_END, // Closes a group
+    CMD_JUMP, // Continue in the next chunk
+    CMD_USE_PROGRAM,
+    CMD_BIND_VERTEX_ARRAY,
+    CMD_BIND_TEXTURE,
+    CMD_UNIFORM_MATRIX4,
+    CMD_UNIFORM_INT,
+    CMD_UNIFORM_FLOAT,
+    CMD_UNIFORM_VEC4,
+    CMD_DRAW_ARRAYS,
+    CMD_DRAW_ELEMENTS,
+    CMD_BUFFER_SUB_DATA
+};
+
+struct CommandHeader
+{
+    CommandType type;
+    uint16_t size; // Whole packet in bytes, a multiple of 8
+};
+
+struct CommandGroup
+{
+    uint64_t key; // Replay order
+    const CommandHeader* first; // First packet
+};
+
+struct CommandBuffer
+{
+    unsigned char* cursor = nullptr; // Next free byte in the current chunk
+    unsigned char* chunkEnd = nullptr; // Leaves room for a closing jump
+    CommandGroup* groups = nullptr; // Frame arena array
+    size_t groupCount = 0;
+    size_t groupCapacity = 0;
+    size_t packetCount = 0;
+    bool groupOpen = false; // The last group has packets but no END yet
+};
+
+struct CommandStats
+{
+    size_t groups = 0;
+    size_t packets = 0; // Excluding END and JUMP
+    size_t draws = 0;
+    size_t skippedBinds = 0; // Program, vertex array and texture binds dropped as redundant
+};
+
+// Sort key: pass first, then program and texture so state changes cluster, then front-to-back depth (0..1)
+inline uint64_t commandSortKey(unsigned pass, unsigned program, unsigned texture, float depth)
+{
+    depth = depth < 0.0f ? 0.0f : (depth > 1.0f ? 1.0f : depth);
+    return ((uint64_t)(pass & 0xFF) << 56) | ((uint64_t)(program & 0xFFF) << 44) | ((uint64_t)(texture & 0xFFFF) << 28)
+         | (uint64_t)(depth * 0x0FFFFFFF);
+}
+
+// Start a new group; the previous one is closed
+void beginCommandGroup(CommandBuffer& buffer, uint64_t key);
+
+void cmdUseProgram(CommandBuffer& buffer, GLuint program);
+void cmdBindVertexArray(CommandBuffer& buffer, GLuint vertexArray);
+void cmdBindTexture(CommandBuffer& buffer, unsigned unit, GLuint texture); // GL_TEXTURE_2D on GL_TEXTURE0 + unit
+void cmdUniformMatrix4(CommandBuffer& buffer, GLint location, const float* value); // Column major, 16 floats
+void cmdUniformInt(CommandBuffer& buffer, GLint location, GLint value);
+void cmdUniformFloat(CommandBuffer& buffer, GLint location, GLfloat value);
+void cmdUniformVec4(CommandBuffer& buffer, GLint location, const float* value); // 4 floats
+void cmdDrawArrays(CommandBuffer& buffer, GLenum mode, GLint first, GLsizei count);
+void cmdDrawElements(CommandBuffer& buffer, GLenum mode, GLsizei count, GLenum type, size_t offset);
+
+// The data is copied into the command buffer at record time. Binds bufferObject to target during replay, so
+// use it for GL_ARRAY_BUFFER / GL_UNIFORM_BUFFER, not element buffers (those are vertex array state).
+void cmdBufferSubData(CommandBuffer& buffer, GLenum target, GLuint bufferObject, GLintptr offset, GLsizeiptr size, const void* data);
+
+// GL thread: replay every group of every buffer in key order (ties keep buffer, then recording order)
+CommandStats submitCommandBuffers(CommandBuffer* buffers, size_t bufferCount);
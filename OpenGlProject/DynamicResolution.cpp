@@ -0,0 +1,164 @@
+#include "DynamicResolution.h"
+#include <algorithm> // std::min / std::max
+#include <cmath> // sqrt / round
+#include <iostream> // For outputting errors and messages
+
+bool updateDynamicResolution(DynamicResolution& resolution, float frameMs)
+{
+    // Smooth out single spikes (shader compiles, page faults) before reacting
+    resolution.smoothedMs = resolution.smoothedMs == 0.0f ? frameMs : resolution.smoothedMs + 0.1f * (frameMs - resolution.smoothedMs);
+    if (resolution.cooldown > 0)
+    {
+        resolution.cooldown--;
+        return false;
+    }
+
+    bool over = resolution.smoothedMs > resolution.targetMs * resolution.downThreshold;
+    bool under = resolution.smoothedMs < resolution.targetMs * resolution.upThreshold;
+    resolution.overBudget = over ? resolution.overBudget + 1 : 0;
+    resolution.underBudget = under ? resolution.underBudget + 1 : 0;
+
+    float scale = resolution.scale;
+    if (resolution.overBudget >= resolution.downFrames)
+        scale *= std::sqrt(resolution.targetMs / resolution.smoothedMs); // Pixel cost ~ scale^2, so step by the square root
+    else if (resolution.underBudget >= resolution.upFrames)
+        scale += resolution.upStep; // Grow gently; overshooting costs a visible drop back
+    else
+        return false;
+
+    scale = std::round(scale / resolution.quantum) * resolution.quantum;
+    scale = std::min(resolution.maxScale, std::max(resolution.minScale, scale));
+    resolution.overBudget = 0;
+    resolution.underBudget = 0;
+    if (std::fabs(scale - resolution.scale) < resolution.quantum * 0.5f)
+        return false; // Already at a bound
+
+    resolution.scale = scale;
+    resolution.cooldown = resolution.cooldownFrames;
+    resolution.changes++;
+    std::cout << "Resolution scale " << scale << " (frame time " << resolution.smoothedMs << " ms, target "
+              << resolution.targetMs << " ms)" << std::endl;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Upscale blit
+// ---------------------------------------------------------------------------
+
+static unsigned int upscaleProgram = 0; // Fullscreen upscale shader
+static unsigned int upscaleVAO = 0; // Empty VAO; core profile needs one bound to draw
+
+// Uniform locations of the upscale shader, looked up once in createUpscaler
+struct UpscaleUniforms
+{
+    GLint uvScale = -1, texel = -1, sharpen = -1, sharpness = -1;
+};
+static UpscaleUniforms upscaleUniforms;
+
+// Fullscreen triangle generated from gl_VertexID
+static const char* upscaleVertexSource = R"(
+#version 330 core
+out vec2 uv; // 0..1 over the screen
+void main()
+{
+    vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    uv = corner;
+    gl_Position = vec4(corner * 2.0f - 1.0f, 0.0f, 1.0f);
+})";
+
+static const char* upscaleFragmentSource = R"(
+#version 330 core
+in vec2 uv;
+out vec4 FragColor;
+
+uniform sampler2D source; // Scaled scene
+uniform vec2 uvScale; // Used part of the source texture
+uniform vec2 texel; // Size of one source texel in UV
+uniform bool sharpen; // Apply the unsharp mask
+uniform float sharpness; // Mask strength
+
+void main()
+{
+    vec2 p = min(uv * uvScale, uvScale - 0.5f * texel); // Never blend in texels past the rendered area
+    vec3 center = texture(source, p).rgb;
+    if (sharpen)
+    {
+        vec3 neighbors = texture(source, p + vec2(texel.x, 0.0f)).rgb + texture(source, p - vec2(texel.x, 0.0f)).rgb
+                       + texture(source, p + vec2(0.0f, texel.y)).rgb + texture(source, p - vec2(0.0f, texel.y)).rgb;
+        center = clamp(center + sharpness * (4.0f * center - neighbors), 0.0f, 1.0f);
+    }
+    FragColor = vec4(center, 1.0f);
+})";
+
+static unsigned int compileUpscaleShader(GLenum type, const char* source)
+{
+    unsigned int shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    GLint ok = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+    if (!ok)
+    {
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        std::cout << "Upscale shader failed to compile: " << log << std::endl;
+    }
+    return shader;
+}
+
+bool createUpscaler()
+{
+    unsigned int vertexShader = compileUpscaleShader(GL_VERTEX_SHADER, upscaleVertexSource);
+    unsigned int fragmentShader = compileUpscaleShader(GL_FRAGMENT_SHADER, upscaleFragmentSource);
+    upscaleProgram = glCreateProgram();
+    glAttachShader(upscaleProgram, vertexShader);
+    glAttachShader(upscaleProgram, fragmentShader);
+    glLinkProgram(upscaleProgram);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    GLint ok = 0;
+    glGetProgramiv(upscaleProgram, GL_LINK_STATUS, &ok);
+    if (!ok)
+    {
+        std::cout << "Upscale shader failed to link" << std::endl;
+        glDeleteProgram(upscaleProgram);
+        upscaleProgram = 0;
+        return false;
+    }
+
+    upscaleUniforms.uvScale = glGetUniformLocation(upscaleProgram, "uvScale");
+    upscaleUniforms.texel = glGetUniformLocation(upscaleProgram, "texel");
+    upscaleUniforms.sharpen = glGetUniformLocation(upscaleProgram, "sharpen");
+    upscaleUniforms.sharpness = glGetUniformLocation(upscaleProgram, "sharpness");
+    glUseProgram(upscaleProgram);
+    glUniform1i(glGetUniformLocation(upscaleProgram, "source"), 0); // Always texture unit 0: program state, set once
+    glUseProgram(0);
+    glGenVertexArrays(1, &upscaleVAO);
+    return true;
+}
+
+void upscaleTexture(unsigned int source, glm::vec2 uvScale, glm::vec2 sourceTexel, UpscaleFilter filter, float sharpness)
+{
+    glDisable(GL_DEPTH_TEST);
+    glUseProgram(upscaleProgram);
+    glUniform2f(upscaleUniforms.uvScale, uvScale.x, uvScale.y);
+    glUniform2f(upscaleUniforms.texel, sourceTexel.x, sourceTexel.y);
+    glUniform1i(upscaleUniforms.sharpen, filter == UPSCALE_SHARPEN);
+    glUniform1f(upscaleUniforms.sharpness, sharpness);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, source);
+    glBindVertexArray(upscaleVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glEnable(GL_DEPTH_TEST);
+}
+
+void releaseUpscaler()
+{
+    if (upscaleProgram)
+        glDeleteProgram(upscaleProgram);
+    if (upscaleVAO)
+        glDeleteVertexArrays(1, &upscaleVAO);
+    upscaleProgram = 0;
+    upscaleVAO = 0;
+}
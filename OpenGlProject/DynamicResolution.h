@@ -0,0 +1,45 @@
+#pragma once
+#include <glad/glad.h> // GL types
+#include <glm/glm.hpp> // UV scale
+
+// How the scaled scene is stretched to the window
+enum UpscaleFilter
+{
+    UPSCALE_BILINEAR, // Plain bilinear fetch
+    UPSCALE_SHARPEN // Bilinear plus a 5-tap unsharp mask to win back some detail
+};
+
+// Frame-time controller for the scene resolution scale
+struct DynamicResolution
+{
+    float targetMs = 16.7f; // Frame time to hold
+    float minScale = 0.5f; // Lower bound of the per-axis scale
+    float maxScale = 1.0f; // Upper bound of the per-axis scale
+    float scale = 1.0f; // Current per-axis scale
+    float smoothedMs = 0.0f; // Exponential moving average of the frame time
+    float downThreshold = 1.05f; // Scale down once smoothedMs > targetMs * this ...
+    float upThreshold = 0.85f; // ... and up once it is below targetMs * this (the gap is the dead band)
+    int downFrames = 8; // Consecutive frames over budget before scaling down
+    int upFrames = 60; // Consecutive frames under budget before scaling up (slow to avoid ping-pong)
+    int cooldownFrames = 30; // Frames to ignore after a change while the new cost settles
+    float upStep = 0.05f; // Scale increase per step
+    float quantum = 0.05f; // Scales are rounded to multiples of this
+    int overBudget = 0; // Current run of frames over budget
+    int underBudget = 0; // Current run of frames under budget
+    int cooldown = 0; // Frames left in the cooldown
+    int changes = 0; // Number of scale changes so far
+    UpscaleFilter filter = UPSCALE_BILINEAR; // Blit mode
+    float sharpness = 0.5f; // Unsharp mask strength for UPSCALE_SHARPEN
+};
+
+// Feed one frame time; returns true if the scale changed
+bool updateDynamicResolution(DynamicResolution& resolution, float frameMs);
+
+// Compile the upscale shader (render context current)
+bool createUpscaler();
+
+// Draw a fullscreen triangle sampling the used part (uvScale) of source into the bound framebuffer
+void upscaleTexture(unsigned int source, glm::vec2 uvScale, glm::vec2 sourceTexel, UpscaleFilter filter, float sharpness);
+
+// Delete the upscale shader
+void releaseUpscaler();
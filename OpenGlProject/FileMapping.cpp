@@ -0,0 +1,97 @@
+#include "FileMapping.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h> // CreateFileMapping / MapViewOfFile
+#else
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap / madvise
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close
+#endif
+
+bool mapFile(const char* path, MappedFile& file)
+{
+    unmapFile(file); // Drop any previous mapping
+
+#ifdef _WIN32
+    HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (handle == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(handle, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(handle); // Empty files can't be mapped
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL)
+    {
+        CloseHandle(handle);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == NULL)
+    {
+        CloseHandle(mapping);
+        CloseHandle(handle);
+        return false;
+    }
+
+    file.fileHandle = handle;
+    file.mappingHandle = mapping;
+    file.data = (const char*)view;
+    file.size = (size_t)fileSize.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0)
+    {
+        close(fd); // Empty files can't be mapped
+        return false;
+    }
+
+    void* view = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (view == MAP_FAILED)
+    {
+        close(fd);
+        return false;
+    }
+    madvise(view, (size_t)info.st_size, MADV_SEQUENTIAL); // Hint the kernel to read ahead
+
+    file.fd = fd;
+    file.data = (const char*)view;
+    file.size = (size_t)info.st_size;
+#endif
+    return true;
+}
+
+void unmapFile(MappedFile& file)
+{
+#ifdef _WIN32
+    if (file.data)
+        UnmapViewOfFile(file.data);
+    if (file.mappingHandle)
+        CloseHandle(file.mappingHandle);
+    if (file.fileHandle)
+        CloseHandle(file.fileHandle);
+    file.mappingHandle = nullptr;
+    file.fileHandle = nullptr;
+#else
+    if (file.data)
+        munmap((void*)file.data, file.size);
+    if (file.fd >= 0)
+        close(file.fd);
+    file.fd = -1;
+#endif
+    file.data = nullptr;
+    file.size = 0;
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <cstddef> // For size_t
+
+// Read-only view of a whole file mapped into memory
+struct MappedFile
+{
+    const char* data = nullptr; // First byte of the mapped file
+    size_t size = 0; // Size of the file in bytes
+#ifdef _WIN32
+    void* fileHandle = nullptr; // Win32 file handle
+    void* mappingHandle = nullptr; // Win32 file mapping handle
+#else
+    int fd = -1; // POSIX file descriptor
+#endif
+};
+
+// Map a file read-only; returns false if it can't be opened or mapped
+bool mapFile(const char* path, MappedFile& file);
+
+// Release the mapping and close the file
+void unmapFile(MappedFile& file);
@@ -0,0 +1,258 @@
+#include "FrameAllocator.h"
+#include <algorithm> // std::max
+#include <atomic> // Bump offset and counters
+#include <iostream> // For outputting errors and messages
+#include <mutex> // Overflow list and lazy setup
+
+static const size_t FRAME_ARENA_DEFAULT_BYTES = 1 << 20; // Per buffer when nobody called initFrameArenas
+static const size_t FRAME_ARENA_ALIGNMENT = 64; // Buffers start on a cache line
+
+struct FrameArena
+{
+    unsigned char* memory = nullptr;
+    size_t capacity = 0;
+    std::atomic<size_t> offset{ 0 }; // Next free byte
+    std::vector<std::pair<void*, size_t>> overflow; // Heap blocks (pointer, alignment) freed at the next reset
+    size_t overflowBytes = 0;
+};
+
+static FrameArena arenas[FRAME_ARENA_MAX_BUFFERS];
+static std::atomic<unsigned> arenaCount{ 0 }; // 0 until initialized
+static unsigned currentArena = 0;
+static std::mutex arenaMutex; // Guards setup and the overflow lists
+static std::atomic<uint64_t> arenaAllocations{ 0 };
+static std::atomic<uint64_t> arenaOverflows{ 0 };
+static size_t lastFrameBytes = 0;
+static size_t peakFrameBytes = 0;
+static uint64_t arenaFrames = 0;
+
+static void freeArenaMemory(FrameArena& arena)
+{
+    if (arena.memory)
+        ::operator delete(arena.memory, std::align_val_t(FRAME_ARENA_ALIGNMENT));
+    arena.memory = nullptr;
+    arena.capacity = 0;
+}
+
+static void allocateArenaMemory(FrameArena& arena, size_t capacity)
+{
+    freeArenaMemory(arena);
+    arena.memory = (unsigned char*)::operator new(capacity, std::align_val_t(FRAME_ARENA_ALIGNMENT));
+    arena.capacity = capacity;
+}
+
+static void freeOverflow(FrameArena& arena)
+{
+    for (const std::pair<void*, size_t>& block : arena.overflow)
+        ::operator delete(block.first, std::align_val_t(block.second));
+    arena.overflow.clear();
+    arena.overflowBytes = 0;
+}
+
+static void resetArena(FrameArena& arena)
+{
+    freeOverflow(arena);
+    arena.offset.store(0, std::memory_order_relaxed);
+
+    // Outgrown: grow to the next power of two above the largest frame
+    if (peakFrameBytes > arena.capacity)
+    {
+        size_t capacity = arena.capacity;
+        while (capacity < peakFrameBytes)
+            capacity *= 2;
+        allocateArenaMemory(arena, capacity);
+    }
+}
+
+static void ensureFrameArenas()
+{
+    if (arenaCount.load(std::memory_order_acquire) == 0)
+        initFrameArenas(FRAME_ARENA_DEFAULT_BYTES, FRAME_ARENA_MAX_BUFFERS);
+}
+
+// Bumps the offset to a free, aligned range; nullptr if the buffer is full
+static void* bumpArena(FrameArena& arena, size_t size, size_t align)
+{
+    uintptr_t base = (uintptr_t)arena.memory;
+    size_t offset = arena.offset.load(std::memory_order_relaxed);
+    size_t start;
+    do
+    {
+        start = ((base + offset + align - 1) & ~(uintptr_t)(align - 1)) - base;
+        if (start + size > arena.capacity)
+            return nullptr;
+    } while (!arena.offset.compare_exchange_weak(offset, start + size, std::memory_order_relaxed));
+    return arena.memory + start;
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+void initFrameArenas(size_t bytesPerBuffer, unsigned buffers)
+{
+    std::lock_guard<std::mutex> lock(arenaMutex);
+    if (arenaCount.load() != 0)
+        return;
+    buffers = std::max(2u, std::min(buffers, FRAME_ARENA_MAX_BUFFERS));
+    bytesPerBuffer = std::max(bytesPerBuffer, FRAME_ARENA_ALIGNMENT);
+    for (unsigned i = 0; i < buffers; i++)
+        allocateArenaMemory(arenas[i], bytesPerBuffer);
+    currentArena = 0;
+    arenaCount.store(buffers, std::memory_order_release);
+}
+
+void beginFrameArena()
+{
+    ensureFrameArenas();
+    std::lock_guard<std::mutex> lock(arenaMutex);
+    FrameArena& finished = arenas[currentArena];
+    lastFrameBytes = std::min(finished.offset.load(), finished.capacity) + finished.overflowBytes;
+    peakFrameBytes = std::max(peakFrameBytes, lastFrameBytes);
+    arenaFrames++;
+
+    currentArena = (currentArena + 1) % arenaCount.load();
+    resetArena(arenas[currentArena]);
+}
+
+void releaseFrameArenas()
+{
+    std::lock_guard<std::mutex> lock(arenaMutex);
+    for (FrameArena& arena : arenas)
+    {
+        freeOverflow(arena);
+        freeArenaMemory(arena);
+        arena.offset.store(0);
+    }
+    arenaCount.store(0);
+    currentArena = 0;
+}
+
+void* frameAllocate(size_t size, size_t align)
+{
+    ensureFrameArenas();
+    FrameArena& arena = arenas[currentArena];
+    if (void* memory = bumpArena(arena, size, align))
+    {
+        arenaAllocations.fetch_add(1, std::memory_order_relaxed);
+        return memory;
+    }
+
+    // Full: take it from the heap for this frame, the buffer grows at its next reset
+    align = std::max(align, alignof(std::max_align_t));
+    void* memory = ::operator new(std::max<size_t>(size, 1), std::align_val_t(align));
+    std::lock_guard<std::mutex> lock(arenaMutex);
+    arena.overflow.push_back(std::make_pair(memory, align));
+    arena.overflowBytes += size;
+    arenaOverflows.fetch_add(1, std::memory_order_relaxed);
+    return memory;
+}
+
+FrameArenaStats frameArenaStats()
+{
+    std::lock_guard<std::mutex> lock(arenaMutex);
+    FrameArenaStats stats;
+    stats.buffers = arenaCount.load();
+    stats.capacity = stats.buffers ? arenas[currentArena].capacity : 0;
+    stats.lastFrameBytes = lastFrameBytes;
+    stats.peakBytes = peakFrameBytes;
+    stats.frames = arenaFrames;
+    stats.allocations = arenaAllocations.load();
+    stats.overflowAllocations = arenaOverflows.load();
+    return stats;
+}
+
+void printFrameArenaStats()
+{
+    FrameArenaStats stats = frameArenaStats();
+    std::cout << "Frame arena: " << stats.buffers << " x " << stats.capacity / 1024 << " KB, " << stats.frames
+              << " frames, last frame " << stats.lastFrameBytes << " bytes, peak " << stats.peakBytes << " bytes, "
+              << stats.allocations << " heap allocations avoided (" << (stats.frames ? stats.allocations / stats.frames : 0)
+              << " per frame), " << stats.overflowAllocations << " overflowed to the heap" << std::endl;
+}
+
+class FrameMemoryResource : public std::pmr::memory_resource
+{
+    void* do_allocate(size_t bytes, size_t alignment) override { return frameAllocate(bytes, alignment); }
+    void do_deallocate(void*, size_t, size_t) override {} // Reclaimed when the buffer is reset
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+std::pmr::memory_resource* frameMemoryResource()
+{
+    static FrameMemoryResource resource;
+    return &resource;
+}
+
+// ---------------------------------------------------------------------------
+// Pools
+// ---------------------------------------------------------------------------
+
+void initPool(ObjectPool& pool, size_t objectSize, size_t objectAlign, size_t objectsPerChunk)
+{
+    releasePool(pool);
+    pool.blockAlign = std::max(objectAlign, alignof(void*));
+    pool.blockSize = (std::max(objectSize, sizeof(void*)) + pool.blockAlign - 1) & ~(pool.blockAlign - 1);
+    pool.blocksPerChunk = std::max<size_t>(objectsPerChunk, 1);
+}
+
+void* poolAllocate(ObjectPool& pool)
+{
+    if (!pool.freeList)
+    {
+        // New chunk: thread its blocks onto the free list, first block first
+        unsigned char* chunk = (unsigned char*)::operator new(pool.blockSize * pool.blocksPerChunk, std::align_val_t(pool.blockAlign));
+        pool.chunks.push_back(chunk);
+        for (size_t i = pool.blocksPerChunk; i-- > 0;)
+        {
+            *(void**)(chunk + i * pool.blockSize) = pool.freeList;
+            pool.freeList = chunk + i * pool.blockSize;
+        }
+    }
+    void* block = pool.freeList;
+    pool.freeList = *(void**)block;
+    pool.allocations++;
+    pool.live++;
+    pool.peakLive = std::max(pool.peakLive, pool.live);
+    return block;
+}
+
+void poolFree(ObjectPool& pool, void* object)
+{
+    *(void**)object = pool.freeList;
+    pool.freeList = object;
+    pool.frees++;
+    pool.live--;
+}
+
+void releasePool(ObjectPool& pool)
+{
+    for (void* chunk : pool.chunks)
+        ::operator delete(chunk, std::align_val_t(pool.blockAlign));
+    pool.chunks.clear();
+    pool.freeList = nullptr;
+    pool.live = 0;
+}
+
+void printPoolStats(const char* name, const ObjectPool& pool)
+{
+    std::cout << "Pool " << name << ": " << pool.live << " live (peak " << pool.peakLive << "), " << pool.allocations
+              << " allocations from " << pool.chunks.size() << " chunks of " << pool.blocksPerChunk << " x "
+              << pool.blockSize << " bytes (" << (pool.allocations > pool.chunks.size() ? pool.allocations - pool.chunks.size() : 0)
+              << " heap allocations avoided)" << std::endl;
+}
+
+void* PoolMemoryResource::do_allocate(size_t bytes, size_t alignment)
+{
+    if (bytes <= pool.blockSize && alignment <= pool.blockAlign)
+        return poolAllocate(pool);
+    return upstream->allocate(bytes, alignment);
+}
+
+void PoolMemoryResource::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+    if (bytes <= pool.blockSize && alignment <= pool.blockAlign)
+        poolFree(pool, p);
+    else
+        upstream->deallocate(p, bytes, alignment);
+}
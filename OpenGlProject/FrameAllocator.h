@@ -0,0 +1,112 @@
+#pragma once
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+#include <memory_resource> // std::pmr adapters
+#include <new> // Placement new
+#include <utility> // std::forward
+#include <vector> // Pool chunks
+
+// Per-frame linear arena. Each frame bumps a pointer through one of FRAME_ARENA_MAX_BUFFERS buffers (2 or 3, to
+// match the frames in flight); beginFrameArena rotates to the next buffer and resets it, so memory handed out in
+// a frame stays valid until that buffer comes round again. Nothing is freed individually. Allocation is a
+// single atomic add, so worker threads can allocate too. A frame that outgrows its buffer falls back to the
+// heap and the buffer grows to the high-water mark at its next reset.
+
+const unsigned FRAME_ARENA_MAX_BUFFERS = 3;
+
+struct FrameArenaStats
+{
+    size_t capacity = 0; // Bytes per buffer
+    unsigned buffers = 0;
+    size_t lastFrameBytes = 0; // Used by the last finished frame
+    size_t peakBytes = 0; // Largest frame so far
+    uint64_t frames = 0;
+    uint64_t allocations = 0; // Served from an arena: heap allocations avoided
+    uint64_t overflowAllocations = 0; // Had to go to the heap
+};
+
+// Allocate the buffers (buffers is clamped to 2..FRAME_ARENA_MAX_BUFFERS). Done implicitly with 1 MB x 3 on
+// first use.
+void initFrameArenas(size_t bytesPerBuffer, unsigned buffers);
+
+// Start a frame: switch to the next buffer and reset it. Only call while no other thread is allocating.
+void beginFrameArena();
+
+// Free the buffers and any overflow blocks
+void releaseFrameArenas();
+
+// Aligned memory that lives until the current buffer is reset (align must be a power of two)
+void* frameAllocate(size_t size, size_t align = alignof(std::max_align_t));
+
+template <typename T>
+T* frameAllocateArray(size_t count)
+{
+    return (T*)frameAllocate(sizeof(T) * count, alignof(T));
+}
+
+FrameArenaStats frameArenaStats();
+void printFrameArenaStats();
+
+// std::pmr view of the frame arena; deallocate does nothing. Containers using it must not outlive the frame.
+std::pmr::memory_resource* frameMemoryResource();
+
+// ---------------------------------------------------------------------------
+// Pools
+// ---------------------------------------------------------------------------
+
+// Fixed-size blocks carved from chunks, recycled through an intrusive free list. Not thread-safe: guard a
+// shared pool with the owner's lock.
+struct ObjectPool
+{
+    size_t blockSize = 0; // Object size rounded up to the alignment (at least a pointer)
+    size_t blockAlign = 0;
+    size_t blocksPerChunk = 0;
+    std::vector<void*> chunks;
+    void* freeList = nullptr; // Next pointer stored in the free block itself
+    uint64_t allocations = 0; // Served from the pool: heap allocations avoided once the chunks exist
+    uint64_t frees = 0;
+    size_t live = 0;
+    size_t peakLive = 0;
+};
+
+void initPool(ObjectPool& pool, size_t objectSize, size_t objectAlign, size_t objectsPerChunk = 256);
+void* poolAllocate(ObjectPool& pool);
+void poolFree(ObjectPool& pool, void* object);
+
+// Return every chunk to the heap; live objects become invalid
+void releasePool(ObjectPool& pool);
+
+void printPoolStats(const char* name, const ObjectPool& pool);
+
+template <typename T, typename... Args>
+T* poolNew(ObjectPool& pool, Args&&... args)
+{
+    return new (poolAllocate(pool)) T(std::forward<Args>(args)...);
+}
+
+template <typename T>
+void poolDelete(ObjectPool& pool, T* object)
+{
+    if (!object)
+        return;
+    object->~T();
+    poolFree(pool, object);
+}
+
+// std::pmr view of a pool: requests that fit a block come from the pool, anything else from upstream
+class PoolMemoryResource : public std::pmr::memory_resource
+{
+public:
+    explicit PoolMemoryResource(ObjectPool& pool, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : pool(pool), upstream(upstream)
+    {
+    }
+
+private:
+    ObjectPool& pool;
+    std::pmr::memory_resource* upstream;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
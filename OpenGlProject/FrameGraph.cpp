@@ -0,0 +1,470 @@
+#include "FrameGraph.h"
+#include "FrameAllocator.h" // Per-frame scratch lists
+#include "RenderContext.h" // defaultFramebuffer
+#include <algorithm> // std::find / std::count / std::stable_sort
+#include <iostream> // For outputting errors and messages
+
+// ---------------------------------------------------------------------------
+// Backends
+// ---------------------------------------------------------------------------
+
+static unsigned int glCreateGraphTexture(const TransientDesc& desc)
+{
+    unsigned int texture = 0;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    if (desc.format == ATTACHMENT_DEPTH24)
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, desc.width, desc.height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+    else if (desc.format == ATTACHMENT_RGBA16F)
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, desc.width, desc.height, 0, GL_RGBA, GL_HALF_FLOAT, NULL);
+    else
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, desc.width, desc.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return texture;
+}
+
+static void glDeleteGraphTexture(unsigned int texture)
+{
+    glDeleteTextures(1, &texture);
+}
+
+static unsigned int glCreateGraphFramebuffer(const unsigned int* textures, const AttachmentFormat* formats, int count)
+{
+    unsigned int framebuffer = 0;
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    std::vector<GLenum> drawBuffers;
+    for (int i = 0; i < count; i++)
+    {
+        if (formats[i] == ATTACHMENT_DEPTH24)
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, textures[i], 0);
+        else
+        {
+            GLenum attachment = GL_COLOR_ATTACHMENT0 + (GLenum)drawBuffers.size();
+            glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, textures[i], 0);
+            drawBuffers.push_back(attachment);
+        }
+    }
+    if (drawBuffers.empty())
+        glDrawBuffer(GL_NONE);
+    else
+        glDrawBuffers((GLsizei)drawBuffers.size(), drawBuffers.data());
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        std::cout << "Frame graph framebuffer is incomplete" << std::endl;
+    return framebuffer;
+}
+
+static void glDeleteGraphFramebuffer(unsigned int framebuffer)
+{
+    glDeleteFramebuffers(1, &framebuffer);
+}
+
+static void glBindGraphFramebuffer(unsigned int framebuffer, int width, int height)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer ? framebuffer : defaultFramebuffer()); // 0: the imported backbuffer
+    glViewport(0, 0, width, height);
+}
+
+const FrameGraphBackend& glFrameGraphBackend()
+{
+    static const FrameGraphBackend backend = { glCreateGraphTexture, glDeleteGraphTexture, glCreateGraphFramebuffer,
+        glDeleteGraphFramebuffer, glBindGraphFramebuffer };
+    return backend;
+}
+
+// Mock: fake names and call counters
+static unsigned int mockNextName = 1; // Next fake GL name
+static int mockLiveTextures = 0, mockLiveFramebuffers = 0, mockBinds = 0; // Call counters
+
+static unsigned int mockCreateTexture(const TransientDesc&) { mockLiveTextures++; return mockNextName++; }
+static void mockDeleteTexture(unsigned int) { mockLiveTextures--; }
+static unsigned int mockCreateFramebuffer(const unsigned int*, const AttachmentFormat*, int) { mockLiveFramebuffers++; return mockNextName++; }
+static void mockDeleteFramebuffer(unsigned int) { mockLiveFramebuffers--; }
+static void mockBindFramebuffer(unsigned int, int, int) { mockBinds++; }
+
+const FrameGraphBackend& mockFrameGraphBackend()
+{
+    static const FrameGraphBackend backend = { mockCreateTexture, mockDeleteTexture, mockCreateFramebuffer,
+        mockDeleteFramebuffer, mockBindFramebuffer };
+    return backend;
+}
+
+// ---------------------------------------------------------------------------
+// Building
+// ---------------------------------------------------------------------------
+
+static size_t descBytes(const TransientDesc& desc)
+{
+    return (size_t)desc.width * desc.height * (desc.format == ATTACHMENT_RGBA16F ? 8 : 4);
+}
+
+static bool sameDesc(const TransientDesc& a, const TransientDesc& b)
+{
+    return a.width == b.width && a.height == b.height && a.format == b.format;
+}
+
+void beginFrameGraph(FrameGraph& graph, const FrameGraphBackend& backend)
+{
+    graph.backend = &backend;
+    graph.resources.clear();
+    graph.passes.clear();
+    graph.order.clear();
+}
+
+int createTransient(FrameGraph& graph, const char* name, int width, int height, AttachmentFormat format)
+{
+    GraphResource resource;
+    resource.name = name;
+    resource.desc.width = width;
+    resource.desc.height = height;
+    resource.desc.format = format;
+    graph.resources.push_back(resource);
+    return (int)graph.resources.size() - 1;
+}
+
+int importResource(FrameGraph& graph, const char* name, unsigned int texture, int width, int height, AttachmentFormat format)
+{
+    GraphResource resource;
+    resource.name = name;
+    resource.desc.width = width;
+    resource.desc.height = height;
+    resource.desc.format = format;
+    resource.imported = true;
+    resource.texture = texture;
+    graph.resources.push_back(resource);
+    return (int)graph.resources.size() - 1;
+}
+
+void addPass(FrameGraph& graph, const char* name, const std::vector<int>& reads, const std::vector<int>& writes,
+    std::function<void(FrameGraph&, const FramePass&)> execute, bool sideEffect)
+{
+    FramePass pass;
+    pass.name = name;
+    pass.reads = reads;
+    pass.writes = writes;
+    pass.sideEffect = sideEffect;
+    pass.execute = std::move(execute);
+    graph.passes.push_back(std::move(pass));
+}
+
+// ---------------------------------------------------------------------------
+// Compiling
+// ---------------------------------------------------------------------------
+
+static bool passWrites(const FramePass& pass, int resource)
+{
+    return std::find(pass.writes.begin(), pass.writes.end(), resource) != pass.writes.end();
+}
+
+// Passes that must run before pass: every other writer of what it reads
+static std::pmr::vector<int> passDependencies(const FrameGraph& graph, int pass)
+{
+    std::pmr::vector<int> dependencies(frameMemoryResource());
+    for (int resource : graph.passes[pass].reads)
+        for (int other = 0; other < (int)graph.passes.size(); other++)
+            if (other != pass && passWrites(graph.passes[other], resource))
+                dependencies.push_back(other);
+    return dependencies;
+}
+
+// Keep passes that reach a root (side effect or imported write); everything else is culled
+static void cullPasses(FrameGraph& graph)
+{
+    std::pmr::vector<int> stack(frameMemoryResource());
+    for (int i = 0; i < (int)graph.passes.size(); i++)
+    {
+        FramePass& pass = graph.passes[i];
+        pass.culled = true;
+        bool root = pass.sideEffect;
+        for (int resource : pass.writes)
+            root = root || graph.resources[resource].imported;
+        if (root)
+        {
+            pass.culled = false;
+            stack.push_back(i);
+        }
+    }
+    while (!stack.empty())
+    {
+        int pass = stack.back();
+        stack.pop_back();
+        for (int dependency : passDependencies(graph, pass))
+            if (graph.passes[dependency].culled)
+            {
+                graph.passes[dependency].culled = false;
+                stack.push_back(dependency);
+            }
+    }
+}
+
+// Kahn's algorithm over the live passes; ties keep declaration order
+static void orderPasses(FrameGraph& graph)
+{
+    int passCount = (int)graph.passes.size();
+    std::pmr::vector<std::pmr::vector<int>> dependencies(passCount, frameMemoryResource());
+    std::pmr::vector<int> remaining(passCount, 0, frameMemoryResource());
+    for (int i = 0; i < passCount; i++)
+    {
+        if (graph.passes[i].culled)
+            continue;
+        dependencies[i] = passDependencies(graph, i);
+        remaining[i] = (int)dependencies[i].size();
+    }
+
+    std::pmr::vector<bool> done(passCount, false, frameMemoryResource());
+    graph.order.clear();
+    bool progress = true;
+    while (progress)
+    {
+        progress = false;
+        for (int i = 0; i < passCount; i++)
+        {
+            if (graph.passes[i].culled || done[i] || remaining[i] > 0)
+                continue;
+            done[i] = true;
+            graph.order.push_back(i);
+            progress = true;
+            for (int j = 0; j < passCount; j++)
+                if (!graph.passes[j].culled && !done[j])
+                    remaining[j] -= (int)std::count(dependencies[j].begin(), dependencies[j].end(), i);
+            break; // Restart so the earliest declared ready pass always goes next
+        }
+    }
+
+    int liveCount = 0;
+    for (const FramePass& pass : graph.passes)
+        liveCount += pass.culled ? 0 : 1;
+    if ((int)graph.order.size() != liveCount)
+    {
+        std::cout << "Frame graph has a cycle, running passes in declaration order" << std::endl;
+        graph.order.clear();
+        for (int i = 0; i < passCount; i++)
+            if (!graph.passes[i].culled)
+                graph.order.push_back(i);
+    }
+}
+
+void compileFrameGraph(FrameGraph& graph)
+{
+    cullPasses(graph);
+    orderPasses(graph);
+
+    // Lifetimes as positions in the execution order
+    for (int position = 0; position < (int)graph.order.size(); position++)
+    {
+        const FramePass& pass = graph.passes[graph.order[position]];
+        for (const std::vector<int>* list : { &pass.reads, &pass.writes })
+            for (int resource : *list)
+            {
+                GraphResource& r = graph.resources[resource];
+                if (r.firstUse < 0)
+                    r.firstUse = position;
+                r.lastUse = position;
+            }
+        for (int resource : pass.writes)
+            if (graph.resources[resource].producer < 0)
+                graph.resources[resource].producer = graph.order[position];
+    }
+
+    // Transients in order of first use; each takes a matching physical texture whose occupant has died
+    std::pmr::vector<int> transients(frameMemoryResource());
+    for (int i = 0; i < (int)graph.resources.size(); i++)
+        if (!graph.resources[i].imported && graph.resources[i].firstUse >= 0)
+            transients.push_back(i);
+    std::stable_sort(transients.begin(), transients.end(),
+        [&](int a, int b) { return graph.resources[a].firstUse < graph.resources[b].firstUse; });
+
+    for (PhysicalTexture& texture : graph.physical)
+        texture.busyUntil = -2; // Untouched this frame
+    graph.frameAllocations = 0;
+    graph.aliasedBytes = 0;
+    graph.unaliasedBytes = 0;
+    for (int index : transients)
+    {
+        GraphResource& resource = graph.resources[index];
+        graph.unaliasedBytes += descBytes(resource.desc);
+        int chosen = -1;
+        for (int p = 0; p < (int)graph.physical.size() && chosen < 0; p++)
+            if (sameDesc(graph.physical[p].desc, resource.desc) && graph.physical[p].busyUntil < resource.firstUse)
+                chosen = p;
+        if (chosen < 0)
+        {
+            PhysicalTexture texture;
+            texture.desc = resource.desc;
+            texture.texture = graph.backend->createTexture(resource.desc);
+            texture.busyUntil = -2;
+            graph.physical.push_back(texture);
+            chosen = (int)graph.physical.size() - 1;
+            graph.frameAllocations++;
+        }
+        PhysicalTexture& texture = graph.physical[chosen];
+        if (texture.busyUntil == -2)
+            graph.aliasedBytes += descBytes(texture.desc); // First occupant this frame
+        texture.busyUntil = resource.lastUse;
+        texture.idleFrames = 0;
+        resource.physical = chosen;
+        resource.texture = texture.texture;
+    }
+
+    // Drop textures that no frame has needed for a while, along with framebuffers that use them
+    for (size_t p = 0; p < graph.physical.size();)
+    {
+        PhysicalTexture& texture = graph.physical[p];
+        if (texture.busyUntil == -2 && ++texture.idleFrames > FRAME_GRAPH_IDLE_FRAMES)
+        {
+            for (size_t f = 0; f < graph.framebuffers.size();)
+            {
+                std::vector<unsigned int>& attached = graph.framebuffers[f].textures;
+                if (std::find(attached.begin(), attached.end(), texture.texture) != attached.end())
+                {
+                    graph.backend->deleteFramebuffer(graph.framebuffers[f].framebuffer);
+                    graph.framebuffers.erase(graph.framebuffers.begin() + f);
+                }
+                else
+                    f++;
+            }
+            graph.backend->deleteTexture(texture.texture);
+            graph.physical.erase(graph.physical.begin() + p);
+            for (GraphResource& resource : graph.resources)
+                if (resource.physical > (int)p)
+                    resource.physical--;
+        }
+        else
+            p++;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Executing
+// ---------------------------------------------------------------------------
+
+static unsigned int passFramebuffer(FrameGraph& graph, const FramePass& pass)
+{
+    std::vector<unsigned int> textures;
+    std::vector<AttachmentFormat> formats;
+    for (int resource : pass.writes)
+    {
+        if (graph.resources[resource].imported && graph.resources[resource].texture == 0)
+            return 0; // Default framebuffer
+        textures.push_back(graph.resources[resource].texture);
+        formats.push_back(graph.resources[resource].desc.format);
+    }
+    for (GraphFramebuffer& cached : graph.framebuffers)
+        if (cached.textures == textures)
+        {
+            cached.idleFrames = 0;
+            return cached.framebuffer;
+        }
+    GraphFramebuffer created;
+    created.textures = textures;
+    created.framebuffer = graph.backend->createFramebuffer(textures.data(), formats.data(), (int)textures.size());
+    graph.framebuffers.push_back(created);
+    return created.framebuffer;
+}
+
+void executeFrameGraph(FrameGraph& graph)
+{
+    for (GraphFramebuffer& cached : graph.framebuffers)
+        cached.idleFrames++;
+
+    for (int index : graph.order)
+    {
+        const FramePass& pass = graph.passes[index];
+        if (!pass.writes.empty())
+        {
+            const TransientDesc& desc = graph.resources[pass.writes[0]].desc;
+            graph.backend->bindFramebuffer(passFramebuffer(graph, pass), desc.width, desc.height);
+        }
+        if (pass.execute)
+            pass.execute(graph, pass);
+    }
+
+    for (size_t f = 0; f < graph.framebuffers.size();)
+    {
+        if (graph.framebuffers[f].idleFrames > FRAME_GRAPH_IDLE_FRAMES)
+        {
+            graph.backend->deleteFramebuffer(graph.framebuffers[f].framebuffer);
+            graph.framebuffers.erase(graph.framebuffers.begin() + f);
+        }
+        else
+            f++;
+    }
+}
+
+unsigned int graphTexture(const FrameGraph& graph, int resource)
+{
+    return graph.resources[resource].texture;
+}
+
+void printFrameGraph(const FrameGraph& graph)
+{
+    std::cout << "Frame graph:";
+    for (int index : graph.order)
+        std::cout << " " << graph.passes[index].name;
+    for (const FramePass& pass : graph.passes)
+        if (pass.culled)
+            std::cout << " [culled " << pass.name << "]";
+    std::cout << std::endl;
+    for (const GraphResource& resource : graph.resources)
+        if (!resource.imported && resource.firstUse >= 0)
+            std::cout << "  " << resource.name << " " << resource.desc.width << "x" << resource.desc.height
+                      << " passes " << resource.firstUse << "-" << resource.lastUse << " -> physical " << resource.physical << std::endl;
+    std::cout << "  " << graph.aliasedBytes / (1024.0 * 1024.0) << " MB aliased vs " << graph.unaliasedBytes / (1024.0 * 1024.0)
+              << " MB without aliasing, " << graph.frameAllocations << " textures allocated this frame" << std::endl;
+}
+
+void releaseFrameGraph(FrameGraph& graph)
+{
+    if (!graph.backend)
+        return;
+    for (GraphFramebuffer& cached : graph.framebuffers)
+        graph.backend->deleteFramebuffer(cached.framebuffer);
+    for (PhysicalTexture& texture : graph.physical)
+        graph.backend->deleteTexture(texture.texture);
+    graph.framebuffers.clear();
+    graph.physical.clear();
+    graph.resources.clear();
+    graph.passes.clear();
+    graph.order.clear();
+}
+
+void runFrameGraphSelfCheck()
+{
+    FrameGraph graph;
+    int executed = 0;
+    auto count = [&](FrameGraph&, const FramePass&) { executed++; };
+    for (int frame = 0; frame < 3; frame++)
+    {
+        beginFrameGraph(graph, mockFrameGraphBackend());
+        int backbuffer = importResource(graph, "backbuffer", 0, 1280, 720);
+        int shadowMap = createTransient(graph, "shadowMap", 2048, 2048, ATTACHMENT_DEPTH24);
+        int sceneColor = createTransient(graph, "sceneColor", 1280, 720, ATTACHMENT_RGBA16F);
+        int sceneDepth = createTransient(graph, "sceneDepth", 1280, 720, ATTACHMENT_DEPTH24);
+        int bloomA = createTransient(graph, "bloomBright", 640, 360, ATTACHMENT_RGBA16F);
+        int bloomB = createTransient(graph, "bloomBlurX", 640, 360, ATTACHMENT_RGBA16F);
+        int bloomC = createTransient(graph, "bloomBlurY", 640, 360, ATTACHMENT_RGBA16F);
+        int debugView = createTransient(graph, "debugDepth", 1280, 720, ATTACHMENT_RGBA8);
+
+        // Declared out of order on purpose: tonemap first, shadow last
+        addPass(graph, "tonemap", { sceneColor, bloomC }, { backbuffer }, count);
+        addPass(graph, "debugDepth", { sceneDepth }, { debugView }, count); // Nobody reads debugView
+        addPass(graph, "scene", { shadowMap }, { sceneColor, sceneDepth }, count);
+        addPass(graph, "bright", { sceneColor }, { bloomA }, count);
+        addPass(graph, "blurX", { bloomA }, { bloomB }, count);
+        addPass(graph, "blurY", { bloomB }, { bloomC }, count);
+        addPass(graph, "shadow", {}, { shadowMap }, count);
+
+        compileFrameGraph(graph);
+        executeFrameGraph(graph);
+        if (frame == 0 || frame == 2)
+            printFrameGraph(graph);
+    }
+    std::cout << "Mock backend: " << executed << " passes executed, " << mockLiveTextures << " live textures, "
+              << mockLiveFramebuffers << " live framebuffers, " << mockBinds << " binds" << std::endl;
+    releaseFrameGraph(graph);
+    std::cout << "After release: " << mockLiveTextures << " textures, " << mockLiveFramebuffers << " framebuffers" << std::endl;
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <functional> // Pass callbacks
+#include <string> // Pass and resource names
+#include <vector> // Passes, resources, physical textures
+#include "RenderTargets.h" // AttachmentFormat
+
+// Size and format of a transient texture
+struct TransientDesc
+{
+    int width = 0; // Pixels
+    int height = 0;
+    AttachmentFormat format = ATTACHMENT_RGBA8; // Internal format
+};
+
+// GL entry points the graph uses, so it can run against a mock that only counts
+struct FrameGraphBackend
+{
+    unsigned int (*createTexture)(const TransientDesc& desc); // Returns a texture name
+    void (*deleteTexture)(unsigned int texture);
+    unsigned int (*createFramebuffer)(const unsigned int* textures, const AttachmentFormat* formats, int count);
+    void (*deleteFramebuffer)(unsigned int framebuffer);
+    void (*bindFramebuffer)(unsigned int framebuffer, int width, int height); // Also sets the viewport
+};
+
+// Backend that calls OpenGL (render context current)
+const FrameGraphBackend& glFrameGraphBackend();
+
+// Backend that hands out fake names and counts calls; no context needed
+const FrameGraphBackend& mockFrameGraphBackend();
+
+// A virtual resource; several of them may share one physical texture
+struct GraphResource
+{
+    std::string name; // For logs
+    TransientDesc desc; // Size / format (unused for imported resources)
+    bool imported = false; // Owned outside the graph (e.g. the default framebuffer)
+    unsigned int texture = 0; // Physical texture (imported: the given name, 0 = default framebuffer)
+    int producer = -1; // Pass that writes it
+    int firstUse = -1; // Index into the execution order
+    int lastUse = -1;
+    int physical = -1; // Index into FrameGraph::physical
+};
+
+struct FrameGraph;
+
+// One pass: declared reads/writes plus the code that records it
+struct FramePass
+{
+    std::string name; // For logs
+    std::vector<int> reads; // Resource handles sampled by the pass
+    std::vector<int> writes; // Resource handles rendered to (all the same size)
+    bool sideEffect = false; // Never culled (writes outside the graph)
+    bool culled = false; // Set by compileFrameGraph
+    std::function<void(FrameGraph&, const FramePass&)> execute; // Draw calls
+};
+
+// A texture the graph owns; kept across frames so steady-state frames allocate nothing
+struct PhysicalTexture
+{
+    TransientDesc desc; // Must match exactly to be shared
+    unsigned int texture = 0; // GL texture name
+    int busyUntil = -1; // Last execution index of the current occupant this frame
+    int idleFrames = 0; // Frames in a row nobody used it
+};
+
+// Cached framebuffer for one combination of attachments
+struct GraphFramebuffer
+{
+    std::vector<unsigned int> textures; // Attachments in order
+    unsigned int framebuffer = 0; // GL name
+    int idleFrames = 0; // Frames in a row nobody bound it
+};
+
+struct FrameGraph
+{
+    const FrameGraphBackend* backend = nullptr; // GL or mock
+    std::vector<GraphResource> resources; // Rebuilt every frame
+    std::vector<FramePass> passes; // Rebuilt every frame
+    std::vector<int> order; // Execution order of the live passes
+    std::vector<PhysicalTexture> physical; // Persistent texture pool
+    std::vector<GraphFramebuffer> framebuffers; // Persistent framebuffer cache
+    size_t frameAllocations = 0; // Textures created by the last compile
+    size_t aliasedBytes = 0; // Physical bytes needed by the last frame
+    size_t unaliasedBytes = 0; // Bytes if every transient had its own texture
+};
+
+// Frames an unused physical texture or framebuffer survives before it is deleted
+const int FRAME_GRAPH_IDLE_FRAMES = 60;
+
+// Start a new frame: drops passes and resources, keeps the physical pool
+void beginFrameGraph(FrameGraph& graph, const FrameGraphBackend& backend);
+
+// Declare a transient texture (lives only inside this frame)
+int createTransient(FrameGraph& graph, const char* name, int width, int height, AttachmentFormat format);
+
+// Declare an existing texture, or the default framebuffer with texture 0
+int importResource(FrameGraph& graph, const char* name, unsigned int texture, int width, int height,
+    AttachmentFormat format = ATTACHMENT_RGBA8);
+
+// Declare a pass; passes writing imported resources are roots and never culled
+void addPass(FrameGraph& graph, const char* name, const std::vector<int>& reads, const std::vector<int>& writes,
+    std::function<void(FrameGraph&, const FramePass&)> execute, bool sideEffect = false);
+
+// Cull, order, compute lifetimes and assign (alias) physical textures
+void compileFrameGraph(FrameGraph& graph);
+
+// Run the live passes in order, binding each pass's framebuffer first
+void executeFrameGraph(FrameGraph& graph);
+
+// Physical texture behind a handle (valid after compileFrameGraph)
+unsigned int graphTexture(const FrameGraph& graph, int resource);
+
+// Print order, culled passes and memory with / without aliasing
+void printFrameGraph(const FrameGraph& graph);
+
+// Delete every physical texture and framebuffer
+void releaseFrameGraph(FrameGraph& graph);
+
+// Build a shadow / scene / bloom / tonemap graph (plus an unused debug pass) on the mock backend and report
+void runFrameGraphSelfCheck();
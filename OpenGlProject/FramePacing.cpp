@@ -0,0 +1,84 @@
+#include "FramePacing.h"
+#include <algorithm> // std::min / std::max
+#include <chrono> // Wait time
+#include <iostream> // For outputting errors and messages
+
+static const GLuint64 FRAME_PACER_TIMEOUT_NS = 100000000; // Re-check interval while the GPU is busy (100 ms)
+
+void initFramePacer(FramePacer& pacer, int framesInFlight)
+{
+    releaseFramePacer(pacer);
+    pacer = FramePacer();
+    pacer.framesInFlight = std::max(1, std::min(framesInFlight, FRAME_PACER_MAX_FRAMES));
+}
+
+void waitForFrameSlot(FramePacer& pacer)
+{
+    GLsync& fence = pacer.fences[pacer.frame % pacer.framesInFlight];
+    if (!fence)
+        return; // Fewer frames than slots so far
+
+    GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    if (status == GL_TIMEOUT_EXPIRED)
+    {
+        auto start = std::chrono::steady_clock::now();
+        do
+            status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FRAME_PACER_TIMEOUT_NS);
+        while (status == GL_TIMEOUT_EXPIRED);
+        pacer.waits++;
+        pacer.waitedMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    if (status == GL_WAIT_FAILED)
+        std::cout << "Frame fence wait failed" << std::endl;
+    glDeleteSync(fence);
+    fence = nullptr;
+}
+
+void endPacedFrame(FramePacer& pacer)
+{
+    GLsync& fence = pacer.fences[pacer.frame % pacer.framesInFlight];
+    if (fence)
+        glDeleteSync(fence); // waitForFrameSlot was skipped
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    pacer.frame++;
+}
+
+void recordInputLatency(FramePacer& pacer, double ms)
+{
+    pacer.latencyFrames++;
+    pacer.latencySumMs += ms;
+    pacer.latencyMaxMs = std::max(pacer.latencyMaxMs, (float)ms);
+    if (pacer.latencyMs.size() < FRAME_PACER_LATENCY_SAMPLES)
+        pacer.latencyMs.push_back((float)ms);
+    else
+    {
+        pacer.latencyMs[pacer.latencyNext] = (float)ms; // Long sessions: keep memory flat
+        pacer.latencyNext = (pacer.latencyNext + 1) % FRAME_PACER_LATENCY_SAMPLES;
+    }
+}
+
+void releaseFramePacer(FramePacer& pacer)
+{
+    for (GLsync& fence : pacer.fences)
+    {
+        if (fence)
+            glDeleteSync(fence);
+        fence = nullptr;
+    }
+    if (pacer.frame > 0)
+        std::cout << "Frame pacing: " << pacer.framesInFlight << " frames in flight, " << pacer.waits << " of "
+                  << pacer.frame << " frames waited for the GPU (" << pacer.waitedMs << " ms total)" << std::endl;
+
+    std::vector<float>& samples = pacer.latencyMs;
+    if (!samples.empty())
+    {
+        std::sort(samples.begin(), samples.end());
+        auto percentile = [&](double p) { return samples[std::min(samples.size() - 1, (size_t)(p * samples.size()))]; };
+        std::cout << "Input latency (mouse event to swap): " << pacer.latencyFrames << " frames, mean "
+                  << pacer.latencySumMs / pacer.latencyFrames << " ms, max " << pacer.latencyMaxMs << " ms; last "
+                  << samples.size() << " frames: median " << percentile(0.5) << " ms, p95 " << percentile(0.95) << " ms"
+                  << std::endl;
+    }
+    samples.clear();
+    pacer.latencyNext = 0;
+}
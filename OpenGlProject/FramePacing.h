@@ -0,0 +1,39 @@
+#pragma once
+#include <glad/glad.h> // GLsync
+#include <cstdint> // Statistics
+#include <vector> // Latency samples
+
+// Bounds how far the CPU runs ahead of the GPU. A fence goes in after every frame's swap; before recording
+// frame N the render thread waits for the fence of frame N - framesInFlight, so at most framesInFlight frames
+// are queued in the driver (1 = lowest latency, 2 = CPU and GPU overlap).
+const int FRAME_PACER_MAX_FRAMES = 2;
+const size_t FRAME_PACER_LATENCY_SAMPLES = 4096; // Latency samples kept for the percentiles; older ones are overwritten
+
+struct FramePacer
+{
+    int framesInFlight = 2;
+    GLsync fences[FRAME_PACER_MAX_FRAMES] = {}; // One per frame in flight, oldest next
+    uint64_t frame = 0; // Frames ended so far
+    uint64_t waits = 0; // Frames that had to wait for the GPU
+    double waitedMs = 0.0; // Total time spent in those waits
+    std::vector<float> latencyMs; // Ring of the last FRAME_PACER_LATENCY_SAMPLES input-to-swap latencies
+    size_t latencyNext = 0; // Ring slot the next sample overwrites once the ring is full
+    uint64_t latencyFrames = 0; // Frames that answered input, over the whole run
+    double latencySumMs = 0.0; // Their total latency, for the mean
+    float latencyMaxMs = 0.0f; // Their worst latency
+};
+
+void initFramePacer(FramePacer& pacer, int framesInFlight);
+
+// Before recording a frame: blocks until a frame slot is free
+void waitForFrameSlot(FramePacer& pacer);
+
+// After the swap: fence the frame
+void endPacedFrame(FramePacer& pacer);
+
+// After the swap of a frame that consumed input: milliseconds since the input event
+void recordInputLatency(FramePacer& pacer, double ms);
+
+// Delete outstanding fences and print how often the CPU waited and the input latency: mean and max over the run,
+// percentiles over the recent samples
+void releaseFramePacer(FramePacer& pacer);
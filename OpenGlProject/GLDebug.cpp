@@ -0,0 +1,285 @@
+#include "GLDebug.h"
+
+#ifdef GLAD_DEBUG
+#include <algorithm> // std::lower_bound / std::sort
+#include <chrono> // Rate limit window
+#include <cstdarg> // Hook arguments
+#include <cstdint> // Occurrence counts
+#include <cstdio> // snprintf
+#include <cstring> // strcmp / strlen
+#include <iostream> // For outputting errors and messages
+#include <mutex> // The log is shared by every thread that has a context
+#include <string> // Log lines and keys
+#include <unordered_map> // Occurrences per error or message
+#include <vector> // Summary order
+
+struct GlDebugSignature
+{
+    const char* name;
+    const char* kinds; // One letter per argument
+};
+
+#include "GLDebugFunctions.inl"
+
+static const int GL_DEBUG_LOG_PER_SECOND = 20; // New log lines per second; further new entries are only counted
+static const size_t GL_DEBUG_SUMMARY_ENTRIES = 10; // Most frequent entries printed by stopGlDebug
+static const int GL_DEBUG_MAX_ERRORS_PER_CALL = 8; // A driver keeps at most one flag per error code
+
+// GL_KHR_debug, which the GL 3.3 glad build does not load
+typedef void (APIENTRY* GlDebugProc)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length,
+                                     const GLchar* message, const void* userParam);
+typedef void (APIENTRY* PfnGlDebugMessageCallback)(GlDebugProc callback, const void* userParam);
+typedef void (APIENTRY* PfnGlDebugMessageControl)(GLenum source, GLenum type, GLenum severity, GLsizei count,
+                                                  const GLuint* ids, GLboolean enabled);
+static const GLenum GL_DEBUG_OUTPUT = 0x92E0;
+static const GLenum GL_DEBUG_OUTPUT_SYNCHRONOUS = 0x8242;
+static const GLenum GL_DEBUG_SEVERITY_HIGH = 0x9146;
+static const GLenum GL_DEBUG_SEVERITY_MEDIUM = 0x9147;
+static const GLenum GL_DEBUG_SEVERITY_LOW = 0x9148;
+static const GLenum GL_DEBUG_SEVERITY_NOTIFICATION = 0x826B;
+
+struct GlDebugEntry
+{
+    uint64_t count = 0; // Occurrences
+    std::string line; // As logged the first time
+};
+
+static std::mutex logMutex; // Guards everything below
+static std::unordered_map<std::string, GlDebugEntry> entries; // By error or message identity
+static std::chrono::steady_clock::time_point windowStart; // Current one-second rate limit window
+static int windowLines = 0; // Lines printed in the window
+static uint64_t suppressedLines = 0; // New entries the rate limit kept off the log
+
+static thread_local const char* currentCall = nullptr; // gl* function running on this thread, for KHR_debug messages
+static thread_local std::string callError; // KHR_debug's explanation of the error the current call raised
+static PFNGLGETERRORPROC getError = nullptr; // The driver's glGetError, taken before a trace can wrap it
+static PfnGlDebugMessageCallback debugMessageCallback = nullptr;
+static bool debugRunning = false;
+
+// Count an occurrence of key; the first one is printed unless the rate limit is reached
+static void logGlDebug(const std::string& key, const std::string& line)
+{
+    std::lock_guard<std::mutex> lock(logMutex);
+    GlDebugEntry& entry = entries[key];
+    if (entry.count++ > 0)
+        return; // Repeat: only counted
+    entry.line = line;
+
+    auto now = std::chrono::steady_clock::now();
+    if (now - windowStart >= std::chrono::seconds(1))
+    {
+        windowStart = now;
+        windowLines = 0;
+    }
+    if (windowLines >= GL_DEBUG_LOG_PER_SECOND)
+    {
+        suppressedLines++;
+        return;
+    }
+    windowLines++;
+    std::cout << line << std::endl;
+}
+
+static std::string glErrorName(GLenum error)
+{
+    switch (error)
+    {
+    case GL_INVALID_ENUM: return "GL_INVALID_ENUM";
+    case GL_INVALID_VALUE: return "GL_INVALID_VALUE";
+    case GL_INVALID_OPERATION: return "GL_INVALID_OPERATION";
+    case GL_OUT_OF_MEMORY: return "GL_OUT_OF_MEMORY";
+    case GL_INVALID_FRAMEBUFFER_OPERATION: return "GL_INVALID_FRAMEBUFFER_OPERATION";
+    }
+    char hex[16];
+    snprintf(hex, sizeof(hex), "0x%04X", error);
+    return hex;
+}
+
+// "glTexImage2D(0x0DE1, 0, ...)" from the hook's arguments and the generated argument kinds
+static std::string formatCall(const char* name, int argumentCount, va_list args)
+{
+    const GlDebugSignature* end = glDebugSignatures + sizeof(glDebugSignatures) / sizeof(glDebugSignatures[0]);
+    const GlDebugSignature* signature = std::lower_bound(glDebugSignatures, end, name,
+        [](const GlDebugSignature& entry, const char* key) { return strcmp(entry.name, key) < 0; });
+    std::string call = std::string(name) + "(";
+    if (signature == end || strcmp(signature->name, name) != 0 || (int)strlen(signature->kinds) != argumentCount)
+        return call + "...)"; // Not a function this build knows how to decode
+
+    for (int i = 0; i < argumentCount; i++)
+    {
+        char text[32];
+        switch (signature->kinds[i])
+        {
+        case 'e': snprintf(text, sizeof(text), "0x%04X", va_arg(args, unsigned)); break;
+        case 'x': snprintf(text, sizeof(text), "0x%X", va_arg(args, unsigned)); break;
+        case 'i': snprintf(text, sizeof(text), "%d", va_arg(args, int)); break;
+        case 'u': snprintf(text, sizeof(text), "%u", va_arg(args, unsigned)); break;
+        case 'f': snprintf(text, sizeof(text), "%g", va_arg(args, double)); break;
+        case 'z': snprintf(text, sizeof(text), "%lld", (long long)va_arg(args, GLsizeiptr)); break;
+        case 'l': snprintf(text, sizeof(text), "%lld", (long long)va_arg(args, GLint64)); break;
+        case 'L': snprintf(text, sizeof(text), "%llu", (unsigned long long)va_arg(args, GLuint64)); break;
+        default: snprintf(text, sizeof(text), "%p", va_arg(args, void*)); break;
+        }
+        call += (i ? ", " : "") + std::string(text);
+    }
+    return call + ")";
+}
+
+// ---------------------------------------------------------------------------
+// Hooks
+// ---------------------------------------------------------------------------
+
+static void glDebugPreCall(const char* name, void*, int, ...)
+{
+    currentCall = name;
+}
+
+static void glDebugPostCall(const char* name, void*, int argumentCount, ...)
+{
+    currentCall = nullptr;
+    if (strcmp(name, "glGetError") == 0)
+        return; // The caller checks errors itself; don't take them away
+
+    std::string explanation;
+    explanation.swap(callError);
+
+    for (int i = 0; i < GL_DEBUG_MAX_ERRORS_PER_CALL; i++)
+    {
+        GLenum error = GLAD_GL_FUNCTION(PFNGLGETERRORPROC, GetError, getError)(); // This thread's table if contexts differ
+        if (error == GL_NO_ERROR)
+            return;
+        va_list args;
+        va_start(args, argumentCount);
+        std::string call = formatCall(name, argumentCount, args);
+        va_end(args);
+        std::string line = "GL error " + glErrorName(error) + " in " + call;
+        if (!explanation.empty())
+            line += ": " + explanation;
+        explanation.clear(); // Belongs to the first error only
+        logGlDebug(std::string(name) + "/" + std::to_string(error), line);
+    }
+}
+
+static const char* debugSourceName(GLenum source)
+{
+    switch (source)
+    {
+    case 0x8246: return "API";
+    case 0x8247: return "window system";
+    case 0x8248: return "shader compiler";
+    case 0x8249: return "third party";
+    case 0x824A: return "application";
+    }
+    return "other";
+}
+
+static const char* debugTypeName(GLenum type)
+{
+    switch (type)
+    {
+    case 0x824C: return "error";
+    case 0x824D: return "deprecated";
+    case 0x824E: return "undefined behavior";
+    case 0x824F: return "portability";
+    case 0x8250: return "performance";
+    case 0x8268: return "marker";
+    }
+    return "message";
+}
+
+static const char* debugSeverityName(GLenum severity)
+{
+    switch (severity)
+    {
+    case GL_DEBUG_SEVERITY_HIGH: return "high";
+    case GL_DEBUG_SEVERITY_MEDIUM: return "medium";
+    case GL_DEBUG_SEVERITY_LOW: return "low";
+    }
+    return "info";
+}
+
+static void APIENTRY glDebugMessage(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length,
+                                    const GLchar* message, const void*)
+{
+    std::string text(message, length >= 0 ? (size_t)length : strlen(message));
+    while (!text.empty() && (text.back() == '\n' || text.back() == '\r'))
+        text.pop_back();
+    if (source == 0x8246 && type == 0x824C && currentCall)
+    {
+        callError = text; // The post-call hook logs it with the call's arguments
+        return;
+    }
+    std::string line = std::string("GL ") + debugTypeName(type) + " (" + debugSeverityName(severity) + ", "
+                     + debugSourceName(source) + "): " + text;
+    if (currentCall)
+        line += " [in " + std::string(currentCall) + "]"; // Synchronous output: raised by this call
+    logGlDebug(std::to_string(source) + "/" + std::to_string(type) + "/" + std::to_string(id) + "/" + text, line);
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+bool startGlDebug(GLADloadproc loader)
+{
+    getError = glad_glGetError;
+    windowStart = std::chrono::steady_clock::now();
+    glad_set_pre_callback(glDebugPreCall);
+    glad_set_post_callback(glDebugPostCall);
+    debugRunning = true;
+
+    // KHR_debug is core from 4.3; older drivers may still offer the extension
+    bool khrDebug = GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 3);
+    GLint extensionCount = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+    for (GLint i = 0; i < extensionCount && !khrDebug; i++)
+        khrDebug = strcmp((const char*)glGetStringi(GL_EXTENSIONS, (GLuint)i), "GL_KHR_debug") == 0;
+    debugMessageCallback = khrDebug && loader ? (PfnGlDebugMessageCallback)loader("glDebugMessageCallback") : nullptr;
+    PfnGlDebugMessageControl debugMessageControl = debugMessageCallback ? (PfnGlDebugMessageControl)loader("glDebugMessageControl") : nullptr;
+    if (!debugMessageCallback)
+    {
+        std::cout << "GL debug: checking every call for errors (no GL_KHR_debug)" << std::endl;
+        return true;
+    }
+
+    glEnable(GL_DEBUG_OUTPUT);
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS); // Messages arrive inside the call that caused them
+    if (debugMessageControl)
+        debugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE); // Allocation chatter
+    debugMessageCallback(glDebugMessage, nullptr);
+    std::cout << "GL debug: checking every call for errors, logging GL_KHR_debug messages" << std::endl;
+    return true;
+}
+
+void stopGlDebug()
+{
+    if (!debugRunning)
+        return;
+    if (debugMessageCallback)
+    {
+        debugMessageCallback(nullptr, nullptr);
+        glDisable(GL_DEBUG_OUTPUT);
+        debugMessageCallback = nullptr;
+    }
+    glad_set_pre_callback(nullptr);
+    glad_set_post_callback(nullptr);
+    debugRunning = false;
+
+    std::lock_guard<std::mutex> lock(logMutex);
+    uint64_t occurrences = 0;
+    std::vector<const GlDebugEntry*> frequent;
+    for (const auto& entry : entries)
+    {
+        occurrences += entry.second.count;
+        frequent.push_back(&entry.second);
+    }
+    std::cout << "GL debug: " << entries.size() << " distinct errors and messages, " << occurrences << " occurrences, "
+              << suppressedLines << " kept off the log by the rate limit" << std::endl;
+    std::sort(frequent.begin(), frequent.end(), [](const GlDebugEntry* a, const GlDebugEntry* b) { return a->count > b->count; });
+    for (size_t i = 0; i < frequent.size() && i < GL_DEBUG_SUMMARY_ENTRIES; i++)
+        std::cout << "  " << frequent[i]->count << " x " << frequent[i]->line << std::endl;
+    entries.clear();
+    suppressedLines = 0;
+}
+
+#endif
@@ -0,0 +1,25 @@
+#pragma once
+#include <glad/glad.h> // GLADloadproc
+
+// GL error checking for Debug builds. With GLAD_DEBUG defined (Debug builds define it) every gl* call goes through
+// a glad wrapper with pre- and post-call hooks (tools/gen_glad_debug.py): the post hook calls glGetError and logs
+// the failing call with its arguments. If the driver has GL_KHR_debug its messages are logged too, synchronously,
+// so each one names the call that raised it. The log prints the first occurrence of each error or message and
+// counts repeats, and prints at most GL_DEBUG_LOG_PER_SECOND new lines a second; stopGlDebug prints the totals
+// and the most frequent entries. Without GLAD_DEBUG gl* are glad's raw pointers and all of this compiles to nothing.
+
+#ifdef GLAD_DEBUG
+
+// Install the hooks and, if available, the KHR_debug callback on the current context. loader is the
+// getProcAddress glad was loaded through; glDebugMessageCallback is not part of the GL 3.3 glad build.
+bool startGlDebug(GLADloadproc loader);
+
+// Remove the hooks and the callback, print the totals; call on the thread that owns the context
+void stopGlDebug();
+
+#else
+
+inline bool startGlDebug(GLADloadproc) { return false; }
+inline void stopGlDebug() {}
+
+#endif
@@ -0,0 +1,380 @@
+// Generated by tools/gen_glad_debug.py from include/glad/glad.h; do not edit.
+// Argument kinds by function name: e GLenum, x GLbitfield, i int, u unsigned, f float or double,
+// z GLintptr / GLsizeiptr, l GLint64, L GLuint64, p pointer or GLsync.
+
+static const GlDebugSignature glDebugSignatures[] = {
+    { "glActiveTexture", "e" },
+    { "glAttachShader", "uu" },
+    { "glBeginConditionalRender", "ue" },
+    { "glBeginQuery", "eu" },
+    { "glBeginTransformFeedback", "e" },
+    { "glBindAttribLocation", "uup" },
+    { "glBindBuffer", "eu" },
+    { "glBindBufferBase", "euu" },
+    { "glBindBufferRange", "euuzz" },
+    { "glBindFragDataLocation", "uup" },
+    { "glBindFragDataLocationIndexed", "uuup" },
+    { "glBindFramebuffer", "eu" },
+    { "glBindRenderbuffer", "eu" },
+    { "glBindSampler", "uu" },
+    { "glBindTexture", "eu" },
+    { "glBindVertexArray", "u" },
+    { "glBlendColor", "ffff" },
+    { "glBlendEquation", "e" },
+    { "glBlendEquationSeparate", "ee" },
+    { "glBlendFunc", "ee" },
+    { "glBlendFuncSeparate", "eeee" },
+    { "glBlitFramebuffer", "iiiiiiiixe" },
+    { "glBufferData", "ezpe" },
+    { "glBufferSubData", "ezzp" },
+    { "glCheckFramebufferStatus", "e" },
+    { "glClampColor", "ee" },
+    { "glClear", "x" },
+    { "glClearBufferfi", "eifi" },
+    { "glClearBufferfv", "eip" },
+    { "glClearBufferiv", "eip" },
+    { "glClearBufferuiv", "eip" },
+    { "glClearColor", "ffff" },
+    { "glClearDepth", "f" },
+    { "glClearStencil", "i" },
+    { "glClientWaitSync", "pxL" },
+    { "glColorMask", "uuuu" },
+    { "glColorMaski", "uuuuu" },
+    { "glColorP3ui", "eu" },
+    { "glColorP3uiv", "ep" },
+    { "glColorP4ui", "eu" },
+    { "glColorP4uiv", "ep" },
+    { "glCompileShader", "u" },
+    { "glCompressedTexImage1D", "eieiiip" },
+    { "glCompressedTexImage2D", "eieiiiip" },
+    { "glCompressedTexImage3D", "eieiiiiip" },
+    { "glCompressedTexSubImage1D", "eiiieip" },
+    { "glCompressedTexSubImage2D", "eiiiiieip" },
+    { "glCompressedTexSubImage3D", "eiiiiiiieip" },
+    { "glCopyBufferSubData", "eezzz" },
+    { "glCopyTexImage1D", "eieiiii" },
+    { "glCopyTexImage2D", "eieiiiii" },
+    { "glCopyTexSubImage1D", "eiiiii" },
+    { "glCopyTexSubImage2D", "eiiiiiii" },
+    { "glCopyTexSubImage3D", "eiiiiiiii" },
+    { "glCreateProgram", "" },
+    { "glCreateShader", "e" },
+    { "glCullFace", "e" },
+    { "glDeleteBuffers", "ip" },
+    { "glDeleteFramebuffers", "ip" },
+    { "glDeleteProgram", "u" },
+    { "glDeleteQueries", "ip" },
+    { "glDeleteRenderbuffers", "ip" },
+    { "glDeleteSamplers", "ip" },
+    { "glDeleteShader", "u" },
+    { "glDeleteSync", "p" },
+    { "glDeleteTextures", "ip" },
+    { "glDeleteVertexArrays", "ip" },
+    { "glDepthFunc", "e" },
+    { "glDepthMask", "u" },
+    { "glDepthRange", "ff" },
+    { "glDetachShader", "uu" },
+    { "glDisable", "e" },
+    { "glDisableVertexAttribArray", "u" },
+    { "glDisablei", "eu" },
+    { "glDrawArrays", "eii" },
+    { "glDrawArraysInstanced", "eiii" },
+    { "glDrawBuffer", "e" },
+    { "glDrawBuffers", "ip" },
+    { "glDrawElements", "eiep" },
+    { "glDrawElementsBaseVertex", "eiepi" },
+    { "glDrawElementsInstanced", "eiepi" },
+    { "glDrawElementsInstancedBaseVertex", "eiepii" },
+    { "glDrawRangeElements", "euuiep" },
+    { "glDrawRangeElementsBaseVertex", "euuiepi" },
+    { "glEnable", "e" },
+    { "glEnableVertexAttribArray", "u" },
+    { "glEnablei", "eu" },
+    { "glEndConditionalRender", "" },
+    { "glEndQuery", "e" },
+    { "glEndTransformFeedback", "" },
+    { "glFenceSync", "ex" },
+    { "glFinish", "" },
+    { "glFlush", "" },
+    { "glFlushMappedBufferRange", "ezz" },
+    { "glFramebufferRenderbuffer", "eeeu" },
+    { "glFramebufferTexture", "eeui" },
+    { "glFramebufferTexture1D", "eeeui" },
+    { "glFramebufferTexture2D", "eeeui" },
+    { "glFramebufferTexture3D", "eeeuii" },
+    { "glFramebufferTextureLayer", "eeuii" },
+    { "glFrontFace", "e" },
+    { "glGenBuffers", "ip" },
+    { "glGenFramebuffers", "ip" },
+    { "glGenQueries", "ip" },
+    { "glGenRenderbuffers", "ip" },
+    { "glGenSamplers", "ip" },
+    { "glGenTextures", "ip" },
+    { "glGenVertexArrays", "ip" },
+    { "glGenerateMipmap", "e" },
+    { "glGetActiveAttrib", "uuipppp" },
+    { "glGetActiveUniform", "uuipppp" },
+    { "glGetActiveUniformBlockName", "uuipp" },
+    { "glGetActiveUniformBlockiv", "uuep" },
+    { "glGetActiveUniformName", "uuipp" },
+    { "glGetActiveUniformsiv", "uipep" },
+    { "glGetAttachedShaders", "uipp" },
+    { "glGetAttribLocation", "up" },
+    { "glGetBooleani_v", "eup" },
+    { "glGetBooleanv", "ep" },
+    { "glGetBufferParameteri64v", "eep" },
+    { "glGetBufferParameteriv", "eep" },
+    { "glGetBufferPointerv", "eep" },
+    { "glGetBufferSubData", "ezzp" },
+    { "glGetCompressedTexImage", "eip" },
+    { "glGetDoublev", "ep" },
+    { "glGetError", "" },
+    { "glGetFloatv", "ep" },
+    { "glGetFragDataIndex", "up" },
+    { "glGetFragDataLocation", "up" },
+    { "glGetFramebufferAttachmentParameteriv", "eeep" },
+    { "glGetInteger64i_v", "eup" },
+    { "glGetInteger64v", "ep" },
+    { "glGetIntegeri_v", "eup" },
+    { "glGetIntegerv", "ep" },
+    { "glGetMultisamplefv", "eup" },
+    { "glGetProgramInfoLog", "uipp" },
+    { "glGetProgramiv", "uep" },
+    { "glGetQueryObjecti64v", "uep" },
+    { "glGetQueryObjectiv", "uep" },
+    { "glGetQueryObjectui64v", "uep" },
+    { "glGetQueryObjectuiv", "uep" },
+    { "glGetQueryiv", "eep" },
+    { "glGetRenderbufferParameteriv", "eep" },
+    { "glGetSamplerParameterIiv", "uep" },
+    { "glGetSamplerParameterIuiv", "uep" },
+    { "glGetSamplerParameterfv", "uep" },
+    { "glGetSamplerParameteriv", "uep" },
+    { "glGetShaderInfoLog", "uipp" },
+    { "glGetShaderSource", "uipp" },
+    { "glGetShaderiv", "uep" },
+    { "glGetString", "e" },
+    { "glGetStringi", "eu" },
+    { "glGetSynciv", "peipp" },
+    { "glGetTexImage", "eieep" },
+    { "glGetTexLevelParameterfv", "eiep" },
+    { "glGetTexLevelParameteriv", "eiep" },
+    { "glGetTexParameterIiv", "eep" },
+    { "glGetTexParameterIuiv", "eep" },
+    { "glGetTexParameterfv", "eep" },
+    { "glGetTexParameteriv", "eep" },
+    { "glGetTransformFeedbackVarying", "uuipppp" },
+    { "glGetUniformBlockIndex", "up" },
+    { "glGetUniformIndices", "uipp" },
+    { "glGetUniformLocation", "up" },
+    { "glGetUniformfv", "uip" },
+    { "glGetUniformiv", "uip" },
+    { "glGetUniformuiv", "uip" },
+    { "glGetVertexAttribIiv", "uep" },
+    { "glGetVertexAttribIuiv", "uep" },
+    { "glGetVertexAttribPointerv", "uep" },
+    { "glGetVertexAttribdv", "uep" },
+    { "glGetVertexAttribfv", "uep" },
+    { "glGetVertexAttribiv", "uep" },
+    { "glHint", "ee" },
+    { "glIsBuffer", "u" },
+    { "glIsEnabled", "e" },
+    { "glIsEnabledi", "eu" },
+    { "glIsFramebuffer", "u" },
+    { "glIsProgram", "u" },
+    { "glIsQuery", "u" },
+    { "glIsRenderbuffer", "u" },
+    { "glIsSampler", "u" },
+    { "glIsShader", "u" },
+    { "glIsSync", "p" },
+    { "glIsTexture", "u" },
+    { "glIsVertexArray", "u" },
+    { "glLineWidth", "f" },
+    { "glLinkProgram", "u" },
+    { "glLogicOp", "e" },
+    { "glMapBuffer", "ee" },
+    { "glMapBufferRange", "ezzx" },
+    { "glMultiDrawArrays", "eppi" },
+    { "glMultiDrawElements", "epepi" },
+    { "glMultiDrawElementsBaseVertex", "epepip" },
+    { "glMultiTexCoordP1ui", "eeu" },
+    { "glMultiTexCoordP1uiv", "eep" },
+    { "glMultiTexCoordP2ui", "eeu" },
+    { "glMultiTexCoordP2uiv", "eep" },
+    { "glMultiTexCoordP3ui", "eeu" },
+    { "glMultiTexCoordP3uiv", "eep" },
+    { "glMultiTexCoordP4ui", "eeu" },
+    { "glMultiTexCoordP4uiv", "eep" },
+    { "glNormalP3ui", "eu" },
+    { "glNormalP3uiv", "ep" },
+    { "glPixelStoref", "ef" },
+    { "glPixelStorei", "ei" },
+    { "glPointParameterf", "ef" },
+    { "glPointParameterfv", "ep" },
+    { "glPointParameteri", "ei" },
+    { "glPointParameteriv", "ep" },
+    { "glPointSize", "f" },
+    { "glPolygonMode", "ee" },
+    { "glPolygonOffset", "ff" },
+    { "glPrimitiveRestartIndex", "u" },
+    { "glProvokingVertex", "e" },
+    { "glQueryCounter", "ue" },
+    { "glReadBuffer", "e" },
+    { "glReadPixels", "iiiieep" },
+    { "glRenderbufferStorage", "eeii" },
+    { "glRenderbufferStorageMultisample", "eieii" },
+    { "glSampleCoverage", "fu" },
+    { "glSampleMaski", "ux" },
+    { "glSamplerParameterIiv", "uep" },
+    { "glSamplerParameterIuiv", "uep" },
+    { "glSamplerParameterf", "uef" },
+    { "glSamplerParameterfv", "uep" },
+    { "glSamplerParameteri", "uei" },
+    { "glSamplerParameteriv", "uep" },
+    { "glScissor", "iiii" },
+    { "glSecondaryColorP3ui", "eu" },
+    { "glSecondaryColorP3uiv", "ep" },
+    { "glShaderSource", "uipp" },
+    { "glStencilFunc", "eiu" },
+    { "glStencilFuncSeparate", "eeiu" },
+    { "glStencilMask", "u" },
+    { "glStencilMaskSeparate", "eu" },
+    { "glStencilOp", "eee" },
+    { "glStencilOpSeparate", "eeee" },
+    { "glTexBuffer", "eeu" },
+    { "glTexCoordP1ui", "eu" },
+    { "glTexCoordP1uiv", "ep" },
+    { "glTexCoordP2ui", "eu" },
+    { "glTexCoordP2uiv", "ep" },
+    { "glTexCoordP3ui", "eu" },
+    { "glTexCoordP3uiv", "ep" },
+    { "glTexCoordP4ui", "eu" },
+    { "glTexCoordP4uiv", "ep" },
+    { "glTexImage1D", "eiiiieep" },
+    { "glTexImage2D", "eiiiiieep" },
+    { "glTexImage2DMultisample", "eieiiu" },
+    { "glTexImage3D", "eiiiiiieep" },
+    { "glTexImage3DMultisample", "eieiiiu" },
+    { "glTexParameterIiv", "eep" },
+    { "glTexParameterIuiv", "eep" },
+    { "glTexParameterf", "eef" },
+    { "glTexParameterfv", "eep" },
+    { "glTexParameteri", "eei" },
+    { "glTexParameteriv", "eep" },
+    { "glTexSubImage1D", "eiiieep" },
+    { "glTexSubImage2D", "eiiiiieep" },
+    { "glTexSubImage3D", "eiiiiiiieep" },
+    { "glTransformFeedbackVaryings", "uipe" },
+    { "glUniform1f", "if" },
+    { "glUniform1fv", "iip" },
+    { "glUniform1i", "ii" },
+    { "glUniform1iv", "iip" },
+    { "glUniform1ui", "iu" },
+    { "glUniform1uiv", "iip" },
+    { "glUniform2f", "iff" },
+    { "glUniform2fv", "iip" },
+    { "glUniform2i", "iii" },
+    { "glUniform2iv", "iip" },
+    { "glUniform2ui", "iuu" },
+    { "glUniform2uiv", "iip" },
+    { "glUniform3f", "ifff" },
+    { "glUniform3fv", "iip" },
+    { "glUniform3i", "iiii" },
+    { "glUniform3iv", "iip" },
+    { "glUniform3ui", "iuuu" },
+    { "glUniform3uiv", "iip" },
+    { "glUniform4f", "iffff" },
+    { "glUniform4fv", "iip" },
+    { "glUniform4i", "iiiii" },
+    { "glUniform4iv", "iip" },
+    { "glUniform4ui", "iuuuu" },
+    { "glUniform4uiv", "iip" },
+    { "glUniformBlockBinding", "uuu" },
+    { "glUniformMatrix2fv", "iiup" },
+    { "glUniformMatrix2x3fv", "iiup" },
+    { "glUniformMatrix2x4fv", "iiup" },
+    { "glUniformMatrix3fv", "iiup" },
+    { "glUniformMatrix3x2fv", "iiup" },
+    { "glUniformMatrix3x4fv", "iiup" },
+    { "glUniformMatrix4fv", "iiup" },
+    { "glUniformMatrix4x2fv", "iiup" },
+    { "glUniformMatrix4x3fv", "iiup" },
+    { "glUnmapBuffer", "e" },
+    { "glUseProgram", "u" },
+    { "glValidateProgram", "u" },
+    { "glVertexAttrib1d", "uf" },
+    { "glVertexAttrib1dv", "up" },
+    { "glVertexAttrib1f", "uf" },
+    { "glVertexAttrib1fv", "up" },
+    { "glVertexAttrib1s", "ui" },
+    { "glVertexAttrib1sv", "up" },
+    { "glVertexAttrib2d", "uff" },
+    { "glVertexAttrib2dv", "up" },
+    { "glVertexAttrib2f", "uff" },
+    { "glVertexAttrib2fv", "up" },
+    { "glVertexAttrib2s", "uii" },
+    { "glVertexAttrib2sv", "up" },
+    { "glVertexAttrib3d", "ufff" },
+    { "glVertexAttrib3dv", "up" },
+    { "glVertexAttrib3f", "ufff" },
+    { "glVertexAttrib3fv", "up" },
+    { "glVertexAttrib3s", "uiii" },
+    { "glVertexAttrib3sv", "up" },
+    { "glVertexAttrib4Nbv", "up" },
+    { "glVertexAttrib4Niv", "up" },
+    { "glVertexAttrib4Nsv", "up" },
+    { "glVertexAttrib4Nub", "uuuuu" },
+    { "glVertexAttrib4Nubv", "up" },
+    { "glVertexAttrib4Nuiv", "up" },
+    { "glVertexAttrib4Nusv", "up" },
+    { "glVertexAttrib4bv", "up" },
+    { "glVertexAttrib4d", "uffff" },
+    { "glVertexAttrib4dv", "up" },
+    { "glVertexAttrib4f", "uffff" },
+    { "glVertexAttrib4fv", "up" },
+    { "glVertexAttrib4iv", "up" },
+    { "glVertexAttrib4s", "uiiii" },
+    { "glVertexAttrib4sv", "up" },
+    { "glVertexAttrib4ubv", "up" },
+    { "glVertexAttrib4uiv", "up" },
+    { "glVertexAttrib4usv", "up" },
+    { "glVertexAttribDivisor", "uu" },
+    { "glVertexAttribI1i", "ui" },
+    { "glVertexAttribI1iv", "up" },
+    { "glVertexAttribI1ui", "uu" },
+    { "glVertexAttribI1uiv", "up" },
+    { "glVertexAttribI2i", "uii" },
+    { "glVertexAttribI2iv", "up" },
+    { "glVertexAttribI2ui", "uuu" },
+    { "glVertexAttribI2uiv", "up" },
+    { "glVertexAttribI3i", "uiii" },
+    { "glVertexAttribI3iv", "up" },
+    { "glVertexAttribI3ui", "uuuu" },
+    { "glVertexAttribI3uiv", "up" },
+    { "glVertexAttribI4bv", "up" },
+    { "glVertexAttribI4i", "uiiii" },
+    { "glVertexAttribI4iv", "up" },
+    { "glVertexAttribI4sv", "up" },
+    { "glVertexAttribI4ubv", "up" },
+    { "glVertexAttribI4ui", "uuuuu" },
+    { "glVertexAttribI4uiv", "up" },
+    { "glVertexAttribI4usv", "up" },
+    { "glVertexAttribIPointer", "uieip" },
+    { "glVertexAttribP1ui", "ueuu" },
+    { "glVertexAttribP1uiv", "ueup" },
+    { "glVertexAttribP2ui", "ueuu" },
+    { "glVertexAttribP2uiv", "ueup" },
+    { "glVertexAttribP3ui", "ueuu" },
+    { "glVertexAttribP3uiv", "ueup" },
+    { "glVertexAttribP4ui", "ueuu" },
+    { "glVertexAttribP4uiv", "ueup" },
+    { "glVertexAttribPointer", "uieuip" },
+    { "glVertexP2ui", "eu" },
+    { "glVertexP2uiv", "ep" },
+    { "glVertexP3ui", "eu" },
+    { "glVertexP3uiv", "ep" },
+    { "glVertexP4ui", "eu" },
+    { "glVertexP4uiv", "ep" },
+    { "glViewport", "iiii" },
+    { "glWaitSync", "pxL" },
+};
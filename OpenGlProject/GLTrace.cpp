@@ -0,0 +1,619 @@
+#include "GLTrace.h"
+#include "FileMapping.h" // Reading traces back
+#include <glad/glad.h> // Entry points to wrap and replay
+#include <algorithm> // std::sort, std::min
+#include <atomic> // Capture flag read by every thread
+#include <chrono> // Per-call timing
+#include <cstdint> // Fixed-size record fields
+#include <cstring> // memcpy, strlen
+#include <fstream> // Trace output
+#include <iostream> // For outputting errors and messages
+#include <string> // Shader sources
+#include <thread> // Capturing thread
+#include <type_traits> // Argument encoding
+#include <unordered_map> // Name remapping
+#include <vector> // Record buffer
+
+// File layout: GlTraceHeader, a name table (u8 length + characters per function), then one record per call:
+// u16 function, u8 argument count, u8 flags, u64 per argument, [u32 size + payload bytes], [u64 result].
+// Arguments are stored as 64-bit words: integers sign-extended, floats as their bit pattern, pointers as addresses.
+static const uint32_t GL_TRACE_MAGIC = 0x52544C47; // "GLTR"
+static const uint32_t GL_TRACE_VERSION = 1;
+static const uint16_t GL_TRACE_FRAME_MARKER = 0xFFFF; // Record id for the end of a frame; one argument, the frame index
+static const uint8_t GL_TRACE_HAS_PAYLOAD = 1;
+static const uint8_t GL_TRACE_HAS_RESULT = 2;
+static const int GL_TRACE_MAX_ARGS = 16; // The widest GL 3.3 call has 11
+static const size_t GL_TRACE_FLUSH_BYTES = 4 << 20; // Write the record buffer out past this size
+static const size_t GL_TRACE_SCRATCH_BYTES = 32 << 20; // Replay target for output pointers (glGet*, glReadPixels)
+
+struct GlTraceHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t functionCount; // Entries in the name table
+    uint32_t width; // Framebuffer size at capture
+    uint32_t height;
+};
+
+// Object namespaces the replay remaps: captured names become whatever the replay context hands out
+enum TraceNamespace
+{
+    TRACE_NS_BUFFER,
+    TRACE_NS_TEXTURE,
+    TRACE_NS_VERTEX_ARRAY,
+    TRACE_NS_FRAMEBUFFER,
+    TRACE_NS_RENDERBUFFER,
+    TRACE_NS_PROGRAM,
+    TRACE_NS_SHADER,
+    TRACE_NS_SAMPLER,
+    TRACE_NS_QUERY,
+    TRACE_NS_COUNT
+};
+
+// ---------------------------------------------------------------------------
+// Capture
+// ---------------------------------------------------------------------------
+
+struct TraceMapping
+{
+    void* pointer; // What glMapBuffer(Range) returned
+    size_t length; // Bytes the application may have written
+};
+
+static std::atomic<bool> tracing(false); // Wrappers record only while set...
+static std::thread::id traceThread; // ...and only on this thread
+static std::ofstream traceFile;
+static std::vector<char> traceBuffer; // Records not yet written
+static size_t recordStart = 0; // Offset of the record being built
+static size_t traceRecords = 0, traceBytes = 0; // Totals for the summary
+static int traceFrames = 0;
+static GLuint traceUnpackBuffer = 0; // Bound GL_PIXEL_UNPACK_BUFFER; texture uploads read from it instead of client memory
+static GLint traceUnpackAlignment = 4;
+static std::unordered_map<GLenum, TraceMapping> traceMappings; // Target -> mapped range, written out at unmap
+
+static bool traceActive()
+{
+    return tracing.load(std::memory_order_relaxed) && std::this_thread::get_id() == traceThread;
+}
+
+static void traceWrite(const void* data, size_t size)
+{
+    const char* bytes = (const char*)data;
+    traceBuffer.insert(traceBuffer.end(), bytes, bytes + size);
+}
+
+template <typename T>
+static uint64_t traceEncode(T value)
+{
+    uint64_t word = 0;
+    if constexpr (std::is_pointer<T>::value)
+        word = (uint64_t)(uintptr_t)value;
+    else if constexpr (std::is_floating_point<T>::value)
+        memcpy(&word, &value, sizeof(T));
+    else
+        word = (uint64_t)(int64_t)value;
+    return word;
+}
+
+static void traceBegin(int function, int argc)
+{
+    recordStart = traceBuffer.size();
+    uint16_t id = (uint16_t)function;
+    uint8_t header[2] = { (uint8_t)argc, 0 };
+    traceWrite(&id, sizeof(id));
+    traceWrite(header, sizeof(header));
+}
+
+template <typename T>
+static void traceArg(T value)
+{
+    uint64_t word = traceEncode(value);
+    traceWrite(&word, sizeof(word));
+}
+
+// Copy the memory behind a pointer argument into the record (at most one payload per call)
+static void tracePayload(const void* data, size_t size)
+{
+    char& flags = traceBuffer[recordStart + 3];
+    if (!data || size == 0 || size > UINT32_MAX || (flags & GL_TRACE_HAS_PAYLOAD))
+        return;
+    flags |= GL_TRACE_HAS_PAYLOAD;
+    uint32_t size32 = (uint32_t)size;
+    traceWrite(&size32, sizeof(size32));
+    traceWrite(data, size);
+}
+
+template <typename T>
+static void traceResult(T value)
+{
+    traceBuffer[recordStart + 3] |= GL_TRACE_HAS_RESULT;
+    traceArg(value);
+}
+
+static void traceFlush()
+{
+    traceFile.write(traceBuffer.data(), (std::streamsize)traceBuffer.size());
+    traceBytes += traceBuffer.size();
+    traceBuffer.clear();
+}
+
+static void traceEnd()
+{
+    traceRecords++;
+    if (traceBuffer.size() > GL_TRACE_FLUSH_BYTES)
+        traceFlush();
+}
+
+// Bytes glTex(Sub)Image2D reads from client memory; 0 when the source is a bound unpack buffer
+static size_t traceImageBytes(GLsizei width, GLsizei height, GLenum format, GLenum type)
+{
+    if (traceUnpackBuffer != 0 || width <= 0 || height <= 0)
+        return 0;
+    size_t components = 4;
+    switch (format)
+    {
+    case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX: components = 1; break;
+    case GL_RG: case GL_RG_INTEGER: components = 2; break;
+    case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: components = 3; break;
+    }
+    size_t componentBytes = 1;
+    switch (type)
+    {
+    case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: componentBytes = 2; break;
+    case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT: componentBytes = 4; break;
+    case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_2_10_10_10_REV: case GL_UNSIGNED_INT_10F_11F_11F_REV:
+    case GL_UNSIGNED_INT_5_9_9_9_REV: case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV:
+        components = 1; componentBytes = 4; break;
+    case GL_FLOAT_32_UNSIGNED_INT_24_8_REV: components = 1; componentBytes = 8; break;
+    case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_5_5_5_1:
+        components = 1; componentBytes = 2; break;
+    }
+    size_t rowBytes = (size_t)width * components * componentBytes;
+    size_t alignment = (size_t)std::max(traceUnpackAlignment, 1);
+    size_t stride = (rowBytes + alignment - 1) / alignment * alignment;
+    return stride * (size_t)(height - 1) + rowBytes;
+}
+
+static void traceHook_glShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length);
+static void traceHook_glUnmapBuffer(GLenum target);
+static void traceHook_glBindBuffer(GLenum target, GLuint buffer);
+static void traceHook_glPixelStorei(GLenum pname, GLint param);
+static void traceAfter_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access, void* result);
+static void traceAfter_glMapBuffer(GLenum target, GLenum access, void* result);
+
+// ---------------------------------------------------------------------------
+// Replay helpers (used by the generated dispatch)
+// ---------------------------------------------------------------------------
+
+struct ReplayMapping
+{
+    void* pointer;
+    size_t length;
+};
+
+static std::unordered_map<uint64_t, GLuint> replayNameMaps[TRACE_NS_COUNT]; // Captured name -> replay name
+static std::unordered_map<uint64_t, GLsync> replaySyncs; // Captured fence address -> replay fence
+static std::unordered_map<uint64_t, GLint> replayLocations; // (captured program << 32 | captured location) -> replay location
+static uint64_t replayProgram = 0; // Captured name of the program in use
+static std::unordered_map<GLenum, ReplayMapping> replayMappings; // Target -> range mapped during replay
+static std::vector<char> replayScratchBuffer;
+
+static GLuint replayName(int space, uint64_t captured)
+{
+    if (captured == 0)
+        return 0;
+    auto found = replayNameMaps[space].find(captured);
+    return found != replayNameMaps[space].end() ? found->second : (GLuint)captured;
+}
+
+static void replayBindName(int space, uint64_t captured, GLuint name)
+{
+    replayNameMaps[space][captured] = name;
+}
+
+static void replayBindNames(int space, const char* payload, uint32_t payloadSize, const std::vector<GLuint>& names)
+{
+    for (size_t i = 0; i < names.size() && (i + 1) * sizeof(GLuint) <= payloadSize; i++)
+    {
+        GLuint captured;
+        memcpy(&captured, payload + i * sizeof(GLuint), sizeof(GLuint));
+        replayNameMaps[space][captured] = names[i];
+    }
+}
+
+// Names to pass to glDelete*; unknown names are dropped rather than deleting someone else's object
+static std::vector<GLuint> replayNames(int space, const char* payload, uint32_t payloadSize)
+{
+    std::vector<GLuint> names;
+    for (uint32_t offset = 0; offset + sizeof(GLuint) <= payloadSize; offset += sizeof(GLuint))
+    {
+        GLuint captured;
+        memcpy(&captured, payload + offset, sizeof(GLuint));
+        auto found = replayNameMaps[space].find(captured);
+        if (found == replayNameMaps[space].end())
+            continue;
+        names.push_back(found->second);
+        replayNameMaps[space].erase(found);
+    }
+    return names;
+}
+
+static GLsync replaySync(uint64_t captured)
+{
+    auto found = replaySyncs.find(captured);
+    return found != replaySyncs.end() ? found->second : NULL;
+}
+
+static void replayBindSync(uint64_t captured, GLsync sync)
+{
+    replaySyncs[captured] = sync;
+}
+
+static uint64_t replayLocationKey(uint64_t program, GLint location)
+{
+    return (program << 32) | (uint32_t)location;
+}
+
+static GLint replayLocation(uint64_t captured)
+{
+    GLint location = (GLint)captured;
+    if (location < 0)
+        return location;
+    auto found = replayLocations.find(replayLocationKey(replayProgram, location));
+    return found != replayLocations.end() ? found->second : location;
+}
+
+static float replayFloat(uint64_t word)
+{
+    uint32_t bits = (uint32_t)word;
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static double replayDouble(uint64_t word)
+{
+    double value;
+    memcpy(&value, &word, sizeof(value));
+    return value;
+}
+
+// Captured pointer argument: recorded data if there is any, otherwise the value is an offset into a bound buffer
+static const void* replayPointer(uint64_t captured, const char* payload, uint32_t payloadSize)
+{
+    if (captured == 0)
+        return NULL;
+    return payload ? (const void*)payload : (const void*)(uintptr_t)captured;
+}
+
+// Zeroed memory for output parameters, whose contents the replay ignores
+static void* replayScratch()
+{
+    return replayScratchBuffer.data();
+}
+
+static void replay_glShaderSource(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result);
+static void replay_glMapBufferRange(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result);
+static void replay_glMapBuffer(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result);
+static void replay_glUnmapBuffer(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result);
+static void replay_glGetUniformLocation(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result);
+static void replay_glUseProgram(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result);
+static void replay_glDeleteSync(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result);
+
+#include "GLTraceFunctions.inl" // Wrappers, install/remove and replay dispatch for every entry point glad loads
+
+// ---------------------------------------------------------------------------
+// Hand-written capture hooks
+// ---------------------------------------------------------------------------
+
+// Sources are joined into one NUL-terminated string
+static void traceHook_glShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length)
+{
+    std::string source;
+    for (GLsizei i = 0; i < count && string; i++)
+    {
+        if (!string[i])
+            continue;
+        if (length && length[i] >= 0)
+            source.append(string[i], (size_t)length[i]);
+        else
+            source.append(string[i]);
+    }
+    tracePayload(source.c_str(), source.size() + 1);
+}
+
+// Whatever the application wrote into a mapped range goes into the unmap record
+static void traceHook_glUnmapBuffer(GLenum target)
+{
+    auto found = traceMappings.find(target);
+    if (found == traceMappings.end())
+        return;
+    tracePayload(found->second.pointer, found->second.length);
+    traceMappings.erase(found);
+}
+
+static void traceHook_glBindBuffer(GLenum target, GLuint buffer)
+{
+    if (target == GL_PIXEL_UNPACK_BUFFER)
+        traceUnpackBuffer = buffer;
+}
+
+static void traceHook_glPixelStorei(GLenum pname, GLint param)
+{
+    if (pname == GL_UNPACK_ALIGNMENT)
+        traceUnpackAlignment = param;
+}
+
+static void traceAfter_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access, void* result)
+{
+    if (result && (access & GL_MAP_WRITE_BIT))
+        traceMappings[target] = { result, (size_t)length };
+}
+
+static void traceAfter_glMapBuffer(GLenum target, GLenum access, void* result)
+{
+    if (!result || access == GL_READ_ONLY)
+        return;
+    GLint size = 0;
+    ((PFNGLGETBUFFERPARAMETERIVPROC)traceReal[TRACE_glGetBufferParameteriv])(target, GL_BUFFER_SIZE, &size);
+    traceMappings[target] = { result, (size_t)std::max(size, 0) };
+}
+
+// ---------------------------------------------------------------------------
+// Hand-written replay
+// ---------------------------------------------------------------------------
+
+static void replay_glShaderSource(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result)
+{
+    const GLchar* source = payload ? payload : "";
+    glad_glShaderSource(replayName(TRACE_NS_SHADER, a[0]), 1, &source, NULL);
+}
+
+static void replay_glMapBufferRange(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result)
+{
+    GLenum target = (GLenum)a[0];
+    void* pointer = glad_glMapBufferRange(target, (GLintptr)a[1], (GLsizeiptr)a[2], (GLbitfield)a[3]);
+    replayMappings[target] = { pointer, (size_t)a[2] };
+}
+
+static void replay_glMapBuffer(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result)
+{
+    GLenum target = (GLenum)a[0];
+    GLint size = 0;
+    glad_glGetBufferParameteriv(target, GL_BUFFER_SIZE, &size);
+    replayMappings[target] = { glad_glMapBuffer(target, (GLenum)a[1]), (size_t)std::max(size, 0) };
+}
+
+static void replay_glUnmapBuffer(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result)
+{
+    GLenum target = (GLenum)a[0];
+    auto found = replayMappings.find(target);
+    if (found != replayMappings.end())
+    {
+        if (found->second.pointer && payload)
+            memcpy(found->second.pointer, payload, std::min((size_t)payloadSize, found->second.length));
+        replayMappings.erase(found);
+    }
+    glad_glUnmapBuffer(target);
+}
+
+// Locations can differ between drivers, so uniforms are looked up again and keyed by (program, captured location)
+static void replay_glGetUniformLocation(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result)
+{
+    GLint location = glad_glGetUniformLocation(replayName(TRACE_NS_PROGRAM, a[0]), payload ? payload : "");
+    replayLocations[replayLocationKey(a[0], (GLint)result)] = location;
+}
+
+static void replay_glUseProgram(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result)
+{
+    replayProgram = a[0];
+    glad_glUseProgram(replayName(TRACE_NS_PROGRAM, a[0]));
+}
+
+static void replay_glDeleteSync(const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result)
+{
+    auto found = replaySyncs.find(a[0]);
+    if (found == replaySyncs.end())
+        return;
+    glad_glDeleteSync(found->second);
+    replaySyncs.erase(found);
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+bool startGlTrace(const char* path, int width, int height)
+{
+    if (tracing)
+        return false;
+    traceFile.open(path, std::ios::binary | std::ios::trunc);
+    if (!traceFile)
+    {
+        std::cout << "Failed to open trace file: " << path << std::endl;
+        return false;
+    }
+
+    traceBuffer.clear();
+    traceBuffer.reserve(GL_TRACE_FLUSH_BYTES + (1 << 20));
+    GlTraceHeader header = { GL_TRACE_MAGIC, GL_TRACE_VERSION, TRACE_FUNCTION_COUNT, (uint32_t)width, (uint32_t)height };
+    traceWrite(&header, sizeof(header));
+    for (int i = 0; i < TRACE_FUNCTION_COUNT; i++)
+    {
+        uint8_t length = (uint8_t)strlen(traceNames[i]);
+        traceWrite(&length, sizeof(length));
+        traceWrite(traceNames[i], length);
+    }
+
+    traceRecords = 0;
+    traceBytes = 0;
+    traceFrames = 0;
+    traceUnpackBuffer = 0;
+    traceUnpackAlignment = 4;
+    traceMappings.clear();
+    traceThread = std::this_thread::get_id();
+    installTraceWrappers();
+    tracing = true;
+    std::cout << "Tracing GL calls to " << path << std::endl;
+    return true;
+}
+
+void traceFrameEnd()
+{
+    if (!traceActive())
+        return;
+    traceBegin(GL_TRACE_FRAME_MARKER, 1);
+    traceArg(traceFrames++);
+    traceEnd();
+}
+
+void stopGlTrace()
+{
+    if (!tracing)
+        return;
+    tracing = false;
+    removeTraceWrappers();
+    traceFlush();
+    traceFile.close();
+    std::cout << "GL trace: " << traceRecords << " records, " << traceFrames << " frames, "
+              << traceBytes / (1024.0 * 1024.0) << " MB" << std::endl;
+}
+
+bool readGlTraceSize(const char* path, int& width, int& height)
+{
+    std::ifstream in(path, std::ios::binary);
+    GlTraceHeader header;
+    if (!in.read((char*)&header, sizeof(header)) || header.magic != GL_TRACE_MAGIC || header.version != GL_TRACE_VERSION)
+        return false;
+    width = (int)header.width;
+    height = (int)header.height;
+    return true;
+}
+
+bool replayGlTrace(const char* path)
+{
+    MappedFile file;
+    if (!mapFile(path, file))
+    {
+        std::cout << "Failed to open trace: " << path << std::endl;
+        return false;
+    }
+    const char* cursor = file.data;
+    const char* end = file.data + file.size;
+    GlTraceHeader header;
+    if (file.size < sizeof(header) || (memcpy(&header, cursor, sizeof(header)), header.magic != GL_TRACE_MAGIC || header.version != GL_TRACE_VERSION))
+    {
+        std::cout << "Not a GL trace: " << path << std::endl;
+        unmapFile(file);
+        return false;
+    }
+    cursor += sizeof(header);
+
+    // Function ids are mapped by name, so traces survive a regenerated glad
+    std::vector<int> functions(header.functionCount, -1);
+    for (uint32_t i = 0; i < header.functionCount && cursor < end; i++)
+    {
+        size_t length = (uint8_t)*cursor++;
+        std::string name(cursor, std::min(length, (size_t)(end - cursor)));
+        cursor += length;
+        for (int j = 0; j < TRACE_FUNCTION_COUNT; j++)
+            if (name == traceNames[j])
+                functions[i] = j;
+    }
+
+    for (auto& names : replayNameMaps)
+        names.clear();
+    replaySyncs.clear();
+    replayLocations.clear();
+    replayMappings.clear();
+    replayProgram = 0;
+    replayScratchBuffer.assign(GL_TRACE_SCRATCH_BYTES, 0);
+
+    std::vector<uint64_t> callNanoseconds(TRACE_FUNCTION_COUNT, 0);
+    std::vector<size_t> callCounts(TRACE_FUNCTION_COUNT, 0);
+    uint64_t finishNanoseconds = 0;
+    size_t calls = 0, skipped = 0;
+    int frames = 0;
+    auto replayStart = std::chrono::steady_clock::now();
+    while (cursor + 4 <= end)
+    {
+        uint16_t id;
+        memcpy(&id, cursor, sizeof(id));
+        uint8_t argc = (uint8_t)cursor[2], flags = (uint8_t)cursor[3];
+        cursor += 4;
+        uint64_t args[GL_TRACE_MAX_ARGS];
+        if (argc > GL_TRACE_MAX_ARGS || cursor + argc * sizeof(uint64_t) > end)
+            break;
+        memcpy(args, cursor, argc * sizeof(uint64_t));
+        cursor += argc * sizeof(uint64_t);
+        const char* payload = NULL;
+        uint32_t payloadSize = 0;
+        if (flags & GL_TRACE_HAS_PAYLOAD)
+        {
+            if (cursor + sizeof(payloadSize) > end)
+                break;
+            memcpy(&payloadSize, cursor, sizeof(payloadSize));
+            cursor += sizeof(payloadSize);
+            if (payloadSize > (size_t)(end - cursor))
+                break;
+            payload = cursor;
+            cursor += payloadSize;
+        }
+        uint64_t result = 0;
+        if (flags & GL_TRACE_HAS_RESULT)
+        {
+            if (cursor + sizeof(result) > end)
+                break;
+            memcpy(&result, cursor, sizeof(result));
+            cursor += sizeof(result);
+        }
+
+        if (id == GL_TRACE_FRAME_MARKER)
+        {
+            // Drain the frame so queued driver work lands in this frame's time, not in the next call's
+            auto start = std::chrono::steady_clock::now();
+            glad_glFinish();
+            finishNanoseconds += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            frames++;
+            continue;
+        }
+        int function = id < functions.size() ? functions[id] : -1;
+        if (function < 0)
+        {
+            skipped++;
+            continue;
+        }
+        auto start = std::chrono::steady_clock::now();
+        replayDispatch(function, args, payload, payloadSize, result);
+        callNanoseconds[function] += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        callCounts[function]++;
+        calls++;
+    }
+    double totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - replayStart).count();
+    unmapFile(file);
+    replayScratchBuffer = std::vector<char>();
+
+    uint64_t callTotal = 0;
+    std::vector<int> order;
+    for (int i = 0; i < TRACE_FUNCTION_COUNT; i++)
+        if (callCounts[i])
+        {
+            order.push_back(i);
+            callTotal += callNanoseconds[i];
+        }
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return callNanoseconds[a] > callNanoseconds[b]; });
+
+    std::cout << "GL replay: " << calls << " calls over " << frames << " frames in " << totalMs << " ms ("
+              << (totalMs > 0.0 ? frames * 1000.0 / totalMs : 0.0) << " fps), " << callTotal / 1e6 << " ms in calls, "
+              << finishNanoseconds / 1e6 << " ms in glFinish at frame ends";
+    if (skipped)
+        std::cout << ", " << skipped << " records for unknown functions skipped";
+    std::cout << std::endl;
+    for (size_t i = 0; i < order.size() && i < 20; i++)
+    {
+        int function = order[i];
+        std::cout << "  " << traceNames[function] << ": " << callCounts[function] << " calls, " << callNanoseconds[function] / 1e6
+                  << " ms, " << (double)callNanoseconds[function] / callCounts[function] << " ns per call" << std::endl;
+    }
+    return true;
+}
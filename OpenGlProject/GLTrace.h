@@ -0,0 +1,22 @@
+#pragma once
+
+// Binary GL call trace: startGlTrace swaps every glad entry point for a wrapper that records the call, its
+// arguments and the data behind known pointers (buffer and texture uploads, uniforms, shader sources, mapped
+// ranges) to a file. replayGlTrace plays a trace back against whatever context is current and times every
+// call, which separates driver cost from our own CPU work and lets drivers be compared on the same stream.
+// Only calls made on the thread that started the trace are recorded.
+
+// Start recording to path; width/height are stored so the replay can size its window. Call after glad is loaded.
+bool startGlTrace(const char* path, int width, int height);
+
+// Mark the end of a frame (after the swap)
+void traceFrameEnd();
+
+// Restore the real entry points, flush and close the file
+void stopGlTrace();
+
+// Read the framebuffer size a trace was captured at; returns false if the file is not a trace
+bool readGlTraceSize(const char* path, int& width, int& height);
+
+// Replay a trace on the current context and print the cost per GL function
+bool replayGlTrace(const char* path);
@@ -0,0 +1,6884 @@
+// Generated by tools/gen_gl_trace.py from include/glad/glad.h; do not edit.
+
+enum TraceFunction
+{
+    TRACE_glCullFace,
+    TRACE_glFrontFace,
+    TRACE_glHint,
+    TRACE_glLineWidth,
+    TRACE_glPointSize,
+    TRACE_glPolygonMode,
+    TRACE_glScissor,
+    TRACE_glTexParameterf,
+    TRACE_glTexParameterfv,
+    TRACE_glTexParameteri,
+    TRACE_glTexParameteriv,
+    TRACE_glTexImage1D,
+    TRACE_glTexImage2D,
+    TRACE_glDrawBuffer,
+    TRACE_glClear,
+    TRACE_glClearColor,
+    TRACE_glClearStencil,
+    TRACE_glClearDepth,
+    TRACE_glStencilMask,
+    TRACE_glColorMask,
+    TRACE_glDepthMask,
+    TRACE_glDisable,
+    TRACE_glEnable,
+    TRACE_glFinish,
+    TRACE_glFlush,
+    TRACE_glBlendFunc,
+    TRACE_glLogicOp,
+    TRACE_glStencilFunc,
+    TRACE_glStencilOp,
+    TRACE_glDepthFunc,
+    TRACE_glPixelStoref,
+    TRACE_glPixelStorei,
+    TRACE_glReadBuffer,
+    TRACE_glReadPixels,
+    TRACE_glGetBooleanv,
+    TRACE_glGetDoublev,
+    TRACE_glGetError,
+    TRACE_glGetFloatv,
+    TRACE_glGetIntegerv,
+    TRACE_glGetString,
+    TRACE_glGetTexImage,
+    TRACE_glGetTexParameterfv,
+    TRACE_glGetTexParameteriv,
+    TRACE_glGetTexLevelParameterfv,
+    TRACE_glGetTexLevelParameteriv,
+    TRACE_glIsEnabled,
+    TRACE_glDepthRange,
+    TRACE_glViewport,
+    TRACE_glDrawArrays,
+    TRACE_glDrawElements,
+    TRACE_glPolygonOffset,
+    TRACE_glCopyTexImage1D,
+    TRACE_glCopyTexImage2D,
+    TRACE_glCopyTexSubImage1D,
+    TRACE_glCopyTexSubImage2D,
+    TRACE_glTexSubImage1D,
+    TRACE_glTexSubImage2D,
+    TRACE_glBindTexture,
+    TRACE_glDeleteTextures,
+    TRACE_glGenTextures,
+    TRACE_glIsTexture,
+    TRACE_glDrawRangeElements,
+    TRACE_glTexImage3D,
+    TRACE_glTexSubImage3D,
+    TRACE_glCopyTexSubImage3D,
+    TRACE_glActiveTexture,
+    TRACE_glSampleCoverage,
+    TRACE_glCompressedTexImage3D,
+    TRACE_glCompressedTexImage2D,
+    TRACE_glCompressedTexImage1D,
+    TRACE_glCompressedTexSubImage3D,
+    TRACE_glCompressedTexSubImage2D,
+    TRACE_glCompressedTexSubImage1D,
+    TRACE_glGetCompressedTexImage,
+    TRACE_glBlendFuncSeparate,
+    TRACE_glMultiDrawArrays,
+    TRACE_glMultiDrawElements,
+    TRACE_glPointParameterf,
+    TRACE_glPointParameterfv,
+    TRACE_glPointParameteri,
+    TRACE_glPointParameteriv,
+    TRACE_glBlendColor,
+    TRACE_glBlendEquation,
+    TRACE_glGenQueries,
+    TRACE_glDeleteQueries,
+    TRACE_glIsQuery,
+    TRACE_glBeginQuery,
+    TRACE_glEndQuery,
+    TRACE_glGetQueryiv,
+    TRACE_glGetQueryObjectiv,
+    TRACE_glGetQueryObjectuiv,
+    TRACE_glBindBuffer,
+    TRACE_glDeleteBuffers,
+    TRACE_glGenBuffers,
+    TRACE_glIsBuffer,
+    TRACE_glBufferData,
+    TRACE_glBufferSubData,
+    TRACE_glGetBufferSubData,
+    TRACE_glMapBuffer,
+    TRACE_glUnmapBuffer,
+    TRACE_glGetBufferParameteriv,
+    TRACE_glGetBufferPointerv,
+    TRACE_glBlendEquationSeparate,
+    TRACE_glDrawBuffers,
+    TRACE_glStencilOpSeparate,
+    TRACE_glStencilFuncSeparate,
+    TRACE_glStencilMaskSeparate,
+    TRACE_glAttachShader,
+    TRACE_glBindAttribLocation,
+    TRACE_glCompileShader,
+    TRACE_glCreateProgram,
+    TRACE_glCreateShader,
+    TRACE_glDeleteProgram,
+    TRACE_glDeleteShader,
+    TRACE_glDetachShader,
+    TRACE_glDisableVertexAttribArray,
+    TRACE_glEnableVertexAttribArray,
+    TRACE_glGetActiveAttrib,
+    TRACE_glGetActiveUniform,
+    TRACE_glGetAttachedShaders,
+    TRACE_glGetAttribLocation,
+    TRACE_glGetProgramiv,
+    TRACE_glGetProgramInfoLog,
+    TRACE_glGetShaderiv,
+    TRACE_glGetShaderInfoLog,
+    TRACE_glGetShaderSource,
+    TRACE_glGetUniformLocation,
+    TRACE_glGetUniformfv,
+    TRACE_glGetUniformiv,
+    TRACE_glGetVertexAttribdv,
+    TRACE_glGetVertexAttribfv,
+    TRACE_glGetVertexAttribiv,
+    TRACE_glGetVertexAttribPointerv,
+    TRACE_glIsProgram,
+    TRACE_glIsShader,
+    TRACE_glLinkProgram,
+    TRACE_glShaderSource,
+    TRACE_glUseProgram,
+    TRACE_glUniform1f,
+    TRACE_glUniform2f,
+    TRACE_glUniform3f,
+    TRACE_glUniform4f,
+    TRACE_glUniform1i,
+    TRACE_glUniform2i,
+    TRACE_glUniform3i,
+    TRACE_glUniform4i,
+    TRACE_glUniform1fv,
+    TRACE_glUniform2fv,
+    TRACE_glUniform3fv,
+    TRACE_glUniform4fv,
+    TRACE_glUniform1iv,
+    TRACE_glUniform2iv,
+    TRACE_glUniform3iv,
+    TRACE_glUniform4iv,
+    TRACE_glUniformMatrix2fv,
+    TRACE_glUniformMatrix3fv,
+    TRACE_glUniformMatrix4fv,
+    TRACE_glValidateProgram,
+    TRACE_glVertexAttrib1d,
+    TRACE_glVertexAttrib1dv,
+    TRACE_glVertexAttrib1f,
+    TRACE_glVertexAttrib1fv,
+    TRACE_glVertexAttrib1s,
+    TRACE_glVertexAttrib1sv,
+    TRACE_glVertexAttrib2d,
+    TRACE_glVertexAttrib2dv,
+    TRACE_glVertexAttrib2f,
+    TRACE_glVertexAttrib2fv,
+    TRACE_glVertexAttrib2s,
+    TRACE_glVertexAttrib2sv,
+    TRACE_glVertexAttrib3d,
+    TRACE_glVertexAttrib3dv,
+    TRACE_glVertexAttrib3f,
+    TRACE_glVertexAttrib3fv,
+    TRACE_glVertexAttrib3s,
+    TRACE_glVertexAttrib3sv,
+    TRACE_glVertexAttrib4Nbv,
+    TRACE_glVertexAttrib4Niv,
+    TRACE_glVertexAttrib4Nsv,
+    TRACE_glVertexAttrib4Nub,
+    TRACE_glVertexAttrib4Nubv,
+    TRACE_glVertexAttrib4Nuiv,
+    TRACE_glVertexAttrib4Nusv,
+    TRACE_glVertexAttrib4bv,
+    TRACE_glVertexAttrib4d,
+    TRACE_glVertexAttrib4dv,
+    TRACE_glVertexAttrib4f,
+    TRACE_glVertexAttrib4fv,
+    TRACE_glVertexAttrib4iv,
+    TRACE_glVertexAttrib4s,
+    TRACE_glVertexAttrib4sv,
+    TRACE_glVertexAttrib4ubv,
+    TRACE_glVertexAttrib4uiv,
+    TRACE_glVertexAttrib4usv,
+    TRACE_glVertexAttribPointer,
+    TRACE_glUniformMatrix2x3fv,
+    TRACE_glUniformMatrix3x2fv,
+    TRACE_glUniformMatrix2x4fv,
+    TRACE_glUniformMatrix4x2fv,
+    TRACE_glUniformMatrix3x4fv,
+    TRACE_glUniformMatrix4x3fv,
+    TRACE_glColorMaski,
+    TRACE_glGetBooleani_v,
+    TRACE_glGetIntegeri_v,
+    TRACE_glEnablei,
+    TRACE_glDisablei,
+    TRACE_glIsEnabledi,
+    TRACE_glBeginTransformFeedback,
+    TRACE_glEndTransformFeedback,
+    TRACE_glBindBufferRange,
+    TRACE_glBindBufferBase,
+    TRACE_glTransformFeedbackVaryings,
+    TRACE_glGetTransformFeedbackVarying,
+    TRACE_glClampColor,
+    TRACE_glBeginConditionalRender,
+    TRACE_glEndConditionalRender,
+    TRACE_glVertexAttribIPointer,
+    TRACE_glGetVertexAttribIiv,
+    TRACE_glGetVertexAttribIuiv,
+    TRACE_glVertexAttribI1i,
+    TRACE_glVertexAttribI2i,
+    TRACE_glVertexAttribI3i,
+    TRACE_glVertexAttribI4i,
+    TRACE_glVertexAttribI1ui,
+    TRACE_glVertexAttribI2ui,
+    TRACE_glVertexAttribI3ui,
+    TRACE_glVertexAttribI4ui,
+    TRACE_glVertexAttribI1iv,
+    TRACE_glVertexAttribI2iv,
+    TRACE_glVertexAttribI3iv,
+    TRACE_glVertexAttribI4iv,
+    TRACE_glVertexAttribI1uiv,
+    TRACE_glVertexAttribI2uiv,
+    TRACE_glVertexAttribI3uiv,
+    TRACE_glVertexAttribI4uiv,
+    TRACE_glVertexAttribI4bv,
+    TRACE_glVertexAttribI4sv,
+    TRACE_glVertexAttribI4ubv,
+    TRACE_glVertexAttribI4usv,
+    TRACE_glGetUniformuiv,
+    TRACE_glBindFragDataLocation,
+    TRACE_glGetFragDataLocation,
+    TRACE_glUniform1ui,
+    TRACE_glUniform2ui,
+    TRACE_glUniform3ui,
+    TRACE_glUniform4ui,
+    TRACE_glUniform1uiv,
+    TRACE_glUniform2uiv,
+    TRACE_glUniform3uiv,
+    TRACE_glUniform4uiv,
+    TRACE_glTexParameterIiv,
+    TRACE_glTexParameterIuiv,
+    TRACE_glGetTexParameterIiv,
+    TRACE_glGetTexParameterIuiv,
+    TRACE_glClearBufferiv,
+    TRACE_glClearBufferuiv,
+    TRACE_glClearBufferfv,
+    TRACE_glClearBufferfi,
+    TRACE_glGetStringi,
+    TRACE_glIsRenderbuffer,
+    TRACE_glBindRenderbuffer,
+    TRACE_glDeleteRenderbuffers,
+    TRACE_glGenRenderbuffers,
+    TRACE_glRenderbufferStorage,
+    TRACE_glGetRenderbufferParameteriv,
+    TRACE_glIsFramebuffer,
+    TRACE_glBindFramebuffer,
+    TRACE_glDeleteFramebuffers,
+    TRACE_glGenFramebuffers,
+    TRACE_glCheckFramebufferStatus,
+    TRACE_glFramebufferTexture1D,
+    TRACE_glFramebufferTexture2D,
+    TRACE_glFramebufferTexture3D,
+    TRACE_glFramebufferRenderbuffer,
+    TRACE_glGetFramebufferAttachmentParameteriv,
+    TRACE_glGenerateMipmap,
+    TRACE_glBlitFramebuffer,
+    TRACE_glRenderbufferStorageMultisample,
+    TRACE_glFramebufferTextureLayer,
+    TRACE_glMapBufferRange,
+    TRACE_glFlushMappedBufferRange,
+    TRACE_glBindVertexArray,
+    TRACE_glDeleteVertexArrays,
+    TRACE_glGenVertexArrays,
+    TRACE_glIsVertexArray,
+    TRACE_glDrawArraysInstanced,
+    TRACE_glDrawElementsInstanced,
+    TRACE_glTexBuffer,
+    TRACE_glPrimitiveRestartIndex,
+    TRACE_glCopyBufferSubData,
+    TRACE_glGetUniformIndices,
+    TRACE_glGetActiveUniformsiv,
+    TRACE_glGetActiveUniformName,
+    TRACE_glGetUniformBlockIndex,
+    TRACE_glGetActiveUniformBlockiv,
+    TRACE_glGetActiveUniformBlockName,
+    TRACE_glUniformBlockBinding,
+    TRACE_glDrawElementsBaseVertex,
+    TRACE_glDrawRangeElementsBaseVertex,
+    TRACE_glDrawElementsInstancedBaseVertex,
+    TRACE_glMultiDrawElementsBaseVertex,
+    TRACE_glProvokingVertex,
+    TRACE_glFenceSync,
+    TRACE_glIsSync,
+    TRACE_glDeleteSync,
+    TRACE_glClientWaitSync,
+    TRACE_glWaitSync,
+    TRACE_glGetInteger64v,
+    TRACE_glGetSynciv,
+    TRACE_glGetInteger64i_v,
+    TRACE_glGetBufferParameteri64v,
+    TRACE_glFramebufferTexture,
+    TRACE_glTexImage2DMultisample,
+    TRACE_glTexImage3DMultisample,
+    TRACE_glGetMultisamplefv,
+    TRACE_glSampleMaski,
+    TRACE_glBindFragDataLocationIndexed,
+    TRACE_glGetFragDataIndex,
+    TRACE_glGenSamplers,
+    TRACE_glDeleteSamplers,
+    TRACE_glIsSampler,
+    TRACE_glBindSampler,
+    TRACE_glSamplerParameteri,
+    TRACE_glSamplerParameteriv,
+    TRACE_glSamplerParameterf,
+    TRACE_glSamplerParameterfv,
+    TRACE_glSamplerParameterIiv,
+    TRACE_glSamplerParameterIuiv,
+    TRACE_glGetSamplerParameteriv,
+    TRACE_glGetSamplerParameterIiv,
+    TRACE_glGetSamplerParameterfv,
+    TRACE_glGetSamplerParameterIuiv,
+    TRACE_glQueryCounter,
+    TRACE_glGetQueryObjecti64v,
+    TRACE_glGetQueryObjectui64v,
+    TRACE_glVertexAttribDivisor,
+    TRACE_glVertexAttribP1ui,
+    TRACE_glVertexAttribP1uiv,
+    TRACE_glVertexAttribP2ui,
+    TRACE_glVertexAttribP2uiv,
+    TRACE_glVertexAttribP3ui,
+    TRACE_glVertexAttribP3uiv,
+    TRACE_glVertexAttribP4ui,
+    TRACE_glVertexAttribP4uiv,
+    TRACE_glVertexP2ui,
+    TRACE_glVertexP2uiv,
+    TRACE_glVertexP3ui,
+    TRACE_glVertexP3uiv,
+    TRACE_glVertexP4ui,
+    TRACE_glVertexP4uiv,
+    TRACE_glTexCoordP1ui,
+    TRACE_glTexCoordP1uiv,
+    TRACE_glTexCoordP2ui,
+    TRACE_glTexCoordP2uiv,
+    TRACE_glTexCoordP3ui,
+    TRACE_glTexCoordP3uiv,
+    TRACE_glTexCoordP4ui,
+    TRACE_glTexCoordP4uiv,
+    TRACE_glMultiTexCoordP1ui,
+    TRACE_glMultiTexCoordP1uiv,
+    TRACE_glMultiTexCoordP2ui,
+    TRACE_glMultiTexCoordP2uiv,
+    TRACE_glMultiTexCoordP3ui,
+    TRACE_glMultiTexCoordP3uiv,
+    TRACE_glMultiTexCoordP4ui,
+    TRACE_glMultiTexCoordP4uiv,
+    TRACE_glNormalP3ui,
+    TRACE_glNormalP3uiv,
+    TRACE_glColorP3ui,
+    TRACE_glColorP3uiv,
+    TRACE_glColorP4ui,
+    TRACE_glColorP4uiv,
+    TRACE_glSecondaryColorP3ui,
+    TRACE_glSecondaryColorP3uiv,
+    TRACE_FUNCTION_COUNT
+};
+
+static const char* traceNames[TRACE_FUNCTION_COUNT] = {
+    "glCullFace",
+    "glFrontFace",
+    "glHint",
+    "glLineWidth",
+    "glPointSize",
+    "glPolygonMode",
+    "glScissor",
+    "glTexParameterf",
+    "glTexParameterfv",
+    "glTexParameteri",
+    "glTexParameteriv",
+    "glTexImage1D",
+    "glTexImage2D",
+    "glDrawBuffer",
+    "glClear",
+    "glClearColor",
+    "glClearStencil",
+    "glClearDepth",
+    "glStencilMask",
+    "glColorMask",
+    "glDepthMask",
+    "glDisable",
+    "glEnable",
+    "glFinish",
+    "glFlush",
+    "glBlendFunc",
+    "glLogicOp",
+    "glStencilFunc",
+    "glStencilOp",
+    "glDepthFunc",
+    "glPixelStoref",
+    "glPixelStorei",
+    "glReadBuffer",
+    "glReadPixels",
+    "glGetBooleanv",
+    "glGetDoublev",
+    "glGetError",
+    "glGetFloatv",
+    "glGetIntegerv",
+    "glGetString",
+    "glGetTexImage",
+    "glGetTexParameterfv",
+    "glGetTexParameteriv",
+    "glGetTexLevelParameterfv",
+    "glGetTexLevelParameteriv",
+    "glIsEnabled",
+    "glDepthRange",
+    "glViewport",
+    "glDrawArrays",
+    "glDrawElements",
+    "glPolygonOffset",
+    "glCopyTexImage1D",
+    "glCopyTexImage2D",
+    "glCopyTexSubImage1D",
+    "glCopyTexSubImage2D",
+    "glTexSubImage1D",
+    "glTexSubImage2D",
+    "glBindTexture",
+    "glDeleteTextures",
+    "glGenTextures",
+    "glIsTexture",
+    "glDrawRangeElements",
+    "glTexImage3D",
+    "glTexSubImage3D",
+    "glCopyTexSubImage3D",
+    "glActiveTexture",
+    "glSampleCoverage",
+    "glCompressedTexImage3D",
+    "glCompressedTexImage2D",
+    "glCompressedTexImage1D",
+    "glCompressedTexSubImage3D",
+    "glCompressedTexSubImage2D",
+    "glCompressedTexSubImage1D",
+    "glGetCompressedTexImage",
+    "glBlendFuncSeparate",
+    "glMultiDrawArrays",
+    "glMultiDrawElements",
+    "glPointParameterf",
+    "glPointParameterfv",
+    "glPointParameteri",
+    "glPointParameteriv",
+    "glBlendColor",
+    "glBlendEquation",
+    "glGenQueries",
+    "glDeleteQueries",
+    "glIsQuery",
+    "glBeginQuery",
+    "glEndQuery",
+    "glGetQueryiv",
+    "glGetQueryObjectiv",
+    "glGetQueryObjectuiv",
+    "glBindBuffer",
+    "glDeleteBuffers",
+    "glGenBuffers",
+    "glIsBuffer",
+    "glBufferData",
+    "glBufferSubData",
+    "glGetBufferSubData",
+    "glMapBuffer",
+    "glUnmapBuffer",
+    "glGetBufferParameteriv",
+    "glGetBufferPointerv",
+    "glBlendEquationSeparate",
+    "glDrawBuffers",
+    "glStencilOpSeparate",
+    "glStencilFuncSeparate",
+    "glStencilMaskSeparate",
+    "glAttachShader",
+    "glBindAttribLocation",
+    "glCompileShader",
+    "glCreateProgram",
+    "glCreateShader",
+    "glDeleteProgram",
+    "glDeleteShader",
+    "glDetachShader",
+    "glDisableVertexAttribArray",
+    "glEnableVertexAttribArray",
+    "glGetActiveAttrib",
+    "glGetActiveUniform",
+    "glGetAttachedShaders",
+    "glGetAttribLocation",
+    "glGetProgramiv",
+    "glGetProgramInfoLog",
+    "glGetShaderiv",
+    "glGetShaderInfoLog",
+    "glGetShaderSource",
+    "glGetUniformLocation",
+    "glGetUniformfv",
+    "glGetUniformiv",
+    "glGetVertexAttribdv",
+    "glGetVertexAttribfv",
+    "glGetVertexAttribiv",
+    "glGetVertexAttribPointerv",
+    "glIsProgram",
+    "glIsShader",
+    "glLinkProgram",
+    "glShaderSource",
+    "glUseProgram",
+    "glUniform1f",
+    "glUniform2f",
+    "glUniform3f",
+    "glUniform4f",
+    "glUniform1i",
+    "glUniform2i",
+    "glUniform3i",
+    "glUniform4i",
+    "glUniform1fv",
+    "glUniform2fv",
+    "glUniform3fv",
+    "glUniform4fv",
+    "glUniform1iv",
+    "glUniform2iv",
+    "glUniform3iv",
+    "glUniform4iv",
+    "glUniformMatrix2fv",
+    "glUniformMatrix3fv",
+    "glUniformMatrix4fv",
+    "glValidateProgram",
+    "glVertexAttrib1d",
+    "glVertexAttrib1dv",
+    "glVertexAttrib1f",
+    "glVertexAttrib1fv",
+    "glVertexAttrib1s",
+    "glVertexAttrib1sv",
+    "glVertexAttrib2d",
+    "glVertexAttrib2dv",
+    "glVertexAttrib2f",
+    "glVertexAttrib2fv",
+    "glVertexAttrib2s",
+    "glVertexAttrib2sv",
+    "glVertexAttrib3d",
+    "glVertexAttrib3dv",
+    "glVertexAttrib3f",
+    "glVertexAttrib3fv",
+    "glVertexAttrib3s",
+    "glVertexAttrib3sv",
+    "glVertexAttrib4Nbv",
+    "glVertexAttrib4Niv",
+    "glVertexAttrib4Nsv",
+    "glVertexAttrib4Nub",
+    "glVertexAttrib4Nubv",
+    "glVertexAttrib4Nuiv",
+    "glVertexAttrib4Nusv",
+    "glVertexAttrib4bv",
+    "glVertexAttrib4d",
+    "glVertexAttrib4dv",
+    "glVertexAttrib4f",
+    "glVertexAttrib4fv",
+    "glVertexAttrib4iv",
+    "glVertexAttrib4s",
+    "glVertexAttrib4sv",
+    "glVertexAttrib4ubv",
+    "glVertexAttrib4uiv",
+    "glVertexAttrib4usv",
+    "glVertexAttribPointer",
+    "glUniformMatrix2x3fv",
+    "glUniformMatrix3x2fv",
+    "glUniformMatrix2x4fv",
+    "glUniformMatrix4x2fv",
+    "glUniformMatrix3x4fv",
+    "glUniformMatrix4x3fv",
+    "glColorMaski",
+    "glGetBooleani_v",
+    "glGetIntegeri_v",
+    "glEnablei",
+    "glDisablei",
+    "glIsEnabledi",
+    "glBeginTransformFeedback",
+    "glEndTransformFeedback",
+    "glBindBufferRange",
+    "glBindBufferBase",
+    "glTransformFeedbackVaryings",
+    "glGetTransformFeedbackVarying",
+    "glClampColor",
+    "glBeginConditionalRender",
+    "glEndConditionalRender",
+    "glVertexAttribIPointer",
+    "glGetVertexAttribIiv",
+    "glGetVertexAttribIuiv",
+    "glVertexAttribI1i",
+    "glVertexAttribI2i",
+    "glVertexAttribI3i",
+    "glVertexAttribI4i",
+    "glVertexAttribI1ui",
+    "glVertexAttribI2ui",
+    "glVertexAttribI3ui",
+    "glVertexAttribI4ui",
+    "glVertexAttribI1iv",
+    "glVertexAttribI2iv",
+    "glVertexAttribI3iv",
+    "glVertexAttribI4iv",
+    "glVertexAttribI1uiv",
+    "glVertexAttribI2uiv",
+    "glVertexAttribI3uiv",
+    "glVertexAttribI4uiv",
+    "glVertexAttribI4bv",
+    "glVertexAttribI4sv",
+    "glVertexAttribI4ubv",
+    "glVertexAttribI4usv",
+    "glGetUniformuiv",
+    "glBindFragDataLocation",
+    "glGetFragDataLocation",
+    "glUniform1ui",
+    "glUniform2ui",
+    "glUniform3ui",
+    "glUniform4ui",
+    "glUniform1uiv",
+    "glUniform2uiv",
+    "glUniform3uiv",
+    "glUniform4uiv",
+    "glTexParameterIiv",
+    "glTexParameterIuiv",
+    "glGetTexParameterIiv",
+    "glGetTexParameterIuiv",
+    "glClearBufferiv",
+    "glClearBufferuiv",
+    "glClearBufferfv",
+    "glClearBufferfi",
+    "glGetStringi",
+    "glIsRenderbuffer",
+    "glBindRenderbuffer",
+    "glDeleteRenderbuffers",
+    "glGenRenderbuffers",
+    "glRenderbufferStorage",
+    "glGetRenderbufferParameteriv",
+    "glIsFramebuffer",
+    "glBindFramebuffer",
+    "glDeleteFramebuffers",
+    "glGenFramebuffers",
+    "glCheckFramebufferStatus",
+    "glFramebufferTexture1D",
+    "glFramebufferTexture2D",
+    "glFramebufferTexture3D",
+    "glFramebufferRenderbuffer",
+    "glGetFramebufferAttachmentParameteriv",
+    "glGenerateMipmap",
+    "glBlitFramebuffer",
+    "glRenderbufferStorageMultisample",
+    "glFramebufferTextureLayer",
+    "glMapBufferRange",
+    "glFlushMappedBufferRange",
+    "glBindVertexArray",
+    "glDeleteVertexArrays",
+    "glGenVertexArrays",
+    "glIsVertexArray",
+    "glDrawArraysInstanced",
+    "glDrawElementsInstanced",
+    "glTexBuffer",
+    "glPrimitiveRestartIndex",
+    "glCopyBufferSubData",
+    "glGetUniformIndices",
+    "glGetActiveUniformsiv",
+    "glGetActiveUniformName",
+    "glGetUniformBlockIndex",
+    "glGetActiveUniformBlockiv",
+    "glGetActiveUniformBlockName",
+    "glUniformBlockBinding",
+    "glDrawElementsBaseVertex",
+    "glDrawRangeElementsBaseVertex",
+    "glDrawElementsInstancedBaseVertex",
+    "glMultiDrawElementsBaseVertex",
+    "glProvokingVertex",
+    "glFenceSync",
+    "glIsSync",
+    "glDeleteSync",
+    "glClientWaitSync",
+    "glWaitSync",
+    "glGetInteger64v",
+    "glGetSynciv",
+    "glGetInteger64i_v",
+    "glGetBufferParameteri64v",
+    "glFramebufferTexture",
+    "glTexImage2DMultisample",
+    "glTexImage3DMultisample",
+    "glGetMultisamplefv",
+    "glSampleMaski",
+    "glBindFragDataLocationIndexed",
+    "glGetFragDataIndex",
+    "glGenSamplers",
+    "glDeleteSamplers",
+    "glIsSampler",
+    "glBindSampler",
+    "glSamplerParameteri",
+    "glSamplerParameteriv",
+    "glSamplerParameterf",
+    "glSamplerParameterfv",
+    "glSamplerParameterIiv",
+    "glSamplerParameterIuiv",
+    "glGetSamplerParameteriv",
+    "glGetSamplerParameterIiv",
+    "glGetSamplerParameterfv",
+    "glGetSamplerParameterIuiv",
+    "glQueryCounter",
+    "glGetQueryObjecti64v",
+    "glGetQueryObjectui64v",
+    "glVertexAttribDivisor",
+    "glVertexAttribP1ui",
+    "glVertexAttribP1uiv",
+    "glVertexAttribP2ui",
+    "glVertexAttribP2uiv",
+    "glVertexAttribP3ui",
+    "glVertexAttribP3uiv",
+    "glVertexAttribP4ui",
+    "glVertexAttribP4uiv",
+    "glVertexP2ui",
+    "glVertexP2uiv",
+    "glVertexP3ui",
+    "glVertexP3uiv",
+    "glVertexP4ui",
+    "glVertexP4uiv",
+    "glTexCoordP1ui",
+    "glTexCoordP1uiv",
+    "glTexCoordP2ui",
+    "glTexCoordP2uiv",
+    "glTexCoordP3ui",
+    "glTexCoordP3uiv",
+    "glTexCoordP4ui",
+    "glTexCoordP4uiv",
+    "glMultiTexCoordP1ui",
+    "glMultiTexCoordP1uiv",
+    "glMultiTexCoordP2ui",
+    "glMultiTexCoordP2uiv",
+    "glMultiTexCoordP3ui",
+    "glMultiTexCoordP3uiv",
+    "glMultiTexCoordP4ui",
+    "glMultiTexCoordP4uiv",
+    "glNormalP3ui",
+    "glNormalP3uiv",
+    "glColorP3ui",
+    "glColorP3uiv",
+    "glColorP4ui",
+    "glColorP4uiv",
+    "glSecondaryColorP3ui",
+    "glSecondaryColorP3uiv",
+};
+
+static void* traceReal[TRACE_FUNCTION_COUNT]; // Entry points the wrappers forward to
+
+static void APIENTRY trace_glCullFace(GLenum mode)
+{
+    PFNGLCULLFACEPROC real = (PFNGLCULLFACEPROC)traceReal[TRACE_glCullFace];
+    if (!traceActive())
+        return real(mode);
+    traceBegin(TRACE_glCullFace, 1);
+    traceArg(mode);
+    real(mode);
+    traceEnd();
+}
+
+static void APIENTRY trace_glFrontFace(GLenum mode)
+{
+    PFNGLFRONTFACEPROC real = (PFNGLFRONTFACEPROC)traceReal[TRACE_glFrontFace];
+    if (!traceActive())
+        return real(mode);
+    traceBegin(TRACE_glFrontFace, 1);
+    traceArg(mode);
+    real(mode);
+    traceEnd();
+}
+
+static void APIENTRY trace_glHint(GLenum target, GLenum mode)
+{
+    PFNGLHINTPROC real = (PFNGLHINTPROC)traceReal[TRACE_glHint];
+    if (!traceActive())
+        return real(target, mode);
+    traceBegin(TRACE_glHint, 2);
+    traceArg(target);
+    traceArg(mode);
+    real(target, mode);
+    traceEnd();
+}
+
+static void APIENTRY trace_glLineWidth(GLfloat width)
+{
+    PFNGLLINEWIDTHPROC real = (PFNGLLINEWIDTHPROC)traceReal[TRACE_glLineWidth];
+    if (!traceActive())
+        return real(width);
+    traceBegin(TRACE_glLineWidth, 1);
+    traceArg(width);
+    real(width);
+    traceEnd();
+}
+
+static void APIENTRY trace_glPointSize(GLfloat size)
+{
+    PFNGLPOINTSIZEPROC real = (PFNGLPOINTSIZEPROC)traceReal[TRACE_glPointSize];
+    if (!traceActive())
+        return real(size);
+    traceBegin(TRACE_glPointSize, 1);
+    traceArg(size);
+    real(size);
+    traceEnd();
+}
+
+static void APIENTRY trace_glPolygonMode(GLenum face, GLenum mode)
+{
+    PFNGLPOLYGONMODEPROC real = (PFNGLPOLYGONMODEPROC)traceReal[TRACE_glPolygonMode];
+    if (!traceActive())
+        return real(face, mode);
+    traceBegin(TRACE_glPolygonMode, 2);
+    traceArg(face);
+    traceArg(mode);
+    real(face, mode);
+    traceEnd();
+}
+
+static void APIENTRY trace_glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    PFNGLSCISSORPROC real = (PFNGLSCISSORPROC)traceReal[TRACE_glScissor];
+    if (!traceActive())
+        return real(x, y, width, height);
+    traceBegin(TRACE_glScissor, 4);
+    traceArg(x);
+    traceArg(y);
+    traceArg(width);
+    traceArg(height);
+    real(x, y, width, height);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexParameterf(GLenum target, GLenum pname, GLfloat param)
+{
+    PFNGLTEXPARAMETERFPROC real = (PFNGLTEXPARAMETERFPROC)traceReal[TRACE_glTexParameterf];
+    if (!traceActive())
+        return real(target, pname, param);
+    traceBegin(TRACE_glTexParameterf, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(param);
+    real(target, pname, param);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexParameterfv(GLenum target, GLenum pname, const GLfloat * params)
+{
+    PFNGLTEXPARAMETERFVPROC real = (PFNGLTEXPARAMETERFVPROC)traceReal[TRACE_glTexParameterfv];
+    if (!traceActive())
+        return real(target, pname, params);
+    traceBegin(TRACE_glTexParameterfv, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(params);
+    tracePayload(params, 4 * sizeof(GLfloat));
+    real(target, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+    PFNGLTEXPARAMETERIPROC real = (PFNGLTEXPARAMETERIPROC)traceReal[TRACE_glTexParameteri];
+    if (!traceActive())
+        return real(target, pname, param);
+    traceBegin(TRACE_glTexParameteri, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(param);
+    real(target, pname, param);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexParameteriv(GLenum target, GLenum pname, const GLint * params)
+{
+    PFNGLTEXPARAMETERIVPROC real = (PFNGLTEXPARAMETERIVPROC)traceReal[TRACE_glTexParameteriv];
+    if (!traceActive())
+        return real(target, pname, params);
+    traceBegin(TRACE_glTexParameteriv, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(params);
+    tracePayload(params, 4 * sizeof(GLint));
+    real(target, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    PFNGLTEXIMAGE1DPROC real = (PFNGLTEXIMAGE1DPROC)traceReal[TRACE_glTexImage1D];
+    if (!traceActive())
+        return real(target, level, internalformat, width, border, format, type, pixels);
+    traceBegin(TRACE_glTexImage1D, 8);
+    traceArg(target);
+    traceArg(level);
+    traceArg(internalformat);
+    traceArg(width);
+    traceArg(border);
+    traceArg(format);
+    traceArg(type);
+    traceArg(pixels);
+    real(target, level, internalformat, width, border, format, type, pixels);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    PFNGLTEXIMAGE2DPROC real = (PFNGLTEXIMAGE2DPROC)traceReal[TRACE_glTexImage2D];
+    if (!traceActive())
+        return real(target, level, internalformat, width, height, border, format, type, pixels);
+    traceBegin(TRACE_glTexImage2D, 9);
+    traceArg(target);
+    traceArg(level);
+    traceArg(internalformat);
+    traceArg(width);
+    traceArg(height);
+    traceArg(border);
+    traceArg(format);
+    traceArg(type);
+    traceArg(pixels);
+    tracePayload(pixels, traceImageBytes(width, height, format, type));
+    real(target, level, internalformat, width, height, border, format, type, pixels);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDrawBuffer(GLenum buf)
+{
+    PFNGLDRAWBUFFERPROC real = (PFNGLDRAWBUFFERPROC)traceReal[TRACE_glDrawBuffer];
+    if (!traceActive())
+        return real(buf);
+    traceBegin(TRACE_glDrawBuffer, 1);
+    traceArg(buf);
+    real(buf);
+    traceEnd();
+}
+
+static void APIENTRY trace_glClear(GLbitfield mask)
+{
+    PFNGLCLEARPROC real = (PFNGLCLEARPROC)traceReal[TRACE_glClear];
+    if (!traceActive())
+        return real(mask);
+    traceBegin(TRACE_glClear, 1);
+    traceArg(mask);
+    real(mask);
+    traceEnd();
+}
+
+static void APIENTRY trace_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    PFNGLCLEARCOLORPROC real = (PFNGLCLEARCOLORPROC)traceReal[TRACE_glClearColor];
+    if (!traceActive())
+        return real(red, green, blue, alpha);
+    traceBegin(TRACE_glClearColor, 4);
+    traceArg(red);
+    traceArg(green);
+    traceArg(blue);
+    traceArg(alpha);
+    real(red, green, blue, alpha);
+    traceEnd();
+}
+
+static void APIENTRY trace_glClearStencil(GLint s)
+{
+    PFNGLCLEARSTENCILPROC real = (PFNGLCLEARSTENCILPROC)traceReal[TRACE_glClearStencil];
+    if (!traceActive())
+        return real(s);
+    traceBegin(TRACE_glClearStencil, 1);
+    traceArg(s);
+    real(s);
+    traceEnd();
+}
+
+static void APIENTRY trace_glClearDepth(GLdouble depth)
+{
+    PFNGLCLEARDEPTHPROC real = (PFNGLCLEARDEPTHPROC)traceReal[TRACE_glClearDepth];
+    if (!traceActive())
+        return real(depth);
+    traceBegin(TRACE_glClearDepth, 1);
+    traceArg(depth);
+    real(depth);
+    traceEnd();
+}
+
+static void APIENTRY trace_glStencilMask(GLuint mask)
+{
+    PFNGLSTENCILMASKPROC real = (PFNGLSTENCILMASKPROC)traceReal[TRACE_glStencilMask];
+    if (!traceActive())
+        return real(mask);
+    traceBegin(TRACE_glStencilMask, 1);
+    traceArg(mask);
+    real(mask);
+    traceEnd();
+}
+
+static void APIENTRY trace_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    PFNGLCOLORMASKPROC real = (PFNGLCOLORMASKPROC)traceReal[TRACE_glColorMask];
+    if (!traceActive())
+        return real(red, green, blue, alpha);
+    traceBegin(TRACE_glColorMask, 4);
+    traceArg(red);
+    traceArg(green);
+    traceArg(blue);
+    traceArg(alpha);
+    real(red, green, blue, alpha);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDepthMask(GLboolean flag)
+{
+    PFNGLDEPTHMASKPROC real = (PFNGLDEPTHMASKPROC)traceReal[TRACE_glDepthMask];
+    if (!traceActive())
+        return real(flag);
+    traceBegin(TRACE_glDepthMask, 1);
+    traceArg(flag);
+    real(flag);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDisable(GLenum cap)
+{
+    PFNGLDISABLEPROC real = (PFNGLDISABLEPROC)traceReal[TRACE_glDisable];
+    if (!traceActive())
+        return real(cap);
+    traceBegin(TRACE_glDisable, 1);
+    traceArg(cap);
+    real(cap);
+    traceEnd();
+}
+
+static void APIENTRY trace_glEnable(GLenum cap)
+{
+    PFNGLENABLEPROC real = (PFNGLENABLEPROC)traceReal[TRACE_glEnable];
+    if (!traceActive())
+        return real(cap);
+    traceBegin(TRACE_glEnable, 1);
+    traceArg(cap);
+    real(cap);
+    traceEnd();
+}
+
+static void APIENTRY trace_glFinish(void)
+{
+    PFNGLFINISHPROC real = (PFNGLFINISHPROC)traceReal[TRACE_glFinish];
+    if (!traceActive())
+        return real();
+    traceBegin(TRACE_glFinish, 0);
+    real();
+    traceEnd();
+}
+
+static void APIENTRY trace_glFlush(void)
+{
+    PFNGLFLUSHPROC real = (PFNGLFLUSHPROC)traceReal[TRACE_glFlush];
+    if (!traceActive())
+        return real();
+    traceBegin(TRACE_glFlush, 0);
+    real();
+    traceEnd();
+}
+
+static void APIENTRY trace_glBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    PFNGLBLENDFUNCPROC real = (PFNGLBLENDFUNCPROC)traceReal[TRACE_glBlendFunc];
+    if (!traceActive())
+        return real(sfactor, dfactor);
+    traceBegin(TRACE_glBlendFunc, 2);
+    traceArg(sfactor);
+    traceArg(dfactor);
+    real(sfactor, dfactor);
+    traceEnd();
+}
+
+static void APIENTRY trace_glLogicOp(GLenum opcode)
+{
+    PFNGLLOGICOPPROC real = (PFNGLLOGICOPPROC)traceReal[TRACE_glLogicOp];
+    if (!traceActive())
+        return real(opcode);
+    traceBegin(TRACE_glLogicOp, 1);
+    traceArg(opcode);
+    real(opcode);
+    traceEnd();
+}
+
+static void APIENTRY trace_glStencilFunc(GLenum func, GLint ref, GLuint mask)
+{
+    PFNGLSTENCILFUNCPROC real = (PFNGLSTENCILFUNCPROC)traceReal[TRACE_glStencilFunc];
+    if (!traceActive())
+        return real(func, ref, mask);
+    traceBegin(TRACE_glStencilFunc, 3);
+    traceArg(func);
+    traceArg(ref);
+    traceArg(mask);
+    real(func, ref, mask);
+    traceEnd();
+}
+
+static void APIENTRY trace_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+{
+    PFNGLSTENCILOPPROC real = (PFNGLSTENCILOPPROC)traceReal[TRACE_glStencilOp];
+    if (!traceActive())
+        return real(fail, zfail, zpass);
+    traceBegin(TRACE_glStencilOp, 3);
+    traceArg(fail);
+    traceArg(zfail);
+    traceArg(zpass);
+    real(fail, zfail, zpass);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDepthFunc(GLenum func)
+{
+    PFNGLDEPTHFUNCPROC real = (PFNGLDEPTHFUNCPROC)traceReal[TRACE_glDepthFunc];
+    if (!traceActive())
+        return real(func);
+    traceBegin(TRACE_glDepthFunc, 1);
+    traceArg(func);
+    real(func);
+    traceEnd();
+}
+
+static void APIENTRY trace_glPixelStoref(GLenum pname, GLfloat param)
+{
+    PFNGLPIXELSTOREFPROC real = (PFNGLPIXELSTOREFPROC)traceReal[TRACE_glPixelStoref];
+    if (!traceActive())
+        return real(pname, param);
+    traceBegin(TRACE_glPixelStoref, 2);
+    traceArg(pname);
+    traceArg(param);
+    real(pname, param);
+    traceEnd();
+}
+
+static void APIENTRY trace_glPixelStorei(GLenum pname, GLint param)
+{
+    PFNGLPIXELSTOREIPROC real = (PFNGLPIXELSTOREIPROC)traceReal[TRACE_glPixelStorei];
+    if (!traceActive())
+        return real(pname, param);
+    traceBegin(TRACE_glPixelStorei, 2);
+    traceArg(pname);
+    traceArg(param);
+    traceHook_glPixelStorei(pname, param);
+    real(pname, param);
+    traceEnd();
+}
+
+static void APIENTRY trace_glReadBuffer(GLenum src)
+{
+    PFNGLREADBUFFERPROC real = (PFNGLREADBUFFERPROC)traceReal[TRACE_glReadBuffer];
+    if (!traceActive())
+        return real(src);
+    traceBegin(TRACE_glReadBuffer, 1);
+    traceArg(src);
+    real(src);
+    traceEnd();
+}
+
+static void APIENTRY trace_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void * pixels)
+{
+    PFNGLREADPIXELSPROC real = (PFNGLREADPIXELSPROC)traceReal[TRACE_glReadPixels];
+    if (!traceActive())
+        return real(x, y, width, height, format, type, pixels);
+    traceBegin(TRACE_glReadPixels, 7);
+    traceArg(x);
+    traceArg(y);
+    traceArg(width);
+    traceArg(height);
+    traceArg(format);
+    traceArg(type);
+    traceArg(pixels);
+    real(x, y, width, height, format, type, pixels);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetBooleanv(GLenum pname, GLboolean * data)
+{
+    PFNGLGETBOOLEANVPROC real = (PFNGLGETBOOLEANVPROC)traceReal[TRACE_glGetBooleanv];
+    if (!traceActive())
+        return real(pname, data);
+    traceBegin(TRACE_glGetBooleanv, 2);
+    traceArg(pname);
+    traceArg(data);
+    real(pname, data);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetDoublev(GLenum pname, GLdouble * data)
+{
+    PFNGLGETDOUBLEVPROC real = (PFNGLGETDOUBLEVPROC)traceReal[TRACE_glGetDoublev];
+    if (!traceActive())
+        return real(pname, data);
+    traceBegin(TRACE_glGetDoublev, 2);
+    traceArg(pname);
+    traceArg(data);
+    real(pname, data);
+    traceEnd();
+}
+
+static GLenum APIENTRY trace_glGetError(void)
+{
+    PFNGLGETERRORPROC real = (PFNGLGETERRORPROC)traceReal[TRACE_glGetError];
+    if (!traceActive())
+        return real();
+    traceBegin(TRACE_glGetError, 0);
+    GLenum result = real();
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glGetFloatv(GLenum pname, GLfloat * data)
+{
+    PFNGLGETFLOATVPROC real = (PFNGLGETFLOATVPROC)traceReal[TRACE_glGetFloatv];
+    if (!traceActive())
+        return real(pname, data);
+    traceBegin(TRACE_glGetFloatv, 2);
+    traceArg(pname);
+    traceArg(data);
+    real(pname, data);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetIntegerv(GLenum pname, GLint * data)
+{
+    PFNGLGETINTEGERVPROC real = (PFNGLGETINTEGERVPROC)traceReal[TRACE_glGetIntegerv];
+    if (!traceActive())
+        return real(pname, data);
+    traceBegin(TRACE_glGetIntegerv, 2);
+    traceArg(pname);
+    traceArg(data);
+    real(pname, data);
+    traceEnd();
+}
+
+static const GLubyte * APIENTRY trace_glGetString(GLenum name)
+{
+    PFNGLGETSTRINGPROC real = (PFNGLGETSTRINGPROC)traceReal[TRACE_glGetString];
+    if (!traceActive())
+        return real(name);
+    traceBegin(TRACE_glGetString, 1);
+    traceArg(name);
+    const GLubyte * result = real(name);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void * pixels)
+{
+    PFNGLGETTEXIMAGEPROC real = (PFNGLGETTEXIMAGEPROC)traceReal[TRACE_glGetTexImage];
+    if (!traceActive())
+        return real(target, level, format, type, pixels);
+    traceBegin(TRACE_glGetTexImage, 5);
+    traceArg(target);
+    traceArg(level);
+    traceArg(format);
+    traceArg(type);
+    traceArg(pixels);
+    real(target, level, format, type, pixels);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+    PFNGLGETTEXPARAMETERFVPROC real = (PFNGLGETTEXPARAMETERFVPROC)traceReal[TRACE_glGetTexParameterfv];
+    if (!traceActive())
+        return real(target, pname, params);
+    traceBegin(TRACE_glGetTexParameterfv, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(params);
+    real(target, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetTexParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+    PFNGLGETTEXPARAMETERIVPROC real = (PFNGLGETTEXPARAMETERIVPROC)traceReal[TRACE_glGetTexParameteriv];
+    if (!traceActive())
+        return real(target, pname, params);
+    traceBegin(TRACE_glGetTexParameteriv, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(params);
+    real(target, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat * params)
+{
+    PFNGLGETTEXLEVELPARAMETERFVPROC real = (PFNGLGETTEXLEVELPARAMETERFVPROC)traceReal[TRACE_glGetTexLevelParameterfv];
+    if (!traceActive())
+        return real(target, level, pname, params);
+    traceBegin(TRACE_glGetTexLevelParameterfv, 4);
+    traceArg(target);
+    traceArg(level);
+    traceArg(pname);
+    traceArg(params);
+    real(target, level, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params)
+{
+    PFNGLGETTEXLEVELPARAMETERIVPROC real = (PFNGLGETTEXLEVELPARAMETERIVPROC)traceReal[TRACE_glGetTexLevelParameteriv];
+    if (!traceActive())
+        return real(target, level, pname, params);
+    traceBegin(TRACE_glGetTexLevelParameteriv, 4);
+    traceArg(target);
+    traceArg(level);
+    traceArg(pname);
+    traceArg(params);
+    real(target, level, pname, params);
+    traceEnd();
+}
+
+static GLboolean APIENTRY trace_glIsEnabled(GLenum cap)
+{
+    PFNGLISENABLEDPROC real = (PFNGLISENABLEDPROC)traceReal[TRACE_glIsEnabled];
+    if (!traceActive())
+        return real(cap);
+    traceBegin(TRACE_glIsEnabled, 1);
+    traceArg(cap);
+    GLboolean result = real(cap);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glDepthRange(GLdouble n, GLdouble f)
+{
+    PFNGLDEPTHRANGEPROC real = (PFNGLDEPTHRANGEPROC)traceReal[TRACE_glDepthRange];
+    if (!traceActive())
+        return real(n, f);
+    traceBegin(TRACE_glDepthRange, 2);
+    traceArg(n);
+    traceArg(f);
+    real(n, f);
+    traceEnd();
+}
+
+static void APIENTRY trace_glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    PFNGLVIEWPORTPROC real = (PFNGLVIEWPORTPROC)traceReal[TRACE_glViewport];
+    if (!traceActive())
+        return real(x, y, width, height);
+    traceBegin(TRACE_glViewport, 4);
+    traceArg(x);
+    traceArg(y);
+    traceArg(width);
+    traceArg(height);
+    real(x, y, width, height);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    PFNGLDRAWARRAYSPROC real = (PFNGLDRAWARRAYSPROC)traceReal[TRACE_glDrawArrays];
+    if (!traceActive())
+        return real(mode, first, count);
+    traceBegin(TRACE_glDrawArrays, 3);
+    traceArg(mode);
+    traceArg(first);
+    traceArg(count);
+    real(mode, first, count);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void * indices)
+{
+    PFNGLDRAWELEMENTSPROC real = (PFNGLDRAWELEMENTSPROC)traceReal[TRACE_glDrawElements];
+    if (!traceActive())
+        return real(mode, count, type, indices);
+    traceBegin(TRACE_glDrawElements, 4);
+    traceArg(mode);
+    traceArg(count);
+    traceArg(type);
+    traceArg(indices);
+    real(mode, count, type, indices);
+    traceEnd();
+}
+
+static void APIENTRY trace_glPolygonOffset(GLfloat factor, GLfloat units)
+{
+    PFNGLPOLYGONOFFSETPROC real = (PFNGLPOLYGONOFFSETPROC)traceReal[TRACE_glPolygonOffset];
+    if (!traceActive())
+        return real(factor, units);
+    traceBegin(TRACE_glPolygonOffset, 2);
+    traceArg(factor);
+    traceArg(units);
+    real(factor, units);
+    traceEnd();
+}
+
+static void APIENTRY trace_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+    PFNGLCOPYTEXIMAGE1DPROC real = (PFNGLCOPYTEXIMAGE1DPROC)traceReal[TRACE_glCopyTexImage1D];
+    if (!traceActive())
+        return real(target, level, internalformat, x, y, width, border);
+    traceBegin(TRACE_glCopyTexImage1D, 7);
+    traceArg(target);
+    traceArg(level);
+    traceArg(internalformat);
+    traceArg(x);
+    traceArg(y);
+    traceArg(width);
+    traceArg(border);
+    real(target, level, internalformat, x, y, width, border);
+    traceEnd();
+}
+
+static void APIENTRY trace_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+    PFNGLCOPYTEXIMAGE2DPROC real = (PFNGLCOPYTEXIMAGE2DPROC)traceReal[TRACE_glCopyTexImage2D];
+    if (!traceActive())
+        return real(target, level, internalformat, x, y, width, height, border);
+    traceBegin(TRACE_glCopyTexImage2D, 8);
+    traceArg(target);
+    traceArg(level);
+    traceArg(internalformat);
+    traceArg(x);
+    traceArg(y);
+    traceArg(width);
+    traceArg(height);
+    traceArg(border);
+    real(target, level, internalformat, x, y, width, height, border);
+    traceEnd();
+}
+
+static void APIENTRY trace_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    PFNGLCOPYTEXSUBIMAGE1DPROC real = (PFNGLCOPYTEXSUBIMAGE1DPROC)traceReal[TRACE_glCopyTexSubImage1D];
+    if (!traceActive())
+        return real(target, level, xoffset, x, y, width);
+    traceBegin(TRACE_glCopyTexSubImage1D, 6);
+    traceArg(target);
+    traceArg(level);
+    traceArg(xoffset);
+    traceArg(x);
+    traceArg(y);
+    traceArg(width);
+    real(target, level, xoffset, x, y, width);
+    traceEnd();
+}
+
+static void APIENTRY trace_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    PFNGLCOPYTEXSUBIMAGE2DPROC real = (PFNGLCOPYTEXSUBIMAGE2DPROC)traceReal[TRACE_glCopyTexSubImage2D];
+    if (!traceActive())
+        return real(target, level, xoffset, yoffset, x, y, width, height);
+    traceBegin(TRACE_glCopyTexSubImage2D, 8);
+    traceArg(target);
+    traceArg(level);
+    traceArg(xoffset);
+    traceArg(yoffset);
+    traceArg(x);
+    traceArg(y);
+    traceArg(width);
+    traceArg(height);
+    real(target, level, xoffset, yoffset, x, y, width, height);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels)
+{
+    PFNGLTEXSUBIMAGE1DPROC real = (PFNGLTEXSUBIMAGE1DPROC)traceReal[TRACE_glTexSubImage1D];
+    if (!traceActive())
+        return real(target, level, xoffset, width, format, type, pixels);
+    traceBegin(TRACE_glTexSubImage1D, 7);
+    traceArg(target);
+    traceArg(level);
+    traceArg(xoffset);
+    traceArg(width);
+    traceArg(format);
+    traceArg(type);
+    traceArg(pixels);
+    real(target, level, xoffset, width, format, type, pixels);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels)
+{
+    PFNGLTEXSUBIMAGE2DPROC real = (PFNGLTEXSUBIMAGE2DPROC)traceReal[TRACE_glTexSubImage2D];
+    if (!traceActive())
+        return real(target, level, xoffset, yoffset, width, height, format, type, pixels);
+    traceBegin(TRACE_glTexSubImage2D, 9);
+    traceArg(target);
+    traceArg(level);
+    traceArg(xoffset);
+    traceArg(yoffset);
+    traceArg(width);
+    traceArg(height);
+    traceArg(format);
+    traceArg(type);
+    traceArg(pixels);
+    tracePayload(pixels, traceImageBytes(width, height, format, type));
+    real(target, level, xoffset, yoffset, width, height, format, type, pixels);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBindTexture(GLenum target, GLuint texture)
+{
+    PFNGLBINDTEXTUREPROC real = (PFNGLBINDTEXTUREPROC)traceReal[TRACE_glBindTexture];
+    if (!traceActive())
+        return real(target, texture);
+    traceBegin(TRACE_glBindTexture, 2);
+    traceArg(target);
+    traceArg(texture);
+    real(target, texture);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDeleteTextures(GLsizei n, const GLuint * textures)
+{
+    PFNGLDELETETEXTURESPROC real = (PFNGLDELETETEXTURESPROC)traceReal[TRACE_glDeleteTextures];
+    if (!traceActive())
+        return real(n, textures);
+    traceBegin(TRACE_glDeleteTextures, 2);
+    traceArg(n);
+    traceArg(textures);
+    tracePayload(textures, (size_t)n * sizeof(GLuint));
+    real(n, textures);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGenTextures(GLsizei n, GLuint * textures)
+{
+    PFNGLGENTEXTURESPROC real = (PFNGLGENTEXTURESPROC)traceReal[TRACE_glGenTextures];
+    if (!traceActive())
+        return real(n, textures);
+    traceBegin(TRACE_glGenTextures, 2);
+    traceArg(n);
+    traceArg(textures);
+    real(n, textures);
+    tracePayload(textures, (size_t)n * sizeof(GLuint));
+    traceEnd();
+}
+
+static GLboolean APIENTRY trace_glIsTexture(GLuint texture)
+{
+    PFNGLISTEXTUREPROC real = (PFNGLISTEXTUREPROC)traceReal[TRACE_glIsTexture];
+    if (!traceActive())
+        return real(texture);
+    traceBegin(TRACE_glIsTexture, 1);
+    traceArg(texture);
+    GLboolean result = real(texture);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices)
+{
+    PFNGLDRAWRANGEELEMENTSPROC real = (PFNGLDRAWRANGEELEMENTSPROC)traceReal[TRACE_glDrawRangeElements];
+    if (!traceActive())
+        return real(mode, start, end, count, type, indices);
+    traceBegin(TRACE_glDrawRangeElements, 6);
+    traceArg(mode);
+    traceArg(start);
+    traceArg(end);
+    traceArg(count);
+    traceArg(type);
+    traceArg(indices);
+    real(mode, start, end, count, type, indices);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels)
+{
+    PFNGLTEXIMAGE3DPROC real = (PFNGLTEXIMAGE3DPROC)traceReal[TRACE_glTexImage3D];
+    if (!traceActive())
+        return real(target, level, internalformat, width, height, depth, border, format, type, pixels);
+    traceBegin(TRACE_glTexImage3D, 10);
+    traceArg(target);
+    traceArg(level);
+    traceArg(internalformat);
+    traceArg(width);
+    traceArg(height);
+    traceArg(depth);
+    traceArg(border);
+    traceArg(format);
+    traceArg(type);
+    traceArg(pixels);
+    real(target, level, internalformat, width, height, depth, border, format, type, pixels);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels)
+{
+    PFNGLTEXSUBIMAGE3DPROC real = (PFNGLTEXSUBIMAGE3DPROC)traceReal[TRACE_glTexSubImage3D];
+    if (!traceActive())
+        return real(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    traceBegin(TRACE_glTexSubImage3D, 11);
+    traceArg(target);
+    traceArg(level);
+    traceArg(xoffset);
+    traceArg(yoffset);
+    traceArg(zoffset);
+    traceArg(width);
+    traceArg(height);
+    traceArg(depth);
+    traceArg(format);
+    traceArg(type);
+    traceArg(pixels);
+    real(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    traceEnd();
+}
+
+static void APIENTRY trace_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    PFNGLCOPYTEXSUBIMAGE3DPROC real = (PFNGLCOPYTEXSUBIMAGE3DPROC)traceReal[TRACE_glCopyTexSubImage3D];
+    if (!traceActive())
+        return real(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    traceBegin(TRACE_glCopyTexSubImage3D, 9);
+    traceArg(target);
+    traceArg(level);
+    traceArg(xoffset);
+    traceArg(yoffset);
+    traceArg(zoffset);
+    traceArg(x);
+    traceArg(y);
+    traceArg(width);
+    traceArg(height);
+    real(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    traceEnd();
+}
+
+static void APIENTRY trace_glActiveTexture(GLenum texture)
+{
+    PFNGLACTIVETEXTUREPROC real = (PFNGLACTIVETEXTUREPROC)traceReal[TRACE_glActiveTexture];
+    if (!traceActive())
+        return real(texture);
+    traceBegin(TRACE_glActiveTexture, 1);
+    traceArg(texture);
+    real(texture);
+    traceEnd();
+}
+
+static void APIENTRY trace_glSampleCoverage(GLfloat value, GLboolean invert)
+{
+    PFNGLSAMPLECOVERAGEPROC real = (PFNGLSAMPLECOVERAGEPROC)traceReal[TRACE_glSampleCoverage];
+    if (!traceActive())
+        return real(value, invert);
+    traceBegin(TRACE_glSampleCoverage, 2);
+    traceArg(value);
+    traceArg(invert);
+    real(value, invert);
+    traceEnd();
+}
+
+static void APIENTRY trace_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data)
+{
+    PFNGLCOMPRESSEDTEXIMAGE3DPROC real = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)traceReal[TRACE_glCompressedTexImage3D];
+    if (!traceActive())
+        return real(target, level, internalformat, width, height, depth, border, imageSize, data);
+    traceBegin(TRACE_glCompressedTexImage3D, 9);
+    traceArg(target);
+    traceArg(level);
+    traceArg(internalformat);
+    traceArg(width);
+    traceArg(height);
+    traceArg(depth);
+    traceArg(border);
+    traceArg(imageSize);
+    traceArg(data);
+    real(target, level, internalformat, width, height, depth, border, imageSize, data);
+    traceEnd();
+}
+
+static void APIENTRY trace_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data)
+{
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC real = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)traceReal[TRACE_glCompressedTexImage2D];
+    if (!traceActive())
+        return real(target, level, internalformat, width, height, border, imageSize, data);
+    traceBegin(TRACE_glCompressedTexImage2D, 8);
+    traceArg(target);
+    traceArg(level);
+    traceArg(internalformat);
+    traceArg(width);
+    traceArg(height);
+    traceArg(border);
+    traceArg(imageSize);
+    traceArg(data);
+    tracePayload(data, (size_t)imageSize);
+    real(target, level, internalformat, width, height, border, imageSize, data);
+    traceEnd();
+}
+
+static void APIENTRY trace_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void * data)
+{
+    PFNGLCOMPRESSEDTEXIMAGE1DPROC real = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)traceReal[TRACE_glCompressedTexImage1D];
+    if (!traceActive())
+        return real(target, level, internalformat, width, border, imageSize, data);
+    traceBegin(TRACE_glCompressedTexImage1D, 7);
+    traceArg(target);
+    traceArg(level);
+    traceArg(internalformat);
+    traceArg(width);
+    traceArg(border);
+    traceArg(imageSize);
+    traceArg(data);
+    real(target, level, internalformat, width, border, imageSize, data);
+    traceEnd();
+}
+
+static void APIENTRY trace_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data)
+{
+    PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC real = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)traceReal[TRACE_glCompressedTexSubImage3D];
+    if (!traceActive())
+        return real(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    traceBegin(TRACE_glCompressedTexSubImage3D, 11);
+    traceArg(target);
+    traceArg(level);
+    traceArg(xoffset);
+    traceArg(yoffset);
+    traceArg(zoffset);
+    traceArg(width);
+    traceArg(height);
+    traceArg(depth);
+    traceArg(format);
+    traceArg(imageSize);
+    traceArg(data);
+    real(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    traceEnd();
+}
+
+static void APIENTRY trace_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data)
+{
+    PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC real = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)traceReal[TRACE_glCompressedTexSubImage2D];
+    if (!traceActive())
+        return real(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    traceBegin(TRACE_glCompressedTexSubImage2D, 9);
+    traceArg(target);
+    traceArg(level);
+    traceArg(xoffset);
+    traceArg(yoffset);
+    traceArg(width);
+    traceArg(height);
+    traceArg(format);
+    traceArg(imageSize);
+    traceArg(data);
+    tracePayload(data, (size_t)imageSize);
+    real(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    traceEnd();
+}
+
+static void APIENTRY trace_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data)
+{
+    PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC real = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)traceReal[TRACE_glCompressedTexSubImage1D];
+    if (!traceActive())
+        return real(target, level, xoffset, width, format, imageSize, data);
+    traceBegin(TRACE_glCompressedTexSubImage1D, 7);
+    traceArg(target);
+    traceArg(level);
+    traceArg(xoffset);
+    traceArg(width);
+    traceArg(format);
+    traceArg(imageSize);
+    traceArg(data);
+    real(target, level, xoffset, width, format, imageSize, data);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetCompressedTexImage(GLenum target, GLint level, void * img)
+{
+    PFNGLGETCOMPRESSEDTEXIMAGEPROC real = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)traceReal[TRACE_glGetCompressedTexImage];
+    if (!traceActive())
+        return real(target, level, img);
+    traceBegin(TRACE_glGetCompressedTexImage, 3);
+    traceArg(target);
+    traceArg(level);
+    traceArg(img);
+    real(target, level, img);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    PFNGLBLENDFUNCSEPARATEPROC real = (PFNGLBLENDFUNCSEPARATEPROC)traceReal[TRACE_glBlendFuncSeparate];
+    if (!traceActive())
+        return real(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    traceBegin(TRACE_glBlendFuncSeparate, 4);
+    traceArg(sfactorRGB);
+    traceArg(dfactorRGB);
+    traceArg(sfactorAlpha);
+    traceArg(dfactorAlpha);
+    real(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    traceEnd();
+}
+
+static void APIENTRY trace_glMultiDrawArrays(GLenum mode, const GLint * first, const GLsizei * count, GLsizei drawcount)
+{
+    PFNGLMULTIDRAWARRAYSPROC real = (PFNGLMULTIDRAWARRAYSPROC)traceReal[TRACE_glMultiDrawArrays];
+    if (!traceActive())
+        return real(mode, first, count, drawcount);
+    traceBegin(TRACE_glMultiDrawArrays, 4);
+    traceArg(mode);
+    traceArg(first);
+    traceArg(count);
+    traceArg(drawcount);
+    real(mode, first, count, drawcount);
+    traceEnd();
+}
+
+static void APIENTRY trace_glMultiDrawElements(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount)
+{
+    PFNGLMULTIDRAWELEMENTSPROC real = (PFNGLMULTIDRAWELEMENTSPROC)traceReal[TRACE_glMultiDrawElements];
+    if (!traceActive())
+        return real(mode, count, type, indices, drawcount);
+    traceBegin(TRACE_glMultiDrawElements, 5);
+    traceArg(mode);
+    traceArg(count);
+    traceArg(type);
+    traceArg(indices);
+    traceArg(drawcount);
+    real(mode, count, type, indices, drawcount);
+    traceEnd();
+}
+
+static void APIENTRY trace_glPointParameterf(GLenum pname, GLfloat param)
+{
+    PFNGLPOINTPARAMETERFPROC real = (PFNGLPOINTPARAMETERFPROC)traceReal[TRACE_glPointParameterf];
+    if (!traceActive())
+        return real(pname, param);
+    traceBegin(TRACE_glPointParameterf, 2);
+    traceArg(pname);
+    traceArg(param);
+    real(pname, param);
+    traceEnd();
+}
+
+static void APIENTRY trace_glPointParameterfv(GLenum pname, const GLfloat * params)
+{
+    PFNGLPOINTPARAMETERFVPROC real = (PFNGLPOINTPARAMETERFVPROC)traceReal[TRACE_glPointParameterfv];
+    if (!traceActive())
+        return real(pname, params);
+    traceBegin(TRACE_glPointParameterfv, 2);
+    traceArg(pname);
+    traceArg(params);
+    real(pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glPointParameteri(GLenum pname, GLint param)
+{
+    PFNGLPOINTPARAMETERIPROC real = (PFNGLPOINTPARAMETERIPROC)traceReal[TRACE_glPointParameteri];
+    if (!traceActive())
+        return real(pname, param);
+    traceBegin(TRACE_glPointParameteri, 2);
+    traceArg(pname);
+    traceArg(param);
+    real(pname, param);
+    traceEnd();
+}
+
+static void APIENTRY trace_glPointParameteriv(GLenum pname, const GLint * params)
+{
+    PFNGLPOINTPARAMETERIVPROC real = (PFNGLPOINTPARAMETERIVPROC)traceReal[TRACE_glPointParameteriv];
+    if (!traceActive())
+        return real(pname, params);
+    traceBegin(TRACE_glPointParameteriv, 2);
+    traceArg(pname);
+    traceArg(params);
+    real(pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    PFNGLBLENDCOLORPROC real = (PFNGLBLENDCOLORPROC)traceReal[TRACE_glBlendColor];
+    if (!traceActive())
+        return real(red, green, blue, alpha);
+    traceBegin(TRACE_glBlendColor, 4);
+    traceArg(red);
+    traceArg(green);
+    traceArg(blue);
+    traceArg(alpha);
+    real(red, green, blue, alpha);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBlendEquation(GLenum mode)
+{
+    PFNGLBLENDEQUATIONPROC real = (PFNGLBLENDEQUATIONPROC)traceReal[TRACE_glBlendEquation];
+    if (!traceActive())
+        return real(mode);
+    traceBegin(TRACE_glBlendEquation, 1);
+    traceArg(mode);
+    real(mode);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGenQueries(GLsizei n, GLuint * ids)
+{
+    PFNGLGENQUERIESPROC real = (PFNGLGENQUERIESPROC)traceReal[TRACE_glGenQueries];
+    if (!traceActive())
+        return real(n, ids);
+    traceBegin(TRACE_glGenQueries, 2);
+    traceArg(n);
+    traceArg(ids);
+    real(n, ids);
+    tracePayload(ids, (size_t)n * sizeof(GLuint));
+    traceEnd();
+}
+
+static void APIENTRY trace_glDeleteQueries(GLsizei n, const GLuint * ids)
+{
+    PFNGLDELETEQUERIESPROC real = (PFNGLDELETEQUERIESPROC)traceReal[TRACE_glDeleteQueries];
+    if (!traceActive())
+        return real(n, ids);
+    traceBegin(TRACE_glDeleteQueries, 2);
+    traceArg(n);
+    traceArg(ids);
+    tracePayload(ids, (size_t)n * sizeof(GLuint));
+    real(n, ids);
+    traceEnd();
+}
+
+static GLboolean APIENTRY trace_glIsQuery(GLuint id)
+{
+    PFNGLISQUERYPROC real = (PFNGLISQUERYPROC)traceReal[TRACE_glIsQuery];
+    if (!traceActive())
+        return real(id);
+    traceBegin(TRACE_glIsQuery, 1);
+    traceArg(id);
+    GLboolean result = real(id);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glBeginQuery(GLenum target, GLuint id)
+{
+    PFNGLBEGINQUERYPROC real = (PFNGLBEGINQUERYPROC)traceReal[TRACE_glBeginQuery];
+    if (!traceActive())
+        return real(target, id);
+    traceBegin(TRACE_glBeginQuery, 2);
+    traceArg(target);
+    traceArg(id);
+    real(target, id);
+    traceEnd();
+}
+
+static void APIENTRY trace_glEndQuery(GLenum target)
+{
+    PFNGLENDQUERYPROC real = (PFNGLENDQUERYPROC)traceReal[TRACE_glEndQuery];
+    if (!traceActive())
+        return real(target);
+    traceBegin(TRACE_glEndQuery, 1);
+    traceArg(target);
+    real(target);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetQueryiv(GLenum target, GLenum pname, GLint * params)
+{
+    PFNGLGETQUERYIVPROC real = (PFNGLGETQUERYIVPROC)traceReal[TRACE_glGetQueryiv];
+    if (!traceActive())
+        return real(target, pname, params);
+    traceBegin(TRACE_glGetQueryiv, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(params);
+    real(target, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetQueryObjectiv(GLuint id, GLenum pname, GLint * params)
+{
+    PFNGLGETQUERYOBJECTIVPROC real = (PFNGLGETQUERYOBJECTIVPROC)traceReal[TRACE_glGetQueryObjectiv];
+    if (!traceActive())
+        return real(id, pname, params);
+    traceBegin(TRACE_glGetQueryObjectiv, 3);
+    traceArg(id);
+    traceArg(pname);
+    traceArg(params);
+    real(id, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint * params)
+{
+    PFNGLGETQUERYOBJECTUIVPROC real = (PFNGLGETQUERYOBJECTUIVPROC)traceReal[TRACE_glGetQueryObjectuiv];
+    if (!traceActive())
+        return real(id, pname, params);
+    traceBegin(TRACE_glGetQueryObjectuiv, 3);
+    traceArg(id);
+    traceArg(pname);
+    traceArg(params);
+    real(id, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBindBuffer(GLenum target, GLuint buffer)
+{
+    PFNGLBINDBUFFERPROC real = (PFNGLBINDBUFFERPROC)traceReal[TRACE_glBindBuffer];
+    if (!traceActive())
+        return real(target, buffer);
+    traceBegin(TRACE_glBindBuffer, 2);
+    traceArg(target);
+    traceArg(buffer);
+    traceHook_glBindBuffer(target, buffer);
+    real(target, buffer);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDeleteBuffers(GLsizei n, const GLuint * buffers)
+{
+    PFNGLDELETEBUFFERSPROC real = (PFNGLDELETEBUFFERSPROC)traceReal[TRACE_glDeleteBuffers];
+    if (!traceActive())
+        return real(n, buffers);
+    traceBegin(TRACE_glDeleteBuffers, 2);
+    traceArg(n);
+    traceArg(buffers);
+    tracePayload(buffers, (size_t)n * sizeof(GLuint));
+    real(n, buffers);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGenBuffers(GLsizei n, GLuint * buffers)
+{
+    PFNGLGENBUFFERSPROC real = (PFNGLGENBUFFERSPROC)traceReal[TRACE_glGenBuffers];
+    if (!traceActive())
+        return real(n, buffers);
+    traceBegin(TRACE_glGenBuffers, 2);
+    traceArg(n);
+    traceArg(buffers);
+    real(n, buffers);
+    tracePayload(buffers, (size_t)n * sizeof(GLuint));
+    traceEnd();
+}
+
+static GLboolean APIENTRY trace_glIsBuffer(GLuint buffer)
+{
+    PFNGLISBUFFERPROC real = (PFNGLISBUFFERPROC)traceReal[TRACE_glIsBuffer];
+    if (!traceActive())
+        return real(buffer);
+    traceBegin(TRACE_glIsBuffer, 1);
+    traceArg(buffer);
+    GLboolean result = real(buffer);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glBufferData(GLenum target, GLsizeiptr size, const void * data, GLenum usage)
+{
+    PFNGLBUFFERDATAPROC real = (PFNGLBUFFERDATAPROC)traceReal[TRACE_glBufferData];
+    if (!traceActive())
+        return real(target, size, data, usage);
+    traceBegin(TRACE_glBufferData, 4);
+    traceArg(target);
+    traceArg(size);
+    traceArg(data);
+    traceArg(usage);
+    tracePayload(data, (size_t)size);
+    real(target, size, data, usage);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void * data)
+{
+    PFNGLBUFFERSUBDATAPROC real = (PFNGLBUFFERSUBDATAPROC)traceReal[TRACE_glBufferSubData];
+    if (!traceActive())
+        return real(target, offset, size, data);
+    traceBegin(TRACE_glBufferSubData, 4);
+    traceArg(target);
+    traceArg(offset);
+    traceArg(size);
+    traceArg(data);
+    tracePayload(data, (size_t)size);
+    real(target, offset, size, data);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void * data)
+{
+    PFNGLGETBUFFERSUBDATAPROC real = (PFNGLGETBUFFERSUBDATAPROC)traceReal[TRACE_glGetBufferSubData];
+    if (!traceActive())
+        return real(target, offset, size, data);
+    traceBegin(TRACE_glGetBufferSubData, 4);
+    traceArg(target);
+    traceArg(offset);
+    traceArg(size);
+    traceArg(data);
+    real(target, offset, size, data);
+    traceEnd();
+}
+
+static void * APIENTRY trace_glMapBuffer(GLenum target, GLenum access)
+{
+    PFNGLMAPBUFFERPROC real = (PFNGLMAPBUFFERPROC)traceReal[TRACE_glMapBuffer];
+    if (!traceActive())
+        return real(target, access);
+    traceBegin(TRACE_glMapBuffer, 2);
+    traceArg(target);
+    traceArg(access);
+    void * result = real(target, access);
+    traceAfter_glMapBuffer(target, access, result);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static GLboolean APIENTRY trace_glUnmapBuffer(GLenum target)
+{
+    PFNGLUNMAPBUFFERPROC real = (PFNGLUNMAPBUFFERPROC)traceReal[TRACE_glUnmapBuffer];
+    if (!traceActive())
+        return real(target);
+    traceBegin(TRACE_glUnmapBuffer, 1);
+    traceArg(target);
+    traceHook_glUnmapBuffer(target);
+    GLboolean result = real(target);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glGetBufferParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+    PFNGLGETBUFFERPARAMETERIVPROC real = (PFNGLGETBUFFERPARAMETERIVPROC)traceReal[TRACE_glGetBufferParameteriv];
+    if (!traceActive())
+        return real(target, pname, params);
+    traceBegin(TRACE_glGetBufferParameteriv, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(params);
+    real(target, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetBufferPointerv(GLenum target, GLenum pname, void ** params)
+{
+    PFNGLGETBUFFERPOINTERVPROC real = (PFNGLGETBUFFERPOINTERVPROC)traceReal[TRACE_glGetBufferPointerv];
+    if (!traceActive())
+        return real(target, pname, params);
+    traceBegin(TRACE_glGetBufferPointerv, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(params);
+    real(target, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+{
+    PFNGLBLENDEQUATIONSEPARATEPROC real = (PFNGLBLENDEQUATIONSEPARATEPROC)traceReal[TRACE_glBlendEquationSeparate];
+    if (!traceActive())
+        return real(modeRGB, modeAlpha);
+    traceBegin(TRACE_glBlendEquationSeparate, 2);
+    traceArg(modeRGB);
+    traceArg(modeAlpha);
+    real(modeRGB, modeAlpha);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDrawBuffers(GLsizei n, const GLenum * bufs)
+{
+    PFNGLDRAWBUFFERSPROC real = (PFNGLDRAWBUFFERSPROC)traceReal[TRACE_glDrawBuffers];
+    if (!traceActive())
+        return real(n, bufs);
+    traceBegin(TRACE_glDrawBuffers, 2);
+    traceArg(n);
+    traceArg(bufs);
+    tracePayload(bufs, (size_t)n * sizeof(GLenum));
+    real(n, bufs);
+    traceEnd();
+}
+
+static void APIENTRY trace_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    PFNGLSTENCILOPSEPARATEPROC real = (PFNGLSTENCILOPSEPARATEPROC)traceReal[TRACE_glStencilOpSeparate];
+    if (!traceActive())
+        return real(face, sfail, dpfail, dppass);
+    traceBegin(TRACE_glStencilOpSeparate, 4);
+    traceArg(face);
+    traceArg(sfail);
+    traceArg(dpfail);
+    traceArg(dppass);
+    real(face, sfail, dpfail, dppass);
+    traceEnd();
+}
+
+static void APIENTRY trace_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    PFNGLSTENCILFUNCSEPARATEPROC real = (PFNGLSTENCILFUNCSEPARATEPROC)traceReal[TRACE_glStencilFuncSeparate];
+    if (!traceActive())
+        return real(face, func, ref, mask);
+    traceBegin(TRACE_glStencilFuncSeparate, 4);
+    traceArg(face);
+    traceArg(func);
+    traceArg(ref);
+    traceArg(mask);
+    real(face, func, ref, mask);
+    traceEnd();
+}
+
+static void APIENTRY trace_glStencilMaskSeparate(GLenum face, GLuint mask)
+{
+    PFNGLSTENCILMASKSEPARATEPROC real = (PFNGLSTENCILMASKSEPARATEPROC)traceReal[TRACE_glStencilMaskSeparate];
+    if (!traceActive())
+        return real(face, mask);
+    traceBegin(TRACE_glStencilMaskSeparate, 2);
+    traceArg(face);
+    traceArg(mask);
+    real(face, mask);
+    traceEnd();
+}
+
+static void APIENTRY trace_glAttachShader(GLuint program, GLuint shader)
+{
+    PFNGLATTACHSHADERPROC real = (PFNGLATTACHSHADERPROC)traceReal[TRACE_glAttachShader];
+    if (!traceActive())
+        return real(program, shader);
+    traceBegin(TRACE_glAttachShader, 2);
+    traceArg(program);
+    traceArg(shader);
+    real(program, shader);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBindAttribLocation(GLuint program, GLuint index, const GLchar * name)
+{
+    PFNGLBINDATTRIBLOCATIONPROC real = (PFNGLBINDATTRIBLOCATIONPROC)traceReal[TRACE_glBindAttribLocation];
+    if (!traceActive())
+        return real(program, index, name);
+    traceBegin(TRACE_glBindAttribLocation, 3);
+    traceArg(program);
+    traceArg(index);
+    traceArg(name);
+    tracePayload(name, strlen(name) + 1);
+    real(program, index, name);
+    traceEnd();
+}
+
+static void APIENTRY trace_glCompileShader(GLuint shader)
+{
+    PFNGLCOMPILESHADERPROC real = (PFNGLCOMPILESHADERPROC)traceReal[TRACE_glCompileShader];
+    if (!traceActive())
+        return real(shader);
+    traceBegin(TRACE_glCompileShader, 1);
+    traceArg(shader);
+    real(shader);
+    traceEnd();
+}
+
+static GLuint APIENTRY trace_glCreateProgram(void)
+{
+    PFNGLCREATEPROGRAMPROC real = (PFNGLCREATEPROGRAMPROC)traceReal[TRACE_glCreateProgram];
+    if (!traceActive())
+        return real();
+    traceBegin(TRACE_glCreateProgram, 0);
+    GLuint result = real();
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static GLuint APIENTRY trace_glCreateShader(GLenum type)
+{
+    PFNGLCREATESHADERPROC real = (PFNGLCREATESHADERPROC)traceReal[TRACE_glCreateShader];
+    if (!traceActive())
+        return real(type);
+    traceBegin(TRACE_glCreateShader, 1);
+    traceArg(type);
+    GLuint result = real(type);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glDeleteProgram(GLuint program)
+{
+    PFNGLDELETEPROGRAMPROC real = (PFNGLDELETEPROGRAMPROC)traceReal[TRACE_glDeleteProgram];
+    if (!traceActive())
+        return real(program);
+    traceBegin(TRACE_glDeleteProgram, 1);
+    traceArg(program);
+    real(program);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDeleteShader(GLuint shader)
+{
+    PFNGLDELETESHADERPROC real = (PFNGLDELETESHADERPROC)traceReal[TRACE_glDeleteShader];
+    if (!traceActive())
+        return real(shader);
+    traceBegin(TRACE_glDeleteShader, 1);
+    traceArg(shader);
+    real(shader);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDetachShader(GLuint program, GLuint shader)
+{
+    PFNGLDETACHSHADERPROC real = (PFNGLDETACHSHADERPROC)traceReal[TRACE_glDetachShader];
+    if (!traceActive())
+        return real(program, shader);
+    traceBegin(TRACE_glDetachShader, 2);
+    traceArg(program);
+    traceArg(shader);
+    real(program, shader);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDisableVertexAttribArray(GLuint index)
+{
+    PFNGLDISABLEVERTEXATTRIBARRAYPROC real = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)traceReal[TRACE_glDisableVertexAttribArray];
+    if (!traceActive())
+        return real(index);
+    traceBegin(TRACE_glDisableVertexAttribArray, 1);
+    traceArg(index);
+    real(index);
+    traceEnd();
+}
+
+static void APIENTRY trace_glEnableVertexAttribArray(GLuint index)
+{
+    PFNGLENABLEVERTEXATTRIBARRAYPROC real = (PFNGLENABLEVERTEXATTRIBARRAYPROC)traceReal[TRACE_glEnableVertexAttribArray];
+    if (!traceActive())
+        return real(index);
+    traceBegin(TRACE_glEnableVertexAttribArray, 1);
+    traceArg(index);
+    real(index);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)
+{
+    PFNGLGETACTIVEATTRIBPROC real = (PFNGLGETACTIVEATTRIBPROC)traceReal[TRACE_glGetActiveAttrib];
+    if (!traceActive())
+        return real(program, index, bufSize, length, size, type, name);
+    traceBegin(TRACE_glGetActiveAttrib, 7);
+    traceArg(program);
+    traceArg(index);
+    traceArg(bufSize);
+    traceArg(length);
+    traceArg(size);
+    traceArg(type);
+    traceArg(name);
+    real(program, index, bufSize, length, size, type, name);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)
+{
+    PFNGLGETACTIVEUNIFORMPROC real = (PFNGLGETACTIVEUNIFORMPROC)traceReal[TRACE_glGetActiveUniform];
+    if (!traceActive())
+        return real(program, index, bufSize, length, size, type, name);
+    traceBegin(TRACE_glGetActiveUniform, 7);
+    traceArg(program);
+    traceArg(index);
+    traceArg(bufSize);
+    traceArg(length);
+    traceArg(size);
+    traceArg(type);
+    traceArg(name);
+    real(program, index, bufSize, length, size, type, name);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * shaders)
+{
+    PFNGLGETATTACHEDSHADERSPROC real = (PFNGLGETATTACHEDSHADERSPROC)traceReal[TRACE_glGetAttachedShaders];
+    if (!traceActive())
+        return real(program, maxCount, count, shaders);
+    traceBegin(TRACE_glGetAttachedShaders, 4);
+    traceArg(program);
+    traceArg(maxCount);
+    traceArg(count);
+    traceArg(shaders);
+    real(program, maxCount, count, shaders);
+    traceEnd();
+}
+
+static GLint APIENTRY trace_glGetAttribLocation(GLuint program, const GLchar * name)
+{
+    PFNGLGETATTRIBLOCATIONPROC real = (PFNGLGETATTRIBLOCATIONPROC)traceReal[TRACE_glGetAttribLocation];
+    if (!traceActive())
+        return real(program, name);
+    traceBegin(TRACE_glGetAttribLocation, 2);
+    traceArg(program);
+    traceArg(name);
+    tracePayload(name, strlen(name) + 1);
+    GLint result = real(program, name);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glGetProgramiv(GLuint program, GLenum pname, GLint * params)
+{
+    PFNGLGETPROGRAMIVPROC real = (PFNGLGETPROGRAMIVPROC)traceReal[TRACE_glGetProgramiv];
+    if (!traceActive())
+        return real(program, pname, params);
+    traceBegin(TRACE_glGetProgramiv, 3);
+    traceArg(program);
+    traceArg(pname);
+    traceArg(params);
+    real(program, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
+{
+    PFNGLGETPROGRAMINFOLOGPROC real = (PFNGLGETPROGRAMINFOLOGPROC)traceReal[TRACE_glGetProgramInfoLog];
+    if (!traceActive())
+        return real(program, bufSize, length, infoLog);
+    traceBegin(TRACE_glGetProgramInfoLog, 4);
+    traceArg(program);
+    traceArg(bufSize);
+    traceArg(length);
+    traceArg(infoLog);
+    real(program, bufSize, length, infoLog);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetShaderiv(GLuint shader, GLenum pname, GLint * params)
+{
+    PFNGLGETSHADERIVPROC real = (PFNGLGETSHADERIVPROC)traceReal[TRACE_glGetShaderiv];
+    if (!traceActive())
+        return real(shader, pname, params);
+    traceBegin(TRACE_glGetShaderiv, 3);
+    traceArg(shader);
+    traceArg(pname);
+    traceArg(params);
+    real(shader, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
+{
+    PFNGLGETSHADERINFOLOGPROC real = (PFNGLGETSHADERINFOLOGPROC)traceReal[TRACE_glGetShaderInfoLog];
+    if (!traceActive())
+        return real(shader, bufSize, length, infoLog);
+    traceBegin(TRACE_glGetShaderInfoLog, 4);
+    traceArg(shader);
+    traceArg(bufSize);
+    traceArg(length);
+    traceArg(infoLog);
+    real(shader, bufSize, length, infoLog);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * source)
+{
+    PFNGLGETSHADERSOURCEPROC real = (PFNGLGETSHADERSOURCEPROC)traceReal[TRACE_glGetShaderSource];
+    if (!traceActive())
+        return real(shader, bufSize, length, source);
+    traceBegin(TRACE_glGetShaderSource, 4);
+    traceArg(shader);
+    traceArg(bufSize);
+    traceArg(length);
+    traceArg(source);
+    real(shader, bufSize, length, source);
+    traceEnd();
+}
+
+static GLint APIENTRY trace_glGetUniformLocation(GLuint program, const GLchar * name)
+{
+    PFNGLGETUNIFORMLOCATIONPROC real = (PFNGLGETUNIFORMLOCATIONPROC)traceReal[TRACE_glGetUniformLocation];
+    if (!traceActive())
+        return real(program, name);
+    traceBegin(TRACE_glGetUniformLocation, 2);
+    traceArg(program);
+    traceArg(name);
+    tracePayload(name, strlen(name) + 1);
+    GLint result = real(program, name);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glGetUniformfv(GLuint program, GLint location, GLfloat * params)
+{
+    PFNGLGETUNIFORMFVPROC real = (PFNGLGETUNIFORMFVPROC)traceReal[TRACE_glGetUniformfv];
+    if (!traceActive())
+        return real(program, location, params);
+    traceBegin(TRACE_glGetUniformfv, 3);
+    traceArg(program);
+    traceArg(location);
+    traceArg(params);
+    real(program, location, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetUniformiv(GLuint program, GLint location, GLint * params)
+{
+    PFNGLGETUNIFORMIVPROC real = (PFNGLGETUNIFORMIVPROC)traceReal[TRACE_glGetUniformiv];
+    if (!traceActive())
+        return real(program, location, params);
+    traceBegin(TRACE_glGetUniformiv, 3);
+    traceArg(program);
+    traceArg(location);
+    traceArg(params);
+    real(program, location, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble * params)
+{
+    PFNGLGETVERTEXATTRIBDVPROC real = (PFNGLGETVERTEXATTRIBDVPROC)traceReal[TRACE_glGetVertexAttribdv];
+    if (!traceActive())
+        return real(index, pname, params);
+    traceBegin(TRACE_glGetVertexAttribdv, 3);
+    traceArg(index);
+    traceArg(pname);
+    traceArg(params);
+    real(index, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat * params)
+{
+    PFNGLGETVERTEXATTRIBFVPROC real = (PFNGLGETVERTEXATTRIBFVPROC)traceReal[TRACE_glGetVertexAttribfv];
+    if (!traceActive())
+        return real(index, pname, params);
+    traceBegin(TRACE_glGetVertexAttribfv, 3);
+    traceArg(index);
+    traceArg(pname);
+    traceArg(params);
+    real(index, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetVertexAttribiv(GLuint index, GLenum pname, GLint * params)
+{
+    PFNGLGETVERTEXATTRIBIVPROC real = (PFNGLGETVERTEXATTRIBIVPROC)traceReal[TRACE_glGetVertexAttribiv];
+    if (!traceActive())
+        return real(index, pname, params);
+    traceBegin(TRACE_glGetVertexAttribiv, 3);
+    traceArg(index);
+    traceArg(pname);
+    traceArg(params);
+    real(index, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetVertexAttribPointerv(GLuint index, GLenum pname, void ** pointer)
+{
+    PFNGLGETVERTEXATTRIBPOINTERVPROC real = (PFNGLGETVERTEXATTRIBPOINTERVPROC)traceReal[TRACE_glGetVertexAttribPointerv];
+    if (!traceActive())
+        return real(index, pname, pointer);
+    traceBegin(TRACE_glGetVertexAttribPointerv, 3);
+    traceArg(index);
+    traceArg(pname);
+    traceArg(pointer);
+    real(index, pname, pointer);
+    traceEnd();
+}
+
+static GLboolean APIENTRY trace_glIsProgram(GLuint program)
+{
+    PFNGLISPROGRAMPROC real = (PFNGLISPROGRAMPROC)traceReal[TRACE_glIsProgram];
+    if (!traceActive())
+        return real(program);
+    traceBegin(TRACE_glIsProgram, 1);
+    traceArg(program);
+    GLboolean result = real(program);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static GLboolean APIENTRY trace_glIsShader(GLuint shader)
+{
+    PFNGLISSHADERPROC real = (PFNGLISSHADERPROC)traceReal[TRACE_glIsShader];
+    if (!traceActive())
+        return real(shader);
+    traceBegin(TRACE_glIsShader, 1);
+    traceArg(shader);
+    GLboolean result = real(shader);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glLinkProgram(GLuint program)
+{
+    PFNGLLINKPROGRAMPROC real = (PFNGLLINKPROGRAMPROC)traceReal[TRACE_glLinkProgram];
+    if (!traceActive())
+        return real(program);
+    traceBegin(TRACE_glLinkProgram, 1);
+    traceArg(program);
+    real(program);
+    traceEnd();
+}
+
+static void APIENTRY trace_glShaderSource(GLuint shader, GLsizei count, const GLchar *const* string, const GLint * length)
+{
+    PFNGLSHADERSOURCEPROC real = (PFNGLSHADERSOURCEPROC)traceReal[TRACE_glShaderSource];
+    if (!traceActive())
+        return real(shader, count, string, length);
+    traceBegin(TRACE_glShaderSource, 4);
+    traceArg(shader);
+    traceArg(count);
+    traceArg(string);
+    traceArg(length);
+    traceHook_glShaderSource(shader, count, string, length);
+    real(shader, count, string, length);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUseProgram(GLuint program)
+{
+    PFNGLUSEPROGRAMPROC real = (PFNGLUSEPROGRAMPROC)traceReal[TRACE_glUseProgram];
+    if (!traceActive())
+        return real(program);
+    traceBegin(TRACE_glUseProgram, 1);
+    traceArg(program);
+    real(program);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform1f(GLint location, GLfloat v0)
+{
+    PFNGLUNIFORM1FPROC real = (PFNGLUNIFORM1FPROC)traceReal[TRACE_glUniform1f];
+    if (!traceActive())
+        return real(location, v0);
+    traceBegin(TRACE_glUniform1f, 2);
+    traceArg(location);
+    traceArg(v0);
+    real(location, v0);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+    PFNGLUNIFORM2FPROC real = (PFNGLUNIFORM2FPROC)traceReal[TRACE_glUniform2f];
+    if (!traceActive())
+        return real(location, v0, v1);
+    traceBegin(TRACE_glUniform2f, 3);
+    traceArg(location);
+    traceArg(v0);
+    traceArg(v1);
+    real(location, v0, v1);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    PFNGLUNIFORM3FPROC real = (PFNGLUNIFORM3FPROC)traceReal[TRACE_glUniform3f];
+    if (!traceActive())
+        return real(location, v0, v1, v2);
+    traceBegin(TRACE_glUniform3f, 4);
+    traceArg(location);
+    traceArg(v0);
+    traceArg(v1);
+    traceArg(v2);
+    real(location, v0, v1, v2);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    PFNGLUNIFORM4FPROC real = (PFNGLUNIFORM4FPROC)traceReal[TRACE_glUniform4f];
+    if (!traceActive())
+        return real(location, v0, v1, v2, v3);
+    traceBegin(TRACE_glUniform4f, 5);
+    traceArg(location);
+    traceArg(v0);
+    traceArg(v1);
+    traceArg(v2);
+    traceArg(v3);
+    real(location, v0, v1, v2, v3);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform1i(GLint location, GLint v0)
+{
+    PFNGLUNIFORM1IPROC real = (PFNGLUNIFORM1IPROC)traceReal[TRACE_glUniform1i];
+    if (!traceActive())
+        return real(location, v0);
+    traceBegin(TRACE_glUniform1i, 2);
+    traceArg(location);
+    traceArg(v0);
+    real(location, v0);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform2i(GLint location, GLint v0, GLint v1)
+{
+    PFNGLUNIFORM2IPROC real = (PFNGLUNIFORM2IPROC)traceReal[TRACE_glUniform2i];
+    if (!traceActive())
+        return real(location, v0, v1);
+    traceBegin(TRACE_glUniform2i, 3);
+    traceArg(location);
+    traceArg(v0);
+    traceArg(v1);
+    real(location, v0, v1);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+{
+    PFNGLUNIFORM3IPROC real = (PFNGLUNIFORM3IPROC)traceReal[TRACE_glUniform3i];
+    if (!traceActive())
+        return real(location, v0, v1, v2);
+    traceBegin(TRACE_glUniform3i, 4);
+    traceArg(location);
+    traceArg(v0);
+    traceArg(v1);
+    traceArg(v2);
+    real(location, v0, v1, v2);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    PFNGLUNIFORM4IPROC real = (PFNGLUNIFORM4IPROC)traceReal[TRACE_glUniform4i];
+    if (!traceActive())
+        return real(location, v0, v1, v2, v3);
+    traceBegin(TRACE_glUniform4i, 5);
+    traceArg(location);
+    traceArg(v0);
+    traceArg(v1);
+    traceArg(v2);
+    traceArg(v3);
+    real(location, v0, v1, v2, v3);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform1fv(GLint location, GLsizei count, const GLfloat * value)
+{
+    PFNGLUNIFORM1FVPROC real = (PFNGLUNIFORM1FVPROC)traceReal[TRACE_glUniform1fv];
+    if (!traceActive())
+        return real(location, count, value);
+    traceBegin(TRACE_glUniform1fv, 3);
+    traceArg(location);
+    traceArg(count);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 1 * 4);
+    real(location, count, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform2fv(GLint location, GLsizei count, const GLfloat * value)
+{
+    PFNGLUNIFORM2FVPROC real = (PFNGLUNIFORM2FVPROC)traceReal[TRACE_glUniform2fv];
+    if (!traceActive())
+        return real(location, count, value);
+    traceBegin(TRACE_glUniform2fv, 3);
+    traceArg(location);
+    traceArg(count);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 2 * 4);
+    real(location, count, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform3fv(GLint location, GLsizei count, const GLfloat * value)
+{
+    PFNGLUNIFORM3FVPROC real = (PFNGLUNIFORM3FVPROC)traceReal[TRACE_glUniform3fv];
+    if (!traceActive())
+        return real(location, count, value);
+    traceBegin(TRACE_glUniform3fv, 3);
+    traceArg(location);
+    traceArg(count);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 3 * 4);
+    real(location, count, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform4fv(GLint location, GLsizei count, const GLfloat * value)
+{
+    PFNGLUNIFORM4FVPROC real = (PFNGLUNIFORM4FVPROC)traceReal[TRACE_glUniform4fv];
+    if (!traceActive())
+        return real(location, count, value);
+    traceBegin(TRACE_glUniform4fv, 3);
+    traceArg(location);
+    traceArg(count);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 4 * 4);
+    real(location, count, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform1iv(GLint location, GLsizei count, const GLint * value)
+{
+    PFNGLUNIFORM1IVPROC real = (PFNGLUNIFORM1IVPROC)traceReal[TRACE_glUniform1iv];
+    if (!traceActive())
+        return real(location, count, value);
+    traceBegin(TRACE_glUniform1iv, 3);
+    traceArg(location);
+    traceArg(count);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 1 * 4);
+    real(location, count, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform2iv(GLint location, GLsizei count, const GLint * value)
+{
+    PFNGLUNIFORM2IVPROC real = (PFNGLUNIFORM2IVPROC)traceReal[TRACE_glUniform2iv];
+    if (!traceActive())
+        return real(location, count, value);
+    traceBegin(TRACE_glUniform2iv, 3);
+    traceArg(location);
+    traceArg(count);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 2 * 4);
+    real(location, count, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform3iv(GLint location, GLsizei count, const GLint * value)
+{
+    PFNGLUNIFORM3IVPROC real = (PFNGLUNIFORM3IVPROC)traceReal[TRACE_glUniform3iv];
+    if (!traceActive())
+        return real(location, count, value);
+    traceBegin(TRACE_glUniform3iv, 3);
+    traceArg(location);
+    traceArg(count);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 3 * 4);
+    real(location, count, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform4iv(GLint location, GLsizei count, const GLint * value)
+{
+    PFNGLUNIFORM4IVPROC real = (PFNGLUNIFORM4IVPROC)traceReal[TRACE_glUniform4iv];
+    if (!traceActive())
+        return real(location, count, value);
+    traceBegin(TRACE_glUniform4iv, 3);
+    traceArg(location);
+    traceArg(count);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 4 * 4);
+    real(location, count, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    PFNGLUNIFORMMATRIX2FVPROC real = (PFNGLUNIFORMMATRIX2FVPROC)traceReal[TRACE_glUniformMatrix2fv];
+    if (!traceActive())
+        return real(location, count, transpose, value);
+    traceBegin(TRACE_glUniformMatrix2fv, 4);
+    traceArg(location);
+    traceArg(count);
+    traceArg(transpose);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 2 * 2 * 4);
+    real(location, count, transpose, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    PFNGLUNIFORMMATRIX3FVPROC real = (PFNGLUNIFORMMATRIX3FVPROC)traceReal[TRACE_glUniformMatrix3fv];
+    if (!traceActive())
+        return real(location, count, transpose, value);
+    traceBegin(TRACE_glUniformMatrix3fv, 4);
+    traceArg(location);
+    traceArg(count);
+    traceArg(transpose);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 3 * 3 * 4);
+    real(location, count, transpose, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    PFNGLUNIFORMMATRIX4FVPROC real = (PFNGLUNIFORMMATRIX4FVPROC)traceReal[TRACE_glUniformMatrix4fv];
+    if (!traceActive())
+        return real(location, count, transpose, value);
+    traceBegin(TRACE_glUniformMatrix4fv, 4);
+    traceArg(location);
+    traceArg(count);
+    traceArg(transpose);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 4 * 4 * 4);
+    real(location, count, transpose, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glValidateProgram(GLuint program)
+{
+    PFNGLVALIDATEPROGRAMPROC real = (PFNGLVALIDATEPROGRAMPROC)traceReal[TRACE_glValidateProgram];
+    if (!traceActive())
+        return real(program);
+    traceBegin(TRACE_glValidateProgram, 1);
+    traceArg(program);
+    real(program);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib1d(GLuint index, GLdouble x)
+{
+    PFNGLVERTEXATTRIB1DPROC real = (PFNGLVERTEXATTRIB1DPROC)traceReal[TRACE_glVertexAttrib1d];
+    if (!traceActive())
+        return real(index, x);
+    traceBegin(TRACE_glVertexAttrib1d, 2);
+    traceArg(index);
+    traceArg(x);
+    real(index, x);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib1dv(GLuint index, const GLdouble * v)
+{
+    PFNGLVERTEXATTRIB1DVPROC real = (PFNGLVERTEXATTRIB1DVPROC)traceReal[TRACE_glVertexAttrib1dv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib1dv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib1f(GLuint index, GLfloat x)
+{
+    PFNGLVERTEXATTRIB1FPROC real = (PFNGLVERTEXATTRIB1FPROC)traceReal[TRACE_glVertexAttrib1f];
+    if (!traceActive())
+        return real(index, x);
+    traceBegin(TRACE_glVertexAttrib1f, 2);
+    traceArg(index);
+    traceArg(x);
+    real(index, x);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib1fv(GLuint index, const GLfloat * v)
+{
+    PFNGLVERTEXATTRIB1FVPROC real = (PFNGLVERTEXATTRIB1FVPROC)traceReal[TRACE_glVertexAttrib1fv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib1fv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib1s(GLuint index, GLshort x)
+{
+    PFNGLVERTEXATTRIB1SPROC real = (PFNGLVERTEXATTRIB1SPROC)traceReal[TRACE_glVertexAttrib1s];
+    if (!traceActive())
+        return real(index, x);
+    traceBegin(TRACE_glVertexAttrib1s, 2);
+    traceArg(index);
+    traceArg(x);
+    real(index, x);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib1sv(GLuint index, const GLshort * v)
+{
+    PFNGLVERTEXATTRIB1SVPROC real = (PFNGLVERTEXATTRIB1SVPROC)traceReal[TRACE_glVertexAttrib1sv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib1sv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
+{
+    PFNGLVERTEXATTRIB2DPROC real = (PFNGLVERTEXATTRIB2DPROC)traceReal[TRACE_glVertexAttrib2d];
+    if (!traceActive())
+        return real(index, x, y);
+    traceBegin(TRACE_glVertexAttrib2d, 3);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    real(index, x, y);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib2dv(GLuint index, const GLdouble * v)
+{
+    PFNGLVERTEXATTRIB2DVPROC real = (PFNGLVERTEXATTRIB2DVPROC)traceReal[TRACE_glVertexAttrib2dv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib2dv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
+{
+    PFNGLVERTEXATTRIB2FPROC real = (PFNGLVERTEXATTRIB2FPROC)traceReal[TRACE_glVertexAttrib2f];
+    if (!traceActive())
+        return real(index, x, y);
+    traceBegin(TRACE_glVertexAttrib2f, 3);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    real(index, x, y);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib2fv(GLuint index, const GLfloat * v)
+{
+    PFNGLVERTEXATTRIB2FVPROC real = (PFNGLVERTEXATTRIB2FVPROC)traceReal[TRACE_glVertexAttrib2fv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib2fv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib2s(GLuint index, GLshort x, GLshort y)
+{
+    PFNGLVERTEXATTRIB2SPROC real = (PFNGLVERTEXATTRIB2SPROC)traceReal[TRACE_glVertexAttrib2s];
+    if (!traceActive())
+        return real(index, x, y);
+    traceBegin(TRACE_glVertexAttrib2s, 3);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    real(index, x, y);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib2sv(GLuint index, const GLshort * v)
+{
+    PFNGLVERTEXATTRIB2SVPROC real = (PFNGLVERTEXATTRIB2SVPROC)traceReal[TRACE_glVertexAttrib2sv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib2sv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    PFNGLVERTEXATTRIB3DPROC real = (PFNGLVERTEXATTRIB3DPROC)traceReal[TRACE_glVertexAttrib3d];
+    if (!traceActive())
+        return real(index, x, y, z);
+    traceBegin(TRACE_glVertexAttrib3d, 4);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    traceArg(z);
+    real(index, x, y, z);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib3dv(GLuint index, const GLdouble * v)
+{
+    PFNGLVERTEXATTRIB3DVPROC real = (PFNGLVERTEXATTRIB3DVPROC)traceReal[TRACE_glVertexAttrib3dv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib3dv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    PFNGLVERTEXATTRIB3FPROC real = (PFNGLVERTEXATTRIB3FPROC)traceReal[TRACE_glVertexAttrib3f];
+    if (!traceActive())
+        return real(index, x, y, z);
+    traceBegin(TRACE_glVertexAttrib3f, 4);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    traceArg(z);
+    real(index, x, y, z);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib3fv(GLuint index, const GLfloat * v)
+{
+    PFNGLVERTEXATTRIB3FVPROC real = (PFNGLVERTEXATTRIB3FVPROC)traceReal[TRACE_glVertexAttrib3fv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib3fv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    PFNGLVERTEXATTRIB3SPROC real = (PFNGLVERTEXATTRIB3SPROC)traceReal[TRACE_glVertexAttrib3s];
+    if (!traceActive())
+        return real(index, x, y, z);
+    traceBegin(TRACE_glVertexAttrib3s, 4);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    traceArg(z);
+    real(index, x, y, z);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib3sv(GLuint index, const GLshort * v)
+{
+    PFNGLVERTEXATTRIB3SVPROC real = (PFNGLVERTEXATTRIB3SVPROC)traceReal[TRACE_glVertexAttrib3sv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib3sv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4Nbv(GLuint index, const GLbyte * v)
+{
+    PFNGLVERTEXATTRIB4NBVPROC real = (PFNGLVERTEXATTRIB4NBVPROC)traceReal[TRACE_glVertexAttrib4Nbv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4Nbv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4Niv(GLuint index, const GLint * v)
+{
+    PFNGLVERTEXATTRIB4NIVPROC real = (PFNGLVERTEXATTRIB4NIVPROC)traceReal[TRACE_glVertexAttrib4Niv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4Niv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4Nsv(GLuint index, const GLshort * v)
+{
+    PFNGLVERTEXATTRIB4NSVPROC real = (PFNGLVERTEXATTRIB4NSVPROC)traceReal[TRACE_glVertexAttrib4Nsv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4Nsv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+    PFNGLVERTEXATTRIB4NUBPROC real = (PFNGLVERTEXATTRIB4NUBPROC)traceReal[TRACE_glVertexAttrib4Nub];
+    if (!traceActive())
+        return real(index, x, y, z, w);
+    traceBegin(TRACE_glVertexAttrib4Nub, 5);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    traceArg(z);
+    traceArg(w);
+    real(index, x, y, z, w);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4Nubv(GLuint index, const GLubyte * v)
+{
+    PFNGLVERTEXATTRIB4NUBVPROC real = (PFNGLVERTEXATTRIB4NUBVPROC)traceReal[TRACE_glVertexAttrib4Nubv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4Nubv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4Nuiv(GLuint index, const GLuint * v)
+{
+    PFNGLVERTEXATTRIB4NUIVPROC real = (PFNGLVERTEXATTRIB4NUIVPROC)traceReal[TRACE_glVertexAttrib4Nuiv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4Nuiv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4Nusv(GLuint index, const GLushort * v)
+{
+    PFNGLVERTEXATTRIB4NUSVPROC real = (PFNGLVERTEXATTRIB4NUSVPROC)traceReal[TRACE_glVertexAttrib4Nusv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4Nusv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4bv(GLuint index, const GLbyte * v)
+{
+    PFNGLVERTEXATTRIB4BVPROC real = (PFNGLVERTEXATTRIB4BVPROC)traceReal[TRACE_glVertexAttrib4bv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4bv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    PFNGLVERTEXATTRIB4DPROC real = (PFNGLVERTEXATTRIB4DPROC)traceReal[TRACE_glVertexAttrib4d];
+    if (!traceActive())
+        return real(index, x, y, z, w);
+    traceBegin(TRACE_glVertexAttrib4d, 5);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    traceArg(z);
+    traceArg(w);
+    real(index, x, y, z, w);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4dv(GLuint index, const GLdouble * v)
+{
+    PFNGLVERTEXATTRIB4DVPROC real = (PFNGLVERTEXATTRIB4DVPROC)traceReal[TRACE_glVertexAttrib4dv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4dv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    PFNGLVERTEXATTRIB4FPROC real = (PFNGLVERTEXATTRIB4FPROC)traceReal[TRACE_glVertexAttrib4f];
+    if (!traceActive())
+        return real(index, x, y, z, w);
+    traceBegin(TRACE_glVertexAttrib4f, 5);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    traceArg(z);
+    traceArg(w);
+    real(index, x, y, z, w);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4fv(GLuint index, const GLfloat * v)
+{
+    PFNGLVERTEXATTRIB4FVPROC real = (PFNGLVERTEXATTRIB4FVPROC)traceReal[TRACE_glVertexAttrib4fv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4fv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4iv(GLuint index, const GLint * v)
+{
+    PFNGLVERTEXATTRIB4IVPROC real = (PFNGLVERTEXATTRIB4IVPROC)traceReal[TRACE_glVertexAttrib4iv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4iv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    PFNGLVERTEXATTRIB4SPROC real = (PFNGLVERTEXATTRIB4SPROC)traceReal[TRACE_glVertexAttrib4s];
+    if (!traceActive())
+        return real(index, x, y, z, w);
+    traceBegin(TRACE_glVertexAttrib4s, 5);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    traceArg(z);
+    traceArg(w);
+    real(index, x, y, z, w);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4sv(GLuint index, const GLshort * v)
+{
+    PFNGLVERTEXATTRIB4SVPROC real = (PFNGLVERTEXATTRIB4SVPROC)traceReal[TRACE_glVertexAttrib4sv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4sv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4ubv(GLuint index, const GLubyte * v)
+{
+    PFNGLVERTEXATTRIB4UBVPROC real = (PFNGLVERTEXATTRIB4UBVPROC)traceReal[TRACE_glVertexAttrib4ubv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4ubv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4uiv(GLuint index, const GLuint * v)
+{
+    PFNGLVERTEXATTRIB4UIVPROC real = (PFNGLVERTEXATTRIB4UIVPROC)traceReal[TRACE_glVertexAttrib4uiv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4uiv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttrib4usv(GLuint index, const GLushort * v)
+{
+    PFNGLVERTEXATTRIB4USVPROC real = (PFNGLVERTEXATTRIB4USVPROC)traceReal[TRACE_glVertexAttrib4usv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttrib4usv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer)
+{
+    PFNGLVERTEXATTRIBPOINTERPROC real = (PFNGLVERTEXATTRIBPOINTERPROC)traceReal[TRACE_glVertexAttribPointer];
+    if (!traceActive())
+        return real(index, size, type, normalized, stride, pointer);
+    traceBegin(TRACE_glVertexAttribPointer, 6);
+    traceArg(index);
+    traceArg(size);
+    traceArg(type);
+    traceArg(normalized);
+    traceArg(stride);
+    traceArg(pointer);
+    real(index, size, type, normalized, stride, pointer);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    PFNGLUNIFORMMATRIX2X3FVPROC real = (PFNGLUNIFORMMATRIX2X3FVPROC)traceReal[TRACE_glUniformMatrix2x3fv];
+    if (!traceActive())
+        return real(location, count, transpose, value);
+    traceBegin(TRACE_glUniformMatrix2x3fv, 4);
+    traceArg(location);
+    traceArg(count);
+    traceArg(transpose);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 2 * 3 * 4);
+    real(location, count, transpose, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    PFNGLUNIFORMMATRIX3X2FVPROC real = (PFNGLUNIFORMMATRIX3X2FVPROC)traceReal[TRACE_glUniformMatrix3x2fv];
+    if (!traceActive())
+        return real(location, count, transpose, value);
+    traceBegin(TRACE_glUniformMatrix3x2fv, 4);
+    traceArg(location);
+    traceArg(count);
+    traceArg(transpose);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 3 * 2 * 4);
+    real(location, count, transpose, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    PFNGLUNIFORMMATRIX2X4FVPROC real = (PFNGLUNIFORMMATRIX2X4FVPROC)traceReal[TRACE_glUniformMatrix2x4fv];
+    if (!traceActive())
+        return real(location, count, transpose, value);
+    traceBegin(TRACE_glUniformMatrix2x4fv, 4);
+    traceArg(location);
+    traceArg(count);
+    traceArg(transpose);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 2 * 4 * 4);
+    real(location, count, transpose, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    PFNGLUNIFORMMATRIX4X2FVPROC real = (PFNGLUNIFORMMATRIX4X2FVPROC)traceReal[TRACE_glUniformMatrix4x2fv];
+    if (!traceActive())
+        return real(location, count, transpose, value);
+    traceBegin(TRACE_glUniformMatrix4x2fv, 4);
+    traceArg(location);
+    traceArg(count);
+    traceArg(transpose);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 4 * 2 * 4);
+    real(location, count, transpose, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    PFNGLUNIFORMMATRIX3X4FVPROC real = (PFNGLUNIFORMMATRIX3X4FVPROC)traceReal[TRACE_glUniformMatrix3x4fv];
+    if (!traceActive())
+        return real(location, count, transpose, value);
+    traceBegin(TRACE_glUniformMatrix3x4fv, 4);
+    traceArg(location);
+    traceArg(count);
+    traceArg(transpose);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 3 * 4 * 4);
+    real(location, count, transpose, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+    PFNGLUNIFORMMATRIX4X3FVPROC real = (PFNGLUNIFORMMATRIX4X3FVPROC)traceReal[TRACE_glUniformMatrix4x3fv];
+    if (!traceActive())
+        return real(location, count, transpose, value);
+    traceBegin(TRACE_glUniformMatrix4x3fv, 4);
+    traceArg(location);
+    traceArg(count);
+    traceArg(transpose);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 4 * 3 * 4);
+    real(location, count, transpose, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+    PFNGLCOLORMASKIPROC real = (PFNGLCOLORMASKIPROC)traceReal[TRACE_glColorMaski];
+    if (!traceActive())
+        return real(index, r, g, b, a);
+    traceBegin(TRACE_glColorMaski, 5);
+    traceArg(index);
+    traceArg(r);
+    traceArg(g);
+    traceArg(b);
+    traceArg(a);
+    real(index, r, g, b, a);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetBooleani_v(GLenum target, GLuint index, GLboolean * data)
+{
+    PFNGLGETBOOLEANI_VPROC real = (PFNGLGETBOOLEANI_VPROC)traceReal[TRACE_glGetBooleani_v];
+    if (!traceActive())
+        return real(target, index, data);
+    traceBegin(TRACE_glGetBooleani_v, 3);
+    traceArg(target);
+    traceArg(index);
+    traceArg(data);
+    real(target, index, data);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetIntegeri_v(GLenum target, GLuint index, GLint * data)
+{
+    PFNGLGETINTEGERI_VPROC real = (PFNGLGETINTEGERI_VPROC)traceReal[TRACE_glGetIntegeri_v];
+    if (!traceActive())
+        return real(target, index, data);
+    traceBegin(TRACE_glGetIntegeri_v, 3);
+    traceArg(target);
+    traceArg(index);
+    traceArg(data);
+    real(target, index, data);
+    traceEnd();
+}
+
+static void APIENTRY trace_glEnablei(GLenum target, GLuint index)
+{
+    PFNGLENABLEIPROC real = (PFNGLENABLEIPROC)traceReal[TRACE_glEnablei];
+    if (!traceActive())
+        return real(target, index);
+    traceBegin(TRACE_glEnablei, 2);
+    traceArg(target);
+    traceArg(index);
+    real(target, index);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDisablei(GLenum target, GLuint index)
+{
+    PFNGLDISABLEIPROC real = (PFNGLDISABLEIPROC)traceReal[TRACE_glDisablei];
+    if (!traceActive())
+        return real(target, index);
+    traceBegin(TRACE_glDisablei, 2);
+    traceArg(target);
+    traceArg(index);
+    real(target, index);
+    traceEnd();
+}
+
+static GLboolean APIENTRY trace_glIsEnabledi(GLenum target, GLuint index)
+{
+    PFNGLISENABLEDIPROC real = (PFNGLISENABLEDIPROC)traceReal[TRACE_glIsEnabledi];
+    if (!traceActive())
+        return real(target, index);
+    traceBegin(TRACE_glIsEnabledi, 2);
+    traceArg(target);
+    traceArg(index);
+    GLboolean result = real(target, index);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glBeginTransformFeedback(GLenum primitiveMode)
+{
+    PFNGLBEGINTRANSFORMFEEDBACKPROC real = (PFNGLBEGINTRANSFORMFEEDBACKPROC)traceReal[TRACE_glBeginTransformFeedback];
+    if (!traceActive())
+        return real(primitiveMode);
+    traceBegin(TRACE_glBeginTransformFeedback, 1);
+    traceArg(primitiveMode);
+    real(primitiveMode);
+    traceEnd();
+}
+
+static void APIENTRY trace_glEndTransformFeedback(void)
+{
+    PFNGLENDTRANSFORMFEEDBACKPROC real = (PFNGLENDTRANSFORMFEEDBACKPROC)traceReal[TRACE_glEndTransformFeedback];
+    if (!traceActive())
+        return real();
+    traceBegin(TRACE_glEndTransformFeedback, 0);
+    real();
+    traceEnd();
+}
+
+static void APIENTRY trace_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    PFNGLBINDBUFFERRANGEPROC real = (PFNGLBINDBUFFERRANGEPROC)traceReal[TRACE_glBindBufferRange];
+    if (!traceActive())
+        return real(target, index, buffer, offset, size);
+    traceBegin(TRACE_glBindBufferRange, 5);
+    traceArg(target);
+    traceArg(index);
+    traceArg(buffer);
+    traceArg(offset);
+    traceArg(size);
+    real(target, index, buffer, offset, size);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    PFNGLBINDBUFFERBASEPROC real = (PFNGLBINDBUFFERBASEPROC)traceReal[TRACE_glBindBufferBase];
+    if (!traceActive())
+        return real(target, index, buffer);
+    traceBegin(TRACE_glBindBufferBase, 3);
+    traceArg(target);
+    traceArg(index);
+    traceArg(buffer);
+    real(target, index, buffer);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const* varyings, GLenum bufferMode)
+{
+    PFNGLTRANSFORMFEEDBACKVARYINGSPROC real = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)traceReal[TRACE_glTransformFeedbackVaryings];
+    if (!traceActive())
+        return real(program, count, varyings, bufferMode);
+    traceBegin(TRACE_glTransformFeedbackVaryings, 4);
+    traceArg(program);
+    traceArg(count);
+    traceArg(varyings);
+    traceArg(bufferMode);
+    real(program, count, varyings, bufferMode);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name)
+{
+    PFNGLGETTRANSFORMFEEDBACKVARYINGPROC real = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)traceReal[TRACE_glGetTransformFeedbackVarying];
+    if (!traceActive())
+        return real(program, index, bufSize, length, size, type, name);
+    traceBegin(TRACE_glGetTransformFeedbackVarying, 7);
+    traceArg(program);
+    traceArg(index);
+    traceArg(bufSize);
+    traceArg(length);
+    traceArg(size);
+    traceArg(type);
+    traceArg(name);
+    real(program, index, bufSize, length, size, type, name);
+    traceEnd();
+}
+
+static void APIENTRY trace_glClampColor(GLenum target, GLenum clamp)
+{
+    PFNGLCLAMPCOLORPROC real = (PFNGLCLAMPCOLORPROC)traceReal[TRACE_glClampColor];
+    if (!traceActive())
+        return real(target, clamp);
+    traceBegin(TRACE_glClampColor, 2);
+    traceArg(target);
+    traceArg(clamp);
+    real(target, clamp);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBeginConditionalRender(GLuint id, GLenum mode)
+{
+    PFNGLBEGINCONDITIONALRENDERPROC real = (PFNGLBEGINCONDITIONALRENDERPROC)traceReal[TRACE_glBeginConditionalRender];
+    if (!traceActive())
+        return real(id, mode);
+    traceBegin(TRACE_glBeginConditionalRender, 2);
+    traceArg(id);
+    traceArg(mode);
+    real(id, mode);
+    traceEnd();
+}
+
+static void APIENTRY trace_glEndConditionalRender(void)
+{
+    PFNGLENDCONDITIONALRENDERPROC real = (PFNGLENDCONDITIONALRENDERPROC)traceReal[TRACE_glEndConditionalRender];
+    if (!traceActive())
+        return real();
+    traceBegin(TRACE_glEndConditionalRender, 0);
+    real();
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer)
+{
+    PFNGLVERTEXATTRIBIPOINTERPROC real = (PFNGLVERTEXATTRIBIPOINTERPROC)traceReal[TRACE_glVertexAttribIPointer];
+    if (!traceActive())
+        return real(index, size, type, stride, pointer);
+    traceBegin(TRACE_glVertexAttribIPointer, 5);
+    traceArg(index);
+    traceArg(size);
+    traceArg(type);
+    traceArg(stride);
+    traceArg(pointer);
+    real(index, size, type, stride, pointer);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint * params)
+{
+    PFNGLGETVERTEXATTRIBIIVPROC real = (PFNGLGETVERTEXATTRIBIIVPROC)traceReal[TRACE_glGetVertexAttribIiv];
+    if (!traceActive())
+        return real(index, pname, params);
+    traceBegin(TRACE_glGetVertexAttribIiv, 3);
+    traceArg(index);
+    traceArg(pname);
+    traceArg(params);
+    real(index, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint * params)
+{
+    PFNGLGETVERTEXATTRIBIUIVPROC real = (PFNGLGETVERTEXATTRIBIUIVPROC)traceReal[TRACE_glGetVertexAttribIuiv];
+    if (!traceActive())
+        return real(index, pname, params);
+    traceBegin(TRACE_glGetVertexAttribIuiv, 3);
+    traceArg(index);
+    traceArg(pname);
+    traceArg(params);
+    real(index, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI1i(GLuint index, GLint x)
+{
+    PFNGLVERTEXATTRIBI1IPROC real = (PFNGLVERTEXATTRIBI1IPROC)traceReal[TRACE_glVertexAttribI1i];
+    if (!traceActive())
+        return real(index, x);
+    traceBegin(TRACE_glVertexAttribI1i, 2);
+    traceArg(index);
+    traceArg(x);
+    real(index, x);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI2i(GLuint index, GLint x, GLint y)
+{
+    PFNGLVERTEXATTRIBI2IPROC real = (PFNGLVERTEXATTRIBI2IPROC)traceReal[TRACE_glVertexAttribI2i];
+    if (!traceActive())
+        return real(index, x, y);
+    traceBegin(TRACE_glVertexAttribI2i, 3);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    real(index, x, y);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
+{
+    PFNGLVERTEXATTRIBI3IPROC real = (PFNGLVERTEXATTRIBI3IPROC)traceReal[TRACE_glVertexAttribI3i];
+    if (!traceActive())
+        return real(index, x, y, z);
+    traceBegin(TRACE_glVertexAttribI3i, 4);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    traceArg(z);
+    real(index, x, y, z);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    PFNGLVERTEXATTRIBI4IPROC real = (PFNGLVERTEXATTRIBI4IPROC)traceReal[TRACE_glVertexAttribI4i];
+    if (!traceActive())
+        return real(index, x, y, z, w);
+    traceBegin(TRACE_glVertexAttribI4i, 5);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    traceArg(z);
+    traceArg(w);
+    real(index, x, y, z, w);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI1ui(GLuint index, GLuint x)
+{
+    PFNGLVERTEXATTRIBI1UIPROC real = (PFNGLVERTEXATTRIBI1UIPROC)traceReal[TRACE_glVertexAttribI1ui];
+    if (!traceActive())
+        return real(index, x);
+    traceBegin(TRACE_glVertexAttribI1ui, 2);
+    traceArg(index);
+    traceArg(x);
+    real(index, x);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y)
+{
+    PFNGLVERTEXATTRIBI2UIPROC real = (PFNGLVERTEXATTRIBI2UIPROC)traceReal[TRACE_glVertexAttribI2ui];
+    if (!traceActive())
+        return real(index, x, y);
+    traceBegin(TRACE_glVertexAttribI2ui, 3);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    real(index, x, y);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
+{
+    PFNGLVERTEXATTRIBI3UIPROC real = (PFNGLVERTEXATTRIBI3UIPROC)traceReal[TRACE_glVertexAttribI3ui];
+    if (!traceActive())
+        return real(index, x, y, z);
+    traceBegin(TRACE_glVertexAttribI3ui, 4);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    traceArg(z);
+    real(index, x, y, z);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    PFNGLVERTEXATTRIBI4UIPROC real = (PFNGLVERTEXATTRIBI4UIPROC)traceReal[TRACE_glVertexAttribI4ui];
+    if (!traceActive())
+        return real(index, x, y, z, w);
+    traceBegin(TRACE_glVertexAttribI4ui, 5);
+    traceArg(index);
+    traceArg(x);
+    traceArg(y);
+    traceArg(z);
+    traceArg(w);
+    real(index, x, y, z, w);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI1iv(GLuint index, const GLint * v)
+{
+    PFNGLVERTEXATTRIBI1IVPROC real = (PFNGLVERTEXATTRIBI1IVPROC)traceReal[TRACE_glVertexAttribI1iv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttribI1iv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI2iv(GLuint index, const GLint * v)
+{
+    PFNGLVERTEXATTRIBI2IVPROC real = (PFNGLVERTEXATTRIBI2IVPROC)traceReal[TRACE_glVertexAttribI2iv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttribI2iv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI3iv(GLuint index, const GLint * v)
+{
+    PFNGLVERTEXATTRIBI3IVPROC real = (PFNGLVERTEXATTRIBI3IVPROC)traceReal[TRACE_glVertexAttribI3iv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttribI3iv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI4iv(GLuint index, const GLint * v)
+{
+    PFNGLVERTEXATTRIBI4IVPROC real = (PFNGLVERTEXATTRIBI4IVPROC)traceReal[TRACE_glVertexAttribI4iv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttribI4iv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI1uiv(GLuint index, const GLuint * v)
+{
+    PFNGLVERTEXATTRIBI1UIVPROC real = (PFNGLVERTEXATTRIBI1UIVPROC)traceReal[TRACE_glVertexAttribI1uiv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttribI1uiv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI2uiv(GLuint index, const GLuint * v)
+{
+    PFNGLVERTEXATTRIBI2UIVPROC real = (PFNGLVERTEXATTRIBI2UIVPROC)traceReal[TRACE_glVertexAttribI2uiv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttribI2uiv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI3uiv(GLuint index, const GLuint * v)
+{
+    PFNGLVERTEXATTRIBI3UIVPROC real = (PFNGLVERTEXATTRIBI3UIVPROC)traceReal[TRACE_glVertexAttribI3uiv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttribI3uiv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI4uiv(GLuint index, const GLuint * v)
+{
+    PFNGLVERTEXATTRIBI4UIVPROC real = (PFNGLVERTEXATTRIBI4UIVPROC)traceReal[TRACE_glVertexAttribI4uiv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttribI4uiv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI4bv(GLuint index, const GLbyte * v)
+{
+    PFNGLVERTEXATTRIBI4BVPROC real = (PFNGLVERTEXATTRIBI4BVPROC)traceReal[TRACE_glVertexAttribI4bv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttribI4bv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI4sv(GLuint index, const GLshort * v)
+{
+    PFNGLVERTEXATTRIBI4SVPROC real = (PFNGLVERTEXATTRIBI4SVPROC)traceReal[TRACE_glVertexAttribI4sv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttribI4sv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI4ubv(GLuint index, const GLubyte * v)
+{
+    PFNGLVERTEXATTRIBI4UBVPROC real = (PFNGLVERTEXATTRIBI4UBVPROC)traceReal[TRACE_glVertexAttribI4ubv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttribI4ubv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribI4usv(GLuint index, const GLushort * v)
+{
+    PFNGLVERTEXATTRIBI4USVPROC real = (PFNGLVERTEXATTRIBI4USVPROC)traceReal[TRACE_glVertexAttribI4usv];
+    if (!traceActive())
+        return real(index, v);
+    traceBegin(TRACE_glVertexAttribI4usv, 2);
+    traceArg(index);
+    traceArg(v);
+    real(index, v);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetUniformuiv(GLuint program, GLint location, GLuint * params)
+{
+    PFNGLGETUNIFORMUIVPROC real = (PFNGLGETUNIFORMUIVPROC)traceReal[TRACE_glGetUniformuiv];
+    if (!traceActive())
+        return real(program, location, params);
+    traceBegin(TRACE_glGetUniformuiv, 3);
+    traceArg(program);
+    traceArg(location);
+    traceArg(params);
+    real(program, location, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBindFragDataLocation(GLuint program, GLuint color, const GLchar * name)
+{
+    PFNGLBINDFRAGDATALOCATIONPROC real = (PFNGLBINDFRAGDATALOCATIONPROC)traceReal[TRACE_glBindFragDataLocation];
+    if (!traceActive())
+        return real(program, color, name);
+    traceBegin(TRACE_glBindFragDataLocation, 3);
+    traceArg(program);
+    traceArg(color);
+    traceArg(name);
+    tracePayload(name, strlen(name) + 1);
+    real(program, color, name);
+    traceEnd();
+}
+
+static GLint APIENTRY trace_glGetFragDataLocation(GLuint program, const GLchar * name)
+{
+    PFNGLGETFRAGDATALOCATIONPROC real = (PFNGLGETFRAGDATALOCATIONPROC)traceReal[TRACE_glGetFragDataLocation];
+    if (!traceActive())
+        return real(program, name);
+    traceBegin(TRACE_glGetFragDataLocation, 2);
+    traceArg(program);
+    traceArg(name);
+    GLint result = real(program, name);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glUniform1ui(GLint location, GLuint v0)
+{
+    PFNGLUNIFORM1UIPROC real = (PFNGLUNIFORM1UIPROC)traceReal[TRACE_glUniform1ui];
+    if (!traceActive())
+        return real(location, v0);
+    traceBegin(TRACE_glUniform1ui, 2);
+    traceArg(location);
+    traceArg(v0);
+    real(location, v0);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform2ui(GLint location, GLuint v0, GLuint v1)
+{
+    PFNGLUNIFORM2UIPROC real = (PFNGLUNIFORM2UIPROC)traceReal[TRACE_glUniform2ui];
+    if (!traceActive())
+        return real(location, v0, v1);
+    traceBegin(TRACE_glUniform2ui, 3);
+    traceArg(location);
+    traceArg(v0);
+    traceArg(v1);
+    real(location, v0, v1);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    PFNGLUNIFORM3UIPROC real = (PFNGLUNIFORM3UIPROC)traceReal[TRACE_glUniform3ui];
+    if (!traceActive())
+        return real(location, v0, v1, v2);
+    traceBegin(TRACE_glUniform3ui, 4);
+    traceArg(location);
+    traceArg(v0);
+    traceArg(v1);
+    traceArg(v2);
+    real(location, v0, v1, v2);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    PFNGLUNIFORM4UIPROC real = (PFNGLUNIFORM4UIPROC)traceReal[TRACE_glUniform4ui];
+    if (!traceActive())
+        return real(location, v0, v1, v2, v3);
+    traceBegin(TRACE_glUniform4ui, 5);
+    traceArg(location);
+    traceArg(v0);
+    traceArg(v1);
+    traceArg(v2);
+    traceArg(v3);
+    real(location, v0, v1, v2, v3);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform1uiv(GLint location, GLsizei count, const GLuint * value)
+{
+    PFNGLUNIFORM1UIVPROC real = (PFNGLUNIFORM1UIVPROC)traceReal[TRACE_glUniform1uiv];
+    if (!traceActive())
+        return real(location, count, value);
+    traceBegin(TRACE_glUniform1uiv, 3);
+    traceArg(location);
+    traceArg(count);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 1 * 4);
+    real(location, count, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform2uiv(GLint location, GLsizei count, const GLuint * value)
+{
+    PFNGLUNIFORM2UIVPROC real = (PFNGLUNIFORM2UIVPROC)traceReal[TRACE_glUniform2uiv];
+    if (!traceActive())
+        return real(location, count, value);
+    traceBegin(TRACE_glUniform2uiv, 3);
+    traceArg(location);
+    traceArg(count);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 2 * 4);
+    real(location, count, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform3uiv(GLint location, GLsizei count, const GLuint * value)
+{
+    PFNGLUNIFORM3UIVPROC real = (PFNGLUNIFORM3UIVPROC)traceReal[TRACE_glUniform3uiv];
+    if (!traceActive())
+        return real(location, count, value);
+    traceBegin(TRACE_glUniform3uiv, 3);
+    traceArg(location);
+    traceArg(count);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 3 * 4);
+    real(location, count, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniform4uiv(GLint location, GLsizei count, const GLuint * value)
+{
+    PFNGLUNIFORM4UIVPROC real = (PFNGLUNIFORM4UIVPROC)traceReal[TRACE_glUniform4uiv];
+    if (!traceActive())
+        return real(location, count, value);
+    traceBegin(TRACE_glUniform4uiv, 3);
+    traceArg(location);
+    traceArg(count);
+    traceArg(value);
+    tracePayload(value, (size_t)count * 4 * 4);
+    real(location, count, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexParameterIiv(GLenum target, GLenum pname, const GLint * params)
+{
+    PFNGLTEXPARAMETERIIVPROC real = (PFNGLTEXPARAMETERIIVPROC)traceReal[TRACE_glTexParameterIiv];
+    if (!traceActive())
+        return real(target, pname, params);
+    traceBegin(TRACE_glTexParameterIiv, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(params);
+    real(target, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint * params)
+{
+    PFNGLTEXPARAMETERIUIVPROC real = (PFNGLTEXPARAMETERIUIVPROC)traceReal[TRACE_glTexParameterIuiv];
+    if (!traceActive())
+        return real(target, pname, params);
+    traceBegin(TRACE_glTexParameterIuiv, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(params);
+    real(target, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetTexParameterIiv(GLenum target, GLenum pname, GLint * params)
+{
+    PFNGLGETTEXPARAMETERIIVPROC real = (PFNGLGETTEXPARAMETERIIVPROC)traceReal[TRACE_glGetTexParameterIiv];
+    if (!traceActive())
+        return real(target, pname, params);
+    traceBegin(TRACE_glGetTexParameterIiv, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(params);
+    real(target, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint * params)
+{
+    PFNGLGETTEXPARAMETERIUIVPROC real = (PFNGLGETTEXPARAMETERIUIVPROC)traceReal[TRACE_glGetTexParameterIuiv];
+    if (!traceActive())
+        return real(target, pname, params);
+    traceBegin(TRACE_glGetTexParameterIuiv, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(params);
+    real(target, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint * value)
+{
+    PFNGLCLEARBUFFERIVPROC real = (PFNGLCLEARBUFFERIVPROC)traceReal[TRACE_glClearBufferiv];
+    if (!traceActive())
+        return real(buffer, drawbuffer, value);
+    traceBegin(TRACE_glClearBufferiv, 3);
+    traceArg(buffer);
+    traceArg(drawbuffer);
+    traceArg(value);
+    tracePayload(value, 4 * sizeof(GLint));
+    real(buffer, drawbuffer, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint * value)
+{
+    PFNGLCLEARBUFFERUIVPROC real = (PFNGLCLEARBUFFERUIVPROC)traceReal[TRACE_glClearBufferuiv];
+    if (!traceActive())
+        return real(buffer, drawbuffer, value);
+    traceBegin(TRACE_glClearBufferuiv, 3);
+    traceArg(buffer);
+    traceArg(drawbuffer);
+    traceArg(value);
+    tracePayload(value, 4 * sizeof(GLuint));
+    real(buffer, drawbuffer, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat * value)
+{
+    PFNGLCLEARBUFFERFVPROC real = (PFNGLCLEARBUFFERFVPROC)traceReal[TRACE_glClearBufferfv];
+    if (!traceActive())
+        return real(buffer, drawbuffer, value);
+    traceBegin(TRACE_glClearBufferfv, 3);
+    traceArg(buffer);
+    traceArg(drawbuffer);
+    traceArg(value);
+    tracePayload(value, 4 * sizeof(GLfloat));
+    real(buffer, drawbuffer, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    PFNGLCLEARBUFFERFIPROC real = (PFNGLCLEARBUFFERFIPROC)traceReal[TRACE_glClearBufferfi];
+    if (!traceActive())
+        return real(buffer, drawbuffer, depth, stencil);
+    traceBegin(TRACE_glClearBufferfi, 4);
+    traceArg(buffer);
+    traceArg(drawbuffer);
+    traceArg(depth);
+    traceArg(stencil);
+    real(buffer, drawbuffer, depth, stencil);
+    traceEnd();
+}
+
+static const GLubyte * APIENTRY trace_glGetStringi(GLenum name, GLuint index)
+{
+    PFNGLGETSTRINGIPROC real = (PFNGLGETSTRINGIPROC)traceReal[TRACE_glGetStringi];
+    if (!traceActive())
+        return real(name, index);
+    traceBegin(TRACE_glGetStringi, 2);
+    traceArg(name);
+    traceArg(index);
+    const GLubyte * result = real(name, index);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static GLboolean APIENTRY trace_glIsRenderbuffer(GLuint renderbuffer)
+{
+    PFNGLISRENDERBUFFERPROC real = (PFNGLISRENDERBUFFERPROC)traceReal[TRACE_glIsRenderbuffer];
+    if (!traceActive())
+        return real(renderbuffer);
+    traceBegin(TRACE_glIsRenderbuffer, 1);
+    traceArg(renderbuffer);
+    GLboolean result = real(renderbuffer);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+    PFNGLBINDRENDERBUFFERPROC real = (PFNGLBINDRENDERBUFFERPROC)traceReal[TRACE_glBindRenderbuffer];
+    if (!traceActive())
+        return real(target, renderbuffer);
+    traceBegin(TRACE_glBindRenderbuffer, 2);
+    traceArg(target);
+    traceArg(renderbuffer);
+    real(target, renderbuffer);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDeleteRenderbuffers(GLsizei n, const GLuint * renderbuffers)
+{
+    PFNGLDELETERENDERBUFFERSPROC real = (PFNGLDELETERENDERBUFFERSPROC)traceReal[TRACE_glDeleteRenderbuffers];
+    if (!traceActive())
+        return real(n, renderbuffers);
+    traceBegin(TRACE_glDeleteRenderbuffers, 2);
+    traceArg(n);
+    traceArg(renderbuffers);
+    tracePayload(renderbuffers, (size_t)n * sizeof(GLuint));
+    real(n, renderbuffers);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGenRenderbuffers(GLsizei n, GLuint * renderbuffers)
+{
+    PFNGLGENRENDERBUFFERSPROC real = (PFNGLGENRENDERBUFFERSPROC)traceReal[TRACE_glGenRenderbuffers];
+    if (!traceActive())
+        return real(n, renderbuffers);
+    traceBegin(TRACE_glGenRenderbuffers, 2);
+    traceArg(n);
+    traceArg(renderbuffers);
+    real(n, renderbuffers);
+    tracePayload(renderbuffers, (size_t)n * sizeof(GLuint));
+    traceEnd();
+}
+
+static void APIENTRY trace_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    PFNGLRENDERBUFFERSTORAGEPROC real = (PFNGLRENDERBUFFERSTORAGEPROC)traceReal[TRACE_glRenderbufferStorage];
+    if (!traceActive())
+        return real(target, internalformat, width, height);
+    traceBegin(TRACE_glRenderbufferStorage, 4);
+    traceArg(target);
+    traceArg(internalformat);
+    traceArg(width);
+    traceArg(height);
+    real(target, internalformat, width, height);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+    PFNGLGETRENDERBUFFERPARAMETERIVPROC real = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)traceReal[TRACE_glGetRenderbufferParameteriv];
+    if (!traceActive())
+        return real(target, pname, params);
+    traceBegin(TRACE_glGetRenderbufferParameteriv, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(params);
+    real(target, pname, params);
+    traceEnd();
+}
+
+static GLboolean APIENTRY trace_glIsFramebuffer(GLuint framebuffer)
+{
+    PFNGLISFRAMEBUFFERPROC real = (PFNGLISFRAMEBUFFERPROC)traceReal[TRACE_glIsFramebuffer];
+    if (!traceActive())
+        return real(framebuffer);
+    traceBegin(TRACE_glIsFramebuffer, 1);
+    traceArg(framebuffer);
+    GLboolean result = real(framebuffer);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    PFNGLBINDFRAMEBUFFERPROC real = (PFNGLBINDFRAMEBUFFERPROC)traceReal[TRACE_glBindFramebuffer];
+    if (!traceActive())
+        return real(target, framebuffer);
+    traceBegin(TRACE_glBindFramebuffer, 2);
+    traceArg(target);
+    traceArg(framebuffer);
+    real(target, framebuffer);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDeleteFramebuffers(GLsizei n, const GLuint * framebuffers)
+{
+    PFNGLDELETEFRAMEBUFFERSPROC real = (PFNGLDELETEFRAMEBUFFERSPROC)traceReal[TRACE_glDeleteFramebuffers];
+    if (!traceActive())
+        return real(n, framebuffers);
+    traceBegin(TRACE_glDeleteFramebuffers, 2);
+    traceArg(n);
+    traceArg(framebuffers);
+    tracePayload(framebuffers, (size_t)n * sizeof(GLuint));
+    real(n, framebuffers);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGenFramebuffers(GLsizei n, GLuint * framebuffers)
+{
+    PFNGLGENFRAMEBUFFERSPROC real = (PFNGLGENFRAMEBUFFERSPROC)traceReal[TRACE_glGenFramebuffers];
+    if (!traceActive())
+        return real(n, framebuffers);
+    traceBegin(TRACE_glGenFramebuffers, 2);
+    traceArg(n);
+    traceArg(framebuffers);
+    real(n, framebuffers);
+    tracePayload(framebuffers, (size_t)n * sizeof(GLuint));
+    traceEnd();
+}
+
+static GLenum APIENTRY trace_glCheckFramebufferStatus(GLenum target)
+{
+    PFNGLCHECKFRAMEBUFFERSTATUSPROC real = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)traceReal[TRACE_glCheckFramebufferStatus];
+    if (!traceActive())
+        return real(target);
+    traceBegin(TRACE_glCheckFramebufferStatus, 1);
+    traceArg(target);
+    GLenum result = real(target);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    PFNGLFRAMEBUFFERTEXTURE1DPROC real = (PFNGLFRAMEBUFFERTEXTURE1DPROC)traceReal[TRACE_glFramebufferTexture1D];
+    if (!traceActive())
+        return real(target, attachment, textarget, texture, level);
+    traceBegin(TRACE_glFramebufferTexture1D, 5);
+    traceArg(target);
+    traceArg(attachment);
+    traceArg(textarget);
+    traceArg(texture);
+    traceArg(level);
+    real(target, attachment, textarget, texture, level);
+    traceEnd();
+}
+
+static void APIENTRY trace_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    PFNGLFRAMEBUFFERTEXTURE2DPROC real = (PFNGLFRAMEBUFFERTEXTURE2DPROC)traceReal[TRACE_glFramebufferTexture2D];
+    if (!traceActive())
+        return real(target, attachment, textarget, texture, level);
+    traceBegin(TRACE_glFramebufferTexture2D, 5);
+    traceArg(target);
+    traceArg(attachment);
+    traceArg(textarget);
+    traceArg(texture);
+    traceArg(level);
+    real(target, attachment, textarget, texture, level);
+    traceEnd();
+}
+
+static void APIENTRY trace_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+    PFNGLFRAMEBUFFERTEXTURE3DPROC real = (PFNGLFRAMEBUFFERTEXTURE3DPROC)traceReal[TRACE_glFramebufferTexture3D];
+    if (!traceActive())
+        return real(target, attachment, textarget, texture, level, zoffset);
+    traceBegin(TRACE_glFramebufferTexture3D, 6);
+    traceArg(target);
+    traceArg(attachment);
+    traceArg(textarget);
+    traceArg(texture);
+    traceArg(level);
+    traceArg(zoffset);
+    real(target, attachment, textarget, texture, level, zoffset);
+    traceEnd();
+}
+
+static void APIENTRY trace_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    PFNGLFRAMEBUFFERRENDERBUFFERPROC real = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)traceReal[TRACE_glFramebufferRenderbuffer];
+    if (!traceActive())
+        return real(target, attachment, renderbuffertarget, renderbuffer);
+    traceBegin(TRACE_glFramebufferRenderbuffer, 4);
+    traceArg(target);
+    traceArg(attachment);
+    traceArg(renderbuffertarget);
+    traceArg(renderbuffer);
+    real(target, attachment, renderbuffertarget, renderbuffer);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint * params)
+{
+    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC real = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)traceReal[TRACE_glGetFramebufferAttachmentParameteriv];
+    if (!traceActive())
+        return real(target, attachment, pname, params);
+    traceBegin(TRACE_glGetFramebufferAttachmentParameteriv, 4);
+    traceArg(target);
+    traceArg(attachment);
+    traceArg(pname);
+    traceArg(params);
+    real(target, attachment, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGenerateMipmap(GLenum target)
+{
+    PFNGLGENERATEMIPMAPPROC real = (PFNGLGENERATEMIPMAPPROC)traceReal[TRACE_glGenerateMipmap];
+    if (!traceActive())
+        return real(target);
+    traceBegin(TRACE_glGenerateMipmap, 1);
+    traceArg(target);
+    real(target);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    PFNGLBLITFRAMEBUFFERPROC real = (PFNGLBLITFRAMEBUFFERPROC)traceReal[TRACE_glBlitFramebuffer];
+    if (!traceActive())
+        return real(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    traceBegin(TRACE_glBlitFramebuffer, 10);
+    traceArg(srcX0);
+    traceArg(srcY0);
+    traceArg(srcX1);
+    traceArg(srcY1);
+    traceArg(dstX0);
+    traceArg(dstY0);
+    traceArg(dstX1);
+    traceArg(dstY1);
+    traceArg(mask);
+    traceArg(filter);
+    real(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    traceEnd();
+}
+
+static void APIENTRY trace_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC real = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)traceReal[TRACE_glRenderbufferStorageMultisample];
+    if (!traceActive())
+        return real(target, samples, internalformat, width, height);
+    traceBegin(TRACE_glRenderbufferStorageMultisample, 5);
+    traceArg(target);
+    traceArg(samples);
+    traceArg(internalformat);
+    traceArg(width);
+    traceArg(height);
+    real(target, samples, internalformat, width, height);
+    traceEnd();
+}
+
+static void APIENTRY trace_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    PFNGLFRAMEBUFFERTEXTURELAYERPROC real = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)traceReal[TRACE_glFramebufferTextureLayer];
+    if (!traceActive())
+        return real(target, attachment, texture, level, layer);
+    traceBegin(TRACE_glFramebufferTextureLayer, 5);
+    traceArg(target);
+    traceArg(attachment);
+    traceArg(texture);
+    traceArg(level);
+    traceArg(layer);
+    real(target, attachment, texture, level, layer);
+    traceEnd();
+}
+
+static void * APIENTRY trace_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    PFNGLMAPBUFFERRANGEPROC real = (PFNGLMAPBUFFERRANGEPROC)traceReal[TRACE_glMapBufferRange];
+    if (!traceActive())
+        return real(target, offset, length, access);
+    traceBegin(TRACE_glMapBufferRange, 4);
+    traceArg(target);
+    traceArg(offset);
+    traceArg(length);
+    traceArg(access);
+    void * result = real(target, offset, length, access);
+    traceAfter_glMapBufferRange(target, offset, length, access, result);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    PFNGLFLUSHMAPPEDBUFFERRANGEPROC real = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)traceReal[TRACE_glFlushMappedBufferRange];
+    if (!traceActive())
+        return real(target, offset, length);
+    traceBegin(TRACE_glFlushMappedBufferRange, 3);
+    traceArg(target);
+    traceArg(offset);
+    traceArg(length);
+    real(target, offset, length);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBindVertexArray(GLuint array)
+{
+    PFNGLBINDVERTEXARRAYPROC real = (PFNGLBINDVERTEXARRAYPROC)traceReal[TRACE_glBindVertexArray];
+    if (!traceActive())
+        return real(array);
+    traceBegin(TRACE_glBindVertexArray, 1);
+    traceArg(array);
+    real(array);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDeleteVertexArrays(GLsizei n, const GLuint * arrays)
+{
+    PFNGLDELETEVERTEXARRAYSPROC real = (PFNGLDELETEVERTEXARRAYSPROC)traceReal[TRACE_glDeleteVertexArrays];
+    if (!traceActive())
+        return real(n, arrays);
+    traceBegin(TRACE_glDeleteVertexArrays, 2);
+    traceArg(n);
+    traceArg(arrays);
+    tracePayload(arrays, (size_t)n * sizeof(GLuint));
+    real(n, arrays);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGenVertexArrays(GLsizei n, GLuint * arrays)
+{
+    PFNGLGENVERTEXARRAYSPROC real = (PFNGLGENVERTEXARRAYSPROC)traceReal[TRACE_glGenVertexArrays];
+    if (!traceActive())
+        return real(n, arrays);
+    traceBegin(TRACE_glGenVertexArrays, 2);
+    traceArg(n);
+    traceArg(arrays);
+    real(n, arrays);
+    tracePayload(arrays, (size_t)n * sizeof(GLuint));
+    traceEnd();
+}
+
+static GLboolean APIENTRY trace_glIsVertexArray(GLuint array)
+{
+    PFNGLISVERTEXARRAYPROC real = (PFNGLISVERTEXARRAYPROC)traceReal[TRACE_glIsVertexArray];
+    if (!traceActive())
+        return real(array);
+    traceBegin(TRACE_glIsVertexArray, 1);
+    traceArg(array);
+    GLboolean result = real(array);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    PFNGLDRAWARRAYSINSTANCEDPROC real = (PFNGLDRAWARRAYSINSTANCEDPROC)traceReal[TRACE_glDrawArraysInstanced];
+    if (!traceActive())
+        return real(mode, first, count, instancecount);
+    traceBegin(TRACE_glDrawArraysInstanced, 4);
+    traceArg(mode);
+    traceArg(first);
+    traceArg(count);
+    traceArg(instancecount);
+    real(mode, first, count, instancecount);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount)
+{
+    PFNGLDRAWELEMENTSINSTANCEDPROC real = (PFNGLDRAWELEMENTSINSTANCEDPROC)traceReal[TRACE_glDrawElementsInstanced];
+    if (!traceActive())
+        return real(mode, count, type, indices, instancecount);
+    traceBegin(TRACE_glDrawElementsInstanced, 5);
+    traceArg(mode);
+    traceArg(count);
+    traceArg(type);
+    traceArg(indices);
+    traceArg(instancecount);
+    real(mode, count, type, indices, instancecount);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
+{
+    PFNGLTEXBUFFERPROC real = (PFNGLTEXBUFFERPROC)traceReal[TRACE_glTexBuffer];
+    if (!traceActive())
+        return real(target, internalformat, buffer);
+    traceBegin(TRACE_glTexBuffer, 3);
+    traceArg(target);
+    traceArg(internalformat);
+    traceArg(buffer);
+    real(target, internalformat, buffer);
+    traceEnd();
+}
+
+static void APIENTRY trace_glPrimitiveRestartIndex(GLuint index)
+{
+    PFNGLPRIMITIVERESTARTINDEXPROC real = (PFNGLPRIMITIVERESTARTINDEXPROC)traceReal[TRACE_glPrimitiveRestartIndex];
+    if (!traceActive())
+        return real(index);
+    traceBegin(TRACE_glPrimitiveRestartIndex, 1);
+    traceArg(index);
+    real(index);
+    traceEnd();
+}
+
+static void APIENTRY trace_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    PFNGLCOPYBUFFERSUBDATAPROC real = (PFNGLCOPYBUFFERSUBDATAPROC)traceReal[TRACE_glCopyBufferSubData];
+    if (!traceActive())
+        return real(readTarget, writeTarget, readOffset, writeOffset, size);
+    traceBegin(TRACE_glCopyBufferSubData, 5);
+    traceArg(readTarget);
+    traceArg(writeTarget);
+    traceArg(readOffset);
+    traceArg(writeOffset);
+    traceArg(size);
+    real(readTarget, writeTarget, readOffset, writeOffset, size);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const* uniformNames, GLuint * uniformIndices)
+{
+    PFNGLGETUNIFORMINDICESPROC real = (PFNGLGETUNIFORMINDICESPROC)traceReal[TRACE_glGetUniformIndices];
+    if (!traceActive())
+        return real(program, uniformCount, uniformNames, uniformIndices);
+    traceBegin(TRACE_glGetUniformIndices, 4);
+    traceArg(program);
+    traceArg(uniformCount);
+    traceArg(uniformNames);
+    traceArg(uniformIndices);
+    real(program, uniformCount, uniformNames, uniformIndices);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint * uniformIndices, GLenum pname, GLint * params)
+{
+    PFNGLGETACTIVEUNIFORMSIVPROC real = (PFNGLGETACTIVEUNIFORMSIVPROC)traceReal[TRACE_glGetActiveUniformsiv];
+    if (!traceActive())
+        return real(program, uniformCount, uniformIndices, pname, params);
+    traceBegin(TRACE_glGetActiveUniformsiv, 5);
+    traceArg(program);
+    traceArg(uniformCount);
+    traceArg(uniformIndices);
+    traceArg(pname);
+    traceArg(params);
+    real(program, uniformCount, uniformIndices, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformName)
+{
+    PFNGLGETACTIVEUNIFORMNAMEPROC real = (PFNGLGETACTIVEUNIFORMNAMEPROC)traceReal[TRACE_glGetActiveUniformName];
+    if (!traceActive())
+        return real(program, uniformIndex, bufSize, length, uniformName);
+    traceBegin(TRACE_glGetActiveUniformName, 5);
+    traceArg(program);
+    traceArg(uniformIndex);
+    traceArg(bufSize);
+    traceArg(length);
+    traceArg(uniformName);
+    real(program, uniformIndex, bufSize, length, uniformName);
+    traceEnd();
+}
+
+static GLuint APIENTRY trace_glGetUniformBlockIndex(GLuint program, const GLchar * uniformBlockName)
+{
+    PFNGLGETUNIFORMBLOCKINDEXPROC real = (PFNGLGETUNIFORMBLOCKINDEXPROC)traceReal[TRACE_glGetUniformBlockIndex];
+    if (!traceActive())
+        return real(program, uniformBlockName);
+    traceBegin(TRACE_glGetUniformBlockIndex, 2);
+    traceArg(program);
+    traceArg(uniformBlockName);
+    tracePayload(uniformBlockName, strlen(uniformBlockName) + 1);
+    GLuint result = real(program, uniformBlockName);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params)
+{
+    PFNGLGETACTIVEUNIFORMBLOCKIVPROC real = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)traceReal[TRACE_glGetActiveUniformBlockiv];
+    if (!traceActive())
+        return real(program, uniformBlockIndex, pname, params);
+    traceBegin(TRACE_glGetActiveUniformBlockiv, 4);
+    traceArg(program);
+    traceArg(uniformBlockIndex);
+    traceArg(pname);
+    traceArg(params);
+    real(program, uniformBlockIndex, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformBlockName)
+{
+    PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC real = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)traceReal[TRACE_glGetActiveUniformBlockName];
+    if (!traceActive())
+        return real(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+    traceBegin(TRACE_glGetActiveUniformBlockName, 5);
+    traceArg(program);
+    traceArg(uniformBlockIndex);
+    traceArg(bufSize);
+    traceArg(length);
+    traceArg(uniformBlockName);
+    real(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+    traceEnd();
+}
+
+static void APIENTRY trace_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+    PFNGLUNIFORMBLOCKBINDINGPROC real = (PFNGLUNIFORMBLOCKBINDINGPROC)traceReal[TRACE_glUniformBlockBinding];
+    if (!traceActive())
+        return real(program, uniformBlockIndex, uniformBlockBinding);
+    traceBegin(TRACE_glUniformBlockBinding, 3);
+    traceArg(program);
+    traceArg(uniformBlockIndex);
+    traceArg(uniformBlockBinding);
+    real(program, uniformBlockIndex, uniformBlockBinding);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLint basevertex)
+{
+    PFNGLDRAWELEMENTSBASEVERTEXPROC real = (PFNGLDRAWELEMENTSBASEVERTEXPROC)traceReal[TRACE_glDrawElementsBaseVertex];
+    if (!traceActive())
+        return real(mode, count, type, indices, basevertex);
+    traceBegin(TRACE_glDrawElementsBaseVertex, 5);
+    traceArg(mode);
+    traceArg(count);
+    traceArg(type);
+    traceArg(indices);
+    traceArg(basevertex);
+    real(mode, count, type, indices, basevertex);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices, GLint basevertex)
+{
+    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC real = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)traceReal[TRACE_glDrawRangeElementsBaseVertex];
+    if (!traceActive())
+        return real(mode, start, end, count, type, indices, basevertex);
+    traceBegin(TRACE_glDrawRangeElementsBaseVertex, 7);
+    traceArg(mode);
+    traceArg(start);
+    traceArg(end);
+    traceArg(count);
+    traceArg(type);
+    traceArg(indices);
+    traceArg(basevertex);
+    real(mode, start, end, count, type, indices, basevertex);
+    traceEnd();
+}
+
+static void APIENTRY trace_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex)
+{
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC real = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)traceReal[TRACE_glDrawElementsInstancedBaseVertex];
+    if (!traceActive())
+        return real(mode, count, type, indices, instancecount, basevertex);
+    traceBegin(TRACE_glDrawElementsInstancedBaseVertex, 6);
+    traceArg(mode);
+    traceArg(count);
+    traceArg(type);
+    traceArg(indices);
+    traceArg(instancecount);
+    traceArg(basevertex);
+    real(mode, count, type, indices, instancecount, basevertex);
+    traceEnd();
+}
+
+static void APIENTRY trace_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount, const GLint * basevertex)
+{
+    PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC real = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)traceReal[TRACE_glMultiDrawElementsBaseVertex];
+    if (!traceActive())
+        return real(mode, count, type, indices, drawcount, basevertex);
+    traceBegin(TRACE_glMultiDrawElementsBaseVertex, 6);
+    traceArg(mode);
+    traceArg(count);
+    traceArg(type);
+    traceArg(indices);
+    traceArg(drawcount);
+    traceArg(basevertex);
+    real(mode, count, type, indices, drawcount, basevertex);
+    traceEnd();
+}
+
+static void APIENTRY trace_glProvokingVertex(GLenum mode)
+{
+    PFNGLPROVOKINGVERTEXPROC real = (PFNGLPROVOKINGVERTEXPROC)traceReal[TRACE_glProvokingVertex];
+    if (!traceActive())
+        return real(mode);
+    traceBegin(TRACE_glProvokingVertex, 1);
+    traceArg(mode);
+    real(mode);
+    traceEnd();
+}
+
+static GLsync APIENTRY trace_glFenceSync(GLenum condition, GLbitfield flags)
+{
+    PFNGLFENCESYNCPROC real = (PFNGLFENCESYNCPROC)traceReal[TRACE_glFenceSync];
+    if (!traceActive())
+        return real(condition, flags);
+    traceBegin(TRACE_glFenceSync, 2);
+    traceArg(condition);
+    traceArg(flags);
+    GLsync result = real(condition, flags);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static GLboolean APIENTRY trace_glIsSync(GLsync sync)
+{
+    PFNGLISSYNCPROC real = (PFNGLISSYNCPROC)traceReal[TRACE_glIsSync];
+    if (!traceActive())
+        return real(sync);
+    traceBegin(TRACE_glIsSync, 1);
+    traceArg(sync);
+    GLboolean result = real(sync);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glDeleteSync(GLsync sync)
+{
+    PFNGLDELETESYNCPROC real = (PFNGLDELETESYNCPROC)traceReal[TRACE_glDeleteSync];
+    if (!traceActive())
+        return real(sync);
+    traceBegin(TRACE_glDeleteSync, 1);
+    traceArg(sync);
+    real(sync);
+    traceEnd();
+}
+
+static GLenum APIENTRY trace_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    PFNGLCLIENTWAITSYNCPROC real = (PFNGLCLIENTWAITSYNCPROC)traceReal[TRACE_glClientWaitSync];
+    if (!traceActive())
+        return real(sync, flags, timeout);
+    traceBegin(TRACE_glClientWaitSync, 3);
+    traceArg(sync);
+    traceArg(flags);
+    traceArg(timeout);
+    GLenum result = real(sync, flags, timeout);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    PFNGLWAITSYNCPROC real = (PFNGLWAITSYNCPROC)traceReal[TRACE_glWaitSync];
+    if (!traceActive())
+        return real(sync, flags, timeout);
+    traceBegin(TRACE_glWaitSync, 3);
+    traceArg(sync);
+    traceArg(flags);
+    traceArg(timeout);
+    real(sync, flags, timeout);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetInteger64v(GLenum pname, GLint64 * data)
+{
+    PFNGLGETINTEGER64VPROC real = (PFNGLGETINTEGER64VPROC)traceReal[TRACE_glGetInteger64v];
+    if (!traceActive())
+        return real(pname, data);
+    traceBegin(TRACE_glGetInteger64v, 2);
+    traceArg(pname);
+    traceArg(data);
+    real(pname, data);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei * length, GLint * values)
+{
+    PFNGLGETSYNCIVPROC real = (PFNGLGETSYNCIVPROC)traceReal[TRACE_glGetSynciv];
+    if (!traceActive())
+        return real(sync, pname, count, length, values);
+    traceBegin(TRACE_glGetSynciv, 5);
+    traceArg(sync);
+    traceArg(pname);
+    traceArg(count);
+    traceArg(length);
+    traceArg(values);
+    real(sync, pname, count, length, values);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetInteger64i_v(GLenum target, GLuint index, GLint64 * data)
+{
+    PFNGLGETINTEGER64I_VPROC real = (PFNGLGETINTEGER64I_VPROC)traceReal[TRACE_glGetInteger64i_v];
+    if (!traceActive())
+        return real(target, index, data);
+    traceBegin(TRACE_glGetInteger64i_v, 3);
+    traceArg(target);
+    traceArg(index);
+    traceArg(data);
+    real(target, index, data);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 * params)
+{
+    PFNGLGETBUFFERPARAMETERI64VPROC real = (PFNGLGETBUFFERPARAMETERI64VPROC)traceReal[TRACE_glGetBufferParameteri64v];
+    if (!traceActive())
+        return real(target, pname, params);
+    traceBegin(TRACE_glGetBufferParameteri64v, 3);
+    traceArg(target);
+    traceArg(pname);
+    traceArg(params);
+    real(target, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+    PFNGLFRAMEBUFFERTEXTUREPROC real = (PFNGLFRAMEBUFFERTEXTUREPROC)traceReal[TRACE_glFramebufferTexture];
+    if (!traceActive())
+        return real(target, attachment, texture, level);
+    traceBegin(TRACE_glFramebufferTexture, 4);
+    traceArg(target);
+    traceArg(attachment);
+    traceArg(texture);
+    traceArg(level);
+    real(target, attachment, texture, level);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    PFNGLTEXIMAGE2DMULTISAMPLEPROC real = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)traceReal[TRACE_glTexImage2DMultisample];
+    if (!traceActive())
+        return real(target, samples, internalformat, width, height, fixedsamplelocations);
+    traceBegin(TRACE_glTexImage2DMultisample, 6);
+    traceArg(target);
+    traceArg(samples);
+    traceArg(internalformat);
+    traceArg(width);
+    traceArg(height);
+    traceArg(fixedsamplelocations);
+    real(target, samples, internalformat, width, height, fixedsamplelocations);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    PFNGLTEXIMAGE3DMULTISAMPLEPROC real = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)traceReal[TRACE_glTexImage3DMultisample];
+    if (!traceActive())
+        return real(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    traceBegin(TRACE_glTexImage3DMultisample, 7);
+    traceArg(target);
+    traceArg(samples);
+    traceArg(internalformat);
+    traceArg(width);
+    traceArg(height);
+    traceArg(depth);
+    traceArg(fixedsamplelocations);
+    real(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat * val)
+{
+    PFNGLGETMULTISAMPLEFVPROC real = (PFNGLGETMULTISAMPLEFVPROC)traceReal[TRACE_glGetMultisamplefv];
+    if (!traceActive())
+        return real(pname, index, val);
+    traceBegin(TRACE_glGetMultisamplefv, 3);
+    traceArg(pname);
+    traceArg(index);
+    traceArg(val);
+    real(pname, index, val);
+    traceEnd();
+}
+
+static void APIENTRY trace_glSampleMaski(GLuint maskNumber, GLbitfield mask)
+{
+    PFNGLSAMPLEMASKIPROC real = (PFNGLSAMPLEMASKIPROC)traceReal[TRACE_glSampleMaski];
+    if (!traceActive())
+        return real(maskNumber, mask);
+    traceBegin(TRACE_glSampleMaski, 2);
+    traceArg(maskNumber);
+    traceArg(mask);
+    real(maskNumber, mask);
+    traceEnd();
+}
+
+static void APIENTRY trace_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar * name)
+{
+    PFNGLBINDFRAGDATALOCATIONINDEXEDPROC real = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)traceReal[TRACE_glBindFragDataLocationIndexed];
+    if (!traceActive())
+        return real(program, colorNumber, index, name);
+    traceBegin(TRACE_glBindFragDataLocationIndexed, 4);
+    traceArg(program);
+    traceArg(colorNumber);
+    traceArg(index);
+    traceArg(name);
+    real(program, colorNumber, index, name);
+    traceEnd();
+}
+
+static GLint APIENTRY trace_glGetFragDataIndex(GLuint program, const GLchar * name)
+{
+    PFNGLGETFRAGDATAINDEXPROC real = (PFNGLGETFRAGDATAINDEXPROC)traceReal[TRACE_glGetFragDataIndex];
+    if (!traceActive())
+        return real(program, name);
+    traceBegin(TRACE_glGetFragDataIndex, 2);
+    traceArg(program);
+    traceArg(name);
+    GLint result = real(program, name);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glGenSamplers(GLsizei count, GLuint * samplers)
+{
+    PFNGLGENSAMPLERSPROC real = (PFNGLGENSAMPLERSPROC)traceReal[TRACE_glGenSamplers];
+    if (!traceActive())
+        return real(count, samplers);
+    traceBegin(TRACE_glGenSamplers, 2);
+    traceArg(count);
+    traceArg(samplers);
+    real(count, samplers);
+    tracePayload(samplers, (size_t)count * sizeof(GLuint));
+    traceEnd();
+}
+
+static void APIENTRY trace_glDeleteSamplers(GLsizei count, const GLuint * samplers)
+{
+    PFNGLDELETESAMPLERSPROC real = (PFNGLDELETESAMPLERSPROC)traceReal[TRACE_glDeleteSamplers];
+    if (!traceActive())
+        return real(count, samplers);
+    traceBegin(TRACE_glDeleteSamplers, 2);
+    traceArg(count);
+    traceArg(samplers);
+    tracePayload(samplers, (size_t)count * sizeof(GLuint));
+    real(count, samplers);
+    traceEnd();
+}
+
+static GLboolean APIENTRY trace_glIsSampler(GLuint sampler)
+{
+    PFNGLISSAMPLERPROC real = (PFNGLISSAMPLERPROC)traceReal[TRACE_glIsSampler];
+    if (!traceActive())
+        return real(sampler);
+    traceBegin(TRACE_glIsSampler, 1);
+    traceArg(sampler);
+    GLboolean result = real(sampler);
+    traceResult(result);
+    traceEnd();
+    return result;
+}
+
+static void APIENTRY trace_glBindSampler(GLuint unit, GLuint sampler)
+{
+    PFNGLBINDSAMPLERPROC real = (PFNGLBINDSAMPLERPROC)traceReal[TRACE_glBindSampler];
+    if (!traceActive())
+        return real(unit, sampler);
+    traceBegin(TRACE_glBindSampler, 2);
+    traceArg(unit);
+    traceArg(sampler);
+    real(unit, sampler);
+    traceEnd();
+}
+
+static void APIENTRY trace_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+{
+    PFNGLSAMPLERPARAMETERIPROC real = (PFNGLSAMPLERPARAMETERIPROC)traceReal[TRACE_glSamplerParameteri];
+    if (!traceActive())
+        return real(sampler, pname, param);
+    traceBegin(TRACE_glSamplerParameteri, 3);
+    traceArg(sampler);
+    traceArg(pname);
+    traceArg(param);
+    real(sampler, pname, param);
+    traceEnd();
+}
+
+static void APIENTRY trace_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint * param)
+{
+    PFNGLSAMPLERPARAMETERIVPROC real = (PFNGLSAMPLERPARAMETERIVPROC)traceReal[TRACE_glSamplerParameteriv];
+    if (!traceActive())
+        return real(sampler, pname, param);
+    traceBegin(TRACE_glSamplerParameteriv, 3);
+    traceArg(sampler);
+    traceArg(pname);
+    traceArg(param);
+    real(sampler, pname, param);
+    traceEnd();
+}
+
+static void APIENTRY trace_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+{
+    PFNGLSAMPLERPARAMETERFPROC real = (PFNGLSAMPLERPARAMETERFPROC)traceReal[TRACE_glSamplerParameterf];
+    if (!traceActive())
+        return real(sampler, pname, param);
+    traceBegin(TRACE_glSamplerParameterf, 3);
+    traceArg(sampler);
+    traceArg(pname);
+    traceArg(param);
+    real(sampler, pname, param);
+    traceEnd();
+}
+
+static void APIENTRY trace_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat * param)
+{
+    PFNGLSAMPLERPARAMETERFVPROC real = (PFNGLSAMPLERPARAMETERFVPROC)traceReal[TRACE_glSamplerParameterfv];
+    if (!traceActive())
+        return real(sampler, pname, param);
+    traceBegin(TRACE_glSamplerParameterfv, 3);
+    traceArg(sampler);
+    traceArg(pname);
+    traceArg(param);
+    real(sampler, pname, param);
+    traceEnd();
+}
+
+static void APIENTRY trace_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint * param)
+{
+    PFNGLSAMPLERPARAMETERIIVPROC real = (PFNGLSAMPLERPARAMETERIIVPROC)traceReal[TRACE_glSamplerParameterIiv];
+    if (!traceActive())
+        return real(sampler, pname, param);
+    traceBegin(TRACE_glSamplerParameterIiv, 3);
+    traceArg(sampler);
+    traceArg(pname);
+    traceArg(param);
+    real(sampler, pname, param);
+    traceEnd();
+}
+
+static void APIENTRY trace_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint * param)
+{
+    PFNGLSAMPLERPARAMETERIUIVPROC real = (PFNGLSAMPLERPARAMETERIUIVPROC)traceReal[TRACE_glSamplerParameterIuiv];
+    if (!traceActive())
+        return real(sampler, pname, param);
+    traceBegin(TRACE_glSamplerParameterIuiv, 3);
+    traceArg(sampler);
+    traceArg(pname);
+    traceArg(param);
+    real(sampler, pname, param);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint * params)
+{
+    PFNGLGETSAMPLERPARAMETERIVPROC real = (PFNGLGETSAMPLERPARAMETERIVPROC)traceReal[TRACE_glGetSamplerParameteriv];
+    if (!traceActive())
+        return real(sampler, pname, params);
+    traceBegin(TRACE_glGetSamplerParameteriv, 3);
+    traceArg(sampler);
+    traceArg(pname);
+    traceArg(params);
+    real(sampler, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint * params)
+{
+    PFNGLGETSAMPLERPARAMETERIIVPROC real = (PFNGLGETSAMPLERPARAMETERIIVPROC)traceReal[TRACE_glGetSamplerParameterIiv];
+    if (!traceActive())
+        return real(sampler, pname, params);
+    traceBegin(TRACE_glGetSamplerParameterIiv, 3);
+    traceArg(sampler);
+    traceArg(pname);
+    traceArg(params);
+    real(sampler, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat * params)
+{
+    PFNGLGETSAMPLERPARAMETERFVPROC real = (PFNGLGETSAMPLERPARAMETERFVPROC)traceReal[TRACE_glGetSamplerParameterfv];
+    if (!traceActive())
+        return real(sampler, pname, params);
+    traceBegin(TRACE_glGetSamplerParameterfv, 3);
+    traceArg(sampler);
+    traceArg(pname);
+    traceArg(params);
+    real(sampler, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint * params)
+{
+    PFNGLGETSAMPLERPARAMETERIUIVPROC real = (PFNGLGETSAMPLERPARAMETERIUIVPROC)traceReal[TRACE_glGetSamplerParameterIuiv];
+    if (!traceActive())
+        return real(sampler, pname, params);
+    traceBegin(TRACE_glGetSamplerParameterIuiv, 3);
+    traceArg(sampler);
+    traceArg(pname);
+    traceArg(params);
+    real(sampler, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glQueryCounter(GLuint id, GLenum target)
+{
+    PFNGLQUERYCOUNTERPROC real = (PFNGLQUERYCOUNTERPROC)traceReal[TRACE_glQueryCounter];
+    if (!traceActive())
+        return real(id, target);
+    traceBegin(TRACE_glQueryCounter, 2);
+    traceArg(id);
+    traceArg(target);
+    real(id, target);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 * params)
+{
+    PFNGLGETQUERYOBJECTI64VPROC real = (PFNGLGETQUERYOBJECTI64VPROC)traceReal[TRACE_glGetQueryObjecti64v];
+    if (!traceActive())
+        return real(id, pname, params);
+    traceBegin(TRACE_glGetQueryObjecti64v, 3);
+    traceArg(id);
+    traceArg(pname);
+    traceArg(params);
+    real(id, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 * params)
+{
+    PFNGLGETQUERYOBJECTUI64VPROC real = (PFNGLGETQUERYOBJECTUI64VPROC)traceReal[TRACE_glGetQueryObjectui64v];
+    if (!traceActive())
+        return real(id, pname, params);
+    traceBegin(TRACE_glGetQueryObjectui64v, 3);
+    traceArg(id);
+    traceArg(pname);
+    traceArg(params);
+    real(id, pname, params);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribDivisor(GLuint index, GLuint divisor)
+{
+    PFNGLVERTEXATTRIBDIVISORPROC real = (PFNGLVERTEXATTRIBDIVISORPROC)traceReal[TRACE_glVertexAttribDivisor];
+    if (!traceActive())
+        return real(index, divisor);
+    traceBegin(TRACE_glVertexAttribDivisor, 2);
+    traceArg(index);
+    traceArg(divisor);
+    real(index, divisor);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    PFNGLVERTEXATTRIBP1UIPROC real = (PFNGLVERTEXATTRIBP1UIPROC)traceReal[TRACE_glVertexAttribP1ui];
+    if (!traceActive())
+        return real(index, type, normalized, value);
+    traceBegin(TRACE_glVertexAttribP1ui, 4);
+    traceArg(index);
+    traceArg(type);
+    traceArg(normalized);
+    traceArg(value);
+    real(index, type, normalized, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
+{
+    PFNGLVERTEXATTRIBP1UIVPROC real = (PFNGLVERTEXATTRIBP1UIVPROC)traceReal[TRACE_glVertexAttribP1uiv];
+    if (!traceActive())
+        return real(index, type, normalized, value);
+    traceBegin(TRACE_glVertexAttribP1uiv, 4);
+    traceArg(index);
+    traceArg(type);
+    traceArg(normalized);
+    traceArg(value);
+    real(index, type, normalized, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    PFNGLVERTEXATTRIBP2UIPROC real = (PFNGLVERTEXATTRIBP2UIPROC)traceReal[TRACE_glVertexAttribP2ui];
+    if (!traceActive())
+        return real(index, type, normalized, value);
+    traceBegin(TRACE_glVertexAttribP2ui, 4);
+    traceArg(index);
+    traceArg(type);
+    traceArg(normalized);
+    traceArg(value);
+    real(index, type, normalized, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
+{
+    PFNGLVERTEXATTRIBP2UIVPROC real = (PFNGLVERTEXATTRIBP2UIVPROC)traceReal[TRACE_glVertexAttribP2uiv];
+    if (!traceActive())
+        return real(index, type, normalized, value);
+    traceBegin(TRACE_glVertexAttribP2uiv, 4);
+    traceArg(index);
+    traceArg(type);
+    traceArg(normalized);
+    traceArg(value);
+    real(index, type, normalized, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    PFNGLVERTEXATTRIBP3UIPROC real = (PFNGLVERTEXATTRIBP3UIPROC)traceReal[TRACE_glVertexAttribP3ui];
+    if (!traceActive())
+        return real(index, type, normalized, value);
+    traceBegin(TRACE_glVertexAttribP3ui, 4);
+    traceArg(index);
+    traceArg(type);
+    traceArg(normalized);
+    traceArg(value);
+    real(index, type, normalized, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
+{
+    PFNGLVERTEXATTRIBP3UIVPROC real = (PFNGLVERTEXATTRIBP3UIVPROC)traceReal[TRACE_glVertexAttribP3uiv];
+    if (!traceActive())
+        return real(index, type, normalized, value);
+    traceBegin(TRACE_glVertexAttribP3uiv, 4);
+    traceArg(index);
+    traceArg(type);
+    traceArg(normalized);
+    traceArg(value);
+    real(index, type, normalized, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    PFNGLVERTEXATTRIBP4UIPROC real = (PFNGLVERTEXATTRIBP4UIPROC)traceReal[TRACE_glVertexAttribP4ui];
+    if (!traceActive())
+        return real(index, type, normalized, value);
+    traceBegin(TRACE_glVertexAttribP4ui, 4);
+    traceArg(index);
+    traceArg(type);
+    traceArg(normalized);
+    traceArg(value);
+    real(index, type, normalized, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
+{
+    PFNGLVERTEXATTRIBP4UIVPROC real = (PFNGLVERTEXATTRIBP4UIVPROC)traceReal[TRACE_glVertexAttribP4uiv];
+    if (!traceActive())
+        return real(index, type, normalized, value);
+    traceBegin(TRACE_glVertexAttribP4uiv, 4);
+    traceArg(index);
+    traceArg(type);
+    traceArg(normalized);
+    traceArg(value);
+    real(index, type, normalized, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexP2ui(GLenum type, GLuint value)
+{
+    PFNGLVERTEXP2UIPROC real = (PFNGLVERTEXP2UIPROC)traceReal[TRACE_glVertexP2ui];
+    if (!traceActive())
+        return real(type, value);
+    traceBegin(TRACE_glVertexP2ui, 2);
+    traceArg(type);
+    traceArg(value);
+    real(type, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexP2uiv(GLenum type, const GLuint * value)
+{
+    PFNGLVERTEXP2UIVPROC real = (PFNGLVERTEXP2UIVPROC)traceReal[TRACE_glVertexP2uiv];
+    if (!traceActive())
+        return real(type, value);
+    traceBegin(TRACE_glVertexP2uiv, 2);
+    traceArg(type);
+    traceArg(value);
+    real(type, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexP3ui(GLenum type, GLuint value)
+{
+    PFNGLVERTEXP3UIPROC real = (PFNGLVERTEXP3UIPROC)traceReal[TRACE_glVertexP3ui];
+    if (!traceActive())
+        return real(type, value);
+    traceBegin(TRACE_glVertexP3ui, 2);
+    traceArg(type);
+    traceArg(value);
+    real(type, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexP3uiv(GLenum type, const GLuint * value)
+{
+    PFNGLVERTEXP3UIVPROC real = (PFNGLVERTEXP3UIVPROC)traceReal[TRACE_glVertexP3uiv];
+    if (!traceActive())
+        return real(type, value);
+    traceBegin(TRACE_glVertexP3uiv, 2);
+    traceArg(type);
+    traceArg(value);
+    real(type, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexP4ui(GLenum type, GLuint value)
+{
+    PFNGLVERTEXP4UIPROC real = (PFNGLVERTEXP4UIPROC)traceReal[TRACE_glVertexP4ui];
+    if (!traceActive())
+        return real(type, value);
+    traceBegin(TRACE_glVertexP4ui, 2);
+    traceArg(type);
+    traceArg(value);
+    real(type, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glVertexP4uiv(GLenum type, const GLuint * value)
+{
+    PFNGLVERTEXP4UIVPROC real = (PFNGLVERTEXP4UIVPROC)traceReal[TRACE_glVertexP4uiv];
+    if (!traceActive())
+        return real(type, value);
+    traceBegin(TRACE_glVertexP4uiv, 2);
+    traceArg(type);
+    traceArg(value);
+    real(type, value);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexCoordP1ui(GLenum type, GLuint coords)
+{
+    PFNGLTEXCOORDP1UIPROC real = (PFNGLTEXCOORDP1UIPROC)traceReal[TRACE_glTexCoordP1ui];
+    if (!traceActive())
+        return real(type, coords);
+    traceBegin(TRACE_glTexCoordP1ui, 2);
+    traceArg(type);
+    traceArg(coords);
+    real(type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexCoordP1uiv(GLenum type, const GLuint * coords)
+{
+    PFNGLTEXCOORDP1UIVPROC real = (PFNGLTEXCOORDP1UIVPROC)traceReal[TRACE_glTexCoordP1uiv];
+    if (!traceActive())
+        return real(type, coords);
+    traceBegin(TRACE_glTexCoordP1uiv, 2);
+    traceArg(type);
+    traceArg(coords);
+    real(type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexCoordP2ui(GLenum type, GLuint coords)
+{
+    PFNGLTEXCOORDP2UIPROC real = (PFNGLTEXCOORDP2UIPROC)traceReal[TRACE_glTexCoordP2ui];
+    if (!traceActive())
+        return real(type, coords);
+    traceBegin(TRACE_glTexCoordP2ui, 2);
+    traceArg(type);
+    traceArg(coords);
+    real(type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexCoordP2uiv(GLenum type, const GLuint * coords)
+{
+    PFNGLTEXCOORDP2UIVPROC real = (PFNGLTEXCOORDP2UIVPROC)traceReal[TRACE_glTexCoordP2uiv];
+    if (!traceActive())
+        return real(type, coords);
+    traceBegin(TRACE_glTexCoordP2uiv, 2);
+    traceArg(type);
+    traceArg(coords);
+    real(type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexCoordP3ui(GLenum type, GLuint coords)
+{
+    PFNGLTEXCOORDP3UIPROC real = (PFNGLTEXCOORDP3UIPROC)traceReal[TRACE_glTexCoordP3ui];
+    if (!traceActive())
+        return real(type, coords);
+    traceBegin(TRACE_glTexCoordP3ui, 2);
+    traceArg(type);
+    traceArg(coords);
+    real(type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexCoordP3uiv(GLenum type, const GLuint * coords)
+{
+    PFNGLTEXCOORDP3UIVPROC real = (PFNGLTEXCOORDP3UIVPROC)traceReal[TRACE_glTexCoordP3uiv];
+    if (!traceActive())
+        return real(type, coords);
+    traceBegin(TRACE_glTexCoordP3uiv, 2);
+    traceArg(type);
+    traceArg(coords);
+    real(type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexCoordP4ui(GLenum type, GLuint coords)
+{
+    PFNGLTEXCOORDP4UIPROC real = (PFNGLTEXCOORDP4UIPROC)traceReal[TRACE_glTexCoordP4ui];
+    if (!traceActive())
+        return real(type, coords);
+    traceBegin(TRACE_glTexCoordP4ui, 2);
+    traceArg(type);
+    traceArg(coords);
+    real(type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glTexCoordP4uiv(GLenum type, const GLuint * coords)
+{
+    PFNGLTEXCOORDP4UIVPROC real = (PFNGLTEXCOORDP4UIVPROC)traceReal[TRACE_glTexCoordP4uiv];
+    if (!traceActive())
+        return real(type, coords);
+    traceBegin(TRACE_glTexCoordP4uiv, 2);
+    traceArg(type);
+    traceArg(coords);
+    real(type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
+{
+    PFNGLMULTITEXCOORDP1UIPROC real = (PFNGLMULTITEXCOORDP1UIPROC)traceReal[TRACE_glMultiTexCoordP1ui];
+    if (!traceActive())
+        return real(texture, type, coords);
+    traceBegin(TRACE_glMultiTexCoordP1ui, 3);
+    traceArg(texture);
+    traceArg(type);
+    traceArg(coords);
+    real(texture, type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint * coords)
+{
+    PFNGLMULTITEXCOORDP1UIVPROC real = (PFNGLMULTITEXCOORDP1UIVPROC)traceReal[TRACE_glMultiTexCoordP1uiv];
+    if (!traceActive())
+        return real(texture, type, coords);
+    traceBegin(TRACE_glMultiTexCoordP1uiv, 3);
+    traceArg(texture);
+    traceArg(type);
+    traceArg(coords);
+    real(texture, type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
+{
+    PFNGLMULTITEXCOORDP2UIPROC real = (PFNGLMULTITEXCOORDP2UIPROC)traceReal[TRACE_glMultiTexCoordP2ui];
+    if (!traceActive())
+        return real(texture, type, coords);
+    traceBegin(TRACE_glMultiTexCoordP2ui, 3);
+    traceArg(texture);
+    traceArg(type);
+    traceArg(coords);
+    real(texture, type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint * coords)
+{
+    PFNGLMULTITEXCOORDP2UIVPROC real = (PFNGLMULTITEXCOORDP2UIVPROC)traceReal[TRACE_glMultiTexCoordP2uiv];
+    if (!traceActive())
+        return real(texture, type, coords);
+    traceBegin(TRACE_glMultiTexCoordP2uiv, 3);
+    traceArg(texture);
+    traceArg(type);
+    traceArg(coords);
+    real(texture, type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
+{
+    PFNGLMULTITEXCOORDP3UIPROC real = (PFNGLMULTITEXCOORDP3UIPROC)traceReal[TRACE_glMultiTexCoordP3ui];
+    if (!traceActive())
+        return real(texture, type, coords);
+    traceBegin(TRACE_glMultiTexCoordP3ui, 3);
+    traceArg(texture);
+    traceArg(type);
+    traceArg(coords);
+    real(texture, type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint * coords)
+{
+    PFNGLMULTITEXCOORDP3UIVPROC real = (PFNGLMULTITEXCOORDP3UIVPROC)traceReal[TRACE_glMultiTexCoordP3uiv];
+    if (!traceActive())
+        return real(texture, type, coords);
+    traceBegin(TRACE_glMultiTexCoordP3uiv, 3);
+    traceArg(texture);
+    traceArg(type);
+    traceArg(coords);
+    real(texture, type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
+{
+    PFNGLMULTITEXCOORDP4UIPROC real = (PFNGLMULTITEXCOORDP4UIPROC)traceReal[TRACE_glMultiTexCoordP4ui];
+    if (!traceActive())
+        return real(texture, type, coords);
+    traceBegin(TRACE_glMultiTexCoordP4ui, 3);
+    traceArg(texture);
+    traceArg(type);
+    traceArg(coords);
+    real(texture, type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint * coords)
+{
+    PFNGLMULTITEXCOORDP4UIVPROC real = (PFNGLMULTITEXCOORDP4UIVPROC)traceReal[TRACE_glMultiTexCoordP4uiv];
+    if (!traceActive())
+        return real(texture, type, coords);
+    traceBegin(TRACE_glMultiTexCoordP4uiv, 3);
+    traceArg(texture);
+    traceArg(type);
+    traceArg(coords);
+    real(texture, type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glNormalP3ui(GLenum type, GLuint coords)
+{
+    PFNGLNORMALP3UIPROC real = (PFNGLNORMALP3UIPROC)traceReal[TRACE_glNormalP3ui];
+    if (!traceActive())
+        return real(type, coords);
+    traceBegin(TRACE_glNormalP3ui, 2);
+    traceArg(type);
+    traceArg(coords);
+    real(type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glNormalP3uiv(GLenum type, const GLuint * coords)
+{
+    PFNGLNORMALP3UIVPROC real = (PFNGLNORMALP3UIVPROC)traceReal[TRACE_glNormalP3uiv];
+    if (!traceActive())
+        return real(type, coords);
+    traceBegin(TRACE_glNormalP3uiv, 2);
+    traceArg(type);
+    traceArg(coords);
+    real(type, coords);
+    traceEnd();
+}
+
+static void APIENTRY trace_glColorP3ui(GLenum type, GLuint color)
+{
+    PFNGLCOLORP3UIPROC real = (PFNGLCOLORP3UIPROC)traceReal[TRACE_glColorP3ui];
+    if (!traceActive())
+        return real(type, color);
+    traceBegin(TRACE_glColorP3ui, 2);
+    traceArg(type);
+    traceArg(color);
+    real(type, color);
+    traceEnd();
+}
+
+static void APIENTRY trace_glColorP3uiv(GLenum type, const GLuint * color)
+{
+    PFNGLCOLORP3UIVPROC real = (PFNGLCOLORP3UIVPROC)traceReal[TRACE_glColorP3uiv];
+    if (!traceActive())
+        return real(type, color);
+    traceBegin(TRACE_glColorP3uiv, 2);
+    traceArg(type);
+    traceArg(color);
+    real(type, color);
+    traceEnd();
+}
+
+static void APIENTRY trace_glColorP4ui(GLenum type, GLuint color)
+{
+    PFNGLCOLORP4UIPROC real = (PFNGLCOLORP4UIPROC)traceReal[TRACE_glColorP4ui];
+    if (!traceActive())
+        return real(type, color);
+    traceBegin(TRACE_glColorP4ui, 2);
+    traceArg(type);
+    traceArg(color);
+    real(type, color);
+    traceEnd();
+}
+
+static void APIENTRY trace_glColorP4uiv(GLenum type, const GLuint * color)
+{
+    PFNGLCOLORP4UIVPROC real = (PFNGLCOLORP4UIVPROC)traceReal[TRACE_glColorP4uiv];
+    if (!traceActive())
+        return real(type, color);
+    traceBegin(TRACE_glColorP4uiv, 2);
+    traceArg(type);
+    traceArg(color);
+    real(type, color);
+    traceEnd();
+}
+
+static void APIENTRY trace_glSecondaryColorP3ui(GLenum type, GLuint color)
+{
+    PFNGLSECONDARYCOLORP3UIPROC real = (PFNGLSECONDARYCOLORP3UIPROC)traceReal[TRACE_glSecondaryColorP3ui];
+    if (!traceActive())
+        return real(type, color);
+    traceBegin(TRACE_glSecondaryColorP3ui, 2);
+    traceArg(type);
+    traceArg(color);
+    real(type, color);
+    traceEnd();
+}
+
+static void APIENTRY trace_glSecondaryColorP3uiv(GLenum type, const GLuint * color)
+{
+    PFNGLSECONDARYCOLORP3UIVPROC real = (PFNGLSECONDARYCOLORP3UIVPROC)traceReal[TRACE_glSecondaryColorP3uiv];
+    if (!traceActive())
+        return real(type, color);
+    traceBegin(TRACE_glSecondaryColorP3uiv, 2);
+    traceArg(type);
+    traceArg(color);
+    real(type, color);
+    traceEnd();
+}
+
+static void installTraceWrappers()
+{
+    if ((traceReal[TRACE_glCullFace] = (void*)glad_glCullFace)) glad_glCullFace = trace_glCullFace;
+    if ((traceReal[TRACE_glFrontFace] = (void*)glad_glFrontFace)) glad_glFrontFace = trace_glFrontFace;
+    if ((traceReal[TRACE_glHint] = (void*)glad_glHint)) glad_glHint = trace_glHint;
+    if ((traceReal[TRACE_glLineWidth] = (void*)glad_glLineWidth)) glad_glLineWidth = trace_glLineWidth;
+    if ((traceReal[TRACE_glPointSize] = (void*)glad_glPointSize)) glad_glPointSize = trace_glPointSize;
+    if ((traceReal[TRACE_glPolygonMode] = (void*)glad_glPolygonMode)) glad_glPolygonMode = trace_glPolygonMode;
+    if ((traceReal[TRACE_glScissor] = (void*)glad_glScissor)) glad_glScissor = trace_glScissor;
+    if ((traceReal[TRACE_glTexParameterf] = (void*)glad_glTexParameterf)) glad_glTexParameterf = trace_glTexParameterf;
+    if ((traceReal[TRACE_glTexParameterfv] = (void*)glad_glTexParameterfv)) glad_glTexParameterfv = trace_glTexParameterfv;
+    if ((traceReal[TRACE_glTexParameteri] = (void*)glad_glTexParameteri)) glad_glTexParameteri = trace_glTexParameteri;
+    if ((traceReal[TRACE_glTexParameteriv] = (void*)glad_glTexParameteriv)) glad_glTexParameteriv = trace_glTexParameteriv;
+    if ((traceReal[TRACE_glTexImage1D] = (void*)glad_glTexImage1D)) glad_glTexImage1D = trace_glTexImage1D;
+    if ((traceReal[TRACE_glTexImage2D] = (void*)glad_glTexImage2D)) glad_glTexImage2D = trace_glTexImage2D;
+    if ((traceReal[TRACE_glDrawBuffer] = (void*)glad_glDrawBuffer)) glad_glDrawBuffer = trace_glDrawBuffer;
+    if ((traceReal[TRACE_glClear] = (void*)glad_glClear)) glad_glClear = trace_glClear;
+    if ((traceReal[TRACE_glClearColor] = (void*)glad_glClearColor)) glad_glClearColor = trace_glClearColor;
+    if ((traceReal[TRACE_glClearStencil] = (void*)glad_glClearStencil)) glad_glClearStencil = trace_glClearStencil;
+    if ((traceReal[TRACE_glClearDepth] = (void*)glad_glClearDepth)) glad_glClearDepth = trace_glClearDepth;
+    if ((traceReal[TRACE_glStencilMask] = (void*)glad_glStencilMask)) glad_glStencilMask = trace_glStencilMask;
+    if ((traceReal[TRACE_glColorMask] = (void*)glad_glColorMask)) glad_glColorMask = trace_glColorMask;
+    if ((traceReal[TRACE_glDepthMask] = (void*)glad_glDepthMask)) glad_glDepthMask = trace_glDepthMask;
+    if ((traceReal[TRACE_glDisable] = (void*)glad_glDisable)) glad_glDisable = trace_glDisable;
+    if ((traceReal[TRACE_glEnable] = (void*)glad_glEnable)) glad_glEnable = trace_glEnable;
+    if ((traceReal[TRACE_glFinish] = (void*)glad_glFinish)) glad_glFinish = trace_glFinish;
+    if ((traceReal[TRACE_glFlush] = (void*)glad_glFlush)) glad_glFlush = trace_glFlush;
+    if ((traceReal[TRACE_glBlendFunc] = (void*)glad_glBlendFunc)) glad_glBlendFunc = trace_glBlendFunc;
+    if ((traceReal[TRACE_glLogicOp] = (void*)glad_glLogicOp)) glad_glLogicOp = trace_glLogicOp;
+    if ((traceReal[TRACE_glStencilFunc] = (void*)glad_glStencilFunc)) glad_glStencilFunc = trace_glStencilFunc;
+    if ((traceReal[TRACE_glStencilOp] = (void*)glad_glStencilOp)) glad_glStencilOp = trace_glStencilOp;
+    if ((traceReal[TRACE_glDepthFunc] = (void*)glad_glDepthFunc)) glad_glDepthFunc = trace_glDepthFunc;
+    if ((traceReal[TRACE_glPixelStoref] = (void*)glad_glPixelStoref)) glad_glPixelStoref = trace_glPixelStoref;
+    if ((traceReal[TRACE_glPixelStorei] = (void*)glad_glPixelStorei)) glad_glPixelStorei = trace_glPixelStorei;
+    if ((traceReal[TRACE_glReadBuffer] = (void*)glad_glReadBuffer)) glad_glReadBuffer = trace_glReadBuffer;
+    if ((traceReal[TRACE_glReadPixels] = (void*)glad_glReadPixels)) glad_glReadPixels = trace_glReadPixels;
+    if ((traceReal[TRACE_glGetBooleanv] = (void*)glad_glGetBooleanv)) glad_glGetBooleanv = trace_glGetBooleanv;
+    if ((traceReal[TRACE_glGetDoublev] = (void*)glad_glGetDoublev)) glad_glGetDoublev = trace_glGetDoublev;
+    if ((traceReal[TRACE_glGetError] = (void*)glad_glGetError)) glad_glGetError = trace_glGetError;
+    if ((traceReal[TRACE_glGetFloatv] = (void*)glad_glGetFloatv)) glad_glGetFloatv = trace_glGetFloatv;
+    if ((traceReal[TRACE_glGetIntegerv] = (void*)glad_glGetIntegerv)) glad_glGetIntegerv = trace_glGetIntegerv;
+    if ((traceReal[TRACE_glGetString] = (void*)glad_glGetString)) glad_glGetString = trace_glGetString;
+    if ((traceReal[TRACE_glGetTexImage] = (void*)glad_glGetTexImage)) glad_glGetTexImage = trace_glGetTexImage;
+    if ((traceReal[TRACE_glGetTexParameterfv] = (void*)glad_glGetTexParameterfv)) glad_glGetTexParameterfv = trace_glGetTexParameterfv;
+    if ((traceReal[TRACE_glGetTexParameteriv] = (void*)glad_glGetTexParameteriv)) glad_glGetTexParameteriv = trace_glGetTexParameteriv;
+    if ((traceReal[TRACE_glGetTexLevelParameterfv] = (void*)glad_glGetTexLevelParameterfv)) glad_glGetTexLevelParameterfv = trace_glGetTexLevelParameterfv;
+    if ((traceReal[TRACE_glGetTexLevelParameteriv] = (void*)glad_glGetTexLevelParameteriv)) glad_glGetTexLevelParameteriv = trace_glGetTexLevelParameteriv;
+    if ((traceReal[TRACE_glIsEnabled] = (void*)glad_glIsEnabled)) glad_glIsEnabled = trace_glIsEnabled;
+    if ((traceReal[TRACE_glDepthRange] = (void*)glad_glDepthRange)) glad_glDepthRange = trace_glDepthRange;
+    if ((traceReal[TRACE_glViewport] = (void*)glad_glViewport)) glad_glViewport = trace_glViewport;
+    if ((traceReal[TRACE_glDrawArrays] = (void*)glad_glDrawArrays)) glad_glDrawArrays = trace_glDrawArrays;
+    if ((traceReal[TRACE_glDrawElements] = (void*)glad_glDrawElements)) glad_glDrawElements = trace_glDrawElements;
+    if ((traceReal[TRACE_glPolygonOffset] = (void*)glad_glPolygonOffset)) glad_glPolygonOffset = trace_glPolygonOffset;
+    if ((traceReal[TRACE_glCopyTexImage1D] = (void*)glad_glCopyTexImage1D)) glad_glCopyTexImage1D = trace_glCopyTexImage1D;
+    if ((traceReal[TRACE_glCopyTexImage2D] = (void*)glad_glCopyTexImage2D)) glad_glCopyTexImage2D = trace_glCopyTexImage2D;
+    if ((traceReal[TRACE_glCopyTexSubImage1D] = (void*)glad_glCopyTexSubImage1D)) glad_glCopyTexSubImage1D = trace_glCopyTexSubImage1D;
+    if ((traceReal[TRACE_glCopyTexSubImage2D] = (void*)glad_glCopyTexSubImage2D)) glad_glCopyTexSubImage2D = trace_glCopyTexSubImage2D;
+    if ((traceReal[TRACE_glTexSubImage1D] = (void*)glad_glTexSubImage1D)) glad_glTexSubImage1D = trace_glTexSubImage1D;
+    if ((traceReal[TRACE_glTexSubImage2D] = (void*)glad_glTexSubImage2D)) glad_glTexSubImage2D = trace_glTexSubImage2D;
+    if ((traceReal[TRACE_glBindTexture] = (void*)glad_glBindTexture)) glad_glBindTexture = trace_glBindTexture;
+    if ((traceReal[TRACE_glDeleteTextures] = (void*)glad_glDeleteTextures)) glad_glDeleteTextures = trace_glDeleteTextures;
+    if ((traceReal[TRACE_glGenTextures] = (void*)glad_glGenTextures)) glad_glGenTextures = trace_glGenTextures;
+    if ((traceReal[TRACE_glIsTexture] = (void*)glad_glIsTexture)) glad_glIsTexture = trace_glIsTexture;
+    if ((traceReal[TRACE_glDrawRangeElements] = (void*)glad_glDrawRangeElements)) glad_glDrawRangeElements = trace_glDrawRangeElements;
+    if ((traceReal[TRACE_glTexImage3D] = (void*)glad_glTexImage3D)) glad_glTexImage3D = trace_glTexImage3D;
+    if ((traceReal[TRACE_glTexSubImage3D] = (void*)glad_glTexSubImage3D)) glad_glTexSubImage3D = trace_glTexSubImage3D;
+    if ((traceReal[TRACE_glCopyTexSubImage3D] = (void*)glad_glCopyTexSubImage3D)) glad_glCopyTexSubImage3D = trace_glCopyTexSubImage3D;
+    if ((traceReal[TRACE_glActiveTexture] = (void*)glad_glActiveTexture)) glad_glActiveTexture = trace_glActiveTexture;
+    if ((traceReal[TRACE_glSampleCoverage] = (void*)glad_glSampleCoverage)) glad_glSampleCoverage = trace_glSampleCoverage;
+    if ((traceReal[TRACE_glCompressedTexImage3D] = (void*)glad_glCompressedTexImage3D)) glad_glCompressedTexImage3D = trace_glCompressedTexImage3D;
+    if ((traceReal[TRACE_glCompressedTexImage2D] = (void*)glad_glCompressedTexImage2D)) glad_glCompressedTexImage2D = trace_glCompressedTexImage2D;
+    if ((traceReal[TRACE_glCompressedTexImage1D] = (void*)glad_glCompressedTexImage1D)) glad_glCompressedTexImage1D = trace_glCompressedTexImage1D;
+    if ((traceReal[TRACE_glCompressedTexSubImage3D] = (void*)glad_glCompressedTexSubImage3D)) glad_glCompressedTexSubImage3D = trace_glCompressedTexSubImage3D;
+    if ((traceReal[TRACE_glCompressedTexSubImage2D] = (void*)glad_glCompressedTexSubImage2D)) glad_glCompressedTexSubImage2D = trace_glCompressedTexSubImage2D;
+    if ((traceReal[TRACE_glCompressedTexSubImage1D] = (void*)glad_glCompressedTexSubImage1D)) glad_glCompressedTexSubImage1D = trace_glCompressedTexSubImage1D;
+    if ((traceReal[TRACE_glGetCompressedTexImage] = (void*)glad_glGetCompressedTexImage)) glad_glGetCompressedTexImage = trace_glGetCompressedTexImage;
+    if ((traceReal[TRACE_glBlendFuncSeparate] = (void*)glad_glBlendFuncSeparate)) glad_glBlendFuncSeparate = trace_glBlendFuncSeparate;
+    if ((traceReal[TRACE_glMultiDrawArrays] = (void*)glad_glMultiDrawArrays)) glad_glMultiDrawArrays = trace_glMultiDrawArrays;
+    if ((traceReal[TRACE_glMultiDrawElements] = (void*)glad_glMultiDrawElements)) glad_glMultiDrawElements = trace_glMultiDrawElements;
+    if ((traceReal[TRACE_glPointParameterf] = (void*)glad_glPointParameterf)) glad_glPointParameterf = trace_glPointParameterf;
+    if ((traceReal[TRACE_glPointParameterfv] = (void*)glad_glPointParameterfv)) glad_glPointParameterfv = trace_glPointParameterfv;
+    if ((traceReal[TRACE_glPointParameteri] = (void*)glad_glPointParameteri)) glad_glPointParameteri = trace_glPointParameteri;
+    if ((traceReal[TRACE_glPointParameteriv] = (void*)glad_glPointParameteriv)) glad_glPointParameteriv = trace_glPointParameteriv;
+    if ((traceReal[TRACE_glBlendColor] = (void*)glad_glBlendColor)) glad_glBlendColor = trace_glBlendColor;
+    if ((traceReal[TRACE_glBlendEquation] = (void*)glad_glBlendEquation)) glad_glBlendEquation = trace_glBlendEquation;
+    if ((traceReal[TRACE_glGenQueries] = (void*)glad_glGenQueries)) glad_glGenQueries = trace_glGenQueries;
+    if ((traceReal[TRACE_glDeleteQueries] = (void*)glad_glDeleteQueries)) glad_glDeleteQueries = trace_glDeleteQueries;
+    if ((traceReal[TRACE_glIsQuery] = (void*)glad_glIsQuery)) glad_glIsQuery = trace_glIsQuery;
+    if ((traceReal[TRACE_glBeginQuery] = (void*)glad_glBeginQuery)) glad_glBeginQuery = trace_glBeginQuery;
+    if ((traceReal[TRACE_glEndQuery] = (void*)glad_glEndQuery)) glad_glEndQuery = trace_glEndQuery;
+    if ((traceReal[TRACE_glGetQueryiv] = (void*)glad_glGetQueryiv)) glad_glGetQueryiv = trace_glGetQueryiv;
+    if ((traceReal[TRACE_glGetQueryObjectiv] = (void*)glad_glGetQueryObjectiv)) glad_glGetQueryObjectiv = trace_glGetQueryObjectiv;
+    if ((traceReal[TRACE_glGetQueryObjectuiv] = (void*)glad_glGetQueryObjectuiv)) glad_glGetQueryObjectuiv = trace_glGetQueryObjectuiv;
+    if ((traceReal[TRACE_glBindBuffer] = (void*)glad_glBindBuffer)) glad_glBindBuffer = trace_glBindBuffer;
+    if ((traceReal[TRACE_glDeleteBuffers] = (void*)glad_glDeleteBuffers)) glad_glDeleteBuffers = trace_glDeleteBuffers;
+    if ((traceReal[TRACE_glGenBuffers] = (void*)glad_glGenBuffers)) glad_glGenBuffers = trace_glGenBuffers;
+    if ((traceReal[TRACE_glIsBuffer] = (void*)glad_glIsBuffer)) glad_glIsBuffer = trace_glIsBuffer;
+    if ((traceReal[TRACE_glBufferData] = (void*)glad_glBufferData)) glad_glBufferData = trace_glBufferData;
+    if ((traceReal[TRACE_glBufferSubData] = (void*)glad_glBufferSubData)) glad_glBufferSubData = trace_glBufferSubData;
+    if ((traceReal[TRACE_glGetBufferSubData] = (void*)glad_glGetBufferSubData)) glad_glGetBufferSubData = trace_glGetBufferSubData;
+    if ((traceReal[TRACE_glMapBuffer] = (void*)glad_glMapBuffer)) glad_glMapBuffer = trace_glMapBuffer;
+    if ((traceReal[TRACE_glUnmapBuffer] = (void*)glad_glUnmapBuffer)) glad_glUnmapBuffer = trace_glUnmapBuffer;
+    if ((traceReal[TRACE_glGetBufferParameteriv] = (void*)glad_glGetBufferParameteriv)) glad_glGetBufferParameteriv = trace_glGetBufferParameteriv;
+    if ((traceReal[TRACE_glGetBufferPointerv] = (void*)glad_glGetBufferPointerv)) glad_glGetBufferPointerv = trace_glGetBufferPointerv;
+    if ((traceReal[TRACE_glBlendEquationSeparate] = (void*)glad_glBlendEquationSeparate)) glad_glBlendEquationSeparate = trace_glBlendEquationSeparate;
+    if ((traceReal[TRACE_glDrawBuffers] = (void*)glad_glDrawBuffers)) glad_glDrawBuffers = trace_glDrawBuffers;
+    if ((traceReal[TRACE_glStencilOpSeparate] = (void*)glad_glStencilOpSeparate)) glad_glStencilOpSeparate = trace_glStencilOpSeparate;
+    if ((traceReal[TRACE_glStencilFuncSeparate] = (void*)glad_glStencilFuncSeparate)) glad_glStencilFuncSeparate = trace_glStencilFuncSeparate;
+    if ((traceReal[TRACE_glStencilMaskSeparate] = (void*)glad_glStencilMaskSeparate)) glad_glStencilMaskSeparate = trace_glStencilMaskSeparate;
+    if ((traceReal[TRACE_glAttachShader] = (void*)glad_glAttachShader)) glad_glAttachShader = trace_glAttachShader;
+    if ((traceReal[TRACE_glBindAttribLocation] = (void*)glad_glBindAttribLocation)) glad_glBindAttribLocation = trace_glBindAttribLocation;
+    if ((traceReal[TRACE_glCompileShader] = (void*)glad_glCompileShader)) glad_glCompileShader = trace_glCompileShader;
+    if ((traceReal[TRACE_glCreateProgram] = (void*)glad_glCreateProgram)) glad_glCreateProgram = trace_glCreateProgram;
+    if ((traceReal[TRACE_glCreateShader] = (void*)glad_glCreateShader)) glad_glCreateShader = trace_glCreateShader;
+    if ((traceReal[TRACE_glDeleteProgram] = (void*)glad_glDeleteProgram)) glad_glDeleteProgram = trace_glDeleteProgram;
+    if ((traceReal[TRACE_glDeleteShader] = (void*)glad_glDeleteShader)) glad_glDeleteShader = trace_glDeleteShader;
+    if ((traceReal[TRACE_glDetachShader] = (void*)glad_glDetachShader)) glad_glDetachShader = trace_glDetachShader;
+    if ((traceReal[TRACE_glDisableVertexAttribArray] = (void*)glad_glDisableVertexAttribArray)) glad_glDisableVertexAttribArray = trace_glDisableVertexAttribArray;
+    if ((traceReal[TRACE_glEnableVertexAttribArray] = (void*)glad_glEnableVertexAttribArray)) glad_glEnableVertexAttribArray = trace_glEnableVertexAttribArray;
+    if ((traceReal[TRACE_glGetActiveAttrib] = (void*)glad_glGetActiveAttrib)) glad_glGetActiveAttrib = trace_glGetActiveAttrib;
+    if ((traceReal[TRACE_glGetActiveUniform] = (void*)glad_glGetActiveUniform)) glad_glGetActiveUniform = trace_glGetActiveUniform;
+    if ((traceReal[TRACE_glGetAttachedShaders] = (void*)glad_glGetAttachedShaders)) glad_glGetAttachedShaders = trace_glGetAttachedShaders;
+    if ((traceReal[TRACE_glGetAttribLocation] = (void*)glad_glGetAttribLocation)) glad_glGetAttribLocation = trace_glGetAttribLocation;
+    if ((traceReal[TRACE_glGetProgramiv] = (void*)glad_glGetProgramiv)) glad_glGetProgramiv = trace_glGetProgramiv;
+    if ((traceReal[TRACE_glGetProgramInfoLog] = (void*)glad_glGetProgramInfoLog)) glad_glGetProgramInfoLog = trace_glGetProgramInfoLog;
+    if ((traceReal[TRACE_glGetShaderiv] = (void*)glad_glGetShaderiv)) glad_glGetShaderiv = trace_glGetShaderiv;
+    if ((traceReal[TRACE_glGetShaderInfoLog] = (void*)glad_glGetShaderInfoLog)) glad_glGetShaderInfoLog = trace_glGetShaderInfoLog;
+    if ((traceReal[TRACE_glGetShaderSource] = (void*)glad_glGetShaderSource)) glad_glGetShaderSource = trace_glGetShaderSource;
+    if ((traceReal[TRACE_glGetUniformLocation] = (void*)glad_glGetUniformLocation)) glad_glGetUniformLocation = trace_glGetUniformLocation;
+    if ((traceReal[TRACE_glGetUniformfv] = (void*)glad_glGetUniformfv)) glad_glGetUniformfv = trace_glGetUniformfv;
+    if ((traceReal[TRACE_glGetUniformiv] = (void*)glad_glGetUniformiv)) glad_glGetUniformiv = trace_glGetUniformiv;
+    if ((traceReal[TRACE_glGetVertexAttribdv] = (void*)glad_glGetVertexAttribdv)) glad_glGetVertexAttribdv = trace_glGetVertexAttribdv;
+    if ((traceReal[TRACE_glGetVertexAttribfv] = (void*)glad_glGetVertexAttribfv)) glad_glGetVertexAttribfv = trace_glGetVertexAttribfv;
+    if ((traceReal[TRACE_glGetVertexAttribiv] = (void*)glad_glGetVertexAttribiv)) glad_glGetVertexAttribiv = trace_glGetVertexAttribiv;
+    if ((traceReal[TRACE_glGetVertexAttribPointerv] = (void*)glad_glGetVertexAttribPointerv)) glad_glGetVertexAttribPointerv = trace_glGetVertexAttribPointerv;
+    if ((traceReal[TRACE_glIsProgram] = (void*)glad_glIsProgram)) glad_glIsProgram = trace_glIsProgram;
+    if ((traceReal[TRACE_glIsShader] = (void*)glad_glIsShader)) glad_glIsShader = trace_glIsShader;
+    if ((traceReal[TRACE_glLinkProgram] = (void*)glad_glLinkProgram)) glad_glLinkProgram = trace_glLinkProgram;
+    if ((traceReal[TRACE_glShaderSource] = (void*)glad_glShaderSource)) glad_glShaderSource = trace_glShaderSource;
+    if ((traceReal[TRACE_glUseProgram] = (void*)glad_glUseProgram)) glad_glUseProgram = trace_glUseProgram;
+    if ((traceReal[TRACE_glUniform1f] = (void*)glad_glUniform1f)) glad_glUniform1f = trace_glUniform1f;
+    if ((traceReal[TRACE_glUniform2f] = (void*)glad_glUniform2f)) glad_glUniform2f = trace_glUniform2f;
+    if ((traceReal[TRACE_glUniform3f] = (void*)glad_glUniform3f)) glad_glUniform3f = trace_glUniform3f;
+    if ((traceReal[TRACE_glUniform4f] = (void*)glad_glUniform4f)) glad_glUniform4f = trace_glUniform4f;
+    if ((traceReal[TRACE_glUniform1i] = (void*)glad_glUniform1i)) glad_glUniform1i = trace_glUniform1i;
+    if ((traceReal[TRACE_glUniform2i] = (void*)glad_glUniform2i)) glad_glUniform2i = trace_glUniform2i;
+    if ((traceReal[TRACE_glUniform3i] = (void*)glad_glUniform3i)) glad_glUniform3i = trace_glUniform3i;
+    if ((traceReal[TRACE_glUniform4i] = (void*)glad_glUniform4i)) glad_glUniform4i = trace_glUniform4i;
+    if ((traceReal[TRACE_glUniform1fv] = (void*)glad_glUniform1fv)) glad_glUniform1fv = trace_glUniform1fv;
+    if ((traceReal[TRACE_glUniform2fv] = (void*)glad_glUniform2fv)) glad_glUniform2fv = trace_glUniform2fv;
+    if ((traceReal[TRACE_glUniform3fv] = (void*)glad_glUniform3fv)) glad_glUniform3fv = trace_glUniform3fv;
+    if ((traceReal[TRACE_glUniform4fv] = (void*)glad_glUniform4fv)) glad_glUniform4fv = trace_glUniform4fv;
+    if ((traceReal[TRACE_glUniform1iv] = (void*)glad_glUniform1iv)) glad_glUniform1iv = trace_glUniform1iv;
+    if ((traceReal[TRACE_glUniform2iv] = (void*)glad_glUniform2iv)) glad_glUniform2iv = trace_glUniform2iv;
+    if ((traceReal[TRACE_glUniform3iv] = (void*)glad_glUniform3iv)) glad_glUniform3iv = trace_glUniform3iv;
+    if ((traceReal[TRACE_glUniform4iv] = (void*)glad_glUniform4iv)) glad_glUniform4iv = trace_glUniform4iv;
+    if ((traceReal[TRACE_glUniformMatrix2fv] = (void*)glad_glUniformMatrix2fv)) glad_glUniformMatrix2fv = trace_glUniformMatrix2fv;
+    if ((traceReal[TRACE_glUniformMatrix3fv] = (void*)glad_glUniformMatrix3fv)) glad_glUniformMatrix3fv = trace_glUniformMatrix3fv;
+    if ((traceReal[TRACE_glUniformMatrix4fv] = (void*)glad_glUniformMatrix4fv)) glad_glUniformMatrix4fv = trace_glUniformMatrix4fv;
+    if ((traceReal[TRACE_glValidateProgram] = (void*)glad_glValidateProgram)) glad_glValidateProgram = trace_glValidateProgram;
+    if ((traceReal[TRACE_glVertexAttrib1d] = (void*)glad_glVertexAttrib1d)) glad_glVertexAttrib1d = trace_glVertexAttrib1d;
+    if ((traceReal[TRACE_glVertexAttrib1dv] = (void*)glad_glVertexAttrib1dv)) glad_glVertexAttrib1dv = trace_glVertexAttrib1dv;
+    if ((traceReal[TRACE_glVertexAttrib1f] = (void*)glad_glVertexAttrib1f)) glad_glVertexAttrib1f = trace_glVertexAttrib1f;
+    if ((traceReal[TRACE_glVertexAttrib1fv] = (void*)glad_glVertexAttrib1fv)) glad_glVertexAttrib1fv = trace_glVertexAttrib1fv;
+    if ((traceReal[TRACE_glVertexAttrib1s] = (void*)glad_glVertexAttrib1s)) glad_glVertexAttrib1s = trace_glVertexAttrib1s;
+    if ((traceReal[TRACE_glVertexAttrib1sv] = (void*)glad_glVertexAttrib1sv)) glad_glVertexAttrib1sv = trace_glVertexAttrib1sv;
+    if ((traceReal[TRACE_glVertexAttrib2d] = (void*)glad_glVertexAttrib2d)) glad_glVertexAttrib2d = trace_glVertexAttrib2d;
+    if ((traceReal[TRACE_glVertexAttrib2dv] = (void*)glad_glVertexAttrib2dv)) glad_glVertexAttrib2dv = trace_glVertexAttrib2dv;
+    if ((traceReal[TRACE_glVertexAttrib2f] = (void*)glad_glVertexAttrib2f)) glad_glVertexAttrib2f = trace_glVertexAttrib2f;
+    if ((traceReal[TRACE_glVertexAttrib2fv] = (void*)glad_glVertexAttrib2fv)) glad_glVertexAttrib2fv = trace_glVertexAttrib2fv;
+    if ((traceReal[TRACE_glVertexAttrib2s] = (void*)glad_glVertexAttrib2s)) glad_glVertexAttrib2s = trace_glVertexAttrib2s;
+    if ((traceReal[TRACE_glVertexAttrib2sv] = (void*)glad_glVertexAttrib2sv)) glad_glVertexAttrib2sv = trace_glVertexAttrib2sv;
+    if ((traceReal[TRACE_glVertexAttrib3d] = (void*)glad_glVertexAttrib3d)) glad_glVertexAttrib3d = trace_glVertexAttrib3d;
+    if ((traceReal[TRACE_glVertexAttrib3dv] = (void*)glad_glVertexAttrib3dv)) glad_glVertexAttrib3dv = trace_glVertexAttrib3dv;
+    if ((traceReal[TRACE_glVertexAttrib3f] = (void*)glad_glVertexAttrib3f)) glad_glVertexAttrib3f = trace_glVertexAttrib3f;
+    if ((traceReal[TRACE_glVertexAttrib3fv] = (void*)glad_glVertexAttrib3fv)) glad_glVertexAttrib3fv = trace_glVertexAttrib3fv;
+    if ((traceReal[TRACE_glVertexAttrib3s] = (void*)glad_glVertexAttrib3s)) glad_glVertexAttrib3s = trace_glVertexAttrib3s;
+    if ((traceReal[TRACE_glVertexAttrib3sv] = (void*)glad_glVertexAttrib3sv)) glad_glVertexAttrib3sv = trace_glVertexAttrib3sv;
+    if ((traceReal[TRACE_glVertexAttrib4Nbv] = (void*)glad_glVertexAttrib4Nbv)) glad_glVertexAttrib4Nbv = trace_glVertexAttrib4Nbv;
+    if ((traceReal[TRACE_glVertexAttrib4Niv] = (void*)glad_glVertexAttrib4Niv)) glad_glVertexAttrib4Niv = trace_glVertexAttrib4Niv;
+    if ((traceReal[TRACE_glVertexAttrib4Nsv] = (void*)glad_glVertexAttrib4Nsv)) glad_glVertexAttrib4Nsv = trace_glVertexAttrib4Nsv;
+    if ((traceReal[TRACE_glVertexAttrib4Nub] = (void*)glad_glVertexAttrib4Nub)) glad_glVertexAttrib4Nub = trace_glVertexAttrib4Nub;
+    if ((traceReal[TRACE_glVertexAttrib4Nubv] = (void*)glad_glVertexAttrib4Nubv)) glad_glVertexAttrib4Nubv = trace_glVertexAttrib4Nubv;
+    if ((traceReal[TRACE_glVertexAttrib4Nuiv] = (void*)glad_glVertexAttrib4Nuiv)) glad_glVertexAttrib4Nuiv = trace_glVertexAttrib4Nuiv;
+    if ((traceReal[TRACE_glVertexAttrib4Nusv] = (void*)glad_glVertexAttrib4Nusv)) glad_glVertexAttrib4Nusv = trace_glVertexAttrib4Nusv;
+    if ((traceReal[TRACE_glVertexAttrib4bv] = (void*)glad_glVertexAttrib4bv)) glad_glVertexAttrib4bv = trace_glVertexAttrib4bv;
+    if ((traceReal[TRACE_glVertexAttrib4d] = (void*)glad_glVertexAttrib4d)) glad_glVertexAttrib4d = trace_glVertexAttrib4d;
+    if ((traceReal[TRACE_glVertexAttrib4dv] = (void*)glad_glVertexAttrib4dv)) glad_glVertexAttrib4dv = trace_glVertexAttrib4dv;
+    if ((traceReal[TRACE_glVertexAttrib4f] = (void*)glad_glVertexAttrib4f)) glad_glVertexAttrib4f = trace_glVertexAttrib4f;
+    if ((traceReal[TRACE_glVertexAttrib4fv] = (void*)glad_glVertexAttrib4fv)) glad_glVertexAttrib4fv = trace_glVertexAttrib4fv;
+    if ((traceReal[TRACE_glVertexAttrib4iv] = (void*)glad_glVertexAttrib4iv)) glad_glVertexAttrib4iv = trace_glVertexAttrib4iv;
+    if ((traceReal[TRACE_glVertexAttrib4s] = (void*)glad_glVertexAttrib4s)) glad_glVertexAttrib4s = trace_glVertexAttrib4s;
+    if ((traceReal[TRACE_glVertexAttrib4sv] = (void*)glad_glVertexAttrib4sv)) glad_glVertexAttrib4sv = trace_glVertexAttrib4sv;
+    if ((traceReal[TRACE_glVertexAttrib4ubv] = (void*)glad_glVertexAttrib4ubv)) glad_glVertexAttrib4ubv = trace_glVertexAttrib4ubv;
+    if ((traceReal[TRACE_glVertexAttrib4uiv] = (void*)glad_glVertexAttrib4uiv)) glad_glVertexAttrib4uiv = trace_glVertexAttrib4uiv;
+    if ((traceReal[TRACE_glVertexAttrib4usv] = (void*)glad_glVertexAttrib4usv)) glad_glVertexAttrib4usv = trace_glVertexAttrib4usv;
+    if ((traceReal[TRACE_glVertexAttribPointer] = (void*)glad_glVertexAttribPointer)) glad_glVertexAttribPointer = trace_glVertexAttribPointer;
+    if ((traceReal[TRACE_glUniformMatrix2x3fv] = (void*)glad_glUniformMatrix2x3fv)) glad_glUniformMatrix2x3fv = trace_glUniformMatrix2x3fv;
+    if ((traceReal[TRACE_glUniformMatrix3x2fv] = (void*)glad_glUniformMatrix3x2fv)) glad_glUniformMatrix3x2fv = trace_glUniformMatrix3x2fv;
+    if ((traceReal[TRACE_glUniformMatrix2x4fv] = (void*)glad_glUniformMatrix2x4fv)) glad_glUniformMatrix2x4fv = trace_glUniformMatrix2x4fv;
+    if ((traceReal[TRACE_glUniformMatrix4x2fv] = (void*)glad_glUniformMatrix4x2fv)) glad_glUniformMatrix4x2fv = trace_glUniformMatrix4x2fv;
+    if ((traceReal[TRACE_glUniformMatrix3x4fv] = (void*)glad_glUniformMatrix3x4fv)) glad_glUniformMatrix3x4fv = trace_glUniformMatrix3x4fv;
+    if ((traceReal[TRACE_glUniformMatrix4x3fv] = (void*)glad_glUniformMatrix4x3fv)) glad_glUniformMatrix4x3fv = trace_glUniformMatrix4x3fv;
+    if ((traceReal[TRACE_glColorMaski] = (void*)glad_glColorMaski)) glad_glColorMaski = trace_glColorMaski;
+    if ((traceReal[TRACE_glGetBooleani_v] = (void*)glad_glGetBooleani_v)) glad_glGetBooleani_v = trace_glGetBooleani_v;
+    if ((traceReal[TRACE_glGetIntegeri_v] = (void*)glad_glGetIntegeri_v)) glad_glGetIntegeri_v = trace_glGetIntegeri_v;
+    if ((traceReal[TRACE_glEnablei] = (void*)glad_glEnablei)) glad_glEnablei = trace_glEnablei;
+    if ((traceReal[TRACE_glDisablei] = (void*)glad_glDisablei)) glad_glDisablei = trace_glDisablei;
+    if ((traceReal[TRACE_glIsEnabledi] = (void*)glad_glIsEnabledi)) glad_glIsEnabledi = trace_glIsEnabledi;
+    if ((traceReal[TRACE_glBeginTransformFeedback] = (void*)glad_glBeginTransformFeedback)) glad_glBeginTransformFeedback = trace_glBeginTransformFeedback;
+    if ((traceReal[TRACE_glEndTransformFeedback] = (void*)glad_glEndTransformFeedback)) glad_glEndTransformFeedback = trace_glEndTransformFeedback;
+    if ((traceReal[TRACE_glBindBufferRange] = (void*)glad_glBindBufferRange)) glad_glBindBufferRange = trace_glBindBufferRange;
+    if ((traceReal[TRACE_glBindBufferBase] = (void*)glad_glBindBufferBase)) glad_glBindBufferBase = trace_glBindBufferBase;
+    if ((traceReal[TRACE_glTransformFeedbackVaryings] = (void*)glad_glTransformFeedbackVaryings)) glad_glTransformFeedbackVaryings = trace_glTransformFeedbackVaryings;
+    if ((traceReal[TRACE_glGetTransformFeedbackVarying] = (void*)glad_glGetTransformFeedbackVarying)) glad_glGetTransformFeedbackVarying = trace_glGetTransformFeedbackVarying;
+    if ((traceReal[TRACE_glClampColor] = (void*)glad_glClampColor)) glad_glClampColor = trace_glClampColor;
+    if ((traceReal[TRACE_glBeginConditionalRender] = (void*)glad_glBeginConditionalRender)) glad_glBeginConditionalRender = trace_glBeginConditionalRender;
+    if ((traceReal[TRACE_glEndConditionalRender] = (void*)glad_glEndConditionalRender)) glad_glEndConditionalRender = trace_glEndConditionalRender;
+    if ((traceReal[TRACE_glVertexAttribIPointer] = (void*)glad_glVertexAttribIPointer)) glad_glVertexAttribIPointer = trace_glVertexAttribIPointer;
+    if ((traceReal[TRACE_glGetVertexAttribIiv] = (void*)glad_glGetVertexAttribIiv)) glad_glGetVertexAttribIiv = trace_glGetVertexAttribIiv;
+    if ((traceReal[TRACE_glGetVertexAttribIuiv] = (void*)glad_glGetVertexAttribIuiv)) glad_glGetVertexAttribIuiv = trace_glGetVertexAttribIuiv;
+    if ((traceReal[TRACE_glVertexAttribI1i] = (void*)glad_glVertexAttribI1i)) glad_glVertexAttribI1i = trace_glVertexAttribI1i;
+    if ((traceReal[TRACE_glVertexAttribI2i] = (void*)glad_glVertexAttribI2i)) glad_glVertexAttribI2i = trace_glVertexAttribI2i;
+    if ((traceReal[TRACE_glVertexAttribI3i] = (void*)glad_glVertexAttribI3i)) glad_glVertexAttribI3i = trace_glVertexAttribI3i;
+    if ((traceReal[TRACE_glVertexAttribI4i] = (void*)glad_glVertexAttribI4i)) glad_glVertexAttribI4i = trace_glVertexAttribI4i;
+    if ((traceReal[TRACE_glVertexAttribI1ui] = (void*)glad_glVertexAttribI1ui)) glad_glVertexAttribI1ui = trace_glVertexAttribI1ui;
+    if ((traceReal[TRACE_glVertexAttribI2ui] = (void*)glad_glVertexAttribI2ui)) glad_glVertexAttribI2ui = trace_glVertexAttribI2ui;
+    if ((traceReal[TRACE_glVertexAttribI3ui] = (void*)glad_glVertexAttribI3ui)) glad_glVertexAttribI3ui = trace_glVertexAttribI3ui;
+    if ((traceReal[TRACE_glVertexAttribI4ui] = (void*)glad_glVertexAttribI4ui)) glad_glVertexAttribI4ui = trace_glVertexAttribI4ui;
+    if ((traceReal[TRACE_glVertexAttribI1iv] = (void*)glad_glVertexAttribI1iv)) glad_glVertexAttribI1iv = trace_glVertexAttribI1iv;
+    if ((traceReal[TRACE_glVertexAttribI2iv] = (void*)glad_glVertexAttribI2iv)) glad_glVertexAttribI2iv = trace_glVertexAttribI2iv;
+    if ((traceReal[TRACE_glVertexAttribI3iv] = (void*)glad_glVertexAttribI3iv)) glad_glVertexAttribI3iv = trace_glVertexAttribI3iv;
+    if ((traceReal[TRACE_glVertexAttribI4iv] = (void*)glad_glVertexAttribI4iv)) glad_glVertexAttribI4iv = trace_glVertexAttribI4iv;
+    if ((traceReal[TRACE_glVertexAttribI1uiv] = (void*)glad_glVertexAttribI1uiv)) glad_glVertexAttribI1uiv = trace_glVertexAttribI1uiv;
+    if ((traceReal[TRACE_glVertexAttribI2uiv] = (void*)glad_glVertexAttribI2uiv)) glad_glVertexAttribI2uiv = trace_glVertexAttribI2uiv;
+    if ((traceReal[TRACE_glVertexAttribI3uiv] = (void*)glad_glVertexAttribI3uiv)) glad_glVertexAttribI3uiv = trace_glVertexAttribI3uiv;
+    if ((traceReal[TRACE_glVertexAttribI4uiv] = (void*)glad_glVertexAttribI4uiv)) glad_glVertexAttribI4uiv = trace_glVertexAttribI4uiv;
+    if ((traceReal[TRACE_glVertexAttribI4bv] = (void*)glad_glVertexAttribI4bv)) glad_glVertexAttribI4bv = trace_glVertexAttribI4bv;
+    if ((traceReal[TRACE_glVertexAttribI4sv] = (void*)glad_glVertexAttribI4sv)) glad_glVertexAttribI4sv = trace_glVertexAttribI4sv;
+    if ((traceReal[TRACE_glVertexAttribI4ubv] = (void*)glad_glVertexAttribI4ubv)) glad_glVertexAttribI4ubv = trace_glVertexAttribI4ubv;
+    if ((traceReal[TRACE_glVertexAttribI4usv] = (void*)glad_glVertexAttribI4usv)) glad_glVertexAttribI4usv = trace_glVertexAttribI4usv;
+    if ((traceReal[TRACE_glGetUniformuiv] = (void*)glad_glGetUniformuiv)) glad_glGetUniformuiv = trace_glGetUniformuiv;
+    if ((traceReal[TRACE_glBindFragDataLocation] = (void*)glad_glBindFragDataLocation)) glad_glBindFragDataLocation = trace_glBindFragDataLocation;
+    if ((traceReal[TRACE_glGetFragDataLocation] = (void*)glad_glGetFragDataLocation)) glad_glGetFragDataLocation = trace_glGetFragDataLocation;
+    if ((traceReal[TRACE_glUniform1ui] = (void*)glad_glUniform1ui)) glad_glUniform1ui = trace_glUniform1ui;
+    if ((traceReal[TRACE_glUniform2ui] = (void*)glad_glUniform2ui)) glad_glUniform2ui = trace_glUniform2ui;
+    if ((traceReal[TRACE_glUniform3ui] = (void*)glad_glUniform3ui)) glad_glUniform3ui = trace_glUniform3ui;
+    if ((traceReal[TRACE_glUniform4ui] = (void*)glad_glUniform4ui)) glad_glUniform4ui = trace_glUniform4ui;
+    if ((traceReal[TRACE_glUniform1uiv] = (void*)glad_glUniform1uiv)) glad_glUniform1uiv = trace_glUniform1uiv;
+    if ((traceReal[TRACE_glUniform2uiv] = (void*)glad_glUniform2uiv)) glad_glUniform2uiv = trace_glUniform2uiv;
+    if ((traceReal[TRACE_glUniform3uiv] = (void*)glad_glUniform3uiv)) glad_glUniform3uiv = trace_glUniform3uiv;
+    if ((traceReal[TRACE_glUniform4uiv] = (void*)glad_glUniform4uiv)) glad_glUniform4uiv = trace_glUniform4uiv;
+    if ((traceReal[TRACE_glTexParameterIiv] = (void*)glad_glTexParameterIiv)) glad_glTexParameterIiv = trace_glTexParameterIiv;
+    if ((traceReal[TRACE_glTexParameterIuiv] = (void*)glad_glTexParameterIuiv)) glad_glTexParameterIuiv = trace_glTexParameterIuiv;
+    if ((traceReal[TRACE_glGetTexParameterIiv] = (void*)glad_glGetTexParameterIiv)) glad_glGetTexParameterIiv = trace_glGetTexParameterIiv;
+    if ((traceReal[TRACE_glGetTexParameterIuiv] = (void*)glad_glGetTexParameterIuiv)) glad_glGetTexParameterIuiv = trace_glGetTexParameterIuiv;
+    if ((traceReal[TRACE_glClearBufferiv] = (void*)glad_glClearBufferiv)) glad_glClearBufferiv = trace_glClearBufferiv;
+    if ((traceReal[TRACE_glClearBufferuiv] = (void*)glad_glClearBufferuiv)) glad_glClearBufferuiv = trace_glClearBufferuiv;
+    if ((traceReal[TRACE_glClearBufferfv] = (void*)glad_glClearBufferfv)) glad_glClearBufferfv = trace_glClearBufferfv;
+    if ((traceReal[TRACE_glClearBufferfi] = (void*)glad_glClearBufferfi)) glad_glClearBufferfi = trace_glClearBufferfi;
+    if ((traceReal[TRACE_glGetStringi] = (void*)glad_glGetStringi)) glad_glGetStringi = trace_glGetStringi;
+    if ((traceReal[TRACE_glIsRenderbuffer] = (void*)glad_glIsRenderbuffer)) glad_glIsRenderbuffer = trace_glIsRenderbuffer;
+    if ((traceReal[TRACE_glBindRenderbuffer] = (void*)glad_glBindRenderbuffer)) glad_glBindRenderbuffer = trace_glBindRenderbuffer;
+    if ((traceReal[TRACE_glDeleteRenderbuffers] = (void*)glad_glDeleteRenderbuffers)) glad_glDeleteRenderbuffers = trace_glDeleteRenderbuffers;
+    if ((traceReal[TRACE_glGenRenderbuffers] = (void*)glad_glGenRenderbuffers)) glad_glGenRenderbuffers = trace_glGenRenderbuffers;
+    if ((traceReal[TRACE_glRenderbufferStorage] = (void*)glad_glRenderbufferStorage)) glad_glRenderbufferStorage = trace_glRenderbufferStorage;
+    if ((traceReal[TRACE_glGetRenderbufferParameteriv] = (void*)glad_glGetRenderbufferParameteriv)) glad_glGetRenderbufferParameteriv = trace_glGetRenderbufferParameteriv;
+    if ((traceReal[TRACE_glIsFramebuffer] = (void*)glad_glIsFramebuffer)) glad_glIsFramebuffer = trace_glIsFramebuffer;
+    if ((traceReal[TRACE_glBindFramebuffer] = (void*)glad_glBindFramebuffer)) glad_glBindFramebuffer = trace_glBindFramebuffer;
+    if ((traceReal[TRACE_glDeleteFramebuffers] = (void*)glad_glDeleteFramebuffers)) glad_glDeleteFramebuffers = trace_glDeleteFramebuffers;
+    if ((traceReal[TRACE_glGenFramebuffers] = (void*)glad_glGenFramebuffers)) glad_glGenFramebuffers = trace_glGenFramebuffers;
+    if ((traceReal[TRACE_glCheckFramebufferStatus] = (void*)glad_glCheckFramebufferStatus)) glad_glCheckFramebufferStatus = trace_glCheckFramebufferStatus;
+    if ((traceReal[TRACE_glFramebufferTexture1D] = (void*)glad_glFramebufferTexture1D)) glad_glFramebufferTexture1D = trace_glFramebufferTexture1D;
+    if ((traceReal[TRACE_glFramebufferTexture2D] = (void*)glad_glFramebufferTexture2D)) glad_glFramebufferTexture2D = trace_glFramebufferTexture2D;
+    if ((traceReal[TRACE_glFramebufferTexture3D] = (void*)glad_glFramebufferTexture3D)) glad_glFramebufferTexture3D = trace_glFramebufferTexture3D;
+    if ((traceReal[TRACE_glFramebufferRenderbuffer] = (void*)glad_glFramebufferRenderbuffer)) glad_glFramebufferRenderbuffer = trace_glFramebufferRenderbuffer;
+    if ((traceReal[TRACE_glGetFramebufferAttachmentParameteriv] = (void*)glad_glGetFramebufferAttachmentParameteriv)) glad_glGetFramebufferAttachmentParameteriv = trace_glGetFramebufferAttachmentParameteriv;
+    if ((traceReal[TRACE_glGenerateMipmap] = (void*)glad_glGenerateMipmap)) glad_glGenerateMipmap = trace_glGenerateMipmap;
+    if ((traceReal[TRACE_glBlitFramebuffer] = (void*)glad_glBlitFramebuffer)) glad_glBlitFramebuffer = trace_glBlitFramebuffer;
+    if ((traceReal[TRACE_glRenderbufferStorageMultisample] = (void*)glad_glRenderbufferStorageMultisample)) glad_glRenderbufferStorageMultisample = trace_glRenderbufferStorageMultisample;
+    if ((traceReal[TRACE_glFramebufferTextureLayer] = (void*)glad_glFramebufferTextureLayer)) glad_glFramebufferTextureLayer = trace_glFramebufferTextureLayer;
+    if ((traceReal[TRACE_glMapBufferRange] = (void*)glad_glMapBufferRange)) glad_glMapBufferRange = trace_glMapBufferRange;
+    if ((traceReal[TRACE_glFlushMappedBufferRange] = (void*)glad_glFlushMappedBufferRange)) glad_glFlushMappedBufferRange = trace_glFlushMappedBufferRange;
+    if ((traceReal[TRACE_glBindVertexArray] = (void*)glad_glBindVertexArray)) glad_glBindVertexArray = trace_glBindVertexArray;
+    if ((traceReal[TRACE_glDeleteVertexArrays] = (void*)glad_glDeleteVertexArrays)) glad_glDeleteVertexArrays = trace_glDeleteVertexArrays;
+    if ((traceReal[TRACE_glGenVertexArrays] = (void*)glad_glGenVertexArrays)) glad_glGenVertexArrays = trace_glGenVertexArrays;
+    if ((traceReal[TRACE_glIsVertexArray] = (void*)glad_glIsVertexArray)) glad_glIsVertexArray = trace_glIsVertexArray;
+    if ((traceReal[TRACE_glDrawArraysInstanced] = (void*)glad_glDrawArraysInstanced)) glad_glDrawArraysInstanced = trace_glDrawArraysInstanced;
+    if ((traceReal[TRACE_glDrawElementsInstanced] = (void*)glad_glDrawElementsInstanced)) glad_glDrawElementsInstanced = trace_glDrawElementsInstanced;
+    if ((traceReal[TRACE_glTexBuffer] = (void*)glad_glTexBuffer)) glad_glTexBuffer = trace_glTexBuffer;
+    if ((traceReal[TRACE_glPrimitiveRestartIndex] = (void*)glad_glPrimitiveRestartIndex)) glad_glPrimitiveRestartIndex = trace_glPrimitiveRestartIndex;
+    if ((traceReal[TRACE_glCopyBufferSubData] = (void*)glad_glCopyBufferSubData)) glad_glCopyBufferSubData = trace_glCopyBufferSubData;
+    if ((traceReal[TRACE_glGetUniformIndices] = (void*)glad_glGetUniformIndices)) glad_glGetUniformIndices = trace_glGetUniformIndices;
+    if ((traceReal[TRACE_glGetActiveUniformsiv] = (void*)glad_glGetActiveUniformsiv)) glad_glGetActiveUniformsiv = trace_glGetActiveUniformsiv;
+    if ((traceReal[TRACE_glGetActiveUniformName] = (void*)glad_glGetActiveUniformName)) glad_glGetActiveUniformName = trace_glGetActiveUniformName;
+    if ((traceReal[TRACE_glGetUniformBlockIndex] = (void*)glad_glGetUniformBlockIndex)) glad_glGetUniformBlockIndex = trace_glGetUniformBlockIndex;
+    if ((traceReal[TRACE_glGetActiveUniformBlockiv] = (void*)glad_glGetActiveUniformBlockiv)) glad_glGetActiveUniformBlockiv = trace_glGetActiveUniformBlockiv;
+    if ((traceReal[TRACE_glGetActiveUniformBlockName] = (void*)glad_glGetActiveUniformBlockName)) glad_glGetActiveUniformBlockName = trace_glGetActiveUniformBlockName;
+    if ((traceReal[TRACE_glUniformBlockBinding] = (void*)glad_glUniformBlockBinding)) glad_glUniformBlockBinding = trace_glUniformBlockBinding;
+    if ((traceReal[TRACE_glDrawElementsBaseVertex] = (void*)glad_glDrawElementsBaseVertex)) glad_glDrawElementsBaseVertex = trace_glDrawElementsBaseVertex;
+    if ((traceReal[TRACE_glDrawRangeElementsBaseVertex] = (void*)glad_glDrawRangeElementsBaseVertex)) glad_glDrawRangeElementsBaseVertex = trace_glDrawRangeElementsBaseVertex;
+    if ((traceReal[TRACE_glDrawElementsInstancedBaseVertex] = (void*)glad_glDrawElementsInstancedBaseVertex)) glad_glDrawElementsInstancedBaseVertex = trace_glDrawElementsInstancedBaseVertex;
+    if ((traceReal[TRACE_glMultiDrawElementsBaseVertex] = (void*)glad_glMultiDrawElementsBaseVertex)) glad_glMultiDrawElementsBaseVertex = trace_glMultiDrawElementsBaseVertex;
+    if ((traceReal[TRACE_glProvokingVertex] = (void*)glad_glProvokingVertex)) glad_glProvokingVertex = trace_glProvokingVertex;
+    if ((traceReal[TRACE_glFenceSync] = (void*)glad_glFenceSync)) glad_glFenceSync = trace_glFenceSync;
+    if ((traceReal[TRACE_glIsSync] = (void*)glad_glIsSync)) glad_glIsSync = trace_glIsSync;
+    if ((traceReal[TRACE_glDeleteSync] = (void*)glad_glDeleteSync)) glad_glDeleteSync = trace_glDeleteSync;
+    if ((traceReal[TRACE_glClientWaitSync] = (void*)glad_glClientWaitSync)) glad_glClientWaitSync = trace_glClientWaitSync;
+    if ((traceReal[TRACE_glWaitSync] = (void*)glad_glWaitSync)) glad_glWaitSync = trace_glWaitSync;
+    if ((traceReal[TRACE_glGetInteger64v] = (void*)glad_glGetInteger64v)) glad_glGetInteger64v = trace_glGetInteger64v;
+    if ((traceReal[TRACE_glGetSynciv] = (void*)glad_glGetSynciv)) glad_glGetSynciv = trace_glGetSynciv;
+    if ((traceReal[TRACE_glGetInteger64i_v] = (void*)glad_glGetInteger64i_v)) glad_glGetInteger64i_v = trace_glGetInteger64i_v;
+    if ((traceReal[TRACE_glGetBufferParameteri64v] = (void*)glad_glGetBufferParameteri64v)) glad_glGetBufferParameteri64v = trace_glGetBufferParameteri64v;
+    if ((traceReal[TRACE_glFramebufferTexture] = (void*)glad_glFramebufferTexture)) glad_glFramebufferTexture = trace_glFramebufferTexture;
+    if ((traceReal[TRACE_glTexImage2DMultisample] = (void*)glad_glTexImage2DMultisample)) glad_glTexImage2DMultisample = trace_glTexImage2DMultisample;
+    if ((traceReal[TRACE_glTexImage3DMultisample] = (void*)glad_glTexImage3DMultisample)) glad_glTexImage3DMultisample = trace_glTexImage3DMultisample;
+    if ((traceReal[TRACE_glGetMultisamplefv] = (void*)glad_glGetMultisamplefv)) glad_glGetMultisamplefv = trace_glGetMultisamplefv;
+    if ((traceReal[TRACE_glSampleMaski] = (void*)glad_glSampleMaski)) glad_glSampleMaski = trace_glSampleMaski;
+    if ((traceReal[TRACE_glBindFragDataLocationIndexed] = (void*)glad_glBindFragDataLocationIndexed)) glad_glBindFragDataLocationIndexed = trace_glBindFragDataLocationIndexed;
+    if ((traceReal[TRACE_glGetFragDataIndex] = (void*)glad_glGetFragDataIndex)) glad_glGetFragDataIndex = trace_glGetFragDataIndex;
+    if ((traceReal[TRACE_glGenSamplers] = (void*)glad_glGenSamplers)) glad_glGenSamplers = trace_glGenSamplers;
+    if ((traceReal[TRACE_glDeleteSamplers] = (void*)glad_glDeleteSamplers)) glad_glDeleteSamplers = trace_glDeleteSamplers;
+    if ((traceReal[TRACE_glIsSampler] = (void*)glad_glIsSampler)) glad_glIsSampler = trace_glIsSampler;
+    if ((traceReal[TRACE_glBindSampler] = (void*)glad_glBindSampler)) glad_glBindSampler = trace_glBindSampler;
+    if ((traceReal[TRACE_glSamplerParameteri] = (void*)glad_glSamplerParameteri)) glad_glSamplerParameteri = trace_glSamplerParameteri;
+    if ((traceReal[TRACE_glSamplerParameteriv] = (void*)glad_glSamplerParameteriv)) glad_glSamplerParameteriv = trace_glSamplerParameteriv;
+    if ((traceReal[TRACE_glSamplerParameterf] = (void*)glad_glSamplerParameterf)) glad_glSamplerParameterf = trace_glSamplerParameterf;
+    if ((traceReal[TRACE_glSamplerParameterfv] = (void*)glad_glSamplerParameterfv)) glad_glSamplerParameterfv = trace_glSamplerParameterfv;
+    if ((traceReal[TRACE_glSamplerParameterIiv] = (void*)glad_glSamplerParameterIiv)) glad_glSamplerParameterIiv = trace_glSamplerParameterIiv;
+    if ((traceReal[TRACE_glSamplerParameterIuiv] = (void*)glad_glSamplerParameterIuiv)) glad_glSamplerParameterIuiv = trace_glSamplerParameterIuiv;
+    if ((traceReal[TRACE_glGetSamplerParameteriv] = (void*)glad_glGetSamplerParameteriv)) glad_glGetSamplerParameteriv = trace_glGetSamplerParameteriv;
+    if ((traceReal[TRACE_glGetSamplerParameterIiv] = (void*)glad_glGetSamplerParameterIiv)) glad_glGetSamplerParameterIiv = trace_glGetSamplerParameterIiv;
+    if ((traceReal[TRACE_glGetSamplerParameterfv] = (void*)glad_glGetSamplerParameterfv)) glad_glGetSamplerParameterfv = trace_glGetSamplerParameterfv;
+    if ((traceReal[TRACE_glGetSamplerParameterIuiv] = (void*)glad_glGetSamplerParameterIuiv)) glad_glGetSamplerParameterIuiv = trace_glGetSamplerParameterIuiv;
+    if ((traceReal[TRACE_glQueryCounter] = (void*)glad_glQueryCounter)) glad_glQueryCounter = trace_glQueryCounter;
+    if ((traceReal[TRACE_glGetQueryObjecti64v] = (void*)glad_glGetQueryObjecti64v)) glad_glGetQueryObjecti64v = trace_glGetQueryObjecti64v;
+    if ((traceReal[TRACE_glGetQueryObjectui64v] = (void*)glad_glGetQueryObjectui64v)) glad_glGetQueryObjectui64v = trace_glGetQueryObjectui64v;
+    if ((traceReal[TRACE_glVertexAttribDivisor] = (void*)glad_glVertexAttribDivisor)) glad_glVertexAttribDivisor = trace_glVertexAttribDivisor;
+    if ((traceReal[TRACE_glVertexAttribP1ui] = (void*)glad_glVertexAttribP1ui)) glad_glVertexAttribP1ui = trace_glVertexAttribP1ui;
+    if ((traceReal[TRACE_glVertexAttribP1uiv] = (void*)glad_glVertexAttribP1uiv)) glad_glVertexAttribP1uiv = trace_glVertexAttribP1uiv;
+    if ((traceReal[TRACE_glVertexAttribP2ui] = (void*)glad_glVertexAttribP2ui)) glad_glVertexAttribP2ui = trace_glVertexAttribP2ui;
+    if ((traceReal[TRACE_glVertexAttribP2uiv] = (void*)glad_glVertexAttribP2uiv)) glad_glVertexAttribP2uiv = trace_glVertexAttribP2uiv;
+    if ((traceReal[TRACE_glVertexAttribP3ui] = (void*)glad_glVertexAttribP3ui)) glad_glVertexAttribP3ui = trace_glVertexAttribP3ui;
+    if ((traceReal[TRACE_glVertexAttribP3uiv] = (void*)glad_glVertexAttribP3uiv)) glad_glVertexAttribP3uiv = trace_glVertexAttribP3uiv;
+    if ((traceReal[TRACE_glVertexAttribP4ui] = (void*)glad_glVertexAttribP4ui)) glad_glVertexAttribP4ui = trace_glVertexAttribP4ui;
+    if ((traceReal[TRACE_glVertexAttribP4uiv] = (void*)glad_glVertexAttribP4uiv)) glad_glVertexAttribP4uiv = trace_glVertexAttribP4uiv;
+    if ((traceReal[TRACE_glVertexP2ui] = (void*)glad_glVertexP2ui)) glad_glVertexP2ui = trace_glVertexP2ui;
+    if ((traceReal[TRACE_glVertexP2uiv] = (void*)glad_glVertexP2uiv)) glad_glVertexP2uiv = trace_glVertexP2uiv;
+    if ((traceReal[TRACE_glVertexP3ui] = (void*)glad_glVertexP3ui)) glad_glVertexP3ui = trace_glVertexP3ui;
+    if ((traceReal[TRACE_glVertexP3uiv] = (void*)glad_glVertexP3uiv)) glad_glVertexP3uiv = trace_glVertexP3uiv;
+    if ((traceReal[TRACE_glVertexP4ui] = (void*)glad_glVertexP4ui)) glad_glVertexP4ui = trace_glVertexP4ui;
+    if ((traceReal[TRACE_glVertexP4uiv] = (void*)glad_glVertexP4uiv)) glad_glVertexP4uiv = trace_glVertexP4uiv;
+    if ((traceReal[TRACE_glTexCoordP1ui] = (void*)glad_glTexCoordP1ui)) glad_glTexCoordP1ui = trace_glTexCoordP1ui;
+    if ((traceReal[TRACE_glTexCoordP1uiv] = (void*)glad_glTexCoordP1uiv)) glad_glTexCoordP1uiv = trace_glTexCoordP1uiv;
+    if ((traceReal[TRACE_glTexCoordP2ui] = (void*)glad_glTexCoordP2ui)) glad_glTexCoordP2ui = trace_glTexCoordP2ui;
+    if ((traceReal[TRACE_glTexCoordP2uiv] = (void*)glad_glTexCoordP2uiv)) glad_glTexCoordP2uiv = trace_glTexCoordP2uiv;
+    if ((traceReal[TRACE_glTexCoordP3ui] = (void*)glad_glTexCoordP3ui)) glad_glTexCoordP3ui = trace_glTexCoordP3ui;
+    if ((traceReal[TRACE_glTexCoordP3uiv] = (void*)glad_glTexCoordP3uiv)) glad_glTexCoordP3uiv = trace_glTexCoordP3uiv;
+    if ((traceReal[TRACE_glTexCoordP4ui] = (void*)glad_glTexCoordP4ui)) glad_glTexCoordP4ui = trace_glTexCoordP4ui;
+    if ((traceReal[TRACE_glTexCoordP4uiv] = (void*)glad_glTexCoordP4uiv)) glad_glTexCoordP4uiv = trace_glTexCoordP4uiv;
+    if ((traceReal[TRACE_glMultiTexCoordP1ui] = (void*)glad_glMultiTexCoordP1ui)) glad_glMultiTexCoordP1ui = trace_glMultiTexCoordP1ui;
+    if ((traceReal[TRACE_glMultiTexCoordP1uiv] = (void*)glad_glMultiTexCoordP1uiv)) glad_glMultiTexCoordP1uiv = trace_glMultiTexCoordP1uiv;
+    if ((traceReal[TRACE_glMultiTexCoordP2ui] = (void*)glad_glMultiTexCoordP2ui)) glad_glMultiTexCoordP2ui = trace_glMultiTexCoordP2ui;
+    if ((traceReal[TRACE_glMultiTexCoordP2uiv] = (void*)glad_glMultiTexCoordP2uiv)) glad_glMultiTexCoordP2uiv = trace_glMultiTexCoordP2uiv;
+    if ((traceReal[TRACE_glMultiTexCoordP3ui] = (void*)glad_glMultiTexCoordP3ui)) glad_glMultiTexCoordP3ui = trace_glMultiTexCoordP3ui;
+    if ((traceReal[TRACE_glMultiTexCoordP3uiv] = (void*)glad_glMultiTexCoordP3uiv)) glad_glMultiTexCoordP3uiv = trace_glMultiTexCoordP3uiv;
+    if ((traceReal[TRACE_glMultiTexCoordP4ui] = (void*)glad_glMultiTexCoordP4ui)) glad_glMultiTexCoordP4ui = trace_glMultiTexCoordP4ui;
+    if ((traceReal[TRACE_glMultiTexCoordP4uiv] = (void*)glad_glMultiTexCoordP4uiv)) glad_glMultiTexCoordP4uiv = trace_glMultiTexCoordP4uiv;
+    if ((traceReal[TRACE_glNormalP3ui] = (void*)glad_glNormalP3ui)) glad_glNormalP3ui = trace_glNormalP3ui;
+    if ((traceReal[TRACE_glNormalP3uiv] = (void*)glad_glNormalP3uiv)) glad_glNormalP3uiv = trace_glNormalP3uiv;
+    if ((traceReal[TRACE_glColorP3ui] = (void*)glad_glColorP3ui)) glad_glColorP3ui = trace_glColorP3ui;
+    if ((traceReal[TRACE_glColorP3uiv] = (void*)glad_glColorP3uiv)) glad_glColorP3uiv = trace_glColorP3uiv;
+    if ((traceReal[TRACE_glColorP4ui] = (void*)glad_glColorP4ui)) glad_glColorP4ui = trace_glColorP4ui;
+    if ((traceReal[TRACE_glColorP4uiv] = (void*)glad_glColorP4uiv)) glad_glColorP4uiv = trace_glColorP4uiv;
+    if ((traceReal[TRACE_glSecondaryColorP3ui] = (void*)glad_glSecondaryColorP3ui)) glad_glSecondaryColorP3ui = trace_glSecondaryColorP3ui;
+    if ((traceReal[TRACE_glSecondaryColorP3uiv] = (void*)glad_glSecondaryColorP3uiv)) glad_glSecondaryColorP3uiv = trace_glSecondaryColorP3uiv;
+}
+
+static void removeTraceWrappers()
+{
+    if (traceReal[TRACE_glCullFace]) glad_glCullFace = (PFNGLCULLFACEPROC)traceReal[TRACE_glCullFace];
+    if (traceReal[TRACE_glFrontFace]) glad_glFrontFace = (PFNGLFRONTFACEPROC)traceReal[TRACE_glFrontFace];
+    if (traceReal[TRACE_glHint]) glad_glHint = (PFNGLHINTPROC)traceReal[TRACE_glHint];
+    if (traceReal[TRACE_glLineWidth]) glad_glLineWidth = (PFNGLLINEWIDTHPROC)traceReal[TRACE_glLineWidth];
+    if (traceReal[TRACE_glPointSize]) glad_glPointSize = (PFNGLPOINTSIZEPROC)traceReal[TRACE_glPointSize];
+    if (traceReal[TRACE_glPolygonMode]) glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)traceReal[TRACE_glPolygonMode];
+    if (traceReal[TRACE_glScissor]) glad_glScissor = (PFNGLSCISSORPROC)traceReal[TRACE_glScissor];
+    if (traceReal[TRACE_glTexParameterf]) glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)traceReal[TRACE_glTexParameterf];
+    if (traceReal[TRACE_glTexParameterfv]) glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)traceReal[TRACE_glTexParameterfv];
+    if (traceReal[TRACE_glTexParameteri]) glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)traceReal[TRACE_glTexParameteri];
+    if (traceReal[TRACE_glTexParameteriv]) glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)traceReal[TRACE_glTexParameteriv];
+    if (traceReal[TRACE_glTexImage1D]) glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)traceReal[TRACE_glTexImage1D];
+    if (traceReal[TRACE_glTexImage2D]) glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)traceReal[TRACE_glTexImage2D];
+    if (traceReal[TRACE_glDrawBuffer]) glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)traceReal[TRACE_glDrawBuffer];
+    if (traceReal[TRACE_glClear]) glad_glClear = (PFNGLCLEARPROC)traceReal[TRACE_glClear];
+    if (traceReal[TRACE_glClearColor]) glad_glClearColor = (PFNGLCLEARCOLORPROC)traceReal[TRACE_glClearColor];
+    if (traceReal[TRACE_glClearStencil]) glad_glClearStencil = (PFNGLCLEARSTENCILPROC)traceReal[TRACE_glClearStencil];
+    if (traceReal[TRACE_glClearDepth]) glad_glClearDepth = (PFNGLCLEARDEPTHPROC)traceReal[TRACE_glClearDepth];
+    if (traceReal[TRACE_glStencilMask]) glad_glStencilMask = (PFNGLSTENCILMASKPROC)traceReal[TRACE_glStencilMask];
+    if (traceReal[TRACE_glColorMask]) glad_glColorMask = (PFNGLCOLORMASKPROC)traceReal[TRACE_glColorMask];
+    if (traceReal[TRACE_glDepthMask]) glad_glDepthMask = (PFNGLDEPTHMASKPROC)traceReal[TRACE_glDepthMask];
+    if (traceReal[TRACE_glDisable]) glad_glDisable = (PFNGLDISABLEPROC)traceReal[TRACE_glDisable];
+    if (traceReal[TRACE_glEnable]) glad_glEnable = (PFNGLENABLEPROC)traceReal[TRACE_glEnable];
+    if (traceReal[TRACE_glFinish]) glad_glFinish = (PFNGLFINISHPROC)traceReal[TRACE_glFinish];
+    if (traceReal[TRACE_glFlush]) glad_glFlush = (PFNGLFLUSHPROC)traceReal[TRACE_glFlush];
+    if (traceReal[TRACE_glBlendFunc]) glad_glBlendFunc = (PFNGLBLENDFUNCPROC)traceReal[TRACE_glBlendFunc];
+    if (traceReal[TRACE_glLogicOp]) glad_glLogicOp = (PFNGLLOGICOPPROC)traceReal[TRACE_glLogicOp];
+    if (traceReal[TRACE_glStencilFunc]) glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)traceReal[TRACE_glStencilFunc];
+    if (traceReal[TRACE_glStencilOp]) glad_glStencilOp = (PFNGLSTENCILOPPROC)traceReal[TRACE_glStencilOp];
+    if (traceReal[TRACE_glDepthFunc]) glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)traceReal[TRACE_glDepthFunc];
+    if (traceReal[TRACE_glPixelStoref]) glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)traceReal[TRACE_glPixelStoref];
+    if (traceReal[TRACE_glPixelStorei]) glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)traceReal[TRACE_glPixelStorei];
+    if (traceReal[TRACE_glReadBuffer]) glad_glReadBuffer = (PFNGLREADBUFFERPROC)traceReal[TRACE_glReadBuffer];
+    if (traceReal[TRACE_glReadPixels]) glad_glReadPixels = (PFNGLREADPIXELSPROC)traceReal[TRACE_glReadPixels];
+    if (traceReal[TRACE_glGetBooleanv]) glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)traceReal[TRACE_glGetBooleanv];
+    if (traceReal[TRACE_glGetDoublev]) glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)traceReal[TRACE_glGetDoublev];
+    if (traceReal[TRACE_glGetError]) glad_glGetError = (PFNGLGETERRORPROC)traceReal[TRACE_glGetError];
+    if (traceReal[TRACE_glGetFloatv]) glad_glGetFloatv = (PFNGLGETFLOATVPROC)traceReal[TRACE_glGetFloatv];
+    if (traceReal[TRACE_glGetIntegerv]) glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)traceReal[TRACE_glGetIntegerv];
+    if (traceReal[TRACE_glGetString]) glad_glGetString = (PFNGLGETSTRINGPROC)traceReal[TRACE_glGetString];
+    if (traceReal[TRACE_glGetTexImage]) glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)traceReal[TRACE_glGetTexImage];
+    if (traceReal[TRACE_glGetTexParameterfv]) glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)traceReal[TRACE_glGetTexParameterfv];
+    if (traceReal[TRACE_glGetTexParameteriv]) glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)traceReal[TRACE_glGetTexParameteriv];
+    if (traceReal[TRACE_glGetTexLevelParameterfv]) glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)traceReal[TRACE_glGetTexLevelParameterfv];
+    if (traceReal[TRACE_glGetTexLevelParameteriv]) glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)traceReal[TRACE_glGetTexLevelParameteriv];
+    if (traceReal[TRACE_glIsEnabled]) glad_glIsEnabled = (PFNGLISENABLEDPROC)traceReal[TRACE_glIsEnabled];
+    if (traceReal[TRACE_glDepthRange]) glad_glDepthRange = (PFNGLDEPTHRANGEPROC)traceReal[TRACE_glDepthRange];
+    if (traceReal[TRACE_glViewport]) glad_glViewport = (PFNGLVIEWPORTPROC)traceReal[TRACE_glViewport];
+    if (traceReal[TRACE_glDrawArrays]) glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)traceReal[TRACE_glDrawArrays];
+    if (traceReal[TRACE_glDrawElements]) glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)traceReal[TRACE_glDrawElements];
+    if (traceReal[TRACE_glPolygonOffset]) glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)traceReal[TRACE_glPolygonOffset];
+    if (traceReal[TRACE_glCopyTexImage1D]) glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)traceReal[TRACE_glCopyTexImage1D];
+    if (traceReal[TRACE_glCopyTexImage2D]) glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)traceReal[TRACE_glCopyTexImage2D];
+    if (traceReal[TRACE_glCopyTexSubImage1D]) glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)traceReal[TRACE_glCopyTexSubImage1D];
+    if (traceReal[TRACE_glCopyTexSubImage2D]) glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)traceReal[TRACE_glCopyTexSubImage2D];
+    if (traceReal[TRACE_glTexSubImage1D]) glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)traceReal[TRACE_glTexSubImage1D];
+    if (traceReal[TRACE_glTexSubImage2D]) glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)traceReal[TRACE_glTexSubImage2D];
+    if (traceReal[TRACE_glBindTexture]) glad_glBindTexture = (PFNGLBINDTEXTUREPROC)traceReal[TRACE_glBindTexture];
+    if (traceReal[TRACE_glDeleteTextures]) glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)traceReal[TRACE_glDeleteTextures];
+    if (traceReal[TRACE_glGenTextures]) glad_glGenTextures = (PFNGLGENTEXTURESPROC)traceReal[TRACE_glGenTextures];
+    if (traceReal[TRACE_glIsTexture]) glad_glIsTexture = (PFNGLISTEXTUREPROC)traceReal[TRACE_glIsTexture];
+    if (traceReal[TRACE_glDrawRangeElements]) glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)traceReal[TRACE_glDrawRangeElements];
+    if (traceReal[TRACE_glTexImage3D]) glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)traceReal[TRACE_glTexImage3D];
+    if (traceReal[TRACE_glTexSubImage3D]) glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)traceReal[TRACE_glTexSubImage3D];
+    if (traceReal[TRACE_glCopyTexSubImage3D]) glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)traceReal[TRACE_glCopyTexSubImage3D];
+    if (traceReal[TRACE_glActiveTexture]) glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)traceReal[TRACE_glActiveTexture];
+    if (traceReal[TRACE_glSampleCoverage]) glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)traceReal[TRACE_glSampleCoverage];
+    if (traceReal[TRACE_glCompressedTexImage3D]) glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)traceReal[TRACE_glCompressedTexImage3D];
+    if (traceReal[TRACE_glCompressedTexImage2D]) glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)traceReal[TRACE_glCompressedTexImage2D];
+    if (traceReal[TRACE_glCompressedTexImage1D]) glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)traceReal[TRACE_glCompressedTexImage1D];
+    if (traceReal[TRACE_glCompressedTexSubImage3D]) glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)traceReal[TRACE_glCompressedTexSubImage3D];
+    if (traceReal[TRACE_glCompressedTexSubImage2D]) glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)traceReal[TRACE_glCompressedTexSubImage2D];
+    if (traceReal[TRACE_glCompressedTexSubImage1D]) glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)traceReal[TRACE_glCompressedTexSubImage1D];
+    if (traceReal[TRACE_glGetCompressedTexImage]) glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)traceReal[TRACE_glGetCompressedTexImage];
+    if (traceReal[TRACE_glBlendFuncSeparate]) glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)traceReal[TRACE_glBlendFuncSeparate];
+    if (traceReal[TRACE_glMultiDrawArrays]) glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)traceReal[TRACE_glMultiDrawArrays];
+    if (traceReal[TRACE_glMultiDrawElements]) glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)traceReal[TRACE_glMultiDrawElements];
+    if (traceReal[TRACE_glPointParameterf]) glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)traceReal[TRACE_glPointParameterf];
+    if (traceReal[TRACE_glPointParameterfv]) glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)traceReal[TRACE_glPointParameterfv];
+    if (traceReal[TRACE_glPointParameteri]) glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)traceReal[TRACE_glPointParameteri];
+    if (traceReal[TRACE_glPointParameteriv]) glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)traceReal[TRACE_glPointParameteriv];
+    if (traceReal[TRACE_glBlendColor]) glad_glBlendColor = (PFNGLBLENDCOLORPROC)traceReal[TRACE_glBlendColor];
+    if (traceReal[TRACE_glBlendEquation]) glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)traceReal[TRACE_glBlendEquation];
+    if (traceReal[TRACE_glGenQueries]) glad_glGenQueries = (PFNGLGENQUERIESPROC)traceReal[TRACE_glGenQueries];
+    if (traceReal[TRACE_glDeleteQueries]) glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)traceReal[TRACE_glDeleteQueries];
+    if (traceReal[TRACE_glIsQuery]) glad_glIsQuery = (PFNGLISQUERYPROC)traceReal[TRACE_glIsQuery];
+    if (traceReal[TRACE_glBeginQuery]) glad_glBeginQuery = (PFNGLBEGINQUERYPROC)traceReal[TRACE_glBeginQuery];
+    if (traceReal[TRACE_glEndQuery]) glad_glEndQuery = (PFNGLENDQUERYPROC)traceReal[TRACE_glEndQuery];
+    if (traceReal[TRACE_glGetQueryiv]) glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)traceReal[TRACE_glGetQueryiv];
+    if (traceReal[TRACE_glGetQueryObjectiv]) glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)traceReal[TRACE_glGetQueryObjectiv];
+    if (traceReal[TRACE_glGetQueryObjectuiv]) glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)traceReal[TRACE_glGetQueryObjectuiv];
+    if (traceReal[TRACE_glBindBuffer]) glad_glBindBuffer = (PFNGLBINDBUFFERPROC)traceReal[TRACE_glBindBuffer];
+    if (traceReal[TRACE_glDeleteBuffers]) glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)traceReal[TRACE_glDeleteBuffers];
+    if (traceReal[TRACE_glGenBuffers]) glad_glGenBuffers = (PFNGLGENBUFFERSPROC)traceReal[TRACE_glGenBuffers];
+    if (traceReal[TRACE_glIsBuffer]) glad_glIsBuffer = (PFNGLISBUFFERPROC)traceReal[TRACE_glIsBuffer];
+    if (traceReal[TRACE_glBufferData]) glad_glBufferData = (PFNGLBUFFERDATAPROC)traceReal[TRACE_glBufferData];
+    if (traceReal[TRACE_glBufferSubData]) glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)traceReal[TRACE_glBufferSubData];
+    if (traceReal[TRACE_glGetBufferSubData]) glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)traceReal[TRACE_glGetBufferSubData];
+    if (traceReal[TRACE_glMapBuffer]) glad_glMapBuffer = (PFNGLMAPBUFFERPROC)traceReal[TRACE_glMapBuffer];
+    if (traceReal[TRACE_glUnmapBuffer]) glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)traceReal[TRACE_glUnmapBuffer];
+    if (traceReal[TRACE_glGetBufferParameteriv]) glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)traceReal[TRACE_glGetBufferParameteriv];
+    if (traceReal[TRACE_glGetBufferPointerv]) glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)traceReal[TRACE_glGetBufferPointerv];
+    if (traceReal[TRACE_glBlendEquationSeparate]) glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)traceReal[TRACE_glBlendEquationSeparate];
+    if (traceReal[TRACE_glDrawBuffers]) glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)traceReal[TRACE_glDrawBuffers];
+    if (traceReal[TRACE_glStencilOpSeparate]) glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)traceReal[TRACE_glStencilOpSeparate];
+    if (traceReal[TRACE_glStencilFuncSeparate]) glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)traceReal[TRACE_glStencilFuncSeparate];
+    if (traceReal[TRACE_glStencilMaskSeparate]) glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)traceReal[TRACE_glStencilMaskSeparate];
+    if (traceReal[TRACE_glAttachShader]) glad_glAttachShader = (PFNGLATTACHSHADERPROC)traceReal[TRACE_glAttachShader];
+    if (traceReal[TRACE_glBindAttribLocation]) glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)traceReal[TRACE_glBindAttribLocation];
+    if (traceReal[TRACE_glCompileShader]) glad_glCompileShader = (PFNGLCOMPILESHADERPROC)traceReal[TRACE_glCompileShader];
+    if (traceReal[TRACE_glCreateProgram]) glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)traceReal[TRACE_glCreateProgram];
+    if (traceReal[TRACE_glCreateShader]) glad_glCreateShader = (PFNGLCREATESHADERPROC)traceReal[TRACE_glCreateShader];
+    if (traceReal[TRACE_glDeleteProgram]) glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)traceReal[TRACE_glDeleteProgram];
+    if (traceReal[TRACE_glDeleteShader]) glad_glDeleteShader = (PFNGLDELETESHADERPROC)traceReal[TRACE_glDeleteShader];
+    if (traceReal[TRACE_glDetachShader]) glad_glDetachShader = (PFNGLDETACHSHADERPROC)traceReal[TRACE_glDetachShader];
+    if (traceReal[TRACE_glDisableVertexAttribArray]) glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)traceReal[TRACE_glDisableVertexAttribArray];
+    if (traceReal[TRACE_glEnableVertexAttribArray]) glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)traceReal[TRACE_glEnableVertexAttribArray];
+    if (traceReal[TRACE_glGetActiveAttrib]) glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)traceReal[TRACE_glGetActiveAttrib];
+    if (traceReal[TRACE_glGetActiveUniform]) glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)traceReal[TRACE_glGetActiveUniform];
+    if (traceReal[TRACE_glGetAttachedShaders]) glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)traceReal[TRACE_glGetAttachedShaders];
+    if (traceReal[TRACE_glGetAttribLocation]) glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)traceReal[TRACE_glGetAttribLocation];
+    if (traceReal[TRACE_glGetProgramiv]) glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)traceReal[TRACE_glGetProgramiv];
+    if (traceReal[TRACE_glGetProgramInfoLog]) glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)traceReal[TRACE_glGetProgramInfoLog];
+    if (traceReal[TRACE_glGetShaderiv]) glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)traceReal[TRACE_glGetShaderiv];
+    if (traceReal[TRACE_glGetShaderInfoLog]) glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)traceReal[TRACE_glGetShaderInfoLog];
+    if (traceReal[TRACE_glGetShaderSource]) glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)traceReal[TRACE_glGetShaderSource];
+    if (traceReal[TRACE_glGetUniformLocation]) glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)traceReal[TRACE_glGetUniformLocation];
+    if (traceReal[TRACE_glGetUniformfv]) glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)traceReal[TRACE_glGetUniformfv];
+    if (traceReal[TRACE_glGetUniformiv]) glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)traceReal[TRACE_glGetUniformiv];
+    if (traceReal[TRACE_glGetVertexAttribdv]) glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)traceReal[TRACE_glGetVertexAttribdv];
+    if (traceReal[TRACE_glGetVertexAttribfv]) glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)traceReal[TRACE_glGetVertexAttribfv];
+    if (traceReal[TRACE_glGetVertexAttribiv]) glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)traceReal[TRACE_glGetVertexAttribiv];
+    if (traceReal[TRACE_glGetVertexAttribPointerv]) glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)traceReal[TRACE_glGetVertexAttribPointerv];
+    if (traceReal[TRACE_glIsProgram]) glad_glIsProgram = (PFNGLISPROGRAMPROC)traceReal[TRACE_glIsProgram];
+    if (traceReal[TRACE_glIsShader]) glad_glIsShader = (PFNGLISSHADERPROC)traceReal[TRACE_glIsShader];
+    if (traceReal[TRACE_glLinkProgram]) glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)traceReal[TRACE_glLinkProgram];
+    if (traceReal[TRACE_glShaderSource]) glad_glShaderSource = (PFNGLSHADERSOURCEPROC)traceReal[TRACE_glShaderSource];
+    if (traceReal[TRACE_glUseProgram]) glad_glUseProgram = (PFNGLUSEPROGRAMPROC)traceReal[TRACE_glUseProgram];
+    if (traceReal[TRACE_glUniform1f]) glad_glUniform1f = (PFNGLUNIFORM1FPROC)traceReal[TRACE_glUniform1f];
+    if (traceReal[TRACE_glUniform2f]) glad_glUniform2f = (PFNGLUNIFORM2FPROC)traceReal[TRACE_glUniform2f];
+    if (traceReal[TRACE_glUniform3f]) glad_glUniform3f = (PFNGLUNIFORM3FPROC)traceReal[TRACE_glUniform3f];
+    if (traceReal[TRACE_glUniform4f]) glad_glUniform4f = (PFNGLUNIFORM4FPROC)traceReal[TRACE_glUniform4f];
+    if (traceReal[TRACE_glUniform1i]) glad_glUniform1i = (PFNGLUNIFORM1IPROC)traceReal[TRACE_glUniform1i];
+    if (traceReal[TRACE_glUniform2i]) glad_glUniform2i = (PFNGLUNIFORM2IPROC)traceReal[TRACE_glUniform2i];
+    if (traceReal[TRACE_glUniform3i]) glad_glUniform3i = (PFNGLUNIFORM3IPROC)traceReal[TRACE_glUniform3i];
+    if (traceReal[TRACE_glUniform4i]) glad_glUniform4i = (PFNGLUNIFORM4IPROC)traceReal[TRACE_glUniform4i];
+    if (traceReal[TRACE_glUniform1fv]) glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)traceReal[TRACE_glUniform1fv];
+    if (traceReal[TRACE_glUniform2fv]) glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)traceReal[TRACE_glUniform2fv];
+    if (traceReal[TRACE_glUniform3fv]) glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)traceReal[TRACE_glUniform3fv];
+    if (traceReal[TRACE_glUniform4fv]) glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)traceReal[TRACE_glUniform4fv];
+    if (traceReal[TRACE_glUniform1iv]) glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)traceReal[TRACE_glUniform1iv];
+    if (traceReal[TRACE_glUniform2iv]) glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)traceReal[TRACE_glUniform2iv];
+    if (traceReal[TRACE_glUniform3iv]) glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)traceReal[TRACE_glUniform3iv];
+    if (traceReal[TRACE_glUniform4iv]) glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)traceReal[TRACE_glUniform4iv];
+    if (traceReal[TRACE_glUniformMatrix2fv]) glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)traceReal[TRACE_glUniformMatrix2fv];
+    if (traceReal[TRACE_glUniformMatrix3fv]) glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)traceReal[TRACE_glUniformMatrix3fv];
+    if (traceReal[TRACE_glUniformMatrix4fv]) glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)traceReal[TRACE_glUniformMatrix4fv];
+    if (traceReal[TRACE_glValidateProgram]) glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)traceReal[TRACE_glValidateProgram];
+    if (traceReal[TRACE_glVertexAttrib1d]) glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)traceReal[TRACE_glVertexAttrib1d];
+    if (traceReal[TRACE_glVertexAttrib1dv]) glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)traceReal[TRACE_glVertexAttrib1dv];
+    if (traceReal[TRACE_glVertexAttrib1f]) glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)traceReal[TRACE_glVertexAttrib1f];
+    if (traceReal[TRACE_glVertexAttrib1fv]) glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)traceReal[TRACE_glVertexAttrib1fv];
+    if (traceReal[TRACE_glVertexAttrib1s]) glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)traceReal[TRACE_glVertexAttrib1s];
+    if (traceReal[TRACE_glVertexAttrib1sv]) glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)traceReal[TRACE_glVertexAttrib1sv];
+    if (traceReal[TRACE_glVertexAttrib2d]) glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)traceReal[TRACE_glVertexAttrib2d];
+    if (traceReal[TRACE_glVertexAttrib2dv]) glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)traceReal[TRACE_glVertexAttrib2dv];
+    if (traceReal[TRACE_glVertexAttrib2f]) glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)traceReal[TRACE_glVertexAttrib2f];
+    if (traceReal[TRACE_glVertexAttrib2fv]) glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)traceReal[TRACE_glVertexAttrib2fv];
+    if (traceReal[TRACE_glVertexAttrib2s]) glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)traceReal[TRACE_glVertexAttrib2s];
+    if (traceReal[TRACE_glVertexAttrib2sv]) glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)traceReal[TRACE_glVertexAttrib2sv];
+    if (traceReal[TRACE_glVertexAttrib3d]) glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)traceReal[TRACE_glVertexAttrib3d];
+    if (traceReal[TRACE_glVertexAttrib3dv]) glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)traceReal[TRACE_glVertexAttrib3dv];
+    if (traceReal[TRACE_glVertexAttrib3f]) glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)traceReal[TRACE_glVertexAttrib3f];
+    if (traceReal[TRACE_glVertexAttrib3fv]) glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)traceReal[TRACE_glVertexAttrib3fv];
+    if (traceReal[TRACE_glVertexAttrib3s]) glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)traceReal[TRACE_glVertexAttrib3s];
+    if (traceReal[TRACE_glVertexAttrib3sv]) glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)traceReal[TRACE_glVertexAttrib3sv];
+    if (traceReal[TRACE_glVertexAttrib4Nbv]) glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)traceReal[TRACE_glVertexAttrib4Nbv];
+    if (traceReal[TRACE_glVertexAttrib4Niv]) glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)traceReal[TRACE_glVertexAttrib4Niv];
+    if (traceReal[TRACE_glVertexAttrib4Nsv]) glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)traceReal[TRACE_glVertexAttrib4Nsv];
+    if (traceReal[TRACE_glVertexAttrib4Nub]) glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)traceReal[TRACE_glVertexAttrib4Nub];
+    if (traceReal[TRACE_glVertexAttrib4Nubv]) glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)traceReal[TRACE_glVertexAttrib4Nubv];
+    if (traceReal[TRACE_glVertexAttrib4Nuiv]) glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)traceReal[TRACE_glVertexAttrib4Nuiv];
+    if (traceReal[TRACE_glVertexAttrib4Nusv]) glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)traceReal[TRACE_glVertexAttrib4Nusv];
+    if (traceReal[TRACE_glVertexAttrib4bv]) glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)traceReal[TRACE_glVertexAttrib4bv];
+    if (traceReal[TRACE_glVertexAttrib4d]) glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)traceReal[TRACE_glVertexAttrib4d];
+    if (traceReal[TRACE_glVertexAttrib4dv]) glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)traceReal[TRACE_glVertexAttrib4dv];
+    if (traceReal[TRACE_glVertexAttrib4f]) glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)traceReal[TRACE_glVertexAttrib4f];
+    if (traceReal[TRACE_glVertexAttrib4fv]) glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)traceReal[TRACE_glVertexAttrib4fv];
+    if (traceReal[TRACE_glVertexAttrib4iv]) glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)traceReal[TRACE_glVertexAttrib4iv];
+    if (traceReal[TRACE_glVertexAttrib4s]) glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)traceReal[TRACE_glVertexAttrib4s];
+    if (traceReal[TRACE_glVertexAttrib4sv]) glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)traceReal[TRACE_glVertexAttrib4sv];
+    if (traceReal[TRACE_glVertexAttrib4ubv]) glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)traceReal[TRACE_glVertexAttrib4ubv];
+    if (traceReal[TRACE_glVertexAttrib4uiv]) glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)traceReal[TRACE_glVertexAttrib4uiv];
+    if (traceReal[TRACE_glVertexAttrib4usv]) glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)traceReal[TRACE_glVertexAttrib4usv];
+    if (traceReal[TRACE_glVertexAttribPointer]) glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)traceReal[TRACE_glVertexAttribPointer];
+    if (traceReal[TRACE_glUniformMatrix2x3fv]) glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)traceReal[TRACE_glUniformMatrix2x3fv];
+    if (traceReal[TRACE_glUniformMatrix3x2fv]) glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)traceReal[TRACE_glUniformMatrix3x2fv];
+    if (traceReal[TRACE_glUniformMatrix2x4fv]) glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)traceReal[TRACE_glUniformMatrix2x4fv];
+    if (traceReal[TRACE_glUniformMatrix4x2fv]) glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)traceReal[TRACE_glUniformMatrix4x2fv];
+    if (traceReal[TRACE_glUniformMatrix3x4fv]) glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)traceReal[TRACE_glUniformMatrix3x4fv];
+    if (traceReal[TRACE_glUniformMatrix4x3fv]) glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)traceReal[TRACE_glUniformMatrix4x3fv];
+    if (traceReal[TRACE_glColorMaski]) glad_glColorMaski = (PFNGLCOLORMASKIPROC)traceReal[TRACE_glColorMaski];
+    if (traceReal[TRACE_glGetBooleani_v]) glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)traceReal[TRACE_glGetBooleani_v];
+    if (traceReal[TRACE_glGetIntegeri_v]) glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)traceReal[TRACE_glGetIntegeri_v];
+    if (traceReal[TRACE_glEnablei]) glad_glEnablei = (PFNGLENABLEIPROC)traceReal[TRACE_glEnablei];
+    if (traceReal[TRACE_glDisablei]) glad_glDisablei = (PFNGLDISABLEIPROC)traceReal[TRACE_glDisablei];
+    if (traceReal[TRACE_glIsEnabledi]) glad_glIsEnabledi = (PFNGLISENABLEDIPROC)traceReal[TRACE_glIsEnabledi];
+    if (traceReal[TRACE_glBeginTransformFeedback]) glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)traceReal[TRACE_glBeginTransformFeedback];
+    if (traceReal[TRACE_glEndTransformFeedback]) glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)traceReal[TRACE_glEndTransformFeedback];
+    if (traceReal[TRACE_glBindBufferRange]) glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)traceReal[TRACE_glBindBufferRange];
+    if (traceReal[TRACE_glBindBufferBase]) glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)traceReal[TRACE_glBindBufferBase];
+    if (traceReal[TRACE_glTransformFeedbackVaryings]) glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)traceReal[TRACE_glTransformFeedbackVaryings];
+    if (traceReal[TRACE_glGetTransformFeedbackVarying]) glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)traceReal[TRACE_glGetTransformFeedbackVarying];
+    if (traceReal[TRACE_glClampColor]) glad_glClampColor = (PFNGLCLAMPCOLORPROC)traceReal[TRACE_glClampColor];
+    if (traceReal[TRACE_glBeginConditionalRender]) glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)traceReal[TRACE_glBeginConditionalRender];
+    if (traceReal[TRACE_glEndConditionalRender]) glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)traceReal[TRACE_glEndConditionalRender];
+    if (traceReal[TRACE_glVertexAttribIPointer]) glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)traceReal[TRACE_glVertexAttribIPointer];
+    if (traceReal[TRACE_glGetVertexAttribIiv]) glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)traceReal[TRACE_glGetVertexAttribIiv];
+    if (traceReal[TRACE_glGetVertexAttribIuiv]) glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)traceReal[TRACE_glGetVertexAttribIuiv];
+    if (traceReal[TRACE_glVertexAttribI1i]) glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)traceReal[TRACE_glVertexAttribI1i];
+    if (traceReal[TRACE_glVertexAttribI2i]) glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)traceReal[TRACE_glVertexAttribI2i];
+    if (traceReal[TRACE_glVertexAttribI3i]) glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)traceReal[TRACE_glVertexAttribI3i];
+    if (traceReal[TRACE_glVertexAttribI4i]) glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)traceReal[TRACE_glVertexAttribI4i];
+    if (traceReal[TRACE_glVertexAttribI1ui]) glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)traceReal[TRACE_glVertexAttribI1ui];
+    if (traceReal[TRACE_glVertexAttribI2ui]) glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)traceReal[TRACE_glVertexAttribI2ui];
+    if (traceReal[TRACE_glVertexAttribI3ui]) glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)traceReal[TRACE_glVertexAttribI3ui];
+    if (traceReal[TRACE_glVertexAttribI4ui]) glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)traceReal[TRACE_glVertexAttribI4ui];
+    if (traceReal[TRACE_glVertexAttribI1iv]) glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)traceReal[TRACE_glVertexAttribI1iv];
+    if (traceReal[TRACE_glVertexAttribI2iv]) glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)traceReal[TRACE_glVertexAttribI2iv];
+    if (traceReal[TRACE_glVertexAttribI3iv]) glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)traceReal[TRACE_glVertexAttribI3iv];
+    if (traceReal[TRACE_glVertexAttribI4iv]) glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)traceReal[TRACE_glVertexAttribI4iv];
+    if (traceReal[TRACE_glVertexAttribI1uiv]) glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)traceReal[TRACE_glVertexAttribI1uiv];
+    if (traceReal[TRACE_glVertexAttribI2uiv]) glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)traceReal[TRACE_glVertexAttribI2uiv];
+    if (traceReal[TRACE_glVertexAttribI3uiv]) glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)traceReal[TRACE_glVertexAttribI3uiv];
+    if (traceReal[TRACE_glVertexAttribI4uiv]) glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)traceReal[TRACE_glVertexAttribI4uiv];
+    if (traceReal[TRACE_glVertexAttribI4bv]) glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)traceReal[TRACE_glVertexAttribI4bv];
+    if (traceReal[TRACE_glVertexAttribI4sv]) glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)traceReal[TRACE_glVertexAttribI4sv];
+    if (traceReal[TRACE_glVertexAttribI4ubv]) glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)traceReal[TRACE_glVertexAttribI4ubv];
+    if (traceReal[TRACE_glVertexAttribI4usv]) glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)traceReal[TRACE_glVertexAttribI4usv];
+    if (traceReal[TRACE_glGetUniformuiv]) glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)traceReal[TRACE_glGetUniformuiv];
+    if (traceReal[TRACE_glBindFragDataLocation]) glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)traceReal[TRACE_glBindFragDataLocation];
+    if (traceReal[TRACE_glGetFragDataLocation]) glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)traceReal[TRACE_glGetFragDataLocation];
+    if (traceReal[TRACE_glUniform1ui]) glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)traceReal[TRACE_glUniform1ui];
+    if (traceReal[TRACE_glUniform2ui]) glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)traceReal[TRACE_glUniform2ui];
+    if (traceReal[TRACE_glUniform3ui]) glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)traceReal[TRACE_glUniform3ui];
+    if (traceReal[TRACE_glUniform4ui]) glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)traceReal[TRACE_glUniform4ui];
+    if (traceReal[TRACE_glUniform1uiv]) glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)traceReal[TRACE_glUniform1uiv];
+    if (traceReal[TRACE_glUniform2uiv]) glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)traceReal[TRACE_glUniform2uiv];
+    if (traceReal[TRACE_glUniform3uiv]) glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)traceReal[TRACE_glUniform3uiv];
+    if (traceReal[TRACE_glUniform4uiv]) glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)traceReal[TRACE_glUniform4uiv];
+    if (traceReal[TRACE_glTexParameterIiv]) glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)traceReal[TRACE_glTexParameterIiv];
+    if (traceReal[TRACE_glTexParameterIuiv]) glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)traceReal[TRACE_glTexParameterIuiv];
+    if (traceReal[TRACE_glGetTexParameterIiv]) glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)traceReal[TRACE_glGetTexParameterIiv];
+    if (traceReal[TRACE_glGetTexParameterIuiv]) glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)traceReal[TRACE_glGetTexParameterIuiv];
+    if (traceReal[TRACE_glClearBufferiv]) glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)traceReal[TRACE_glClearBufferiv];
+    if (traceReal[TRACE_glClearBufferuiv]) glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)traceReal[TRACE_glClearBufferuiv];
+    if (traceReal[TRACE_glClearBufferfv]) glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)traceReal[TRACE_glClearBufferfv];
+    if (traceReal[TRACE_glClearBufferfi]) glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)traceReal[TRACE_glClearBufferfi];
+    if (traceReal[TRACE_glGetStringi]) glad_glGetStringi = (PFNGLGETSTRINGIPROC)traceReal[TRACE_glGetStringi];
+    if (traceReal[TRACE_glIsRenderbuffer]) glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)traceReal[TRACE_glIsRenderbuffer];
+    if (traceReal[TRACE_glBindRenderbuffer]) glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)traceReal[TRACE_glBindRenderbuffer];
+    if (traceReal[TRACE_glDeleteRenderbuffers]) glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)traceReal[TRACE_glDeleteRenderbuffers];
+    if (traceReal[TRACE_glGenRenderbuffers]) glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)traceReal[TRACE_glGenRenderbuffers];
+    if (traceReal[TRACE_glRenderbufferStorage]) glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)traceReal[TRACE_glRenderbufferStorage];
+    if (traceReal[TRACE_glGetRenderbufferParameteriv]) glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)traceReal[TRACE_glGetRenderbufferParameteriv];
+    if (traceReal[TRACE_glIsFramebuffer]) glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)traceReal[TRACE_glIsFramebuffer];
+    if (traceReal[TRACE_glBindFramebuffer]) glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)traceReal[TRACE_glBindFramebuffer];
+    if (traceReal[TRACE_glDeleteFramebuffers]) glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)traceReal[TRACE_glDeleteFramebuffers];
+    if (traceReal[TRACE_glGenFramebuffers]) glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)traceReal[TRACE_glGenFramebuffers];
+    if (traceReal[TRACE_glCheckFramebufferStatus]) glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)traceReal[TRACE_glCheckFramebufferStatus];
+    if (traceReal[TRACE_glFramebufferTexture1D]) glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)traceReal[TRACE_glFramebufferTexture1D];
+    if (traceReal[TRACE_glFramebufferTexture2D]) glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)traceReal[TRACE_glFramebufferTexture2D];
+    if (traceReal[TRACE_glFramebufferTexture3D]) glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)traceReal[TRACE_glFramebufferTexture3D];
+    if (traceReal[TRACE_glFramebufferRenderbuffer]) glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)traceReal[TRACE_glFramebufferRenderbuffer];
+    if (traceReal[TRACE_glGetFramebufferAttachmentParameteriv]) glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)traceReal[TRACE_glGetFramebufferAttachmentParameteriv];
+    if (traceReal[TRACE_glGenerateMipmap]) glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)traceReal[TRACE_glGenerateMipmap];
+    if (traceReal[TRACE_glBlitFramebuffer]) glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)traceReal[TRACE_glBlitFramebuffer];
+    if (traceReal[TRACE_glRenderbufferStorageMultisample]) glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)traceReal[TRACE_glRenderbufferStorageMultisample];
+    if (traceReal[TRACE_glFramebufferTextureLayer]) glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)traceReal[TRACE_glFramebufferTextureLayer];
+    if (traceReal[TRACE_glMapBufferRange]) glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)traceReal[TRACE_glMapBufferRange];
+    if (traceReal[TRACE_glFlushMappedBufferRange]) glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)traceReal[TRACE_glFlushMappedBufferRange];
+    if (traceReal[TRACE_glBindVertexArray]) glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)traceReal[TRACE_glBindVertexArray];
+    if (traceReal[TRACE_glDeleteVertexArrays]) glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)traceReal[TRACE_glDeleteVertexArrays];
+    if (traceReal[TRACE_glGenVertexArrays]) glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)traceReal[TRACE_glGenVertexArrays];
+    if (traceReal[TRACE_glIsVertexArray]) glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)traceReal[TRACE_glIsVertexArray];
+    if (traceReal[TRACE_glDrawArraysInstanced]) glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)traceReal[TRACE_glDrawArraysInstanced];
+    if (traceReal[TRACE_glDrawElementsInstanced]) glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)traceReal[TRACE_glDrawElementsInstanced];
+    if (traceReal[TRACE_glTexBuffer]) glad_glTexBuffer = (PFNGLTEXBUFFERPROC)traceReal[TRACE_glTexBuffer];
+    if (traceReal[TRACE_glPrimitiveRestartIndex]) glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)traceReal[TRACE_glPrimitiveRestartIndex];
+    if (traceReal[TRACE_glCopyBufferSubData]) glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)traceReal[TRACE_glCopyBufferSubData];
+    if (traceReal[TRACE_glGetUniformIndices]) glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)traceReal[TRACE_glGetUniformIndices];
+    if (traceReal[TRACE_glGetActiveUniformsiv]) glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)traceReal[TRACE_glGetActiveUniformsiv];
+    if (traceReal[TRACE_glGetActiveUniformName]) glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)traceReal[TRACE_glGetActiveUniformName];
+    if (traceReal[TRACE_glGetUniformBlockIndex]) glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)traceReal[TRACE_glGetUniformBlockIndex];
+    if (traceReal[TRACE_glGetActiveUniformBlockiv]) glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)traceReal[TRACE_glGetActiveUniformBlockiv];
+    if (traceReal[TRACE_glGetActiveUniformBlockName]) glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)traceReal[TRACE_glGetActiveUniformBlockName];
+    if (traceReal[TRACE_glUniformBlockBinding]) glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)traceReal[TRACE_glUniformBlockBinding];
+    if (traceReal[TRACE_glDrawElementsBaseVertex]) glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)traceReal[TRACE_glDrawElementsBaseVertex];
+    if (traceReal[TRACE_glDrawRangeElementsBaseVertex]) glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)traceReal[TRACE_glDrawRangeElementsBaseVertex];
+    if (traceReal[TRACE_glDrawElementsInstancedBaseVertex]) glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)traceReal[TRACE_glDrawElementsInstancedBaseVertex];
+    if (traceReal[TRACE_glMultiDrawElementsBaseVertex]) glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)traceReal[TRACE_glMultiDrawElementsBaseVertex];
+    if (traceReal[TRACE_glProvokingVertex]) glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)traceReal[TRACE_glProvokingVertex];
+    if (traceReal[TRACE_glFenceSync]) glad_glFenceSync = (PFNGLFENCESYNCPROC)traceReal[TRACE_glFenceSync];
+    if (traceReal[TRACE_glIsSync]) glad_glIsSync = (PFNGLISSYNCPROC)traceReal[TRACE_glIsSync];
+    if (traceReal[TRACE_glDeleteSync]) glad_glDeleteSync = (PFNGLDELETESYNCPROC)traceReal[TRACE_glDeleteSync];
+    if (traceReal[TRACE_glClientWaitSync]) glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)traceReal[TRACE_glClientWaitSync];
+    if (traceReal[TRACE_glWaitSync]) glad_glWaitSync = (PFNGLWAITSYNCPROC)traceReal[TRACE_glWaitSync];
+    if (traceReal[TRACE_glGetInteger64v]) glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)traceReal[TRACE_glGetInteger64v];
+    if (traceReal[TRACE_glGetSynciv]) glad_glGetSynciv = (PFNGLGETSYNCIVPROC)traceReal[TRACE_glGetSynciv];
+    if (traceReal[TRACE_glGetInteger64i_v]) glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)traceReal[TRACE_glGetInteger64i_v];
+    if (traceReal[TRACE_glGetBufferParameteri64v]) glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)traceReal[TRACE_glGetBufferParameteri64v];
+    if (traceReal[TRACE_glFramebufferTexture]) glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)traceReal[TRACE_glFramebufferTexture];
+    if (traceReal[TRACE_glTexImage2DMultisample]) glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)traceReal[TRACE_glTexImage2DMultisample];
+    if (traceReal[TRACE_glTexImage3DMultisample]) glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)traceReal[TRACE_glTexImage3DMultisample];
+    if (traceReal[TRACE_glGetMultisamplefv]) glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)traceReal[TRACE_glGetMultisamplefv];
+    if (traceReal[TRACE_glSampleMaski]) glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)traceReal[TRACE_glSampleMaski];
+    if (traceReal[TRACE_glBindFragDataLocationIndexed]) glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)traceReal[TRACE_glBindFragDataLocationIndexed];
+    if (traceReal[TRACE_glGetFragDataIndex]) glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)traceReal[TRACE_glGetFragDataIndex];
+    if (traceReal[TRACE_glGenSamplers]) glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)traceReal[TRACE_glGenSamplers];
+    if (traceReal[TRACE_glDeleteSamplers]) glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)traceReal[TRACE_glDeleteSamplers];
+    if (traceReal[TRACE_glIsSampler]) glad_glIsSampler = (PFNGLISSAMPLERPROC)traceReal[TRACE_glIsSampler];
+    if (traceReal[TRACE_glBindSampler]) glad_glBindSampler = (PFNGLBINDSAMPLERPROC)traceReal[TRACE_glBindSampler];
+    if (traceReal[TRACE_glSamplerParameteri]) glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)traceReal[TRACE_glSamplerParameteri];
+    if (traceReal[TRACE_glSamplerParameteriv]) glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)traceReal[TRACE_glSamplerParameteriv];
+    if (traceReal[TRACE_glSamplerParameterf]) glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)traceReal[TRACE_glSamplerParameterf];
+    if (traceReal[TRACE_glSamplerParameterfv]) glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)traceReal[TRACE_glSamplerParameterfv];
+    if (traceReal[TRACE_glSamplerParameterIiv]) glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)traceReal[TRACE_glSamplerParameterIiv];
+    if (traceReal[TRACE_glSamplerParameterIuiv]) glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)traceReal[TRACE_glSamplerParameterIuiv];
+    if (traceReal[TRACE_glGetSamplerParameteriv]) glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)traceReal[TRACE_glGetSamplerParameteriv];
+    if (traceReal[TRACE_glGetSamplerParameterIiv]) glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)traceReal[TRACE_glGetSamplerParameterIiv];
+    if (traceReal[TRACE_glGetSamplerParameterfv]) glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)traceReal[TRACE_glGetSamplerParameterfv];
+    if (traceReal[TRACE_glGetSamplerParameterIuiv]) glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)traceReal[TRACE_glGetSamplerParameterIuiv];
+    if (traceReal[TRACE_glQueryCounter]) glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)traceReal[TRACE_glQueryCounter];
+    if (traceReal[TRACE_glGetQueryObjecti64v]) glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)traceReal[TRACE_glGetQueryObjecti64v];
+    if (traceReal[TRACE_glGetQueryObjectui64v]) glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)traceReal[TRACE_glGetQueryObjectui64v];
+    if (traceReal[TRACE_glVertexAttribDivisor]) glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)traceReal[TRACE_glVertexAttribDivisor];
+    if (traceReal[TRACE_glVertexAttribP1ui]) glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)traceReal[TRACE_glVertexAttribP1ui];
+    if (traceReal[TRACE_glVertexAttribP1uiv]) glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)traceReal[TRACE_glVertexAttribP1uiv];
+    if (traceReal[TRACE_glVertexAttribP2ui]) glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)traceReal[TRACE_glVertexAttribP2ui];
+    if (traceReal[TRACE_glVertexAttribP2uiv]) glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)traceReal[TRACE_glVertexAttribP2uiv];
+    if (traceReal[TRACE_glVertexAttribP3ui]) glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)traceReal[TRACE_glVertexAttribP3ui];
+    if (traceReal[TRACE_glVertexAttribP3uiv]) glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)traceReal[TRACE_glVertexAttribP3uiv];
+    if (traceReal[TRACE_glVertexAttribP4ui]) glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)traceReal[TRACE_glVertexAttribP4ui];
+    if (traceReal[TRACE_glVertexAttribP4uiv]) glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)traceReal[TRACE_glVertexAttribP4uiv];
+    if (traceReal[TRACE_glVertexP2ui]) glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)traceReal[TRACE_glVertexP2ui];
+    if (traceReal[TRACE_glVertexP2uiv]) glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)traceReal[TRACE_glVertexP2uiv];
+    if (traceReal[TRACE_glVertexP3ui]) glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)traceReal[TRACE_glVertexP3ui];
+    if (traceReal[TRACE_glVertexP3uiv]) glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)traceReal[TRACE_glVertexP3uiv];
+    if (traceReal[TRACE_glVertexP4ui]) glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)traceReal[TRACE_glVertexP4ui];
+    if (traceReal[TRACE_glVertexP4uiv]) glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)traceReal[TRACE_glVertexP4uiv];
+    if (traceReal[TRACE_glTexCoordP1ui]) glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)traceReal[TRACE_glTexCoordP1ui];
+    if (traceReal[TRACE_glTexCoordP1uiv]) glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)traceReal[TRACE_glTexCoordP1uiv];
+    if (traceReal[TRACE_glTexCoordP2ui]) glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)traceReal[TRACE_glTexCoordP2ui];
+    if (traceReal[TRACE_glTexCoordP2uiv]) glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)traceReal[TRACE_glTexCoordP2uiv];
+    if (traceReal[TRACE_glTexCoordP3ui]) glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)traceReal[TRACE_glTexCoordP3ui];
+    if (traceReal[TRACE_glTexCoordP3uiv]) glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)traceReal[TRACE_glTexCoordP3uiv];
+    if (traceReal[TRACE_glTexCoordP4ui]) glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)traceReal[TRACE_glTexCoordP4ui];
+    if (traceReal[TRACE_glTexCoordP4uiv]) glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)traceReal[TRACE_glTexCoordP4uiv];
+    if (traceReal[TRACE_glMultiTexCoordP1ui]) glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)traceReal[TRACE_glMultiTexCoordP1ui];
+    if (traceReal[TRACE_glMultiTexCoordP1uiv]) glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)traceReal[TRACE_glMultiTexCoordP1uiv];
+    if (traceReal[TRACE_glMultiTexCoordP2ui]) glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)traceReal[TRACE_glMultiTexCoordP2ui];
+    if (traceReal[TRACE_glMultiTexCoordP2uiv]) glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)traceReal[TRACE_glMultiTexCoordP2uiv];
+    if (traceReal[TRACE_glMultiTexCoordP3ui]) glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)traceReal[TRACE_glMultiTexCoordP3ui];
+    if (traceReal[TRACE_glMultiTexCoordP3uiv]) glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)traceReal[TRACE_glMultiTexCoordP3uiv];
+    if (traceReal[TRACE_glMultiTexCoordP4ui]) glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)traceReal[TRACE_glMultiTexCoordP4ui];
+    if (traceReal[TRACE_glMultiTexCoordP4uiv]) glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)traceReal[TRACE_glMultiTexCoordP4uiv];
+    if (traceReal[TRACE_glNormalP3ui]) glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)traceReal[TRACE_glNormalP3ui];
+    if (traceReal[TRACE_glNormalP3uiv]) glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)traceReal[TRACE_glNormalP3uiv];
+    if (traceReal[TRACE_glColorP3ui]) glad_glColorP3ui = (PFNGLCOLORP3UIPROC)traceReal[TRACE_glColorP3ui];
+    if (traceReal[TRACE_glColorP3uiv]) glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)traceReal[TRACE_glColorP3uiv];
+    if (traceReal[TRACE_glColorP4ui]) glad_glColorP4ui = (PFNGLCOLORP4UIPROC)traceReal[TRACE_glColorP4ui];
+    if (traceReal[TRACE_glColorP4uiv]) glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)traceReal[TRACE_glColorP4uiv];
+    if (traceReal[TRACE_glSecondaryColorP3ui]) glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)traceReal[TRACE_glSecondaryColorP3ui];
+    if (traceReal[TRACE_glSecondaryColorP3uiv]) glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)traceReal[TRACE_glSecondaryColorP3uiv];
+}
+
+static void replayDispatch(int function, const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result)
+{
+    switch (function)
+    {
+    case TRACE_glCullFace: glad_glCullFace((GLenum)a[0]); break;
+    case TRACE_glFrontFace: glad_glFrontFace((GLenum)a[0]); break;
+    case TRACE_glHint: glad_glHint((GLenum)a[0], (GLenum)a[1]); break;
+    case TRACE_glLineWidth: glad_glLineWidth(replayFloat(a[0])); break;
+    case TRACE_glPointSize: glad_glPointSize(replayFloat(a[0])); break;
+    case TRACE_glPolygonMode: glad_glPolygonMode((GLenum)a[0], (GLenum)a[1]); break;
+    case TRACE_glScissor: glad_glScissor((GLint)a[0], (GLint)a[1], (GLsizei)a[2], (GLsizei)a[3]); break;
+    case TRACE_glTexParameterf: glad_glTexParameterf((GLenum)a[0], (GLenum)a[1], replayFloat(a[2])); break;
+    case TRACE_glTexParameterfv: glad_glTexParameterfv((GLenum)a[0], (GLenum)a[1], (const GLfloat *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glTexParameteri: glad_glTexParameteri((GLenum)a[0], (GLenum)a[1], (GLint)a[2]); break;
+    case TRACE_glTexParameteriv: glad_glTexParameteriv((GLenum)a[0], (GLenum)a[1], (const GLint *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glTexImage1D: glad_glTexImage1D((GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLsizei)a[3], (GLint)a[4], (GLenum)a[5], (GLenum)a[6], (const void *)replayScratch()); break;
+    case TRACE_glTexImage2D: glad_glTexImage2D((GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLsizei)a[3], (GLsizei)a[4], (GLint)a[5], (GLenum)a[6], (GLenum)a[7], (const void *)replayPointer(a[8], payload, payloadSize)); break;
+    case TRACE_glDrawBuffer: glad_glDrawBuffer((GLenum)a[0]); break;
+    case TRACE_glClear: glad_glClear((GLbitfield)a[0]); break;
+    case TRACE_glClearColor: glad_glClearColor(replayFloat(a[0]), replayFloat(a[1]), replayFloat(a[2]), replayFloat(a[3])); break;
+    case TRACE_glClearStencil: glad_glClearStencil((GLint)a[0]); break;
+    case TRACE_glClearDepth: glad_glClearDepth(replayDouble(a[0])); break;
+    case TRACE_glStencilMask: glad_glStencilMask((GLuint)a[0]); break;
+    case TRACE_glColorMask: glad_glColorMask((GLboolean)a[0], (GLboolean)a[1], (GLboolean)a[2], (GLboolean)a[3]); break;
+    case TRACE_glDepthMask: glad_glDepthMask((GLboolean)a[0]); break;
+    case TRACE_glDisable: glad_glDisable((GLenum)a[0]); break;
+    case TRACE_glEnable: glad_glEnable((GLenum)a[0]); break;
+    case TRACE_glFinish: glad_glFinish(); break;
+    case TRACE_glFlush: glad_glFlush(); break;
+    case TRACE_glBlendFunc: glad_glBlendFunc((GLenum)a[0], (GLenum)a[1]); break;
+    case TRACE_glLogicOp: glad_glLogicOp((GLenum)a[0]); break;
+    case TRACE_glStencilFunc: glad_glStencilFunc((GLenum)a[0], (GLint)a[1], (GLuint)a[2]); break;
+    case TRACE_glStencilOp: glad_glStencilOp((GLenum)a[0], (GLenum)a[1], (GLenum)a[2]); break;
+    case TRACE_glDepthFunc: glad_glDepthFunc((GLenum)a[0]); break;
+    case TRACE_glPixelStoref: glad_glPixelStoref((GLenum)a[0], replayFloat(a[1])); break;
+    case TRACE_glPixelStorei: glad_glPixelStorei((GLenum)a[0], (GLint)a[1]); break;
+    case TRACE_glReadBuffer: glad_glReadBuffer((GLenum)a[0]); break;
+    case TRACE_glReadPixels: glad_glReadPixels((GLint)a[0], (GLint)a[1], (GLsizei)a[2], (GLsizei)a[3], (GLenum)a[4], (GLenum)a[5], (void *)replayScratch()); break;
+    case TRACE_glGetBooleanv: glad_glGetBooleanv((GLenum)a[0], (GLboolean *)replayScratch()); break;
+    case TRACE_glGetDoublev: glad_glGetDoublev((GLenum)a[0], (GLdouble *)replayScratch()); break;
+    case TRACE_glGetError: glad_glGetError(); break;
+    case TRACE_glGetFloatv: glad_glGetFloatv((GLenum)a[0], (GLfloat *)replayScratch()); break;
+    case TRACE_glGetIntegerv: glad_glGetIntegerv((GLenum)a[0], (GLint *)replayScratch()); break;
+    case TRACE_glGetString: glad_glGetString((GLenum)a[0]); break;
+    case TRACE_glGetTexImage: glad_glGetTexImage((GLenum)a[0], (GLint)a[1], (GLenum)a[2], (GLenum)a[3], (void *)replayScratch()); break;
+    case TRACE_glGetTexParameterfv: glad_glGetTexParameterfv((GLenum)a[0], (GLenum)a[1], (GLfloat *)replayScratch()); break;
+    case TRACE_glGetTexParameteriv: glad_glGetTexParameteriv((GLenum)a[0], (GLenum)a[1], (GLint *)replayScratch()); break;
+    case TRACE_glGetTexLevelParameterfv: glad_glGetTexLevelParameterfv((GLenum)a[0], (GLint)a[1], (GLenum)a[2], (GLfloat *)replayScratch()); break;
+    case TRACE_glGetTexLevelParameteriv: glad_glGetTexLevelParameteriv((GLenum)a[0], (GLint)a[1], (GLenum)a[2], (GLint *)replayScratch()); break;
+    case TRACE_glIsEnabled: glad_glIsEnabled((GLenum)a[0]); break;
+    case TRACE_glDepthRange: glad_glDepthRange(replayDouble(a[0]), replayDouble(a[1])); break;
+    case TRACE_glViewport: glad_glViewport((GLint)a[0], (GLint)a[1], (GLsizei)a[2], (GLsizei)a[3]); break;
+    case TRACE_glDrawArrays: glad_glDrawArrays((GLenum)a[0], (GLint)a[1], (GLsizei)a[2]); break;
+    case TRACE_glDrawElements: glad_glDrawElements((GLenum)a[0], (GLsizei)a[1], (GLenum)a[2], (const void *)(uintptr_t)a[3]); break;
+    case TRACE_glPolygonOffset: glad_glPolygonOffset(replayFloat(a[0]), replayFloat(a[1])); break;
+    case TRACE_glCopyTexImage1D: glad_glCopyTexImage1D((GLenum)a[0], (GLint)a[1], (GLenum)a[2], (GLint)a[3], (GLint)a[4], (GLsizei)a[5], (GLint)a[6]); break;
+    case TRACE_glCopyTexImage2D: glad_glCopyTexImage2D((GLenum)a[0], (GLint)a[1], (GLenum)a[2], (GLint)a[3], (GLint)a[4], (GLsizei)a[5], (GLsizei)a[6], (GLint)a[7]); break;
+    case TRACE_glCopyTexSubImage1D: glad_glCopyTexSubImage1D((GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3], (GLint)a[4], (GLsizei)a[5]); break;
+    case TRACE_glCopyTexSubImage2D: glad_glCopyTexSubImage2D((GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3], (GLint)a[4], (GLint)a[5], (GLsizei)a[6], (GLsizei)a[7]); break;
+    case TRACE_glTexSubImage1D: glad_glTexSubImage1D((GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLsizei)a[3], (GLenum)a[4], (GLenum)a[5], (const void *)replayScratch()); break;
+    case TRACE_glTexSubImage2D: glad_glTexSubImage2D((GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3], (GLsizei)a[4], (GLsizei)a[5], (GLenum)a[6], (GLenum)a[7], (const void *)replayPointer(a[8], payload, payloadSize)); break;
+    case TRACE_glBindTexture: glad_glBindTexture((GLenum)a[0], replayName(TRACE_NS_TEXTURE, a[1])); break;
+    case TRACE_glDeleteTextures: { std::vector<GLuint> names = replayNames(TRACE_NS_TEXTURE, payload, payloadSize); glad_glDeleteTextures((GLsizei)names.size(), names.data()); } break;
+    case TRACE_glGenTextures: { std::vector<GLuint> names((size_t)std::max<int64_t>(0, (int64_t)a[0])); glad_glGenTextures((GLsizei)names.size(), names.data()); replayBindNames(TRACE_NS_TEXTURE, payload, payloadSize, names); } break;
+    case TRACE_glIsTexture: glad_glIsTexture(replayName(TRACE_NS_TEXTURE, a[0])); break;
+    case TRACE_glDrawRangeElements: glad_glDrawRangeElements((GLenum)a[0], (GLuint)a[1], (GLuint)a[2], (GLsizei)a[3], (GLenum)a[4], (const void *)(uintptr_t)a[5]); break;
+    case TRACE_glTexImage3D: glad_glTexImage3D((GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLsizei)a[3], (GLsizei)a[4], (GLsizei)a[5], (GLint)a[6], (GLenum)a[7], (GLenum)a[8], (const void *)replayScratch()); break;
+    case TRACE_glTexSubImage3D: glad_glTexSubImage3D((GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3], (GLint)a[4], (GLsizei)a[5], (GLsizei)a[6], (GLsizei)a[7], (GLenum)a[8], (GLenum)a[9], (const void *)replayScratch()); break;
+    case TRACE_glCopyTexSubImage3D: glad_glCopyTexSubImage3D((GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3], (GLint)a[4], (GLint)a[5], (GLint)a[6], (GLsizei)a[7], (GLsizei)a[8]); break;
+    case TRACE_glActiveTexture: glad_glActiveTexture((GLenum)a[0]); break;
+    case TRACE_glSampleCoverage: glad_glSampleCoverage(replayFloat(a[0]), (GLboolean)a[1]); break;
+    case TRACE_glCompressedTexImage3D: glad_glCompressedTexImage3D((GLenum)a[0], (GLint)a[1], (GLenum)a[2], (GLsizei)a[3], (GLsizei)a[4], (GLsizei)a[5], (GLint)a[6], (GLsizei)a[7], (const void *)replayScratch()); break;
+    case TRACE_glCompressedTexImage2D: glad_glCompressedTexImage2D((GLenum)a[0], (GLint)a[1], (GLenum)a[2], (GLsizei)a[3], (GLsizei)a[4], (GLint)a[5], (GLsizei)a[6], (const void *)replayPointer(a[7], payload, payloadSize)); break;
+    case TRACE_glCompressedTexImage1D: glad_glCompressedTexImage1D((GLenum)a[0], (GLint)a[1], (GLenum)a[2], (GLsizei)a[3], (GLint)a[4], (GLsizei)a[5], (const void *)replayScratch()); break;
+    case TRACE_glCompressedTexSubImage3D: glad_glCompressedTexSubImage3D((GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3], (GLint)a[4], (GLsizei)a[5], (GLsizei)a[6], (GLsizei)a[7], (GLenum)a[8], (GLsizei)a[9], (const void *)replayScratch()); break;
+    case TRACE_glCompressedTexSubImage2D: glad_glCompressedTexSubImage2D((GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3], (GLsizei)a[4], (GLsizei)a[5], (GLenum)a[6], (GLsizei)a[7], (const void *)replayPointer(a[8], payload, payloadSize)); break;
+    case TRACE_glCompressedTexSubImage1D: glad_glCompressedTexSubImage1D((GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLsizei)a[3], (GLenum)a[4], (GLsizei)a[5], (const void *)replayScratch()); break;
+    case TRACE_glGetCompressedTexImage: glad_glGetCompressedTexImage((GLenum)a[0], (GLint)a[1], (void *)replayScratch()); break;
+    case TRACE_glBlendFuncSeparate: glad_glBlendFuncSeparate((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], (GLenum)a[3]); break;
+    case TRACE_glMultiDrawArrays: glad_glMultiDrawArrays((GLenum)a[0], (const GLint *)replayScratch(), (const GLsizei *)replayScratch(), (GLsizei)a[3]); break;
+    case TRACE_glMultiDrawElements: glad_glMultiDrawElements((GLenum)a[0], (const GLsizei *)replayScratch(), (GLenum)a[2], (const void *const*)(uintptr_t)a[3], (GLsizei)a[4]); break;
+    case TRACE_glPointParameterf: glad_glPointParameterf((GLenum)a[0], replayFloat(a[1])); break;
+    case TRACE_glPointParameterfv: glad_glPointParameterfv((GLenum)a[0], (const GLfloat *)replayScratch()); break;
+    case TRACE_glPointParameteri: glad_glPointParameteri((GLenum)a[0], (GLint)a[1]); break;
+    case TRACE_glPointParameteriv: glad_glPointParameteriv((GLenum)a[0], (const GLint *)replayScratch()); break;
+    case TRACE_glBlendColor: glad_glBlendColor(replayFloat(a[0]), replayFloat(a[1]), replayFloat(a[2]), replayFloat(a[3])); break;
+    case TRACE_glBlendEquation: glad_glBlendEquation((GLenum)a[0]); break;
+    case TRACE_glGenQueries: { std::vector<GLuint> names((size_t)std::max<int64_t>(0, (int64_t)a[0])); glad_glGenQueries((GLsizei)names.size(), names.data()); replayBindNames(TRACE_NS_QUERY, payload, payloadSize, names); } break;
+    case TRACE_glDeleteQueries: { std::vector<GLuint> names = replayNames(TRACE_NS_QUERY, payload, payloadSize); glad_glDeleteQueries((GLsizei)names.size(), names.data()); } break;
+    case TRACE_glIsQuery: glad_glIsQuery(replayName(TRACE_NS_QUERY, a[0])); break;
+    case TRACE_glBeginQuery: glad_glBeginQuery((GLenum)a[0], replayName(TRACE_NS_QUERY, a[1])); break;
+    case TRACE_glEndQuery: glad_glEndQuery((GLenum)a[0]); break;
+    case TRACE_glGetQueryiv: glad_glGetQueryiv((GLenum)a[0], (GLenum)a[1], (GLint *)replayScratch()); break;
+    case TRACE_glGetQueryObjectiv: glad_glGetQueryObjectiv(replayName(TRACE_NS_QUERY, a[0]), (GLenum)a[1], (GLint *)replayScratch()); break;
+    case TRACE_glGetQueryObjectuiv: glad_glGetQueryObjectuiv(replayName(TRACE_NS_QUERY, a[0]), (GLenum)a[1], (GLuint *)replayScratch()); break;
+    case TRACE_glBindBuffer: glad_glBindBuffer((GLenum)a[0], replayName(TRACE_NS_BUFFER, a[1])); break;
+    case TRACE_glDeleteBuffers: { std::vector<GLuint> names = replayNames(TRACE_NS_BUFFER, payload, payloadSize); glad_glDeleteBuffers((GLsizei)names.size(), names.data()); } break;
+    case TRACE_glGenBuffers: { std::vector<GLuint> names((size_t)std::max<int64_t>(0, (int64_t)a[0])); glad_glGenBuffers((GLsizei)names.size(), names.data()); replayBindNames(TRACE_NS_BUFFER, payload, payloadSize, names); } break;
+    case TRACE_glIsBuffer: glad_glIsBuffer(replayName(TRACE_NS_BUFFER, a[0])); break;
+    case TRACE_glBufferData: glad_glBufferData((GLenum)a[0], (GLsizeiptr)a[1], (const void *)replayPointer(a[2], payload, payloadSize), (GLenum)a[3]); break;
+    case TRACE_glBufferSubData: glad_glBufferSubData((GLenum)a[0], (GLintptr)a[1], (GLsizeiptr)a[2], (const void *)replayPointer(a[3], payload, payloadSize)); break;
+    case TRACE_glGetBufferSubData: glad_glGetBufferSubData((GLenum)a[0], (GLintptr)a[1], (GLsizeiptr)a[2], (void *)replayScratch()); break;
+    case TRACE_glMapBuffer: replay_glMapBuffer(a, payload, payloadSize, result); break;
+    case TRACE_glUnmapBuffer: replay_glUnmapBuffer(a, payload, payloadSize, result); break;
+    case TRACE_glGetBufferParameteriv: glad_glGetBufferParameteriv((GLenum)a[0], (GLenum)a[1], (GLint *)replayScratch()); break;
+    case TRACE_glGetBufferPointerv: glad_glGetBufferPointerv((GLenum)a[0], (GLenum)a[1], (void **)replayScratch()); break;
+    case TRACE_glBlendEquationSeparate: glad_glBlendEquationSeparate((GLenum)a[0], (GLenum)a[1]); break;
+    case TRACE_glDrawBuffers: glad_glDrawBuffers((GLsizei)a[0], (const GLenum *)replayPointer(a[1], payload, payloadSize)); break;
+    case TRACE_glStencilOpSeparate: glad_glStencilOpSeparate((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], (GLenum)a[3]); break;
+    case TRACE_glStencilFuncSeparate: glad_glStencilFuncSeparate((GLenum)a[0], (GLenum)a[1], (GLint)a[2], (GLuint)a[3]); break;
+    case TRACE_glStencilMaskSeparate: glad_glStencilMaskSeparate((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glAttachShader: glad_glAttachShader(replayName(TRACE_NS_PROGRAM, a[0]), replayName(TRACE_NS_SHADER, a[1])); break;
+    case TRACE_glBindAttribLocation: glad_glBindAttribLocation(replayName(TRACE_NS_PROGRAM, a[0]), (GLuint)a[1], (const GLchar *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glCompileShader: glad_glCompileShader(replayName(TRACE_NS_SHADER, a[0])); break;
+    case TRACE_glCreateProgram: replayBindName(TRACE_NS_PROGRAM, result, glad_glCreateProgram()); break;
+    case TRACE_glCreateShader: replayBindName(TRACE_NS_SHADER, result, glad_glCreateShader((GLenum)a[0])); break;
+    case TRACE_glDeleteProgram: glad_glDeleteProgram(replayName(TRACE_NS_PROGRAM, a[0])); break;
+    case TRACE_glDeleteShader: glad_glDeleteShader(replayName(TRACE_NS_SHADER, a[0])); break;
+    case TRACE_glDetachShader: glad_glDetachShader(replayName(TRACE_NS_PROGRAM, a[0]), replayName(TRACE_NS_SHADER, a[1])); break;
+    case TRACE_glDisableVertexAttribArray: glad_glDisableVertexAttribArray((GLuint)a[0]); break;
+    case TRACE_glEnableVertexAttribArray: glad_glEnableVertexAttribArray((GLuint)a[0]); break;
+    case TRACE_glGetActiveAttrib: glad_glGetActiveAttrib(replayName(TRACE_NS_PROGRAM, a[0]), (GLuint)a[1], (GLsizei)a[2], (GLsizei *)replayScratch(), (GLint *)replayScratch(), (GLenum *)replayScratch(), (GLchar *)replayScratch()); break;
+    case TRACE_glGetActiveUniform: glad_glGetActiveUniform(replayName(TRACE_NS_PROGRAM, a[0]), (GLuint)a[1], (GLsizei)a[2], (GLsizei *)replayScratch(), (GLint *)replayScratch(), (GLenum *)replayScratch(), (GLchar *)replayScratch()); break;
+    case TRACE_glGetAttachedShaders: glad_glGetAttachedShaders(replayName(TRACE_NS_PROGRAM, a[0]), (GLsizei)a[1], (GLsizei *)replayScratch(), (GLuint *)replayScratch()); break;
+    case TRACE_glGetAttribLocation: glad_glGetAttribLocation(replayName(TRACE_NS_PROGRAM, a[0]), (const GLchar *)replayPointer(a[1], payload, payloadSize)); break;
+    case TRACE_glGetProgramiv: glad_glGetProgramiv(replayName(TRACE_NS_PROGRAM, a[0]), (GLenum)a[1], (GLint *)replayScratch()); break;
+    case TRACE_glGetProgramInfoLog: glad_glGetProgramInfoLog(replayName(TRACE_NS_PROGRAM, a[0]), (GLsizei)a[1], (GLsizei *)replayScratch(), (GLchar *)replayScratch()); break;
+    case TRACE_glGetShaderiv: glad_glGetShaderiv(replayName(TRACE_NS_SHADER, a[0]), (GLenum)a[1], (GLint *)replayScratch()); break;
+    case TRACE_glGetShaderInfoLog: glad_glGetShaderInfoLog(replayName(TRACE_NS_SHADER, a[0]), (GLsizei)a[1], (GLsizei *)replayScratch(), (GLchar *)replayScratch()); break;
+    case TRACE_glGetShaderSource: glad_glGetShaderSource(replayName(TRACE_NS_SHADER, a[0]), (GLsizei)a[1], (GLsizei *)replayScratch(), (GLchar *)replayScratch()); break;
+    case TRACE_glGetUniformLocation: replay_glGetUniformLocation(a, payload, payloadSize, result); break;
+    case TRACE_glGetUniformfv: glad_glGetUniformfv(replayName(TRACE_NS_PROGRAM, a[0]), replayLocation(a[1]), (GLfloat *)replayScratch()); break;
+    case TRACE_glGetUniformiv: glad_glGetUniformiv(replayName(TRACE_NS_PROGRAM, a[0]), replayLocation(a[1]), (GLint *)replayScratch()); break;
+    case TRACE_glGetVertexAttribdv: glad_glGetVertexAttribdv((GLuint)a[0], (GLenum)a[1], (GLdouble *)replayScratch()); break;
+    case TRACE_glGetVertexAttribfv: glad_glGetVertexAttribfv((GLuint)a[0], (GLenum)a[1], (GLfloat *)replayScratch()); break;
+    case TRACE_glGetVertexAttribiv: glad_glGetVertexAttribiv((GLuint)a[0], (GLenum)a[1], (GLint *)replayScratch()); break;
+    case TRACE_glGetVertexAttribPointerv: glad_glGetVertexAttribPointerv((GLuint)a[0], (GLenum)a[1], (void **)(uintptr_t)a[2]); break;
+    case TRACE_glIsProgram: glad_glIsProgram(replayName(TRACE_NS_PROGRAM, a[0])); break;
+    case TRACE_glIsShader: glad_glIsShader(replayName(TRACE_NS_SHADER, a[0])); break;
+    case TRACE_glLinkProgram: glad_glLinkProgram(replayName(TRACE_NS_PROGRAM, a[0])); break;
+    case TRACE_glShaderSource: replay_glShaderSource(a, payload, payloadSize, result); break;
+    case TRACE_glUseProgram: replay_glUseProgram(a, payload, payloadSize, result); break;
+    case TRACE_glUniform1f: glad_glUniform1f(replayLocation(a[0]), replayFloat(a[1])); break;
+    case TRACE_glUniform2f: glad_glUniform2f(replayLocation(a[0]), replayFloat(a[1]), replayFloat(a[2])); break;
+    case TRACE_glUniform3f: glad_glUniform3f(replayLocation(a[0]), replayFloat(a[1]), replayFloat(a[2]), replayFloat(a[3])); break;
+    case TRACE_glUniform4f: glad_glUniform4f(replayLocation(a[0]), replayFloat(a[1]), replayFloat(a[2]), replayFloat(a[3]), replayFloat(a[4])); break;
+    case TRACE_glUniform1i: glad_glUniform1i(replayLocation(a[0]), (GLint)a[1]); break;
+    case TRACE_glUniform2i: glad_glUniform2i(replayLocation(a[0]), (GLint)a[1], (GLint)a[2]); break;
+    case TRACE_glUniform3i: glad_glUniform3i(replayLocation(a[0]), (GLint)a[1], (GLint)a[2], (GLint)a[3]); break;
+    case TRACE_glUniform4i: glad_glUniform4i(replayLocation(a[0]), (GLint)a[1], (GLint)a[2], (GLint)a[3], (GLint)a[4]); break;
+    case TRACE_glUniform1fv: glad_glUniform1fv(replayLocation(a[0]), (GLsizei)a[1], (const GLfloat *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glUniform2fv: glad_glUniform2fv(replayLocation(a[0]), (GLsizei)a[1], (const GLfloat *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glUniform3fv: glad_glUniform3fv(replayLocation(a[0]), (GLsizei)a[1], (const GLfloat *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glUniform4fv: glad_glUniform4fv(replayLocation(a[0]), (GLsizei)a[1], (const GLfloat *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glUniform1iv: glad_glUniform1iv(replayLocation(a[0]), (GLsizei)a[1], (const GLint *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glUniform2iv: glad_glUniform2iv(replayLocation(a[0]), (GLsizei)a[1], (const GLint *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glUniform3iv: glad_glUniform3iv(replayLocation(a[0]), (GLsizei)a[1], (const GLint *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glUniform4iv: glad_glUniform4iv(replayLocation(a[0]), (GLsizei)a[1], (const GLint *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glUniformMatrix2fv: glad_glUniformMatrix2fv(replayLocation(a[0]), (GLsizei)a[1], (GLboolean)a[2], (const GLfloat *)replayPointer(a[3], payload, payloadSize)); break;
+    case TRACE_glUniformMatrix3fv: glad_glUniformMatrix3fv(replayLocation(a[0]), (GLsizei)a[1], (GLboolean)a[2], (const GLfloat *)replayPointer(a[3], payload, payloadSize)); break;
+    case TRACE_glUniformMatrix4fv: glad_glUniformMatrix4fv(replayLocation(a[0]), (GLsizei)a[1], (GLboolean)a[2], (const GLfloat *)replayPointer(a[3], payload, payloadSize)); break;
+    case TRACE_glValidateProgram: glad_glValidateProgram(replayName(TRACE_NS_PROGRAM, a[0])); break;
+    case TRACE_glVertexAttrib1d: glad_glVertexAttrib1d((GLuint)a[0], replayDouble(a[1])); break;
+    case TRACE_glVertexAttrib1dv: glad_glVertexAttrib1dv((GLuint)a[0], (const GLdouble *)replayScratch()); break;
+    case TRACE_glVertexAttrib1f: glad_glVertexAttrib1f((GLuint)a[0], replayFloat(a[1])); break;
+    case TRACE_glVertexAttrib1fv: glad_glVertexAttrib1fv((GLuint)a[0], (const GLfloat *)replayScratch()); break;
+    case TRACE_glVertexAttrib1s: glad_glVertexAttrib1s((GLuint)a[0], (GLshort)a[1]); break;
+    case TRACE_glVertexAttrib1sv: glad_glVertexAttrib1sv((GLuint)a[0], (const GLshort *)replayScratch()); break;
+    case TRACE_glVertexAttrib2d: glad_glVertexAttrib2d((GLuint)a[0], replayDouble(a[1]), replayDouble(a[2])); break;
+    case TRACE_glVertexAttrib2dv: glad_glVertexAttrib2dv((GLuint)a[0], (const GLdouble *)replayScratch()); break;
+    case TRACE_glVertexAttrib2f: glad_glVertexAttrib2f((GLuint)a[0], replayFloat(a[1]), replayFloat(a[2])); break;
+    case TRACE_glVertexAttrib2fv: glad_glVertexAttrib2fv((GLuint)a[0], (const GLfloat *)replayScratch()); break;
+    case TRACE_glVertexAttrib2s: glad_glVertexAttrib2s((GLuint)a[0], (GLshort)a[1], (GLshort)a[2]); break;
+    case TRACE_glVertexAttrib2sv: glad_glVertexAttrib2sv((GLuint)a[0], (const GLshort *)replayScratch()); break;
+    case TRACE_glVertexAttrib3d: glad_glVertexAttrib3d((GLuint)a[0], replayDouble(a[1]), replayDouble(a[2]), replayDouble(a[3])); break;
+    case TRACE_glVertexAttrib3dv: glad_glVertexAttrib3dv((GLuint)a[0], (const GLdouble *)replayScratch()); break;
+    case TRACE_glVertexAttrib3f: glad_glVertexAttrib3f((GLuint)a[0], replayFloat(a[1]), replayFloat(a[2]), replayFloat(a[3])); break;
+    case TRACE_glVertexAttrib3fv: glad_glVertexAttrib3fv((GLuint)a[0], (const GLfloat *)replayScratch()); break;
+    case TRACE_glVertexAttrib3s: glad_glVertexAttrib3s((GLuint)a[0], (GLshort)a[1], (GLshort)a[2], (GLshort)a[3]); break;
+    case TRACE_glVertexAttrib3sv: glad_glVertexAttrib3sv((GLuint)a[0], (const GLshort *)replayScratch()); break;
+    case TRACE_glVertexAttrib4Nbv: glad_glVertexAttrib4Nbv((GLuint)a[0], (const GLbyte *)replayScratch()); break;
+    case TRACE_glVertexAttrib4Niv: glad_glVertexAttrib4Niv((GLuint)a[0], (const GLint *)replayScratch()); break;
+    case TRACE_glVertexAttrib4Nsv: glad_glVertexAttrib4Nsv((GLuint)a[0], (const GLshort *)replayScratch()); break;
+    case TRACE_glVertexAttrib4Nub: glad_glVertexAttrib4Nub((GLuint)a[0], (GLubyte)a[1], (GLubyte)a[2], (GLubyte)a[3], (GLubyte)a[4]); break;
+    case TRACE_glVertexAttrib4Nubv: glad_glVertexAttrib4Nubv((GLuint)a[0], (const GLubyte *)replayScratch()); break;
+    case TRACE_glVertexAttrib4Nuiv: glad_glVertexAttrib4Nuiv((GLuint)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glVertexAttrib4Nusv: glad_glVertexAttrib4Nusv((GLuint)a[0], (const GLushort *)replayScratch()); break;
+    case TRACE_glVertexAttrib4bv: glad_glVertexAttrib4bv((GLuint)a[0], (const GLbyte *)replayScratch()); break;
+    case TRACE_glVertexAttrib4d: glad_glVertexAttrib4d((GLuint)a[0], replayDouble(a[1]), replayDouble(a[2]), replayDouble(a[3]), replayDouble(a[4])); break;
+    case TRACE_glVertexAttrib4dv: glad_glVertexAttrib4dv((GLuint)a[0], (const GLdouble *)replayScratch()); break;
+    case TRACE_glVertexAttrib4f: glad_glVertexAttrib4f((GLuint)a[0], replayFloat(a[1]), replayFloat(a[2]), replayFloat(a[3]), replayFloat(a[4])); break;
+    case TRACE_glVertexAttrib4fv: glad_glVertexAttrib4fv((GLuint)a[0], (const GLfloat *)replayScratch()); break;
+    case TRACE_glVertexAttrib4iv: glad_glVertexAttrib4iv((GLuint)a[0], (const GLint *)replayScratch()); break;
+    case TRACE_glVertexAttrib4s: glad_glVertexAttrib4s((GLuint)a[0], (GLshort)a[1], (GLshort)a[2], (GLshort)a[3], (GLshort)a[4]); break;
+    case TRACE_glVertexAttrib4sv: glad_glVertexAttrib4sv((GLuint)a[0], (const GLshort *)replayScratch()); break;
+    case TRACE_glVertexAttrib4ubv: glad_glVertexAttrib4ubv((GLuint)a[0], (const GLubyte *)replayScratch()); break;
+    case TRACE_glVertexAttrib4uiv: glad_glVertexAttrib4uiv((GLuint)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glVertexAttrib4usv: glad_glVertexAttrib4usv((GLuint)a[0], (const GLushort *)replayScratch()); break;
+    case TRACE_glVertexAttribPointer: glad_glVertexAttribPointer((GLuint)a[0], (GLint)a[1], (GLenum)a[2], (GLboolean)a[3], (GLsizei)a[4], (const void *)(uintptr_t)a[5]); break;
+    case TRACE_glUniformMatrix2x3fv: glad_glUniformMatrix2x3fv(replayLocation(a[0]), (GLsizei)a[1], (GLboolean)a[2], (const GLfloat *)replayPointer(a[3], payload, payloadSize)); break;
+    case TRACE_glUniformMatrix3x2fv: glad_glUniformMatrix3x2fv(replayLocation(a[0]), (GLsizei)a[1], (GLboolean)a[2], (const GLfloat *)replayPointer(a[3], payload, payloadSize)); break;
+    case TRACE_glUniformMatrix2x4fv: glad_glUniformMatrix2x4fv(replayLocation(a[0]), (GLsizei)a[1], (GLboolean)a[2], (const GLfloat *)replayPointer(a[3], payload, payloadSize)); break;
+    case TRACE_glUniformMatrix4x2fv: glad_glUniformMatrix4x2fv(replayLocation(a[0]), (GLsizei)a[1], (GLboolean)a[2], (const GLfloat *)replayPointer(a[3], payload, payloadSize)); break;
+    case TRACE_glUniformMatrix3x4fv: glad_glUniformMatrix3x4fv(replayLocation(a[0]), (GLsizei)a[1], (GLboolean)a[2], (const GLfloat *)replayPointer(a[3], payload, payloadSize)); break;
+    case TRACE_glUniformMatrix4x3fv: glad_glUniformMatrix4x3fv(replayLocation(a[0]), (GLsizei)a[1], (GLboolean)a[2], (const GLfloat *)replayPointer(a[3], payload, payloadSize)); break;
+    case TRACE_glColorMaski: glad_glColorMaski((GLuint)a[0], (GLboolean)a[1], (GLboolean)a[2], (GLboolean)a[3], (GLboolean)a[4]); break;
+    case TRACE_glGetBooleani_v: glad_glGetBooleani_v((GLenum)a[0], (GLuint)a[1], (GLboolean *)replayScratch()); break;
+    case TRACE_glGetIntegeri_v: glad_glGetIntegeri_v((GLenum)a[0], (GLuint)a[1], (GLint *)replayScratch()); break;
+    case TRACE_glEnablei: glad_glEnablei((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glDisablei: glad_glDisablei((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glIsEnabledi: glad_glIsEnabledi((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glBeginTransformFeedback: glad_glBeginTransformFeedback((GLenum)a[0]); break;
+    case TRACE_glEndTransformFeedback: glad_glEndTransformFeedback(); break;
+    case TRACE_glBindBufferRange: glad_glBindBufferRange((GLenum)a[0], (GLuint)a[1], replayName(TRACE_NS_BUFFER, a[2]), (GLintptr)a[3], (GLsizeiptr)a[4]); break;
+    case TRACE_glBindBufferBase: glad_glBindBufferBase((GLenum)a[0], (GLuint)a[1], replayName(TRACE_NS_BUFFER, a[2])); break;
+    case TRACE_glTransformFeedbackVaryings: glad_glTransformFeedbackVaryings(replayName(TRACE_NS_PROGRAM, a[0]), (GLsizei)a[1], (const GLchar *const*)replayScratch(), (GLenum)a[3]); break;
+    case TRACE_glGetTransformFeedbackVarying: glad_glGetTransformFeedbackVarying(replayName(TRACE_NS_PROGRAM, a[0]), (GLuint)a[1], (GLsizei)a[2], (GLsizei *)replayScratch(), (GLsizei *)replayScratch(), (GLenum *)replayScratch(), (GLchar *)replayScratch()); break;
+    case TRACE_glClampColor: glad_glClampColor((GLenum)a[0], (GLenum)a[1]); break;
+    case TRACE_glBeginConditionalRender: glad_glBeginConditionalRender(replayName(TRACE_NS_QUERY, a[0]), (GLenum)a[1]); break;
+    case TRACE_glEndConditionalRender: glad_glEndConditionalRender(); break;
+    case TRACE_glVertexAttribIPointer: glad_glVertexAttribIPointer((GLuint)a[0], (GLint)a[1], (GLenum)a[2], (GLsizei)a[3], (const void *)(uintptr_t)a[4]); break;
+    case TRACE_glGetVertexAttribIiv: glad_glGetVertexAttribIiv((GLuint)a[0], (GLenum)a[1], (GLint *)replayScratch()); break;
+    case TRACE_glGetVertexAttribIuiv: glad_glGetVertexAttribIuiv((GLuint)a[0], (GLenum)a[1], (GLuint *)replayScratch()); break;
+    case TRACE_glVertexAttribI1i: glad_glVertexAttribI1i((GLuint)a[0], (GLint)a[1]); break;
+    case TRACE_glVertexAttribI2i: glad_glVertexAttribI2i((GLuint)a[0], (GLint)a[1], (GLint)a[2]); break;
+    case TRACE_glVertexAttribI3i: glad_glVertexAttribI3i((GLuint)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3]); break;
+    case TRACE_glVertexAttribI4i: glad_glVertexAttribI4i((GLuint)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3], (GLint)a[4]); break;
+    case TRACE_glVertexAttribI1ui: glad_glVertexAttribI1ui((GLuint)a[0], (GLuint)a[1]); break;
+    case TRACE_glVertexAttribI2ui: glad_glVertexAttribI2ui((GLuint)a[0], (GLuint)a[1], (GLuint)a[2]); break;
+    case TRACE_glVertexAttribI3ui: glad_glVertexAttribI3ui((GLuint)a[0], (GLuint)a[1], (GLuint)a[2], (GLuint)a[3]); break;
+    case TRACE_glVertexAttribI4ui: glad_glVertexAttribI4ui((GLuint)a[0], (GLuint)a[1], (GLuint)a[2], (GLuint)a[3], (GLuint)a[4]); break;
+    case TRACE_glVertexAttribI1iv: glad_glVertexAttribI1iv((GLuint)a[0], (const GLint *)replayScratch()); break;
+    case TRACE_glVertexAttribI2iv: glad_glVertexAttribI2iv((GLuint)a[0], (const GLint *)replayScratch()); break;
+    case TRACE_glVertexAttribI3iv: glad_glVertexAttribI3iv((GLuint)a[0], (const GLint *)replayScratch()); break;
+    case TRACE_glVertexAttribI4iv: glad_glVertexAttribI4iv((GLuint)a[0], (const GLint *)replayScratch()); break;
+    case TRACE_glVertexAttribI1uiv: glad_glVertexAttribI1uiv((GLuint)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glVertexAttribI2uiv: glad_glVertexAttribI2uiv((GLuint)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glVertexAttribI3uiv: glad_glVertexAttribI3uiv((GLuint)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glVertexAttribI4uiv: glad_glVertexAttribI4uiv((GLuint)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glVertexAttribI4bv: glad_glVertexAttribI4bv((GLuint)a[0], (const GLbyte *)replayScratch()); break;
+    case TRACE_glVertexAttribI4sv: glad_glVertexAttribI4sv((GLuint)a[0], (const GLshort *)replayScratch()); break;
+    case TRACE_glVertexAttribI4ubv: glad_glVertexAttribI4ubv((GLuint)a[0], (const GLubyte *)replayScratch()); break;
+    case TRACE_glVertexAttribI4usv: glad_glVertexAttribI4usv((GLuint)a[0], (const GLushort *)replayScratch()); break;
+    case TRACE_glGetUniformuiv: glad_glGetUniformuiv(replayName(TRACE_NS_PROGRAM, a[0]), replayLocation(a[1]), (GLuint *)replayScratch()); break;
+    case TRACE_glBindFragDataLocation: glad_glBindFragDataLocation(replayName(TRACE_NS_PROGRAM, a[0]), (GLuint)a[1], (const GLchar *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glGetFragDataLocation: glad_glGetFragDataLocation(replayName(TRACE_NS_PROGRAM, a[0]), (const GLchar *)replayScratch()); break;
+    case TRACE_glUniform1ui: glad_glUniform1ui(replayLocation(a[0]), (GLuint)a[1]); break;
+    case TRACE_glUniform2ui: glad_glUniform2ui(replayLocation(a[0]), (GLuint)a[1], (GLuint)a[2]); break;
+    case TRACE_glUniform3ui: glad_glUniform3ui(replayLocation(a[0]), (GLuint)a[1], (GLuint)a[2], (GLuint)a[3]); break;
+    case TRACE_glUniform4ui: glad_glUniform4ui(replayLocation(a[0]), (GLuint)a[1], (GLuint)a[2], (GLuint)a[3], (GLuint)a[4]); break;
+    case TRACE_glUniform1uiv: glad_glUniform1uiv(replayLocation(a[0]), (GLsizei)a[1], (const GLuint *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glUniform2uiv: glad_glUniform2uiv(replayLocation(a[0]), (GLsizei)a[1], (const GLuint *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glUniform3uiv: glad_glUniform3uiv(replayLocation(a[0]), (GLsizei)a[1], (const GLuint *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glUniform4uiv: glad_glUniform4uiv(replayLocation(a[0]), (GLsizei)a[1], (const GLuint *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glTexParameterIiv: glad_glTexParameterIiv((GLenum)a[0], (GLenum)a[1], (const GLint *)replayScratch()); break;
+    case TRACE_glTexParameterIuiv: glad_glTexParameterIuiv((GLenum)a[0], (GLenum)a[1], (const GLuint *)replayScratch()); break;
+    case TRACE_glGetTexParameterIiv: glad_glGetTexParameterIiv((GLenum)a[0], (GLenum)a[1], (GLint *)replayScratch()); break;
+    case TRACE_glGetTexParameterIuiv: glad_glGetTexParameterIuiv((GLenum)a[0], (GLenum)a[1], (GLuint *)replayScratch()); break;
+    case TRACE_glClearBufferiv: glad_glClearBufferiv((GLenum)a[0], (GLint)a[1], (const GLint *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glClearBufferuiv: glad_glClearBufferuiv((GLenum)a[0], (GLint)a[1], (const GLuint *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glClearBufferfv: glad_glClearBufferfv((GLenum)a[0], (GLint)a[1], (const GLfloat *)replayPointer(a[2], payload, payloadSize)); break;
+    case TRACE_glClearBufferfi: glad_glClearBufferfi((GLenum)a[0], (GLint)a[1], replayFloat(a[2]), (GLint)a[3]); break;
+    case TRACE_glGetStringi: glad_glGetStringi((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glIsRenderbuffer: glad_glIsRenderbuffer(replayName(TRACE_NS_RENDERBUFFER, a[0])); break;
+    case TRACE_glBindRenderbuffer: glad_glBindRenderbuffer((GLenum)a[0], replayName(TRACE_NS_RENDERBUFFER, a[1])); break;
+    case TRACE_glDeleteRenderbuffers: { std::vector<GLuint> names = replayNames(TRACE_NS_RENDERBUFFER, payload, payloadSize); glad_glDeleteRenderbuffers((GLsizei)names.size(), names.data()); } break;
+    case TRACE_glGenRenderbuffers: { std::vector<GLuint> names((size_t)std::max<int64_t>(0, (int64_t)a[0])); glad_glGenRenderbuffers((GLsizei)names.size(), names.data()); replayBindNames(TRACE_NS_RENDERBUFFER, payload, payloadSize, names); } break;
+    case TRACE_glRenderbufferStorage: glad_glRenderbufferStorage((GLenum)a[0], (GLenum)a[1], (GLsizei)a[2], (GLsizei)a[3]); break;
+    case TRACE_glGetRenderbufferParameteriv: glad_glGetRenderbufferParameteriv((GLenum)a[0], (GLenum)a[1], (GLint *)replayScratch()); break;
+    case TRACE_glIsFramebuffer: glad_glIsFramebuffer(replayName(TRACE_NS_FRAMEBUFFER, a[0])); break;
+    case TRACE_glBindFramebuffer: glad_glBindFramebuffer((GLenum)a[0], replayName(TRACE_NS_FRAMEBUFFER, a[1])); break;
+    case TRACE_glDeleteFramebuffers: { std::vector<GLuint> names = replayNames(TRACE_NS_FRAMEBUFFER, payload, payloadSize); glad_glDeleteFramebuffers((GLsizei)names.size(), names.data()); } break;
+    case TRACE_glGenFramebuffers: { std::vector<GLuint> names((size_t)std::max<int64_t>(0, (int64_t)a[0])); glad_glGenFramebuffers((GLsizei)names.size(), names.data()); replayBindNames(TRACE_NS_FRAMEBUFFER, payload, payloadSize, names); } break;
+    case TRACE_glCheckFramebufferStatus: glad_glCheckFramebufferStatus((GLenum)a[0]); break;
+    case TRACE_glFramebufferTexture1D: glad_glFramebufferTexture1D((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], replayName(TRACE_NS_TEXTURE, a[3]), (GLint)a[4]); break;
+    case TRACE_glFramebufferTexture2D: glad_glFramebufferTexture2D((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], replayName(TRACE_NS_TEXTURE, a[3]), (GLint)a[4]); break;
+    case TRACE_glFramebufferTexture3D: glad_glFramebufferTexture3D((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], replayName(TRACE_NS_TEXTURE, a[3]), (GLint)a[4], (GLint)a[5]); break;
+    case TRACE_glFramebufferRenderbuffer: glad_glFramebufferRenderbuffer((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], replayName(TRACE_NS_RENDERBUFFER, a[3])); break;
+    case TRACE_glGetFramebufferAttachmentParameteriv: glad_glGetFramebufferAttachmentParameteriv((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], (GLint *)replayScratch()); break;
+    case TRACE_glGenerateMipmap: glad_glGenerateMipmap((GLenum)a[0]); break;
+    case TRACE_glBlitFramebuffer: glad_glBlitFramebuffer((GLint)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3], (GLint)a[4], (GLint)a[5], (GLint)a[6], (GLint)a[7], (GLbitfield)a[8], (GLenum)a[9]); break;
+    case TRACE_glRenderbufferStorageMultisample: glad_glRenderbufferStorageMultisample((GLenum)a[0], (GLsizei)a[1], (GLenum)a[2], (GLsizei)a[3], (GLsizei)a[4]); break;
+    case TRACE_glFramebufferTextureLayer: glad_glFramebufferTextureLayer((GLenum)a[0], (GLenum)a[1], replayName(TRACE_NS_TEXTURE, a[2]), (GLint)a[3], (GLint)a[4]); break;
+    case TRACE_glMapBufferRange: replay_glMapBufferRange(a, payload, payloadSize, result); break;
+    case TRACE_glFlushMappedBufferRange: glad_glFlushMappedBufferRange((GLenum)a[0], (GLintptr)a[1], (GLsizeiptr)a[2]); break;
+    case TRACE_glBindVertexArray: glad_glBindVertexArray(replayName(TRACE_NS_VERTEX_ARRAY, a[0])); break;
+    case TRACE_glDeleteVertexArrays: { std::vector<GLuint> names = replayNames(TRACE_NS_VERTEX_ARRAY, payload, payloadSize); glad_glDeleteVertexArrays((GLsizei)names.size(), names.data()); } break;
+    case TRACE_glGenVertexArrays: { std::vector<GLuint> names((size_t)std::max<int64_t>(0, (int64_t)a[0])); glad_glGenVertexArrays((GLsizei)names.size(), names.data()); replayBindNames(TRACE_NS_VERTEX_ARRAY, payload, payloadSize, names); } break;
+    case TRACE_glIsVertexArray: glad_glIsVertexArray(replayName(TRACE_NS_VERTEX_ARRAY, a[0])); break;
+    case TRACE_glDrawArraysInstanced: glad_glDrawArraysInstanced((GLenum)a[0], (GLint)a[1], (GLsizei)a[2], (GLsizei)a[3]); break;
+    case TRACE_glDrawElementsInstanced: glad_glDrawElementsInstanced((GLenum)a[0], (GLsizei)a[1], (GLenum)a[2], (const void *)(uintptr_t)a[3], (GLsizei)a[4]); break;
+    case TRACE_glTexBuffer: glad_glTexBuffer((GLenum)a[0], (GLenum)a[1], replayName(TRACE_NS_BUFFER, a[2])); break;
+    case TRACE_glPrimitiveRestartIndex: glad_glPrimitiveRestartIndex((GLuint)a[0]); break;
+    case TRACE_glCopyBufferSubData: glad_glCopyBufferSubData((GLenum)a[0], (GLenum)a[1], (GLintptr)a[2], (GLintptr)a[3], (GLsizeiptr)a[4]); break;
+    case TRACE_glGetUniformIndices: glad_glGetUniformIndices(replayName(TRACE_NS_PROGRAM, a[0]), (GLsizei)a[1], (const GLchar *const*)replayScratch(), (GLuint *)replayScratch()); break;
+    case TRACE_glGetActiveUniformsiv: glad_glGetActiveUniformsiv(replayName(TRACE_NS_PROGRAM, a[0]), (GLsizei)a[1], (const GLuint *)replayScratch(), (GLenum)a[3], (GLint *)replayScratch()); break;
+    case TRACE_glGetActiveUniformName: glad_glGetActiveUniformName(replayName(TRACE_NS_PROGRAM, a[0]), (GLuint)a[1], (GLsizei)a[2], (GLsizei *)replayScratch(), (GLchar *)replayScratch()); break;
+    case TRACE_glGetUniformBlockIndex: glad_glGetUniformBlockIndex(replayName(TRACE_NS_PROGRAM, a[0]), (const GLchar *)replayPointer(a[1], payload, payloadSize)); break;
+    case TRACE_glGetActiveUniformBlockiv: glad_glGetActiveUniformBlockiv(replayName(TRACE_NS_PROGRAM, a[0]), (GLuint)a[1], (GLenum)a[2], (GLint *)replayScratch()); break;
+    case TRACE_glGetActiveUniformBlockName: glad_glGetActiveUniformBlockName(replayName(TRACE_NS_PROGRAM, a[0]), (GLuint)a[1], (GLsizei)a[2], (GLsizei *)replayScratch(), (GLchar *)replayScratch()); break;
+    case TRACE_glUniformBlockBinding: glad_glUniformBlockBinding(replayName(TRACE_NS_PROGRAM, a[0]), (GLuint)a[1], (GLuint)a[2]); break;
+    case TRACE_glDrawElementsBaseVertex: glad_glDrawElementsBaseVertex((GLenum)a[0], (GLsizei)a[1], (GLenum)a[2], (const void *)(uintptr_t)a[3], (GLint)a[4]); break;
+    case TRACE_glDrawRangeElementsBaseVertex: glad_glDrawRangeElementsBaseVertex((GLenum)a[0], (GLuint)a[1], (GLuint)a[2], (GLsizei)a[3], (GLenum)a[4], (const void *)(uintptr_t)a[5], (GLint)a[6]); break;
+    case TRACE_glDrawElementsInstancedBaseVertex: glad_glDrawElementsInstancedBaseVertex((GLenum)a[0], (GLsizei)a[1], (GLenum)a[2], (const void *)(uintptr_t)a[3], (GLsizei)a[4], (GLint)a[5]); break;
+    case TRACE_glMultiDrawElementsBaseVertex: glad_glMultiDrawElementsBaseVertex((GLenum)a[0], (const GLsizei *)replayScratch(), (GLenum)a[2], (const void *const*)(uintptr_t)a[3], (GLsizei)a[4], (const GLint *)replayScratch()); break;
+    case TRACE_glProvokingVertex: glad_glProvokingVertex((GLenum)a[0]); break;
+    case TRACE_glFenceSync: replayBindSync(result, glad_glFenceSync((GLenum)a[0], (GLbitfield)a[1])); break;
+    case TRACE_glIsSync: glad_glIsSync(replaySync(a[0])); break;
+    case TRACE_glDeleteSync: replay_glDeleteSync(a, payload, payloadSize, result); break;
+    case TRACE_glClientWaitSync: glad_glClientWaitSync(replaySync(a[0]), (GLbitfield)a[1], (GLuint64)a[2]); break;
+    case TRACE_glWaitSync: glad_glWaitSync(replaySync(a[0]), (GLbitfield)a[1], (GLuint64)a[2]); break;
+    case TRACE_glGetInteger64v: glad_glGetInteger64v((GLenum)a[0], (GLint64 *)replayScratch()); break;
+    case TRACE_glGetSynciv: glad_glGetSynciv(replaySync(a[0]), (GLenum)a[1], (GLsizei)a[2], (GLsizei *)replayScratch(), (GLint *)replayScratch()); break;
+    case TRACE_glGetInteger64i_v: glad_glGetInteger64i_v((GLenum)a[0], (GLuint)a[1], (GLint64 *)replayScratch()); break;
+    case TRACE_glGetBufferParameteri64v: glad_glGetBufferParameteri64v((GLenum)a[0], (GLenum)a[1], (GLint64 *)replayScratch()); break;
+    case TRACE_glFramebufferTexture: glad_glFramebufferTexture((GLenum)a[0], (GLenum)a[1], replayName(TRACE_NS_TEXTURE, a[2]), (GLint)a[3]); break;
+    case TRACE_glTexImage2DMultisample: glad_glTexImage2DMultisample((GLenum)a[0], (GLsizei)a[1], (GLenum)a[2], (GLsizei)a[3], (GLsizei)a[4], (GLboolean)a[5]); break;
+    case TRACE_glTexImage3DMultisample: glad_glTexImage3DMultisample((GLenum)a[0], (GLsizei)a[1], (GLenum)a[2], (GLsizei)a[3], (GLsizei)a[4], (GLsizei)a[5], (GLboolean)a[6]); break;
+    case TRACE_glGetMultisamplefv: glad_glGetMultisamplefv((GLenum)a[0], (GLuint)a[1], (GLfloat *)replayScratch()); break;
+    case TRACE_glSampleMaski: glad_glSampleMaski((GLuint)a[0], (GLbitfield)a[1]); break;
+    case TRACE_glBindFragDataLocationIndexed: glad_glBindFragDataLocationIndexed(replayName(TRACE_NS_PROGRAM, a[0]), (GLuint)a[1], (GLuint)a[2], (const GLchar *)replayScratch()); break;
+    case TRACE_glGetFragDataIndex: glad_glGetFragDataIndex(replayName(TRACE_NS_PROGRAM, a[0]), (const GLchar *)replayScratch()); break;
+    case TRACE_glGenSamplers: { std::vector<GLuint> names((size_t)std::max<int64_t>(0, (int64_t)a[0])); glad_glGenSamplers((GLsizei)names.size(), names.data()); replayBindNames(TRACE_NS_SAMPLER, payload, payloadSize, names); } break;
+    case TRACE_glDeleteSamplers: { std::vector<GLuint> names = replayNames(TRACE_NS_SAMPLER, payload, payloadSize); glad_glDeleteSamplers((GLsizei)names.size(), names.data()); } break;
+    case TRACE_glIsSampler: glad_glIsSampler(replayName(TRACE_NS_SAMPLER, a[0])); break;
+    case TRACE_glBindSampler: glad_glBindSampler((GLuint)a[0], replayName(TRACE_NS_SAMPLER, a[1])); break;
+    case TRACE_glSamplerParameteri: glad_glSamplerParameteri(replayName(TRACE_NS_SAMPLER, a[0]), (GLenum)a[1], (GLint)a[2]); break;
+    case TRACE_glSamplerParameteriv: glad_glSamplerParameteriv(replayName(TRACE_NS_SAMPLER, a[0]), (GLenum)a[1], (const GLint *)replayScratch()); break;
+    case TRACE_glSamplerParameterf: glad_glSamplerParameterf(replayName(TRACE_NS_SAMPLER, a[0]), (GLenum)a[1], replayFloat(a[2])); break;
+    case TRACE_glSamplerParameterfv: glad_glSamplerParameterfv(replayName(TRACE_NS_SAMPLER, a[0]), (GLenum)a[1], (const GLfloat *)replayScratch()); break;
+    case TRACE_glSamplerParameterIiv: glad_glSamplerParameterIiv(replayName(TRACE_NS_SAMPLER, a[0]), (GLenum)a[1], (const GLint *)replayScratch()); break;
+    case TRACE_glSamplerParameterIuiv: glad_glSamplerParameterIuiv(replayName(TRACE_NS_SAMPLER, a[0]), (GLenum)a[1], (const GLuint *)replayScratch()); break;
+    case TRACE_glGetSamplerParameteriv: glad_glGetSamplerParameteriv(replayName(TRACE_NS_SAMPLER, a[0]), (GLenum)a[1], (GLint *)replayScratch()); break;
+    case TRACE_glGetSamplerParameterIiv: glad_glGetSamplerParameterIiv(replayName(TRACE_NS_SAMPLER, a[0]), (GLenum)a[1], (GLint *)replayScratch()); break;
+    case TRACE_glGetSamplerParameterfv: glad_glGetSamplerParameterfv(replayName(TRACE_NS_SAMPLER, a[0]), (GLenum)a[1], (GLfloat *)replayScratch()); break;
+    case TRACE_glGetSamplerParameterIuiv: glad_glGetSamplerParameterIuiv(replayName(TRACE_NS_SAMPLER, a[0]), (GLenum)a[1], (GLuint *)replayScratch()); break;
+    case TRACE_glQueryCounter: glad_glQueryCounter(replayName(TRACE_NS_QUERY, a[0]), (GLenum)a[1]); break;
+    case TRACE_glGetQueryObjecti64v: glad_glGetQueryObjecti64v(replayName(TRACE_NS_QUERY, a[0]), (GLenum)a[1], (GLint64 *)replayScratch()); break;
+    case TRACE_glGetQueryObjectui64v: glad_glGetQueryObjectui64v(replayName(TRACE_NS_QUERY, a[0]), (GLenum)a[1], (GLuint64 *)replayScratch()); break;
+    case TRACE_glVertexAttribDivisor: glad_glVertexAttribDivisor((GLuint)a[0], (GLuint)a[1]); break;
+    case TRACE_glVertexAttribP1ui: glad_glVertexAttribP1ui((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (GLuint)a[3]); break;
+    case TRACE_glVertexAttribP1uiv: glad_glVertexAttribP1uiv((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (const GLuint *)replayScratch()); break;
+    case TRACE_glVertexAttribP2ui: glad_glVertexAttribP2ui((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (GLuint)a[3]); break;
+    case TRACE_glVertexAttribP2uiv: glad_glVertexAttribP2uiv((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (const GLuint *)replayScratch()); break;
+    case TRACE_glVertexAttribP3ui: glad_glVertexAttribP3ui((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (GLuint)a[3]); break;
+    case TRACE_glVertexAttribP3uiv: glad_glVertexAttribP3uiv((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (const GLuint *)replayScratch()); break;
+    case TRACE_glVertexAttribP4ui: glad_glVertexAttribP4ui((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (GLuint)a[3]); break;
+    case TRACE_glVertexAttribP4uiv: glad_glVertexAttribP4uiv((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (const GLuint *)replayScratch()); break;
+    case TRACE_glVertexP2ui: glad_glVertexP2ui((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glVertexP2uiv: glad_glVertexP2uiv((GLenum)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glVertexP3ui: glad_glVertexP3ui((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glVertexP3uiv: glad_glVertexP3uiv((GLenum)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glVertexP4ui: glad_glVertexP4ui((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glVertexP4uiv: glad_glVertexP4uiv((GLenum)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glTexCoordP1ui: glad_glTexCoordP1ui((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glTexCoordP1uiv: glad_glTexCoordP1uiv((GLenum)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glTexCoordP2ui: glad_glTexCoordP2ui((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glTexCoordP2uiv: glad_glTexCoordP2uiv((GLenum)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glTexCoordP3ui: glad_glTexCoordP3ui((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glTexCoordP3uiv: glad_glTexCoordP3uiv((GLenum)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glTexCoordP4ui: glad_glTexCoordP4ui((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glTexCoordP4uiv: glad_glTexCoordP4uiv((GLenum)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glMultiTexCoordP1ui: glad_glMultiTexCoordP1ui((GLenum)a[0], (GLenum)a[1], (GLuint)a[2]); break;
+    case TRACE_glMultiTexCoordP1uiv: glad_glMultiTexCoordP1uiv((GLenum)a[0], (GLenum)a[1], (const GLuint *)replayScratch()); break;
+    case TRACE_glMultiTexCoordP2ui: glad_glMultiTexCoordP2ui((GLenum)a[0], (GLenum)a[1], (GLuint)a[2]); break;
+    case TRACE_glMultiTexCoordP2uiv: glad_glMultiTexCoordP2uiv((GLenum)a[0], (GLenum)a[1], (const GLuint *)replayScratch()); break;
+    case TRACE_glMultiTexCoordP3ui: glad_glMultiTexCoordP3ui((GLenum)a[0], (GLenum)a[1], (GLuint)a[2]); break;
+    case TRACE_glMultiTexCoordP3uiv: glad_glMultiTexCoordP3uiv((GLenum)a[0], (GLenum)a[1], (const GLuint *)replayScratch()); break;
+    case TRACE_glMultiTexCoordP4ui: glad_glMultiTexCoordP4ui((GLenum)a[0], (GLenum)a[1], (GLuint)a[2]); break;
+    case TRACE_glMultiTexCoordP4uiv: glad_glMultiTexCoordP4uiv((GLenum)a[0], (GLenum)a[1], (const GLuint *)replayScratch()); break;
+    case TRACE_glNormalP3ui: glad_glNormalP3ui((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glNormalP3uiv: glad_glNormalP3uiv((GLenum)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glColorP3ui: glad_glColorP3ui((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glColorP3uiv: glad_glColorP3uiv((GLenum)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glColorP4ui: glad_glColorP4ui((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glColorP4uiv: glad_glColorP4uiv((GLenum)a[0], (const GLuint *)replayScratch()); break;
+    case TRACE_glSecondaryColorP3ui: glad_glSecondaryColorP3ui((GLenum)a[0], (GLuint)a[1]); break;
+    case TRACE_glSecondaryColorP3uiv: glad_glSecondaryColorP3uiv((GLenum)a[0], (const GLuint *)replayScratch()); break;
+    }
+}
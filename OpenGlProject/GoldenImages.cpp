@@ -0,0 +1,299 @@
+#include "GoldenImages.h"
+#include "Image.h" // RGBA8 images
+#include "JobSystem.h" // parallelFor
+#include "RenderContext.h" // defaultFramebuffer
+#include "RenderTargets.h" // Field of view and clip planes
+#include "Texture.h" // decodeImage
+#include <glad/glad.h> // Offscreen framebuffer and readback
+#include <glm/gtc/matrix_transform.hpp> // glm::perspective
+#include <algorithm> // std::max
+#include <cmath> // sqrtf
+#include <cstdio> // snprintf
+#include <cstdlib> // abs
+#include <filesystem> // Creating the golden directory
+#include <fstream> // Writing PPM files
+#include <iostream> // For outputting errors and messages
+#include <string> // Paths
+#include <vector> // Scene list
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h> // SSE2 tolerance compare
+#define GOLDEN_USE_SSE2 1
+#endif
+
+static const double GOLDEN_TIMES[] = { 0.75, 2.0 }; // Animation times each toggle mask is rendered at
+static const int GOLDEN_TIME_COUNT = sizeof(GOLDEN_TIMES) / sizeof(GOLDEN_TIMES[0]);
+static const int GOLDEN_TOGGLE_MASKS = 32; // Every combination of the five toggles
+static const float GOLDEN_PERCEPTUAL_THRESHOLD = 4.0f; // Blurred YCoCg distance (0-255 scale) a viewer would notice
+
+enum GoldenResult
+{
+    GOLDEN_PASS, // Within the channel tolerance everywhere
+    GOLDEN_PASS_PERCEPTUAL, // Some pixels over the tolerance, but not visibly different
+    GOLDEN_FAIL, // Visibly different
+    GOLDEN_MISSING // No golden to compare with
+};
+
+struct GoldenScene
+{
+    std::string name; // File stem, e.g. "toggles_13_t1"
+    unsigned toggles = 0;
+    double time = 0.0;
+    Image rendered;
+    GoldenResult result = GOLDEN_PASS;
+    size_t overTolerance = 0; // Pixels with a channel past GOLDEN_CHANNEL_TOLERANCE
+    size_t perceptual = 0; // Pixels past GOLDEN_PERCEPTUAL_THRESHOLD
+    int maxDifference = 0; // Largest channel difference
+};
+
+// Binary PPM (P6); Image rows are bottom-up, PPM rows top-down
+static bool writePpm(const std::string& path, const Image& image)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        return false;
+    out << "P6\n" << image.width << " " << image.height << "\n255\n";
+    std::vector<unsigned char> row((size_t)image.width * 3);
+    for (int y = image.height - 1; y >= 0; y--)
+    {
+        const unsigned char* source = &image.pixels[(size_t)y * image.width * 4];
+        for (int x = 0; x < image.width; x++)
+        {
+            row[x * 3 + 0] = source[x * 4 + 0];
+            row[x * 3 + 1] = source[x * 4 + 1];
+            row[x * 3 + 2] = source[x * 4 + 2];
+        }
+        out.write((const char*)row.data(), (std::streamsize)row.size());
+    }
+    return (bool)out;
+}
+
+// Pixels with any of R, G, B past the tolerance (alpha is ignored: PPM goldens have none), and the largest difference
+static size_t countOverTolerance(const Image& a, const Image& b, int& maxDifference)
+{
+    const unsigned char* pa = a.pixels.data();
+    const unsigned char* pb = b.pixels.data();
+    size_t pixelCount = (size_t)a.width * a.height;
+    size_t over = 0, i = 0;
+    int largest = 0;
+#ifdef GOLDEN_USE_SSE2
+    const __m128i tolerance = _mm_set1_epi8((char)GOLDEN_CHANNEL_TOLERANCE);
+    const __m128i colorMask = _mm_set1_epi32(0x00FFFFFF); // Drop alpha
+    __m128i largestBytes = _mm_setzero_si128();
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        __m128i va = _mm_loadu_si128((const __m128i*)(pa + i * 4));
+        __m128i vb = _mm_loadu_si128((const __m128i*)(pb + i * 4));
+        __m128i difference = _mm_and_si128(_mm_or_si128(_mm_subs_epu8(va, vb), _mm_subs_epu8(vb, va)), colorMask);
+        largestBytes = _mm_max_epu8(largestBytes, difference);
+        // Bytes left after subtracting the tolerance are over it; a pixel passes if all four are zero
+        __m128i excess = _mm_subs_epu8(difference, tolerance);
+        int passing = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(excess, _mm_setzero_si128())));
+        over += 4 - (size_t)((passing & 1) + ((passing >> 1) & 1) + ((passing >> 2) & 1) + ((passing >> 3) & 1));
+    }
+    alignas(16) unsigned char bytes[16];
+    _mm_store_si128((__m128i*)bytes, largestBytes);
+    for (unsigned char value : bytes)
+        largest = std::max(largest, (int)value);
+#endif
+    for (; i < pixelCount; i++)
+    {
+        int pixelLargest = 0;
+        for (int c = 0; c < 3; c++)
+            pixelLargest = std::max(pixelLargest, abs((int)pa[i * 4 + c] - (int)pb[i * 4 + c]));
+        largest = std::max(largest, pixelLargest);
+        if (pixelLargest > GOLDEN_CHANNEL_TOLERANCE)
+            over++;
+    }
+    maxDifference = largest;
+    return over;
+}
+
+// Luma and chroma (YCoCg) blurred over 3x3, so single-pixel edge differences average out
+static std::vector<float> blurredYCoCg(const Image& image)
+{
+    int w = image.width, h = image.height;
+    std::vector<float> plain((size_t)w * h * 3), blurred((size_t)w * h * 3);
+    for (size_t i = 0; i < (size_t)w * h; i++)
+    {
+        float r = image.pixels[i * 4 + 0], g = image.pixels[i * 4 + 1], b = image.pixels[i * 4 + 2];
+        plain[i * 3 + 0] = 0.25f * r + 0.5f * g + 0.25f * b;
+        plain[i * 3 + 1] = 0.5f * r - 0.5f * b;
+        plain[i * 3 + 2] = -0.25f * r + 0.5f * g - 0.25f * b;
+    }
+    for (int y = 0; y < h; y++)
+        for (int x = 0; x < w; x++)
+            for (int c = 0; c < 3; c++)
+            {
+                float sum = 0.0f;
+                for (int dy = -1; dy <= 1; dy++)
+                    for (int dx = -1; dx <= 1; dx++)
+                    {
+                        int sx = std::min(std::max(x + dx, 0), w - 1), sy = std::min(std::max(y + dy, 0), h - 1);
+                        sum += plain[((size_t)sy * w + sx) * 3 + c];
+                    }
+                blurred[((size_t)y * w + x) * 3 + c] = sum / 9.0f;
+            }
+    return blurred;
+}
+
+// Pixels whose blurred color moved further than a viewer would notice; chroma counts half as much as luma
+static size_t countPerceptual(const Image& a, const Image& b)
+{
+    std::vector<float> ya = blurredYCoCg(a), yb = blurredYCoCg(b);
+    size_t different = 0;
+    for (size_t i = 0; i < (size_t)a.width * a.height; i++)
+    {
+        float dy = ya[i * 3 + 0] - yb[i * 3 + 0];
+        float dco = ya[i * 3 + 1] - yb[i * 3 + 1];
+        float dcg = ya[i * 3 + 2] - yb[i * 3 + 2];
+        if (sqrtf(dy * dy + 0.25f * (dco * dco + dcg * dcg)) > GOLDEN_PERCEPTUAL_THRESHOLD)
+            different++;
+    }
+    return different;
+}
+
+// Dimmed grey golden with the difference on top: blue (just over tolerance) through red to yellow (>= 64)
+static Image diffHeatmap(const Image& golden, const Image& rendered)
+{
+    Image heatmap;
+    heatmap.width = golden.width;
+    heatmap.height = golden.height;
+    heatmap.pixels.resize(golden.pixels.size());
+    for (size_t i = 0; i < (size_t)golden.width * golden.height; i++)
+    {
+        const unsigned char* g = &golden.pixels[i * 4];
+        const unsigned char* r = &rendered.pixels[i * 4];
+        int difference = 0;
+        for (int c = 0; c < 3; c++)
+            difference = std::max(difference, abs((int)g[c] - (int)r[c]));
+        unsigned char* out = &heatmap.pixels[i * 4];
+        if (difference <= GOLDEN_CHANNEL_TOLERANCE)
+        {
+            unsigned char grey = (unsigned char)((g[0] + 2 * g[1] + g[2]) / 12); // A third of the luma
+            out[0] = out[1] = out[2] = grey;
+        }
+        else
+        {
+            float t = std::min(difference / 64.0f, 1.0f);
+            out[0] = (unsigned char)(255.0f * std::min(t * 2.0f, 1.0f));
+            out[1] = (unsigned char)(255.0f * std::max(t * 2.0f - 1.0f, 0.0f));
+            out[2] = (unsigned char)(255.0f * std::max(1.0f - t * 2.0f, 0.0f));
+        }
+        out[3] = 255;
+    }
+    return heatmap;
+}
+
+static void compareScene(GoldenScene& scene, const std::string& directory)
+{
+    std::string goldenPath = directory + "/" + scene.name + ".ppm";
+    Image golden;
+    if (!decodeImage(goldenPath.c_str(), golden) || golden.width != scene.rendered.width || golden.height != scene.rendered.height)
+    {
+        scene.result = GOLDEN_MISSING;
+        writePpm(directory + "/" + scene.name + ".actual.ppm", scene.rendered);
+        return;
+    }
+
+    scene.overTolerance = countOverTolerance(golden, scene.rendered, scene.maxDifference);
+    if (scene.overTolerance == 0)
+    {
+        scene.result = GOLDEN_PASS;
+        return;
+    }
+    scene.perceptual = countPerceptual(golden, scene.rendered);
+    size_t allowed = (size_t)(GOLDEN_PERCEPTUAL_FRACTION * golden.width * golden.height);
+    scene.result = scene.perceptual > allowed ? GOLDEN_FAIL : GOLDEN_PASS_PERCEPTUAL;
+    writePpm(directory + "/" + scene.name + ".actual.ppm", scene.rendered);
+    writePpm(directory + "/" + scene.name + ".diff.ppm", diffHeatmap(golden, scene.rendered));
+}
+
+int runGoldenImages(const char* goldenDir, bool update, const GoldenSceneFunc& drawScene)
+{
+    std::error_code error;
+    std::filesystem::create_directories(goldenDir, error);
+    std::string directory = goldenDir;
+
+    // Fixed-size color + depth target, so results do not depend on the window
+    GLuint framebuffer, colorTexture, depthBuffer;
+    glGenFramebuffers(1, &framebuffer);
+    glGenTextures(1, &colorTexture);
+    glGenRenderbuffers(1, &depthBuffer);
+    glBindTexture(GL_TEXTURE_2D, colorTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, GOLDEN_WIDTH, GOLDEN_HEIGHT, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, GOLDEN_WIDTH, GOLDEN_HEIGHT);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorTexture, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        std::cout << "Golden framebuffer is incomplete" << std::endl;
+
+    const RenderView& view = currentRenderView();
+    glm::mat4 projection = glm::perspective(glm::radians(view.fovDegrees), (float)GOLDEN_WIDTH / GOLDEN_HEIGHT, view.nearPlane, view.farPlane);
+
+    // Rendering and readback stay on the GL thread
+    std::vector<GoldenScene> scenes;
+    for (int toggles = 0; toggles < GOLDEN_TOGGLE_MASKS; toggles++)
+        for (int t = 0; t < GOLDEN_TIME_COUNT; t++)
+        {
+            GoldenScene scene;
+            char name[32];
+            snprintf(name, sizeof(name), "toggles_%02d_t%d", toggles, t);
+            scene.name = name;
+            scene.toggles = (unsigned)toggles;
+            scene.time = GOLDEN_TIMES[t];
+            scene.rendered.width = GOLDEN_WIDTH;
+            scene.rendered.height = GOLDEN_HEIGHT;
+            scene.rendered.pixels.resize((size_t)GOLDEN_WIDTH * GOLDEN_HEIGHT * 4);
+
+            glViewport(0, 0, GOLDEN_WIDTH, GOLDEN_HEIGHT);
+            drawScene(scene.toggles, scene.time, projection);
+            glPixelStorei(GL_PACK_ALIGNMENT, 1);
+            glReadPixels(0, 0, GOLDEN_WIDTH, GOLDEN_HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE, scene.rendered.pixels.data());
+            scenes.push_back(std::move(scene));
+        }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, defaultFramebuffer());
+    glViewport(0, 0, view.width, view.height);
+    glDeleteFramebuffers(1, &framebuffer);
+    glDeleteTextures(1, &colorTexture);
+    glDeleteRenderbuffers(1, &depthBuffer);
+
+    if (update)
+    {
+        int written = 0;
+        for (const GoldenScene& scene : scenes)
+            written += writePpm(directory + "/" + scene.name + ".ppm", scene.rendered) ? 1 : 0;
+        std::cout << "Golden images: wrote " << written << " of " << scenes.size() << " to " << directory << std::endl;
+        return written == (int)scenes.size() ? 0 : (int)scenes.size() - written;
+    }
+
+    // Decoding, diffs and heatmaps are CPU only and independent per scene
+    parallelFor(0, scenes.size(), 1, [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++)
+            compareScene(scenes[i], directory);
+    });
+
+    int failures = 0, perceptualPasses = 0;
+    for (const GoldenScene& scene : scenes)
+    {
+        if (scene.result == GOLDEN_PASS)
+            continue;
+        if (scene.result == GOLDEN_PASS_PERCEPTUAL)
+            perceptualPasses++;
+        else
+            failures++;
+        const char* label = scene.result == GOLDEN_MISSING ? "MISSING" : (scene.result == GOLDEN_FAIL ? "FAIL" : "pass (perceptual)");
+        std::cout << "  " << scene.name << ": " << label;
+        if (scene.result != GOLDEN_MISSING)
+            std::cout << ", " << scene.overTolerance << " pixels over tolerance, " << scene.perceptual
+                      << " perceptually different, max difference " << scene.maxDifference;
+        std::cout << std::endl;
+    }
+    std::cout << "Golden images: " << scenes.size() - failures << " of " << scenes.size() << " passed (" << perceptualPasses
+              << " only perceptually), " << failures << " failed" << std::endl;
+    return failures;
+}
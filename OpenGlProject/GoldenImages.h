@@ -0,0 +1,22 @@
+#pragma once
+#include <functional> // Scene callback
+#include <glm/glm.hpp> // Projection matrix
+
+// Golden-image regression check. Every combination of the five transformation toggles is rendered at a few fixed
+// animation times into a fixed-size offscreen framebuffer, read back, and compared with the images stored in a
+// directory: first per channel against a tolerance (SSE2), then, for images that exceed it, with a perceptual
+// metric that ignores isolated anti-aliasing noise. Comparisons run in parallel. Mismatches write the rendered
+// image and a diff heatmap next to the golden. Goldens are driver specific: record them on the machine that checks
+// them (e.g. Mesa llvmpipe via LIBGL_ALWAYS_SOFTWARE=1 on a CPU-only box).
+
+// Draws one scene into the bound framebuffer: clear, then render toggle mask `toggles` at `time` with `projection`
+typedef std::function<void(unsigned toggles, double time, const glm::mat4& projection)> GoldenSceneFunc;
+
+const int GOLDEN_WIDTH = 256; // Offscreen size, independent of the window
+const int GOLDEN_HEIGHT = 256;
+const int GOLDEN_CHANNEL_TOLERANCE = 2; // Largest per-channel difference that still counts as equal
+const double GOLDEN_PERCEPTUAL_FRACTION = 0.001; // Share of perceptually different pixels that fails a scene
+
+// Render every scene and either store it in goldenDir (update) or compare with what is stored there.
+// Returns the number of scenes that failed (missing goldens count as failures).
+int runGoldenImages(const char* goldenDir, bool update, const GoldenSceneFunc& drawScene);
@@ -0,0 +1,10 @@
+#pragma once
+#include <vector> // Pixel storage
+
+// RGBA8 image; row 0 is the bottom row, as glTexImage2D expects
+struct Image
+{
+    int width = 0; // Width in pixels
+    int height = 0; // Height in pixels
+    std::vector<unsigned char> pixels; // width * height * 4 bytes
+};
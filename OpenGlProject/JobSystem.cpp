@@ -0,0 +1,491 @@
+#include "JobSystem.h"
+#include "Profiler.h" // Worker tracks and job slices
+#include <glm/glm.hpp> // Benchmark transforms
+#include <glm/gtc/matrix_transform.hpp> // glm::translate / rotate / scale
+#include <algorithm> // std::min
+#include <chrono> // Benchmark timing
+#include <cmath> // sin
+#include <condition_variable> // Sleeping workers
+#include <cstdlib> // atexit
+#include <deque> // Jobs submitted from outside the workers
+#include <functional> // Benchmark workloads
+#include <iostream> // For outputting errors and messages
+#include <memory> // Worker records
+#include <mutex> // Shared queue and sleep lock
+#include <thread> // Worker threads
+#include <vector> // Worker list
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h> // SetThreadAffinityMask
+#elif defined(__linux__)
+#include <pthread.h> // pthread_setaffinity_np
+#endif
+
+static const int64_t JOB_DEQUE_CAPACITY = 4096; // Per worker; must be a power of two
+static const size_t JOB_RING_SIZE = 4096; // Job slots per worker; must be a power of two
+static const int JOB_RING_PROBES = 4; // Busy slots skipped before falling back to the heap
+static const int JOB_SPIN_ROUNDS = 64; // Empty searches before an idle worker sleeps
+static const int JOB_SLEEP_MS = 10; // Upper bound on a sleep; wake-ups normally come from submitJob
+
+// Chase-Lev deque with a fixed capacity (Le, Pop, Cohen and Zappa Nardelli, "Correct and Efficient
+// Work-Stealing for Weak Memory Models"). The owner pushes and pops at the bottom; thieves take from the top.
+struct JobDeque
+{
+    alignas(64) std::atomic<int64_t> top{ 0 };
+    alignas(64) std::atomic<int64_t> bottom{ 0 };
+    std::atomic<Job*> slots[JOB_DEQUE_CAPACITY];
+};
+
+struct JobWorker
+{
+    JobDeque deque;
+    std::unique_ptr<Job[]> ring{ new Job[JOB_RING_SIZE] }; // Jobs allocated by this worker
+    size_t nextSlot = 0; // Owner only
+    uint32_t random = 1; // Victim selection (xorshift), owner only
+    std::atomic<uint64_t> executed{ 0 }; // Statistics, written by the owner only
+    std::atomic<uint64_t> stolen{ 0 };
+    std::atomic<uint64_t> inlined{ 0 };
+};
+
+static std::vector<std::unique_ptr<JobWorker>> workers; // Index 0 is the thread that started the system
+static std::vector<std::thread> workerThreads; // Workers 1..n-1
+static std::atomic<unsigned> workerCount{ 0 }; // 0 while stopped
+static std::atomic<bool> jobsQuitting{ false };
+static std::mutex startMutex; // Serializes start and stop
+static std::mutex sharedMutex; // Guards sharedJobs
+static std::deque<Job*> sharedJobs; // Submitted by threads that are not workers
+static std::atomic<size_t> sharedCount{ 0 }; // sharedJobs.size(), readable without the lock
+static std::mutex sleepMutex;
+static std::condition_variable sleepSignal;
+static std::atomic<unsigned> sleepingWorkers{ 0 };
+static std::atomic<uint64_t> wakeEpoch{ 0 }; // Bumped on every submit, so a sleeper can tell it missed nothing
+static std::atomic<uint64_t> outsideExecuted{ 0 }; // Jobs run by threads that are not workers
+static thread_local JobWorker* localWorker = nullptr;
+
+// ---------------------------------------------------------------------------
+// Deque
+// ---------------------------------------------------------------------------
+
+// Owner only; false if the deque is full
+static bool pushJob(JobDeque& deque, Job* job)
+{
+    int64_t bottom = deque.bottom.load(std::memory_order_relaxed);
+    int64_t top = deque.top.load(std::memory_order_acquire);
+    if (bottom - top >= JOB_DEQUE_CAPACITY)
+        return false;
+    deque.slots[bottom & (JOB_DEQUE_CAPACITY - 1)].store(job, std::memory_order_relaxed);
+    deque.bottom.store(bottom + 1, std::memory_order_release); // Publishes the job's contents to thieves
+    return true;
+}
+
+// Owner only; newest job first
+static Job* popJob(JobDeque& deque)
+{
+    int64_t bottom = deque.bottom.load(std::memory_order_relaxed) - 1;
+    deque.bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = deque.top.load(std::memory_order_relaxed);
+    if (top > bottom)
+    {
+        deque.bottom.store(bottom + 1, std::memory_order_relaxed); // Was empty
+        return nullptr;
+    }
+    Job* job = deque.slots[bottom & (JOB_DEQUE_CAPACITY - 1)].load(std::memory_order_relaxed);
+    if (top == bottom)
+    {
+        // Last job: race the thieves for it
+        if (!deque.top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            job = nullptr;
+        deque.bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+// Any thread; oldest job first
+static Job* stealJob(JobDeque& deque)
+{
+    int64_t top = deque.top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = deque.bottom.load(std::memory_order_acquire);
+    if (top >= bottom)
+        return nullptr;
+    Job* job = deque.slots[top & (JOB_DEQUE_CAPACITY - 1)].load(std::memory_order_relaxed);
+    if (!deque.top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return nullptr; // Lost to the owner or another thief
+    return job;
+}
+
+// ---------------------------------------------------------------------------
+// Scheduling
+// ---------------------------------------------------------------------------
+
+static void countJob(std::atomic<uint64_t>& statistic)
+{
+    statistic.store(statistic.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); // Owner only: no locked add
+}
+
+static bool anyJobsQueued()
+{
+    if (sharedCount.load() > 0)
+        return true;
+    for (unsigned i = 0; i < workerCount.load(std::memory_order_acquire); i++)
+        if (workers[i]->deque.top.load() < workers[i]->deque.bottom.load())
+            return true;
+    return false;
+}
+
+// Own deque first, then the shared queue, then the other workers starting at a random one
+static Job* findJob(JobWorker* self)
+{
+    if (self)
+    {
+        if (Job* job = popJob(self->deque))
+            return job;
+    }
+    if (sharedCount.load(std::memory_order_relaxed) > 0)
+    {
+        std::lock_guard<std::mutex> lock(sharedMutex);
+        if (!sharedJobs.empty())
+        {
+            Job* job = sharedJobs.front();
+            sharedJobs.pop_front();
+            sharedCount.fetch_sub(1);
+            return job;
+        }
+    }
+
+    unsigned count = workerCount.load(std::memory_order_acquire);
+    unsigned start = 0;
+    if (self)
+    {
+        self->random ^= self->random << 13;
+        self->random ^= self->random >> 17;
+        self->random ^= self->random << 5;
+        start = self->random % count;
+    }
+    for (unsigned i = 0; i < count; i++)
+    {
+        JobWorker* victim = workers[(start + i) % count].get();
+        if (victim == self)
+            continue;
+        if (Job* job = stealJob(victim->deque))
+        {
+            if (self)
+                countJob(self->stolen);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+static void executeJob(Job* job)
+{
+    if (job->dependency)
+        waitForCounter(*job->dependency);
+    {
+        PROFILE_SCOPE("job"); // One slice per job on the track of the thread that ran it
+        job->run(job);
+    }
+    job->destroy(job);
+
+    JobCounter* counter = job->counter;
+    if (job->heap)
+        delete job;
+    else
+        job->busy.store(false, std::memory_order_release); // The owning worker may reuse the slot from here on
+    if (counter)
+        counter->pending.fetch_sub(1, std::memory_order_release);
+
+    if (localWorker)
+        countJob(localWorker->executed);
+    else
+        outsideExecuted.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void wakeWorker()
+{
+    wakeEpoch.fetch_add(1);
+    if (sleepingWorkers.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex); // A worker between its last check and wait() can't miss this
+        sleepSignal.notify_one();
+    }
+}
+
+static void workerMain(unsigned index)
+{
+    PROFILE_THREAD("job worker");
+    JobWorker* self = workers[index].get();
+    localWorker = self;
+    int idleRounds = 0;
+    while (!jobsQuitting.load(std::memory_order_acquire))
+    {
+        if (Job* job = findJob(self))
+        {
+            executeJob(job);
+            idleRounds = 0;
+            continue;
+        }
+        if (++idleRounds < JOB_SPIN_ROUNDS)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Nothing to do for a while: sleep until a submit bumps the epoch
+        uint64_t epoch = wakeEpoch.load();
+        sleepingWorkers.fetch_add(1);
+        if (!anyJobsQueued())
+        {
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleepSignal.wait_for(lock, std::chrono::milliseconds(JOB_SLEEP_MS),
+                [&] { return wakeEpoch.load() != epoch || jobsQuitting.load(); });
+        }
+        sleepingWorkers.fetch_sub(1);
+        idleRounds = 0;
+    }
+    localWorker = nullptr;
+}
+
+static void pinThread(std::thread& thread, unsigned core)
+{
+#ifdef _WIN32
+    SetThreadAffinityMask((HANDLE)thread.native_handle(), (DWORD_PTR)1 << (core % 64)); // First processor group only
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core % CPU_SETSIZE, &set);
+    pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else
+    (void)thread;
+    (void)core;
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+void startJobSystem(unsigned threads, bool pinThreads)
+{
+    std::lock_guard<std::mutex> lock(startMutex);
+    if (workerCount.load() != 0)
+        return;
+    static bool registeredExit = false;
+    if (!registeredExit)
+    {
+        atexit(stopJobSystem); // Workers must be joined before static destructors run
+        registeredExit = true;
+    }
+
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+    threads = std::max(1u, std::min(threads, JOB_MAX_WORKERS));
+    jobsQuitting = false;
+    workers.clear();
+    for (unsigned i = 0; i < threads; i++)
+    {
+        workers.emplace_back(new JobWorker());
+        workers.back()->random = 0x9E3779B9u * (i + 1);
+    }
+    localWorker = workers[0].get();
+    workerCount.store(threads, std::memory_order_release);
+
+    // The caller stays unpinned; background worker i goes to core i
+    for (unsigned i = 1; i < threads; i++)
+    {
+        workerThreads.emplace_back(workerMain, i);
+        if (pinThreads)
+            pinThread(workerThreads.back(), i);
+    }
+}
+
+void stopJobSystem()
+{
+    std::lock_guard<std::mutex> lock(startMutex);
+    if (workerCount.load() == 0)
+        return;
+
+    // Help drain whatever is still queued, then let the workers go
+    while (anyJobsQueued())
+    {
+        if (Job* job = findJob(localWorker))
+            executeJob(job);
+        else
+            std::this_thread::yield();
+    }
+    jobsQuitting = true;
+    {
+        std::lock_guard<std::mutex> sleepLock(sleepMutex);
+        sleepSignal.notify_all();
+    }
+    for (std::thread& thread : workerThreads)
+        thread.join();
+    workerThreads.clear();
+    workerCount.store(0);
+    localWorker = nullptr;
+    workers.clear();
+}
+
+unsigned jobWorkerCount()
+{
+    return std::max(1u, workerCount.load(std::memory_order_relaxed));
+}
+
+JobStats jobSystemStats()
+{
+    JobStats stats;
+    stats.executed = outsideExecuted.load();
+    for (unsigned i = 0; i < workerCount.load(); i++)
+    {
+        stats.executed += workers[i]->executed.load(std::memory_order_relaxed);
+        stats.stolen += workers[i]->stolen.load(std::memory_order_relaxed);
+        stats.inlined += workers[i]->inlined.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+Job* allocateJob()
+{
+    if (workerCount.load(std::memory_order_acquire) == 0)
+        startJobSystem();
+
+    JobWorker* self = localWorker;
+    if (self)
+    {
+        for (int probe = 0; probe < JOB_RING_PROBES; probe++)
+        {
+            Job* job = &self->ring[self->nextSlot++ & (JOB_RING_SIZE - 1)];
+            if (!job->busy.load(std::memory_order_acquire))
+            {
+                job->busy.store(true, std::memory_order_relaxed);
+                job->heap = false;
+                return job;
+            }
+        }
+    }
+    Job* job = new Job();
+    job->heap = true;
+    return job;
+}
+
+void submitJob(Job* job)
+{
+    JobWorker* self = localWorker;
+    if (self)
+    {
+        if (!pushJob(self->deque, job))
+        {
+            countJob(self->inlined); // Deque full: running it here keeps memory bounded
+            executeJob(job);
+            return;
+        }
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(sharedMutex);
+        sharedJobs.push_back(job);
+        sharedCount.fetch_add(1);
+    }
+    wakeWorker();
+}
+
+void waitForCounter(JobCounter& counter)
+{
+    while (counter.pending.load(std::memory_order_acquire) > 0)
+    {
+        if (Job* job = findJob(localWorker))
+            executeJob(job);
+        else
+            std::this_thread::yield();
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark
+// ---------------------------------------------------------------------------
+
+// Best of a few runs, in milliseconds
+static double bestMilliseconds(int runs, const std::function<void()>& work)
+{
+    double best = 1e30;
+    for (int run = 0; run < runs; run++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        work();
+        best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+void runJobBenchmark(bool pinThreads)
+{
+    const size_t transformCount = 1 << 20; // Model matrices composed per run
+    const size_t transformGrain = 1024;
+    const int tinyJobCount = 1 << 17; // Empty jobs per run, for submission and stealing overhead
+    const int runs = 5;
+
+    unsigned cores = std::max(1u, std::min(std::thread::hardware_concurrency(), JOB_MAX_WORKERS));
+    std::vector<unsigned> threadCounts;
+    for (unsigned t = 1; t < cores; t *= 2)
+        threadCounts.push_back(t);
+    threadCounts.push_back(cores);
+
+    // Same shape of work as the toggles: translate, rotate, scale and shear per instance
+    std::vector<glm::mat4> transforms(transformCount);
+    auto compose = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++)
+        {
+            float t = (float)i * 0.001f;
+            glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(sin(t), 0.0f, 0.0f));
+            model = glm::rotate(model, t, glm::normalize(glm::vec3(0.5f, 1.0f, 0.0f)));
+            model = glm::scale(model, glm::vec3(1.0f + 0.5f * sin(t)));
+            glm::mat4 shear(1.0f);
+            shear[1][0] = 0.5f * sin(t);
+            transforms[i] = model * shear;
+        }
+    };
+    std::atomic<int> tinyJobsRun{ 0 };
+    auto tinyJobs = [&] {
+        JobCounter counter;
+        for (int i = 0; i < tinyJobCount; i++)
+            runJob([&tinyJobsRun] { tinyJobsRun.fetch_add(1, std::memory_order_relaxed); }, &counter);
+        waitForCounter(counter);
+    };
+
+    stopJobSystem();
+    std::cout << "Job system: " << cores << " cores, " << transformCount << " transforms (grain " << transformGrain
+              << "), " << tinyJobCount << " empty jobs, best of " << runs << (pinThreads ? ", pinned" : "") << std::endl;
+    double singleThreadMs = 0.0;
+    for (unsigned threads : threadCounts)
+    {
+        startJobSystem(threads, pinThreads);
+        double transformMs = bestMilliseconds(runs, [&] { parallelFor(0, transformCount, transformGrain, compose); });
+        double tinyMs = bestMilliseconds(runs, tinyJobs);
+        JobStats stats = jobSystemStats();
+        stopJobSystem();
+
+        if (threads == 1)
+            singleThreadMs = transformMs;
+        double speedup = singleThreadMs / transformMs;
+        std::cout << "  " << threads << " threads: transforms " << transformMs << " ms (speedup " << speedup
+                  << ", efficiency " << 100.0 * speedup / threads << "%), empty jobs " << tinyJobCount / (tinyMs * 1000.0)
+                  << " M/s, " << (stats.executed ? 100.0 * stats.stolen / stats.executed : 0.0) << "% stolen, "
+                  << stats.inlined << " inlined" << std::endl;
+    }
+
+    // Grain size on every core: too small pays the scheduling cost, too large leaves workers idle
+    startJobSystem(cores, pinThreads);
+    std::cout << "  Grain sweep on " << cores << " threads:";
+    for (size_t grain : { (size_t)16, (size_t)256, (size_t)4096, (size_t)65536, transformCount / cores })
+        std::cout << " " << grain << " -> " << bestMilliseconds(runs, [&] { parallelFor(0, transformCount, grain, compose); }) << " ms;";
+    std::cout << std::endl;
+    stopJobSystem();
+
+    float checksum = 0.0f; // Keeps the transforms observable
+    for (size_t i = 0; i < transformCount; i += 4096)
+        checksum += transforms[i][3][0];
+    std::cout << "  (checksum " << checksum << ", " << tinyJobsRun.load() << " empty jobs run)" << std::endl;
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include <atomic> // Counters and job slots
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+#include <new> // Placement new into the job payload
+#include <type_traits> // std::decay
+#include <utility> // std::forward
+
+// Work-stealing job system. Each worker thread owns a Chase-Lev deque: it pushes and pops jobs at the bottom
+// (LIFO, cache-warm), idle workers steal from the top of a random victim (FIFO, the largest remaining pieces).
+// The thread that starts the system is worker 0; other threads submit through a shared queue. Completion is
+// tracked with counters: a job decrements its counter when it finishes, and waitForCounter runs other jobs
+// while it waits, so waiting inside a job never deadlocks. No fibers: a waiting job keeps its stack.
+// Closures up to JOB_PAYLOAD_BYTES are stored inside the job; jobs come from a per-worker ring, so submitting
+// does not allocate in the steady state.
+
+const size_t JOB_PAYLOAD_BYTES = 64; // Closures up to this size are stored inline
+const unsigned JOB_MAX_WORKERS = 128;
+
+struct JobCounter
+{
+    std::atomic<int> pending{ 0 }; // Jobs submitted against this counter that have not finished
+};
+
+struct Job;
+typedef void (*JobFunction)(Job* job);
+
+struct alignas(64) Job
+{
+    JobFunction run = nullptr; // Calls the closure in payload
+    JobFunction destroy = nullptr; // Destroys it
+    JobCounter* counter = nullptr; // Decremented when the job has finished (may be null)
+    JobCounter* dependency = nullptr; // The job runs once this reaches zero (may be null)
+    std::atomic<bool> busy{ false }; // Ring slot in use
+    bool heap = false; // Allocated with new (ring full, or submitted from outside the workers)
+    alignas(16) unsigned char payload[JOB_PAYLOAD_BYTES];
+};
+
+struct JobStats
+{
+    uint64_t executed = 0; // Jobs run
+    uint64_t stolen = 0; // Jobs taken from another worker's deque
+    uint64_t inlined = 0; // Jobs run immediately because the deque was full
+};
+
+// Start the workers: threads in total including the caller, which becomes worker 0 (0 = one per core).
+// pinThreads binds worker i to core i. Called implicitly with the defaults by the first submitted job.
+void startJobSystem(unsigned threads = 0, bool pinThreads = false);
+
+// Finish queued jobs and join the workers
+void stopJobSystem();
+
+// Threads taking part (1 if the system is not running)
+unsigned jobWorkerCount();
+
+// Totals over all workers since startJobSystem
+JobStats jobSystemStats();
+
+// Ring slot (or heap block) for a job; filled in by runJob
+Job* allocateJob();
+
+// Queue a filled-in job on the calling worker's deque (or the shared queue)
+void submitJob(Job* job);
+
+// Run other jobs until counter reaches zero
+void waitForCounter(JobCounter& counter);
+
+// Queue func() as a job. counter (optional) is incremented now and decremented when func returns; the job does
+// not start before dependency (optional) has reached zero.
+template <typename Func>
+void runJob(Func&& func, JobCounter* counter = nullptr, JobCounter* dependency = nullptr)
+{
+    typedef typename std::decay<Func>::type Stored;
+    Job* job = allocateJob();
+    if constexpr (sizeof(Stored) <= JOB_PAYLOAD_BYTES && alignof(Stored) <= 16)
+    {
+        new (job->payload) Stored(std::forward<Func>(func));
+        job->run = [](Job* j) { (*(Stored*)j->payload)(); };
+        job->destroy = [](Job* j) { ((Stored*)j->payload)->~Stored(); };
+    }
+    else
+    {
+        *(Stored**)job->payload = new Stored(std::forward<Func>(func)); // Too large: the payload holds a pointer
+        job->run = [](Job* j) { (**(Stored**)j->payload)(); };
+        job->destroy = [](Job* j) { delete *(Stored**)j->payload; };
+    }
+    job->counter = counter;
+    job->dependency = dependency;
+    if (counter)
+        counter->pending.fetch_add(1, std::memory_order_relaxed);
+    submitJob(job);
+}
+
+// Recursively halve [begin, end) until pieces are at most grain items; the halves go to the deque, so idle
+// workers steal large ranges and split them further themselves
+template <typename Func>
+void splitParallelRange(size_t begin, size_t end, size_t grain, const Func& func, JobCounter* counter)
+{
+    while (end - begin > grain)
+    {
+        size_t middle = begin + (end - begin) / 2;
+        runJob([middle, end, grain, &func, counter] { splitParallelRange(middle, end, grain, func, counter); }, counter);
+        end = middle;
+    }
+    func(begin, end);
+}
+
+// Call func(first, last) over [begin, end) in pieces of at most grain items (0 = about four pieces per worker);
+// returns once every piece has run
+template <typename Func>
+void parallelFor(size_t begin, size_t end, size_t grain, const Func& func)
+{
+    if (begin >= end)
+        return;
+    if (grain == 0)
+        grain = (end - begin + jobWorkerCount() * 4 - 1) / (jobWorkerCount() * 4);
+    JobCounter counter;
+    splitParallelRange(begin, end, grain, func, &counter);
+    waitForCounter(counter);
+}
+
+// Thread-count scalability benchmark: transform composition with parallelFor, job submission overhead and a
+// grain-size sweep, for 1, 2, 4, ... up to every core (at most JOB_MAX_WORKERS)
+void runJobBenchmark(bool pinThreads);
@@ -0,0 +1,311 @@
+#include "MeshCache.h"
+#include <glad/glad.h> // glBufferData
+#include <algorithm> // std::min / std::max
+#include <chrono> // Conversion timing
+#include <cstring> // strlen / memcpy
+#include <fstream> // Writing the cache
+#include <iostream> // For outputting errors and messages
+#include <numeric> // std::iota
+#include <unordered_map> // Vertex clustering
+
+static_assert(sizeof(MeshCacheHeader) == 104, "MeshCacheHeader layout is part of the file format");
+static_assert(sizeof(MeshCacheLod) == 16, "MeshCacheLod layout is part of the file format");
+
+static uint64_t alignUp(uint64_t value, uint64_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+bool isMeshCacheFile(const char* path)
+{
+    size_t length = strlen(path);
+    return length > 5 && strcmp(path + length - 5, ".mesh") == 0;
+}
+
+// ---------------------------------------------------------------------------
+// LOD generation
+// ---------------------------------------------------------------------------
+
+// Snap vertices to a grid and keep one representative per cell; collapsed triangles are dropped
+static std::vector<unsigned int> clusterIndices(const MeshData& mesh, const std::vector<unsigned int>& indices, int gridSize)
+{
+    glm::vec3 extent = glm::max(mesh.boundsMax - mesh.boundsMin, glm::vec3(1e-6f));
+    size_t vertexCount = meshVertexCount(mesh);
+    std::vector<unsigned int> remap(vertexCount);
+    std::unordered_map<uint64_t, unsigned int> cells; // Cell key -> representative vertex
+    cells.reserve(vertexCount / 4 + 1);
+
+    for (size_t i = 0; i < vertexCount; i++)
+    {
+        const float* v = &mesh.vertices[i * MESH_VERTEX_FLOATS];
+        glm::vec3 t = (glm::vec3(v[0], v[1], v[2]) - mesh.boundsMin) / extent * (float)gridSize;
+        uint64_t x = (uint64_t)std::min(gridSize - 1, std::max(0, (int)t.x));
+        uint64_t y = (uint64_t)std::min(gridSize - 1, std::max(0, (int)t.y));
+        uint64_t z = (uint64_t)std::min(gridSize - 1, std::max(0, (int)t.z));
+        uint64_t key = (x << 42) | (y << 21) | z;
+        remap[i] = cells.emplace(key, (unsigned int)i).first->second;
+    }
+
+    std::vector<unsigned int> result;
+    result.reserve(indices.size() / 2);
+    for (size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+        unsigned int a = remap[indices[i]], b = remap[indices[i + 1]], c = remap[indices[i + 2]];
+        if (a != b && b != c && a != c)
+        {
+            result.push_back(a);
+            result.push_back(b);
+            result.push_back(c);
+        }
+    }
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// Index compression
+// ---------------------------------------------------------------------------
+
+// Each index is stored as the zigzag-encoded difference to the previous one, in LEB128 bytes
+static void encodeIndices(const std::vector<unsigned int>& indices, std::vector<uint8_t>& out)
+{
+    out.reserve(indices.size() * 2);
+    unsigned int previous = 0;
+    for (unsigned int index : indices)
+    {
+        int32_t delta = (int32_t)(index - previous);
+        uint32_t zigzag = ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+        previous = index;
+        while (zigzag >= 0x80)
+        {
+            out.push_back((uint8_t)(zigzag | 0x80));
+            zigzag >>= 7;
+        }
+        out.push_back((uint8_t)zigzag);
+    }
+}
+
+static bool decodeIndices(const uint8_t* data, size_t bytes, size_t count, std::vector<unsigned int>& out)
+{
+    out.resize(count);
+    const uint8_t* end = data + bytes;
+    unsigned int previous = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint32_t zigzag = 0;
+        int shift = 0;
+        for (;;)
+        {
+            if (data == end || shift > 28)
+                return false; // Truncated or corrupt stream
+            uint8_t byte = *data++;
+            zigzag |= (uint32_t)(byte & 0x7F) << shift;
+            shift += 7;
+            if (!(byte & 0x80))
+                break;
+        }
+        int32_t delta = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+        previous += (unsigned int)delta;
+        out[i] = previous;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Writing
+// ---------------------------------------------------------------------------
+
+static void writePadding(std::ofstream& out, uint64_t target)
+{
+    static const char zeros[MESH_CACHE_ALIGNMENT] = {};
+    uint64_t position = (uint64_t)out.tellp();
+    if (target > position)
+        out.write(zeros, (std::streamsize)(target - position));
+}
+
+bool writeMeshCache(const char* path, const MeshData& mesh, bool compressIndices, int lodCount)
+{
+    lodCount = std::max(1, std::min(lodCount, MESH_CACHE_MAX_LODS));
+
+    // LOD 0 is the full mesh; non-indexed meshes get a trivial index list
+    std::vector<unsigned int> indices = mesh.indices;
+    if (indices.empty())
+    {
+        indices.resize(meshVertexCount(mesh));
+        std::iota(indices.begin(), indices.end(), 0u);
+    }
+
+    std::vector<MeshCacheLod> lods;
+    lods.push_back({ 0, (uint32_t)indices.size(), 0.0f, 0 });
+
+    // Coarser LODs from vertex clustering, halving the grid each level
+    glm::vec3 extent = mesh.boundsMax - mesh.boundsMin;
+    float size = std::max(extent.x, std::max(extent.y, extent.z));
+    size_t lodZeroCount = indices.size();
+    for (int level = 1, grid = 128; level < lodCount && grid >= 4; level++, grid /= 2)
+    {
+        std::vector<unsigned int> lod(indices.begin(), indices.begin() + lodZeroCount);
+        lod = clusterIndices(mesh, lod, grid);
+        if (lod.empty() || lod.size() * 10 > (size_t)lods.back().indexCount * 9)
+            continue; // Not worth storing unless it saves at least 10%
+        lods.push_back({ (uint32_t)indices.size(), (uint32_t)lod.size(), size / grid, 0 });
+        indices.insert(indices.end(), lod.begin(), lod.end());
+    }
+
+    std::vector<uint8_t> packed;
+    if (compressIndices)
+        encodeIndices(indices, packed);
+
+    MeshCacheHeader header = {};
+    header.magic = MESH_CACHE_MAGIC;
+    header.version = MESH_CACHE_VERSION;
+    header.flags = compressIndices ? MESH_CACHE_COMPRESSED_INDICES : 0;
+    header.vertexStride = MESH_VERTEX_FLOATS * sizeof(float);
+    header.vertexCount = meshVertexCount(mesh);
+    header.indexCount = indices.size();
+    header.lodCount = (uint32_t)lods.size();
+    header.lodOffset = sizeof(MeshCacheHeader);
+    header.vertexOffset = alignUp(header.lodOffset + lods.size() * sizeof(MeshCacheLod), MESH_CACHE_ALIGNMENT);
+    header.vertexBytes = header.vertexCount * header.vertexStride;
+    header.indexOffset = alignUp(header.vertexOffset + header.vertexBytes, MESH_CACHE_ALIGNMENT);
+    header.indexBytes = compressIndices ? packed.size() : indices.size() * sizeof(unsigned int);
+    memcpy(header.boundsMin, &mesh.boundsMin[0], sizeof(header.boundsMin));
+    memcpy(header.boundsMax, &mesh.boundsMax[0], sizeof(header.boundsMax));
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        std::cout << "Failed to create mesh cache: " << path << std::endl;
+        return false;
+    }
+    out.write((const char*)&header, sizeof(header));
+    out.write((const char*)lods.data(), (std::streamsize)(lods.size() * sizeof(MeshCacheLod)));
+    writePadding(out, header.vertexOffset);
+    out.write((const char*)mesh.vertices.data(), (std::streamsize)header.vertexBytes);
+    writePadding(out, header.indexOffset);
+    if (compressIndices)
+        out.write((const char*)packed.data(), (std::streamsize)packed.size());
+    else
+        out.write((const char*)indices.data(), (std::streamsize)header.indexBytes);
+    return (bool)out;
+}
+
+// ---------------------------------------------------------------------------
+// Reading
+// ---------------------------------------------------------------------------
+
+bool openMeshCache(const char* path, MeshCache& cache)
+{
+    closeMeshCache(cache);
+    if (!mapFile(path, cache.file))
+    {
+        std::cout << "Failed to open mesh cache: " << path << std::endl;
+        return false;
+    }
+
+    const MeshCacheHeader* header = (const MeshCacheHeader*)cache.file.data;
+    uint64_t fileSize = cache.file.size;
+    bool valid = fileSize >= sizeof(MeshCacheHeader)
+        && header->magic == MESH_CACHE_MAGIC
+        && header->version == MESH_CACHE_VERSION
+        && header->vertexStride == MESH_VERTEX_FLOATS * sizeof(float)
+        && header->lodCount >= 1 && header->lodCount <= (uint32_t)MESH_CACHE_MAX_LODS
+        // Untrusted 64-bit fields: bounds are checked by subtraction and division so nothing can wrap
+        && header->lodOffset <= fileSize && header->lodCount * sizeof(MeshCacheLod) <= fileSize - header->lodOffset
+        && header->vertexOffset % MESH_CACHE_ALIGNMENT == 0 && header->indexOffset % MESH_CACHE_ALIGNMENT == 0
+        && header->vertexOffset <= fileSize && header->vertexBytes <= fileSize - header->vertexOffset
+        && header->indexOffset <= fileSize && header->indexBytes <= fileSize - header->indexOffset
+        && header->vertexBytes / header->vertexStride == header->vertexCount && header->vertexBytes % header->vertexStride == 0;
+    if (valid && !(header->flags & MESH_CACHE_COMPRESSED_INDICES))
+        valid = header->indexBytes / sizeof(unsigned int) == header->indexCount && header->indexBytes % sizeof(unsigned int) == 0;
+    else if (valid)
+        valid = header->indexCount <= header->indexBytes; // Every encoded index takes at least a byte
+    if (!valid)
+    {
+        std::cout << "Invalid or outdated mesh cache: " << path << std::endl;
+        closeMeshCache(cache);
+        return false;
+    }
+
+    cache.header = header;
+    cache.lods = (const MeshCacheLod*)(cache.file.data + header->lodOffset);
+    cache.vertices = (const float*)(cache.file.data + header->vertexOffset);
+    for (uint32_t i = 0; i < header->lodCount; i++)
+    {
+        if ((uint64_t)cache.lods[i].firstIndex + cache.lods[i].indexCount > header->indexCount)
+        {
+            std::cout << "Mesh cache LOD table is out of range: " << path << std::endl;
+            closeMeshCache(cache);
+            return false;
+        }
+    }
+
+    if (header->flags & MESH_CACHE_COMPRESSED_INDICES)
+    {
+        // Compressed indices need one decode pass; vertices stay zero-copy
+        const uint8_t* packed = (const uint8_t*)(cache.file.data + header->indexOffset);
+        if (!decodeIndices(packed, header->indexBytes, header->indexCount, cache.decodedIndices))
+        {
+            std::cout << "Corrupt index stream in mesh cache: " << path << std::endl;
+            closeMeshCache(cache);
+            return false;
+        }
+        cache.indices = cache.decodedIndices.data();
+    }
+    else
+        cache.indices = (const unsigned int*)(cache.file.data + header->indexOffset);
+
+    // Reject indices that point past the vertex blob
+    for (uint64_t i = 0; i < header->indexCount; i++)
+    {
+        if (cache.indices[i] >= header->vertexCount)
+        {
+            std::cout << "Mesh cache index out of range: " << path << std::endl;
+            closeMeshCache(cache);
+            return false;
+        }
+    }
+    return true;
+}
+
+void closeMeshCache(MeshCache& cache)
+{
+    unmapFile(cache.file);
+    cache.header = nullptr;
+    cache.lods = nullptr;
+    cache.vertices = nullptr;
+    cache.indices = nullptr;
+    std::vector<unsigned int>().swap(cache.decodedIndices);
+}
+
+void uploadMeshCache(const MeshCache& cache, unsigned int VBO, unsigned int EBO)
+{
+    // The driver reads straight out of the page cache; there is no staging copy on our side
+    glBindBuffer(GL_COPY_WRITE_BUFFER, VBO);
+    glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)cache.header->vertexBytes, cache.vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, EBO);
+    glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)(cache.header->indexCount * sizeof(unsigned int)), cache.indices, GL_STATIC_DRAW);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+bool convertMeshToCache(const char* sourcePath, const char* cachePath, bool compressIndices)
+{
+    MeshData mesh;
+    if (!loadMesh(sourcePath, mesh))
+        return false;
+
+    auto start = std::chrono::steady_clock::now();
+    if (!writeMeshCache(cachePath, mesh, compressIndices, 4))
+        return false;
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    MeshCache cache;
+    if (!openMeshCache(cachePath, cache))
+        return false;
+    std::cout << "Wrote " << cachePath << ": " << cache.file.size / 1024 << " KB, "
+              << cache.header->lodCount << " LODs in " << seconds * 1000.0 << " ms" << std::endl;
+    for (uint32_t i = 0; i < cache.header->lodCount; i++)
+        std::cout << "  LOD " << i << ": " << cache.lods[i].indexCount / 3 << " triangles, error "
+                  << cache.lods[i].error << std::endl;
+    closeMeshCache(cache);
+    return true;
+}
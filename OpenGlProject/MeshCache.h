@@ -0,0 +1,70 @@
+#pragma once
+#include <cstdint> // Fixed-size header fields
+#include <vector> // Decoded indices
+#include "FileMapping.h" // Zero-copy access to the cache file
+#include "MeshImporter.h" // MeshData
+
+// Binary mesh cache (.mesh): header, LOD table, then 64-byte aligned vertex and index blobs.
+// Vertices use the interleaved position/color layout, so the mapped blob goes straight to glBufferData.
+const uint32_t MESH_CACHE_MAGIC = 0x4348534D; // "MSHC" in little endian
+const uint32_t MESH_CACHE_VERSION = 1; // Bump whenever the layout changes
+const uint32_t MESH_CACHE_ALIGNMENT = 64; // Alignment of every blob inside the file
+const uint32_t MESH_CACHE_COMPRESSED_INDICES = 1; // Index blob is zigzag-delta varint encoded
+const int MESH_CACHE_MAX_LODS = 8; // Upper limit of the LOD table
+
+struct MeshCacheHeader
+{
+    uint32_t magic; // MESH_CACHE_MAGIC
+    uint32_t version; // MESH_CACHE_VERSION
+    uint32_t flags; // MESH_CACHE_* flags
+    uint32_t vertexStride; // Bytes per vertex (24)
+    uint64_t vertexCount; // Number of vertices
+    uint64_t indexCount; // Number of indices over all LODs
+    uint64_t vertexOffset; // File offset of the vertex blob
+    uint64_t vertexBytes; // Size of the vertex blob
+    uint64_t indexOffset; // File offset of the index blob
+    uint64_t indexBytes; // Stored size of the index blob (compressed size when compressed)
+    uint64_t lodOffset; // File offset of the LOD table
+    uint32_t lodCount; // Entries in the LOD table
+    uint32_t reserved; // Keeps the bounds 8-byte aligned
+    float boundsMin[3]; // Bounding box of the positions
+    float boundsMax[3];
+};
+
+// One level of detail: a range of the shared index buffer
+struct MeshCacheLod
+{
+    uint32_t firstIndex; // First index of this LOD
+    uint32_t indexCount; // Number of indices
+    float error; // Approximate geometric error in mesh units (0 for the full mesh)
+    uint32_t reserved; // Padding
+};
+
+// An opened cache; pointers reference the mapping and stay valid until closeMeshCache
+struct MeshCache
+{
+    MappedFile file; // Mapping of the whole file
+    const MeshCacheHeader* header = nullptr; // Start of the file
+    const MeshCacheLod* lods = nullptr; // LOD table
+    const float* vertices = nullptr; // Interleaved vertex blob
+    const unsigned int* indices = nullptr; // Index blob (points into decodedIndices when compressed)
+    std::vector<unsigned int> decodedIndices; // Only used for compressed caches
+};
+
+// True if the path ends in .mesh
+bool isMeshCacheFile(const char* path);
+
+// Write mesh (plus generated LODs) to a cache file
+bool writeMeshCache(const char* path, const MeshData& mesh, bool compressIndices, int lodCount);
+
+// Map a cache file and validate its header
+bool openMeshCache(const char* path, MeshCache& cache);
+
+// Unmap the cache file
+void closeMeshCache(MeshCache& cache);
+
+// Upload the vertex and index blobs into VBO and EBO (bound to GL_COPY_WRITE_BUFFER, so no VAO is needed)
+void uploadMeshCache(const MeshCache& cache, unsigned int VBO, unsigned int EBO);
+
+// Converter: import an .obj/.ply file and write it as a .mesh cache
+bool convertMeshToCache(const char* sourcePath, const char* cachePath, bool compressIndices);
@@ -0,0 +1,740 @@
+#include "MeshImporter.h"
+#include "FileMapping.h" // Memory-mapped input
+#include "Parallel.h" // runParallel
+#include <algorithm> // std::min / std::max
+#include <cfloat> // FLT_MAX
+#include <charconv> // std::from_chars for fast number parsing
+#include <chrono> // Load timing
+#include <cstring> // memchr / memcpy / strcmp
+#include <iostream> // For outputting errors and messages
+#include <string> // Header tokens
+#include <thread> // Worker threads
+
+// ---------------------------------------------------------------------------
+// Shared helpers
+// ---------------------------------------------------------------------------
+
+// Pick a worker count: one per core, but never less than ~1 MB of input per worker
+static unsigned workerCountFor(size_t bytes)
+{
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    size_t bySize = bytes / (1 << 20) + 1;
+    return (unsigned)std::min<size_t>(cores, bySize);
+}
+
+// Split [begin, end) into count pieces that all start at the beginning of a line
+static std::vector<const char*> splitAtLines(const char* begin, const char* end, unsigned count)
+{
+    std::vector<const char*> cuts(count + 1, end);
+    cuts[0] = begin;
+    size_t size = end - begin;
+    for (unsigned i = 1; i < count; i++)
+    {
+        const char* p = std::max(begin + size * i / count, cuts[i - 1]);
+        const char* newline = (const char*)memchr(p, '\n', end - p);
+        cuts[i] = newline ? newline + 1 : end;
+    }
+    return cuts;
+}
+
+static const char* skipSpaces(const char* p, const char* end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+        p++;
+    return p;
+}
+
+static const char* nextLine(const char* p, const char* end)
+{
+    const char* newline = (const char*)memchr(p, '\n', end - p);
+    return newline ? newline + 1 : end;
+}
+
+// Parse one number and advance p; from_chars doesn't accept a leading '+'
+template <typename T>
+static bool parseNumber(const char*& p, const char* end, T& value)
+{
+    p = skipSpaces(p, end);
+    if (p < end && *p == '+')
+        p++;
+    std::from_chars_result result = std::from_chars(p, end, value);
+    if (result.ec != std::errc())
+        return false;
+    p = result.ptr;
+    return true;
+}
+
+size_t meshVertexCount(const MeshData& mesh)
+{
+    return mesh.vertices.size() / MESH_VERTEX_FLOATS;
+}
+
+size_t meshDrawCount(const MeshData& mesh)
+{
+    return mesh.indices.empty() ? meshVertexCount(mesh) : mesh.indices.size();
+}
+
+void computeMeshBounds(MeshData& mesh)
+{
+    size_t vertexCount = meshVertexCount(mesh);
+    if (vertexCount == 0)
+    {
+        mesh.boundsMin = mesh.boundsMax = glm::vec3(0.0f);
+        return;
+    }
+
+    unsigned workers = workerCountFor(mesh.vertices.size() * sizeof(float));
+    std::vector<glm::vec3> mins(workers, glm::vec3(FLT_MAX)), maxs(workers, glm::vec3(-FLT_MAX));
+    runParallel(workers, [&](unsigned w) {
+        size_t first = vertexCount * w / workers, last = vertexCount * (w + 1) / workers;
+        for (size_t i = first; i < last; i++)
+        {
+            glm::vec3 p(mesh.vertices[i * 6], mesh.vertices[i * 6 + 1], mesh.vertices[i * 6 + 2]);
+            mins[w] = glm::min(mins[w], p);
+            maxs[w] = glm::max(maxs[w], p);
+        }
+    });
+
+    mesh.boundsMin = mins[0];
+    mesh.boundsMax = maxs[0];
+    for (unsigned w = 1; w < workers; w++)
+    {
+        mesh.boundsMin = glm::min(mesh.boundsMin, mins[w]);
+        mesh.boundsMax = glm::max(mesh.boundsMax, maxs[w]);
+    }
+}
+
+// Meshes without vertex colors get a color from their position inside the bounds
+static void colorByPosition(MeshData& mesh)
+{
+    size_t vertexCount = meshVertexCount(mesh);
+    glm::vec3 extent = glm::max(mesh.boundsMax - mesh.boundsMin, glm::vec3(1e-6f));
+    unsigned workers = workerCountFor(mesh.vertices.size() * sizeof(float));
+    runParallel(workers, [&](unsigned w) {
+        size_t first = vertexCount * w / workers, last = vertexCount * (w + 1) / workers;
+        for (size_t i = first; i < last; i++)
+        {
+            float* v = &mesh.vertices[i * 6];
+            glm::vec3 t = (glm::vec3(v[0], v[1], v[2]) - mesh.boundsMin) / extent;
+            v[3] = t.x; v[4] = t.y; v[5] = t.z;
+        }
+    });
+}
+
+// ---------------------------------------------------------------------------
+// OBJ
+// ---------------------------------------------------------------------------
+
+// Face index as written in the file; negative OBJ indices are relative to the vertices read so far
+struct ObjIndex
+{
+    long long value; // Zero-based absolute index, or chunk-local index when relative
+    bool relative; // True if value still needs the chunk's vertex base added
+};
+
+// Output of one parsing worker
+struct ObjChunk
+{
+    std::vector<float> vertices; // Interleaved position/color
+    std::vector<ObjIndex> indices; // Triangulated face indices
+    bool hasColors = false; // Saw at least one "v x y z r g b" line
+    bool ok = true; // Parse succeeded
+};
+
+static void parseObjChunk(const char* p, const char* end, ObjChunk& chunk)
+{
+    std::vector<ObjIndex> polygon; // Indices of the face being read
+    while (p < end && chunk.ok)
+    {
+        const char* lineEnd = nextLine(p, end);
+        p = skipSpaces(p, lineEnd);
+
+        if (lineEnd - p > 1 && p[0] == 'v' && (p[1] == ' ' || p[1] == '\t'))
+        {
+            // Vertex: position plus optional color
+            p++;
+            float values[6] = { 0, 0, 0, 1, 1, 1 };
+            int count = 0;
+            while (count < 6 && parseNumber(p, lineEnd, values[count]))
+                count++;
+            if (count < 3) { chunk.ok = false; break; }
+            if (count == 6) chunk.hasColors = true;
+            else values[3] = values[4] = values[5] = 1.0f; // "v x y z w" or no color
+            chunk.vertices.insert(chunk.vertices.end(), values, values + 6);
+        }
+        else if (lineEnd - p > 1 && p[0] == 'f' && (p[1] == ' ' || p[1] == '\t'))
+        {
+            // Face: "f v", "f v/t", "f v//n", "f v/t/n"; only the position index is used
+            p++;
+            polygon.clear();
+            long long localCount = (long long)(chunk.vertices.size() / 6);
+            long long value;
+            while (parseNumber(p, lineEnd, value))
+            {
+                if (value > 0) polygon.push_back({ value - 1, false });
+                else if (value < 0) polygon.push_back({ localCount + value, true });
+                else { chunk.ok = false; break; }
+                while (p < lineEnd && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n')
+                    p++; // Skip "/t/n"
+            }
+            for (size_t k = 1; k + 1 < polygon.size(); k++)
+            {
+                chunk.indices.push_back(polygon[0]);
+                chunk.indices.push_back(polygon[k]);
+                chunk.indices.push_back(polygon[k + 1]);
+            }
+        }
+        p = lineEnd; // Ignore everything else (vn, vt, o, g, usemtl, comments)
+    }
+}
+
+bool parseObj(const char* text, size_t size, MeshData& mesh)
+{
+    unsigned workers = workerCountFor(size);
+    std::vector<const char*> cuts = splitAtLines(text, text + size, workers);
+    std::vector<ObjChunk> chunks(workers);
+    runParallel(workers, [&](unsigned w) { parseObjChunk(cuts[w], cuts[w + 1], chunks[w]); });
+
+    // Prefix sums give every chunk its place in the final arrays
+    std::vector<size_t> vertexBase(workers + 1, 0), indexBase(workers + 1, 0);
+    bool hasColors = false;
+    for (unsigned w = 0; w < workers; w++)
+    {
+        if (!chunks[w].ok)
+        {
+            std::cout << "OBJ parse error" << std::endl;
+            return false;
+        }
+        vertexBase[w + 1] = vertexBase[w] + chunks[w].vertices.size() / 6;
+        indexBase[w + 1] = indexBase[w] + chunks[w].indices.size();
+        hasColors = hasColors || chunks[w].hasColors;
+    }
+
+    size_t vertexCount = vertexBase[workers];
+    mesh.vertices.resize(vertexCount * 6);
+    mesh.indices.resize(indexBase[workers]);
+
+    bool indicesValid = true;
+    runParallel(workers, [&](unsigned w) {
+        ObjChunk& chunk = chunks[w];
+        std::copy(chunk.vertices.begin(), chunk.vertices.end(), mesh.vertices.begin() + vertexBase[w] * 6);
+        unsigned int* out = mesh.indices.data() + indexBase[w];
+        for (const ObjIndex& index : chunk.indices)
+        {
+            long long absolute = index.relative ? (long long)vertexBase[w] + index.value : index.value;
+            if (absolute < 0 || absolute >= (long long)vertexCount)
+            {
+                indicesValid = false; // Benign race: every writer stores false
+                absolute = 0;
+            }
+            *out++ = (unsigned int)absolute;
+        }
+        std::vector<float>().swap(chunk.vertices); // Free as we go
+    });
+
+    if (!indicesValid)
+    {
+        std::cout << "OBJ face references a missing vertex" << std::endl;
+        return false;
+    }
+
+    computeMeshBounds(mesh);
+    if (!hasColors)
+        colorByPosition(mesh);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// PLY
+// ---------------------------------------------------------------------------
+
+enum PlyType { PLY_INVALID, PLY_INT8, PLY_UINT8, PLY_INT16, PLY_UINT16, PLY_INT32, PLY_UINT32, PLY_FLOAT32, PLY_FLOAT64 };
+
+struct PlyProperty
+{
+    std::string name; // Property name (x, red, vertex_indices...)
+    PlyType type = PLY_INVALID; // Value type, or item type for lists
+    PlyType countType = PLY_INVALID; // Length type for lists
+    bool isList = false; // "property list ..."
+};
+
+struct PlyElement
+{
+    std::string name; // Element name (vertex, face...)
+    size_t count = 0; // Number of instances
+    std::vector<PlyProperty> properties; // Properties in file order
+};
+
+static PlyType plyTypeFromName(const std::string& name)
+{
+    if (name == "char" || name == "int8") return PLY_INT8;
+    if (name == "uchar" || name == "uint8") return PLY_UINT8;
+    if (name == "short" || name == "int16") return PLY_INT16;
+    if (name == "ushort" || name == "uint16") return PLY_UINT16;
+    if (name == "int" || name == "int32") return PLY_INT32;
+    if (name == "uint" || name == "uint32") return PLY_UINT32;
+    if (name == "float" || name == "float32") return PLY_FLOAT32;
+    if (name == "double" || name == "float64") return PLY_FLOAT64;
+    return PLY_INVALID;
+}
+
+static size_t plyTypeSize(PlyType type)
+{
+    switch (type)
+    {
+    case PLY_INT8: case PLY_UINT8: return 1;
+    case PLY_INT16: case PLY_UINT16: return 2;
+    case PLY_INT32: case PLY_UINT32: case PLY_FLOAT32: return 4;
+    case PLY_FLOAT64: return 8;
+    default: return 0;
+    }
+}
+
+// Read one little-endian binary value as a double
+static double readPlyValue(const char* p, PlyType type)
+{
+    switch (type)
+    {
+    case PLY_INT8: { int8_t v; memcpy(&v, p, 1); return v; }
+    case PLY_UINT8: { uint8_t v; memcpy(&v, p, 1); return v; }
+    case PLY_INT16: { int16_t v; memcpy(&v, p, 2); return v; }
+    case PLY_UINT16: { uint16_t v; memcpy(&v, p, 2); return v; }
+    case PLY_INT32: { int32_t v; memcpy(&v, p, 4); return v; }
+    case PLY_UINT32: { uint32_t v; memcpy(&v, p, 4); return v; }
+    case PLY_FLOAT32: { float v; memcpy(&v, p, 4); return v; }
+    case PLY_FLOAT64: { double v; memcpy(&v, p, 8); return v; }
+    default: return 0.0;
+    }
+}
+
+// Where the interesting vertex properties live inside a vertex record
+struct PlyVertexLayout
+{
+    int position[3] = { -1, -1, -1 }; // Property index of x, y, z
+    int color[3] = { -1, -1, -1 }; // Property index of red, green, blue
+    float colorScale = 1.0f; // 1/255 for integer colors
+};
+
+static PlyVertexLayout plyVertexLayout(const PlyElement& element)
+{
+    PlyVertexLayout layout;
+    const char* positionNames[3] = { "x", "y", "z" };
+    const char* colorNames[3] = { "red", "green", "blue" };
+    for (int i = 0; i < (int)element.properties.size(); i++)
+    {
+        const PlyProperty& property = element.properties[i];
+        for (int c = 0; c < 3; c++)
+        {
+            if (property.name == positionNames[c]) layout.position[c] = i;
+            if (property.name == colorNames[c])
+            {
+                layout.color[c] = i;
+                bool isFloat = property.type == PLY_FLOAT32 || property.type == PLY_FLOAT64;
+                layout.colorScale = isFloat ? 1.0f : 1.0f / 255.0f;
+            }
+        }
+    }
+    return layout;
+}
+
+// Write one vertex given its property values in file order
+static void storePlyVertex(const double* values, const PlyVertexLayout& layout, bool hasColors, float* out)
+{
+    for (int c = 0; c < 3; c++)
+    {
+        out[c] = (float)values[layout.position[c]];
+        out[3 + c] = hasColors ? (float)values[layout.color[c]] * layout.colorScale : 1.0f;
+    }
+}
+
+static void appendFan(const std::vector<unsigned int>& polygon, std::vector<unsigned int>& out)
+{
+    for (size_t k = 1; k + 1 < polygon.size(); k++)
+    {
+        out.push_back(polygon[0]);
+        out.push_back(polygon[k]);
+        out.push_back(polygon[k + 1]);
+    }
+}
+
+// Ascii body: every element instance is one line, so lines are counted in parallel first
+static bool parsePlyAscii(const char* begin, const char* end, const std::vector<PlyElement>& elements, MeshData& mesh)
+{
+    unsigned workers = workerCountFor(end - begin);
+    std::vector<const char*> cuts = splitAtLines(begin, end, workers);
+
+    std::vector<size_t> lineBase(workers + 1, 0);
+    runParallel(workers, [&](unsigned w) {
+        size_t lines = 0;
+        for (const char* p = cuts[w]; p < cuts[w + 1]; p = nextLine(p, cuts[w + 1]))
+            lines++;
+        lineBase[w + 1] = lines;
+    });
+    for (unsigned w = 0; w < workers; w++)
+        lineBase[w + 1] += lineBase[w];
+
+    // First line of every element
+    std::vector<size_t> elementStart(elements.size() + 1, 0);
+    for (size_t e = 0; e < elements.size(); e++)
+        elementStart[e + 1] = elementStart[e] + elements[e].count;
+
+    int vertexElement = -1, faceElement = -1;
+    for (size_t e = 0; e < elements.size(); e++)
+    {
+        if (elements[e].name == "vertex") vertexElement = (int)e;
+        if (elements[e].name == "face") faceElement = (int)e;
+    }
+
+    PlyVertexLayout layout = plyVertexLayout(elements[vertexElement]);
+    bool hasColors = layout.color[0] >= 0 && layout.color[1] >= 0 && layout.color[2] >= 0;
+    size_t vertexCount = elements[vertexElement].count;
+    mesh.vertices.resize(vertexCount * 6);
+
+    std::vector<std::vector<unsigned int>> faceChunks(workers);
+    std::vector<char> chunkOk(workers, 1);
+    runParallel(workers, [&](unsigned w) {
+        std::vector<double> values;
+        std::vector<unsigned int> polygon;
+        size_t line = lineBase[w];
+        for (const char* p = cuts[w]; p < cuts[w + 1]; line++)
+        {
+            const char* lineEnd = nextLine(p, cuts[w + 1]);
+            if (line >= elementStart[vertexElement] && line < elementStart[vertexElement + 1])
+            {
+                // Vertices go straight to their final slot
+                const PlyElement& element = elements[vertexElement];
+                values.resize(element.properties.size());
+                for (double& value : values)
+                    if (!parseNumber(p, lineEnd, value)) { chunkOk[w] = 0; return; }
+                storePlyVertex(values.data(), layout, hasColors, &mesh.vertices[(line - elementStart[vertexElement]) * 6]);
+            }
+            else if (faceElement >= 0 && line >= elementStart[faceElement] && line < elementStart[faceElement + 1])
+            {
+                size_t count;
+                // Each index takes a separator and a digit at least, which bounds a corrupt count
+                if (!parseNumber(p, lineEnd, count) || count > (size_t)(lineEnd - p) / 2) { chunkOk[w] = 0; return; }
+                polygon.resize(count);
+                for (unsigned int& index : polygon)
+                    if (!parseNumber(p, lineEnd, index) || index >= vertexCount) { chunkOk[w] = 0; return; }
+                appendFan(polygon, faceChunks[w]);
+            }
+            p = lineEnd;
+        }
+    });
+
+    for (unsigned w = 0; w < workers; w++)
+        if (!chunkOk[w])
+            return false;
+
+    size_t indexCount = 0;
+    for (const std::vector<unsigned int>& chunk : faceChunks)
+        indexCount += chunk.size();
+    mesh.indices.clear();
+    mesh.indices.reserve(indexCount);
+    for (const std::vector<unsigned int>& chunk : faceChunks)
+        mesh.indices.insert(mesh.indices.end(), chunk.begin(), chunk.end());
+    return true;
+}
+
+// Binary body: fixed-size elements are parsed in parallel, list elements are walked in order
+static bool parsePlyBinary(const char* begin, const char* end, const std::vector<PlyElement>& elements, MeshData& mesh)
+{
+    const char* p = begin;
+    mesh.indices.clear();
+
+    for (const PlyElement& element : elements)
+    {
+        bool fixedSize = true;
+        size_t stride = 0;
+        std::vector<size_t> offsets;
+        for (const PlyProperty& property : element.properties)
+        {
+            fixedSize = fixedSize && !property.isList;
+            offsets.push_back(stride);
+            stride += plyTypeSize(property.type);
+        }
+
+        if (element.name == "vertex")
+        {
+            if (!fixedSize || stride == 0 || element.count > (size_t)(end - p) / stride)
+                return false;
+            PlyVertexLayout layout = plyVertexLayout(element);
+            bool hasColors = layout.color[0] >= 0 && layout.color[1] >= 0 && layout.color[2] >= 0;
+            mesh.vertices.resize(element.count * 6);
+            unsigned workers = workerCountFor(stride * element.count);
+            const char* base = p;
+            runParallel(workers, [&](unsigned w) {
+                std::vector<double> values(element.properties.size());
+                size_t first = element.count * w / workers, last = element.count * (w + 1) / workers;
+                for (size_t i = first; i < last; i++)
+                {
+                    const char* record = base + i * stride;
+                    for (size_t k = 0; k < values.size(); k++)
+                        values[k] = readPlyValue(record + offsets[k], element.properties[k].type);
+                    storePlyVertex(values.data(), layout, hasColors, &mesh.vertices[i * 6]);
+                }
+            });
+            p += stride * element.count;
+        }
+        else if (fixedSize)
+        {
+            if (stride != 0 && element.count > (size_t)(end - p) / stride)
+                return false;
+            p += stride * element.count; // Skip elements we don't use
+        }
+        else
+        {
+            // Variable-size records (faces); only the list named vertex_indices/vertex_index is used
+            bool isFace = element.name == "face";
+            size_t vertexCount = meshVertexCount(mesh);
+            std::vector<unsigned int> polygon;
+            if (isFace)
+                mesh.indices.reserve(element.count * 3);
+            for (size_t i = 0; i < element.count; i++)
+            {
+                for (const PlyProperty& property : element.properties)
+                {
+                    if (!property.isList)
+                    {
+                        if ((size_t)(end - p) < plyTypeSize(property.type))
+                            return false;
+                        p += plyTypeSize(property.type);
+                        continue;
+                    }
+                    size_t countSize = plyTypeSize(property.countType), itemSize = plyTypeSize(property.type);
+                    if ((size_t)(end - p) < countSize)
+                        return false;
+                    double listSize = readPlyValue(p, property.countType);
+                    p += countSize;
+                    if (!(listSize >= 0.0 && listSize <= (double)((size_t)(end - p) / itemSize)))
+                        return false; // Negative, or runs past the end of the file
+                    size_t count = (size_t)listSize;
+                    bool isIndices = isFace && (property.name == "vertex_indices" || property.name == "vertex_index");
+                    if (isIndices)
+                    {
+                        polygon.resize(count);
+                        for (size_t k = 0; k < count; k++)
+                        {
+                            polygon[k] = (unsigned int)readPlyValue(p + k * itemSize, property.type);
+                            if (polygon[k] >= vertexCount)
+                                return false;
+                        }
+                        appendFan(polygon, mesh.indices);
+                    }
+                    p += count * itemSize;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool parsePly(const char* data, size_t size, MeshData& mesh)
+{
+    const char* end = data + size;
+    const char* p = data;
+    if (size < 4 || memcmp(data, "ply", 3) != 0)
+    {
+        std::cout << "Not a PLY file" << std::endl;
+        return false;
+    }
+
+    // Header is plain text up to "end_header"
+    std::string format;
+    std::vector<PlyElement> elements;
+    bool headerDone = false;
+    p = nextLine(p, end);
+    while (p < end && !headerDone)
+    {
+        const char* lineEnd = nextLine(p, end);
+        std::string line(p, lineEnd);
+        while (!line.empty() && (line.back() == '\n' || line.back() == '\r'))
+            line.pop_back();
+        p = lineEnd;
+
+        std::vector<std::string> tokens;
+        size_t start = 0;
+        while (start < line.size())
+        {
+            size_t stop = line.find(' ', start);
+            if (stop == std::string::npos) stop = line.size();
+            if (stop > start) tokens.push_back(line.substr(start, stop - start));
+            start = stop + 1;
+        }
+        if (tokens.empty())
+            continue;
+
+        if (tokens[0] == "format" && tokens.size() >= 2)
+            format = tokens[1];
+        else if (tokens[0] == "element" && tokens.size() >= 3)
+        {
+            PlyElement element;
+            element.name = tokens[1];
+            const char* countEnd = tokens[2].data() + tokens[2].size();
+            std::from_chars_result result = std::from_chars(tokens[2].data(), countEnd, element.count);
+            if (result.ec != std::errc() || result.ptr != countEnd || element.count > size)
+            {
+                // Every record takes at least a byte, so a larger count can only be a broken header
+                std::cout << "Bad PLY element count: " << line << std::endl;
+                return false;
+            }
+            elements.push_back(element);
+        }
+        else if (tokens[0] == "property" && !elements.empty())
+        {
+            PlyProperty property;
+            if (tokens.size() >= 5 && tokens[1] == "list")
+            {
+                property.isList = true;
+                property.countType = plyTypeFromName(tokens[2]);
+                property.type = plyTypeFromName(tokens[3]);
+                property.name = tokens[4];
+                if (property.countType == PLY_INVALID) return false;
+            }
+            else if (tokens.size() >= 3)
+            {
+                property.type = plyTypeFromName(tokens[1]);
+                property.name = tokens[2];
+            }
+            if (property.type == PLY_INVALID)
+            {
+                std::cout << "Unsupported PLY property: " << line << std::endl;
+                return false;
+            }
+            elements.back().properties.push_back(property);
+        }
+        else if (tokens[0] == "end_header")
+            headerDone = true;
+    }
+
+    int vertexElement = -1;
+    for (size_t e = 0; e < elements.size(); e++)
+        if (elements[e].name == "vertex")
+            vertexElement = (int)e;
+    if (!headerDone || vertexElement < 0)
+    {
+        std::cout << "PLY header is incomplete" << std::endl;
+        return false;
+    }
+    PlyVertexLayout layout = plyVertexLayout(elements[vertexElement]);
+    if (layout.position[0] < 0 || layout.position[1] < 0 || layout.position[2] < 0)
+    {
+        std::cout << "PLY vertices have no x/y/z" << std::endl;
+        return false;
+    }
+    bool hasColors = layout.color[0] >= 0 && layout.color[1] >= 0 && layout.color[2] >= 0;
+
+    bool ok;
+    if (format == "ascii")
+        ok = parsePlyAscii(p, end, elements, mesh);
+    else if (format == "binary_little_endian")
+        ok = parsePlyBinary(p, end, elements, mesh);
+    else
+    {
+        std::cout << "Unsupported PLY format: " << format << std::endl;
+        return false;
+    }
+    if (!ok)
+    {
+        std::cout << "PLY parse error" << std::endl;
+        return false;
+    }
+
+    computeMeshBounds(mesh);
+    if (!hasColors)
+        colorByPosition(mesh);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Entry point
+// ---------------------------------------------------------------------------
+
+bool parseMesh(const char* path, const char* data, size_t size, MeshData& mesh)
+{
+    std::string name(path);
+    std::string extension = name.substr(name.find_last_of('.') + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)tolower(c); });
+
+    if (extension == "obj")
+        return parseObj(data, size, mesh);
+    if (extension == "ply")
+        return parsePly(data, size, mesh);
+    std::cout << "Unknown mesh format: " << path << std::endl;
+    return false;
+}
+
+bool loadMesh(const char* path, MeshData& mesh)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    MappedFile file;
+    if (!mapFile(path, file))
+    {
+        std::cout << "Failed to open mesh: " << path << std::endl;
+        return false;
+    }
+
+    bool ok = parseMesh(path, file.data, file.size, mesh);
+    size_t bytes = file.size;
+    unmapFile(file);
+
+    if (ok)
+    {
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Loaded " << path << ": " << meshVertexCount(mesh) << " vertices, "
+                  << mesh.indices.size() / 3 << " triangles in " << seconds * 1000.0 << " ms ("
+                  << bytes / (1024.0 * 1024.0) / std::max(seconds, 1e-9) << " MB/s)" << std::endl;
+    }
+    return ok;
+}
+
+// ---------------------------------------------------------------------------
+// Self check
+// ---------------------------------------------------------------------------
+
+struct ImportCase
+{
+    const char* name; // Printed with the result
+    const char* extension; // Picks the parser
+    std::string data; // File contents
+    bool valid; // Whether the import must succeed
+};
+
+int runImportSelfCheck()
+{
+    const std::string plyAscii = "ply\nformat ascii 1.0\nelement vertex 3\nproperty float x\nproperty float y\nproperty float z\n"
+                                 "element face 1\nproperty list uchar int vertex_indices\nend_header\n0 0 0\n1 0 0\n0 1 0\n";
+    const std::string plyBinary = "ply\nformat binary_little_endian 1.0\nelement vertex 3\nproperty float x\nproperty float y\n"
+                                  "property float z\nelement face 1\nproperty uchar flags\nproperty list uchar int vertex_indices\nend_header\n";
+    std::string vertices(3 * 3 * sizeof(float), '\0');
+    std::string face = std::string("\0\3", 2) + std::string("\0\0\0\0\1\0\0\0\2\0\0\0", 12);
+
+    std::vector<ImportCase> cases = {
+        { "obj triangle", "obj", "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n", true },
+        { "ascii ply", "ply", plyAscii + "3 0 1 2\n", true },
+        { "ascii ply, index out of range", "ply", plyAscii + "3 0 1 7\n", false },
+        { "ascii ply, face count too large", "ply", plyAscii + "4000000000 0 1 2\n", false },
+        { "ascii ply, face shorter than its count", "ply", plyAscii + "4 0 1 2\n", false },
+        { "ascii ply, malformed element count", "ply", "ply\nformat ascii 1.0\nelement vertex x3\nproperty float x\nend_header\n", false },
+        { "binary ply", "ply", plyBinary + vertices + face, true },
+        { "binary ply, truncated before a scalar", "ply", plyBinary + vertices, false },
+        { "binary ply, truncated list", "ply", plyBinary + vertices + face.substr(0, 5), false },
+        { "binary ply, element count overflows the stride", "ply",
+          "ply\nformat binary_little_endian 1.0\nelement vertex 768614336404564651\nproperty float x\nproperty float y\n"
+          "property float z\nend_header\n" + vertices, false },
+    };
+
+    int failures = 0;
+    for (const ImportCase& test : cases)
+    {
+        MeshData mesh;
+        std::string path = std::string("check.") + test.extension;
+        bool ok = parseMesh(path.c_str(), test.data.data(), test.data.size(), mesh);
+        bool passed = ok == test.valid;
+        failures += passed ? 0 : 1;
+        std::cout << (passed ? "PASS " : "FAIL ") << test.name << std::endl;
+    }
+    std::cout << "Import check: " << cases.size() - failures << " of " << cases.size() << " passed" << std::endl;
+    return failures;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstddef> // For size_t
+#include <vector> // Vertex/index storage
+#include <glm/glm.hpp> // Bounds
+
+// Floats per vertex: position (xyz) + color (rgb), same layout as the VAO in main()
+const int MESH_VERTEX_FLOATS = 6;
+
+// Geometry ready to be handed to glBufferData
+struct MeshData
+{
+    std::vector<float> vertices; // Interleaved position/color
+    std::vector<unsigned int> indices; // Triangle list; empty means draw vertices in order
+    glm::vec3 boundsMin = glm::vec3(0.0f); // Smallest corner of the bounding box
+    glm::vec3 boundsMax = glm::vec3(0.0f); // Largest corner of the bounding box
+};
+
+// Number of vertices stored in the mesh
+size_t meshVertexCount(const MeshData& mesh);
+
+// Number of elements to pass to glDrawArrays/glDrawElements
+size_t meshDrawCount(const MeshData& mesh);
+
+// Load an .obj or .ply file (chosen by extension) through a memory mapping
+bool loadMesh(const char* path, MeshData& mesh);
+
+// Parse an already mapped .obj or .ply file (chosen by the extension of path)
+bool parseMesh(const char* path, const char* data, size_t size, MeshData& mesh);
+
+// Parse OBJ text ("v x y z [r g b]" and "f" lines); polygons are fan-triangulated
+bool parseObj(const char* text, size_t size, MeshData& mesh);
+
+// Parse an ascii or binary_little_endian PLY file
+bool parsePly(const char* data, size_t size, MeshData& mesh);
+
+// Recompute boundsMin/boundsMax from the vertex positions
+void computeMeshBounds(MeshData& mesh);
+
+// Parse built-in valid and malformed OBJ/PLY files and check each is accepted or rejected; returns the failures
+int runImportSelfCheck();
@@ -0,0 +1,443 @@
+#include "NullGL.h"
+#include <glad/glad.h> // GL types and enums
+#include <algorithm> // std::sort
+#include <cstdint> // uintptr_t
+#include <cstring> // strcmp
+#include <iostream> // For outputting errors and messages
+#include <unordered_map> // Buffer storage
+#include <unordered_set> // Live object names
+#include <vector> // Report ordering
+
+static void nullGlCount(int function);
+#include "NullGLFunctions.inl" // Counting stubs for every entry point glad loads
+
+static size_t callCounts[NULL_GL_FUNCTION_COUNT]; // Calls per entry point
+static size_t errorCount = 0; // Validation failures since the last reset
+static GLenum pendingError = GL_NO_ERROR; // What glGetError returns next
+static GLuint nextName = 1; // Shared name counter for every object type
+static std::unordered_set<GLuint> buffers, textures, vertexArrays, framebuffers, renderbuffers, queries, shaders, programs;
+static std::unordered_map<GLenum, GLuint> bufferBindings; // Target -> bound buffer
+static std::unordered_map<GLuint, std::vector<char>> bufferStorage; // Backing memory handed out by glMapBufferRange
+static GLuint boundVertexArray = 0; // Core profile draws need one
+static GLint viewport[4] = { 0, 0, 0, 0 }; // For glGetIntegerv(GL_VIEWPORT)
+static size_t drawCalls = 0, drawnVertices = 0; // Submitted work
+
+static void nullGlCount(int function)
+{
+    callCounts[function]++;
+}
+
+// Record a GL error the way a driver would: the first one sticks until glGetError
+static void raiseError(const char* function, GLenum error, const char* reason)
+{
+    if (errorCount < 10)
+        std::cout << "NullGL: " << function << ": error 0x" << std::hex << error << std::dec << " (" << reason << ")" << std::endl;
+    errorCount++;
+    if (pendingError == GL_NO_ERROR)
+        pendingError = error;
+}
+
+// ---------------------------------------------------------------------------
+// Overrides: entry points that need state or a non-zero answer
+// ---------------------------------------------------------------------------
+
+static const GLubyte* APIENTRY nullGetString(GLenum name)
+{
+    nullGlCount(NULL_GL_glGetString);
+    switch (name)
+    {
+    case GL_VENDOR: return (const GLubyte*)"NullGL";
+    case GL_RENDERER: return (const GLubyte*)"NullGL (no rendering)";
+    case GL_VERSION: return (const GLubyte*)"3.3.0 Core NullGL";
+    case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte*)"3.30";
+    }
+    raiseError("glGetString", GL_INVALID_ENUM, "unknown name");
+    return NULL;
+}
+
+// One placeholder extension: glad's loader fails on a context that reports none
+static const GLubyte* APIENTRY nullGetStringi(GLenum name, GLuint index)
+{
+    nullGlCount(NULL_GL_glGetStringi);
+    if (name == GL_EXTENSIONS && index == 0)
+        return (const GLubyte*)"GL_NULLGL_no_rendering";
+    raiseError("glGetStringi", GL_INVALID_VALUE, "index out of range");
+    return NULL;
+}
+
+static void APIENTRY nullGetIntegerv(GLenum name, GLint* data)
+{
+    nullGlCount(NULL_GL_glGetIntegerv);
+    if (!data)
+        return;
+    switch (name)
+    {
+    case GL_NUM_EXTENSIONS: data[0] = 1; break;
+    case GL_MAJOR_VERSION: data[0] = 3; break;
+    case GL_MINOR_VERSION: data[0] = 3; break;
+    case GL_MAX_TEXTURE_SIZE: data[0] = 16384; break;
+    case GL_VIEWPORT: memcpy(data, viewport, sizeof(viewport)); break;
+    default: data[0] = 0; break;
+    }
+}
+
+static GLenum APIENTRY nullGetError()
+{
+    nullGlCount(NULL_GL_glGetError);
+    GLenum error = pendingError;
+    pendingError = GL_NO_ERROR;
+    return error;
+}
+
+static void generateNames(const char* function, std::unordered_set<GLuint>& live, GLsizei n, GLuint* names)
+{
+    if (n < 0)
+    {
+        raiseError(function, GL_INVALID_VALUE, "negative count");
+        return;
+    }
+    for (GLsizei i = 0; i < n; i++)
+    {
+        names[i] = nextName++;
+        live.insert(names[i]);
+    }
+}
+
+static void deleteNames(const char* function, std::unordered_set<GLuint>& live, GLsizei n, const GLuint* names)
+{
+    if (n < 0)
+    {
+        raiseError(function, GL_INVALID_VALUE, "negative count");
+        return;
+    }
+    for (GLsizei i = 0; i < n; i++)
+        live.erase(names[i]); // Unknown names are silently ignored, as in GL
+}
+
+// Binding name 0 is always fine; anything else must have come from glGen*
+static bool checkName(const char* function, const std::unordered_set<GLuint>& live, GLuint name)
+{
+    if (name == 0 || live.count(name))
+        return true;
+    raiseError(function, GL_INVALID_OPERATION, "name was never generated");
+    return false;
+}
+
+static void APIENTRY nullGenBuffers(GLsizei n, GLuint* names) { nullGlCount(NULL_GL_glGenBuffers); generateNames("glGenBuffers", buffers, n, names); }
+static void APIENTRY nullGenTextures(GLsizei n, GLuint* names) { nullGlCount(NULL_GL_glGenTextures); generateNames("glGenTextures", textures, n, names); }
+static void APIENTRY nullGenVertexArrays(GLsizei n, GLuint* names) { nullGlCount(NULL_GL_glGenVertexArrays); generateNames("glGenVertexArrays", vertexArrays, n, names); }
+static void APIENTRY nullGenFramebuffers(GLsizei n, GLuint* names) { nullGlCount(NULL_GL_glGenFramebuffers); generateNames("glGenFramebuffers", framebuffers, n, names); }
+static void APIENTRY nullGenRenderbuffers(GLsizei n, GLuint* names) { nullGlCount(NULL_GL_glGenRenderbuffers); generateNames("glGenRenderbuffers", renderbuffers, n, names); }
+static void APIENTRY nullGenQueries(GLsizei n, GLuint* names) { nullGlCount(NULL_GL_glGenQueries); generateNames("glGenQueries", queries, n, names); }
+
+static void APIENTRY nullDeleteBuffers(GLsizei n, const GLuint* names)
+{
+    nullGlCount(NULL_GL_glDeleteBuffers);
+    deleteNames("glDeleteBuffers", buffers, n, names);
+    for (GLsizei i = 0; i < n; i++)
+        bufferStorage.erase(names[i]);
+}
+static void APIENTRY nullDeleteTextures(GLsizei n, const GLuint* names) { nullGlCount(NULL_GL_glDeleteTextures); deleteNames("glDeleteTextures", textures, n, names); }
+static void APIENTRY nullDeleteVertexArrays(GLsizei n, const GLuint* names) { nullGlCount(NULL_GL_glDeleteVertexArrays); deleteNames("glDeleteVertexArrays", vertexArrays, n, names); }
+static void APIENTRY nullDeleteFramebuffers(GLsizei n, const GLuint* names) { nullGlCount(NULL_GL_glDeleteFramebuffers); deleteNames("glDeleteFramebuffers", framebuffers, n, names); }
+static void APIENTRY nullDeleteRenderbuffers(GLsizei n, const GLuint* names) { nullGlCount(NULL_GL_glDeleteRenderbuffers); deleteNames("glDeleteRenderbuffers", renderbuffers, n, names); }
+static void APIENTRY nullDeleteQueries(GLsizei n, const GLuint* names) { nullGlCount(NULL_GL_glDeleteQueries); deleteNames("glDeleteQueries", queries, n, names); }
+
+static GLuint APIENTRY nullCreateShader(GLenum type)
+{
+    nullGlCount(NULL_GL_glCreateShader);
+    if (type != GL_VERTEX_SHADER && type != GL_FRAGMENT_SHADER && type != GL_GEOMETRY_SHADER)
+    {
+        raiseError("glCreateShader", GL_INVALID_ENUM, "unknown shader type");
+        return 0;
+    }
+    shaders.insert(nextName);
+    return nextName++;
+}
+
+static GLuint APIENTRY nullCreateProgram()
+{
+    nullGlCount(NULL_GL_glCreateProgram);
+    programs.insert(nextName);
+    return nextName++;
+}
+
+static void APIENTRY nullDeleteShader(GLuint shader) { nullGlCount(NULL_GL_glDeleteShader); shaders.erase(shader); }
+static void APIENTRY nullDeleteProgram(GLuint program) { nullGlCount(NULL_GL_glDeleteProgram); programs.erase(program); }
+
+// Every shader compiles and every program links
+static void APIENTRY nullGetShaderiv(GLuint shader, GLenum name, GLint* value)
+{
+    nullGlCount(NULL_GL_glGetShaderiv);
+    if (!shaders.count(shader))
+        raiseError("glGetShaderiv", GL_INVALID_VALUE, "not a shader");
+    *value = name == GL_COMPILE_STATUS ? GL_TRUE : 0;
+}
+
+static void APIENTRY nullGetProgramiv(GLuint program, GLenum name, GLint* value)
+{
+    nullGlCount(NULL_GL_glGetProgramiv);
+    if (!programs.count(program))
+        raiseError("glGetProgramiv", GL_INVALID_VALUE, "not a program");
+    *value = (name == GL_LINK_STATUS || name == GL_VALIDATE_STATUS) ? GL_TRUE : 0;
+}
+
+static void APIENTRY nullGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* log)
+{
+    nullGlCount(NULL_GL_glGetShaderInfoLog);
+    if (length) *length = 0;
+    if (log && bufSize > 0) log[0] = '\0';
+}
+
+static void APIENTRY nullGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length, GLchar* log)
+{
+    nullGlCount(NULL_GL_glGetProgramInfoLog);
+    if (length) *length = 0;
+    if (log && bufSize > 0) log[0] = '\0';
+}
+
+static GLint APIENTRY nullGetUniformLocation(GLuint program, const GLchar* name)
+{
+    nullGlCount(NULL_GL_glGetUniformLocation);
+    if (!programs.count(program))
+    {
+        raiseError("glGetUniformLocation", GL_INVALID_VALUE, "not a program");
+        return -1;
+    }
+    return 0;
+}
+
+static void APIENTRY nullBindBuffer(GLenum target, GLuint buffer)
+{
+    nullGlCount(NULL_GL_glBindBuffer);
+    if (checkName("glBindBuffer", buffers, buffer))
+        bufferBindings[target] = buffer;
+}
+
+static void APIENTRY nullBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+{
+    nullGlCount(NULL_GL_glBufferData);
+    GLuint buffer = bufferBindings[target];
+    if (size < 0)
+        raiseError("glBufferData", GL_INVALID_VALUE, "negative size");
+    else if (buffer == 0)
+        raiseError("glBufferData", GL_INVALID_OPERATION, "no buffer bound");
+    else
+        bufferStorage[buffer].resize((size_t)size); // Contents are never read
+}
+
+static void* APIENTRY nullMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    nullGlCount(NULL_GL_glMapBufferRange);
+    GLuint buffer = bufferBindings[target];
+    if (buffer == 0)
+    {
+        raiseError("glMapBufferRange", GL_INVALID_OPERATION, "no buffer bound");
+        return NULL;
+    }
+    std::vector<char>& storage = bufferStorage[buffer];
+    if (offset < 0 || length <= 0 || (size_t)(offset + length) > storage.size())
+    {
+        raiseError("glMapBufferRange", GL_INVALID_VALUE, "range outside the buffer");
+        return NULL;
+    }
+    return storage.data() + offset;
+}
+
+static GLboolean APIENTRY nullUnmapBuffer(GLenum target)
+{
+    nullGlCount(NULL_GL_glUnmapBuffer);
+    return GL_TRUE;
+}
+
+static void APIENTRY nullBindTexture(GLenum target, GLuint texture)
+{
+    nullGlCount(NULL_GL_glBindTexture);
+    checkName("glBindTexture", textures, texture);
+}
+
+static void APIENTRY nullBindVertexArray(GLuint array)
+{
+    nullGlCount(NULL_GL_glBindVertexArray);
+    if (checkName("glBindVertexArray", vertexArrays, array))
+        boundVertexArray = array;
+}
+
+static void APIENTRY nullBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    nullGlCount(NULL_GL_glBindFramebuffer);
+    checkName("glBindFramebuffer", framebuffers, framebuffer);
+}
+
+static void APIENTRY nullUseProgram(GLuint program)
+{
+    nullGlCount(NULL_GL_glUseProgram);
+    checkName("glUseProgram", programs, program);
+}
+
+static void APIENTRY nullViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    nullGlCount(NULL_GL_glViewport);
+    if (width < 0 || height < 0)
+    {
+        raiseError("glViewport", GL_INVALID_VALUE, "negative size");
+        return;
+    }
+    viewport[0] = x; viewport[1] = y; viewport[2] = width; viewport[3] = height;
+}
+
+static void APIENTRY nullClear(GLbitfield mask)
+{
+    nullGlCount(NULL_GL_glClear);
+    if (mask & ~(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT))
+        raiseError("glClear", GL_INVALID_VALUE, "unknown bits in mask");
+}
+
+static void APIENTRY nullTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height,
+    GLint border, GLenum format, GLenum type, const void* pixels)
+{
+    nullGlCount(NULL_GL_glTexImage2D);
+    if (level < 0 || width < 0 || height < 0 || border != 0)
+        raiseError("glTexImage2D", GL_INVALID_VALUE, "bad level, size or border");
+}
+
+// Shared checks for the draw entry points
+static bool checkDraw(const char* function, GLenum mode, GLsizei count)
+{
+    bool validMode = mode <= GL_TRIANGLE_FAN || (mode >= GL_LINES_ADJACENCY && mode <= GL_TRIANGLE_STRIP_ADJACENCY);
+    if (!validMode)
+        raiseError(function, GL_INVALID_ENUM, "unknown primitive mode");
+    else if (count < 0)
+        raiseError(function, GL_INVALID_VALUE, "negative count");
+    else if (boundVertexArray == 0)
+        raiseError(function, GL_INVALID_OPERATION, "no vertex array bound (core profile)");
+    else
+    {
+        drawCalls++;
+        drawnVertices += count;
+        return true;
+    }
+    return false;
+}
+
+static void APIENTRY nullDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    nullGlCount(NULL_GL_glDrawArrays);
+    checkDraw("glDrawArrays", mode, count);
+}
+
+static void APIENTRY nullDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices)
+{
+    nullGlCount(NULL_GL_glDrawElements);
+    if (type != GL_UNSIGNED_BYTE && type != GL_UNSIGNED_SHORT && type != GL_UNSIGNED_INT)
+        raiseError("glDrawElements", GL_INVALID_ENUM, "bad index type");
+    else
+        checkDraw("glDrawElements", mode, count);
+}
+
+static GLenum APIENTRY nullCheckFramebufferStatus(GLenum target)
+{
+    nullGlCount(NULL_GL_glCheckFramebufferStatus);
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+// Fences are signalled as soon as they are created
+static GLuint nextSync = 1; // Fake GLsync values
+static GLsync APIENTRY nullFenceSync(GLenum condition, GLbitfield flags)
+{
+    nullGlCount(NULL_GL_glFenceSync);
+    return (GLsync)(uintptr_t)nextSync++;
+}
+
+static GLenum APIENTRY nullClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    nullGlCount(NULL_GL_glClientWaitSync);
+    return GL_ALREADY_SIGNALED;
+}
+
+static void APIENTRY nullGetQueryObjectiv(GLuint id, GLenum name, GLint* value)
+{
+    nullGlCount(NULL_GL_glGetQueryObjectiv);
+    *value = name == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0;
+}
+
+struct NullOverride
+{
+    const char* name; // Entry point
+    void* function; // Replacement for the generated stub
+};
+
+static const NullOverride nullOverrides[] = {
+    { "glGetString", (void*)nullGetString }, { "glGetStringi", (void*)nullGetStringi },
+    { "glGetIntegerv", (void*)nullGetIntegerv }, { "glGetError", (void*)nullGetError },
+    { "glGenBuffers", (void*)nullGenBuffers }, { "glGenTextures", (void*)nullGenTextures },
+    { "glGenVertexArrays", (void*)nullGenVertexArrays }, { "glGenFramebuffers", (void*)nullGenFramebuffers },
+    { "glGenRenderbuffers", (void*)nullGenRenderbuffers }, { "glGenQueries", (void*)nullGenQueries },
+    { "glDeleteBuffers", (void*)nullDeleteBuffers }, { "glDeleteTextures", (void*)nullDeleteTextures },
+    { "glDeleteVertexArrays", (void*)nullDeleteVertexArrays }, { "glDeleteFramebuffers", (void*)nullDeleteFramebuffers },
+    { "glDeleteRenderbuffers", (void*)nullDeleteRenderbuffers }, { "glDeleteQueries", (void*)nullDeleteQueries },
+    { "glCreateShader", (void*)nullCreateShader }, { "glCreateProgram", (void*)nullCreateProgram },
+    { "glDeleteShader", (void*)nullDeleteShader }, { "glDeleteProgram", (void*)nullDeleteProgram },
+    { "glGetShaderiv", (void*)nullGetShaderiv }, { "glGetProgramiv", (void*)nullGetProgramiv },
+    { "glGetShaderInfoLog", (void*)nullGetShaderInfoLog }, { "glGetProgramInfoLog", (void*)nullGetProgramInfoLog },
+    { "glGetUniformLocation", (void*)nullGetUniformLocation },
+    { "glBindBuffer", (void*)nullBindBuffer }, { "glBufferData", (void*)nullBufferData },
+    { "glMapBufferRange", (void*)nullMapBufferRange }, { "glUnmapBuffer", (void*)nullUnmapBuffer },
+    { "glBindTexture", (void*)nullBindTexture }, { "glBindVertexArray", (void*)nullBindVertexArray },
+    { "glBindFramebuffer", (void*)nullBindFramebuffer }, { "glUseProgram", (void*)nullUseProgram },
+    { "glViewport", (void*)nullViewport }, { "glClear", (void*)nullClear }, { "glTexImage2D", (void*)nullTexImage2D },
+    { "glDrawArrays", (void*)nullDrawArrays }, { "glDrawElements", (void*)nullDrawElements },
+    { "glCheckFramebufferStatus", (void*)nullCheckFramebufferStatus },
+    { "glFenceSync", (void*)nullFenceSync }, { "glClientWaitSync", (void*)nullClientWaitSync },
+    { "glGetQueryObjectiv", (void*)nullGetQueryObjectiv },
+};
+
+void* nullGlGetProcAddress(const char* name)
+{
+    for (const NullOverride& entry : nullOverrides)
+        if (strcmp(entry.name, name) == 0)
+            return entry.function;
+    for (int i = 0; i < NULL_GL_FUNCTION_COUNT; i++)
+        if (strcmp(nullGlNames[i], name) == 0)
+            return nullGlStubs[i];
+    return NULL;
+}
+
+void resetNullGlCounters()
+{
+    for (size_t& count : callCounts)
+        count = 0;
+    errorCount = 0;
+    drawCalls = 0;
+    drawnVertices = 0;
+}
+
+size_t nullGlCallCount()
+{
+    size_t total = 0;
+    for (size_t count : callCounts)
+        total += count;
+    return total;
+}
+
+size_t nullGlErrorCount()
+{
+    return errorCount;
+}
+
+void printNullGlReport(int frames, double cpuMs)
+{
+    frames = std::max(frames, 1);
+    size_t total = nullGlCallCount();
+    std::cout << "NullGL: " << frames << " frames, " << cpuMs / frames << " ms CPU per frame, " << (double)total / frames
+              << " GL calls per frame, " << (double)drawCalls / frames << " draws / " << (double)drawnVertices / frames
+              << " vertices per frame, " << errorCount << " validation errors" << std::endl;
+
+    std::vector<int> order;
+    for (int i = 0; i < NULL_GL_FUNCTION_COUNT; i++)
+        if (callCounts[i])
+            order.push_back(i);
+    std::sort(order.begin(), order.end(), [](int a, int b) { return callCounts[a] > callCounts[b]; });
+    for (size_t i = 0; i < order.size() && i < 15; i++)
+        std::cout << "  " << nullGlNames[order[i]] << ": " << (double)callCounts[order[i]] / frames << " per frame" << std::endl;
+}
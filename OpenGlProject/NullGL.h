@@ -0,0 +1,21 @@
+#pragma once
+#include <cstddef> // size_t
+
+// Null OpenGL driver: pass nullGlGetProcAddress to gladLoadGLLoader and every gl* call lands in a stub that
+// validates a few arguments, counts the call and renders nothing. Used to measure our own CPU cost per frame
+// and to run the loop with no display. The counters are not thread-safe; only the render thread may call GL.
+
+// Loader for gladLoadGLLoader; reports a 3.3 core context with one placeholder extension
+void* nullGlGetProcAddress(const char* name);
+
+// Zero the call and error counters (e.g. after warm-up frames)
+void resetNullGlCounters();
+
+// Total gl* calls since the last reset
+size_t nullGlCallCount();
+
+// Errors the validation raised since the last reset (GL_INVALID_* that a real driver would report)
+size_t nullGlErrorCount();
+
+// Print calls per frame, the busiest entry points and the validation errors
+void printNullGlReport(int frames, double cpuMs);
@@ -0,0 +1,1509 @@
+// Generated by tools/gen_null_gl.py from include/glad/glad.h; do not edit.
+
+enum NullGlFunction
+{
+    NULL_GL_glCullFace,
+    NULL_GL_glFrontFace,
+    NULL_GL_glHint,
+    NULL_GL_glLineWidth,
+    NULL_GL_glPointSize,
+    NULL_GL_glPolygonMode,
+    NULL_GL_glScissor,
+    NULL_GL_glTexParameterf,
+    NULL_GL_glTexParameterfv,
+    NULL_GL_glTexParameteri,
+    NULL_GL_glTexParameteriv,
+    NULL_GL_glTexImage1D,
+    NULL_GL_glTexImage2D,
+    NULL_GL_glDrawBuffer,
+    NULL_GL_glClear,
+    NULL_GL_glClearColor,
+    NULL_GL_glClearStencil,
+    NULL_GL_glClearDepth,
+    NULL_GL_glStencilMask,
+    NULL_GL_glColorMask,
+    NULL_GL_glDepthMask,
+    NULL_GL_glDisable,
+    NULL_GL_glEnable,
+    NULL_GL_glFinish,
+    NULL_GL_glFlush,
+    NULL_GL_glBlendFunc,
+    NULL_GL_glLogicOp,
+    NULL_GL_glStencilFunc,
+    NULL_GL_glStencilOp,
+    NULL_GL_glDepthFunc,
+    NULL_GL_glPixelStoref,
+    NULL_GL_glPixelStorei,
+    NULL_GL_glReadBuffer,
+    NULL_GL_glReadPixels,
+    NULL_GL_glGetBooleanv,
+    NULL_GL_glGetDoublev,
+    NULL_GL_glGetError,
+    NULL_GL_glGetFloatv,
+    NULL_GL_glGetIntegerv,
+    NULL_GL_glGetString,
+    NULL_GL_glGetTexImage,
+    NULL_GL_glGetTexParameterfv,
+    NULL_GL_glGetTexParameteriv,
+    NULL_GL_glGetTexLevelParameterfv,
+    NULL_GL_glGetTexLevelParameteriv,
+    NULL_GL_glIsEnabled,
+    NULL_GL_glDepthRange,
+    NULL_GL_glViewport,
+    NULL_GL_glDrawArrays,
+    NULL_GL_glDrawElements,
+    NULL_GL_glPolygonOffset,
+    NULL_GL_glCopyTexImage1D,
+    NULL_GL_glCopyTexImage2D,
+    NULL_GL_glCopyTexSubImage1D,
+    NULL_GL_glCopyTexSubImage2D,
+    NULL_GL_glTexSubImage1D,
+    NULL_GL_glTexSubImage2D,
+    NULL_GL_glBindTexture,
+    NULL_GL_glDeleteTextures,
+    NULL_GL_glGenTextures,
+    NULL_GL_glIsTexture,
+    NULL_GL_glDrawRangeElements,
+    NULL_GL_glTexImage3D,
+    NULL_GL_glTexSubImage3D,
+    NULL_GL_glCopyTexSubImage3D,
+    NULL_GL_glActiveTexture,
+    NULL_GL_glSampleCoverage,
+    NULL_GL_glCompressedTexImage3D,
+    NULL_GL_glCompressedTexImage2D,
+    NULL_GL_glCompressedTexImage1D,
+    NULL_GL_glCompressedTexSubImage3D,
+    NULL_GL_glCompressedTexSubImage2D,
+    NULL_GL_glCompressedTexSubImage1D,
+    NULL_GL_glGetCompressedTexImage,
+    NULL_GL_glBlendFuncSeparate,
+    NULL_GL_glMultiDrawArrays,
+    NULL_GL_glMultiDrawElements,
+    NULL_GL_glPointParameterf,
+    NULL_GL_glPointParameterfv,
+    NULL_GL_glPointParameteri,
+    NULL_GL_glPointParameteriv,
+    NULL_GL_glBlendColor,
+    NULL_GL_glBlendEquation,
+    NULL_GL_glGenQueries,
+    NULL_GL_glDeleteQueries,
+    NULL_GL_glIsQuery,
+    NULL_GL_glBeginQuery,
+    NULL_GL_glEndQuery,
+    NULL_GL_glGetQueryiv,
+    NULL_GL_glGetQueryObjectiv,
+    NULL_GL_glGetQueryObjectuiv,
+    NULL_GL_glBindBuffer,
+    NULL_GL_glDeleteBuffers,
+    NULL_GL_glGenBuffers,
+    NULL_GL_glIsBuffer,
+    NULL_GL_glBufferData,
+    NULL_GL_glBufferSubData,
+    NULL_GL_glGetBufferSubData,
+    NULL_GL_glMapBuffer,
+    NULL_GL_glUnmapBuffer,
+    NULL_GL_glGetBufferParameteriv,
+    NULL_GL_glGetBufferPointerv,
+    NULL_GL_glBlendEquationSeparate,
+    NULL_GL_glDrawBuffers,
+    NULL_GL_glStencilOpSeparate,
+    NULL_GL_glStencilFuncSeparate,
+    NULL_GL_glStencilMaskSeparate,
+    NULL_GL_glAttachShader,
+    NULL_GL_glBindAttribLocation,
+    NULL_GL_glCompileShader,
+    NULL_GL_glCreateProgram,
+    NULL_GL_glCreateShader,
+    NULL_GL_glDeleteProgram,
+    NULL_GL_glDeleteShader,
+    NULL_GL_glDetachShader,
+    NULL_GL_glDisableVertexAttribArray,
+    NULL_GL_glEnableVertexAttribArray,
+    NULL_GL_glGetActiveAttrib,
+    NULL_GL_glGetActiveUniform,
+    NULL_GL_glGetAttachedShaders,
+    NULL_GL_glGetAttribLocation,
+    NULL_GL_glGetProgramiv,
+    NULL_GL_glGetProgramInfoLog,
+    NULL_GL_glGetShaderiv,
+    NULL_GL_glGetShaderInfoLog,
+    NULL_GL_glGetShaderSource,
+    NULL_GL_glGetUniformLocation,
+    NULL_GL_glGetUniformfv,
+    NULL_GL_glGetUniformiv,
+    NULL_GL_glGetVertexAttribdv,
+    NULL_GL_glGetVertexAttribfv,
+    NULL_GL_glGetVertexAttribiv,
+    NULL_GL_glGetVertexAttribPointerv,
+    NULL_GL_glIsProgram,
+    NULL_GL_glIsShader,
+    NULL_GL_glLinkProgram,
+    NULL_GL_glShaderSource,
+    NULL_GL_glUseProgram,
+    NULL_GL_glUniform1f,
+    NULL_GL_glUniform2f,
+    NULL_GL_glUniform3f,
+    NULL_GL_glUniform4f,
+    NULL_GL_glUniform1i,
+    NULL_GL_glUniform2i,
+    NULL_GL_glUniform3i,
+    NULL_GL_glUniform4i,
+    NULL_GL_glUniform1fv,
+    NULL_GL_glUniform2fv,
+    NULL_GL_glUniform3fv,
+    NULL_GL_glUniform4fv,
+    NULL_GL_glUniform1iv,
+    NULL_GL_glUniform2iv,
+    NULL_GL_glUniform3iv,
+    NULL_GL_glUniform4iv,
+    NULL_GL_glUniformMatrix2fv,
+    NULL_GL_glUniformMatrix3fv,
+    NULL_GL_glUniformMatrix4fv,
+    NULL_GL_glValidateProgram,
+    NULL_GL_glVertexAttrib1d,
+    NULL_GL_glVertexAttrib1dv,
+    NULL_GL_glVertexAttrib1f,
+    NULL_GL_glVertexAttrib1fv,
+    NULL_GL_glVertexAttrib1s,
+    NULL_GL_glVertexAttrib1sv,
+    NULL_GL_glVertexAttrib2d,
+    NULL_GL_glVertexAttrib2dv,
+    NULL_GL_glVertexAttrib2f,
+    NULL_GL_glVertexAttrib2fv,
+    NULL_GL_glVertexAttrib2s,
+    NULL_GL_glVertexAttrib2sv,
+    NULL_GL_glVertexAttrib3d,
+    NULL_GL_glVertexAttrib3dv,
+    NULL_GL_glVertexAttrib3f,
+    NULL_GL_glVertexAttrib3fv,
+    NULL_GL_glVertexAttrib3s,
+    NULL_GL_glVertexAttrib3sv,
+    NULL_GL_glVertexAttrib4Nbv,
+    NULL_GL_glVertexAttrib4Niv,
+    NULL_GL_glVertexAttrib4Nsv,
+    NULL_GL_glVertexAttrib4Nub,
+    NULL_GL_glVertexAttrib4Nubv,
+    NULL_GL_glVertexAttrib4Nuiv,
+    NULL_GL_glVertexAttrib4Nusv,
+    NULL_GL_glVertexAttrib4bv,
+    NULL_GL_glVertexAttrib4d,
+    NULL_GL_glVertexAttrib4dv,
+    NULL_GL_glVertexAttrib4f,
+    NULL_GL_glVertexAttrib4fv,
+    NULL_GL_glVertexAttrib4iv,
+    NULL_GL_glVertexAttrib4s,
+    NULL_GL_glVertexAttrib4sv,
+    NULL_GL_glVertexAttrib4ubv,
+    NULL_GL_glVertexAttrib4uiv,
+    NULL_GL_glVertexAttrib4usv,
+    NULL_GL_glVertexAttribPointer,
+    NULL_GL_glUniformMatrix2x3fv,
+    NULL_GL_glUniformMatrix3x2fv,
+    NULL_GL_glUniformMatrix2x4fv,
+    NULL_GL_glUniformMatrix4x2fv,
+    NULL_GL_glUniformMatrix3x4fv,
+    NULL_GL_glUniformMatrix4x3fv,
+    NULL_GL_glColorMaski,
+    NULL_GL_glGetBooleani_v,
+    NULL_GL_glGetIntegeri_v,
+    NULL_GL_glEnablei,
+    NULL_GL_glDisablei,
+    NULL_GL_glIsEnabledi,
+    NULL_GL_glBeginTransformFeedback,
+    NULL_GL_glEndTransformFeedback,
+    NULL_GL_glBindBufferRange,
+    NULL_GL_glBindBufferBase,
+    NULL_GL_glTransformFeedbackVaryings,
+    NULL_GL_glGetTransformFeedbackVarying,
+    NULL_GL_glClampColor,
+    NULL_GL_glBeginConditionalRender,
+    NULL_GL_glEndConditionalRender,
+    NULL_GL_glVertexAttribIPointer,
+    NULL_GL_glGetVertexAttribIiv,
+    NULL_GL_glGetVertexAttribIuiv,
+    NULL_GL_glVertexAttribI1i,
+    NULL_GL_glVertexAttribI2i,
+    NULL_GL_glVertexAttribI3i,
+    NULL_GL_glVertexAttribI4i,
+    NULL_GL_glVertexAttribI1ui,
+    NULL_GL_glVertexAttribI2ui,
+    NULL_GL_glVertexAttribI3ui,
+    NULL_GL_glVertexAttribI4ui,
+    NULL_GL_glVertexAttribI1iv,
+    NULL_GL_glVertexAttribI2iv,
+    NULL_GL_glVertexAttribI3iv,
+    NULL_GL_glVertexAttribI4iv,
+    NULL_GL_glVertexAttribI1uiv,
+    NULL_GL_glVertexAttribI2uiv,
+    NULL_GL_glVertexAttribI3uiv,
+    NULL_GL_glVertexAttribI4uiv,
+    NULL_GL_glVertexAttribI4bv,
+    NULL_GL_glVertexAttribI4sv,
+    NULL_GL_glVertexAttribI4ubv,
+    NULL_GL_glVertexAttribI4usv,
+    NULL_GL_glGetUniformuiv,
+    NULL_GL_glBindFragDataLocation,
+    NULL_GL_glGetFragDataLocation,
+    NULL_GL_glUniform1ui,
+    NULL_GL_glUniform2ui,
+    NULL_GL_glUniform3ui,
+    NULL_GL_glUniform4ui,
+    NULL_GL_glUniform1uiv,
+    NULL_GL_glUniform2uiv,
+    NULL_GL_glUniform3uiv,
+    NULL_GL_glUniform4uiv,
+    NULL_GL_glTexParameterIiv,
+    NULL_GL_glTexParameterIuiv,
+    NULL_GL_glGetTexParameterIiv,
+    NULL_GL_glGetTexParameterIuiv,
+    NULL_GL_glClearBufferiv,
+    NULL_GL_glClearBufferuiv,
+    NULL_GL_glClearBufferfv,
+    NULL_GL_glClearBufferfi,
+    NULL_GL_glGetStringi,
+    NULL_GL_glIsRenderbuffer,
+    NULL_GL_glBindRenderbuffer,
+    NULL_GL_glDeleteRenderbuffers,
+    NULL_GL_glGenRenderbuffers,
+    NULL_GL_glRenderbufferStorage,
+    NULL_GL_glGetRenderbufferParameteriv,
+    NULL_GL_glIsFramebuffer,
+    NULL_GL_glBindFramebuffer,
+    NULL_GL_glDeleteFramebuffers,
+    NULL_GL_glGenFramebuffers,
+    NULL_GL_glCheckFramebufferStatus,
+    NULL_GL_glFramebufferTexture1D,
+    NULL_GL_glFramebufferTexture2D,
+    NULL_GL_glFramebufferTexture3D,
+    NULL_GL_glFramebufferRenderbuffer,
+    NULL_GL_glGetFramebufferAttachmentParameteriv,
+    NULL_GL_glGenerateMipmap,
+    NULL_GL_glBlitFramebuffer,
+    NULL_GL_glRenderbufferStorageMultisample,
+    NULL_GL_glFramebufferTextureLayer,
+    NULL_GL_glMapBufferRange,
+    NULL_GL_glFlushMappedBufferRange,
+    NULL_GL_glBindVertexArray,
+    NULL_GL_glDeleteVertexArrays,
+    NULL_GL_glGenVertexArrays,
+    NULL_GL_glIsVertexArray,
+    NULL_GL_glDrawArraysInstanced,
+    NULL_GL_glDrawElementsInstanced,
+    NULL_GL_glTexBuffer,
+    NULL_GL_glPrimitiveRestartIndex,
+    NULL_GL_glCopyBufferSubData,
+    NULL_GL_glGetUniformIndices,
+    NULL_GL_glGetActiveUniformsiv,
+    NULL_GL_glGetActiveUniformName,
+    NULL_GL_glGetUniformBlockIndex,
+    NULL_GL_glGetActiveUniformBlockiv,
+    NULL_GL_glGetActiveUniformBlockName,
+    NULL_GL_glUniformBlockBinding,
+    NULL_GL_glDrawElementsBaseVertex,
+    NULL_GL_glDrawRangeElementsBaseVertex,
+    NULL_GL_glDrawElementsInstancedBaseVertex,
+    NULL_GL_glMultiDrawElementsBaseVertex,
+    NULL_GL_glProvokingVertex,
+    NULL_GL_glFenceSync,
+    NULL_GL_glIsSync,
+    NULL_GL_glDeleteSync,
+    NULL_GL_glClientWaitSync,
+    NULL_GL_glWaitSync,
+    NULL_GL_glGetInteger64v,
+    NULL_GL_glGetSynciv,
+    NULL_GL_glGetInteger64i_v,
+    NULL_GL_glGetBufferParameteri64v,
+    NULL_GL_glFramebufferTexture,
+    NULL_GL_glTexImage2DMultisample,
+    NULL_GL_glTexImage3DMultisample,
+    NULL_GL_glGetMultisamplefv,
+    NULL_GL_glSampleMaski,
+    NULL_GL_glBindFragDataLocationIndexed,
+    NULL_GL_glGetFragDataIndex,
+    NULL_GL_glGenSamplers,
+    NULL_GL_glDeleteSamplers,
+    NULL_GL_glIsSampler,
+    NULL_GL_glBindSampler,
+    NULL_GL_glSamplerParameteri,
+    NULL_GL_glSamplerParameteriv,
+    NULL_GL_glSamplerParameterf,
+    NULL_GL_glSamplerParameterfv,
+    NULL_GL_glSamplerParameterIiv,
+    NULL_GL_glSamplerParameterIuiv,
+    NULL_GL_glGetSamplerParameteriv,
+    NULL_GL_glGetSamplerParameterIiv,
+    NULL_GL_glGetSamplerParameterfv,
+    NULL_GL_glGetSamplerParameterIuiv,
+    NULL_GL_glQueryCounter,
+    NULL_GL_glGetQueryObjecti64v,
+    NULL_GL_glGetQueryObjectui64v,
+    NULL_GL_glVertexAttribDivisor,
+    NULL_GL_glVertexAttribP1ui,
+    NULL_GL_glVertexAttribP1uiv,
+    NULL_GL_glVertexAttribP2ui,
+    NULL_GL_glVertexAttribP2uiv,
+    NULL_GL_glVertexAttribP3ui,
+    NULL_GL_glVertexAttribP3uiv,
+    NULL_GL_glVertexAttribP4ui,
+    NULL_GL_glVertexAttribP4uiv,
+    NULL_GL_glVertexP2ui,
+    NULL_GL_glVertexP2uiv,
+    NULL_GL_glVertexP3ui,
+    NULL_GL_glVertexP3uiv,
+    NULL_GL_glVertexP4ui,
+    NULL_GL_glVertexP4uiv,
+    NULL_GL_glTexCoordP1ui,
+    NULL_GL_glTexCoordP1uiv,
+    NULL_GL_glTexCoordP2ui,
+    NULL_GL_glTexCoordP2uiv,
+    NULL_GL_glTexCoordP3ui,
+    NULL_GL_glTexCoordP3uiv,
+    NULL_GL_glTexCoordP4ui,
+    NULL_GL_glTexCoordP4uiv,
+    NULL_GL_glMultiTexCoordP1ui,
+    NULL_GL_glMultiTexCoordP1uiv,
+    NULL_GL_glMultiTexCoordP2ui,
+    NULL_GL_glMultiTexCoordP2uiv,
+    NULL_GL_glMultiTexCoordP3ui,
+    NULL_GL_glMultiTexCoordP3uiv,
+    NULL_GL_glMultiTexCoordP4ui,
+    NULL_GL_glMultiTexCoordP4uiv,
+    NULL_GL_glNormalP3ui,
+    NULL_GL_glNormalP3uiv,
+    NULL_GL_glColorP3ui,
+    NULL_GL_glColorP3uiv,
+    NULL_GL_glColorP4ui,
+    NULL_GL_glColorP4uiv,
+    NULL_GL_glSecondaryColorP3ui,
+    NULL_GL_glSecondaryColorP3uiv,
+    NULL_GL_FUNCTION_COUNT
+};
+
+static const char* nullGlNames[NULL_GL_FUNCTION_COUNT] = {
+    "glCullFace",
+    "glFrontFace",
+    "glHint",
+    "glLineWidth",
+    "glPointSize",
+    "glPolygonMode",
+    "glScissor",
+    "glTexParameterf",
+    "glTexParameterfv",
+    "glTexParameteri",
+    "glTexParameteriv",
+    "glTexImage1D",
+    "glTexImage2D",
+    "glDrawBuffer",
+    "glClear",
+    "glClearColor",
+    "glClearStencil",
+    "glClearDepth",
+    "glStencilMask",
+    "glColorMask",
+    "glDepthMask",
+    "glDisable",
+    "glEnable",
+    "glFinish",
+    "glFlush",
+    "glBlendFunc",
+    "glLogicOp",
+    "glStencilFunc",
+    "glStencilOp",
+    "glDepthFunc",
+    "glPixelStoref",
+    "glPixelStorei",
+    "glReadBuffer",
+    "glReadPixels",
+    "glGetBooleanv",
+    "glGetDoublev",
+    "glGetError",
+    "glGetFloatv",
+    "glGetIntegerv",
+    "glGetString",
+    "glGetTexImage",
+    "glGetTexParameterfv",
+    "glGetTexParameteriv",
+    "glGetTexLevelParameterfv",
+    "glGetTexLevelParameteriv",
+    "glIsEnabled",
+    "glDepthRange",
+    "glViewport",
+    "glDrawArrays",
+    "glDrawElements",
+    "glPolygonOffset",
+    "glCopyTexImage1D",
+    "glCopyTexImage2D",
+    "glCopyTexSubImage1D",
+    "glCopyTexSubImage2D",
+    "glTexSubImage1D",
+    "glTexSubImage2D",
+    "glBindTexture",
+    "glDeleteTextures",
+    "glGenTextures",
+    "glIsTexture",
+    "glDrawRangeElements",
+    "glTexImage3D",
+    "glTexSubImage3D",
+    "glCopyTexSubImage3D",
+    "glActiveTexture",
+    "glSampleCoverage",
+    "glCompressedTexImage3D",
+    "glCompressedTexImage2D",
+    "glCompressedTexImage1D",
+    "glCompressedTexSubImage3D",
+    "glCompressedTexSubImage2D",
+    "glCompressedTexSubImage1D",
+    "glGetCompressedTexImage",
+    "glBlendFuncSeparate",
+    "glMultiDrawArrays",
+    "glMultiDrawElements",
+    "glPointParameterf",
+    "glPointParameterfv",
+    "glPointParameteri",
+    "glPointParameteriv",
+    "glBlendColor",
+    "glBlendEquation",
+    "glGenQueries",
+    "glDeleteQueries",
+    "glIsQuery",
+    "glBeginQuery",
+    "glEndQuery",
+    "glGetQueryiv",
+    "glGetQueryObjectiv",
+    "glGetQueryObjectuiv",
+    "glBindBuffer",
+    "glDeleteBuffers",
+    "glGenBuffers",
+    "glIsBuffer",
+    "glBufferData",
+    "glBufferSubData",
+    "glGetBufferSubData",
+    "glMapBuffer",
+    "glUnmapBuffer",
+    "glGetBufferParameteriv",
+    "glGetBufferPointerv",
+    "glBlendEquationSeparate",
+    "glDrawBuffers",
+    "glStencilOpSeparate",
+    "glStencilFuncSeparate",
+    "glStencilMaskSeparate",
+    "glAttachShader",
+    "glBindAttribLocation",
+    "glCompileShader",
+    "glCreateProgram",
+    "glCreateShader",
+    "glDeleteProgram",
+    "glDeleteShader",
+    "glDetachShader",
+    "glDisableVertexAttribArray",
+    "glEnableVertexAttribArray",
+    "glGetActiveAttrib",
+    "glGetActiveUniform",
+    "glGetAttachedShaders",
+    "glGetAttribLocation",
+    "glGetProgramiv",
+    "glGetProgramInfoLog",
+    "glGetShaderiv",
+    "glGetShaderInfoLog",
+    "glGetShaderSource",
+    "glGetUniformLocation",
+    "glGetUniformfv",
+    "glGetUniformiv",
+    "glGetVertexAttribdv",
+    "glGetVertexAttribfv",
+    "glGetVertexAttribiv",
+    "glGetVertexAttribPointerv",
+    "glIsProgram",
+    "glIsShader",
+    "glLinkProgram",
+    "glShaderSource",
+    "glUseProgram",
+    "glUniform1f",
+    "glUniform2f",
+    "glUniform3f",
+    "glUniform4f",
+    "glUniform1i",
+    "glUniform2i",
+    "glUniform3i",
+    "glUniform4i",
+    "glUniform1fv",
+    "glUniform2fv",
+    "glUniform3fv",
+    "glUniform4fv",
+    "glUniform1iv",
+    "glUniform2iv",
+    "glUniform3iv",
+    "glUniform4iv",
+    "glUniformMatrix2fv",
+    "glUniformMatrix3fv",
+    "glUniformMatrix4fv",
+    "glValidateProgram",
+    "glVertexAttrib1d",
+    "glVertexAttrib1dv",
+    "glVertexAttrib1f",
+    "glVertexAttrib1fv",
+    "glVertexAttrib1s",
+    "glVertexAttrib1sv",
+    "glVertexAttrib2d",
+    "glVertexAttrib2dv",
+    "glVertexAttrib2f",
+    "glVertexAttrib2fv",
+    "glVertexAttrib2s",
+    "glVertexAttrib2sv",
+    "glVertexAttrib3d",
+    "glVertexAttrib3dv",
+    "glVertexAttrib3f",
+    "glVertexAttrib3fv",
+    "glVertexAttrib3s",
+    "glVertexAttrib3sv",
+    "glVertexAttrib4Nbv",
+    "glVertexAttrib4Niv",
+    "glVertexAttrib4Nsv",
+    "glVertexAttrib4Nub",
+    "glVertexAttrib4Nubv",
+    "glVertexAttrib4Nuiv",
+    "glVertexAttrib4Nusv",
+    "glVertexAttrib4bv",
+    "glVertexAttrib4d",
+    "glVertexAttrib4dv",
+    "glVertexAttrib4f",
+    "glVertexAttrib4fv",
+    "glVertexAttrib4iv",
+    "glVertexAttrib4s",
+    "glVertexAttrib4sv",
+    "glVertexAttrib4ubv",
+    "glVertexAttrib4uiv",
+    "glVertexAttrib4usv",
+    "glVertexAttribPointer",
+    "glUniformMatrix2x3fv",
+    "glUniformMatrix3x2fv",
+    "glUniformMatrix2x4fv",
+    "glUniformMatrix4x2fv",
+    "glUniformMatrix3x4fv",
+    "glUniformMatrix4x3fv",
+    "glColorMaski",
+    "glGetBooleani_v",
+    "glGetIntegeri_v",
+    "glEnablei",
+    "glDisablei",
+    "glIsEnabledi",
+    "glBeginTransformFeedback",
+    "glEndTransformFeedback",
+    "glBindBufferRange",
+    "glBindBufferBase",
+    "glTransformFeedbackVaryings",
+    "glGetTransformFeedbackVarying",
+    "glClampColor",
+    "glBeginConditionalRender",
+    "glEndConditionalRender",
+    "glVertexAttribIPointer",
+    "glGetVertexAttribIiv",
+    "glGetVertexAttribIuiv",
+    "glVertexAttribI1i",
+    "glVertexAttribI2i",
+    "glVertexAttribI3i",
+    "glVertexAttribI4i",
+    "glVertexAttribI1ui",
+    "glVertexAttribI2ui",
+    "glVertexAttribI3ui",
+    "glVertexAttribI4ui",
+    "glVertexAttribI1iv",
+    "glVertexAttribI2iv",
+    "glVertexAttribI3iv",
+    "glVertexAttribI4iv",
+    "glVertexAttribI1uiv",
+    "glVertexAttribI2uiv",
+    "glVertexAttribI3uiv",
+    "glVertexAttribI4uiv",
+    "glVertexAttribI4bv",
+    "glVertexAttribI4sv",
+    "glVertexAttribI4ubv",
+    "glVertexAttribI4usv",
+    "glGetUniformuiv",
+    "glBindFragDataLocation",
+    "glGetFragDataLocation",
+    "glUniform1ui",
+    "glUniform2ui",
+    "glUniform3ui",
+    "glUniform4ui",
+    "glUniform1uiv",
+    "glUniform2uiv",
+    "glUniform3uiv",
+    "glUniform4uiv",
+    "glTexParameterIiv",
+    "glTexParameterIuiv",
+    "glGetTexParameterIiv",
+    "glGetTexParameterIuiv",
+    "glClearBufferiv",
+    "glClearBufferuiv",
+    "glClearBufferfv",
+    "glClearBufferfi",
+    "glGetStringi",
+    "glIsRenderbuffer",
+    "glBindRenderbuffer",
+    "glDeleteRenderbuffers",
+    "glGenRenderbuffers",
+    "glRenderbufferStorage",
+    "glGetRenderbufferParameteriv",
+    "glIsFramebuffer",
+    "glBindFramebuffer",
+    "glDeleteFramebuffers",
+    "glGenFramebuffers",
+    "glCheckFramebufferStatus",
+    "glFramebufferTexture1D",
+    "glFramebufferTexture2D",
+    "glFramebufferTexture3D",
+    "glFramebufferRenderbuffer",
+    "glGetFramebufferAttachmentParameteriv",
+    "glGenerateMipmap",
+    "glBlitFramebuffer",
+    "glRenderbufferStorageMultisample",
+    "glFramebufferTextureLayer",
+    "glMapBufferRange",
+    "glFlushMappedBufferRange",
+    "glBindVertexArray",
+    "glDeleteVertexArrays",
+    "glGenVertexArrays",
+    "glIsVertexArray",
+    "glDrawArraysInstanced",
+    "glDrawElementsInstanced",
+    "glTexBuffer",
+    "glPrimitiveRestartIndex",
+    "glCopyBufferSubData",
+    "glGetUniformIndices",
+    "glGetActiveUniformsiv",
+    "glGetActiveUniformName",
+    "glGetUniformBlockIndex",
+    "glGetActiveUniformBlockiv",
+    "glGetActiveUniformBlockName",
+    "glUniformBlockBinding",
+    "glDrawElementsBaseVertex",
+    "glDrawRangeElementsBaseVertex",
+    "glDrawElementsInstancedBaseVertex",
+    "glMultiDrawElementsBaseVertex",
+    "glProvokingVertex",
+    "glFenceSync",
+    "glIsSync",
+    "glDeleteSync",
+    "glClientWaitSync",
+    "glWaitSync",
+    "glGetInteger64v",
+    "glGetSynciv",
+    "glGetInteger64i_v",
+    "glGetBufferParameteri64v",
+    "glFramebufferTexture",
+    "glTexImage2DMultisample",
+    "glTexImage3DMultisample",
+    "glGetMultisamplefv",
+    "glSampleMaski",
+    "glBindFragDataLocationIndexed",
+    "glGetFragDataIndex",
+    "glGenSamplers",
+    "glDeleteSamplers",
+    "glIsSampler",
+    "glBindSampler",
+    "glSamplerParameteri",
+    "glSamplerParameteriv",
+    "glSamplerParameterf",
+    "glSamplerParameterfv",
+    "glSamplerParameterIiv",
+    "glSamplerParameterIuiv",
+    "glGetSamplerParameteriv",
+    "glGetSamplerParameterIiv",
+    "glGetSamplerParameterfv",
+    "glGetSamplerParameterIuiv",
+    "glQueryCounter",
+    "glGetQueryObjecti64v",
+    "glGetQueryObjectui64v",
+    "glVertexAttribDivisor",
+    "glVertexAttribP1ui",
+    "glVertexAttribP1uiv",
+    "glVertexAttribP2ui",
+    "glVertexAttribP2uiv",
+    "glVertexAttribP3ui",
+    "glVertexAttribP3uiv",
+    "glVertexAttribP4ui",
+    "glVertexAttribP4uiv",
+    "glVertexP2ui",
+    "glVertexP2uiv",
+    "glVertexP3ui",
+    "glVertexP3uiv",
+    "glVertexP4ui",
+    "glVertexP4uiv",
+    "glTexCoordP1ui",
+    "glTexCoordP1uiv",
+    "glTexCoordP2ui",
+    "glTexCoordP2uiv",
+    "glTexCoordP3ui",
+    "glTexCoordP3uiv",
+    "glTexCoordP4ui",
+    "glTexCoordP4uiv",
+    "glMultiTexCoordP1ui",
+    "glMultiTexCoordP1uiv",
+    "glMultiTexCoordP2ui",
+    "glMultiTexCoordP2uiv",
+    "glMultiTexCoordP3ui",
+    "glMultiTexCoordP3uiv",
+    "glMultiTexCoordP4ui",
+    "glMultiTexCoordP4uiv",
+    "glNormalP3ui",
+    "glNormalP3uiv",
+    "glColorP3ui",
+    "glColorP3uiv",
+    "glColorP4ui",
+    "glColorP4uiv",
+    "glSecondaryColorP3ui",
+    "glSecondaryColorP3uiv",
+};
+
+static void APIENTRY nullStub_glCullFace(GLenum) { nullGlCount(NULL_GL_glCullFace); }
+static void APIENTRY nullStub_glFrontFace(GLenum) { nullGlCount(NULL_GL_glFrontFace); }
+static void APIENTRY nullStub_glHint(GLenum, GLenum) { nullGlCount(NULL_GL_glHint); }
+static void APIENTRY nullStub_glLineWidth(GLfloat) { nullGlCount(NULL_GL_glLineWidth); }
+static void APIENTRY nullStub_glPointSize(GLfloat) { nullGlCount(NULL_GL_glPointSize); }
+static void APIENTRY nullStub_glPolygonMode(GLenum, GLenum) { nullGlCount(NULL_GL_glPolygonMode); }
+static void APIENTRY nullStub_glScissor(GLint, GLint, GLsizei, GLsizei) { nullGlCount(NULL_GL_glScissor); }
+static void APIENTRY nullStub_glTexParameterf(GLenum, GLenum, GLfloat) { nullGlCount(NULL_GL_glTexParameterf); }
+static void APIENTRY nullStub_glTexParameterfv(GLenum, GLenum, const GLfloat *) { nullGlCount(NULL_GL_glTexParameterfv); }
+static void APIENTRY nullStub_glTexParameteri(GLenum, GLenum, GLint) { nullGlCount(NULL_GL_glTexParameteri); }
+static void APIENTRY nullStub_glTexParameteriv(GLenum, GLenum, const GLint *) { nullGlCount(NULL_GL_glTexParameteriv); }
+static void APIENTRY nullStub_glTexImage1D(GLenum, GLint, GLint, GLsizei, GLint, GLenum, GLenum, const void *) { nullGlCount(NULL_GL_glTexImage1D); }
+static void APIENTRY nullStub_glTexImage2D(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void *) { nullGlCount(NULL_GL_glTexImage2D); }
+static void APIENTRY nullStub_glDrawBuffer(GLenum) { nullGlCount(NULL_GL_glDrawBuffer); }
+static void APIENTRY nullStub_glClear(GLbitfield) { nullGlCount(NULL_GL_glClear); }
+static void APIENTRY nullStub_glClearColor(GLfloat, GLfloat, GLfloat, GLfloat) { nullGlCount(NULL_GL_glClearColor); }
+static void APIENTRY nullStub_glClearStencil(GLint) { nullGlCount(NULL_GL_glClearStencil); }
+static void APIENTRY nullStub_glClearDepth(GLdouble) { nullGlCount(NULL_GL_glClearDepth); }
+static void APIENTRY nullStub_glStencilMask(GLuint) { nullGlCount(NULL_GL_glStencilMask); }
+static void APIENTRY nullStub_glColorMask(GLboolean, GLboolean, GLboolean, GLboolean) { nullGlCount(NULL_GL_glColorMask); }
+static void APIENTRY nullStub_glDepthMask(GLboolean) { nullGlCount(NULL_GL_glDepthMask); }
+static void APIENTRY nullStub_glDisable(GLenum) { nullGlCount(NULL_GL_glDisable); }
+static void APIENTRY nullStub_glEnable(GLenum) { nullGlCount(NULL_GL_glEnable); }
+static void APIENTRY nullStub_glFinish(void) { nullGlCount(NULL_GL_glFinish); }
+static void APIENTRY nullStub_glFlush(void) { nullGlCount(NULL_GL_glFlush); }
+static void APIENTRY nullStub_glBlendFunc(GLenum, GLenum) { nullGlCount(NULL_GL_glBlendFunc); }
+static void APIENTRY nullStub_glLogicOp(GLenum) { nullGlCount(NULL_GL_glLogicOp); }
+static void APIENTRY nullStub_glStencilFunc(GLenum, GLint, GLuint) { nullGlCount(NULL_GL_glStencilFunc); }
+static void APIENTRY nullStub_glStencilOp(GLenum, GLenum, GLenum) { nullGlCount(NULL_GL_glStencilOp); }
+static void APIENTRY nullStub_glDepthFunc(GLenum) { nullGlCount(NULL_GL_glDepthFunc); }
+static void APIENTRY nullStub_glPixelStoref(GLenum, GLfloat) { nullGlCount(NULL_GL_glPixelStoref); }
+static void APIENTRY nullStub_glPixelStorei(GLenum, GLint) { nullGlCount(NULL_GL_glPixelStorei); }
+static void APIENTRY nullStub_glReadBuffer(GLenum) { nullGlCount(NULL_GL_glReadBuffer); }
+static void APIENTRY nullStub_glReadPixels(GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, void *) { nullGlCount(NULL_GL_glReadPixels); }
+static void APIENTRY nullStub_glGetBooleanv(GLenum, GLboolean *) { nullGlCount(NULL_GL_glGetBooleanv); }
+static void APIENTRY nullStub_glGetDoublev(GLenum, GLdouble *) { nullGlCount(NULL_GL_glGetDoublev); }
+static GLenum APIENTRY nullStub_glGetError(void) { nullGlCount(NULL_GL_glGetError); return (GLenum)0; }
+static void APIENTRY nullStub_glGetFloatv(GLenum, GLfloat *) { nullGlCount(NULL_GL_glGetFloatv); }
+static void APIENTRY nullStub_glGetIntegerv(GLenum, GLint *) { nullGlCount(NULL_GL_glGetIntegerv); }
+static const GLubyte * APIENTRY nullStub_glGetString(GLenum) { nullGlCount(NULL_GL_glGetString); return (const GLubyte *)0; }
+static void APIENTRY nullStub_glGetTexImage(GLenum, GLint, GLenum, GLenum, void *) { nullGlCount(NULL_GL_glGetTexImage); }
+static void APIENTRY nullStub_glGetTexParameterfv(GLenum, GLenum, GLfloat *) { nullGlCount(NULL_GL_glGetTexParameterfv); }
+static void APIENTRY nullStub_glGetTexParameteriv(GLenum, GLenum, GLint *) { nullGlCount(NULL_GL_glGetTexParameteriv); }
+static void APIENTRY nullStub_glGetTexLevelParameterfv(GLenum, GLint, GLenum, GLfloat *) { nullGlCount(NULL_GL_glGetTexLevelParameterfv); }
+static void APIENTRY nullStub_glGetTexLevelParameteriv(GLenum, GLint, GLenum, GLint *) { nullGlCount(NULL_GL_glGetTexLevelParameteriv); }
+static GLboolean APIENTRY nullStub_glIsEnabled(GLenum) { nullGlCount(NULL_GL_glIsEnabled); return (GLboolean)0; }
+static void APIENTRY nullStub_glDepthRange(GLdouble, GLdouble) { nullGlCount(NULL_GL_glDepthRange); }
+static void APIENTRY nullStub_glViewport(GLint, GLint, GLsizei, GLsizei) { nullGlCount(NULL_GL_glViewport); }
+static void APIENTRY nullStub_glDrawArrays(GLenum, GLint, GLsizei) { nullGlCount(NULL_GL_glDrawArrays); }
+static void APIENTRY nullStub_glDrawElements(GLenum, GLsizei, GLenum, const void *) { nullGlCount(NULL_GL_glDrawElements); }
+static void APIENTRY nullStub_glPolygonOffset(GLfloat, GLfloat) { nullGlCount(NULL_GL_glPolygonOffset); }
+static void APIENTRY nullStub_glCopyTexImage1D(GLenum, GLint, GLenum, GLint, GLint, GLsizei, GLint) { nullGlCount(NULL_GL_glCopyTexImage1D); }
+static void APIENTRY nullStub_glCopyTexImage2D(GLenum, GLint, GLenum, GLint, GLint, GLsizei, GLsizei, GLint) { nullGlCount(NULL_GL_glCopyTexImage2D); }
+static void APIENTRY nullStub_glCopyTexSubImage1D(GLenum, GLint, GLint, GLint, GLint, GLsizei) { nullGlCount(NULL_GL_glCopyTexSubImage1D); }
+static void APIENTRY nullStub_glCopyTexSubImage2D(GLenum, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei) { nullGlCount(NULL_GL_glCopyTexSubImage2D); }
+static void APIENTRY nullStub_glTexSubImage1D(GLenum, GLint, GLint, GLsizei, GLenum, GLenum, const void *) { nullGlCount(NULL_GL_glTexSubImage1D); }
+static void APIENTRY nullStub_glTexSubImage2D(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const void *) { nullGlCount(NULL_GL_glTexSubImage2D); }
+static void APIENTRY nullStub_glBindTexture(GLenum, GLuint) { nullGlCount(NULL_GL_glBindTexture); }
+static void APIENTRY nullStub_glDeleteTextures(GLsizei, const GLuint *) { nullGlCount(NULL_GL_glDeleteTextures); }
+static void APIENTRY nullStub_glGenTextures(GLsizei, GLuint *) { nullGlCount(NULL_GL_glGenTextures); }
+static GLboolean APIENTRY nullStub_glIsTexture(GLuint) { nullGlCount(NULL_GL_glIsTexture); return (GLboolean)0; }
+static void APIENTRY nullStub_glDrawRangeElements(GLenum, GLuint, GLuint, GLsizei, GLenum, const void *) { nullGlCount(NULL_GL_glDrawRangeElements); }
+static void APIENTRY nullStub_glTexImage3D(GLenum, GLint, GLint, GLsizei, GLsizei, GLsizei, GLint, GLenum, GLenum, const void *) { nullGlCount(NULL_GL_glTexImage3D); }
+static void APIENTRY nullStub_glTexSubImage3D(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void *) { nullGlCount(NULL_GL_glTexSubImage3D); }
+static void APIENTRY nullStub_glCopyTexSubImage3D(GLenum, GLint, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei) { nullGlCount(NULL_GL_glCopyTexSubImage3D); }
+static void APIENTRY nullStub_glActiveTexture(GLenum) { nullGlCount(NULL_GL_glActiveTexture); }
+static void APIENTRY nullStub_glSampleCoverage(GLfloat, GLboolean) { nullGlCount(NULL_GL_glSampleCoverage); }
+static void APIENTRY nullStub_glCompressedTexImage3D(GLenum, GLint, GLenum, GLsizei, GLsizei, GLsizei, GLint, GLsizei, const void *) { nullGlCount(NULL_GL_glCompressedTexImage3D); }
+static void APIENTRY nullStub_glCompressedTexImage2D(GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei, const void *) { nullGlCount(NULL_GL_glCompressedTexImage2D); }
+static void APIENTRY nullStub_glCompressedTexImage1D(GLenum, GLint, GLenum, GLsizei, GLint, GLsizei, const void *) { nullGlCount(NULL_GL_glCompressedTexImage1D); }
+static void APIENTRY nullStub_glCompressedTexSubImage3D(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLsizei, const void *) { nullGlCount(NULL_GL_glCompressedTexSubImage3D); }
+static void APIENTRY nullStub_glCompressedTexSubImage2D(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLsizei, const void *) { nullGlCount(NULL_GL_glCompressedTexSubImage2D); }
+static void APIENTRY nullStub_glCompressedTexSubImage1D(GLenum, GLint, GLint, GLsizei, GLenum, GLsizei, const void *) { nullGlCount(NULL_GL_glCompressedTexSubImage1D); }
+static void APIENTRY nullStub_glGetCompressedTexImage(GLenum, GLint, void *) { nullGlCount(NULL_GL_glGetCompressedTexImage); }
+static void APIENTRY nullStub_glBlendFuncSeparate(GLenum, GLenum, GLenum, GLenum) { nullGlCount(NULL_GL_glBlendFuncSeparate); }
+static void APIENTRY nullStub_glMultiDrawArrays(GLenum, const GLint *, const GLsizei *, GLsizei) { nullGlCount(NULL_GL_glMultiDrawArrays); }
+static void APIENTRY nullStub_glMultiDrawElements(GLenum, const GLsizei *, GLenum, const void *const*, GLsizei) { nullGlCount(NULL_GL_glMultiDrawElements); }
+static void APIENTRY nullStub_glPointParameterf(GLenum, GLfloat) { nullGlCount(NULL_GL_glPointParameterf); }
+static void APIENTRY nullStub_glPointParameterfv(GLenum, const GLfloat *) { nullGlCount(NULL_GL_glPointParameterfv); }
+static void APIENTRY nullStub_glPointParameteri(GLenum, GLint) { nullGlCount(NULL_GL_glPointParameteri); }
+static void APIENTRY nullStub_glPointParameteriv(GLenum, const GLint *) { nullGlCount(NULL_GL_glPointParameteriv); }
+static void APIENTRY nullStub_glBlendColor(GLfloat, GLfloat, GLfloat, GLfloat) { nullGlCount(NULL_GL_glBlendColor); }
+static void APIENTRY nullStub_glBlendEquation(GLenum) { nullGlCount(NULL_GL_glBlendEquation); }
+static void APIENTRY nullStub_glGenQueries(GLsizei, GLuint *) { nullGlCount(NULL_GL_glGenQueries); }
+static void APIENTRY nullStub_glDeleteQueries(GLsizei, const GLuint *) { nullGlCount(NULL_GL_glDeleteQueries); }
+static GLboolean APIENTRY nullStub_glIsQuery(GLuint) { nullGlCount(NULL_GL_glIsQuery); return (GLboolean)0; }
+static void APIENTRY nullStub_glBeginQuery(GLenum, GLuint) { nullGlCount(NULL_GL_glBeginQuery); }
+static void APIENTRY nullStub_glEndQuery(GLenum) { nullGlCount(NULL_GL_glEndQuery); }
+static void APIENTRY nullStub_glGetQueryiv(GLenum, GLenum, GLint *) { nullGlCount(NULL_GL_glGetQueryiv); }
+static void APIENTRY nullStub_glGetQueryObjectiv(GLuint, GLenum, GLint *) { nullGlCount(NULL_GL_glGetQueryObjectiv); }
+static void APIENTRY nullStub_glGetQueryObjectuiv(GLuint, GLenum, GLuint *) { nullGlCount(NULL_GL_glGetQueryObjectuiv); }
+static void APIENTRY nullStub_glBindBuffer(GLenum, GLuint) { nullGlCount(NULL_GL_glBindBuffer); }
+static void APIENTRY nullStub_glDeleteBuffers(GLsizei, const GLuint *) { nullGlCount(NULL_GL_glDeleteBuffers); }
+static void APIENTRY nullStub_glGenBuffers(GLsizei, GLuint *) { nullGlCount(NULL_GL_glGenBuffers); }
+static GLboolean APIENTRY nullStub_glIsBuffer(GLuint) { nullGlCount(NULL_GL_glIsBuffer); return (GLboolean)0; }
+static void APIENTRY nullStub_glBufferData(GLenum, GLsizeiptr, const void *, GLenum) { nullGlCount(NULL_GL_glBufferData); }
+static void APIENTRY nullStub_glBufferSubData(GLenum, GLintptr, GLsizeiptr, const void *) { nullGlCount(NULL_GL_glBufferSubData); }
+static void APIENTRY nullStub_glGetBufferSubData(GLenum, GLintptr, GLsizeiptr, void *) { nullGlCount(NULL_GL_glGetBufferSubData); }
+static void * APIENTRY nullStub_glMapBuffer(GLenum, GLenum) { nullGlCount(NULL_GL_glMapBuffer); return (void *)0; }
+static GLboolean APIENTRY nullStub_glUnmapBuffer(GLenum) { nullGlCount(NULL_GL_glUnmapBuffer); return (GLboolean)0; }
+static void APIENTRY nullStub_glGetBufferParameteriv(GLenum, GLenum, GLint *) { nullGlCount(NULL_GL_glGetBufferParameteriv); }
+static void APIENTRY nullStub_glGetBufferPointerv(GLenum, GLenum, void **) { nullGlCount(NULL_GL_glGetBufferPointerv); }
+static void APIENTRY nullStub_glBlendEquationSeparate(GLenum, GLenum) { nullGlCount(NULL_GL_glBlendEquationSeparate); }
+static void APIENTRY nullStub_glDrawBuffers(GLsizei, const GLenum *) { nullGlCount(NULL_GL_glDrawBuffers); }
+static void APIENTRY nullStub_glStencilOpSeparate(GLenum, GLenum, GLenum, GLenum) { nullGlCount(NULL_GL_glStencilOpSeparate); }
+static void APIENTRY nullStub_glStencilFuncSeparate(GLenum, GLenum, GLint, GLuint) { nullGlCount(NULL_GL_glStencilFuncSeparate); }
+static void APIENTRY nullStub_glStencilMaskSeparate(GLenum, GLuint) { nullGlCount(NULL_GL_glStencilMaskSeparate); }
+static void APIENTRY nullStub_glAttachShader(GLuint, GLuint) { nullGlCount(NULL_GL_glAttachShader); }
+static void APIENTRY nullStub_glBindAttribLocation(GLuint, GLuint, const GLchar *) { nullGlCount(NULL_GL_glBindAttribLocation); }
+static void APIENTRY nullStub_glCompileShader(GLuint) { nullGlCount(NULL_GL_glCompileShader); }
+static GLuint APIENTRY nullStub_glCreateProgram(void) { nullGlCount(NULL_GL_glCreateProgram); return (GLuint)0; }
+static GLuint APIENTRY nullStub_glCreateShader(GLenum) { nullGlCount(NULL_GL_glCreateShader); return (GLuint)0; }
+static void APIENTRY nullStub_glDeleteProgram(GLuint) { nullGlCount(NULL_GL_glDeleteProgram); }
+static void APIENTRY nullStub_glDeleteShader(GLuint) { nullGlCount(NULL_GL_glDeleteShader); }
+static void APIENTRY nullStub_glDetachShader(GLuint, GLuint) { nullGlCount(NULL_GL_glDetachShader); }
+static void APIENTRY nullStub_glDisableVertexAttribArray(GLuint) { nullGlCount(NULL_GL_glDisableVertexAttribArray); }
+static void APIENTRY nullStub_glEnableVertexAttribArray(GLuint) { nullGlCount(NULL_GL_glEnableVertexAttribArray); }
+static void APIENTRY nullStub_glGetActiveAttrib(GLuint, GLuint, GLsizei, GLsizei *, GLint *, GLenum *, GLchar *) { nullGlCount(NULL_GL_glGetActiveAttrib); }
+static void APIENTRY nullStub_glGetActiveUniform(GLuint, GLuint, GLsizei, GLsizei *, GLint *, GLenum *, GLchar *) { nullGlCount(NULL_GL_glGetActiveUniform); }
+static void APIENTRY nullStub_glGetAttachedShaders(GLuint, GLsizei, GLsizei *, GLuint *) { nullGlCount(NULL_GL_glGetAttachedShaders); }
+static GLint APIENTRY nullStub_glGetAttribLocation(GLuint, const GLchar *) { nullGlCount(NULL_GL_glGetAttribLocation); return (GLint)0; }
+static void APIENTRY nullStub_glGetProgramiv(GLuint, GLenum, GLint *) { nullGlCount(NULL_GL_glGetProgramiv); }
+static void APIENTRY nullStub_glGetProgramInfoLog(GLuint, GLsizei, GLsizei *, GLchar *) { nullGlCount(NULL_GL_glGetProgramInfoLog); }
+static void APIENTRY nullStub_glGetShaderiv(GLuint, GLenum, GLint *) { nullGlCount(NULL_GL_glGetShaderiv); }
+static void APIENTRY nullStub_glGetShaderInfoLog(GLuint, GLsizei, GLsizei *, GLchar *) { nullGlCount(NULL_GL_glGetShaderInfoLog); }
+static void APIENTRY nullStub_glGetShaderSource(GLuint, GLsizei, GLsizei *, GLchar *) { nullGlCount(NULL_GL_glGetShaderSource); }
+static GLint APIENTRY nullStub_glGetUniformLocation(GLuint, const GLchar *) { nullGlCount(NULL_GL_glGetUniformLocation); return (GLint)0; }
+static void APIENTRY nullStub_glGetUniformfv(GLuint, GLint, GLfloat *) { nullGlCount(NULL_GL_glGetUniformfv); }
+static void APIENTRY nullStub_glGetUniformiv(GLuint, GLint, GLint *) { nullGlCount(NULL_GL_glGetUniformiv); }
+static void APIENTRY nullStub_glGetVertexAttribdv(GLuint, GLenum, GLdouble *) { nullGlCount(NULL_GL_glGetVertexAttribdv); }
+static void APIENTRY nullStub_glGetVertexAttribfv(GLuint, GLenum, GLfloat *) { nullGlCount(NULL_GL_glGetVertexAttribfv); }
+static void APIENTRY nullStub_glGetVertexAttribiv(GLuint, GLenum, GLint *) { nullGlCount(NULL_GL_glGetVertexAttribiv); }
+static void APIENTRY nullStub_glGetVertexAttribPointerv(GLuint, GLenum, void **) { nullGlCount(NULL_GL_glGetVertexAttribPointerv); }
+static GLboolean APIENTRY nullStub_glIsProgram(GLuint) { nullGlCount(NULL_GL_glIsProgram); return (GLboolean)0; }
+static GLboolean APIENTRY nullStub_glIsShader(GLuint) { nullGlCount(NULL_GL_glIsShader); return (GLboolean)0; }
+static void APIENTRY nullStub_glLinkProgram(GLuint) { nullGlCount(NULL_GL_glLinkProgram); }
+static void APIENTRY nullStub_glShaderSource(GLuint, GLsizei, const GLchar *const*, const GLint *) { nullGlCount(NULL_GL_glShaderSource); }
+static void APIENTRY nullStub_glUseProgram(GLuint) { nullGlCount(NULL_GL_glUseProgram); }
+static void APIENTRY nullStub_glUniform1f(GLint, GLfloat) { nullGlCount(NULL_GL_glUniform1f); }
+static void APIENTRY nullStub_glUniform2f(GLint, GLfloat, GLfloat) { nullGlCount(NULL_GL_glUniform2f); }
+static void APIENTRY nullStub_glUniform3f(GLint, GLfloat, GLfloat, GLfloat) { nullGlCount(NULL_GL_glUniform3f); }
+static void APIENTRY nullStub_glUniform4f(GLint, GLfloat, GLfloat, GLfloat, GLfloat) { nullGlCount(NULL_GL_glUniform4f); }
+static void APIENTRY nullStub_glUniform1i(GLint, GLint) { nullGlCount(NULL_GL_glUniform1i); }
+static void APIENTRY nullStub_glUniform2i(GLint, GLint, GLint) { nullGlCount(NULL_GL_glUniform2i); }
+static void APIENTRY nullStub_glUniform3i(GLint, GLint, GLint, GLint) { nullGlCount(NULL_GL_glUniform3i); }
+static void APIENTRY nullStub_glUniform4i(GLint, GLint, GLint, GLint, GLint) { nullGlCount(NULL_GL_glUniform4i); }
+static void APIENTRY nullStub_glUniform1fv(GLint, GLsizei, const GLfloat *) { nullGlCount(NULL_GL_glUniform1fv); }
+static void APIENTRY nullStub_glUniform2fv(GLint, GLsizei, const GLfloat *) { nullGlCount(NULL_GL_glUniform2fv); }
+static void APIENTRY nullStub_glUniform3fv(GLint, GLsizei, const GLfloat *) { nullGlCount(NULL_GL_glUniform3fv); }
+static void APIENTRY nullStub_glUniform4fv(GLint, GLsizei, const GLfloat *) { nullGlCount(NULL_GL_glUniform4fv); }
+static void APIENTRY nullStub_glUniform1iv(GLint, GLsizei, const GLint *) { nullGlCount(NULL_GL_glUniform1iv); }
+static void APIENTRY nullStub_glUniform2iv(GLint, GLsizei, const GLint *) { nullGlCount(NULL_GL_glUniform2iv); }
+static void APIENTRY nullStub_glUniform3iv(GLint, GLsizei, const GLint *) { nullGlCount(NULL_GL_glUniform3iv); }
+static void APIENTRY nullStub_glUniform4iv(GLint, GLsizei, const GLint *) { nullGlCount(NULL_GL_glUniform4iv); }
+static void APIENTRY nullStub_glUniformMatrix2fv(GLint, GLsizei, GLboolean, const GLfloat *) { nullGlCount(NULL_GL_glUniformMatrix2fv); }
+static void APIENTRY nullStub_glUniformMatrix3fv(GLint, GLsizei, GLboolean, const GLfloat *) { nullGlCount(NULL_GL_glUniformMatrix3fv); }
+static void APIENTRY nullStub_glUniformMatrix4fv(GLint, GLsizei, GLboolean, const GLfloat *) { nullGlCount(NULL_GL_glUniformMatrix4fv); }
+static void APIENTRY nullStub_glValidateProgram(GLuint) { nullGlCount(NULL_GL_glValidateProgram); }
+static void APIENTRY nullStub_glVertexAttrib1d(GLuint, GLdouble) { nullGlCount(NULL_GL_glVertexAttrib1d); }
+static void APIENTRY nullStub_glVertexAttrib1dv(GLuint, const GLdouble *) { nullGlCount(NULL_GL_glVertexAttrib1dv); }
+static void APIENTRY nullStub_glVertexAttrib1f(GLuint, GLfloat) { nullGlCount(NULL_GL_glVertexAttrib1f); }
+static void APIENTRY nullStub_glVertexAttrib1fv(GLuint, const GLfloat *) { nullGlCount(NULL_GL_glVertexAttrib1fv); }
+static void APIENTRY nullStub_glVertexAttrib1s(GLuint, GLshort) { nullGlCount(NULL_GL_glVertexAttrib1s); }
+static void APIENTRY nullStub_glVertexAttrib1sv(GLuint, const GLshort *) { nullGlCount(NULL_GL_glVertexAttrib1sv); }
+static void APIENTRY nullStub_glVertexAttrib2d(GLuint, GLdouble, GLdouble) { nullGlCount(NULL_GL_glVertexAttrib2d); }
+static void APIENTRY nullStub_glVertexAttrib2dv(GLuint, const GLdouble *) { nullGlCount(NULL_GL_glVertexAttrib2dv); }
+static void APIENTRY nullStub_glVertexAttrib2f(GLuint, GLfloat, GLfloat) { nullGlCount(NULL_GL_glVertexAttrib2f); }
+static void APIENTRY nullStub_glVertexAttrib2fv(GLuint, const GLfloat *) { nullGlCount(NULL_GL_glVertexAttrib2fv); }
+static void APIENTRY nullStub_glVertexAttrib2s(GLuint, GLshort, GLshort) { nullGlCount(NULL_GL_glVertexAttrib2s); }
+static void APIENTRY nullStub_glVertexAttrib2sv(GLuint, const GLshort *) { nullGlCount(NULL_GL_glVertexAttrib2sv); }
+static void APIENTRY nullStub_glVertexAttrib3d(GLuint, GLdouble, GLdouble, GLdouble) { nullGlCount(NULL_GL_glVertexAttrib3d); }
+static void APIENTRY nullStub_glVertexAttrib3dv(GLuint, const GLdouble *) { nullGlCount(NULL_GL_glVertexAttrib3dv); }
+static void APIENTRY nullStub_glVertexAttrib3f(GLuint, GLfloat, GLfloat, GLfloat) { nullGlCount(NULL_GL_glVertexAttrib3f); }
+static void APIENTRY nullStub_glVertexAttrib3fv(GLuint, const GLfloat *) { nullGlCount(NULL_GL_glVertexAttrib3fv); }
+static void APIENTRY nullStub_glVertexAttrib3s(GLuint, GLshort, GLshort, GLshort) { nullGlCount(NULL_GL_glVertexAttrib3s); }
+static void APIENTRY nullStub_glVertexAttrib3sv(GLuint, const GLshort *) { nullGlCount(NULL_GL_glVertexAttrib3sv); }
+static void APIENTRY nullStub_glVertexAttrib4Nbv(GLuint, const GLbyte *) { nullGlCount(NULL_GL_glVertexAttrib4Nbv); }
+static void APIENTRY nullStub_glVertexAttrib4Niv(GLuint, const GLint *) { nullGlCount(NULL_GL_glVertexAttrib4Niv); }
+static void APIENTRY nullStub_glVertexAttrib4Nsv(GLuint, const GLshort *) { nullGlCount(NULL_GL_glVertexAttrib4Nsv); }
+static void APIENTRY nullStub_glVertexAttrib4Nub(GLuint, GLubyte, GLubyte, GLubyte, GLubyte) { nullGlCount(NULL_GL_glVertexAttrib4Nub); }
+static void APIENTRY nullStub_glVertexAttrib4Nubv(GLuint, const GLubyte *) { nullGlCount(NULL_GL_glVertexAttrib4Nubv); }
+static void APIENTRY nullStub_glVertexAttrib4Nuiv(GLuint, const GLuint *) { nullGlCount(NULL_GL_glVertexAttrib4Nuiv); }
+static void APIENTRY nullStub_glVertexAttrib4Nusv(GLuint, const GLushort *) { nullGlCount(NULL_GL_glVertexAttrib4Nusv); }
+static void APIENTRY nullStub_glVertexAttrib4bv(GLuint, const GLbyte *) { nullGlCount(NULL_GL_glVertexAttrib4bv); }
+static void APIENTRY nullStub_glVertexAttrib4d(GLuint, GLdouble, GLdouble, GLdouble, GLdouble) { nullGlCount(NULL_GL_glVertexAttrib4d); }
+static void APIENTRY nullStub_glVertexAttrib4dv(GLuint, const GLdouble *) { nullGlCount(NULL_GL_glVertexAttrib4dv); }
+static void APIENTRY nullStub_glVertexAttrib4f(GLuint, GLfloat, GLfloat, GLfloat, GLfloat) { nullGlCount(NULL_GL_glVertexAttrib4f); }
+static void APIENTRY nullStub_glVertexAttrib4fv(GLuint, const GLfloat *) { nullGlCount(NULL_GL_glVertexAttrib4fv); }
+static void APIENTRY nullStub_glVertexAttrib4iv(GLuint, const GLint *) { nullGlCount(NULL_GL_glVertexAttrib4iv); }
+static void APIENTRY nullStub_glVertexAttrib4s(GLuint, GLshort, GLshort, GLshort, GLshort) { nullGlCount(NULL_GL_glVertexAttrib4s); }
+static void APIENTRY nullStub_glVertexAttrib4sv(GLuint, const GLshort *) { nullGlCount(NULL_GL_glVertexAttrib4sv); }
+static void APIENTRY nullStub_glVertexAttrib4ubv(GLuint, const GLubyte *) { nullGlCount(NULL_GL_glVertexAttrib4ubv); }
+static void APIENTRY nullStub_glVertexAttrib4uiv(GLuint, const GLuint *) { nullGlCount(NULL_GL_glVertexAttrib4uiv); }
+static void APIENTRY nullStub_glVertexAttrib4usv(GLuint, const GLushort *) { nullGlCount(NULL_GL_glVertexAttrib4usv); }
+static void APIENTRY nullStub_glVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const void *) { nullGlCount(NULL_GL_glVertexAttribPointer); }
+static void APIENTRY nullStub_glUniformMatrix2x3fv(GLint, GLsizei, GLboolean, const GLfloat *) { nullGlCount(NULL_GL_glUniformMatrix2x3fv); }
+static void APIENTRY nullStub_glUniformMatrix3x2fv(GLint, GLsizei, GLboolean, const GLfloat *) { nullGlCount(NULL_GL_glUniformMatrix3x2fv); }
+static void APIENTRY nullStub_glUniformMatrix2x4fv(GLint, GLsizei, GLboolean, const GLfloat *) { nullGlCount(NULL_GL_glUniformMatrix2x4fv); }
+static void APIENTRY nullStub_glUniformMatrix4x2fv(GLint, GLsizei, GLboolean, const GLfloat *) { nullGlCount(NULL_GL_glUniformMatrix4x2fv); }
+static void APIENTRY nullStub_glUniformMatrix3x4fv(GLint, GLsizei, GLboolean, const GLfloat *) { nullGlCount(NULL_GL_glUniformMatrix3x4fv); }
+static void APIENTRY nullStub_glUniformMatrix4x3fv(GLint, GLsizei, GLboolean, const GLfloat *) { nullGlCount(NULL_GL_glUniformMatrix4x3fv); }
+static void APIENTRY nullStub_glColorMaski(GLuint, GLboolean, GLboolean, GLboolean, GLboolean) { nullGlCount(NULL_GL_glColorMaski); }
+static void APIENTRY nullStub_glGetBooleani_v(GLenum, GLuint, GLboolean *) { nullGlCount(NULL_GL_glGetBooleani_v); }
+static void APIENTRY nullStub_glGetIntegeri_v(GLenum, GLuint, GLint *) { nullGlCount(NULL_GL_glGetIntegeri_v); }
+static void APIENTRY nullStub_glEnablei(GLenum, GLuint) { nullGlCount(NULL_GL_glEnablei); }
+static void APIENTRY nullStub_glDisablei(GLenum, GLuint) { nullGlCount(NULL_GL_glDisablei); }
+static GLboolean APIENTRY nullStub_glIsEnabledi(GLenum, GLuint) { nullGlCount(NULL_GL_glIsEnabledi); return (GLboolean)0; }
+static void APIENTRY nullStub_glBeginTransformFeedback(GLenum) { nullGlCount(NULL_GL_glBeginTransformFeedback); }
+static void APIENTRY nullStub_glEndTransformFeedback(void) { nullGlCount(NULL_GL_glEndTransformFeedback); }
+static void APIENTRY nullStub_glBindBufferRange(GLenum, GLuint, GLuint, GLintptr, GLsizeiptr) { nullGlCount(NULL_GL_glBindBufferRange); }
+static void APIENTRY nullStub_glBindBufferBase(GLenum, GLuint, GLuint) { nullGlCount(NULL_GL_glBindBufferBase); }
+static void APIENTRY nullStub_glTransformFeedbackVaryings(GLuint, GLsizei, const GLchar *const*, GLenum) { nullGlCount(NULL_GL_glTransformFeedbackVaryings); }
+static void APIENTRY nullStub_glGetTransformFeedbackVarying(GLuint, GLuint, GLsizei, GLsizei *, GLsizei *, GLenum *, GLchar *) { nullGlCount(NULL_GL_glGetTransformFeedbackVarying); }
+static void APIENTRY nullStub_glClampColor(GLenum, GLenum) { nullGlCount(NULL_GL_glClampColor); }
+static void APIENTRY nullStub_glBeginConditionalRender(GLuint, GLenum) { nullGlCount(NULL_GL_glBeginConditionalRender); }
+static void APIENTRY nullStub_glEndConditionalRender(void) { nullGlCount(NULL_GL_glEndConditionalRender); }
+static void APIENTRY nullStub_glVertexAttribIPointer(GLuint, GLint, GLenum, GLsizei, const void *) { nullGlCount(NULL_GL_glVertexAttribIPointer); }
+static void APIENTRY nullStub_glGetVertexAttribIiv(GLuint, GLenum, GLint *) { nullGlCount(NULL_GL_glGetVertexAttribIiv); }
+static void APIENTRY nullStub_glGetVertexAttribIuiv(GLuint, GLenum, GLuint *) { nullGlCount(NULL_GL_glGetVertexAttribIuiv); }
+static void APIENTRY nullStub_glVertexAttribI1i(GLuint, GLint) { nullGlCount(NULL_GL_glVertexAttribI1i); }
+static void APIENTRY nullStub_glVertexAttribI2i(GLuint, GLint, GLint) { nullGlCount(NULL_GL_glVertexAttribI2i); }
+static void APIENTRY nullStub_glVertexAttribI3i(GLuint, GLint, GLint, GLint) { nullGlCount(NULL_GL_glVertexAttribI3i); }
+static void APIENTRY nullStub_glVertexAttribI4i(GLuint, GLint, GLint, GLint, GLint) { nullGlCount(NULL_GL_glVertexAttribI4i); }
+static void APIENTRY nullStub_glVertexAttribI1ui(GLuint, GLuint) { nullGlCount(NULL_GL_glVertexAttribI1ui); }
+static void APIENTRY nullStub_glVertexAttribI2ui(GLuint, GLuint, GLuint) { nullGlCount(NULL_GL_glVertexAttribI2ui); }
+static void APIENTRY nullStub_glVertexAttribI3ui(GLuint, GLuint, GLuint, GLuint) { nullGlCount(NULL_GL_glVertexAttribI3ui); }
+static void APIENTRY nullStub_glVertexAttribI4ui(GLuint, GLuint, GLuint, GLuint, GLuint) { nullGlCount(NULL_GL_glVertexAttribI4ui); }
+static void APIENTRY nullStub_glVertexAttribI1iv(GLuint, const GLint *) { nullGlCount(NULL_GL_glVertexAttribI1iv); }
+static void APIENTRY nullStub_glVertexAttribI2iv(GLuint, const GLint *) { nullGlCount(NULL_GL_glVertexAttribI2iv); }
+static void APIENTRY nullStub_glVertexAttribI3iv(GLuint, const GLint *) { nullGlCount(NULL_GL_glVertexAttribI3iv); }
+static void APIENTRY nullStub_glVertexAttribI4iv(GLuint, const GLint *) { nullGlCount(NULL_GL_glVertexAttribI4iv); }
+static void APIENTRY nullStub_glVertexAttribI1uiv(GLuint, const GLuint *) { nullGlCount(NULL_GL_glVertexAttribI1uiv); }
+static void APIENTRY nullStub_glVertexAttribI2uiv(GLuint, const GLuint *) { nullGlCount(NULL_GL_glVertexAttribI2uiv); }
+static void APIENTRY nullStub_glVertexAttribI3uiv(GLuint, const GLuint *) { nullGlCount(NULL_GL_glVertexAttribI3uiv); }
+static void APIENTRY nullStub_glVertexAttribI4uiv(GLuint, const GLuint *) { nullGlCount(NULL_GL_glVertexAttribI4uiv); }
+static void APIENTRY nullStub_glVertexAttribI4bv(GLuint, const GLbyte *) { nullGlCount(NULL_GL_glVertexAttribI4bv); }
+static void APIENTRY nullStub_glVertexAttribI4sv(GLuint, const GLshort *) { nullGlCount(NULL_GL_glVertexAttribI4sv); }
+static void APIENTRY nullStub_glVertexAttribI4ubv(GLuint, const GLubyte *) { nullGlCount(NULL_GL_glVertexAttribI4ubv); }
+static void APIENTRY nullStub_glVertexAttribI4usv(GLuint, const GLushort *) { nullGlCount(NULL_GL_glVertexAttribI4usv); }
+static void APIENTRY nullStub_glGetUniformuiv(GLuint, GLint, GLuint *) { nullGlCount(NULL_GL_glGetUniformuiv); }
+static void APIENTRY nullStub_glBindFragDataLocation(GLuint, GLuint, const GLchar *) { nullGlCount(NULL_GL_glBindFragDataLocation); }
+static GLint APIENTRY nullStub_glGetFragDataLocation(GLuint, const GLchar *) { nullGlCount(NULL_GL_glGetFragDataLocation); return (GLint)0; }
+static void APIENTRY nullStub_glUniform1ui(GLint, GLuint) { nullGlCount(NULL_GL_glUniform1ui); }
+static void APIENTRY nullStub_glUniform2ui(GLint, GLuint, GLuint) { nullGlCount(NULL_GL_glUniform2ui); }
+static void APIENTRY nullStub_glUniform3ui(GLint, GLuint, GLuint, GLuint) { nullGlCount(NULL_GL_glUniform3ui); }
+static void APIENTRY nullStub_glUniform4ui(GLint, GLuint, GLuint, GLuint, GLuint) { nullGlCount(NULL_GL_glUniform4ui); }
+static void APIENTRY nullStub_glUniform1uiv(GLint, GLsizei, const GLuint *) { nullGlCount(NULL_GL_glUniform1uiv); }
+static void APIENTRY nullStub_glUniform2uiv(GLint, GLsizei, const GLuint *) { nullGlCount(NULL_GL_glUniform2uiv); }
+static void APIENTRY nullStub_glUniform3uiv(GLint, GLsizei, const GLuint *) { nullGlCount(NULL_GL_glUniform3uiv); }
+static void APIENTRY nullStub_glUniform4uiv(GLint, GLsizei, const GLuint *) { nullGlCount(NULL_GL_glUniform4uiv); }
+static void APIENTRY nullStub_glTexParameterIiv(GLenum, GLenum, const GLint *) { nullGlCount(NULL_GL_glTexParameterIiv); }
+static void APIENTRY nullStub_glTexParameterIuiv(GLenum, GLenum, const GLuint *) { nullGlCount(NULL_GL_glTexParameterIuiv); }
+static void APIENTRY nullStub_glGetTexParameterIiv(GLenum, GLenum, GLint *) { nullGlCount(NULL_GL_glGetTexParameterIiv); }
+static void APIENTRY nullStub_glGetTexParameterIuiv(GLenum, GLenum, GLuint *) { nullGlCount(NULL_GL_glGetTexParameterIuiv); }
+static void APIENTRY nullStub_glClearBufferiv(GLenum, GLint, const GLint *) { nullGlCount(NULL_GL_glClearBufferiv); }
+static void APIENTRY nullStub_glClearBufferuiv(GLenum, GLint, const GLuint *) { nullGlCount(NULL_GL_glClearBufferuiv); }
+static void APIENTRY nullStub_glClearBufferfv(GLenum, GLint, const GLfloat *) { nullGlCount(NULL_GL_glClearBufferfv); }
+static void APIENTRY nullStub_glClearBufferfi(GLenum, GLint, GLfloat, GLint) { nullGlCount(NULL_GL_glClearBufferfi); }
+static const GLubyte * APIENTRY nullStub_glGetStringi(GLenum, GLuint) { nullGlCount(NULL_GL_glGetStringi); return (const GLubyte *)0; }
+static GLboolean APIENTRY nullStub_glIsRenderbuffer(GLuint) { nullGlCount(NULL_GL_glIsRenderbuffer); return (GLboolean)0; }
+static void APIENTRY nullStub_glBindRenderbuffer(GLenum, GLuint) { nullGlCount(NULL_GL_glBindRenderbuffer); }
+static void APIENTRY nullStub_glDeleteRenderbuffers(GLsizei, const GLuint *) { nullGlCount(NULL_GL_glDeleteRenderbuffers); }
+static void APIENTRY nullStub_glGenRenderbuffers(GLsizei, GLuint *) { nullGlCount(NULL_GL_glGenRenderbuffers); }
+static void APIENTRY nullStub_glRenderbufferStorage(GLenum, GLenum, GLsizei, GLsizei) { nullGlCount(NULL_GL_glRenderbufferStorage); }
+static void APIENTRY nullStub_glGetRenderbufferParameteriv(GLenum, GLenum, GLint *) { nullGlCount(NULL_GL_glGetRenderbufferParameteriv); }
+static GLboolean APIENTRY nullStub_glIsFramebuffer(GLuint) { nullGlCount(NULL_GL_glIsFramebuffer); return (GLboolean)0; }
+static void APIENTRY nullStub_glBindFramebuffer(GLenum, GLuint) { nullGlCount(NULL_GL_glBindFramebuffer); }
+static void APIENTRY nullStub_glDeleteFramebuffers(GLsizei, const GLuint *) { nullGlCount(NULL_GL_glDeleteFramebuffers); }
+static void APIENTRY nullStub_glGenFramebuffers(GLsizei, GLuint *) { nullGlCount(NULL_GL_glGenFramebuffers); }
+static GLenum APIENTRY nullStub_glCheckFramebufferStatus(GLenum) { nullGlCount(NULL_GL_glCheckFramebufferStatus); return (GLenum)0; }
+static void APIENTRY nullStub_glFramebufferTexture1D(GLenum, GLenum, GLenum, GLuint, GLint) { nullGlCount(NULL_GL_glFramebufferTexture1D); }
+static void APIENTRY nullStub_glFramebufferTexture2D(GLenum, GLenum, GLenum, GLuint, GLint) { nullGlCount(NULL_GL_glFramebufferTexture2D); }
+static void APIENTRY nullStub_glFramebufferTexture3D(GLenum, GLenum, GLenum, GLuint, GLint, GLint) { nullGlCount(NULL_GL_glFramebufferTexture3D); }
+static void APIENTRY nullStub_glFramebufferRenderbuffer(GLenum, GLenum, GLenum, GLuint) { nullGlCount(NULL_GL_glFramebufferRenderbuffer); }
+static void APIENTRY nullStub_glGetFramebufferAttachmentParameteriv(GLenum, GLenum, GLenum, GLint *) { nullGlCount(NULL_GL_glGetFramebufferAttachmentParameteriv); }
+static void APIENTRY nullStub_glGenerateMipmap(GLenum) { nullGlCount(NULL_GL_glGenerateMipmap); }
+static void APIENTRY nullStub_glBlitFramebuffer(GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLbitfield, GLenum) { nullGlCount(NULL_GL_glBlitFramebuffer); }
+static void APIENTRY nullStub_glRenderbufferStorageMultisample(GLenum, GLsizei, GLenum, GLsizei, GLsizei) { nullGlCount(NULL_GL_glRenderbufferStorageMultisample); }
+static void APIENTRY nullStub_glFramebufferTextureLayer(GLenum, GLenum, GLuint, GLint, GLint) { nullGlCount(NULL_GL_glFramebufferTextureLayer); }
+static void * APIENTRY nullStub_glMapBufferRange(GLenum, GLintptr, GLsizeiptr, GLbitfield) { nullGlCount(NULL_GL_glMapBufferRange); return (void *)0; }
+static void APIENTRY nullStub_glFlushMappedBufferRange(GLenum, GLintptr, GLsizeiptr) { nullGlCount(NULL_GL_glFlushMappedBufferRange); }
+static void APIENTRY nullStub_glBindVertexArray(GLuint) { nullGlCount(NULL_GL_glBindVertexArray); }
+static void APIENTRY nullStub_glDeleteVertexArrays(GLsizei, const GLuint *) { nullGlCount(NULL_GL_glDeleteVertexArrays); }
+static void APIENTRY nullStub_glGenVertexArrays(GLsizei, GLuint *) { nullGlCount(NULL_GL_glGenVertexArrays); }
+static GLboolean APIENTRY nullStub_glIsVertexArray(GLuint) { nullGlCount(NULL_GL_glIsVertexArray); return (GLboolean)0; }
+static void APIENTRY nullStub_glDrawArraysInstanced(GLenum, GLint, GLsizei, GLsizei) { nullGlCount(NULL_GL_glDrawArraysInstanced); }
+static void APIENTRY nullStub_glDrawElementsInstanced(GLenum, GLsizei, GLenum, const void *, GLsizei) { nullGlCount(NULL_GL_glDrawElementsInstanced); }
+static void APIENTRY nullStub_glTexBuffer(GLenum, GLenum, GLuint) { nullGlCount(NULL_GL_glTexBuffer); }
+static void APIENTRY nullStub_glPrimitiveRestartIndex(GLuint) { nullGlCount(NULL_GL_glPrimitiveRestartIndex); }
+static void APIENTRY nullStub_glCopyBufferSubData(GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr) { nullGlCount(NULL_GL_glCopyBufferSubData); }
+static void APIENTRY nullStub_glGetUniformIndices(GLuint, GLsizei, const GLchar *const*, GLuint *) { nullGlCount(NULL_GL_glGetUniformIndices); }
+static void APIENTRY nullStub_glGetActiveUniformsiv(GLuint, GLsizei, const GLuint *, GLenum, GLint *) { nullGlCount(NULL_GL_glGetActiveUniformsiv); }
+static void APIENTRY nullStub_glGetActiveUniformName(GLuint, GLuint, GLsizei, GLsizei *, GLchar *) { nullGlCount(NULL_GL_glGetActiveUniformName); }
+static GLuint APIENTRY nullStub_glGetUniformBlockIndex(GLuint, const GLchar *) { nullGlCount(NULL_GL_glGetUniformBlockIndex); return (GLuint)0; }
+static void APIENTRY nullStub_glGetActiveUniformBlockiv(GLuint, GLuint, GLenum, GLint *) { nullGlCount(NULL_GL_glGetActiveUniformBlockiv); }
+static void APIENTRY nullStub_glGetActiveUniformBlockName(GLuint, GLuint, GLsizei, GLsizei *, GLchar *) { nullGlCount(NULL_GL_glGetActiveUniformBlockName); }
+static void APIENTRY nullStub_glUniformBlockBinding(GLuint, GLuint, GLuint) { nullGlCount(NULL_GL_glUniformBlockBinding); }
+static void APIENTRY nullStub_glDrawElementsBaseVertex(GLenum, GLsizei, GLenum, const void *, GLint) { nullGlCount(NULL_GL_glDrawElementsBaseVertex); }
+static void APIENTRY nullStub_glDrawRangeElementsBaseVertex(GLenum, GLuint, GLuint, GLsizei, GLenum, const void *, GLint) { nullGlCount(NULL_GL_glDrawRangeElementsBaseVertex); }
+static void APIENTRY nullStub_glDrawElementsInstancedBaseVertex(GLenum, GLsizei, GLenum, const void *, GLsizei, GLint) { nullGlCount(NULL_GL_glDrawElementsInstancedBaseVertex); }
+static void APIENTRY nullStub_glMultiDrawElementsBaseVertex(GLenum, const GLsizei *, GLenum, const void *const*, GLsizei, const GLint *) { nullGlCount(NULL_GL_glMultiDrawElementsBaseVertex); }
+static void APIENTRY nullStub_glProvokingVertex(GLenum) { nullGlCount(NULL_GL_glProvokingVertex); }
+static GLsync APIENTRY nullStub_glFenceSync(GLenum, GLbitfield) { nullGlCount(NULL_GL_glFenceSync); return (GLsync)0; }
+static GLboolean APIENTRY nullStub_glIsSync(GLsync) { nullGlCount(NULL_GL_glIsSync); return (GLboolean)0; }
+static void APIENTRY nullStub_glDeleteSync(GLsync) { nullGlCount(NULL_GL_glDeleteSync); }
+static GLenum APIENTRY nullStub_glClientWaitSync(GLsync, GLbitfield, GLuint64) { nullGlCount(NULL_GL_glClientWaitSync); return (GLenum)0; }
+static void APIENTRY nullStub_glWaitSync(GLsync, GLbitfield, GLuint64) { nullGlCount(NULL_GL_glWaitSync); }
+static void APIENTRY nullStub_glGetInteger64v(GLenum, GLint64 *) { nullGlCount(NULL_GL_glGetInteger64v); }
+static void APIENTRY nullStub_glGetSynciv(GLsync, GLenum, GLsizei, GLsizei *, GLint *) { nullGlCount(NULL_GL_glGetSynciv); }
+static void APIENTRY nullStub_glGetInteger64i_v(GLenum, GLuint, GLint64 *) { nullGlCount(NULL_GL_glGetInteger64i_v); }
+static void APIENTRY nullStub_glGetBufferParameteri64v(GLenum, GLenum, GLint64 *) { nullGlCount(NULL_GL_glGetBufferParameteri64v); }
+static void APIENTRY nullStub_glFramebufferTexture(GLenum, GLenum, GLuint, GLint) { nullGlCount(NULL_GL_glFramebufferTexture); }
+static void APIENTRY nullStub_glTexImage2DMultisample(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLboolean) { nullGlCount(NULL_GL_glTexImage2DMultisample); }
+static void APIENTRY nullStub_glTexImage3DMultisample(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei, GLboolean) { nullGlCount(NULL_GL_glTexImage3DMultisample); }
+static void APIENTRY nullStub_glGetMultisamplefv(GLenum, GLuint, GLfloat *) { nullGlCount(NULL_GL_glGetMultisamplefv); }
+static void APIENTRY nullStub_glSampleMaski(GLuint, GLbitfield) { nullGlCount(NULL_GL_glSampleMaski); }
+static void APIENTRY nullStub_glBindFragDataLocationIndexed(GLuint, GLuint, GLuint, const GLchar *) { nullGlCount(NULL_GL_glBindFragDataLocationIndexed); }
+static GLint APIENTRY nullStub_glGetFragDataIndex(GLuint, const GLchar *) { nullGlCount(NULL_GL_glGetFragDataIndex); return (GLint)0; }
+static void APIENTRY nullStub_glGenSamplers(GLsizei, GLuint *) { nullGlCount(NULL_GL_glGenSamplers); }
+static void APIENTRY nullStub_glDeleteSamplers(GLsizei, const GLuint *) { nullGlCount(NULL_GL_glDeleteSamplers); }
+static GLboolean APIENTRY nullStub_glIsSampler(GLuint) { nullGlCount(NULL_GL_glIsSampler); return (GLboolean)0; }
+static void APIENTRY nullStub_glBindSampler(GLuint, GLuint) { nullGlCount(NULL_GL_glBindSampler); }
+static void APIENTRY nullStub_glSamplerParameteri(GLuint, GLenum, GLint) { nullGlCount(NULL_GL_glSamplerParameteri); }
+static void APIENTRY nullStub_glSamplerParameteriv(GLuint, GLenum, const GLint *) { nullGlCount(NULL_GL_glSamplerParameteriv); }
+static void APIENTRY nullStub_glSamplerParameterf(GLuint, GLenum, GLfloat) { nullGlCount(NULL_GL_glSamplerParameterf); }
+static void APIENTRY nullStub_glSamplerParameterfv(GLuint, GLenum, const GLfloat *) { nullGlCount(NULL_GL_glSamplerParameterfv); }
+static void APIENTRY nullStub_glSamplerParameterIiv(GLuint, GLenum, const GLint *) { nullGlCount(NULL_GL_glSamplerParameterIiv); }
+static void APIENTRY nullStub_glSamplerParameterIuiv(GLuint, GLenum, const GLuint *) { nullGlCount(NULL_GL_glSamplerParameterIuiv); }
+static void APIENTRY nullStub_glGetSamplerParameteriv(GLuint, GLenum, GLint *) { nullGlCount(NULL_GL_glGetSamplerParameteriv); }
+static void APIENTRY nullStub_glGetSamplerParameterIiv(GLuint, GLenum, GLint *) { nullGlCount(NULL_GL_glGetSamplerParameterIiv); }
+static void APIENTRY nullStub_glGetSamplerParameterfv(GLuint, GLenum, GLfloat *) { nullGlCount(NULL_GL_glGetSamplerParameterfv); }
+static void APIENTRY nullStub_glGetSamplerParameterIuiv(GLuint, GLenum, GLuint *) { nullGlCount(NULL_GL_glGetSamplerParameterIuiv); }
+static void APIENTRY nullStub_glQueryCounter(GLuint, GLenum) { nullGlCount(NULL_GL_glQueryCounter); }
+static void APIENTRY nullStub_glGetQueryObjecti64v(GLuint, GLenum, GLint64 *) { nullGlCount(NULL_GL_glGetQueryObjecti64v); }
+static void APIENTRY nullStub_glGetQueryObjectui64v(GLuint, GLenum, GLuint64 *) { nullGlCount(NULL_GL_glGetQueryObjectui64v); }
+static void APIENTRY nullStub_glVertexAttribDivisor(GLuint, GLuint) { nullGlCount(NULL_GL_glVertexAttribDivisor); }
+static void APIENTRY nullStub_glVertexAttribP1ui(GLuint, GLenum, GLboolean, GLuint) { nullGlCount(NULL_GL_glVertexAttribP1ui); }
+static void APIENTRY nullStub_glVertexAttribP1uiv(GLuint, GLenum, GLboolean, const GLuint *) { nullGlCount(NULL_GL_glVertexAttribP1uiv); }
+static void APIENTRY nullStub_glVertexAttribP2ui(GLuint, GLenum, GLboolean, GLuint) { nullGlCount(NULL_GL_glVertexAttribP2ui); }
+static void APIENTRY nullStub_glVertexAttribP2uiv(GLuint, GLenum, GLboolean, const GLuint *) { nullGlCount(NULL_GL_glVertexAttribP2uiv); }
+static void APIENTRY nullStub_glVertexAttribP3ui(GLuint, GLenum, GLboolean, GLuint) { nullGlCount(NULL_GL_glVertexAttribP3ui); }
+static void APIENTRY nullStub_glVertexAttribP3uiv(GLuint, GLenum, GLboolean, const GLuint *) { nullGlCount(NULL_GL_glVertexAttribP3uiv); }
+static void APIENTRY nullStub_glVertexAttribP4ui(GLuint, GLenum, GLboolean, GLuint) { nullGlCount(NULL_GL_glVertexAttribP4ui); }
+static void APIENTRY nullStub_glVertexAttribP4uiv(GLuint, GLenum, GLboolean, const GLuint *) { nullGlCount(NULL_GL_glVertexAttribP4uiv); }
+static void APIENTRY nullStub_glVertexP2ui(GLenum, GLuint) { nullGlCount(NULL_GL_glVertexP2ui); }
+static void APIENTRY nullStub_glVertexP2uiv(GLenum, const GLuint *) { nullGlCount(NULL_GL_glVertexP2uiv); }
+static void APIENTRY nullStub_glVertexP3ui(GLenum, GLuint) { nullGlCount(NULL_GL_glVertexP3ui); }
+static void APIENTRY nullStub_glVertexP3uiv(GLenum, const GLuint *) { nullGlCount(NULL_GL_glVertexP3uiv); }
+static void APIENTRY nullStub_glVertexP4ui(GLenum, GLuint) { nullGlCount(NULL_GL_glVertexP4ui); }
+static void APIENTRY nullStub_glVertexP4uiv(GLenum, const GLuint *) { nullGlCount(NULL_GL_glVertexP4uiv); }
+static void APIENTRY nullStub_glTexCoordP1ui(GLenum, GLuint) { nullGlCount(NULL_GL_glTexCoordP1ui); }
+static void APIENTRY nullStub_glTexCoordP1uiv(GLenum, const GLuint *) { nullGlCount(NULL_GL_glTexCoordP1uiv); }
+static void APIENTRY nullStub_glTexCoordP2ui(GLenum, GLuint) { nullGlCount(NULL_GL_glTexCoordP2ui); }
+static void APIENTRY nullStub_glTexCoordP2uiv(GLenum, const GLuint *) { nullGlCount(NULL_GL_glTexCoordP2uiv); }
+static void APIENTRY nullStub_glTexCoordP3ui(GLenum, GLuint) { nullGlCount(NULL_GL_glTexCoordP3ui); }
+static void APIENTRY nullStub_glTexCoordP3uiv(GLenum, const GLuint *) { nullGlCount(NULL_GL_glTexCoordP3uiv); }
+static void APIENTRY nullStub_glTexCoordP4ui(GLenum, GLuint) { nullGlCount(NULL_GL_glTexCoordP4ui); }
+static void APIENTRY nullStub_glTexCoordP4uiv(GLenum, const GLuint *) { nullGlCount(NULL_GL_glTexCoordP4uiv); }
+static void APIENTRY nullStub_glMultiTexCoordP1ui(GLenum, GLenum, GLuint) { nullGlCount(NULL_GL_glMultiTexCoordP1ui); }
+static void APIENTRY nullStub_glMultiTexCoordP1uiv(GLenum, GLenum, const GLuint *) { nullGlCount(NULL_GL_glMultiTexCoordP1uiv); }
+static void APIENTRY nullStub_glMultiTexCoordP2ui(GLenum, GLenum, GLuint) { nullGlCount(NULL_GL_glMultiTexCoordP2ui); }
+static void APIENTRY nullStub_glMultiTexCoordP2uiv(GLenum, GLenum, const GLuint *) { nullGlCount(NULL_GL_glMultiTexCoordP2uiv); }
+static void APIENTRY nullStub_glMultiTexCoordP3ui(GLenum, GLenum, GLuint) { nullGlCount(NULL_GL_glMultiTexCoordP3ui); }
+static void APIENTRY nullStub_glMultiTexCoordP3uiv(GLenum, GLenum, const GLuint *) { nullGlCount(NULL_GL_glMultiTexCoordP3uiv); }
+static void APIENTRY nullStub_glMultiTexCoordP4ui(GLenum, GLenum, GLuint) { nullGlCount(NULL_GL_glMultiTexCoordP4ui); }
+static void APIENTRY nullStub_glMultiTexCoordP4uiv(GLenum, GLenum, const GLuint *) { nullGlCount(NULL_GL_glMultiTexCoordP4uiv); }
+static void APIENTRY nullStub_glNormalP3ui(GLenum, GLuint) { nullGlCount(NULL_GL_glNormalP3ui); }
+static void APIENTRY nullStub_glNormalP3uiv(GLenum, const GLuint *) { nullGlCount(NULL_GL_glNormalP3uiv); }
+static void APIENTRY nullStub_glColorP3ui(GLenum, GLuint) { nullGlCount(NULL_GL_glColorP3ui); }
+static void APIENTRY nullStub_glColorP3uiv(GLenum, const GLuint *) { nullGlCount(NULL_GL_glColorP3uiv); }
+static void APIENTRY nullStub_glColorP4ui(GLenum, GLuint) { nullGlCount(NULL_GL_glColorP4ui); }
+static void APIENTRY nullStub_glColorP4uiv(GLenum, const GLuint *) { nullGlCount(NULL_GL_glColorP4uiv); }
+static void APIENTRY nullStub_glSecondaryColorP3ui(GLenum, GLuint) { nullGlCount(NULL_GL_glSecondaryColorP3ui); }
+static void APIENTRY nullStub_glSecondaryColorP3uiv(GLenum, const GLuint *) { nullGlCount(NULL_GL_glSecondaryColorP3uiv); }
+
+static void* nullGlStubs[NULL_GL_FUNCTION_COUNT] = {
+    (void*)nullStub_glCullFace,
+    (void*)nullStub_glFrontFace,
+    (void*)nullStub_glHint,
+    (void*)nullStub_glLineWidth,
+    (void*)nullStub_glPointSize,
+    (void*)nullStub_glPolygonMode,
+    (void*)nullStub_glScissor,
+    (void*)nullStub_glTexParameterf,
+    (void*)nullStub_glTexParameterfv,
+    (void*)nullStub_glTexParameteri,
+    (void*)nullStub_glTexParameteriv,
+    (void*)nullStub_glTexImage1D,
+    (void*)nullStub_glTexImage2D,
+    (void*)nullStub_glDrawBuffer,
+    (void*)nullStub_glClear,
+    (void*)nullStub_glClearColor,
+    (void*)nullStub_glClearStencil,
+    (void*)nullStub_glClearDepth,
+    (void*)nullStub_glStencilMask,
+    (void*)nullStub_glColorMask,
+    (void*)nullStub_glDepthMask,
+    (void*)nullStub_glDisable,
+    (void*)nullStub_glEnable,
+    (void*)nullStub_glFinish,
+    (void*)nullStub_glFlush,
+    (void*)nullStub_glBlendFunc,
+    (void*)nullStub_glLogicOp,
+    (void*)nullStub_glStencilFunc,
+    (void*)nullStub_glStencilOp,
+    (void*)nullStub_glDepthFunc,
+    (void*)nullStub_glPixelStoref,
+    (void*)nullStub_glPixelStorei,
+    (void*)nullStub_glReadBuffer,
+    (void*)nullStub_glReadPixels,
+    (void*)nullStub_glGetBooleanv,
+    (void*)nullStub_glGetDoublev,
+    (void*)nullStub_glGetError,
+    (void*)nullStub_glGetFloatv,
+    (void*)nullStub_glGetIntegerv,
+    (void*)nullStub_glGetString,
+    (void*)nullStub_glGetTexImage,
+    (void*)nullStub_glGetTexParameterfv,
+    (void*)nullStub_glGetTexParameteriv,
+    (void*)nullStub_glGetTexLevelParameterfv,
+    (void*)nullStub_glGetTexLevelParameteriv,
+    (void*)nullStub_glIsEnabled,
+    (void*)nullStub_glDepthRange,
+    (void*)nullStub_glViewport,
+    (void*)nullStub_glDrawArrays,
+    (void*)nullStub_glDrawElements,
+    (void*)nullStub_glPolygonOffset,
+    (void*)nullStub_glCopyTexImage1D,
+    (void*)nullStub_glCopyTexImage2D,
+    (void*)nullStub_glCopyTexSubImage1D,
+    (void*)nullStub_glCopyTexSubImage2D,
+    (void*)nullStub_glTexSubImage1D,
+    (void*)nullStub_glTexSubImage2D,
+    (void*)nullStub_glBindTexture,
+    (void*)nullStub_glDeleteTextures,
+    (void*)nullStub_glGenTextures,
+    (void*)nullStub_glIsTexture,
+    (void*)nullStub_glDrawRangeElements,
+    (void*)nullStub_glTexImage3D,
+    (void*)nullStub_glTexSubImage3D,
+    (void*)nullStub_glCopyTexSubImage3D,
+    (void*)nullStub_glActiveTexture,
+    (void*)nullStub_glSampleCoverage,
+    (void*)nullStub_glCompressedTexImage3D,
+    (void*)nullStub_glCompressedTexImage2D,
+    (void*)nullStub_glCompressedTexImage1D,
+    (void*)nullStub_glCompressedTexSubImage3D,
+    (void*)nullStub_glCompressedTexSubImage2D,
+    (void*)nullStub_glCompressedTexSubImage1D,
+    (void*)nullStub_glGetCompressedTexImage,
+    (void*)nullStub_glBlendFuncSeparate,
+    (void*)nullStub_glMultiDrawArrays,
+    (void*)nullStub_glMultiDrawElements,
+    (void*)nullStub_glPointParameterf,
+    (void*)nullStub_glPointParameterfv,
+    (void*)nullStub_glPointParameteri,
+    (void*)nullStub_glPointParameteriv,
+    (void*)nullStub_glBlendColor,
+    (void*)nullStub_glBlendEquation,
+    (void*)nullStub_glGenQueries,
+    (void*)nullStub_glDeleteQueries,
+    (void*)nullStub_glIsQuery,
+    (void*)nullStub_glBeginQuery,
+    (void*)nullStub_glEndQuery,
+    (void*)nullStub_glGetQueryiv,
+    (void*)nullStub_glGetQueryObjectiv,
+    (void*)nullStub_glGetQueryObjectuiv,
+    (void*)nullStub_glBindBuffer,
+    (void*)nullStub_glDeleteBuffers,
+    (void*)nullStub_glGenBuffers,
+    (void*)nullStub_glIsBuffer,
+    (void*)nullStub_glBufferData,
+    (void*)nullStub_glBufferSubData,
+    (void*)nullStub_glGetBufferSubData,
+    (void*)nullStub_glMapBuffer,
+    (void*)nullStub_glUnmapBuffer,
+    (void*)nullStub_glGetBufferParameteriv,
+    (void*)nullStub_glGetBufferPointerv,
+    (void*)nullStub_glBlendEquationSeparate,
+    (void*)nullStub_glDrawBuffers,
+    (void*)nullStub_glStencilOpSeparate,
+    (void*)nullStub_glStencilFuncSeparate,
+    (void*)nullStub_glStencilMaskSeparate,
+    (void*)nullStub_glAttachShader,
+    (void*)nullStub_glBindAttribLocation,
+    (void*)nullStub_glCompileShader,
+    (void*)nullStub_glCreateProgram,
+    (void*)nullStub_glCreateShader,
+    (void*)nullStub_glDeleteProgram,
+    (void*)nullStub_glDeleteShader,
+    (void*)nullStub_glDetachShader,
+    (void*)nullStub_glDisableVertexAttribArray,
+    (void*)nullStub_glEnableVertexAttribArray,
+    (void*)nullStub_glGetActiveAttrib,
+    (void*)nullStub_glGetActiveUniform,
+    (void*)nullStub_glGetAttachedShaders,
+    (void*)nullStub_glGetAttribLocation,
+    (void*)nullStub_glGetProgramiv,
+    (void*)nullStub_glGetProgramInfoLog,
+    (void*)nullStub_glGetShaderiv,
+    (void*)nullStub_glGetShaderInfoLog,
+    (void*)nullStub_glGetShaderSource,
+    (void*)nullStub_glGetUniformLocation,
+    (void*)nullStub_glGetUniformfv,
+    (void*)nullStub_glGetUniformiv,
+    (void*)nullStub_glGetVertexAttribdv,
+    (void*)nullStub_glGetVertexAttribfv,
+    (void*)nullStub_glGetVertexAttribiv,
+    (void*)nullStub_glGetVertexAttribPointerv,
+    (void*)nullStub_glIsProgram,
+    (void*)nullStub_glIsShader,
+    (void*)nullStub_glLinkProgram,
+    (void*)nullStub_glShaderSource,
+    (void*)nullStub_glUseProgram,
+    (void*)nullStub_glUniform1f,
+    (void*)nullStub_glUniform2f,
+    (void*)nullStub_glUniform3f,
+    (void*)nullStub_glUniform4f,
+    (void*)nullStub_glUniform1i,
+    (void*)nullStub_glUniform2i,
+    (void*)nullStub_glUniform3i,
+    (void*)nullStub_glUniform4i,
+    (void*)nullStub_glUniform1fv,
+    (void*)nullStub_glUniform2fv,
+    (void*)nullStub_glUniform3fv,
+    (void*)nullStub_glUniform4fv,
+    (void*)nullStub_glUniform1iv,
+    (void*)nullStub_glUniform2iv,
+    (void*)nullStub_glUniform3iv,
+    (void*)nullStub_glUniform4iv,
+    (void*)nullStub_glUniformMatrix2fv,
+    (void*)nullStub_glUniformMatrix3fv,
+    (void*)nullStub_glUniformMatrix4fv,
+    (void*)nullStub_glValidateProgram,
+    (void*)nullStub_glVertexAttrib1d,
+    (void*)nullStub_glVertexAttrib1dv,
+    (void*)nullStub_glVertexAttrib1f,
+    (void*)nullStub_glVertexAttrib1fv,
+    (void*)nullStub_glVertexAttrib1s,
+    (void*)nullStub_glVertexAttrib1sv,
+    (void*)nullStub_glVertexAttrib2d,
+    (void*)nullStub_glVertexAttrib2dv,
+    (void*)nullStub_glVertexAttrib2f,
+    (void*)nullStub_glVertexAttrib2fv,
+    (void*)nullStub_glVertexAttrib2s,
+    (void*)nullStub_glVertexAttrib2sv,
+    (void*)nullStub_glVertexAttrib3d,
+    (void*)nullStub_glVertexAttrib3dv,
+    (void*)nullStub_glVertexAttrib3f,
+    (void*)nullStub_glVertexAttrib3fv,
+    (void*)nullStub_glVertexAttrib3s,
+    (void*)nullStub_glVertexAttrib3sv,
+    (void*)nullStub_glVertexAttrib4Nbv,
+    (void*)nullStub_glVertexAttrib4Niv,
+    (void*)nullStub_glVertexAttrib4Nsv,
+    (void*)nullStub_glVertexAttrib4Nub,
+    (void*)nullStub_glVertexAttrib4Nubv,
+    (void*)nullStub_glVertexAttrib4Nuiv,
+    (void*)nullStub_glVertexAttrib4Nusv,
+    (void*)nullStub_glVertexAttrib4bv,
+    (void*)nullStub_glVertexAttrib4d,
+    (void*)nullStub_glVertexAttrib4dv,
+    (void*)nullStub_glVertexAttrib4f,
+    (void*)nullStub_glVertexAttrib4fv,
+    (void*)nullStub_glVertexAttrib4iv,
+    (void*)nullStub_glVertexAttrib4s,
+    (void*)nullStub_glVertexAttrib4sv,
+    (void*)nullStub_glVertexAttrib4ubv,
+    (void*)nullStub_glVertexAttrib4uiv,
+    (void*)nullStub_glVertexAttrib4usv,
+    (void*)nullStub_glVertexAttribPointer,
+    (void*)nullStub_glUniformMatrix2x3fv,
+    (void*)nullStub_glUniformMatrix3x2fv,
+    (void*)nullStub_glUniformMatrix2x4fv,
+    (void*)nullStub_glUniformMatrix4x2fv,
+    (void*)nullStub_glUniformMatrix3x4fv,
+    (void*)nullStub_glUniformMatrix4x3fv,
+    (void*)nullStub_glColorMaski,
+    (void*)nullStub_glGetBooleani_v,
+    (void*)nullStub_glGetIntegeri_v,
+    (void*)nullStub_glEnablei,
+    (void*)nullStub_glDisablei,
+    (void*)nullStub_glIsEnabledi,
+    (void*)nullStub_glBeginTransformFeedback,
+    (void*)nullStub_glEndTransformFeedback,
+    (void*)nullStub_glBindBufferRange,
+    (void*)nullStub_glBindBufferBase,
+    (void*)nullStub_glTransformFeedbackVaryings,
+    (void*)nullStub_glGetTransformFeedbackVarying,
+    (void*)nullStub_glClampColor,
+    (void*)nullStub_glBeginConditionalRender,
+    (void*)nullStub_glEndConditionalRender,
+    (void*)nullStub_glVertexAttribIPointer,
+    (void*)nullStub_glGetVertexAttribIiv,
+    (void*)nullStub_glGetVertexAttribIuiv,
+    (void*)nullStub_glVertexAttribI1i,
+    (void*)nullStub_glVertexAttribI2i,
+    (void*)nullStub_glVertexAttribI3i,
+    (void*)nullStub_glVertexAttribI4i,
+    (void*)nullStub_glVertexAttribI1ui,
+    (void*)nullStub_glVertexAttribI2ui,
+    (void*)nullStub_glVertexAttribI3ui,
+    (void*)nullStub_glVertexAttribI4ui,
+    (void*)nullStub_glVertexAttribI1iv,
+    (void*)nullStub_glVertexAttribI2iv,
+    (void*)nullStub_glVertexAttribI3iv,
+    (void*)nullStub_glVertexAttribI4iv,
+    (void*)nullStub_glVertexAttribI1uiv,
+    (void*)nullStub_glVertexAttribI2uiv,
+    (void*)nullStub_glVertexAttribI3uiv,
+    (void*)nullStub_glVertexAttribI4uiv,
+    (void*)nullStub_glVertexAttribI4bv,
+    (void*)nullStub_glVertexAttribI4sv,
+    (void*)nullStub_glVertexAttribI4ubv,
+    (void*)nullStub_glVertexAttribI4usv,
+    (void*)nullStub_glGetUniformuiv,
+    (void*)nullStub_glBindFragDataLocation,
+    (void*)nullStub_glGetFragDataLocation,
+    (void*)nullStub_glUniform1ui,
+    (void*)nullStub_glUniform2ui,
+    (void*)nullStub_glUniform3ui,
+    (void*)nullStub_glUniform4ui,
+    (void*)nullStub_glUniform1uiv,
+    (void*)nullStub_glUniform2uiv,
+    (void*)nullStub_glUniform3uiv,
+    (void*)nullStub_glUniform4uiv,
+    (void*)nullStub_glTexParameterIiv,
+    (void*)nullStub_glTexParameterIuiv,
+    (void*)nullStub_glGetTexParameterIiv,
+    (void*)nullStub_glGetTexParameterIuiv,
+    (void*)nullStub_glClearBufferiv,
+    (void*)nullStub_glClearBufferuiv,
+    (void*)nullStub_glClearBufferfv,
+    (void*)nullStub_glClearBufferfi,
+    (void*)nullStub_glGetStringi,
+    (void*)nullStub_glIsRenderbuffer,
+    (void*)nullStub_glBindRenderbuffer,
+    (void*)nullStub_glDeleteRenderbuffers,
+    (void*)nullStub_glGenRenderbuffers,
+    (void*)nullStub_glRenderbufferStorage,
+    (void*)nullStub_glGetRenderbufferParameteriv,
+    (void*)nullStub_glIsFramebuffer,
+    (void*)nullStub_glBindFramebuffer,
+    (void*)nullStub_glDeleteFramebuffers,
+    (void*)nullStub_glGenFramebuffers,
+    (void*)nullStub_glCheckFramebufferStatus,
+    (void*)nullStub_glFramebufferTexture1D,
+    (void*)nullStub_glFramebufferTexture2D,
+    (void*)nullStub_glFramebufferTexture3D,
+    (void*)nullStub_glFramebufferRenderbuffer,
+    (void*)nullStub_glGetFramebufferAttachmentParameteriv,
+    (void*)nullStub_glGenerateMipmap,
+    (void*)nullStub_glBlitFramebuffer,
+    (void*)nullStub_glRenderbufferStorageMultisample,
+    (void*)nullStub_glFramebufferTextureLayer,
+    (void*)nullStub_glMapBufferRange,
+    (void*)nullStub_glFlushMappedBufferRange,
+    (void*)nullStub_glBindVertexArray,
+    (void*)nullStub_glDeleteVertexArrays,
+    (void*)nullStub_glGenVertexArrays,
+    (void*)nullStub_glIsVertexArray,
+    (void*)nullStub_glDrawArraysInstanced,
+    (void*)nullStub_glDrawElementsInstanced,
+    (void*)nullStub_glTexBuffer,
+    (void*)nullStub_glPrimitiveRestartIndex,
+    (void*)nullStub_glCopyBufferSubData,
+    (void*)nullStub_glGetUniformIndices,
+    (void*)nullStub_glGetActiveUniformsiv,
+    (void*)nullStub_glGetActiveUniformName,
+    (void*)nullStub_glGetUniformBlockIndex,
+    (void*)nullStub_glGetActiveUniformBlockiv,
+    (void*)nullStub_glGetActiveUniformBlockName,
+    (void*)nullStub_glUniformBlockBinding,
+    (void*)nullStub_glDrawElementsBaseVertex,
+    (void*)nullStub_glDrawRangeElementsBaseVertex,
+    (void*)nullStub_glDrawElementsInstancedBaseVertex,
+    (void*)nullStub_glMultiDrawElementsBaseVertex,
+    (void*)nullStub_glProvokingVertex,
+    (void*)nullStub_glFenceSync,
+    (void*)nullStub_glIsSync,
+    (void*)nullStub_glDeleteSync,
+    (void*)nullStub_glClientWaitSync,
+    (void*)nullStub_glWaitSync,
+    (void*)nullStub_glGetInteger64v,
+    (void*)nullStub_glGetSynciv,
+    (void*)nullStub_glGetInteger64i_v,
+    (void*)nullStub_glGetBufferParameteri64v,
+    (void*)nullStub_glFramebufferTexture,
+    (void*)nullStub_glTexImage2DMultisample,
+    (void*)nullStub_glTexImage3DMultisample,
+    (void*)nullStub_glGetMultisamplefv,
+    (void*)nullStub_glSampleMaski,
+    (void*)nullStub_glBindFragDataLocationIndexed,
+    (void*)nullStub_glGetFragDataIndex,
+    (void*)nullStub_glGenSamplers,
+    (void*)nullStub_glDeleteSamplers,
+    (void*)nullStub_glIsSampler,
+    (void*)nullStub_glBindSampler,
+    (void*)nullStub_glSamplerParameteri,
+    (void*)nullStub_glSamplerParameteriv,
+    (void*)nullStub_glSamplerParameterf,
+    (void*)nullStub_glSamplerParameterfv,
+    (void*)nullStub_glSamplerParameterIiv,
+    (void*)nullStub_glSamplerParameterIuiv,
+    (void*)nullStub_glGetSamplerParameteriv,
+    (void*)nullStub_glGetSamplerParameterIiv,
+    (void*)nullStub_glGetSamplerParameterfv,
+    (void*)nullStub_glGetSamplerParameterIuiv,
+    (void*)nullStub_glQueryCounter,
+    (void*)nullStub_glGetQueryObjecti64v,
+    (void*)nullStub_glGetQueryObjectui64v,
+    (void*)nullStub_glVertexAttribDivisor,
+    (void*)nullStub_glVertexAttribP1ui,
+    (void*)nullStub_glVertexAttribP1uiv,
+    (void*)nullStub_glVertexAttribP2ui,
+    (void*)nullStub_glVertexAttribP2uiv,
+    (void*)nullStub_glVertexAttribP3ui,
+    (void*)nullStub_glVertexAttribP3uiv,
+    (void*)nullStub_glVertexAttribP4ui,
+    (void*)nullStub_glVertexAttribP4uiv,
+    (void*)nullStub_glVertexP2ui,
+    (void*)nullStub_glVertexP2uiv,
+    (void*)nullStub_glVertexP3ui,
+    (void*)nullStub_glVertexP3uiv,
+    (void*)nullStub_glVertexP4ui,
+    (void*)nullStub_glVertexP4uiv,
+    (void*)nullStub_glTexCoordP1ui,
+    (void*)nullStub_glTexCoordP1uiv,
+    (void*)nullStub_glTexCoordP2ui,
+    (void*)nullStub_glTexCoordP2uiv,
+    (void*)nullStub_glTexCoordP3ui,
+    (void*)nullStub_glTexCoordP3uiv,
+    (void*)nullStub_glTexCoordP4ui,
+    (void*)nullStub_glTexCoordP4uiv,
+    (void*)nullStub_glMultiTexCoordP1ui,
+    (void*)nullStub_glMultiTexCoordP1uiv,
+    (void*)nullStub_glMultiTexCoordP2ui,
+    (void*)nullStub_glMultiTexCoordP2uiv,
+    (void*)nullStub_glMultiTexCoordP3ui,
+    (void*)nullStub_glMultiTexCoordP3uiv,
+    (void*)nullStub_glMultiTexCoordP4ui,
+    (void*)nullStub_glMultiTexCoordP4uiv,
+    (void*)nullStub_glNormalP3ui,
+    (void*)nullStub_glNormalP3uiv,
+    (void*)nullStub_glColorP3ui,
+    (void*)nullStub_glColorP3uiv,
+    (void*)nullStub_glColorP4ui,
+    (void*)nullStub_glColorP4uiv,
+    (void*)nullStub_glSecondaryColorP3ui,
+    (void*)nullStub_glSecondaryColorP3uiv,
+};
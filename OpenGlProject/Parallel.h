@@ -0,0 +1,14 @@
+#pragma once
+#include "JobSystem.h" // Jobs and counters
+
+// Run func(0..count-1) as jobs; index 0 runs on the caller, which then helps with the rest until all are done.
+// Indices may run one after another on the same worker, so func must not wait for a sibling index.
+template <typename Func>
+void runParallel(unsigned count, Func func)
+{
+    JobCounter counter;
+    for (unsigned i = 1; i < count; i++)
+        runJob([&func, i] { func(i); }, &counter);
+    func(0u);
+    waitForCounter(counter);
+}
@@ -0,0 +1,336 @@
+#include "Profiler.h"
+
+#ifdef ENABLE_PROFILING
+#include <chrono> // Timestamps
+#include <condition_variable> // Waking the flush thread
+#include <cstdint> // Fixed-size fields
+#include <cstdio> // snprintf
+#include <cstring> // strlen, strcmp
+#include <fstream> // Trace output
+#include <iostream> // For outputting errors and messages
+#include <memory> // Thread records
+#include <mutex> // Thread registry
+#include <string> // Output buffer
+#include <thread> // Flush thread
+#include <vector> // Thread registry
+
+static const size_t PROFILE_RING_EVENTS = 1 << 15; // Per thread; must be a power of two
+static const int PROFILE_FLUSH_MS = 20; // How often the flush thread drains the rings
+static const uint64_t PROFILE_TRACK_UUID_BASE = 1000; // Perfetto track uuid = base + thread id
+
+struct ProfileEvent
+{
+    const char* name;
+    uint64_t time; // Nanoseconds since startProfiler
+    bool begin;
+};
+
+// One per thread that ever recorded; the owning thread writes, the flush thread reads
+struct ProfileThread
+{
+    ProfileEvent events[PROFILE_RING_EVENTS];
+    std::atomic<uint64_t> written{ 0 }; // Events ever written (producer)
+    std::atomic<uint64_t> read{ 0 }; // Events ever drained (consumer)
+    std::atomic<const char*> name{ nullptr }; // Track name, NULL for "thread <id>"
+    const char* writtenName = nullptr; // Name the output last saw (flush thread only)
+    bool described = false; // Track metadata written (flush thread only)
+    uint32_t id = 0; // Track / tid in the output
+    size_t dropped = 0; // Events lost to a full ring
+    size_t openScopes = 0; // Recorded begins still waiting for their end (owning thread only)
+};
+
+std::atomic<bool> profilerRunning(false);
+static std::mutex registryMutex; // Guards threads
+static std::vector<std::unique_ptr<ProfileThread>> threads; // Never shrinks; threads keep a pointer to theirs
+static thread_local ProfileThread* localThread = nullptr;
+static std::chrono::steady_clock::time_point profileStart;
+
+static std::ofstream profileFile;
+static bool perfettoOutput = false; // Protobuf instead of JSON
+static bool firstJsonEvent = true; // No comma before the first event
+static bool firstPacket = true; // The first packet clears incremental state
+static std::string profileOutput; // Encoded but not yet written
+static size_t profileEventCount = 0;
+static std::thread flushThread;
+static std::mutex flushMutex; // Guards flushStop
+static std::condition_variable flushWake;
+static bool flushStop = false;
+
+static ProfileThread* currentProfileThread()
+{
+    if (!localThread)
+    {
+        std::unique_ptr<ProfileThread> created(new ProfileThread());
+        std::lock_guard<std::mutex> lock(registryMutex);
+        created->id = (uint32_t)threads.size() + 1;
+        localThread = created.get();
+        threads.push_back(std::move(created));
+    }
+    return localThread;
+}
+
+bool profileEvent(const char* name, bool begin)
+{
+    ProfileThread* thread = currentProfileThread();
+    uint64_t written = thread->written.load(std::memory_order_relaxed);
+    // A begin needs room for itself, its own end and the ends of the scopes already open, so a recorded begin
+    // always gets its end and no slice is left open; an end always fits in the room reserved for it
+    uint64_t needed = begin ? thread->openScopes + 2 : 1;
+    if (written - thread->read.load(std::memory_order_acquire) + needed > PROFILE_RING_EVENTS)
+    {
+        thread->dropped++;
+        return false;
+    }
+    if (begin)
+        thread->openScopes++;
+    else if (thread->openScopes > 0)
+        thread->openScopes--;
+    ProfileEvent& event = thread->events[written & (PROFILE_RING_EVENTS - 1)];
+    event.name = name;
+    event.time = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - profileStart).count();
+    event.begin = begin;
+    thread->written.store(written + 1, std::memory_order_release);
+    return true;
+}
+
+void setProfileThreadName(const char* name)
+{
+    currentProfileThread()->name = name;
+}
+
+// ---------------------------------------------------------------------------
+// Chrome trace-event JSON
+// ---------------------------------------------------------------------------
+
+static void appendJsonString(const char* text)
+{
+    profileOutput += '"';
+    for (const char* c = text; *c; c++)
+    {
+        if (*c == '"' || *c == '\\')
+            profileOutput += '\\';
+        if ((unsigned char)*c >= 0x20)
+            profileOutput += *c;
+    }
+    profileOutput += '"';
+}
+
+static void beginJsonEvent()
+{
+    profileOutput += firstJsonEvent ? "\n" : ",\n";
+    firstJsonEvent = false;
+}
+
+static void writeJsonThreadName(const ProfileThread& thread, const char* name)
+{
+    beginJsonEvent();
+    profileOutput += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(thread.id) + ",\"args\":{\"name\":";
+    appendJsonString(name);
+    profileOutput += "}}";
+}
+
+static void writeJsonEvent(const ProfileThread& thread, const ProfileEvent& event)
+{
+    char timestamp[32];
+    snprintf(timestamp, sizeof(timestamp), "%.3f", event.time / 1000.0); // Microseconds
+    beginJsonEvent();
+    profileOutput += "{\"name\":";
+    appendJsonString(event.name);
+    profileOutput += event.begin ? ",\"ph\":\"B\",\"ts\":" : ",\"ph\":\"E\",\"ts\":";
+    profileOutput += timestamp;
+    profileOutput += ",\"pid\":1,\"tid\":" + std::to_string(thread.id) + "}";
+}
+
+// ---------------------------------------------------------------------------
+// Perfetto protobuf (Trace { repeated TracePacket packet = 1; }), hand-encoded
+// ---------------------------------------------------------------------------
+
+static void appendVarint(std::string& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out += (char)(value | 0x80);
+        value >>= 7;
+    }
+    out += (char)value;
+}
+
+static void appendUintField(std::string& out, int field, uint64_t value)
+{
+    appendVarint(out, (uint64_t)field << 3); // Wire type 0
+    appendVarint(out, value);
+}
+
+static void appendBytesField(std::string& out, int field, const char* data, size_t size)
+{
+    appendVarint(out, ((uint64_t)field << 3) | 2); // Wire type 2
+    appendVarint(out, size);
+    out.append(data, size);
+}
+
+static void writePacket(std::string& packet)
+{
+    appendUintField(packet, 10, 1); // trusted_packet_sequence_id
+    if (firstPacket)
+        appendUintField(packet, 13, 1); // sequence_flags = SEQ_INCREMENTAL_STATE_CLEARED
+    firstPacket = false;
+    appendBytesField(profileOutput, 1, packet.data(), packet.size());
+}
+
+static void writePerfettoThread(const ProfileThread& thread, const char* name)
+{
+    std::string descriptor, threadDescriptor, packet;
+    appendUintField(threadDescriptor, 1, 1); // pid
+    appendUintField(threadDescriptor, 2, thread.id); // tid
+    appendBytesField(threadDescriptor, 5, name, strlen(name)); // thread_name
+    appendUintField(descriptor, 1, PROFILE_TRACK_UUID_BASE + thread.id); // uuid
+    appendBytesField(descriptor, 4, threadDescriptor.data(), threadDescriptor.size()); // thread
+    appendBytesField(packet, 60, descriptor.data(), descriptor.size()); // track_descriptor
+    writePacket(packet);
+}
+
+static void writePerfettoEvent(const ProfileThread& thread, const ProfileEvent& event)
+{
+    std::string trackEvent, packet;
+    appendUintField(trackEvent, 9, event.begin ? 1 : 2); // type = TYPE_SLICE_BEGIN / TYPE_SLICE_END
+    appendUintField(trackEvent, 11, PROFILE_TRACK_UUID_BASE + thread.id); // track_uuid
+    if (event.begin)
+        appendBytesField(trackEvent, 23, event.name, strlen(event.name)); // name
+    appendUintField(packet, 8, event.time); // timestamp
+    appendBytesField(packet, 11, trackEvent.data(), trackEvent.size()); // track_event
+    writePacket(packet);
+}
+
+// ---------------------------------------------------------------------------
+// Draining
+// ---------------------------------------------------------------------------
+
+// Move every recorded event into the output and write it out; flush thread, or the caller once it has stopped
+static void drainProfileThreads()
+{
+    std::vector<ProfileThread*> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (const std::unique_ptr<ProfileThread>& thread : threads)
+            snapshot.push_back(thread.get());
+    }
+
+    for (ProfileThread* thread : snapshot)
+    {
+        uint64_t read = thread->read.load(std::memory_order_relaxed);
+        uint64_t written = thread->written.load(std::memory_order_acquire);
+        const char* name = thread->name.load();
+        if (read == written && (!thread->described || name == thread->writtenName))
+            continue;
+
+        if (!thread->described || name != thread->writtenName)
+        {
+            std::string fallback = "thread " + std::to_string(thread->id);
+            const char* trackName = name ? name : fallback.c_str();
+            if (perfettoOutput)
+                writePerfettoThread(*thread, trackName);
+            else
+                writeJsonThreadName(*thread, trackName);
+            thread->described = true;
+            thread->writtenName = name;
+        }
+
+        for (uint64_t i = read; i < written; i++)
+        {
+            const ProfileEvent& event = thread->events[i & (PROFILE_RING_EVENTS - 1)];
+            if (perfettoOutput)
+                writePerfettoEvent(*thread, event);
+            else
+                writeJsonEvent(*thread, event);
+        }
+        profileEventCount += (size_t)(written - read);
+        thread->read.store(written, std::memory_order_release);
+    }
+
+    profileFile.write(profileOutput.data(), (std::streamsize)profileOutput.size());
+    profileOutput.clear();
+}
+
+static void flushWorker()
+{
+    std::unique_lock<std::mutex> lock(flushMutex);
+    while (!flushStop)
+    {
+        flushWake.wait_for(lock, std::chrono::milliseconds(PROFILE_FLUSH_MS));
+        lock.unlock();
+        drainProfileThreads();
+        lock.lock();
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+bool startProfiler(const char* path)
+{
+    if (profilerRunning)
+        return false;
+    profileFile.open(path, std::ios::binary | std::ios::trunc);
+    if (!profileFile)
+    {
+        std::cout << "Failed to open profile output: " << path << std::endl;
+        return false;
+    }
+
+    size_t length = strlen(path);
+    perfettoOutput = !(length >= 5 && strcmp(path + length - 5, ".json") == 0);
+    firstJsonEvent = true;
+    firstPacket = true;
+    profileEventCount = 0;
+    profileOutput = perfettoOutput ? "" : "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    {
+        // Events left over from an earlier session are discarded, track names are written again
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (const std::unique_ptr<ProfileThread>& thread : threads)
+        {
+            thread->read = thread->written.load();
+            thread->described = false;
+            thread->dropped = 0;
+        }
+    }
+
+    profileStart = std::chrono::steady_clock::now();
+    flushStop = false;
+    flushThread = std::thread(flushWorker);
+    profilerRunning = true;
+    std::cout << "Profiling to " << path << (perfettoOutput ? " (Perfetto)" : " (Chrome trace JSON)") << std::endl;
+    return true;
+}
+
+void stopProfiler()
+{
+    if (!profilerRunning)
+        return;
+    profilerRunning = false;
+    {
+        std::lock_guard<std::mutex> lock(flushMutex);
+        flushStop = true;
+    }
+    flushWake.notify_one();
+    flushThread.join();
+
+    drainProfileThreads();
+    if (!perfettoOutput)
+        profileFile << "\n]}\n";
+    profileFile.close();
+
+    size_t dropped = 0, threadCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        threadCount = threads.size();
+        for (const std::unique_ptr<ProfileThread>& thread : threads)
+            dropped += thread->dropped;
+    }
+    std::cout << "Profiler: " << profileEventCount << " events on " << threadCount << " threads";
+    if (dropped)
+        std::cout << ", " << dropped << " dropped (ring full)";
+    std::cout << std::endl;
+}
+
+#endif
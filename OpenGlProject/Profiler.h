@@ -0,0 +1,58 @@
+#pragma once
+
+// CPU timeline profiler. PROFILE_SCOPE("name") records a begin and an end timestamp into a ring buffer owned by
+// the calling thread; a background thread drains the rings into a Chrome trace (.json, chrome://tracing or
+// ui.perfetto.dev) or a Perfetto protobuf trace (any other extension). Each thread gets its own track, named
+// with PROFILE_THREAD. Names must be string literals or otherwise outlive the profiler.
+// Everything compiles to nothing unless ENABLE_PROFILING is defined (Debug builds define it).
+
+#ifdef ENABLE_PROFILING
+#include <atomic> // Enabled flag checked by every scope
+
+extern std::atomic<bool> profilerRunning; // Scopes record only between startProfiler and stopProfiler
+
+// Record a begin (true) or end (false) event on the calling thread; returns false if the ring was full. A begin is
+// only recorded if the ring also has room for its end, so ends of recorded begins are never dropped.
+bool profileEvent(const char* name, bool begin);
+
+// Name the calling thread's track
+void setProfileThreadName(const char* name);
+
+// Start recording and streaming to path; returns false if the file can't be created
+bool startProfiler(const char* path);
+
+// Stop recording, write out what is left and close the file
+void stopProfiler();
+
+struct ProfileScope
+{
+    const char* name;
+    bool recorded; // The end is only written if the begin was, and then always fits
+
+    explicit ProfileScope(const char* name)
+        : name(name), recorded(profilerRunning.load(std::memory_order_relaxed) && profileEvent(name, true))
+    {
+    }
+    ~ProfileScope()
+    {
+        if (recorded)
+            profileEvent(name, false);
+    }
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+#define PROFILE_THREAD(name) setProfileThreadName(name)
+
+#else
+
+inline bool startProfiler(const char*) { return false; }
+inline void stopProfiler() {}
+
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_FUNCTION() ((void)0)
+#define PROFILE_THREAD(name) ((void)0)
+
+#endif
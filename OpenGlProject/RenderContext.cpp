@@ -0,0 +1,458 @@
+#include "RenderContext.h"
+#include <cstring> // strcmp / strstr
+#include <iostream> // For outputting errors and messages
+
+#ifdef __linux__
+#include <dlfcn.h> // dlopen / dlsym
+#endif
+
+static GLuint currentDefaultFramebuffer = 0; // Framebuffer of the context current on the render thread
+
+bool parseContextBackend(const char* name, ContextBackend& backend)
+{
+    static const ContextBackend backends[] = { CONTEXT_WINDOW, CONTEXT_HIDDEN, CONTEXT_EGL, CONTEXT_OSMESA };
+    for (ContextBackend candidate : backends)
+        if (strcmp(name, contextBackendName(candidate)) == 0)
+        {
+            backend = candidate;
+            return true;
+        }
+    return false;
+}
+
+const char* contextBackendName(ContextBackend backend)
+{
+    switch (backend)
+    {
+    case CONTEXT_WINDOW: return "window";
+    case CONTEXT_HIDDEN: return "hidden";
+    case CONTEXT_EGL: return "egl";
+    case CONTEXT_OSMESA: return "osmesa";
+    }
+    return "unknown";
+}
+
+void setGlContextHints()
+{
+    glfwDefaultWindowHints();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3); // OpenGL version 3.x
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE); // Use core profile
+#ifdef GLAD_DEBUG
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE); // Drivers only promise KHR_debug messages on debug contexts
+#endif
+}
+
+GLuint defaultFramebuffer()
+{
+    return currentDefaultFramebuffer;
+}
+
+#ifdef __linux__
+
+// ---------------------------------------------------------------------------
+// EGL and OSMesa entry points, resolved from the shared libraries at run time
+// ---------------------------------------------------------------------------
+
+typedef void* EGLDisplay;
+typedef void* EGLConfig;
+typedef void* EGLContext;
+typedef void* EGLSurface;
+typedef int EGLint;
+typedef unsigned int EGLBoolean;
+typedef unsigned int EGLenum;
+
+static const EGLint EGL_NONE = 0x3038;
+static const EGLint EGL_EXTENSIONS = 0x3055;
+static const EGLint EGL_SURFACE_TYPE = 0x3033;
+static const EGLint EGL_PBUFFER_BIT = 0x0001;
+static const EGLint EGL_RENDERABLE_TYPE = 0x3040;
+static const EGLint EGL_OPENGL_BIT = 0x0008;
+static const EGLint EGL_RED_SIZE = 0x3024;
+static const EGLint EGL_GREEN_SIZE = 0x3023;
+static const EGLint EGL_BLUE_SIZE = 0x3022;
+static const EGLint EGL_ALPHA_SIZE = 0x3021;
+static const EGLint EGL_DEPTH_SIZE = 0x3025;
+static const EGLint EGL_WIDTH = 0x3057;
+static const EGLint EGL_HEIGHT = 0x3056;
+static const EGLenum EGL_OPENGL_API = 0x30A2;
+static const EGLint EGL_CONTEXT_MAJOR_VERSION = 0x3098;
+static const EGLint EGL_CONTEXT_MINOR_VERSION = 0x30FB;
+static const EGLint EGL_CONTEXT_OPENGL_PROFILE_MASK = 0x30FD;
+static const EGLint EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT = 0x0001;
+static const EGLenum EGL_PLATFORM_SURFACELESS_MESA = 0x31DD;
+
+struct EglFunctions
+{
+    EGLDisplay (*getPlatformDisplayEXT)(EGLenum platform, void* nativeDisplay, const EGLint* attribs);
+    EGLDisplay (*getDisplay)(void* nativeDisplay);
+    EGLBoolean (*initialize)(EGLDisplay display, EGLint* major, EGLint* minor);
+    EGLBoolean (*terminate)(EGLDisplay display);
+    const char* (*queryString)(EGLDisplay display, EGLint name);
+    EGLBoolean (*chooseConfig)(EGLDisplay display, const EGLint* attribs, EGLConfig* configs, EGLint size, EGLint* count);
+    EGLBoolean (*bindAPI)(EGLenum api);
+    EGLContext (*createContext)(EGLDisplay display, EGLConfig config, EGLContext share, const EGLint* attribs);
+    EGLBoolean (*destroyContext)(EGLDisplay display, EGLContext context);
+    EGLSurface (*createPbufferSurface)(EGLDisplay display, EGLConfig config, const EGLint* attribs);
+    EGLBoolean (*destroySurface)(EGLDisplay display, EGLSurface surface);
+    EGLBoolean (*makeCurrent)(EGLDisplay display, EGLSurface draw, EGLSurface read, EGLContext context);
+    EGLBoolean (*swapBuffers)(EGLDisplay display, EGLSurface surface);
+    EGLint (*getError)();
+    void* (*getProcAddress)(const char* name);
+};
+
+typedef void* OSMesaContext;
+
+static const int OSMESA_FORMAT = 0x22;
+static const int OSMESA_DEPTH_BITS = 0x30;
+static const int OSMESA_PROFILE = 0x33;
+static const int OSMESA_CORE_PROFILE = 0x34;
+static const int OSMESA_CONTEXT_MAJOR_VERSION = 0x36;
+static const int OSMESA_CONTEXT_MINOR_VERSION = 0x37;
+
+struct OsmesaFunctions
+{
+    OSMesaContext (*createContextAttribs)(const int* attribs, OSMesaContext share);
+    void (*destroyContext)(OSMesaContext context);
+    GLboolean (*makeCurrent)(OSMesaContext context, void* buffer, GLenum type, GLsizei width, GLsizei height);
+    void* (*getProcAddress)(const char* name);
+};
+
+static EglFunctions egl = {};
+static OsmesaFunctions osmesa = {};
+static void* glLibrary = nullptr; // Core GL entry points EGL does not hand out
+
+// First of the candidate names that loads; nullptr if none does
+static void* openLibrary(const char* const* names, int count)
+{
+    for (int i = 0; i < count; i++)
+        if (void* library = dlopen(names[i], RTLD_NOW | RTLD_LOCAL))
+            return library;
+    return nullptr;
+}
+
+template <typename Function>
+static bool loadSymbol(void* library, const char* name, Function& function)
+{
+    function = (Function)dlsym(library, name);
+    return function != nullptr;
+}
+
+static bool loadEgl()
+{
+    if (egl.initialize)
+        return true;
+    static const char* const names[] = { "libEGL.so.1", "libEGL.so" };
+    void* library = openLibrary(names, 2);
+    if (!library)
+    {
+        std::cout << "EGL context: libEGL not found" << std::endl;
+        return false;
+    }
+    EglFunctions loaded = {};
+    bool complete = loadSymbol(library, "eglGetDisplay", loaded.getDisplay) && loadSymbol(library, "eglInitialize", loaded.initialize)
+                 && loadSymbol(library, "eglTerminate", loaded.terminate) && loadSymbol(library, "eglQueryString", loaded.queryString)
+                 && loadSymbol(library, "eglChooseConfig", loaded.chooseConfig) && loadSymbol(library, "eglBindAPI", loaded.bindAPI)
+                 && loadSymbol(library, "eglCreateContext", loaded.createContext) && loadSymbol(library, "eglDestroyContext", loaded.destroyContext)
+                 && loadSymbol(library, "eglCreatePbufferSurface", loaded.createPbufferSurface)
+                 && loadSymbol(library, "eglDestroySurface", loaded.destroySurface) && loadSymbol(library, "eglMakeCurrent", loaded.makeCurrent)
+                 && loadSymbol(library, "eglSwapBuffers", loaded.swapBuffers) && loadSymbol(library, "eglGetError", loaded.getError)
+                 && loadSymbol(library, "eglGetProcAddress", loaded.getProcAddress);
+    if (!complete)
+    {
+        std::cout << "EGL context: libEGL is missing EGL 1.4 entry points" << std::endl;
+        dlclose(library);
+        return false;
+    }
+    loaded.getPlatformDisplayEXT = (decltype(loaded.getPlatformDisplayEXT))loaded.getProcAddress("eglGetPlatformDisplayEXT");
+    egl = loaded;
+    return true;
+}
+
+static bool loadOsmesa()
+{
+    if (osmesa.createContextAttribs)
+        return true;
+    static const char* const names[] = { "libOSMesa.so.8", "libOSMesa.so.6", "libOSMesa.so" };
+    void* library = openLibrary(names, 3);
+    if (!library)
+    {
+        std::cout << "OSMesa context: libOSMesa not found" << std::endl;
+        return false;
+    }
+    OsmesaFunctions loaded = {};
+    bool complete = loadSymbol(library, "OSMesaCreateContextAttribs", loaded.createContextAttribs)
+                 && loadSymbol(library, "OSMesaDestroyContext", loaded.destroyContext)
+                 && loadSymbol(library, "OSMesaMakeCurrent", loaded.makeCurrent)
+                 && loadSymbol(library, "OSMesaGetProcAddress", loaded.getProcAddress);
+    if (!complete)
+    {
+        std::cout << "OSMesa context: libOSMesa is too old (needs OSMesaCreateContextAttribs)" << std::endl;
+        dlclose(library);
+        return false;
+    }
+    osmesa = loaded;
+    return true;
+}
+
+// glad loaders: extension and core functions through the backend, core ones from libGL if it has none
+static void* eglGlProcAddress(const char* name)
+{
+    if (void* function = egl.getProcAddress(name))
+        return function;
+    if (!glLibrary)
+    {
+        static const char* const names[] = { "libOpenGL.so.0", "libGL.so.1" };
+        glLibrary = openLibrary(names, 2);
+    }
+    return glLibrary ? dlsym(glLibrary, name) : nullptr;
+}
+
+static void* osmesaGlProcAddress(const char* name)
+{
+    return osmesa.getProcAddress(name);
+}
+
+// ---------------------------------------------------------------------------
+// Headless backends
+// ---------------------------------------------------------------------------
+
+static bool createEglContext(RenderContext& context)
+{
+    if (!loadEgl())
+        return false;
+
+    // Mesa's surfaceless platform needs no window system at all; any other EGL gets its default display
+    const char* clientExtensions = egl.queryString(nullptr, EGL_EXTENSIONS); // EGL_NO_DISPLAY: client extensions
+    EGLDisplay display = nullptr;
+    if (egl.getPlatformDisplayEXT && clientExtensions && strstr(clientExtensions, "EGL_MESA_platform_surfaceless"))
+        display = egl.getPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, nullptr, nullptr);
+    if (!display)
+        display = egl.getDisplay(nullptr);
+    EGLint major = 0, minor = 0;
+    if (!display || !egl.initialize(display, &major, &minor))
+    {
+        std::cout << "EGL context: no display (error 0x" << std::hex << egl.getError() << std::dec << ")" << std::endl;
+        return false;
+    }
+    context.eglDisplay = display;
+
+    // Prefer a pbuffer config; without one render to an offscreen framebuffer with no surface at all
+    const EGLint pbufferAttribs[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8, EGL_DEPTH_SIZE, 24, EGL_NONE };
+    const EGLint surfacelessAttribs[] = { EGL_SURFACE_TYPE, 0, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE }; // Any surface type
+    EGLConfig config = nullptr;
+    EGLint configCount = 0;
+    bool pbuffer = egl.chooseConfig(display, pbufferAttribs, &config, 1, &configCount) && configCount > 0;
+    if (!pbuffer && (!egl.chooseConfig(display, surfacelessAttribs, &config, 1, &configCount) || configCount == 0))
+    {
+        std::cout << "EGL context: no desktop OpenGL config" << std::endl;
+        return false;
+    }
+
+    const EGLint contextAttribs[] = { EGL_CONTEXT_MAJOR_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 3, EGL_CONTEXT_OPENGL_PROFILE_MASK,
+        EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT, EGL_NONE };
+    if (!egl.bindAPI(EGL_OPENGL_API) || !(context.eglContext = egl.createContext(display, config, nullptr, contextAttribs)))
+    {
+        std::cout << "EGL context: OpenGL 3.3 core not available (error 0x" << std::hex << egl.getError() << std::dec << ")" << std::endl;
+        return false;
+    }
+    if (pbuffer)
+    {
+        const EGLint surfaceAttribs[] = { EGL_WIDTH, context.width, EGL_HEIGHT, context.height, EGL_NONE };
+        context.eglSurface = egl.createPbufferSurface(display, config, surfaceAttribs); // nullptr: surfaceless after all
+    }
+    if (!egl.makeCurrent(display, context.eglSurface, context.eglSurface, context.eglContext))
+    {
+        std::cout << "EGL context: eglMakeCurrent failed (error 0x" << std::hex << egl.getError() << std::dec << ")" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static bool createOsmesaContext(RenderContext& context)
+{
+    if (!loadOsmesa())
+        return false;
+    const int attribs[] = { OSMESA_FORMAT, GL_RGBA, OSMESA_DEPTH_BITS, 24, OSMESA_PROFILE, OSMESA_CORE_PROFILE,
+        OSMESA_CONTEXT_MAJOR_VERSION, 3, OSMESA_CONTEXT_MINOR_VERSION, 3, 0 };
+    context.osmesaContext = osmesa.createContextAttribs(attribs, nullptr);
+    if (!context.osmesaContext)
+    {
+        std::cout << "OSMesa context: OpenGL 3.3 core not available" << std::endl;
+        return false;
+    }
+    context.osmesaBuffer.resize((size_t)context.width * context.height * 4);
+    if (!osmesa.makeCurrent(context.osmesaContext, context.osmesaBuffer.data(), GL_UNSIGNED_BYTE, context.width, context.height))
+    {
+        std::cout << "OSMesa context: OSMesaMakeCurrent failed" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+#endif
+
+// Surfaceless EGL has no framebuffer 0 to draw into; this one takes its place
+static bool createOffscreenFramebuffer(RenderContext& context)
+{
+    glGenRenderbuffers(2, context.renderbuffers);
+    glBindRenderbuffer(GL_RENDERBUFFER, context.renderbuffers[0]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, context.width, context.height);
+    glBindRenderbuffer(GL_RENDERBUFFER, context.renderbuffers[1]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, context.width, context.height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &context.framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, context.framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, context.renderbuffers[0]);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, context.renderbuffers[1]);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        std::cout << "EGL context: offscreen framebuffer is incomplete" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+bool createRenderContext(RenderContext& context, ContextBackend backend, GLFWwindow* window, int width, int height)
+{
+    context.backend = backend;
+    context.window = window;
+    context.width = width;
+    context.height = height;
+
+    GLADloadproc loader = (GLADloadproc)glfwGetProcAddress;
+    if (!isHeadlessBackend(backend))
+        glfwMakeContextCurrent(window);
+    else
+    {
+#ifdef __linux__
+        bool created = backend == CONTEXT_EGL ? createEglContext(context) : createOsmesaContext(context);
+        if (!created)
+        {
+            destroyRenderContext(context);
+            return false;
+        }
+        loader = backend == CONTEXT_EGL ? (GLADloadproc)eglGlProcAddress : (GLADloadproc)osmesaGlProcAddress;
+#else
+        std::cout << contextBackendName(backend) << " context: only available on Linux" << std::endl;
+        return false;
+#endif
+    }
+
+    context.loader = loader;
+    if (!gladLoadGLLoader(loader) || !gladLoadGLContext(&context.gl, loader))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        destroyRenderContext(context);
+        return false;
+    }
+    if (backend == CONTEXT_EGL && !context.eglSurface && !createOffscreenFramebuffer(context))
+    {
+        destroyRenderContext(context);
+        return false;
+    }
+    gladSetGLContext(&context.gl);
+    currentDefaultFramebuffer = context.framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, currentDefaultFramebuffer);
+    return true;
+}
+
+void makeRenderContextCurrent(RenderContext& context)
+{
+    switch (context.backend)
+    {
+    case CONTEXT_WINDOW:
+    case CONTEXT_HIDDEN:
+        glfwMakeContextCurrent(context.window);
+        break;
+#ifdef __linux__
+    case CONTEXT_EGL:
+        egl.makeCurrent(context.eglDisplay, context.eglSurface, context.eglSurface, context.eglContext);
+        break;
+    case CONTEXT_OSMESA:
+        osmesa.makeCurrent(context.osmesaContext, context.osmesaBuffer.data(), GL_UNSIGNED_BYTE, context.width, context.height);
+        break;
+#else
+    default:
+        break;
+#endif
+    }
+    gladSetGLContext(&context.gl);
+    currentDefaultFramebuffer = context.framebuffer;
+}
+
+void releaseRenderContext(RenderContext& context)
+{
+    switch (context.backend)
+    {
+    case CONTEXT_WINDOW:
+    case CONTEXT_HIDDEN:
+        glfwMakeContextCurrent(NULL);
+        break;
+#ifdef __linux__
+    case CONTEXT_EGL:
+        if (context.eglDisplay)
+            egl.makeCurrent(context.eglDisplay, nullptr, nullptr, nullptr);
+        break;
+    case CONTEXT_OSMESA:
+        if (osmesa.makeCurrent)
+            osmesa.makeCurrent(nullptr, nullptr, 0, 0, 0);
+        break;
+#else
+    default:
+        break;
+#endif
+    }
+    gladSetGLContext(NULL);
+    currentDefaultFramebuffer = 0;
+}
+
+void swapRenderContext(RenderContext& context)
+{
+#ifdef __linux__
+    if (context.backend == CONTEXT_EGL && context.eglSurface)
+    {
+        egl.swapBuffers(context.eglDisplay, context.eglSurface);
+        return;
+    }
+#endif
+    if (isHeadlessBackend(context.backend))
+        glFinish(); // Nothing to present; the frame is complete in the buffer
+    else
+        glfwSwapBuffers(context.window);
+}
+
+void destroyRenderContext(RenderContext& context)
+{
+    if (context.framebuffer)
+    {
+        glDeleteFramebuffers(1, &context.framebuffer);
+        glDeleteRenderbuffers(2, context.renderbuffers);
+        context.framebuffer = 0;
+    }
+#ifdef __linux__
+    if (context.eglDisplay)
+    {
+        egl.makeCurrent(context.eglDisplay, nullptr, nullptr, nullptr);
+        if (context.eglSurface)
+            egl.destroySurface(context.eglDisplay, context.eglSurface);
+        if (context.eglContext)
+            egl.destroyContext(context.eglDisplay, context.eglContext);
+        egl.terminate(context.eglDisplay);
+    }
+    if (context.osmesaContext)
+        osmesa.destroyContext(context.osmesaContext);
+#endif
+    context.eglDisplay = context.eglContext = context.eglSurface = nullptr;
+    context.osmesaContext = nullptr;
+    context.osmesaBuffer.clear();
+    if (gladGetGLContext() == &context.gl)
+        gladSetGLContext(NULL);
+    currentDefaultFramebuffer = 0;
+}
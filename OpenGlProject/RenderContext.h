@@ -0,0 +1,69 @@
+#pragma once
+#include <glad/glad.h> // Must precede GLFW
+#include <GLFW/glfw3.h> // Window backends
+#include <vector> // OSMesa color buffer
+
+// Where the GL context comes from. The GLFW backends need a display (an X server, Wayland or Xvfb on Linux);
+// EGL and OSMesa do not, so CI and render farms can run the real renderer without one. EGL uses Mesa's surfaceless
+// platform with a pbuffer, or no surface at all plus an offscreen framebuffer if pbuffers are not offered. OSMesa
+// renders into a buffer in client memory. libEGL and libOSMesa are loaded at run time, so neither is a build
+// dependency; both are Linux only. Headless backends still open a GLFW window on the null platform for input and
+// timing, like the null driver.
+enum ContextBackend
+{
+    CONTEXT_WINDOW, // Visible GLFW window (default)
+    CONTEXT_HIDDEN, // Invisible GLFW window; offscreen, but still needs a display
+    CONTEXT_EGL, // EGL, surfaceless platform
+    CONTEXT_OSMESA // OSMesa, client memory buffer
+};
+
+struct RenderContext
+{
+    ContextBackend backend = CONTEXT_WINDOW;
+    GLFWwindow* window = nullptr; // The context for the GLFW backends; input and timing only for the others
+    GLADloadproc loader = nullptr; // The getProcAddress glad was loaded through
+    GladGLContext gl = {}; // This context's GL function table, selected while it is current
+    int width = 0, height = 0; // Framebuffer size of the headless backends
+    void* eglDisplay = nullptr; // EGLDisplay
+    void* eglContext = nullptr; // EGLContext
+    void* eglSurface = nullptr; // EGLSurface; nullptr when rendering to the offscreen framebuffer
+    void* osmesaContext = nullptr; // OSMesaContext
+    std::vector<unsigned char> osmesaBuffer; // RGBA8 color buffer OSMesa renders into
+    GLuint framebuffer = 0; // Offscreen framebuffer standing in for the default one (surfaceless EGL)
+    GLuint renderbuffers[2] = {}; // Its color and depth storage
+};
+
+// "window", "hidden", "egl" or "osmesa"; false if unknown
+bool parseContextBackend(const char* name, ContextBackend& backend);
+const char* contextBackendName(ContextBackend backend);
+
+// EGL and OSMesa: no GLFW context, so nothing can share with it (background upload and shader reload contexts)
+inline bool isHeadlessBackend(ContextBackend backend)
+{
+    return backend == CONTEXT_EGL || backend == CONTEXT_OSMESA;
+}
+
+// Reset GLFW's window hints to what every GL context of the app uses: 3.3 core, and a debug context under
+// GLAD_DEBUG. The main window and the hidden upload and shader reload windows all go through here.
+void setGlContextHints();
+
+// Create the context on window (GLFW backends, window created with a GL context) or next to it (headless
+// backends, window created with GLFW_NO_API), make it current and load glad through the backend's
+// getProcAddress, both the global pointers and the context's own table. width and height size the headless
+// framebuffer.
+bool createRenderContext(RenderContext& context, ContextBackend backend, GLFWwindow* window, int width, int height);
+
+// Make the context current on the calling thread, or release it from the calling thread. Also selects its
+// function table for the thread (see GladGLContext in glad.h).
+void makeRenderContextCurrent(RenderContext& context);
+void releaseRenderContext(RenderContext& context);
+
+// Present the frame: swaps a window or pbuffer; the other headless targets only need the frame finished
+void swapRenderContext(RenderContext& context);
+
+// Delete the offscreen framebuffer and the context; the window stays with the caller
+void destroyRenderContext(RenderContext& context);
+
+// What binding "framebuffer 0" means for the current render context: 0, or the offscreen framebuffer of a
+// surfaceless EGL context. Use it wherever the window's framebuffer is bound.
+GLuint defaultFramebuffer();
@@ -0,0 +1,235 @@
+#include "RenderTargets.h"
+#include "RenderContext.h" // defaultFramebuffer
+#include <algorithm> // std::max
+#include <atomic> // Pending size, written by the event thread
+#include <cstdint> // uint64_t
+#include <iostream> // For outputting errors and messages
+#include <memory> // std::unique_ptr
+#include <glm/gtc/matrix_transform.hpp> // glm::perspective
+
+// A texture owned by the pool, either lent to a target or free
+struct PooledAttachment
+{
+    unsigned int texture = 0; // GL texture name
+    AttachmentFormat format = ATTACHMENT_RGBA8; // Internal format
+    int width = 0; // Size class
+    int height = 0;
+    bool inUse = false; // Lent to a target
+    int idleFrames = 0; // Frames since it was returned
+};
+
+static RenderView view; // Current view
+static std::atomic<uint64_t> pendingSize{ 0 }; // Latest size from the callback, width << 32 | height
+static bool projectionDirty = true; // Projection parameters changed
+static std::vector<std::unique_ptr<RenderTarget>> targets; // Every registered target
+static std::vector<PooledAttachment> attachmentPool; // Textures shared by all targets
+static size_t textureAllocations = 0, textureReuses = 0, projectionUpdates = 0; // Statistics
+
+void resizeRenderView(int width, int height)
+{
+    pendingSize.store((uint64_t)(uint32_t)width << 32 | (uint32_t)height, std::memory_order_relaxed);
+}
+
+const RenderView& updateRenderView()
+{
+    // Minimized windows report 0x0; keep the last usable size
+    uint64_t pending = pendingSize.load(std::memory_order_relaxed);
+    int pendingWidth = (int)(pending >> 32), pendingHeight = (int)(uint32_t)pending;
+    bool resized = pendingWidth > 0 && pendingHeight > 0 && (pendingWidth != view.width || pendingHeight != view.height);
+    if (resized)
+    {
+        view.width = pendingWidth;
+        view.height = pendingHeight;
+        view.aspect = (float)view.width / view.height;
+        view.generation++;
+        glViewport(0, 0, view.width, view.height);
+    }
+    if (resized || projectionDirty)
+    {
+        view.projection = glm::perspective(glm::radians(view.fovDegrees), view.aspect, view.nearPlane, view.farPlane);
+        projectionDirty = false;
+        projectionUpdates++;
+    }
+    return view;
+}
+
+const RenderView& currentRenderView()
+{
+    return view;
+}
+
+void setRenderViewProjection(float fovDegrees, float nearPlane, float farPlane)
+{
+    view.fovDegrees = fovDegrees;
+    view.nearPlane = nearPlane;
+    view.farPlane = farPlane;
+    projectionDirty = true;
+}
+
+RenderTarget* createRenderTarget(const char* name, const std::vector<AttachmentFormat>& formats, float scale)
+{
+    targets.emplace_back(new RenderTarget());
+    RenderTarget* target = targets.back().get();
+    target->name = name;
+    target->formats = formats;
+    target->scale = scale;
+    return target;
+}
+
+static int sizeClass(int size)
+{
+    return (size + RENDER_TARGET_SIZE_CLASS - 1) / RENDER_TARGET_SIZE_CLASS * RENDER_TARGET_SIZE_CLASS;
+}
+
+// Borrow a free texture of the exact format and size class, or create one
+static unsigned int acquireAttachment(AttachmentFormat format, int width, int height)
+{
+    for (PooledAttachment& entry : attachmentPool)
+        if (!entry.inUse && entry.format == format && entry.width == width && entry.height == height)
+        {
+            entry.inUse = true;
+            textureReuses++;
+            return entry.texture;
+        }
+
+    PooledAttachment entry;
+    entry.format = format;
+    entry.width = width;
+    entry.height = height;
+    entry.inUse = true;
+    glGenTextures(1, &entry.texture);
+    glBindTexture(GL_TEXTURE_2D, entry.texture);
+    if (format == ATTACHMENT_DEPTH24)
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+    else if (format == ATTACHMENT_RGBA16F)
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, width, height, 0, GL_RGBA, GL_HALF_FLOAT, NULL);
+    else
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    attachmentPool.push_back(entry);
+    textureAllocations++;
+    return entry.texture;
+}
+
+static void releaseAttachment(unsigned int texture)
+{
+    for (PooledAttachment& entry : attachmentPool)
+        if (entry.texture == texture)
+        {
+            entry.inUse = false;
+            entry.idleFrames = 0;
+        }
+}
+
+// Size the target for the current view; textures only change when the size class does
+static void resizeRenderTarget(RenderTarget* target)
+{
+    target->generation = view.generation;
+    int width = std::max(1, (int)(view.width * target->scale + 0.5f));
+    int height = std::max(1, (int)(view.height * target->scale + 0.5f));
+    target->width = width;
+    target->height = height;
+
+    int classWidth = sizeClass(width), classHeight = sizeClass(height);
+    if (classWidth != target->allocatedWidth || classHeight != target->allocatedHeight)
+    {
+        for (unsigned int texture : target->textures)
+            releaseAttachment(texture);
+        target->textures.clear();
+        for (AttachmentFormat format : target->formats)
+            target->textures.push_back(acquireAttachment(format, classWidth, classHeight));
+        target->allocatedWidth = classWidth;
+        target->allocatedHeight = classHeight;
+
+        if (!target->framebuffer)
+            glGenFramebuffers(1, &target->framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+        std::vector<GLenum> drawBuffers;
+        for (size_t i = 0; i < target->formats.size(); i++)
+        {
+            if (target->formats[i] == ATTACHMENT_DEPTH24)
+                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, target->textures[i], 0);
+            else
+            {
+                GLenum attachment = GL_COLOR_ATTACHMENT0 + (GLenum)drawBuffers.size();
+                glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, target->textures[i], 0);
+                drawBuffers.push_back(attachment);
+            }
+        }
+        if (drawBuffers.empty())
+            glDrawBuffer(GL_NONE); // Depth-only target
+        else
+            glDrawBuffers((GLsizei)drawBuffers.size(), drawBuffers.data());
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            std::cout << "Render target " << target->name << " is incomplete at " << classWidth << "x" << classHeight << std::endl;
+    }
+    target->uvScale = glm::vec2((float)width / classWidth, (float)height / classHeight);
+}
+
+void setRenderTargetScale(RenderTarget* target, float scale)
+{
+    if (target->scale == scale)
+        return;
+    target->scale = scale;
+    target->generation = ~0u; // Re-evaluate the size on the next use
+}
+
+void updateRenderTarget(RenderTarget* target)
+{
+    if (target->generation != view.generation)
+        resizeRenderTarget(target);
+}
+
+void bindRenderTarget(RenderTarget* target)
+{
+    if (!target)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, defaultFramebuffer());
+        glViewport(0, 0, view.width, view.height);
+        return;
+    }
+    if (target->generation != view.generation)
+        resizeRenderTarget(target); // Binds the framebuffer itself
+    glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+    glViewport(0, 0, target->width, target->height); // Only the used corner of the size class
+}
+
+void endRenderTargetFrame()
+{
+    for (size_t i = 0; i < attachmentPool.size();)
+    {
+        PooledAttachment& entry = attachmentPool[i];
+        if (!entry.inUse && ++entry.idleFrames > RENDER_TARGET_POOL_FRAMES)
+        {
+            glDeleteTextures(1, &entry.texture);
+            attachmentPool.erase(attachmentPool.begin() + i);
+        }
+        else
+            i++;
+    }
+}
+
+void printRenderTargetStats()
+{
+    size_t bytes = 0;
+    for (const PooledAttachment& entry : attachmentPool)
+        bytes += (size_t)entry.width * entry.height * (entry.format == ATTACHMENT_RGBA16F ? 8 : 4);
+    std::cout << "Render targets: " << targets.size() << " targets, " << attachmentPool.size() << " pooled textures ("
+              << bytes / (1024.0 * 1024.0) << " MB), " << textureAllocations << " allocations, " << textureReuses
+              << " reuses, " << projectionUpdates << " projection updates" << std::endl;
+}
+
+void releaseRenderTargets()
+{
+    for (std::unique_ptr<RenderTarget>& target : targets)
+        if (target->framebuffer)
+            glDeleteFramebuffers(1, &target->framebuffer);
+    targets.clear();
+    for (PooledAttachment& entry : attachmentPool)
+        glDeleteTextures(1, &entry.texture);
+    attachmentPool.clear();
+}
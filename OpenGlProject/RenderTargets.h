@@ -0,0 +1,82 @@
+#pragma once
+#include <glad/glad.h> // GL types
+#include <string> // Target names
+#include <vector> // Attachment lists
+#include <glm/glm.hpp> // Projection matrix
+
+// Framebuffer size and everything derived from it; passes read this instead of the window constants
+struct RenderView
+{
+    int width = 1; // Framebuffer width in pixels
+    int height = 1; // Framebuffer height in pixels
+    float aspect = 1.0f; // width / height
+    float fovDegrees = 45.0f; // Vertical field of view
+    float nearPlane = 0.1f; // Near clip distance
+    float farPlane = 100.0f; // Far clip distance
+    glm::mat4 projection = glm::mat4(1.0f); // Recomputed only when the size changes
+    unsigned int generation = 0; // Bumped on every size change; targets compare against it
+};
+
+// Formats an offscreen attachment can have
+enum AttachmentFormat
+{
+    ATTACHMENT_RGBA8, // Color, 8 bits per channel
+    ATTACHMENT_RGBA16F, // HDR color
+    ATTACHMENT_DEPTH24 // Depth only
+};
+
+// An offscreen target that follows the framebuffer size (times scale)
+struct RenderTarget
+{
+    std::string name; // For statistics output
+    std::vector<AttachmentFormat> formats; // Color attachments in order, then at most one depth
+    float scale = 1.0f; // Size relative to the view
+    unsigned int framebuffer = 0; // GL framebuffer object
+    std::vector<unsigned int> textures; // One texture per format, borrowed from the pool
+    int width = 0; // Rendered area in pixels
+    int height = 0;
+    int allocatedWidth = 0; // Size class of the textures (>= width/height)
+    int allocatedHeight = 0;
+    glm::vec2 uvScale = glm::vec2(1.0f); // width / allocatedWidth; multiply UVs by this when sampling
+    unsigned int generation = ~0u; // View generation the attachments were sized for
+};
+
+// Size classes are multiples of this many pixels, so drag-resizing mostly reuses textures
+const int RENDER_TARGET_SIZE_CLASS = 128;
+
+// Frames an unused pooled texture is kept before it is deleted
+const int RENDER_TARGET_POOL_FRAMES = 120;
+
+// Framebuffer size callback: only records the new size (no GL work, no matrix math); safe from the event
+// thread while another thread renders
+void resizeRenderView(int width, int height);
+
+// Once per frame before drawing: applies a pending resize (projection, viewport, generation)
+const RenderView& updateRenderView();
+
+// The view as of the last updateRenderView
+const RenderView& currentRenderView();
+
+// Set the projection parameters; takes effect on the next updateRenderView
+void setRenderViewProjection(float fovDegrees, float nearPlane, float farPlane);
+
+// Register an offscreen target; attachments are allocated lazily by bindRenderTarget
+RenderTarget* createRenderTarget(const char* name, const std::vector<AttachmentFormat>& formats, float scale);
+
+// Change a target's size relative to the view; reallocates lazily, and only if the size class changes
+void setRenderTargetScale(RenderTarget* target, float scale);
+
+// Bring a target's attachments up to date without binding it (for passes that bind it some other way)
+void updateRenderTarget(RenderTarget* target);
+
+// Bind a target (nullptr = default framebuffer) and set the viewport; reallocates only if the view size changed
+void bindRenderTarget(RenderTarget* target);
+
+// Once per frame after rendering: ages and trims the texture pool
+void endRenderTargetFrame();
+
+// Print allocation / reuse counts
+void printRenderTargetStats();
+
+// Delete every target and pooled texture (render context current)
+void releaseRenderTargets();
@@ -0,0 +1,324 @@
+#include "ResourceLoader.h"
+#include "FrameAllocator.h" // Resource pool
+#include "Profiler.h" // Worker tracks
+#include "RenderContext.h" // setGlContextHints
+#include "WorkQueue.h" // Queues between the pipeline stages
+#include <iostream> // For outputting errors and messages
+#include <mutex> // Queue and resource list locks
+#include <thread> // Worker threads
+#include <vector> // Thread and resource lists
+
+// ---------------------------------------------------------------------------
+// Loader state
+// ---------------------------------------------------------------------------
+
+static GLFWwindow* uploadWindow = nullptr; // Hidden window owning the shared upload context
+static GladGLContext uploadGl; // Its GL function table
+static std::vector<std::thread> loaderThreads; // I/O, decode and upload threads
+static WorkQueue<MeshResource*> ioQueue; // Requested resources
+static WorkQueue<MeshResource*> decodeQueue; // Mapped resources
+static WorkQueue<MeshResource*> uploadQueue; // Decoded resources
+static std::mutex resourceMutex; // Guards allResources and fencedResources
+static ObjectPool resourcePool; // Storage of every resource
+static std::vector<MeshResource*> allResources; // Every live resource
+static std::vector<MeshResource*> fencedResources; // Uploaded, waiting for their fence
+
+void setMeshVertexLayout()
+{
+    // Position attribute
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, MESH_VERTEX_FLOATS * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    // Color attribute
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, MESH_VERTEX_FLOATS * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+}
+
+glm::mat4 meshFitMatrix(const MeshResource& resource)
+{
+    glm::vec3 extent = resource.boundsMax - resource.boundsMin;
+    float size = glm::max(extent.x, glm::max(extent.y, extent.z));
+    glm::mat4 fit = glm::mat4(1.0f);
+    fit[0][0] = fit[1][1] = fit[2][2] = size > 0.0f ? 1.0f / size : 1.0f; // Uniform scale
+    fit[3] = glm::vec4(-(resource.boundsMin + resource.boundsMax) * 0.5f * fit[0][0], 1.0f); // Then center
+    return fit;
+}
+
+// Page the whole mapping in so decode workers never block on the disk
+static void touchPages(const char* data, size_t size)
+{
+    volatile char sink = 0;
+    for (size_t offset = 0; offset < size; offset += 4096)
+        sink = sink + data[offset];
+}
+
+static MeshResource* addResource(const char* path)
+{
+    std::lock_guard<std::mutex> lock(resourceMutex);
+    if (resourcePool.blockSize == 0)
+        initPool(resourcePool, sizeof(MeshResource), alignof(MeshResource), 64);
+    MeshResource* resource = poolNew<MeshResource>(resourcePool);
+    allResources.push_back(resource);
+    resource->path = path;
+    return resource;
+}
+
+static void failResource(MeshResource* resource)
+{
+    std::cout << "Failed to stream " << resource->path << std::endl;
+    unmapFile(resource->file);
+    closeMeshCache(resource->cache);
+    resource->mesh = MeshData();
+    resource->state = RESOURCE_FAILED;
+}
+
+// ---------------------------------------------------------------------------
+// Pipeline stages
+// ---------------------------------------------------------------------------
+
+static void ioWorker()
+{
+    PROFILE_THREAD("mesh io");
+    MeshResource* resource;
+    while (popWork(ioQueue, resource))
+    {
+        PROFILE_SCOPE("read mesh");
+        resource->state = RESOURCE_READING;
+        bool ok;
+        if (isMeshCacheFile(resource->path.c_str()))
+        {
+            ok = openMeshCache(resource->path.c_str(), resource->cache);
+            if (ok)
+                touchPages(resource->cache.file.data, resource->cache.file.size);
+        }
+        else
+        {
+            ok = mapFile(resource->path.c_str(), resource->file);
+            if (ok)
+                touchPages(resource->file.data, resource->file.size);
+        }
+
+        if (ok)
+            pushWork(decodeQueue, resource);
+        else
+            failResource(resource);
+    }
+}
+
+static void decodeWorker()
+{
+    PROFILE_THREAD("mesh decode");
+    MeshResource* resource;
+    while (popWork(decodeQueue, resource))
+    {
+        PROFILE_SCOPE("decode mesh");
+        resource->state = RESOURCE_DECODING;
+        if (resource->cache.header)
+        {
+            // Caches need no decoding, only the header values
+            resource->boundsMin = glm::vec3(resource->cache.header->boundsMin[0], resource->cache.header->boundsMin[1], resource->cache.header->boundsMin[2]);
+            resource->boundsMax = glm::vec3(resource->cache.header->boundsMax[0], resource->cache.header->boundsMax[1], resource->cache.header->boundsMax[2]);
+            resource->drawCount = resource->cache.lods[0].indexCount;
+        }
+        else
+        {
+            bool ok = parseMesh(resource->path.c_str(), resource->file.data, resource->file.size, resource->mesh);
+            unmapFile(resource->file);
+            if (!ok)
+            {
+                failResource(resource);
+                continue;
+            }
+            resource->boundsMin = resource->mesh.boundsMin;
+            resource->boundsMax = resource->mesh.boundsMax;
+            resource->drawCount = meshDrawCount(resource->mesh);
+        }
+        resource->state = RESOURCE_UPLOADING;
+        pushWork(uploadQueue, resource);
+    }
+}
+
+// Create the buffers of resource on the current context; VAOs are not shared, so they are made later
+static void uploadBuffers(MeshResource* resource)
+{
+    glGenBuffers(1, &resource->VBO);
+    if (resource->cache.header || !resource->mesh.indices.empty())
+        glGenBuffers(1, &resource->EBO);
+
+    if (resource->cache.header)
+    {
+        uploadMeshCache(resource->cache, resource->VBO, resource->EBO);
+        closeMeshCache(resource->cache);
+    }
+    else
+    {
+        // GL_COPY_WRITE_BUFFER avoids touching VAO state on the upload context
+        glBindBuffer(GL_COPY_WRITE_BUFFER, resource->VBO);
+        glBufferData(GL_COPY_WRITE_BUFFER, resource->mesh.vertices.size() * sizeof(float), resource->mesh.vertices.data(), GL_STATIC_DRAW);
+        if (resource->EBO)
+        {
+            glBindBuffer(GL_COPY_WRITE_BUFFER, resource->EBO);
+            glBufferData(GL_COPY_WRITE_BUFFER, resource->mesh.indices.size() * sizeof(unsigned int), resource->mesh.indices.data(), GL_STATIC_DRAW);
+        }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        resource->mesh = MeshData(); // Free the CPU copy
+    }
+}
+
+static void uploadWorker()
+{
+    glfwMakeContextCurrent(uploadWindow); // The shared context lives on this thread from now on
+    gladSetGLContext(&uploadGl);
+    PROFILE_THREAD("mesh upload");
+
+    MeshResource* resource;
+    while (popWork(uploadQueue, resource))
+    {
+        PROFILE_SCOPE("upload mesh");
+        uploadBuffers(resource);
+        resource->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush(); // Make sure the fence reaches the GPU so the render thread can see it signal
+
+        std::lock_guard<std::mutex> lock(resourceMutex);
+        resource->state = RESOURCE_FENCED;
+        fencedResources.push_back(resource);
+    }
+
+    gladSetGLContext(NULL);
+    glfwMakeContextCurrent(NULL); // Release the context before the window is destroyed
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+MeshResource* createMeshResource(const MeshData& mesh)
+{
+    MeshResource* resource = addResource("<memory>");
+    resource->boundsMin = mesh.boundsMin;
+    resource->boundsMax = mesh.boundsMax;
+    resource->drawCount = meshDrawCount(mesh);
+
+    glGenVertexArrays(1, &resource->VAO);
+    glGenBuffers(1, &resource->VBO);
+    glBindVertexArray(resource->VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, resource->VBO);
+    glBufferData(GL_ARRAY_BUFFER, mesh.vertices.size() * sizeof(float), mesh.vertices.data(), GL_STATIC_DRAW);
+    if (!mesh.indices.empty())
+    {
+        glGenBuffers(1, &resource->EBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, resource->EBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(unsigned int), mesh.indices.data(), GL_STATIC_DRAW);
+    }
+    setMeshVertexLayout();
+    glBindVertexArray(0);
+
+    resource->state = RESOURCE_READY;
+    return resource;
+}
+
+bool startResourceLoader(GLFWwindow* window, int ioThreads, int decodeThreads)
+{
+    // A hidden 1x1 window is the portable way to get a second context sharing window's objects
+    setGlContextHints(); // Same version, profile and debug flag as the main context
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    uploadWindow = glfwCreateWindow(1, 1, "Upload", NULL, window);
+    setGlContextHints();
+    if (uploadWindow == NULL)
+    {
+        std::cout << "Failed to create upload context" << std::endl;
+        return false;
+    }
+    glfwMakeContextCurrent(uploadWindow); // Load its function table before any thread renders with it
+    gladLoadGLContext(&uploadGl, (GLADloadproc)glfwGetProcAddress);
+    glfwMakeContextCurrent(window); // Creating a window can change the current context
+
+    reopenWork(ioQueue);
+    reopenWork(decodeQueue);
+    reopenWork(uploadQueue);
+    for (int i = 0; i < ioThreads; i++)
+        loaderThreads.emplace_back(ioWorker);
+    for (int i = 0; i < decodeThreads; i++)
+        loaderThreads.emplace_back(decodeWorker);
+    loaderThreads.emplace_back(uploadWorker);
+    return true;
+}
+
+MeshResource* requestMesh(const char* path)
+{
+    MeshResource* resource = addResource(path);
+    if (uploadWindow)
+        pushWork(ioQueue, resource);
+    else
+        failResource(resource); // Loader isn't running
+    return resource;
+}
+
+void pollResourceLoader()
+{
+    std::lock_guard<std::mutex> lock(resourceMutex);
+    for (size_t i = 0; i < fencedResources.size();)
+    {
+        MeshResource* resource = fencedResources[i];
+        GLenum status = glClientWaitSync(resource->fence, 0, 0); // Never blocks the frame
+        if (status == GL_TIMEOUT_EXPIRED)
+        {
+            i++;
+            continue;
+        }
+        glDeleteSync(resource->fence);
+        resource->fence = nullptr;
+
+        if (status == GL_WAIT_FAILED)
+            resource->state = RESOURCE_FAILED;
+        else
+        {
+            // VAOs are per-context, so the render thread builds its own around the shared buffers
+            glGenVertexArrays(1, &resource->VAO);
+            glBindVertexArray(resource->VAO);
+            glBindBuffer(GL_ARRAY_BUFFER, resource->VBO);
+            if (resource->EBO)
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, resource->EBO);
+            setMeshVertexLayout();
+            glBindVertexArray(0);
+            resource->state = RESOURCE_READY;
+        }
+        fencedResources[i] = fencedResources.back();
+        fencedResources.pop_back();
+    }
+}
+
+void stopResourceLoader()
+{
+    closeWork(ioQueue);
+    closeWork(decodeQueue);
+    closeWork(uploadQueue);
+    for (std::thread& thread : loaderThreads)
+        thread.join();
+    loaderThreads.clear();
+
+    if (uploadWindow)
+        glfwDestroyWindow(uploadWindow);
+    uploadWindow = nullptr;
+
+    std::lock_guard<std::mutex> lock(resourceMutex);
+    for (MeshResource* resource : allResources)
+    {
+        if (resource->fence)
+            glDeleteSync(resource->fence);
+        if (resource->VAO)
+            glDeleteVertexArrays(1, &resource->VAO);
+        if (resource->VBO)
+            glDeleteBuffers(1, &resource->VBO);
+        if (resource->EBO)
+            glDeleteBuffers(1, &resource->EBO);
+        unmapFile(resource->file);
+        closeMeshCache(resource->cache);
+        poolDelete(resourcePool, resource);
+    }
+    if (!allResources.empty())
+        printPoolStats("mesh resources", resourcePool);
+    allResources.clear();
+    releasePool(resourcePool);
+    fencedResources.clear();
+}
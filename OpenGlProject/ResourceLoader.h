@@ -0,0 +1,59 @@
+#pragma once
+#include <glad/glad.h> // GL types and GLsync
+#include <GLFW/glfw3.h> // Shared upload context
+#include <atomic> // Resource state shared between threads
+#include <string> // Resource path
+#include <glm/glm.hpp> // Bounds and fit matrix
+#include "MeshCache.h" // .mesh caches
+#include "MeshImporter.h" // MeshData
+
+// Life cycle of a streamed resource; only the render thread moves it to READY
+enum ResourceState
+{
+    RESOURCE_QUEUED, // Waiting for an I/O worker
+    RESOURCE_READING, // File is mapped and being paged in
+    RESOURCE_DECODING, // Being parsed by a decode worker
+    RESOURCE_UPLOADING, // Waiting for / inside the upload thread
+    RESOURCE_FENCED, // Uploaded, waiting for the GPU fence
+    RESOURCE_READY, // Drawable on the render thread
+    RESOURCE_FAILED // Load failed; keep drawing the placeholder
+};
+
+// A mesh that can be drawn with the VAO layout from main()
+struct MeshResource
+{
+    std::string path; // Source file
+    std::atomic<int> state{ RESOURCE_QUEUED }; // ResourceState
+    unsigned int VAO = 0, VBO = 0, EBO = 0; // GL objects (VAO lives on the render context)
+    size_t drawCount = 0; // Vertices (EBO == 0) or indices to draw
+    glm::vec3 boundsMin = glm::vec3(0.0f); // Bounding box used to fit the mesh on screen
+    glm::vec3 boundsMax = glm::vec3(0.0f);
+    GLsync fence = nullptr; // Signalled once the upload is visible to the GPU
+
+    // Worker-side data, released after upload
+    MappedFile file; // I/O stage output for .obj/.ply
+    MeshCache cache; // I/O stage output for .mesh
+    MeshData mesh; // Decode stage output
+};
+
+// Set up position/color attributes for the bound VAO/VBO
+void setMeshVertexLayout();
+
+// Matrix that centers the resource and scales it into the unit cube
+glm::mat4 meshFitMatrix(const MeshResource& resource);
+
+// Upload a mesh synchronously on the current context (used for placeholders)
+MeshResource* createMeshResource(const MeshData& mesh);
+
+// Start I/O, decode and upload threads; the upload thread gets a hidden window sharing window's context.
+// Must be called from the main thread, like every GLFW window function.
+bool startResourceLoader(GLFWwindow* window, int ioThreads, int decodeThreads);
+
+// Queue a mesh file (.obj, .ply or .mesh) for streaming
+MeshResource* requestMesh(const char* path);
+
+// Render thread, once per frame: publish resources whose fences have signalled
+void pollResourceLoader();
+
+// Stop the workers and delete every resource (main thread, render context current)
+void stopResourceLoader();
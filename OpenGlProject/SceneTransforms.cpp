@@ -0,0 +1,108 @@
+#include "SceneTransforms.h"
+#include <glm/gtc/matrix_transform.hpp> // translate / rotate / scale
+#include <algorithm> // std::min
+#include <chrono> // Benchmark timing
+#include <cmath> // sin / fmod
+#include <iostream> // For outputting errors and messages
+#include <vector> // Benchmark buffers
+
+static const double TWO_PI = 6.283185307179586;
+
+glm::mat4 toggleModelMatrix(unsigned toggles, double time)
+{
+    glm::mat4 model = glm::mat4(1.0f); // Identity matrix
+
+    // Apply transformations based on toggles
+    if (toggles & TOGGLE_TRANSLATION)
+        model = glm::translate(model, glm::vec3(1.0f, 0.0f, 0.0f));
+    if (toggles & TOGGLE_ROTATION)
+        model = glm::rotate(model, (float)time, glm::vec3(0.5f, 1.0f, 0.0f));
+    if (toggles & TOGGLE_SCALING)
+        model = glm::scale(model, glm::vec3(sin(time) + 1.0f));
+    if (toggles & TOGGLE_SHEARING)
+    {
+        glm::mat4 shear = glm::mat4(1.0f);
+        shear[1][0] = 0.5f * sin(time); // Shear on X axis
+        model *= shear;
+    }
+    if (toggles & TOGGLE_REFLECTION)
+    {
+        glm::mat4 reflect = glm::scale(glm::mat4(1.0f), glm::vec3(-1.0f, 1.0f, 1.0f)); // Reflect X axis
+        model *= reflect;
+    }
+    return model;
+}
+
+float wrapAnimationTime(double time)
+{
+    return (float)fmod(time, TWO_PI);
+}
+
+glm::mat4 objectModelMatrix(unsigned toggles, double time, const glm::vec4& params)
+{
+    return glm::translate(glm::mat4(1.0f), glm::vec3(params)) * toggleModelMatrix(toggles, time + params.w);
+}
+
+unsigned specializedAluSavings(unsigned toggles)
+{
+    const unsigned maskTestOps = 2; // AND + compare per toggle
+    const unsigned matrixProductOps = 64 + 48; // mat4 * mat4: multiplies + adds
+    unsigned saved = 5 * maskTestOps;
+    if (toggles & TOGGLE_TRANSLATION)
+        return saved; // The translation is written into the identity: nothing to fold either way
+    if (toggles & (TOGGLE_ROTATION | TOGGLE_SCALING | TOGGLE_SHEARING))
+        saved += matrixProductOps; // identity * first matrix
+    else if (toggles & TOGGLE_REFLECTION)
+        saved += 4; // Negating the identity's first column
+    return saved;
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark
+// ---------------------------------------------------------------------------
+
+void runTransformBenchmark()
+{
+    const size_t objectCount = 1 << 16; // Objects per frame
+    const int frames = 20; // Best of
+    const unsigned allToggles = TOGGLE_COMBINATIONS - 1;
+
+    std::vector<glm::vec4> params(objectCount);
+    for (size_t i = 0; i < objectCount; i++)
+        params[i] = objectTransformParams(glm::vec3((float)(i % 256), (float)(i / 256), 0.0f), 0.25f * (float)(i % 7));
+
+    // What each path writes into the command stream per object
+    std::vector<glm::mat4> matrices(objectCount);
+    std::vector<glm::vec4> packed(objectCount);
+    auto bestMs = [&](auto&& work) {
+        double best = 1e30;
+        for (int frame = 0; frame < frames; frame++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            work(1.0 + frame / 60.0);
+            best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    };
+
+    std::cout << "Transform benchmark: " << objectCount << " objects, best of " << frames << " frames" << std::endl;
+    for (unsigned toggles : { 0u, (unsigned)TOGGLE_ROTATION, allToggles })
+    {
+        double cpuMs = bestMs([&](double time) {
+            for (size_t i = 0; i < objectCount; i++)
+                matrices[i] = objectModelMatrix(toggles, time, params[i]);
+        });
+        double shaderMs = bestMs([&](double time) {
+            volatile float frameTime = wrapAnimationTime(time); // Once per frame; the shader does the rest
+            (void)frameTime;
+            for (size_t i = 0; i < objectCount; i++)
+                packed[i] = params[i];
+        });
+        std::cout << "  toggles " << toggles << ": CPU matrices " << cpuMs * 1e6 / objectCount << " ns and "
+                  << sizeof(glm::mat4) << " bytes per object; shader path " << shaderMs * 1e6 / objectCount << " ns and "
+                  << sizeof(glm::vec4) << " bytes per object (+ " << sizeof(glm::mat4) + sizeof(int) + sizeof(float)
+                  << " bytes per frame)" << std::endl;
+    }
+    volatile float sink = matrices[objectCount - 1][0][0] + packed[objectCount - 1].x; // Keep the results alive
+    (void)sink;
+}
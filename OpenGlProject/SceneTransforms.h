@@ -0,0 +1,42 @@
+#pragma once
+#include <glm/glm.hpp> // Matrices and parameter vectors
+
+// The animated toggle transforms: translate -> rotate -> scale -> shear -> reflect, driven by a toggle mask and
+// the animation time. The vertex shader evaluates the chain itself from the mask, the time and a vec4 of
+// per-object parameters (offset and animation phase), so the CPU uploads 16 bytes per object instead of a
+// 64-byte matrix it had to build with trig calls. toggleModelMatrix is the CPU reference of the shader code in
+// shaders/scene.vert; it drives the software path (--cpu-transforms) and the benchmark.
+
+// Bits of a toggle mask, in key order (scene.vert uses the same values)
+enum ToggleBit
+{
+    TOGGLE_TRANSLATION = 1,
+    TOGGLE_ROTATION = 2,
+    TOGGLE_SCALING = 4,
+    TOGGLE_SHEARING = 8,
+    TOGGLE_REFLECTION = 16,
+    TOGGLE_COMBINATIONS = 32 // Number of distinct masks
+};
+
+// Model matrix for a toggle mask at a given animation time
+glm::mat4 toggleModelMatrix(unsigned toggles, double time);
+
+// The time uniform: every animated term has a period of 2 pi, so wrapping keeps float precision in long runs
+float wrapAnimationTime(double time);
+
+// Per-object shader parameters: xyz = offset from the origin, w = animation phase (seconds added to the time)
+inline glm::vec4 objectTransformParams(const glm::vec3& offset, float phase)
+{
+    return glm::vec4(offset, phase);
+}
+
+// CPU equivalent of what the shader builds from objectTransformParams: translate(offset) * toggles(time + phase)
+glm::mat4 objectModelMatrix(unsigned toggles, double time, const glm::vec4& params);
+
+// Estimated scalar ALU operations per vertex that the variant specialized on toggles (STATIC_TOGGLES) saves over
+// the generic shader: the five mask tests, and the product with the identity the chain starts from, which only
+// folds away when the mask is a compile-time constant
+unsigned specializedAluSavings(unsigned toggles);
+
+// Compare per-object CPU time and bytes uploaded for the CPU and shader paths over many objects
+void runTransformBenchmark();
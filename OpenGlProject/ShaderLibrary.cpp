@@ -0,0 +1,516 @@
+#include "ShaderLibrary.h"
+#include "Benchmark.h" // checksumBytes
+#include "Profiler.h" // Watcher track
+#include "RenderContext.h" // setGlContextHints
+#include <algorithm> // std::find / std::max
+#include <atomic> // Watcher flags
+#include <chrono> // Build timing
+#include <filesystem> // Modification times
+#include <functional> // Savings estimate callback
+#include <fstream> // Reading sources
+#include <iostream> // For outputting errors and messages
+#include <memory> // std::unique_ptr
+#include <mutex> // Finished programs
+#include <sstream> // Reading sources
+#include <thread> // Watcher thread
+#include <vector> // Program lists
+#ifdef __linux__
+#include <poll.h> // Waiting on the inotify descriptor
+#include <sys/inotify.h> // File change notifications
+#include <unistd.h> // read / close
+#endif
+
+static const int SHADER_WATCH_POLL_MS = 100; // How often the watcher checks whether it should stop
+static const int SHADER_WATCH_SETTLE_MS = 50; // Editors often write a file in several steps; wait for the last one
+static const int SHADER_LOG_BYTES = 4096;
+
+// A program the watcher built, waiting for its fence
+struct FinishedProgram
+{
+    ShaderProgram* target;
+    GLuint program;
+    GLsync fence;
+    uint64_t layoutHash;
+    double buildMs;
+};
+
+static std::vector<std::unique_ptr<ShaderProgram>> programs; // Every loaded program; entries never move
+static std::mutex programsMutex; // Guards programs: permutations can be added while the watcher runs
+static GLFWwindow* reloadWindow = nullptr; // Hidden window owning the watcher's shared context
+static GladGLContext reloadGl; // Its GL function table
+static std::thread watcherThread;
+static std::atomic<bool> watching{ false };
+static std::mutex finishedMutex; // Guards finishedPrograms
+static std::vector<FinishedProgram> finishedPrograms;
+static std::atomic<bool> programsFinished{ false }; // Lets pollShaderPrograms skip the lock on most frames
+
+// ---------------------------------------------------------------------------
+// Building
+// ---------------------------------------------------------------------------
+
+static bool readSource(const std::string& path, std::string& source)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        return false;
+    std::ostringstream text;
+    text << in.rdbuf();
+    source = text.str();
+    return true;
+}
+
+static GLuint compileStage(const ShaderProgram& shader, GLenum type, const std::string& source)
+{
+    GLuint stage = glCreateShader(type);
+    const char* text = source.c_str();
+    glShaderSource(stage, 1, &text, NULL);
+    glCompileShader(stage);
+    GLint ok = 0;
+    glGetShaderiv(stage, GL_COMPILE_STATUS, &ok);
+    if (!ok)
+    {
+        char log[SHADER_LOG_BYTES];
+        glGetShaderInfoLog(stage, sizeof(log), NULL, log);
+        std::cout << shader.name << (type == GL_VERTEX_SHADER ? " vertex" : " fragment") << " shader failed to compile: " << log << std::endl;
+        glDeleteShader(stage);
+        return 0;
+    }
+    return stage;
+}
+
+// The program's defines go right after the #version line, which has to stay first
+static std::string specializeSource(const std::string& source, const std::string& defines)
+{
+    if (defines.empty())
+        return source;
+    size_t version = source.find("#version");
+    size_t lineEnd = version == std::string::npos ? std::string::npos : source.find('\n', version);
+    if (lineEnd == std::string::npos)
+        return defines + source;
+    return source.substr(0, lineEnd + 1) + defines + source.substr(lineEnd + 1);
+}
+
+// 0 if either stage fails to compile or the program fails to link
+static GLuint buildProgram(const ShaderProgram& shader, const std::string& vertexSource, const std::string& fragmentSource)
+{
+    GLuint vertexShader = compileStage(shader, GL_VERTEX_SHADER, specializeSource(vertexSource, shader.defines));
+    GLuint fragmentShader = compileStage(shader, GL_FRAGMENT_SHADER, specializeSource(fragmentSource, shader.defines));
+    if (!vertexShader || !fragmentShader)
+    {
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        return 0;
+    }
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader); // Flagged for deletion; freed with the program
+    glDeleteShader(fragmentShader);
+
+    GLint ok = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok)
+    {
+        char log[SHADER_LOG_BYTES];
+        glGetProgramInfoLog(program, sizeof(log), NULL, log);
+        std::cout << shader.name << " shader failed to link: " << log << std::endl;
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+// Hash of the active uniforms; equal hashes mean cached locations carry over to the new program
+static uint64_t uniformLayoutHash(GLuint program)
+{
+    GLint count = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+    uint64_t hash = checksumBytes(&count, sizeof(count));
+    for (GLint i = 0; i < count; i++)
+    {
+        char name[256];
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(program, (GLuint)i, sizeof(name), &length, &size, &type, name);
+        GLint location = glGetUniformLocation(program, name);
+        hash = checksumBytes(name, (size_t)length, hash);
+        hash = checksumBytes(&size, sizeof(size), hash);
+        hash = checksumBytes(&type, sizeof(type), hash);
+        hash = checksumBytes(&location, sizeof(location), hash);
+    }
+    return hash;
+}
+
+// ---------------------------------------------------------------------------
+// Watcher
+// ---------------------------------------------------------------------------
+
+// Watcher thread: rebuild shader from its files and queue it for the render thread
+static void rebuildProgram(ShaderProgram* shader)
+{
+    PROFILE_SCOPE("rebuild shader");
+    auto start = std::chrono::steady_clock::now();
+    std::string vertexSource, fragmentSource;
+    if (!readSource(shader->vertexPath, vertexSource) || !readSource(shader->fragmentPath, fragmentSource))
+    {
+        std::cout << "Shader " << shader->name << ": sources unreadable, keeping the current program" << std::endl;
+        return;
+    }
+    GLuint program = buildProgram(*shader, vertexSource, fragmentSource);
+    if (!program)
+    {
+        std::cout << "Shader " << shader->name << ": keeping the current program" << std::endl;
+        return;
+    }
+
+    FinishedProgram finished;
+    finished.target = shader;
+    finished.program = program;
+    finished.layoutHash = uniformLayoutHash(program);
+    finished.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush(); // Make sure the fence reaches the GPU so the render thread can see it signal
+    finished.buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::lock_guard<std::mutex> lock(finishedMutex);
+    finishedPrograms.push_back(finished);
+    programsFinished.store(true, std::memory_order_release);
+}
+
+// A watched source file
+struct WatchedFile
+{
+    std::string directory; // "." for a bare file name
+    std::string name;
+    ShaderProgram* shader;
+};
+
+// Files of every program that was loaded from disk
+static std::vector<WatchedFile> watchedFiles()
+{
+    std::lock_guard<std::mutex> lock(programsMutex);
+    std::vector<WatchedFile> files;
+    for (const std::unique_ptr<ShaderProgram>& shader : programs)
+        for (const std::string* path : { &shader->vertexPath, &shader->fragmentPath })
+        {
+            if (path->empty())
+                continue; // Built-in source
+            std::filesystem::path file(*path);
+            std::string directory = file.parent_path().string();
+            files.push_back({ directory.empty() ? "." : directory, file.filename().string(), shader.get() });
+        }
+    return files;
+}
+
+#ifdef __linux__
+static void watchShaderFiles()
+{
+    int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0)
+    {
+        std::cout << "Shader reload: inotify unavailable" << std::endl;
+        return;
+    }
+    // One watch per directory (inotify returns the same descriptor for a directory watched twice); editors that
+    // save through a rename show up as IN_MOVED_TO
+    std::vector<WatchedFile> files;
+    std::vector<int> descriptors; // Per file
+
+    alignas(inotify_event) char buffer[4096];
+    std::vector<ShaderProgram*> changed;
+    while (watching.load())
+    {
+        // Pick up programs loaded since the last pass (lazily built permutations)
+        std::vector<WatchedFile> current = watchedFiles();
+        if (current.size() != files.size())
+        {
+            files = current;
+            descriptors.clear();
+            for (const WatchedFile& file : files)
+            {
+                int wd = inotify_add_watch(fd, file.directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+                if (wd < 0)
+                    std::cout << "Shader reload: cannot watch " << file.directory << std::endl;
+                descriptors.push_back(wd);
+            }
+        }
+
+        pollfd request = { fd, POLLIN, 0 };
+        if (poll(&request, 1, SHADER_WATCH_POLL_MS) <= 0)
+            continue;
+        std::this_thread::sleep_for(std::chrono::milliseconds(SHADER_WATCH_SETTLE_MS));
+
+        changed.clear();
+        ssize_t bytes;
+        while ((bytes = read(fd, buffer, sizeof(buffer))) > 0)
+            for (char* p = buffer; p < buffer + bytes;)
+            {
+                const inotify_event* event = (const inotify_event*)p;
+                p += sizeof(inotify_event) + event->len;
+                for (size_t i = 0; i < files.size(); i++)
+                    if (event->len && descriptors[i] == event->wd && files[i].name == event->name &&
+                        std::find(changed.begin(), changed.end(), files[i].shader) == changed.end())
+                        changed.push_back(files[i].shader);
+            }
+        for (ShaderProgram* shader : changed)
+            rebuildProgram(shader);
+    }
+    close(fd);
+}
+#else
+static void watchShaderFiles()
+{
+    // No change notifications: compare modification times
+    std::vector<WatchedFile> files;
+    std::vector<std::filesystem::file_time_type> times;
+    auto modified = [](const WatchedFile& file) {
+        std::error_code error;
+        return std::filesystem::last_write_time(std::filesystem::path(file.directory) / file.name, error);
+    };
+
+    std::vector<ShaderProgram*> changed;
+    while (watching.load())
+    {
+        // Programs only ever get appended, so files loaded since the last pass are at the end
+        files = watchedFiles();
+        for (size_t i = times.size(); i < files.size(); i++)
+            times.push_back(modified(files[i]));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(SHADER_WATCH_POLL_MS));
+        changed.clear();
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            std::filesystem::file_time_type time = modified(files[i]);
+            if (time == times[i])
+                continue;
+            times[i] = time;
+            if (std::find(changed.begin(), changed.end(), files[i].shader) == changed.end())
+                changed.push_back(files[i].shader);
+        }
+        if (changed.empty())
+            continue;
+        std::this_thread::sleep_for(std::chrono::milliseconds(SHADER_WATCH_SETTLE_MS));
+        for (size_t i = 0; i < files.size(); i++)
+            times[i] = modified(files[i]); // Writes that landed while settling
+        for (ShaderProgram* shader : changed)
+            rebuildProgram(shader);
+    }
+}
+#endif
+
+static void watcherWorker()
+{
+    glfwMakeContextCurrent(reloadWindow); // The shared context lives on this thread from now on
+    gladSetGLContext(&reloadGl);
+    PROFILE_THREAD("shader reload");
+    watchShaderFiles();
+    gladSetGLContext(NULL);
+    glfwMakeContextCurrent(NULL); // Release the context before the window is destroyed
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+static ShaderProgram* createProgram(const char* name, const char* directory, const char* vertexFile, const char* fragmentFile,
+                                    const char* builtinVertex, const char* builtinFragment, const std::string& defines, bool quiet)
+{
+    std::unique_ptr<ShaderProgram> shader(new ShaderProgram());
+    shader->name = name;
+    shader->defines = defines;
+    std::string vertexPath = (std::filesystem::path(directory) / vertexFile).string();
+    std::string fragmentPath = (std::filesystem::path(directory) / fragmentFile).string();
+    std::string vertexSource, fragmentSource;
+    if (readSource(vertexPath, vertexSource) && readSource(fragmentPath, fragmentSource))
+    {
+        shader->vertexPath = vertexPath;
+        shader->fragmentPath = fragmentPath;
+    }
+    else
+    {
+        if (!quiet)
+            std::cout << "Shader " << name << ": " << vertexPath << " / " << fragmentPath << " not found, using the built-in source" << std::endl;
+        vertexSource = builtinVertex;
+        fragmentSource = builtinFragment;
+    }
+
+    shader->program = buildProgram(*shader, vertexSource, fragmentSource);
+    if (!shader->program)
+        return nullptr;
+    shader->layoutHash = uniformLayoutHash(shader->program);
+    std::lock_guard<std::mutex> lock(programsMutex);
+    programs.push_back(std::move(shader));
+    return programs.back().get();
+}
+
+ShaderProgram* loadShaderProgram(const char* name, const char* directory, const char* vertexFile, const char* fragmentFile,
+                                 const char* builtinVertex, const char* builtinFragment, const char* defines)
+{
+    return createProgram(name, directory, vertexFile, fragmentFile, builtinVertex, builtinFragment, defines, false);
+}
+
+bool startShaderReload(GLFWwindow* window)
+{
+    if (watchedFiles().empty())
+        return false; // Nothing on disk to watch
+
+    // A hidden 1x1 window is the portable way to get a second context sharing window's objects
+    setGlContextHints(); // Same version, profile and debug flag as the main context
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    reloadWindow = glfwCreateWindow(1, 1, "Shader reload", NULL, window);
+    setGlContextHints();
+    if (reloadWindow == NULL)
+    {
+        std::cout << "Failed to create shader reload context" << std::endl;
+        return false;
+    }
+    glfwMakeContextCurrent(reloadWindow); // Load its function table before the watcher thread uses it
+    gladLoadGLContext(&reloadGl, (GLADloadproc)glfwGetProcAddress);
+    glfwMakeContextCurrent(window); // Creating a window can change the current context
+
+    watching = true;
+    watcherThread = std::thread(watcherWorker);
+    return true;
+}
+
+void pollShaderPrograms()
+{
+    if (!programsFinished.load(std::memory_order_acquire))
+        return;
+    std::lock_guard<std::mutex> lock(finishedMutex);
+    for (size_t i = 0; i < finishedPrograms.size();)
+    {
+        FinishedProgram& finished = finishedPrograms[i];
+        GLenum status = glClientWaitSync(finished.fence, 0, 0); // Never blocks the frame
+        if (status == GL_TIMEOUT_EXPIRED)
+        {
+            i++;
+            continue;
+        }
+        glDeleteSync(finished.fence);
+
+        ShaderProgram& shader = *finished.target;
+        if (status == GL_WAIT_FAILED)
+            glDeleteProgram(finished.program);
+        else
+        {
+            glDeleteProgram(shader.program); // Frames still in flight keep it alive until they finish
+            shader.program = finished.program;
+            bool layoutChanged = finished.layoutHash != shader.layoutHash;
+            if (layoutChanged)
+            {
+                shader.layoutHash = finished.layoutHash;
+                shader.layoutVersion++;
+            }
+            shader.reloads++;
+            std::cout << "Shader " << shader.name << " reloaded in " << finished.buildMs << " ms ("
+                      << (layoutChanged ? "uniform layout changed" : "uniform layout unchanged") << ")" << std::endl;
+        }
+        finishedPrograms[i] = finishedPrograms.back();
+        finishedPrograms.pop_back();
+    }
+    programsFinished.store(!finishedPrograms.empty(), std::memory_order_release);
+}
+
+void releaseShaderPrograms()
+{
+    if (watcherThread.joinable())
+    {
+        watching = false;
+        watcherThread.join();
+    }
+    if (reloadWindow)
+        glfwDestroyWindow(reloadWindow);
+    reloadWindow = nullptr;
+
+    std::lock_guard<std::mutex> lock(finishedMutex);
+    for (FinishedProgram& finished : finishedPrograms)
+    {
+        glDeleteSync(finished.fence);
+        glDeleteProgram(finished.program);
+    }
+    finishedPrograms.clear();
+    programsFinished = false;
+    std::lock_guard<std::mutex> programsLock(programsMutex);
+    for (const std::unique_ptr<ShaderProgram>& shader : programs)
+        glDeleteProgram(shader->program);
+    programs.clear();
+}
+
+// ---------------------------------------------------------------------------
+// Permutations
+// ---------------------------------------------------------------------------
+
+void initShaderPermutations(ShaderPermutations& permutations, const char* name, const char* directory, const char* vertexFile,
+                            const char* fragmentFile, const char* builtinVertex, const char* builtinFragment,
+                            const char* maskDefine, unsigned count)
+{
+    permutations = ShaderPermutations();
+    permutations.name = name;
+    permutations.directory = directory;
+    permutations.vertexFile = vertexFile;
+    permutations.fragmentFile = fragmentFile;
+    permutations.builtinVertex = builtinVertex;
+    permutations.builtinFragment = builtinFragment;
+    permutations.maskDefine = maskDefine;
+    permutations.variants.assign(count, nullptr);
+    permutations.draws.assign(count, 0);
+}
+
+ShaderProgram* shaderPermutation(ShaderPermutations& permutations, unsigned mask)
+{
+    if (mask >= permutations.variants.size())
+        return nullptr;
+    ShaderProgram*& variant = permutations.variants[mask];
+    if (!variant)
+    {
+        PROFILE_SCOPE("compile permutation");
+        std::string name = permutations.name + "[" + std::to_string(mask) + "]";
+        std::string defines = "#define " + permutations.maskDefine + " " + std::to_string(mask) + "\n";
+        auto start = std::chrono::steady_clock::now();
+        variant = createProgram(name.c_str(), permutations.directory.c_str(), permutations.vertexFile.c_str(), permutations.fragmentFile.c_str(),
+                                permutations.builtinVertex, permutations.builtinFragment, defines, true);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        permutations.compileMs += ms;
+        permutations.slowestCompileMs = std::max(permutations.slowestCompileMs, ms);
+        if (!variant)
+            return nullptr;
+        permutations.compiled++;
+    }
+    permutations.draws[mask]++;
+    return variant;
+}
+
+void compileShaderPermutations(ShaderPermutations& permutations)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned mask = 0; mask < permutations.variants.size(); mask++)
+        if (shaderPermutation(permutations, mask))
+            permutations.draws[mask]--; // Compiling is not a use
+    std::cout << "Shader " << permutations.name << ": " << permutations.compiled << " permutations compiled ahead of time in "
+              << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() << " ms" << std::endl;
+}
+
+void printShaderPermutationStats(const ShaderPermutations& permutations, const std::function<double(unsigned)>& savedAluPerDraw)
+{
+    if (permutations.compiled == 0)
+        return;
+    uint64_t draws = 0;
+    unsigned used = 0;
+    double savedAlu = 0.0;
+    for (unsigned mask = 0; mask < permutations.draws.size(); mask++)
+    {
+        draws += permutations.draws[mask];
+        used += permutations.draws[mask] ? 1 : 0;
+        if (savedAluPerDraw)
+            savedAlu += savedAluPerDraw(mask) * permutations.draws[mask];
+    }
+    std::cout << "Shader " << permutations.name << " permutations: " << permutations.compiled << " of " << permutations.variants.size()
+              << " compiled (" << used << " used), " << permutations.compileMs << " ms compiling (slowest "
+              << permutations.slowestCompileMs << " ms), " << draws << " selections";
+    if (savedAluPerDraw && draws)
+        std::cout << ", ~" << savedAlu / draws << " ALU ops saved per draw";
+    std::cout << std::endl;
+}
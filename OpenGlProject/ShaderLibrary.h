@@ -0,0 +1,77 @@
+#pragma once
+#include <glad/glad.h> // Must precede GLFW
+#include <GLFW/glfw3.h> // Window for the reload context
+#include <cstdint> // Layout hash
+#include <functional> // Savings estimate callback
+#include <string> // Source paths
+#include <vector> // Permutation variants
+
+// Shader programs built from GLSL files, rebuilt while the program runs when a file changes. A watcher thread
+// (inotify on Linux, modification-time polling elsewhere) notices the change and compiles and links the new
+// program on its own shared context, so the render path never waits for the compiler. The render thread swaps
+// the new program in at its next pollShaderPrograms, and only after a successful link; a broken edit prints the
+// compiler log and the old program keeps drawing. Uniform locations cached by users stay valid as long as
+// layoutVersion does not change, which it only does when a reload changes the active uniforms.
+struct ShaderProgram
+{
+    std::string name; // For messages
+    std::string vertexPath; // Source files; empty when the built-in source is used
+    std::string fragmentPath;
+    std::string defines; // Lines inserted after #version: the permutation this program specializes
+    GLuint program = 0; // Current program; only changes inside pollShaderPrograms
+    uint64_t layoutHash = 0; // Active uniforms: name, type, size and location
+    unsigned layoutVersion = 0; // Bumped when a reload changes layoutHash
+    unsigned reloads = 0; // Successful reloads
+};
+
+// Build a program from directory/vertexFile and directory/fragmentFile on the current context. If the files
+// can't be read the built-in sources are used instead (and nothing is watched). defines are inserted after the
+// #version line of both stages. nullptr if it fails to build.
+ShaderProgram* loadShaderProgram(const char* name, const char* directory, const char* vertexFile, const char* fragmentFile,
+                                 const char* builtinVertex, const char* builtinFragment, const char* defines = "");
+
+// Watch the files of every loaded program. Creates a hidden window sharing window's objects, so call it on the
+// main thread after the programs are loaded.
+bool startShaderReload(GLFWwindow* window);
+
+// Render thread, once per frame: swap in programs the watcher has finished (never blocks)
+void pollShaderPrograms();
+
+// Stop the watcher and delete every program; call on the thread that owns the context
+void releaseShaderPrograms();
+
+// ---------------------------------------------------------------------------
+// Permutations
+// ---------------------------------------------------------------------------
+
+// Variants of one shader specialized on a bit mask: variant m is built with "#define <maskDefine> m", so branches
+// on the mask fold at compile time. Variants are built on first use (lazy) or all at once (ahead of time) and
+// live in the library like any other program, so they are hot-reloaded too.
+struct ShaderPermutations
+{
+    std::string name;
+    std::string directory;
+    std::string vertexFile;
+    std::string fragmentFile;
+    const char* builtinVertex = nullptr;
+    const char* builtinFragment = nullptr;
+    std::string maskDefine; // Macro the mask is passed in
+    std::vector<ShaderProgram*> variants; // By mask; nullptr until built
+    std::vector<uint64_t> draws; // Selections per mask
+    unsigned compiled = 0;
+    double compileMs = 0.0; // Total time spent building variants
+    double slowestCompileMs = 0.0;
+};
+
+void initShaderPermutations(ShaderPermutations& permutations, const char* name, const char* directory, const char* vertexFile,
+                            const char* fragmentFile, const char* builtinVertex, const char* builtinFragment,
+                            const char* maskDefine, unsigned count);
+
+// The variant for mask, built on the current context if it doesn't exist yet; nullptr if it fails to build
+ShaderProgram* shaderPermutation(ShaderPermutations& permutations, unsigned mask);
+
+// Build every variant now, so no frame pays for a compile
+void compileShaderPermutations(ShaderPermutations& permutations);
+
+// Compile cost and use; savedAluPerDraw (optional) estimates what a mask's variant saves per draw
+void printShaderPermutationStats(const ShaderPermutations& permutations, const std::function<double(unsigned)>& savedAluPerDraw);
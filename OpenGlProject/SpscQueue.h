@@ -0,0 +1,38 @@
+#pragma once
+#include <atomic> // Head and tail indices
+#include <cstddef> // size_t
+
+// Lock-free single-producer / single-consumer ring. One thread pushes, one other thread pops; neither blocks.
+// Capacity must be a power of two.
+template <typename T, size_t Capacity>
+struct SpscQueue
+{
+    static_assert((Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+    T items[Capacity];
+    alignas(64) std::atomic<size_t> head{ 0 }; // Next item to pop (consumer)
+    alignas(64) std::atomic<size_t> tail{ 0 }; // Next free slot (producer)
+};
+
+// Producer only; false if the queue is full
+template <typename T, size_t Capacity>
+bool pushSpsc(SpscQueue<T, Capacity>& queue, const T& item)
+{
+    size_t tail = queue.tail.load(std::memory_order_relaxed);
+    if (tail - queue.head.load(std::memory_order_acquire) == Capacity)
+        return false;
+    queue.items[tail & (Capacity - 1)] = item;
+    queue.tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+// Consumer only; false if the queue is empty
+template <typename T, size_t Capacity>
+bool popSpsc(SpscQueue<T, Capacity>& queue, T& item)
+{
+    size_t head = queue.head.load(std::memory_order_relaxed);
+    if (head == queue.tail.load(std::memory_order_acquire))
+        return false;
+    item = queue.items[head & (Capacity - 1)];
+    queue.head.store(head + 1, std::memory_order_release);
+    return true;
+}
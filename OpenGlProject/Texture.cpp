@@ -0,0 +1,676 @@
+#include "Texture.h"
+#include "FileMapping.h" // Memory-mapped input
+#include "Parallel.h" // runParallel
+#include "Profiler.h" // Worker track
+#include "WorkQueue.h" // Decode queue
+#include <algorithm> // std::min / std::max
+#include <chrono> // Timing
+#include <cctype> // isspace
+#include <cmath> // Kaiser window
+#include <cstring> // memcpy
+#include <filesystem> // Source stamp of the compressed cache
+#include <iostream> // For outputting errors and messages
+#include <memory> // std::unique_ptr
+#include <mutex> // Decoded list lock
+#include <thread> // Worker threads
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h> // SSE2 box filter
+#define TEXTURE_USE_SSE2 1
+#endif
+
+static double nowMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ---------------------------------------------------------------------------
+// Decoding
+// ---------------------------------------------------------------------------
+
+// Truevision TGA: types 2 (raw) and 10 (RLE), 24 or 32 bits per pixel
+static bool decodeTga(const unsigned char* data, size_t size, Image& image)
+{
+    if (size < 18)
+        return false;
+    int idLength = data[0], colorMapType = data[1], imageType = data[2];
+    int width = data[12] | (data[13] << 8), height = data[14] | (data[15] << 8);
+    int bpp = data[16], descriptor = data[17];
+    if (colorMapType != 0 || (imageType != 2 && imageType != 10) || (bpp != 24 && bpp != 32) || width == 0 || height == 0)
+        return false;
+
+    int channels = bpp / 8;
+    size_t pixelCount = (size_t)width * height;
+    image.width = width;
+    image.height = height;
+    image.pixels.resize(pixelCount * 4);
+
+    const unsigned char* p = data + 18 + idLength;
+    const unsigned char* end = data + size;
+    size_t written = 0;
+    auto storePixel = [&](const unsigned char* bgra) {
+        unsigned char* out = &image.pixels[written * 4];
+        out[0] = bgra[2]; out[1] = bgra[1]; out[2] = bgra[0];
+        out[3] = channels == 4 ? bgra[3] : 255;
+        written++;
+    };
+
+    while (written < pixelCount)
+    {
+        if (imageType == 2)
+        {
+            if (end - p < channels) return false;
+            storePixel(p);
+            p += channels;
+            continue;
+        }
+        // RLE packet: high bit = run of one pixel, otherwise a literal run
+        if (p >= end) return false;
+        int header = *p++;
+        int count = (header & 0x7F) + 1;
+        if (written + count > pixelCount) return false;
+        if (header & 0x80)
+        {
+            if (end - p < channels) return false;
+            for (int i = 0; i < count; i++) storePixel(p);
+            p += channels;
+        }
+        else
+        {
+            if (end - p < (ptrdiff_t)count * channels) return false;
+            for (int i = 0; i < count; i++, p += channels) storePixel(p);
+        }
+    }
+
+    // Bit 5 set means the first row is the top one; GL wants the bottom one first
+    if (descriptor & 0x20)
+    {
+        size_t rowBytes = (size_t)width * 4;
+        for (int y = 0; y < height / 2; y++)
+            std::swap_ranges(image.pixels.begin() + y * rowBytes, image.pixels.begin() + (y + 1) * rowBytes,
+                image.pixels.begin() + (height - 1 - y) * rowBytes);
+    }
+    return true;
+}
+
+// Binary PPM (P6) with maxval 255
+static bool decodePpm(const unsigned char* data, size_t size, Image& image)
+{
+    const unsigned char* p = data + 2;
+    const unsigned char* end = data + size;
+    int values[3] = { 0, 0, 0 }; // width, height, maxval
+    for (int i = 0; i < 3; i++)
+    {
+        while (p < end && (isspace(*p) || *p == '#'))
+        {
+            if (*p == '#') while (p < end && *p != '\n') p++; // Comment
+            else p++;
+        }
+        while (p < end && *p >= '0' && *p <= '9')
+            values[i] = values[i] * 10 + (*p++ - '0');
+    }
+    p++; // Single whitespace before the raster
+    int width = values[0], height = values[1];
+    if (values[2] != 255 || width <= 0 || height <= 0 || end - p < (ptrdiff_t)width * height * 3)
+        return false;
+
+    image.width = width;
+    image.height = height;
+    image.pixels.resize((size_t)width * height * 4);
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char* row = p + (size_t)(height - 1 - y) * width * 3; // PPM is top-down
+        unsigned char* out = &image.pixels[(size_t)y * width * 4];
+        for (int x = 0; x < width; x++)
+        {
+            out[x * 4 + 0] = row[x * 3 + 0];
+            out[x * 4 + 1] = row[x * 3 + 1];
+            out[x * 4 + 2] = row[x * 3 + 2];
+            out[x * 4 + 3] = 255;
+        }
+    }
+    return true;
+}
+
+bool decodeImage(const char* path, Image& image)
+{
+    MappedFile file;
+    if (!mapFile(path, file))
+    {
+        std::cout << "Failed to open texture: " << path << std::endl;
+        return false;
+    }
+    const unsigned char* data = (const unsigned char*)file.data;
+    bool ok = file.size > 2 && data[0] == 'P' && data[1] == '6'
+        ? decodePpm(data, file.size, image)
+        : decodeTga(data, file.size, image);
+    unmapFile(file);
+    if (!ok)
+        std::cout << "Unsupported or corrupt texture: " << path << std::endl;
+    return ok;
+}
+
+// ---------------------------------------------------------------------------
+// Mip generation
+// ---------------------------------------------------------------------------
+
+static void boxFilterRows(const Image& source, Image& target, int firstRow, int lastRow)
+{
+    size_t sourceStride = (size_t)source.width * 4;
+    for (int y = firstRow; y < lastRow; y++)
+    {
+        const unsigned char* row0 = &source.pixels[(size_t)std::min(2 * y, source.height - 1) * sourceStride];
+        const unsigned char* row1 = &source.pixels[(size_t)std::min(2 * y + 1, source.height - 1) * sourceStride];
+        unsigned char* out = &target.pixels[(size_t)y * target.width * 4];
+        int x = 0;
+
+#ifdef TEXTURE_USE_SSE2
+        // 8 source pixels -> 4 target pixels per iteration, in 16-bit lanes
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i two = _mm_set1_epi16(2);
+        for (; x + 4 <= target.width && 2 * x + 8 <= source.width; x += 4)
+        {
+            __m128i a0 = _mm_loadu_si128((const __m128i*)(row0 + x * 8));
+            __m128i a1 = _mm_loadu_si128((const __m128i*)(row0 + x * 8 + 16));
+            __m128i b0 = _mm_loadu_si128((const __m128i*)(row1 + x * 8));
+            __m128i b1 = _mm_loadu_si128((const __m128i*)(row1 + x * 8 + 16));
+
+            // Vertical sums: pixels 0-1, 2-3, 4-5, 6-7
+            __m128i s01 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+            __m128i s23 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+            __m128i s45 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+            __m128i s67 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+            // Horizontal pair sums end up in the low 64 bits
+            __m128i t0 = _mm_add_epi16(s01, _mm_srli_si128(s01, 8));
+            __m128i t1 = _mm_add_epi16(s23, _mm_srli_si128(s23, 8));
+            __m128i t2 = _mm_add_epi16(s45, _mm_srli_si128(s45, 8));
+            __m128i t3 = _mm_add_epi16(s67, _mm_srli_si128(s67, 8));
+
+            __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(t0, t1), two), 2);
+            __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(t2, t3), two), 2);
+            _mm_storeu_si128((__m128i*)(out + x * 4), _mm_packus_epi16(lo, hi));
+        }
+#endif
+
+        // Scalar tail, also handles odd widths by clamping
+        for (; x < target.width; x++)
+        {
+            int x0 = std::min(2 * x, source.width - 1), x1 = std::min(2 * x + 1, source.width - 1);
+            for (int c = 0; c < 4; c++)
+                out[x * 4 + c] = (unsigned char)((row0[x0 * 4 + c] + row0[x1 * 4 + c] + row1[x0 * 4 + c] + row1[x1 * 4 + c] + 2) >> 2);
+        }
+    }
+}
+
+// Zeroth-order modified Bessel function, for the Kaiser window
+static double besselI0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    for (int k = 1; k < 20; k++)
+    {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+// 8 taps at source offsets -3.5..3.5 around the target pixel center
+static void kaiserWeights(float weights[8])
+{
+    const double pi = 3.14159265358979323846, beta = 4.0, radius = 4.0;
+    double total = 0.0;
+    for (int i = 0; i < 8; i++)
+    {
+        double d = i - 3.5; // Distance in source pixels
+        double t = d / 2.0; // Distance in target pixels
+        double sinc = std::sin(pi * t) / (pi * t);
+        double window = besselI0(beta * std::sqrt(std::max(0.0, 1.0 - (d / radius) * (d / radius)))) / besselI0(beta);
+        weights[i] = (float)(sinc * window);
+        total += weights[i];
+    }
+    for (int i = 0; i < 8; i++)
+        weights[i] = (float)(weights[i] / total);
+}
+
+// Separable: horizontal pass into a float buffer, then vertical pass into the target. With SSE2 each RGBA pixel is
+// one float vector; edge pixels, whose taps are clamped, take the scalar path.
+static void kaiserFilter(const Image& source, Image& target, unsigned workers)
+{
+    float weights[8];
+    kaiserWeights(weights);
+
+    std::vector<float> horizontal((size_t)target.width * source.height * 4);
+    runParallel(workers, [&](unsigned w) {
+#ifdef TEXTURE_USE_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        __m128 tap[8];
+        for (int i = 0; i < 8; i++)
+            tap[i] = _mm_set1_ps(weights[i]);
+#endif
+        int first = source.height * w / workers, last = source.height * (w + 1) / workers;
+        for (int y = first; y < last; y++)
+        {
+            const unsigned char* row = &source.pixels[(size_t)y * source.width * 4];
+            float* out = &horizontal[(size_t)y * target.width * 4];
+            for (int x = 0; x < target.width; x++)
+            {
+                int left = 2 * x - 3; // Source pixel under the first tap
+#ifdef TEXTURE_USE_SSE2
+                if (left >= 0 && left + 8 <= source.width)
+                {
+                    // 8 source pixels in two loads, widened to one float vector each
+                    __m128i a = _mm_loadu_si128((const __m128i*)(row + left * 4));
+                    __m128i b = _mm_loadu_si128((const __m128i*)(row + left * 4 + 16));
+                    __m128i pixels[4] = { _mm_unpacklo_epi8(a, zero), _mm_unpackhi_epi8(a, zero),
+                                          _mm_unpacklo_epi8(b, zero), _mm_unpackhi_epi8(b, zero) };
+                    __m128 sum = _mm_setzero_ps();
+                    for (int i = 0; i < 4; i++)
+                    {
+                        sum = _mm_add_ps(sum, _mm_mul_ps(tap[2 * i], _mm_cvtepi32_ps(_mm_unpacklo_epi16(pixels[i], zero))));
+                        sum = _mm_add_ps(sum, _mm_mul_ps(tap[2 * i + 1], _mm_cvtepi32_ps(_mm_unpackhi_epi16(pixels[i], zero))));
+                    }
+                    _mm_storeu_ps(out + x * 4, sum);
+                    continue;
+                }
+#endif
+                float sum[4] = { 0, 0, 0, 0 };
+                for (int i = 0; i < 8; i++)
+                {
+                    int sx = std::min(std::max(left + i, 0), source.width - 1);
+                    for (int c = 0; c < 4; c++)
+                        sum[c] += weights[i] * row[sx * 4 + c];
+                }
+                memcpy(out + x * 4, sum, sizeof(sum));
+            }
+        }
+    });
+
+    runParallel(workers, [&](unsigned w) {
+        int first = target.height * w / workers, last = target.height * (w + 1) / workers;
+        for (int y = first; y < last; y++)
+        {
+            // Clamp the tap rows once per row, not per channel
+            const float* rows[8];
+            for (int i = 0; i < 8; i++)
+                rows[i] = &horizontal[(size_t)std::min(std::max(2 * y - 3 + i, 0), source.height - 1) * target.width * 4];
+            unsigned char* out = &target.pixels[(size_t)y * target.width * 4];
+            int x = 0;
+
+#ifdef TEXTURE_USE_SSE2
+            // One pixel (4 channels) per iteration; +0.5 and truncation round like the scalar path
+            const __m128 half = _mm_set1_ps(0.5f), lowest = _mm_setzero_ps(), highest = _mm_set1_ps(255.0f);
+            for (; x + 4 <= target.width * 4; x += 4)
+            {
+                __m128 sum = _mm_setzero_ps();
+                for (int i = 0; i < 8; i++)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[i]), _mm_loadu_ps(rows[i] + x)));
+                sum = _mm_min_ps(highest, _mm_max_ps(lowest, _mm_add_ps(sum, half)));
+                __m128i values = _mm_cvttps_epi32(sum);
+                values = _mm_packs_epi32(values, values);
+                int packed = _mm_cvtsi128_si32(_mm_packus_epi16(values, values));
+                memcpy(out + x, &packed, 4);
+            }
+#endif
+
+            // Scalar tail (the whole row without SSE2)
+            for (; x < target.width * 4; x++)
+            {
+                float sum = 0.0f;
+                for (int i = 0; i < 8; i++)
+                    sum += weights[i] * rows[i][x];
+                out[x] = (unsigned char)std::min(255.0f, std::max(0.0f, sum + 0.5f));
+            }
+        }
+    });
+}
+
+Image downsampleImage(const Image& source, MipFilter filter)
+{
+    Image target;
+    target.width = std::max(1, source.width / 2);
+    target.height = std::max(1, source.height / 2);
+    target.pixels.resize((size_t)target.width * target.height * 4);
+
+    // Split rows over the job workers (--job-threads) once the level is big enough to be worth it
+    unsigned workers = std::max(1u, std::min(jobWorkerCount(), (unsigned)(target.height / 64 + 1)));
+    if (filter == MIP_FILTER_KAISER)
+        kaiserFilter(source, target, workers);
+    else
+        runParallel(workers, [&](unsigned w) {
+            boxFilterRows(source, target, target.height * w / workers, target.height * (w + 1) / workers);
+        });
+    return target;
+}
+
+// ---------------------------------------------------------------------------
+// Streamer
+// ---------------------------------------------------------------------------
+
+// One pixel unpack buffer of the upload ring
+struct UnpackSlot
+{
+    unsigned int buffer = 0; // GL_PIXEL_UNPACK_BUFFER
+    GLsync fence = nullptr; // Signalled when the GPU has consumed the slot
+};
+
+static std::vector<std::thread> textureThreads; // Decode/mip workers
+static WorkQueue<TextureResource*> textureQueue; // Requested textures
+static std::mutex textureMutex; // Guards decodedTextures
+static std::vector<TextureResource*> decodedTextures; // Decoded, waiting for storage on the render thread
+static std::vector<TextureResource*> uploadingTextures; // Render thread: being streamed, front first
+static std::vector<TextureResource*> queryTextures; // Render thread: waiting for their GPU mip timing
+static std::vector<std::unique_ptr<TextureResource>> allTextures; // Owns every texture
+static std::vector<UnpackSlot> unpackRing; // Ring of pixel unpack buffers
+static size_t unpackSlotBytes = 0; // Size of each ring slot
+static size_t unpackCursor = 0; // Next slot to use
+
+static void textureWorker()
+{
+    PROFILE_THREAD("texture worker");
+    TextureResource* texture;
+    while (popWork(textureQueue, texture))
+    {
+        PROFILE_SCOPE("texture job");
+        texture->state = TEXTURE_DECODING;
+        double start = nowMs();
+
+        // A compressed chain cached by an earlier run skips decoding entirely, unless the image was edited since
+        // or the chain was filtered differently
+        std::string cachePath;
+        CompressedTexture stamp;
+        if (texture->compression != BLOCK_FORMAT_NONE)
+        {
+            const char* suffixes[4] = { "", ".bc1.btc", ".bc3.btc", ".bc7.btc" };
+            cachePath = texture->path + suffixes[texture->compression];
+            std::error_code error;
+            stamp.sourceSize = (uint64_t)std::filesystem::file_size(texture->path, error);
+            stamp.sourceTime = (int64_t)std::filesystem::last_write_time(texture->path, error).time_since_epoch().count();
+            stamp.mipFilter = (uint32_t)texture->filter;
+            if (readCompressedTexture(cachePath.c_str(), texture->compressed) && texture->compressed.format == texture->compression
+                && texture->compressed.sourceSize == stamp.sourceSize && texture->compressed.sourceTime == stamp.sourceTime
+                && texture->compressed.mipFilter == stamp.mipFilter)
+            {
+                texture->decodeMs = nowMs() - start;
+                texture->state = TEXTURE_UPLOADING;
+                std::lock_guard<std::mutex> lock(textureMutex);
+                decodedTextures.push_back(texture);
+                continue;
+            }
+        }
+
+        Image base;
+        if (!decodeImage(texture->path.c_str(), base))
+        {
+            texture->state = TEXTURE_FAILED;
+            continue;
+        }
+        double decoded = nowMs();
+        texture->decodeMs = decoded - start;
+
+        texture->levels.push_back(std::move(base));
+        if (texture->filter != MIP_FILTER_GPU)
+            while (texture->levels.back().width > 1 || texture->levels.back().height > 1)
+                texture->levels.push_back(downsampleImage(texture->levels.back(), texture->filter));
+        double filtered = nowMs();
+        texture->mipMs = filtered - decoded;
+
+        if (texture->compression != BLOCK_FORMAT_NONE)
+        {
+            texture->compressed.levels.clear(); // A stale cache may have been read
+            texture->compressed.format = texture->compression;
+            texture->compressed.sourceSize = stamp.sourceSize;
+            texture->compressed.sourceTime = stamp.sourceTime;
+            texture->compressed.mipFilter = stamp.mipFilter;
+            for (const Image& level : texture->levels)
+                texture->compressed.levels.push_back(compressImage(level, texture->compression, jobWorkerCount()));
+            texture->compressMs = nowMs() - filtered;
+            std::vector<Image>().swap(texture->levels); // Only the blocks are uploaded
+            if (!writeCompressedTexture(cachePath.c_str(), texture->compressed))
+                std::cout << "Failed to write texture cache: " << cachePath << std::endl;
+        }
+
+        texture->state = TEXTURE_UPLOADING;
+        std::lock_guard<std::mutex> lock(textureMutex);
+        decodedTextures.push_back(texture);
+    }
+}
+
+// Allocate every level up front so the texture is complete once the data has streamed in
+static void allocateTexture(TextureResource* texture)
+{
+    glGenTextures(1, &texture->texture);
+    glBindTexture(GL_TEXTURE_2D, texture->texture);
+
+    int levelCount = 1;
+    if (texture->compression != BLOCK_FORMAT_NONE)
+        levelCount = (int)texture->compressed.levels.size(); // Storage comes with each glCompressedTexImage2D
+    else
+    {
+        const Image& base = texture->levels[0];
+        for (int w = base.width, h = base.height; w > 1 || h > 1; w = std::max(1, w / 2), h = std::max(1, h / 2))
+            levelCount++;
+        for (int level = 0, w = base.width, h = base.height; level < levelCount; level++, w = std::max(1, w / 2), h = std::max(1, h / 2))
+            glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levelCount - 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    texture->uploadStart = nowMs();
+}
+
+static void finishTexture(TextureResource* texture)
+{
+    if (texture->filter == MIP_FILTER_GPU)
+    {
+        glGenQueries(1, &texture->gpuMipQuery);
+        glBeginQuery(GL_TIME_ELAPSED, texture->gpuMipQuery);
+        glGenerateMipmap(GL_TEXTURE_2D);
+        glEndQuery(GL_TIME_ELAPSED);
+        queryTextures.push_back(texture);
+    }
+
+    double wallMs = nowMs() - texture->uploadStart;
+    double megabytes = texture->uploadedBytes / (1024.0 * 1024.0);
+    bool compressed = texture->compression != BLOCK_FORMAT_NONE;
+    int width = compressed ? texture->compressed.levels[0].width : texture->levels[0].width;
+    int height = compressed ? texture->compressed.levels[0].height : texture->levels[0].height;
+    std::cout << "Texture " << texture->path << ": " << width << "x" << height;
+    if (compressed)
+        std::cout << ", " << (texture->compressMs > 0.0 ? "compressed in " : "loaded from cache, ") << texture->compressMs << " ms";
+    std::cout << ", decode " << texture->decodeMs << " ms, CPU mips " << texture->mipMs << " ms, uploaded "
+              << megabytes << " MB in " << wallMs << " ms wall (" << megabytes / std::max(wallMs, 1e-3) * 1000.0
+              << " MB/s), " << texture->uploadCpuMs << " ms on the render thread ("
+              << megabytes / std::max(texture->uploadCpuMs, 1e-3) * 1000.0 << " MB/s)" << std::endl;
+
+    std::vector<Image>().swap(texture->levels); // CPU copy no longer needed
+    std::vector<CompressedLevel>().swap(texture->compressed.levels);
+    texture->state = TEXTURE_READY;
+}
+
+// Copy up to budget bytes of the front texture through one ring slot; returns bytes sent, 0 if the ring is busy
+static size_t uploadNextBand(TextureResource* texture, size_t budget)
+{
+    UnpackSlot& slot = unpackRing[unpackCursor];
+    if (slot.fence)
+    {
+        // Never stall: if the GPU is still reading this slot, try again next frame
+        if (glClientWaitSync(slot.fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+            return 0;
+        glDeleteSync(slot.fence);
+        slot.fence = nullptr;
+    }
+
+    double start = nowMs();
+    const Image& level = texture->levels[texture->uploadLevel];
+    size_t rowBytes = (size_t)level.width * 4;
+    size_t maxRows = std::max<size_t>(1, std::min(unpackSlotBytes, budget) / rowBytes);
+    int rows = (int)std::min<size_t>(maxRows, (size_t)(level.height - texture->uploadRow));
+    size_t bytes = rows * rowBytes;
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer);
+    if (bytes > unpackSlotBytes)
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, bytes, NULL, GL_STREAM_DRAW); // A single row wider than a slot
+    void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes,
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    glBindTexture(GL_TEXTURE_2D, texture->texture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    if (mapped)
+    {
+        memcpy(mapped, &level.pixels[texture->uploadRow * rowBytes], bytes);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        glTexSubImage2D(GL_TEXTURE_2D, texture->uploadLevel, 0, texture->uploadRow, level.width, rows,
+            GL_RGBA, GL_UNSIGNED_BYTE, (void*)0); // Sourced from the bound unpack buffer
+        slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+    else
+    {
+        // Mapping failed: direct upload. Unbind first, or GL reads the pointer as an offset into the buffer
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        glTexSubImage2D(GL_TEXTURE_2D, texture->uploadLevel, 0, texture->uploadRow, level.width, rows,
+            GL_RGBA, GL_UNSIGNED_BYTE, &level.pixels[texture->uploadRow * rowBytes]);
+    }
+    unpackCursor = (unpackCursor + 1) % unpackRing.size();
+
+    texture->uploadRow += rows;
+    texture->uploadedBytes += bytes;
+    texture->uploadCpuMs += nowMs() - start;
+    return bytes;
+}
+
+// Compressed levels are a fraction of the RGBA size, so each goes up whole from client memory
+static size_t uploadCompressedLevel(TextureResource* texture)
+{
+    double start = nowMs();
+    const CompressedLevel& level = texture->compressed.levels[texture->uploadLevel];
+    glBindTexture(GL_TEXTURE_2D, texture->texture);
+    glCompressedTexImage2D(GL_TEXTURE_2D, texture->uploadLevel, blockGlFormat(texture->compression), level.width, level.height,
+        0, (GLsizei)level.data.size(), level.data.data());
+    texture->uploadLevel++;
+    texture->uploadedBytes += level.data.size();
+    texture->uploadCpuMs += nowMs() - start;
+    return level.data.size();
+}
+
+void startTextureStreamer(int workerThreads, int ringSlots, size_t slotBytes)
+{
+    unpackSlotBytes = slotBytes;
+    unpackRing.resize(ringSlots);
+    for (UnpackSlot& slot : unpackRing)
+    {
+        glGenBuffers(1, &slot.buffer);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, slotBytes, NULL, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    reopenWork(textureQueue);
+    for (int i = 0; i < workerThreads; i++)
+        textureThreads.emplace_back(textureWorker);
+}
+
+TextureResource* requestTexture(const char* path, MipFilter filter, BlockFormat compression)
+{
+    allTextures.emplace_back(new TextureResource());
+    TextureResource* texture = allTextures.back().get();
+    texture->path = path;
+    texture->filter = filter;
+    texture->compression = compression;
+    if (compression != BLOCK_FORMAT_NONE && filter == MIP_FILTER_GPU)
+        texture->filter = MIP_FILTER_BOX; // glGenerateMipmap cannot produce compressed levels
+    pushWork(textureQueue, texture);
+    return texture;
+}
+
+void updateTextureStreamer(size_t byteBudget)
+{
+    {
+        std::lock_guard<std::mutex> lock(textureMutex);
+        for (TextureResource* texture : decodedTextures)
+        {
+            allocateTexture(texture);
+            uploadingTextures.push_back(texture);
+        }
+        decodedTextures.clear();
+    }
+
+    while (byteBudget > 0 && !uploadingTextures.empty() && !unpackRing.empty())
+    {
+        TextureResource* texture = uploadingTextures.front();
+        if (texture->compression != BLOCK_FORMAT_NONE)
+        {
+            byteBudget -= std::min(uploadCompressedLevel(texture), byteBudget);
+            if (texture->uploadLevel == (int)texture->compressed.levels.size())
+            {
+                finishTexture(texture);
+                uploadingTextures.erase(uploadingTextures.begin());
+            }
+            continue;
+        }
+
+        size_t sent = uploadNextBand(texture, byteBudget);
+        if (sent == 0)
+            break; // Ring is full
+        byteBudget -= std::min(sent, byteBudget);
+
+        if (texture->uploadRow == texture->levels[texture->uploadLevel].height)
+        {
+            texture->uploadRow = 0;
+            if (++texture->uploadLevel == (int)texture->levels.size())
+            {
+                glBindTexture(GL_TEXTURE_2D, texture->texture);
+                finishTexture(texture);
+                uploadingTextures.erase(uploadingTextures.begin());
+            }
+        }
+    }
+
+    // Report GPU mip generation time once the query result is in
+    for (size_t i = 0; i < queryTextures.size();)
+    {
+        GLint available = 0;
+        glGetQueryObjectiv(queryTextures[i]->gpuMipQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+        {
+            i++;
+            continue;
+        }
+        GLuint64 nanoseconds = 0;
+        glGetQueryObjectui64v(queryTextures[i]->gpuMipQuery, GL_QUERY_RESULT, &nanoseconds);
+        std::cout << "Texture " << queryTextures[i]->path << ": glGenerateMipmap took " << nanoseconds / 1.0e6 << " ms on the GPU" << std::endl;
+        glDeleteQueries(1, &queryTextures[i]->gpuMipQuery);
+        queryTextures[i]->gpuMipQuery = 0;
+        queryTextures.erase(queryTextures.begin() + i);
+    }
+}
+
+void stopTextureStreamer()
+{
+    closeWork(textureQueue);
+    for (std::thread& thread : textureThreads)
+        thread.join();
+    textureThreads.clear();
+
+    for (UnpackSlot& slot : unpackRing)
+    {
+        if (slot.fence)
+            glDeleteSync(slot.fence);
+        glDeleteBuffers(1, &slot.buffer);
+    }
+    unpackRing.clear();
+
+    for (std::unique_ptr<TextureResource>& texture : allTextures)
+    {
+        if (texture->texture)
+            glDeleteTextures(1, &texture->texture);
+        if (texture->gpuMipQuery)
+            glDeleteQueries(1, &texture->gpuMipQuery);
+    }
+    allTextures.clear();
+    decodedTextures.clear();
+    uploadingTextures.clear();
+    queryTextures.clear();
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <glad/glad.h> // GL types
+#include <atomic> // Texture state shared between threads
+#include <string> // Texture path
+#include <vector> // Mip chains
+#include "Image.h" // RGBA8 images
+#include "TextureCompression.h" // Block-compressed mip chains
+
+// How the mip chain is produced
+enum MipFilter
+{
+    MIP_FILTER_BOX, // 2x2 average on the CPU (SSE2 when available)
+    MIP_FILTER_KAISER, // 8-tap Kaiser-windowed sinc on the CPU
+    MIP_FILTER_GPU // Upload level 0 only and call glGenerateMipmap
+};
+
+// Life cycle of a streamed texture
+enum TextureState
+{
+    TEXTURE_QUEUED, // Waiting for a worker
+    TEXTURE_DECODING, // Being decoded / filtered on a worker
+    TEXTURE_UPLOADING, // Streaming through the pixel unpack ring
+    TEXTURE_READY, // Complete and sampleable
+    TEXTURE_FAILED // Decode failed
+};
+
+struct TextureResource
+{
+    std::string path; // Source file (.tga or .ppm)
+    MipFilter filter = MIP_FILTER_BOX; // Mip generation mode
+    std::atomic<int> state{ TEXTURE_QUEUED }; // TextureState
+    unsigned int texture = 0; // GL texture name
+    std::vector<Image> levels; // CPU mip chain (just level 0 with MIP_FILTER_GPU)
+    BlockFormat compression = BLOCK_FORMAT_NONE; // Block format to encode to, if any
+    CompressedTexture compressed; // Compressed mip chain when compression is set
+    double compressMs = 0.0; // Worker time for block compression (0 when loaded from the cache)
+    int uploadLevel = 0; // Next level to upload
+    int uploadRow = 0; // Next row of that level
+    double decodeMs = 0.0; // Worker time for decoding
+    double mipMs = 0.0; // Worker time for CPU mip generation
+    double uploadStart = 0.0; // Time the first upload was issued
+    double uploadCpuMs = 0.0; // Render-thread time spent copying into PBOs and issuing uploads
+    size_t uploadedBytes = 0; // Bytes pushed through the ring
+    unsigned int gpuMipQuery = 0; // GL_TIME_ELAPSED query around glGenerateMipmap
+};
+
+// Decode an uncompressed/RLE .tga or a binary .ppm (P6) into RGBA8
+bool decodeImage(const char* path, Image& image);
+
+// Halve an image (at least 1x1) with the given CPU filter
+Image downsampleImage(const Image& source, MipFilter filter);
+
+// Start worker threads and a ring of pixel unpack buffers (render context current)
+void startTextureStreamer(int workerThreads, int ringSlots, size_t slotBytes);
+
+// Queue a texture for decode -> mip -> [compress] -> upload.
+// Compressed chains are cached next to the image as <path>.bc1.btc / .bc3.btc / .bc7.btc.
+TextureResource* requestTexture(const char* path, MipFilter filter, BlockFormat compression);
+
+// Render thread, once per frame: stream up to byteBudget bytes of mip data into textures
+void updateTextureStreamer(size_t byteBudget);
+
+// Stop the workers and delete the ring and every texture
+void stopTextureStreamer();
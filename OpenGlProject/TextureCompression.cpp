@@ -0,0 +1,746 @@
+#include "TextureCompression.h"
+#include "FileMapping.h" // Reading .btc files
+#include "Parallel.h" // runParallel
+#include "Texture.h" // decodeImage for the benchmark
+#include <algorithm> // std::min / std::max
+#include <chrono> // Benchmark timing
+#include <cmath> // sqrt / log10
+#include <cstring> // memcpy / strstr
+#include <fstream> // Writing .btc files
+#include <iostream> // For outputting errors and messages
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h> // SSE2 index selection
+#define COMPRESSION_USE_SSE2 1
+#endif
+
+int blockBytes(BlockFormat format)
+{
+    switch (format)
+    {
+    case BLOCK_FORMAT_BC1: return 8;
+    case BLOCK_FORMAT_BC3: return 16;
+    case BLOCK_FORMAT_BC7: return 16;
+    default: return 0;
+    }
+}
+
+GLenum blockGlFormat(BlockFormat format)
+{
+    switch (format)
+    {
+    case BLOCK_FORMAT_BC1: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+    case BLOCK_FORMAT_BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    case BLOCK_FORMAT_BC7: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+    default: return GL_RGBA8;
+    }
+}
+
+bool isBlockFormatSupported(BlockFormat format)
+{
+    if (format == BLOCK_FORMAT_NONE)
+        return true;
+    if (format == BLOCK_FORMAT_BC7 && (GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 2)))
+        return true; // BPTC is core since 4.2
+
+    const char* wanted = format == BLOCK_FORMAT_BC7 ? "GL_ARB_texture_compression_bptc" : "GL_EXT_texture_compression_s3tc";
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; i++)
+    {
+        const char* name = (const char*)glGetStringi(GL_EXTENSIONS, i);
+        if (name && strcmp(name, wanted) == 0)
+            return true;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// Shared block helpers
+// ---------------------------------------------------------------------------
+
+// Copy a 4x4 block (clamped at the image edge) into 16 RGBA pixels
+static void loadBlock(const Image& image, int bx, int by, uint8_t block[64])
+{
+    for (int y = 0; y < 4; y++)
+    {
+        int sy = std::min(by * 4 + y, image.height - 1);
+        for (int x = 0; x < 4; x++)
+        {
+            int sx = std::min(bx * 4 + x, image.width - 1);
+            memcpy(&block[(y * 4 + x) * 4], &image.pixels[((size_t)sy * image.width + sx) * 4], 4);
+        }
+    }
+}
+
+static void storeBlock(Image& image, int bx, int by, const uint8_t block[64])
+{
+    for (int y = 0; y < 4 && by * 4 + y < image.height; y++)
+        for (int x = 0; x < 4 && bx * 4 + x < image.width; x++)
+            memcpy(&image.pixels[((size_t)(by * 4 + y) * image.width + bx * 4 + x) * 4], &block[(y * 4 + x) * 4], 4);
+}
+
+// Dominant direction of the pixels in the first dims channels (power iteration on the covariance)
+static void principalAxis(const uint8_t block[64], int dims, float mean[4], float axis[4])
+{
+    float minimum[4] = { 255, 255, 255, 255 }, maximum[4] = { 0, 0, 0, 0 };
+    for (int c = 0; c < 4; c++)
+        mean[c] = 0.0f;
+    for (int i = 0; i < 16; i++)
+        for (int c = 0; c < dims; c++)
+        {
+            mean[c] += block[i * 4 + c] / 16.0f;
+            minimum[c] = std::min(minimum[c], (float)block[i * 4 + c]);
+            maximum[c] = std::max(maximum[c], (float)block[i * 4 + c]);
+        }
+
+    float covariance[4][4] = {};
+    for (int i = 0; i < 16; i++)
+        for (int a = 0; a < dims; a++)
+            for (int b = 0; b < dims; b++)
+                covariance[a][b] += (block[i * 4 + a] - mean[a]) * (block[i * 4 + b] - mean[b]);
+
+    for (int c = 0; c < 4; c++)
+        axis[c] = c < dims ? maximum[c] - minimum[c] : 0.0f; // Start from the bounding box diagonal
+    for (int iteration = 0; iteration < 4; iteration++)
+    {
+        float next[4] = {};
+        for (int a = 0; a < dims; a++)
+            for (int b = 0; b < dims; b++)
+                next[a] += covariance[a][b] * axis[b];
+        float length = 0.0f;
+        for (int c = 0; c < dims; c++)
+            length = std::max(length, std::fabs(next[c]));
+        if (length < 1e-6f)
+            break; // Flat block: keep the diagonal
+        for (int c = 0; c < dims; c++)
+            axis[c] = next[c] / length;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// BC1 color block
+// ---------------------------------------------------------------------------
+
+static uint16_t packRgb565(const float color[3])
+{
+    int r = std::min(31, std::max(0, (int)(color[0] * 31.0f / 255.0f + 0.5f)));
+    int g = std::min(63, std::max(0, (int)(color[1] * 63.0f / 255.0f + 0.5f)));
+    int b = std::min(31, std::max(0, (int)(color[2] * 31.0f / 255.0f + 0.5f)));
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static void unpackRgb565(uint16_t value, int color[3])
+{
+    int r = (value >> 11) & 31, g = (value >> 5) & 63, b = value & 31;
+    color[0] = (r << 3) | (r >> 2);
+    color[1] = (g << 2) | (g >> 4);
+    color[2] = (b << 3) | (b >> 2);
+}
+
+// 4-color palette in BC1 index order: c0, c1, 2/3 c0 + 1/3 c1, 1/3 c0 + 2/3 c1
+static void bc1Palette(uint16_t c0, uint16_t c1, int palette[4][3])
+{
+    unpackRgb565(c0, palette[0]);
+    unpackRgb565(c1, palette[1]);
+    for (int c = 0; c < 3; c++)
+    {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    }
+}
+
+// Nearest palette entry for each of the 16 pixels; returns the packed 2-bit indices
+static uint32_t bc1SelectIndices(const uint8_t block[64], const int palette[4][3], uint8_t indices[16])
+{
+#ifdef COMPRESSION_USE_SSE2
+    // Four pixels per iteration, distances to all four palette colors in float lanes
+    for (int i = 0; i < 16; i += 4)
+    {
+        __m128 r = _mm_set_ps(block[(i + 3) * 4], block[(i + 2) * 4], block[(i + 1) * 4], block[i * 4]);
+        __m128 g = _mm_set_ps(block[(i + 3) * 4 + 1], block[(i + 2) * 4 + 1], block[(i + 1) * 4 + 1], block[i * 4 + 1]);
+        __m128 b = _mm_set_ps(block[(i + 3) * 4 + 2], block[(i + 2) * 4 + 2], block[(i + 1) * 4 + 2], block[i * 4 + 2]);
+        __m128 best = _mm_set1_ps(1e30f);
+        __m128i bestIndex = _mm_setzero_si128();
+        for (int k = 0; k < 4; k++)
+        {
+            __m128 dr = _mm_sub_ps(r, _mm_set1_ps((float)palette[k][0]));
+            __m128 dg = _mm_sub_ps(g, _mm_set1_ps((float)palette[k][1]));
+            __m128 db = _mm_sub_ps(b, _mm_set1_ps((float)palette[k][2]));
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db));
+            __m128i closer = _mm_castps_si128(_mm_cmplt_ps(distance, best));
+            best = _mm_min_ps(best, distance);
+            bestIndex = _mm_or_si128(_mm_andnot_si128(closer, bestIndex), _mm_and_si128(closer, _mm_set1_epi32(k)));
+        }
+        alignas(16) int lanes[4];
+        _mm_store_si128((__m128i*)lanes, bestIndex);
+        for (int j = 0; j < 4; j++)
+            indices[i + j] = (uint8_t)lanes[j];
+    }
+#else
+    for (int i = 0; i < 16; i++)
+    {
+        int bestDistance = INT32_MAX;
+        for (int k = 0; k < 4; k++)
+        {
+            int dr = block[i * 4] - palette[k][0], dg = block[i * 4 + 1] - palette[k][1], db = block[i * 4 + 2] - palette[k][2];
+            int distance = dr * dr + dg * dg + db * db;
+            if (distance < bestDistance)
+            {
+                bestDistance = distance;
+                indices[i] = (uint8_t)k;
+            }
+        }
+    }
+#endif
+    uint32_t packed = 0;
+    for (int i = 0; i < 16; i++)
+        packed |= (uint32_t)indices[i] << (2 * i);
+    return packed;
+}
+
+// Least-squares endpoints for fixed indices; returns false if the system is degenerate
+static bool bc1RefineEndpoints(const uint8_t block[64], const uint8_t indices[16], float e0[3], float e1[3])
+{
+    static const float weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f }; // Share of c0 per index
+    float aa = 0, ab = 0, bb = 0, ax[3] = {}, bx[3] = {};
+    for (int i = 0; i < 16; i++)
+    {
+        float a = weights[indices[i]], b = 1.0f - a;
+        aa += a * a; ab += a * b; bb += b * b;
+        for (int c = 0; c < 3; c++)
+        {
+            ax[c] += a * block[i * 4 + c];
+            bx[c] += b * block[i * 4 + c];
+        }
+    }
+    float determinant = aa * bb - ab * ab;
+    if (std::fabs(determinant) < 1e-6f)
+        return false;
+    for (int c = 0; c < 3; c++)
+    {
+        e0[c] = (ax[c] * bb - bx[c] * ab) / determinant;
+        e1[c] = (bx[c] * aa - ax[c] * ab) / determinant;
+    }
+    return true;
+}
+
+static void encodeBc1Color(const uint8_t block[64], uint8_t out[8])
+{
+    float mean[4], axis[4];
+    principalAxis(block, 3, mean, axis);
+
+    // Endpoints at the extreme projections onto the axis
+    float lowest = 1e30f, highest = -1e30f;
+    for (int i = 0; i < 16; i++)
+    {
+        float t = 0.0f;
+        for (int c = 0; c < 3; c++)
+            t += (block[i * 4 + c] - mean[c]) * axis[c];
+        lowest = std::min(lowest, t);
+        highest = std::max(highest, t);
+    }
+    float e0[3], e1[3];
+    for (int c = 0; c < 3; c++)
+    {
+        e0[c] = mean[c] + axis[c] * highest;
+        e1[c] = mean[c] + axis[c] * lowest;
+    }
+
+    uint16_t c0 = packRgb565(e0), c1 = packRgb565(e1);
+    int palette[4][3];
+    uint8_t indices[16];
+    bc1Palette(std::max(c0, c1), std::min(c0, c1), palette);
+    bc1SelectIndices(block, palette, indices);
+
+    // One least-squares pass usually gains 1-2 dB
+    if (c0 != c1 && bc1RefineEndpoints(block, indices, e0, e1))
+    {
+        c0 = packRgb565(e0);
+        c1 = packRgb565(e1);
+    }
+
+    // 4-color mode needs c0 > c1
+    if (c0 < c1)
+        std::swap(c0, c1);
+    uint32_t packed = 0;
+    if (c0 != c1)
+    {
+        bc1Palette(c0, c1, palette);
+        packed = bc1SelectIndices(block, palette, indices);
+    }
+
+    out[0] = (uint8_t)(c0 & 0xFF); out[1] = (uint8_t)(c0 >> 8);
+    out[2] = (uint8_t)(c1 & 0xFF); out[3] = (uint8_t)(c1 >> 8);
+    memcpy(out + 4, &packed, 4); // Little endian
+}
+
+// ---------------------------------------------------------------------------
+// BC3 alpha block
+// ---------------------------------------------------------------------------
+
+static void bc3AlphaPalette(int a0, int a1, int palette[8])
+{
+    palette[0] = a0;
+    palette[1] = a1;
+    for (int k = 2; k < 8; k++)
+        palette[k] = ((8 - k) * a0 + (k - 1) * a1) / 7; // 8-value mode (a0 > a1)
+}
+
+static void encodeBc3Alpha(const uint8_t block[64], uint8_t out[8])
+{
+    int a0 = 0, a1 = 255;
+    for (int i = 0; i < 16; i++)
+    {
+        a0 = std::max(a0, (int)block[i * 4 + 3]);
+        a1 = std::min(a1, (int)block[i * 4 + 3]);
+    }
+    out[0] = (uint8_t)a0;
+    out[1] = (uint8_t)a1;
+
+    uint64_t packed = 0;
+    if (a0 != a1)
+    {
+        int palette[8];
+        bc3AlphaPalette(a0, a1, palette);
+        for (int i = 0; i < 16; i++)
+        {
+            int best = 0, bestDistance = 256;
+            for (int k = 0; k < 8; k++)
+            {
+                int distance = std::abs(block[i * 4 + 3] - palette[k]);
+                if (distance < bestDistance)
+                {
+                    bestDistance = distance;
+                    best = k;
+                }
+            }
+            packed |= (uint64_t)best << (3 * i);
+        }
+    }
+    for (int i = 0; i < 6; i++)
+        out[2 + i] = (uint8_t)(packed >> (8 * i));
+}
+
+// ---------------------------------------------------------------------------
+// BC7 mode 6
+// ---------------------------------------------------------------------------
+
+static const int bc7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+// LSB-first bit stream over 16 bytes
+struct BitStream
+{
+    uint8_t* bytes; // Block being written or read
+    int position = 0; // Next bit
+};
+
+static void writeBits(BitStream& stream, uint32_t value, int count)
+{
+    for (int i = 0; i < count; i++, stream.position++)
+        if (value & (1u << i))
+            stream.bytes[stream.position >> 3] |= (uint8_t)(1u << (stream.position & 7));
+}
+
+static uint32_t readBits(BitStream& stream, int count)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < count; i++, stream.position++)
+        value |= (uint32_t)((stream.bytes[stream.position >> 3] >> (stream.position & 7)) & 1) << i;
+    return value;
+}
+
+// Quantize an RGBA endpoint to 7 bits per channel plus a shared p-bit, picking the better p-bit
+static void quantizeBc7Endpoint(const float endpoint[4], int quantized[4], int& pBit)
+{
+    float bestError = 1e30f;
+    for (int p = 0; p < 2; p++)
+    {
+        int candidate[4];
+        float error = 0.0f;
+        for (int c = 0; c < 4; c++)
+        {
+            candidate[c] = std::min(127, std::max(0, (int)((endpoint[c] - p) / 2.0f + 0.5f)));
+            float difference = (float)((candidate[c] << 1) | p) - endpoint[c];
+            error += difference * difference;
+        }
+        if (error < bestError)
+        {
+            bestError = error;
+            pBit = p;
+            memcpy(quantized, candidate, sizeof(candidate));
+        }
+    }
+}
+
+static void encodeBc7Mode6(const uint8_t block[64], uint8_t out[16])
+{
+    float mean[4], axis[4];
+    principalAxis(block, 4, mean, axis);
+
+    float lowest = 1e30f, highest = -1e30f;
+    for (int i = 0; i < 16; i++)
+    {
+        float t = 0.0f;
+        for (int c = 0; c < 4; c++)
+            t += (block[i * 4 + c] - mean[c]) * axis[c];
+        lowest = std::min(lowest, t);
+        highest = std::max(highest, t);
+    }
+
+    float e0[4], e1[4];
+    for (int c = 0; c < 4; c++)
+    {
+        e0[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * lowest));
+        e1[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * highest));
+    }
+    int q0[4], q1[4], p0 = 0, p1 = 0;
+    quantizeBc7Endpoint(e0, q0, p0);
+    quantizeBc7Endpoint(e1, q1, p1);
+
+    // Nearest of the 16 interpolated colors
+    int endpoint0[4], endpoint1[4], palette[16][4];
+    for (int c = 0; c < 4; c++)
+    {
+        endpoint0[c] = (q0[c] << 1) | p0;
+        endpoint1[c] = (q1[c] << 1) | p1;
+    }
+    for (int k = 0; k < 16; k++)
+        for (int c = 0; c < 4; c++)
+            palette[k][c] = ((64 - bc7Weights4[k]) * endpoint0[c] + bc7Weights4[k] * endpoint1[c] + 32) >> 6;
+
+    int indices[16];
+    for (int i = 0; i < 16; i++)
+    {
+        int bestDistance = INT32_MAX;
+        for (int k = 0; k < 16; k++)
+        {
+            int distance = 0;
+            for (int c = 0; c < 4; c++)
+            {
+                int difference = block[i * 4 + c] - palette[k][c];
+                distance += difference * difference;
+            }
+            if (distance < bestDistance)
+            {
+                bestDistance = distance;
+                indices[i] = k;
+            }
+        }
+    }
+
+    // The anchor (pixel 0) index is stored with 3 bits, so its top bit must be 0
+    if (indices[0] & 8)
+    {
+        std::swap(q0, q1);
+        std::swap(p0, p1);
+        for (int i = 0; i < 16; i++)
+            indices[i] = 15 - indices[i];
+    }
+
+    memset(out, 0, 16);
+    BitStream stream = { out };
+    writeBits(stream, 1 << 6, 7); // Mode 6
+    for (int c = 0; c < 4; c++)
+    {
+        writeBits(stream, q0[c], 7);
+        writeBits(stream, q1[c], 7);
+    }
+    writeBits(stream, p0, 1);
+    writeBits(stream, p1, 1);
+    writeBits(stream, indices[0], 3);
+    for (int i = 1; i < 16; i++)
+        writeBits(stream, indices[i], 4);
+}
+
+// ---------------------------------------------------------------------------
+// Encode / decode
+// ---------------------------------------------------------------------------
+
+CompressedLevel compressImage(const Image& image, BlockFormat format, unsigned threads)
+{
+    CompressedLevel level;
+    level.width = image.width;
+    level.height = image.height;
+    int blocksX = (image.width + 3) / 4, blocksY = (image.height + 3) / 4, bytes = blockBytes(format);
+    level.data.resize((size_t)blocksX * blocksY * bytes);
+
+    threads = std::max(1u, std::min(threads, (unsigned)blocksY));
+    runParallel(threads, [&](unsigned t) {
+        uint8_t block[64];
+        for (int by = blocksY * t / threads; by < (int)(blocksY * (t + 1) / threads); by++)
+            for (int bx = 0; bx < blocksX; bx++)
+            {
+                uint8_t* out = &level.data[((size_t)by * blocksX + bx) * bytes];
+                loadBlock(image, bx, by, block);
+                if (format == BLOCK_FORMAT_BC1)
+                    encodeBc1Color(block, out);
+                else if (format == BLOCK_FORMAT_BC3)
+                {
+                    encodeBc3Alpha(block, out);
+                    encodeBc1Color(block, out + 8);
+                }
+                else
+                    encodeBc7Mode6(block, out);
+            }
+    });
+    return level;
+}
+
+static void decodeBc1Color(const uint8_t* in, uint8_t block[64], bool alwaysFourColor)
+{
+    uint16_t c0 = (uint16_t)(in[0] | (in[1] << 8)), c1 = (uint16_t)(in[2] | (in[3] << 8));
+    int palette[4][3];
+    bc1Palette(c0, c1, palette);
+    bool transparentBlack = !alwaysFourColor && c0 <= c1;
+    if (transparentBlack)
+        for (int c = 0; c < 3; c++)
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+    uint32_t packed;
+    memcpy(&packed, in + 4, 4);
+    for (int i = 0; i < 16; i++)
+    {
+        int index = (packed >> (2 * i)) & 3;
+        for (int c = 0; c < 3; c++)
+            block[i * 4 + c] = (uint8_t)palette[index][c];
+        block[i * 4 + 3] = (transparentBlack && index == 3) ? 0 : 255;
+    }
+}
+
+static void decodeBc3Alpha(const uint8_t* in, uint8_t block[64])
+{
+    int a0 = in[0], a1 = in[1], palette[8];
+    if (a0 > a1)
+        bc3AlphaPalette(a0, a1, palette);
+    else
+    {
+        palette[0] = a0;
+        palette[1] = a1;
+        for (int k = 2; k < 6; k++)
+            palette[k] = ((6 - k) * a0 + (k - 1) * a1) / 5; // 6-value mode
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+    uint64_t packed = 0;
+    for (int i = 0; i < 6; i++)
+        packed |= (uint64_t)in[2 + i] << (8 * i);
+    for (int i = 0; i < 16; i++)
+        block[i * 4 + 3] = (uint8_t)palette[(packed >> (3 * i)) & 7];
+}
+
+// Only mode 6 is decoded; that is all the encoder emits
+static void decodeBc7Mode6(const uint8_t* in, uint8_t block[64])
+{
+    BitStream stream = { (uint8_t*)in };
+    if (readBits(stream, 7) != (1 << 6))
+    {
+        memset(block, 0, 64);
+        return;
+    }
+    int q0[4], q1[4];
+    for (int c = 0; c < 4; c++)
+    {
+        q0[c] = (int)readBits(stream, 7);
+        q1[c] = (int)readBits(stream, 7);
+    }
+    int p0 = (int)readBits(stream, 1), p1 = (int)readBits(stream, 1);
+    for (int i = 0; i < 16; i++)
+    {
+        int index = (int)readBits(stream, i == 0 ? 3 : 4);
+        for (int c = 0; c < 4; c++)
+        {
+            int endpoint0 = (q0[c] << 1) | p0, endpoint1 = (q1[c] << 1) | p1;
+            block[i * 4 + c] = (uint8_t)(((64 - bc7Weights4[index]) * endpoint0 + bc7Weights4[index] * endpoint1 + 32) >> 6);
+        }
+    }
+}
+
+Image decompressLevel(const CompressedLevel& level, BlockFormat format)
+{
+    Image image;
+    image.width = level.width;
+    image.height = level.height;
+    image.pixels.resize((size_t)level.width * level.height * 4);
+    int blocksX = (level.width + 3) / 4, blocksY = (level.height + 3) / 4, bytes = blockBytes(format);
+    uint8_t block[64];
+    for (int by = 0; by < blocksY; by++)
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            const uint8_t* in = &level.data[((size_t)by * blocksX + bx) * bytes];
+            if (format == BLOCK_FORMAT_BC1)
+                decodeBc1Color(in, block, false);
+            else if (format == BLOCK_FORMAT_BC3)
+            {
+                decodeBc1Color(in + 8, block, true);
+                decodeBc3Alpha(in, block);
+            }
+            else
+                decodeBc7Mode6(in, block);
+            storeBlock(image, bx, by, block);
+        }
+    return image;
+}
+
+double imagePsnr(const Image& a, const Image& b, bool withAlpha)
+{
+    int channels = withAlpha ? 4 : 3;
+    double sum = 0.0;
+    size_t pixelCount = (size_t)a.width * a.height;
+    for (size_t i = 0; i < pixelCount; i++)
+        for (int c = 0; c < channels; c++)
+        {
+            double difference = (double)a.pixels[i * 4 + c] - b.pixels[i * 4 + c];
+            sum += difference * difference;
+        }
+    double mse = sum / (double)(pixelCount * channels);
+    return mse > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mse) : 99.0;
+}
+
+// ---------------------------------------------------------------------------
+// .btc container
+// ---------------------------------------------------------------------------
+
+const uint32_t BTC_MAGIC = 0x31435442; // "BTC1" in little endian
+const uint32_t BTC_VERSION = 3; // Bump whenever the layout changes
+const uint32_t BTC_MAX_DIMENSION = 16384; // Largest level accepted from a file; beyond any GL_MAX_TEXTURE_SIZE we upload to
+
+struct BtcHeader
+{
+    uint32_t magic; // BTC_MAGIC
+    uint32_t version; // BTC_VERSION
+    uint32_t format; // BlockFormat
+    uint32_t levelCount; // Entries in the level table
+    uint64_t sourceSize; // CompressedTexture::sourceSize
+    int64_t sourceTime; // CompressedTexture::sourceTime
+    uint32_t mipFilter; // CompressedTexture::mipFilter
+    uint32_t width; // Level 0 width in pixels
+    uint32_t height; // Level 0 height in pixels
+    uint32_t reserved; // Keeps the level table 8-byte aligned
+};
+
+struct BtcLevel
+{
+    uint32_t width; // Level width in pixels
+    uint32_t height; // Level height in pixels
+    uint64_t offset; // File offset of the blocks
+    uint64_t size; // Size of the blocks in bytes
+};
+
+bool writeCompressedTexture(const char* path, const CompressedTexture& texture)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        return false;
+
+    if (texture.levels.empty())
+        return false;
+    BtcHeader header = { BTC_MAGIC, BTC_VERSION, (uint32_t)texture.format, (uint32_t)texture.levels.size(),
+                         texture.sourceSize, texture.sourceTime, texture.mipFilter,
+                         (uint32_t)texture.levels[0].width, (uint32_t)texture.levels[0].height, 0 };
+    out.write((const char*)&header, sizeof(header));
+    uint64_t offset = sizeof(BtcHeader) + texture.levels.size() * sizeof(BtcLevel);
+    for (const CompressedLevel& level : texture.levels)
+    {
+        BtcLevel entry = { (uint32_t)level.width, (uint32_t)level.height, offset, level.data.size() };
+        out.write((const char*)&entry, sizeof(entry));
+        offset += level.data.size();
+    }
+    for (const CompressedLevel& level : texture.levels)
+        out.write((const char*)level.data.data(), (std::streamsize)level.data.size());
+    return (bool)out;
+}
+
+bool readCompressedTexture(const char* path, CompressedTexture& texture)
+{
+    MappedFile file;
+    if (!mapFile(path, file))
+        return false;
+
+    const BtcHeader* header = (const BtcHeader*)file.data;
+    bool valid = file.size >= sizeof(BtcHeader) && header->magic == BTC_MAGIC && header->version == BTC_VERSION
+        && header->format >= BLOCK_FORMAT_BC1 && header->format <= BLOCK_FORMAT_BC7 && header->levelCount > 0
+        && header->levelCount <= (file.size - sizeof(BtcHeader)) / sizeof(BtcLevel)
+        && header->width >= 1 && header->width <= BTC_MAX_DIMENSION && header->height >= 1 && header->height <= BTC_MAX_DIMENSION;
+
+    texture.levels.clear();
+    if (valid)
+    {
+        texture.format = (BlockFormat)header->format;
+        texture.sourceSize = header->sourceSize;
+        texture.sourceTime = header->sourceTime;
+        texture.mipFilter = header->mipFilter;
+        const BtcLevel* entries = (const BtcLevel*)(file.data + sizeof(BtcHeader));
+        uint32_t width = header->width, height = header->height; // Expected size of the next level
+        for (uint32_t i = 0; i < header->levelCount && valid; i++)
+        {
+            // The levels must form the chain down from the header's size, ending at 1x1 at the latest
+            const BtcLevel& entry = entries[i];
+            valid = entry.width == width && entry.height == height && (i == 0 || entries[i - 1].width > 1 || entries[i - 1].height > 1);
+            if (!valid)
+                break;
+            width = std::max(1u, width / 2);
+            height = std::max(1u, height / 2);
+            uint64_t expected = (uint64_t)((entry.width + 3) / 4) * ((entry.height + 3) / 4) * blockBytes(texture.format);
+            valid = entry.size == expected && entry.offset <= file.size && entry.size <= file.size - entry.offset;
+            if (!valid)
+                break;
+            CompressedLevel level;
+            level.width = (int)entry.width;
+            level.height = (int)entry.height;
+            level.data.assign(file.data + entry.offset, file.data + entry.offset + entry.size);
+            texture.levels.push_back(std::move(level));
+        }
+    }
+    unmapFile(file);
+    if (!valid)
+        texture.levels.clear();
+    return valid;
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark
+// ---------------------------------------------------------------------------
+
+void runCompressionBenchmark(const char* imagePath)
+{
+    Image image;
+    if (!decodeImage(imagePath, image))
+        return;
+
+    const char* names[4] = { "none", "BC1", "BC3", "BC7" };
+    startJobSystem(); // Runs before main() starts it; a no-op otherwise
+    unsigned cores = jobWorkerCount();
+    double megapixels = (double)image.width * image.height / 1.0e6;
+    std::cout << imagePath << ": " << image.width << "x" << image.height << ", " << cores << " threads available" << std::endl;
+
+    for (int format = BLOCK_FORMAT_BC1; format <= BLOCK_FORMAT_BC7; format++)
+    {
+        CompressedLevel level;
+        double rates[2] = { 0.0, 0.0 };
+        unsigned threadCounts[2] = { 1u, cores };
+        for (int run = 0; run < 2; run++)
+        {
+            // Repeat until at least half a second has been measured
+            int iterations = 0;
+            auto start = std::chrono::steady_clock::now();
+            double seconds = 0.0;
+            do
+            {
+                level = compressImage(image, (BlockFormat)format, threadCounts[run]);
+                iterations++;
+                seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            } while (seconds < 0.5);
+            rates[run] = megapixels * iterations / seconds;
+        }
+
+        Image decoded = decompressLevel(level, (BlockFormat)format);
+        std::cout << "  " << names[format] << ": PSNR RGB " << imagePsnr(image, decoded, false) << " dB";
+        if (format != BLOCK_FORMAT_BC1)
+            std::cout << ", RGBA " << imagePsnr(image, decoded, true) << " dB";
+        std::cout << ", " << rates[0] << " MPix/s (1 thread), " << rates[1] << " MPix/s (" << cores << " threads), "
+                  << level.data.size() / 1024 << " KB" << std::endl;
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint> // Block bytes
+#include <vector> // Compressed levels
+#include <glad/glad.h> // GLenum
+#include "Image.h" // RGBA8 images
+
+// S3TC/BPTC enums; glad was generated for core 3.3 without these extensions
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GL_COMPRESSED_RGBA_BPTC_UNORM 0x8E8C
+#endif
+
+// Block-compressed formats the encoder can produce
+enum BlockFormat
+{
+    BLOCK_FORMAT_NONE, // Uncompressed RGBA8
+    BLOCK_FORMAT_BC1, // 4 bpp RGB, 8 bytes per 4x4 block
+    BLOCK_FORMAT_BC3, // 8 bpp RGBA, BC1 color + 8-bit interpolated alpha
+    BLOCK_FORMAT_BC7 // 8 bpp RGBA, mode 6 only (fast)
+};
+
+// One compressed mip level
+struct CompressedLevel
+{
+    int width = 0; // Width in pixels
+    int height = 0; // Height in pixels
+    std::vector<uint8_t> data; // Blocks in row-major order
+};
+
+// A whole compressed mip chain
+struct CompressedTexture
+{
+    BlockFormat format = BLOCK_FORMAT_NONE; // Block format of every level
+    std::vector<CompressedLevel> levels; // Level 0 first
+    uint64_t sourceSize = 0; // Size of the image the chain was made from
+    int64_t sourceTime = 0; // Its modification time, in file clock ticks
+    uint32_t mipFilter = 0; // MipFilter the levels were generated with
+};
+
+// Bytes per 4x4 block (0 for BLOCK_FORMAT_NONE)
+int blockBytes(BlockFormat format);
+
+// GL internal format for glCompressedTexImage2D
+GLenum blockGlFormat(BlockFormat format);
+
+// True if the current context exposes the extension (or core version) the format needs
+bool isBlockFormatSupported(BlockFormat format);
+
+// Compress one image; block rows are split across threads
+CompressedLevel compressImage(const Image& image, BlockFormat format, unsigned threads);
+
+// Decode a compressed level back to RGBA8 (used for PSNR)
+Image decompressLevel(const CompressedLevel& level, BlockFormat format);
+
+// Peak signal-to-noise ratio in dB over RGB (or RGBA when withAlpha)
+double imagePsnr(const Image& a, const Image& b, bool withAlpha);
+
+// Compressed texture container (.btc): header, level table, blocks. The header records the source image's size
+// and modification time and the mip filter, so a cache user can tell when the chain is stale.
+bool writeCompressedTexture(const char* path, const CompressedTexture& texture);
+bool readCompressedTexture(const char* path, CompressedTexture& texture);
+
+// Encode-throughput and PSNR benchmark over BC1/BC3/BC7 for one image
+void runCompressionBenchmark(const char* imagePath);
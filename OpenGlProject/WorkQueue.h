@@ -0,0 +1,57 @@
+#pragma once
+#include <condition_variable> // Queue wake-ups
+#include <deque> // Queue storage
+#include <mutex> // Queue lock
+
+// Blocking queue between pipeline stages
+template <typename T>
+struct WorkQueue
+{
+    std::mutex mutex; // Guards items/closed
+    std::condition_variable ready; // Signalled on push and close
+    std::deque<T> items; // Pending work
+    bool closed = false; // No more work will arrive
+};
+
+template <typename T>
+void pushWork(WorkQueue<T>& queue, T item)
+{
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.items.push_back(item);
+    }
+    queue.ready.notify_one();
+}
+
+// Blocks until an item is available; returns false once the queue is closed
+template <typename T>
+bool popWork(WorkQueue<T>& queue, T& item)
+{
+    std::unique_lock<std::mutex> lock(queue.mutex);
+    queue.ready.wait(lock, [&] { return queue.closed || !queue.items.empty(); });
+    if (queue.closed)
+        return false;
+    item = queue.items.front();
+    queue.items.pop_front();
+    return true;
+}
+
+// Wake every waiting worker and make popWork fail from now on
+template <typename T>
+void closeWork(WorkQueue<T>& queue)
+{
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.closed = true;
+    }
+    queue.ready.notify_all();
+}
+
+// Make the queue usable again after closeWork
+template <typename T>
+void reopenWork(WorkQueue<T>& queue)
+{
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.items.clear();
+    queue.closed = false;
+}
@@ -4,23 +4,54 @@
 #include <glm/glm.hpp> // Core GLM types and functions
 #include <glm/gtc/matrix_transform.hpp> // Matrix transformation functions like translate/rotate
 #include <glm/gtc/type_ptr.hpp> // For converting glm types to OpenGL-friendly pointers
+#include "MeshImporter.h" // OBJ/PLY loading
+#include "MeshCache.h" // Binary .mesh caches
+#include "ResourceLoader.h" // Background mesh streaming
+#include "Texture.h" // Texture streaming
+#include "RenderTargets.h" // Framebuffer size, projection and offscreen targets
+#include "Camera.h" // Cached view matrices
+#include "SceneTransforms.h" // Toggle masks and the animated transform chain
+#include "FrameGraph.h" // Pass scheduling and transient textures
+#include "DynamicResolution.h" // Frame-time driven scene resolution
+#include "NullGL.h" // Headless null driver
+#include "RenderContext.h" // Window, EGL or OSMesa context
+#include "GLTrace.h" // GL call capture and replay
+#include "GLDebug.h" // Debug builds: GL error checks and driver messages
+#include "Profiler.h" // CPU timeline scopes
+#include "Benchmark.h" // Scripted input, virtual clock and frame statistics
+#include "GoldenImages.h" // Golden-image regression check
+#include "JobSystem.h" // Work-stealing worker threads
+#include "FrameAllocator.h" // Per-frame arena
+#include "CommandBuffer.h" // Recorded draws
+#include "ShaderLibrary.h" // Shader files and hot reload
+#include "FramePacing.h" // Frames in flight
+#include "SpscQueue.h" // Input snapshots for the render thread
+#include "Parallel.h" // runParallel
+#include <algorithm> // std::min / std::max
+#include <atomic> // Render thread flags
+#include <cctype> // isdigit
+#include <cstdlib> // atof
+#include <chrono> // Frame timing for benchmarks
+#include <cstring> // strcmp
+#include <thread> // Render thread, waiting for the benchmark texture
 
 // Window size settings
 const unsigned int SCR_WIDTH = 800; // Width of the window
 const unsigned int SCR_HEIGHT = 600; // Height of the window
 
-// Camera vectors
-glm::vec3 cameraPos = glm::vec3(0.0f, 0.0f, 3.0f); // Initial camera position
-glm::vec3 cameraFront = glm::vec3(0.0f, 0.0f, -1.0f); // Direction the camera is looking at
-glm::vec3 cameraUp = glm::vec3(0.0f, 1.0f, 0.0f); // The upward direction relative to the camera
+// Camera driven by input; renderers copy its pose into their own Camera so matrices are rebuilt where they are used
+Camera camera = { glm::vec3(0.0f, 0.0f, 3.0f) }; // Initial camera position, looking along -Z
 
-// Yaw/pitch for mouse movement
-float yaw = -90.0f; // Initial yaw to look along -Z
-float pitch = 0.0f; // Initial pitch
-float lastX = SCR_WIDTH / 2.0f; // Last X position of mouse
-float lastY = SCR_HEIGHT / 2.0f; // Last Y position of mouse
+// Mouse look: cursor events only accumulate, processInput turns the sum into a rotation once per frame
+float pitch = 0.0f; // Degrees, tracked only for the clamp
+double lastX = SCR_WIDTH / 2.0; // Last X position of mouse
+double lastY = SCR_HEIGHT / 2.0; // Last Y position of mouse
+double mouseDeltaX = 0.0; // Motion since the last processInput, in pixels (raw counts with raw motion)
+double mouseDeltaY = 0.0;
+double mouseEventTime = 0.0; // glfwGetTime of the oldest accumulated event, 0 = none
 bool firstMouse = true; // Track if it's the first mouse input
 bool leftMousePressed = false; // Flag to track mouse click status
+const float MOUSE_SENSITIVITY = 0.1f; // Degrees per pixel
 
 // Time tracking
 float deltaTime = 0.0f; // Time between frames
@@ -34,6 +65,22 @@ bool applyShearing = false; // Enable/disable shearing
 bool applyReflection = false; // Enable/disable reflection
 bool keyStates[6] = { false }; // Track pressed state to avoid multiple toggles
 bool toggleStates[6] = { false }; // Track on/off states for each transformation
+int instanceGrid = 1; // Draw an instanceGrid x instanceGrid grid of the mesh
+const float INSTANCE_SPACING = 1.5f; // Distance between grid instances
+const float INSTANCE_PHASE_STEP = 0.25f; // Animation phase between consecutive grid instances, in seconds
+bool cpuTransforms = false; // Build every model matrix on the CPU instead of in the vertex shader
+
+// When toggle-specialized scene shader variants are built
+enum PermutationMode
+{
+    PERMUTATIONS_OFF, // One generic shader branching on the mask uniform
+    PERMUTATIONS_LAZY, // A variant is compiled the first time its mask is drawn
+    PERMUTATIONS_AHEAD_OF_TIME // All variants at startup
+};
+const size_t INPUT_QUEUE_SIZE = 256; // Input snapshots the event thread can queue ahead of the render thread
+const double INPUT_POLL_SECONDS = 0.002; // Longest the event thread waits for events before sampling input again
+
+// Built-in copies of shaders/scene.vert and shaders/scene.frag, used when the files are not found
 
 // Vertex Shader source code
 const char* vertexShaderSource = R"(
@@ -42,52 +89,118 @@ layout (location = 0) in vec3 aPos; // Input vertex position
 layout (location = 1) in vec3 aColor; // Input vertex color
 
 out vec3 ourColor; // Pass color to fragment shader
-
-uniform mat4 model; // Model matrix
-uniform mat4 view; // View (camera) matrix
-uniform mat4 projection; // Projection matrix
+out vec3 localPos; // Object-space position, used to derive texture coordinates
+
+uniform mat4 model; // Model matrix: mesh fit only, or the whole transform when the CPU built it
+uniform mat4 viewProjection; // Projection * view, multiplied once per frame on the CPU
+#ifdef STATIC_TOGGLES
+const int toggles = STATIC_TOGGLES; // Permutation specialized on the mask: untaken branches compile away
+#else
+uniform int toggles; // ToggleBit mask (SceneTransforms.h); 0 when the CPU built the model matrix
+#endif
+uniform float time; // Animation time, wrapped to [0, 2 pi)
+uniform vec4 objectParams; // Per object: xyz = offset, w = animation phase
+
+// Same chain as toggleModelMatrix: translate, rotate, scale, shear, reflect
+mat4 toggleModelMatrix(int mask, float t)
+{
+    mat4 m = mat4(1.0f);
+    if ((mask & 1) != 0) // Translation
+        m[3] = vec4(1.0f, 0.0f, 0.0f, 1.0f);
+    if ((mask & 2) != 0) // Rotation about (0.5, 1, 0)
+    {
+        vec3 axis = normalize(vec3(0.5f, 1.0f, 0.0f));
+        float c = cos(t), s = sin(t);
+        vec3 k = (1.0f - c) * axis;
+        m *= mat4(vec4(c + k.x * axis.x, k.x * axis.y + s * axis.z, k.x * axis.z - s * axis.y, 0.0f),
+                  vec4(k.y * axis.x - s * axis.z, c + k.y * axis.y, k.y * axis.z + s * axis.x, 0.0f),
+                  vec4(k.z * axis.x + s * axis.y, k.z * axis.y - s * axis.x, c + k.z * axis.z, 0.0f),
+                  vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    }
+    if ((mask & 4) != 0) // Scaling
+        m *= mat4(vec4(sin(t) + 1.0f, 0.0f, 0.0f, 0.0f), vec4(0.0f, sin(t) + 1.0f, 0.0f, 0.0f), vec4(0.0f, 0.0f, sin(t) + 1.0f, 0.0f), vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    if ((mask & 8) != 0) // Shear on X axis
+    {
+        mat4 shear = mat4(1.0f);
+        shear[1][0] = 0.5f * sin(t);
+        m *= shear;
+    }
+    if ((mask & 16) != 0) // Reflect X axis
+        m[0] = -m[0];
+    return m;
+}
 
 void main()
 {
-    gl_Position = projection * view * model * vec4(aPos, 1.0f); // Calculate transformed position
+    mat4 animated = toggleModelMatrix(toggles, time + objectParams.w);
+    animated[3].xyz += objectParams.xyz; // translate(offset) * animated
+    gl_Position = viewProjection * (animated * (model * vec4(aPos, 1.0f))); // Matrix-vector products only
     ourColor = aColor; // Forward vertex color to fragment shader
+    localPos = aPos; // Forward object-space position
 })";
 
 // Fragment Shader source code
 const char* fragmentShaderSource = R"(
 #version 330 core // Use GLSL version 3.30
 in vec3 ourColor; // Color from vertex shader
+in vec3 localPos; // Object-space position from vertex shader
 out vec4 FragColor; // Final color output
 
+uniform bool useTexture; // True once the streamed texture is ready
+uniform sampler2D diffuseTexture; // Streamed texture
+
 void main()
 {
     FragColor = vec4(ourColor, 1.0f); // Set the pixel color
+    if (useTexture)
+    {
+        // Box-project along the face normal: the meshes have no UVs
+        vec3 n = abs(cross(dFdx(localPos), dFdy(localPos)));
+        vec2 uv = n.x > n.y && n.x > n.z ? localPos.yz : (n.y > n.z ? localPos.xz : localPos.xy);
+        FragColor *= texture(diffuseTexture, uv + 0.5f); // Tint the texture with the vertex color
+    }
 })";
 
 // Handles all input processing
 void processInput(GLFWwindow* window)
 {
+    // Apply the mouse motion gathered since the last call: yaw about world up, pitch about the camera's right
+    if (mouseDeltaX != 0.0 || mouseDeltaY != 0.0)
+    {
+        float yawDelta = (float)mouseDeltaX * MOUSE_SENSITIVITY;
+        float pitchDelta = glm::clamp(pitch + (float)mouseDeltaY * MOUSE_SENSITIVITY, -89.0f, 89.0f) - pitch; // Clamp pitch to prevent flipping
+        pitch += pitchDelta;
+        glm::quat orientation = glm::angleAxis(glm::radians(-yawDelta), glm::vec3(0.0f, 1.0f, 0.0f)) * camera.orientation
+                              * glm::angleAxis(glm::radians(pitchDelta), glm::vec3(1.0f, 0.0f, 0.0f));
+        setCameraOrientation(camera, glm::normalize(orientation)); // Keep rounding from accumulating
+        mouseDeltaX = mouseDeltaY = 0.0;
+    }
+
     float cameraSpeed = 2.5f * deltaTime; // Adjust camera speed per frame
+    glm::vec3 position = camera.position;
+    glm::vec3 front = cameraForward(camera);
+    glm::vec3 right = cameraRight(camera); // Stays horizontal: the mouse look never rolls
 
     // Move forward
-    if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
-        cameraPos += cameraSpeed * cameraFront;
+    if (inputKeyDown(window, GLFW_KEY_W))
+        position += cameraSpeed * front;
     // Move backward
-    if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
-        cameraPos -= cameraSpeed * cameraFront;
+    if (inputKeyDown(window, GLFW_KEY_S))
+        position -= cameraSpeed * front;
     // Move left
-    if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS)
-        cameraPos -= glm::normalize(glm::cross(cameraFront, cameraUp)) * cameraSpeed;
+    if (inputKeyDown(window, GLFW_KEY_A))
+        position -= right * cameraSpeed;
     // Move right
-    if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS)
-        cameraPos += glm::normalize(glm::cross(cameraFront, cameraUp)) * cameraSpeed;
+    if (inputKeyDown(window, GLFW_KEY_D))
+        position += right * cameraSpeed;
+    setCameraPosition(camera, position);
 
     // Map transformation keys
     int keys[5] = { GLFW_KEY_1, GLFW_KEY_2, GLFW_KEY_3, GLFW_KEY_4, GLFW_KEY_5 };
     bool* flags[5] = { &applyTranslation, &applyRotation, &applyScaling, &applyShearing, &applyReflection };
 
     for (int i = 0; i < 5; i++) {
-        if (glfwGetKey(window, keys[i]) == GLFW_PRESS) {
+        if (inputKeyDown(window, keys[i])) {
             if (!keyStates[i]) { // Only toggle once per key press
                 toggleStates[i] = !toggleStates[i]; // Toggle state
                 *flags[i] = toggleStates[i]; // Update flag
@@ -100,7 +213,7 @@ void processInput(GLFWwindow* window)
     }
 
     // Reset all toggles with '0'
-    if (glfwGetKey(window, GLFW_KEY_0) == GLFW_PRESS) {
+    if (inputKeyDown(window, GLFW_KEY_0)) {
         for (int i = 0; i < 5; i++) {
             toggleStates[i] = false;
             *flags[i] = false;
@@ -108,10 +221,10 @@ void processInput(GLFWwindow* window)
     }
 }
 
-// Resize viewport when window changes
+// Record the new framebuffer size; the viewport and projection follow in updateRenderView
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
-    glViewport(0, 0, width, height); // Set OpenGL viewport
+    resizeRenderView(width, height);
 }
 
 // Handle mouse button events
@@ -122,6 +235,8 @@ void mouse_button_callback(GLFWwindow* window, int button, int action, int mods)
         if (action == GLFW_PRESS)
         {
             glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED); // Lock cursor
+            if (glfwRawMouseMotionSupported())
+                glfwSetInputMode(window, GLFW_RAW_MOUSE_MOTION, GLFW_TRUE); // Unaccelerated motion while locked
             leftMousePressed = true; // Enable mouse movement control
         }
         else if (action == GLFW_RELEASE)
@@ -133,6 +248,142 @@ void mouse_button_callback(GLFWwindow* window, int button, int action, int mods)
     }
 }
 
+// The toggles currently switched on, as a mask
+unsigned currentToggles()
+{
+    return (applyTranslation ? TOGGLE_TRANSLATION : 0) | (applyRotation ? TOGGLE_ROTATION : 0) | (applyScaling ? TOGGLE_SCALING : 0) |
+           (applyShearing ? TOGGLE_SHEARING : 0) | (applyReflection ? TOGGLE_REFLECTION : 0);
+}
+
+// Everything a frame needs from input, handed from the event thread to the render thread
+struct FrameInput
+{
+    double time = 0.0; // Animation time
+    glm::vec3 cameraPos = glm::vec3(0.0f);
+    glm::quat cameraOrientation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    unsigned toggles = 0; // currentToggles()
+    double mouseEventTime = 0.0; // Oldest mouse event behind this camera, 0 = none; for input latency
+};
+
+// Snapshot after processInput; takes the pending mouse event time with it
+FrameInput currentFrameInput(double time)
+{
+    FrameInput input;
+    input.time = time;
+    input.cameraPos = camera.position;
+    input.cameraOrientation = camera.orientation;
+    input.toggles = currentToggles();
+    input.mouseEventTime = mouseEventTime;
+    mouseEventTime = 0.0;
+    return input;
+}
+
+// Uniform locations of the scene shader, looked up on the GL thread so workers can record without GL calls
+struct SceneUniforms
+{
+    unsigned int program = 0;
+    GLint model = -1, viewProjection = -1, useTexture = -1, diffuseTexture = -1;
+    GLint toggles = -1, time = -1, objectParams = -1; // Animated transforms evaluated in the shader
+};
+
+SceneUniforms sceneUniforms(unsigned int shaderProgram)
+{
+    SceneUniforms uniforms;
+    uniforms.program = shaderProgram;
+    uniforms.model = glGetUniformLocation(shaderProgram, "model");
+    uniforms.viewProjection = glGetUniformLocation(shaderProgram, "viewProjection");
+    uniforms.useTexture = glGetUniformLocation(shaderProgram, "useTexture");
+    uniforms.diffuseTexture = glGetUniformLocation(shaderProgram, "diffuseTexture");
+    uniforms.toggles = glGetUniformLocation(shaderProgram, "toggles");
+    uniforms.time = glGetUniformLocation(shaderProgram, "time");
+    uniforms.objectParams = glGetUniformLocation(shaderProgram, "objectParams");
+    return uniforms;
+}
+
+// Record one instance of mesh as a command group (any thread). Per-object state only: the camera and the
+// animation uniforms are set once per frame by drawScene. The shader path uploads the 16-byte parameters, the CPU
+// path the finished 64-byte model matrix.
+void recordSceneDraw(CommandBuffer& commands, const SceneUniforms& uniforms, const MeshResource& mesh, GLuint texture,
+                     const glm::vec4& params, const glm::mat4* model, float depth)
+{
+    beginCommandGroup(commands, commandSortKey(0, uniforms.program, texture, depth));
+    cmdUseProgram(commands, uniforms.program);
+    if (model)
+        cmdUniformMatrix4(commands, uniforms.model, glm::value_ptr(*model));
+    else
+        cmdUniformVec4(commands, uniforms.objectParams, glm::value_ptr(params));
+    cmdUniformInt(commands, uniforms.useTexture, texture != 0);
+    cmdUniformInt(commands, uniforms.diffuseTexture, 0);
+    cmdBindTexture(commands, 0, texture);
+    cmdBindVertexArray(commands, mesh.VAO);
+    if (mesh.EBO)
+        cmdDrawElements(commands, GL_TRIANGLES, (GLsizei)mesh.drawCount, GL_UNSIGNED_INT, 0); // Draw loaded mesh
+    else
+        cmdDrawArrays(commands, GL_TRIANGLES, 0, (GLsizei)mesh.drawCount); // Draw cube
+}
+
+// Clear the bound framebuffer and draw mesh with the scene shader: instanceGrid x instanceGrid copies, recorded
+// in parallel (one command buffer per partition of rows) and replayed here front to back. Each instance animates
+// with its own phase; fit is applied first (mesh space). sceneCamera must be up to date (updateCamera).
+void drawScene(const ShaderProgram& shader, const MeshResource& mesh, const TextureResource* texture, unsigned toggles,
+               double time, const glm::mat4& fit, const Camera& sceneCamera)
+{
+    {
+        PROFILE_SCOPE("clear");
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f); // Set background color
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); // Clear buffers
+    }
+
+    // Locations survive a reload that keeps the uniform layout
+    static SceneUniforms uniforms;
+    static const ShaderProgram* uniformsShader = nullptr;
+    static unsigned uniformsLayout = 0;
+    if (uniformsShader != &shader || uniformsLayout != shader.layoutVersion)
+    {
+        uniforms = sceneUniforms(shader.program);
+        uniformsShader = &shader;
+        uniformsLayout = shader.layoutVersion;
+    }
+    uniforms.program = shader.program;
+    GLuint textureId = texture && texture->state == TEXTURE_READY ? texture->texture : 0; // Bind the texture once it has fully streamed in
+
+    // Uniforms shared by every instance are program state: set them once, the groups only set what differs
+    glUseProgram(shader.program);
+    glUniformMatrix4fv(uniforms.viewProjection, 1, GL_FALSE, glm::value_ptr(sceneCamera.viewProjection));
+    glUniformMatrix4fv(uniforms.model, 1, GL_FALSE, glm::value_ptr(fit));
+    glUniform1i(uniforms.toggles, cpuTransforms ? 0 : (GLint)toggles);
+    glUniform1f(uniforms.time, wrapAnimationTime(time));
+    glUniform4f(uniforms.objectParams, 0.0f, 0.0f, 0.0f, 0.0f); // Identity for the CPU path
+
+    int grid = std::max(1, instanceGrid);
+    unsigned partitions = std::min(jobWorkerCount(), (unsigned)grid);
+    CommandBuffer* buffers = frameAllocateArray<CommandBuffer>(partitions);
+    float farPlane = currentRenderView().farPlane;
+    {
+        PROFILE_SCOPE("record");
+        runParallel(partitions, [&](unsigned p) {
+            CommandBuffer& commands = *new (&buffers[p]) CommandBuffer();
+            for (int row = grid * p / partitions; row < (int)(grid * (p + 1) / partitions); row++)
+                for (int column = 0; column < grid; column++)
+                {
+                    glm::vec3 offset((column - (grid - 1) * 0.5f) * INSTANCE_SPACING, (row - (grid - 1) * 0.5f) * INSTANCE_SPACING, 0.0f);
+                    glm::vec4 params = objectTransformParams(offset, INSTANCE_PHASE_STEP * (row * grid + column));
+                    float depth = -(sceneCamera.view * glm::vec4(offset, 1.0f)).z / farPlane;
+                    if (cpuTransforms)
+                    {
+                        glm::mat4 model = objectModelMatrix(toggles, time, params) * fit; // Center and scale the mesh first
+                        recordSceneDraw(commands, uniforms, mesh, textureId, params, &model, depth);
+                    }
+                    else
+                        recordSceneDraw(commands, uniforms, mesh, textureId, params, nullptr, depth);
+                }
+        });
+    }
+
+    PROFILE_SCOPE("draw");
+    submitCommandBuffers(buffers, partitions);
+}
+
 // Mouse movement callback
 void mouse_callback(GLFWwindow* window, double xpos, double ypos)
 {
@@ -143,41 +394,198 @@ void mouse_callback(GLFWwindow* window, double xpos, double ypos)
         firstMouse = false;
     }
 
-    // Calculate offset since last frame
-    float xoffset = xpos - lastX;
-    float yoffset = lastY - ypos;
+    // Accumulate the offset; the camera turns once per frame in processInput
+    mouseDeltaX += xpos - lastX;
+    mouseDeltaY += lastY - ypos;
     lastX = xpos; lastY = ypos;
+    if (mouseEventTime == 0.0)
+        mouseEventTime = glfwGetTime();
+}
 
-    float sensitivity = 0.1f; // Mouse sensitivity
-    xoffset *= sensitivity;
-    yoffset *= sensitivity;
+int main(int argc, char** argv)
+{
+    // Converter: OpenGlProject --convert model.obj model.mesh [--compress]
+    if (argc >= 4 && strcmp(argv[1], "--convert") == 0)
+        return convertMeshToCache(argv[2], argv[3], argc >= 5 && strcmp(argv[4], "--compress") == 0) ? 0 : -1;
 
-    yaw += xoffset; // Update yaw
-    pitch += yoffset; // Update pitch
+    // Block compression benchmark: OpenGlProject --bench-bc image.tga
+    if (argc >= 3 && strcmp(argv[1], "--bench-bc") == 0)
+    {
+        runCompressionBenchmark(argv[2]);
+        return 0;
+    }
 
-    // Clamp pitch to prevent flipping
-    if (pitch > 89.0f) pitch = 89.0f;
-    if (pitch < -89.0f) pitch = -89.0f;
+    // Animated transform benchmark: OpenGlProject --bench-transforms
+    if (argc >= 2 && strcmp(argv[1], "--bench-transforms") == 0)
+    {
+        runTransformBenchmark();
+        return 0;
+    }
 
-    // Update camera front vector
-    glm::vec3 front;
-    front.x = cos(glm::radians(yaw)) * cos(glm::radians(pitch));
-    front.y = sin(glm::radians(pitch));
-    front.z = sin(glm::radians(yaw)) * cos(glm::radians(pitch));
-    cameraFront = glm::normalize(front);
-    // add some changes
-}
+    // Job system scalability benchmark: OpenGlProject --bench-jobs [--pin-threads]
+    if (argc >= 2 && strcmp(argv[1], "--bench-jobs") == 0)
+    {
+        runJobBenchmark(argc >= 3 && strcmp(argv[2], "--pin-threads") == 0);
+        return 0;
+    }
 
-int main()
-{
-    // Initialize GLFW
+    // Importer check on valid and malformed meshes (no window): OpenGlProject --import-check
+    if (argc >= 2 && strcmp(argv[1], "--import-check") == 0)
+        return runImportSelfCheck() ? 1 : 0;
+
+    // Frame graph check against the mock backend (no window): OpenGlProject --framegraph-check
+    if (argc >= 2 && strcmp(argv[1], "--framegraph-check") == 0)
+    {
+        runFrameGraphSelfCheck();
+        return 0;
+    }
+
+    // Command line: [mesh] [--texture image.tga|.ppm] [--mips box|kaiser|gpu] [--compress bc1|bc3|bc7]
+    //               [--dynamic-res targetMs] [--dynamic-res-range min max] [--upscale bilinear|sharpen]
+    //               [--null-gl [frames]] [--trace out.gltrace] [--replay in.gltrace]
+    //               [--profile out.json|out.pftrace] [--benchmark script.txt] [--record-input out.txt]
+    //               [--golden-check dir] [--golden-update dir] [--job-threads n] [--pin-threads]
+    //               [--instances n] [--single-thread] [--frames-in-flight 1|2]
+    //               [--shader-dir dir] [--no-shader-reload] [--cpu-transforms] [--shader-permutations lazy|aot]
+    //               [--context window|hidden|egl|osmesa] [--frames n]
+    const char* meshPath = NULL; // Mesh to stream, the cube if none
+    const char* texturePath = NULL; // Texture to stream, none if NULL
+    MipFilter mipFilter = MIP_FILTER_BOX; // How the texture's mip chain is built
+    BlockFormat textureCompression = BLOCK_FORMAT_NONE; // Block format the texture is encoded to
+    bool dynamicResolution = false; // Render the scene offscreen at a frame-time driven scale
+    DynamicResolution resolution; // Scale controller settings and state
+    bool nullDriver = false; // Bind glad to the null driver and run without a display
+    int maxFrames = 0; // Stop after this many frames (0 = until the window closes)
+    const char* tracePath = NULL; // Record every GL call to this file
+    const char* replayPath = NULL; // Replay this trace instead of rendering
+    const char* profilePath = NULL; // CPU timeline output (Debug / ENABLE_PROFILING builds only)
+    const char* benchmarkPath = NULL; // Input script to play back on the virtual clock
+    const char* recordPath = NULL; // Record live input to this script
+    const char* goldenDir = NULL; // Render the toggle combinations and compare with (or store as) golden images
+    bool goldenUpdate = false; // Store instead of compare
+    unsigned jobThreads = 0; // Job system threads including the main thread (0 = one per core)
+    bool pinThreads = false; // Bind job workers to cores
+    bool singleThread = false; // Render on the event thread even in interactive runs
+    int framesInFlight = 2; // Frames the CPU may queue ahead of the GPU
+    const char* shaderDir = "shaders"; // Where scene.vert / scene.frag are loaded from
+    bool shaderReload = true; // Watch the shader files and rebuild on change
+    PermutationMode permutationMode = PERMUTATIONS_OFF; // Toggle-specialized scene shaders
+    ContextBackend contextBackend = CONTEXT_WINDOW; // Where the GL context comes from
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--texture") == 0 && i + 1 < argc)
+            texturePath = argv[++i];
+        else if (strcmp(argv[i], "--mips") == 0 && i + 1 < argc)
+        {
+            i++;
+            mipFilter = strcmp(argv[i], "gpu") == 0 ? MIP_FILTER_GPU : (strcmp(argv[i], "kaiser") == 0 ? MIP_FILTER_KAISER : MIP_FILTER_BOX);
+        }
+        else if (strcmp(argv[i], "--compress") == 0 && i + 1 < argc)
+        {
+            i++;
+            textureCompression = strcmp(argv[i], "bc7") == 0 ? BLOCK_FORMAT_BC7 : (strcmp(argv[i], "bc3") == 0 ? BLOCK_FORMAT_BC3 : BLOCK_FORMAT_BC1);
+        }
+        else if (strcmp(argv[i], "--dynamic-res") == 0 && i + 1 < argc)
+        {
+            dynamicResolution = true;
+            resolution.targetMs = (float)atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--dynamic-res-range") == 0 && i + 2 < argc)
+        {
+            resolution.minScale = (float)atof(argv[++i]);
+            resolution.maxScale = (float)atof(argv[++i]);
+            resolution.scale = resolution.maxScale;
+        }
+        else if (strcmp(argv[i], "--upscale") == 0 && i + 1 < argc)
+            resolution.filter = strcmp(argv[++i], "sharpen") == 0 ? UPSCALE_SHARPEN : UPSCALE_BILINEAR;
+        else if (strcmp(argv[i], "--null-gl") == 0)
+        {
+            nullDriver = true;
+            maxFrames = i + 1 < argc && isdigit((unsigned char)argv[i + 1][0]) ? atoi(argv[++i]) : 1000;
+        }
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+            tracePath = argv[++i];
+        else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+            replayPath = argv[++i];
+        else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc)
+            profilePath = argv[++i];
+        else if (strcmp(argv[i], "--benchmark") == 0 && i + 1 < argc)
+            benchmarkPath = argv[++i];
+        else if (strcmp(argv[i], "--record-input") == 0 && i + 1 < argc)
+            recordPath = argv[++i];
+        else if ((strcmp(argv[i], "--golden-check") == 0 || strcmp(argv[i], "--golden-update") == 0) && i + 1 < argc)
+        {
+            goldenUpdate = strcmp(argv[i], "--golden-update") == 0;
+            goldenDir = argv[++i];
+        }
+        else if (strcmp(argv[i], "--job-threads") == 0 && i + 1 < argc)
+            jobThreads = (unsigned)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--pin-threads") == 0)
+            pinThreads = true;
+        else if (strcmp(argv[i], "--instances") == 0 && i + 1 < argc)
+            instanceGrid = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--single-thread") == 0)
+            singleThread = true;
+        else if (strcmp(argv[i], "--frames-in-flight") == 0 && i + 1 < argc)
+            framesInFlight = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--shader-dir") == 0 && i + 1 < argc)
+            shaderDir = argv[++i];
+        else if (strcmp(argv[i], "--no-shader-reload") == 0)
+            shaderReload = false;
+        else if (strcmp(argv[i], "--cpu-transforms") == 0)
+            cpuTransforms = true;
+        else if (strcmp(argv[i], "--shader-permutations") == 0 && i + 1 < argc)
+            permutationMode = strcmp(argv[++i], "aot") == 0 ? PERMUTATIONS_AHEAD_OF_TIME : PERMUTATIONS_LAZY;
+        else if (strcmp(argv[i], "--context") == 0 && i + 1 < argc)
+        {
+            if (!parseContextBackend(argv[++i], contextBackend))
+                std::cout << "Unknown context backend " << argv[i] << ", using a window" << std::endl;
+        }
+        else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+            maxFrames = atoi(argv[++i]);
+        else
+            meshPath = argv[i];
+    }
+
+    // Start before any worker so every thread's first events are kept
+    if (profilePath && !startProfiler(profilePath))
+        std::cout << "Profiling unavailable: build with ENABLE_PROFILING" << std::endl;
+    PROFILE_THREAD("main");
+    startJobSystem(jobThreads, pinThreads); // The main thread is worker 0
+    initFrameArenas(1 << 20, FRAME_ARENA_MAX_BUFFERS); // Grows to the largest frame if 1 MB is not enough
+
+    // EGL and OSMesa contexts have no window anybody could close, so they stop after a frame count
+    bool headless = !nullDriver && isHeadlessBackend(contextBackend);
+    if (headless && maxFrames == 0)
+        maxFrames = 1000;
+
+    // Initialize GLFW; the null driver and headless contexts use GLFW's null platform, so no display is needed
+    if (nullDriver || headless)
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
     glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3); // OpenGL version 3.x
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE); // Use core profile
+    setGlContextHints();
+    if (nullDriver || headless)
+        glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API); // Input and timing only, GL comes from NullGL, EGL or OSMesa
+    if (contextBackend == CONTEXT_HIDDEN)
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    // A replay renders into a hidden window the size the trace was captured at
+    int windowWidth = SCR_WIDTH, windowHeight = SCR_HEIGHT;
+    if (replayPath)
+    {
+        if (!readGlTraceSize(replayPath, windowWidth, windowHeight))
+        {
+            std::cout << "Not a GL trace: " << replayPath << std::endl;
+            glfwTerminate();
+            return -1;
+        }
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    }
+    if (goldenDir)
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE); // Goldens render offscreen
 
     // Create GLFW window
-    GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "3D Cube", NULL, NULL);
+    GLFWwindow* window = glfwCreateWindow(windowWidth, windowHeight, "3D Cube", NULL, NULL);
     if (window == NULL)
     {
         std::cout << "Failed to create GLFW window" << std::endl;
@@ -185,19 +593,56 @@ int main()
         return -1;
     }
 
-    glfwMakeContextCurrent(window); // Set current context
+    // Create the context, make it current and load glad through its getProcAddress
+    RenderContext context;
+    if (!nullDriver && !createRenderContext(context, contextBackend, window, windowWidth, windowHeight))
+    {
+        glfwTerminate();
+        return -1;
+    }
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback); // Window resize callback
     glfwSetCursorPosCallback(window, mouse_callback); // Mouse movement callback
     glfwSetMouseButtonCallback(window, mouse_button_callback); // Mouse click callback
+    if (benchmarkPath)
+    {
+        if (!startInputPlayback(window, benchmarkPath))
+        {
+            glfwTerminate();
+            return -1;
+        }
+        maxFrames = inputScriptFrames();
+    }
+    else if (recordPath)
+        startInputRecording(window, recordPath);
 
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    if (nullDriver && !gladLoadGLLoader((GLADloadproc)nullGlGetProcAddress))
     {
         std::cout << "Failed to initialize GLAD" << std::endl;
         return -1; // Exit if GLAD fails
     }
+    if (!nullDriver)
+        startGlDebug(context.loader); // Debug builds: check every GL call, log driver messages
+
+    if (replayPath)
+    {
+        bool replayed = replayGlTrace(replayPath);
+        stopGlDebug();
+        destroyRenderContext(context);
+        glfwTerminate();
+        return replayed ? 0 : -1;
+    }
+
+    // Start from the real framebuffer size (differs from the window size on high-DPI displays)
+    int framebufferWidth = 0, framebufferHeight = 0;
+    glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+    resizeRenderView(framebufferWidth, framebufferHeight);
+
+    // Everything from here on, including resource creation, goes into the trace
+    if (tracePath)
+        startGlTrace(tracePath, framebufferWidth, framebufferHeight);
 
     // Define cube vertices (position + color)
-    float vertices[] = {
+    float cubeVertices[] = {
         // back face
         -0.5f,-0.5f,-0.5f, 1,0,0, 0.5f,-0.5f,-0.5f, 0,1,0, 0.5f,0.5f,-0.5f, 0,0,1,
          0.5f,0.5f,-0.5f, 0,0,1, -0.5f,0.5f,-0.5f, 1,1,0, -0.5f,-0.5f,-0.5f, 1,1,0,
@@ -215,96 +660,315 @@ int main()
             0.5f,-0.5f,0.5f, 0,0,1, -0.5f,-0.5f,0.5f, 1,1,0, -0.5f,-0.5f,-0.5f, 1,1,0
     };
 
-    // Create and bind VAO/VBO
-    unsigned int VBO, VAO;
-    glGenVertexArrays(1, &VAO); // Create Vertex Array
-    glGenBuffers(1, &VBO); // Create Vertex Buffer
-    glBindVertexArray(VAO); // Bind VAO
-    glBindBuffer(GL_ARRAY_BUFFER, VBO); // Bind buffer
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW); // Upload vertex data
-
-    // Position attribute
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0); // Set layout
-    glEnableVertexAttribArray(0); // Enable position
-
-    // Color attribute
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float))); // Set layout
-    glEnableVertexAttribArray(1); // Enable color
-
-    // Compile vertex shader
-    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-
-    // Compile fragment shader
-    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-
-    // Link shaders into a program
-    unsigned int shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
+    // The cube is uploaded right away and drawn until the requested mesh has streamed in
+    MeshData cubeMesh;
+    cubeMesh.vertices.assign(cubeVertices, cubeVertices + sizeof(cubeVertices) / sizeof(float));
+    computeMeshBounds(cubeMesh);
+    MeshResource* placeholder = createMeshResource(cubeMesh);
+
+    // Stream the mesh (.obj, .ply or .mesh) given on the command line.
+    // The null driver and headless contexts have no shared upload context and a trace only sees this thread, so the mesh is
+    // loaded up front instead.
+    // A benchmark or golden run does the same so the mesh does not pop in on a timing-dependent frame.
+    bool deterministic = benchmarkPath || goldenDir;
+    MeshResource* streamedMesh = nullptr;
+    if (nullDriver || headless || tracePath || deterministic)
+    {
+        MeshData loaded;
+        if (meshPath && loadMesh(meshPath, loaded))
+            streamedMesh = createMeshResource(loaded);
+    }
+    else
+    {
+        startResourceLoader(window, 1, 2);
+        streamedMesh = meshPath ? requestMesh(meshPath) : nullptr;
+    }
+
+    // Stream the texture: decode and mips on workers, uploads through a ring of 3 x 4 MB unpack buffers
+    startTextureStreamer(2, 3, 4 << 20);
+    if (!isBlockFormatSupported(textureCompression))
+    {
+        std::cout << "Block compression not supported by this driver, streaming uncompressed" << std::endl;
+        textureCompression = BLOCK_FORMAT_NONE;
+    }
+    TextureResource* streamedTexture = texturePath ? requestTexture(texturePath, mipFilter, textureCompression) : nullptr;
+    while (deterministic && streamedTexture && streamedTexture->state != TEXTURE_READY && streamedTexture->state != TEXTURE_FAILED)
+    {
+        updateTextureStreamer(SIZE_MAX); // Finish the texture before frame 0 so every run draws the same pixels
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Compile and link the scene shader from its files; interactive runs rebuild it whenever a file is saved
+    ShaderProgram* sceneShader = loadShaderProgram("scene", shaderDir, "scene.vert", "scene.frag", vertexShaderSource, fragmentShaderSource);
+    if (!sceneShader)
+    {
+        glfwTerminate();
+        return -1;
+    }
+    // Optionally one variant per toggle mask, selected each frame instead of branching on the mask uniform
+    ShaderPermutations scenePermutations;
+    initShaderPermutations(scenePermutations, "scene", shaderDir, "scene.vert", "scene.frag", vertexShaderSource, fragmentShaderSource,
+                           "STATIC_TOGGLES", TOGGLE_COMBINATIONS);
+    if (permutationMode == PERMUTATIONS_AHEAD_OF_TIME)
+        compileShaderPermutations(scenePermutations);
+    auto selectSceneShader = [&](unsigned toggles) -> const ShaderProgram& {
+        if (permutationMode == PERMUTATIONS_OFF)
+            return *sceneShader;
+        ShaderProgram* variant = shaderPermutation(scenePermutations, cpuTransforms ? 0 : toggles); // The CPU path uses the identity chain
+        return variant ? *variant : *sceneShader;
+    };
+    if (shaderReload && !nullDriver && !headless && !tracePath && !deterministic)
+        startShaderReload(window);
 
     // Enable depth testing
     glEnable(GL_DEPTH_TEST);
 
+    FrameGraph frameGraph; // Rebuilt every frame, keeps its textures across frames
+
+    // With dynamic resolution the scene goes to an offscreen target and is blitted up to the window
+    RenderTarget* sceneTarget = nullptr;
+    if (dynamicResolution && createUpscaler())
+        sceneTarget = createRenderTarget("scene", { ATTACHMENT_RGBA8, ATTACHMENT_DEPTH24 }, resolution.scale);
+
+    // Golden images replace the render loop
+    int exitCode = 0;
+    bool runLoop = true;
+    if (goldenDir)
+    {
+        const MeshResource* goldenMesh = streamedMesh && streamedMesh->state == RESOURCE_READY ? streamedMesh : placeholder;
+        Camera goldenCamera = camera;
+        int failures = runGoldenImages(goldenDir, goldenUpdate, [&](unsigned toggles, double time, const glm::mat4& projection) {
+            beginFrameArena(); // Each golden frame recycles the arena like a rendered one
+            setCameraProjection(goldenCamera, projection);
+            updateCamera(goldenCamera);
+            drawScene(selectSceneShader(toggles), *goldenMesh, streamedTexture, toggles, time, meshFitMatrix(*goldenMesh), goldenCamera);
+        });
+        exitCode = failures ? 1 : 0;
+        runLoop = false;
+    }
+
+    // One frame of rendering from an input snapshot, on whichever thread owns the context
+    Camera viewCamera; // The snapshot's pose; rebuilt only when it or the projection changed
+    auto renderFrame = [&](const FrameInput& input, float frameSeconds) -> const RenderView& {
+        beginFrameArena(); // Recycles the arena of the frame before last
+        const RenderView& renderView = updateRenderView(); // Apply a pending resize
+        if (sceneTarget)
+        {
+            if (frameSeconds < 0.25f) // Skip stalls such as the first frame
+                updateDynamicResolution(resolution, frameSeconds * 1000.0f);
+            setRenderTargetScale(sceneTarget, resolution.scale);
+            updateRenderTarget(sceneTarget); // Reallocates only when the size class changes
+        }
+        {
+            PROFILE_SCOPE("streaming");
+            pollResourceLoader(); // Pick up meshes the upload thread has finished
+            updateTextureStreamer(8 << 20); // Upload at most 8 MB of texels per frame
+        }
+        pollShaderPrograms(); // Swap in shaders rebuilt since the last frame
+
+        // Draw the streamed mesh once it is ready, the placeholder until then
+        const MeshResource* drawMesh = placeholder;
+        if (streamedMesh && streamedMesh->state == RESOURCE_READY)
+            drawMesh = streamedMesh;
+
+        // Passes go through the frame graph: the scene renders into the window, or into the scaled target plus an upscale
+        beginFrameGraph(frameGraph, glFrameGraphBackend());
+        int backbuffer = importResource(frameGraph, "backbuffer", 0, renderView.width, renderView.height);
+        std::vector<int> sceneWrites = { backbuffer };
+        if (sceneTarget)
+        {
+            int sceneColor = importResource(frameGraph, "sceneColor", sceneTarget->textures[0], sceneTarget->width, sceneTarget->height);
+            int sceneDepth = importResource(frameGraph, "sceneDepth", sceneTarget->textures[1], sceneTarget->width, sceneTarget->height, ATTACHMENT_DEPTH24);
+            sceneWrites = { sceneColor, sceneDepth };
+            addPass(frameGraph, "upscale", { sceneColor }, { backbuffer }, [&](FrameGraph&, const FramePass&) {
+                glm::vec2 texel(1.0f / sceneTarget->allocatedWidth, 1.0f / sceneTarget->allocatedHeight);
+                upscaleTexture(sceneTarget->textures[0], sceneTarget->uvScale, texel, resolution.filter, resolution.sharpness);
+            });
+        }
+        addPass(frameGraph, "scene", {}, sceneWrites, [&](FrameGraph&, const FramePass&) {
+            // Camera matrices; the animated model transforms are evaluated per instance (shader or CPU path)
+            {
+                PROFILE_SCOPE("matrices");
+                setCameraPosition(viewCamera, input.cameraPos);
+                setCameraOrientation(viewCamera, input.cameraOrientation);
+                setCameraProjection(viewCamera, renderView.projection);
+                updateCamera(viewCamera);
+            }
+            drawScene(selectSceneShader(input.toggles), *drawMesh, streamedTexture, input.toggles, input.time, meshFitMatrix(*drawMesh), viewCamera);
+        });
+        {
+            PROFILE_SCOPE("frame graph");
+            compileFrameGraph(frameGraph);
+            executeFrameGraph(frameGraph);
+        }
+
+        endRenderTargetFrame(); // Age pooled offscreen textures
+        return renderView;
+    };
+
+    // Interactive runs render on their own thread; headless, traced, scripted and recorded runs stay on this one so
+    // input frames and rendered frames line up
+    bool renderThreadMode = runLoop && !singleThread && !nullDriver && !headless && !tracePath && !benchmarkPath && !recordPath;
+    FramePacer pacer;
+    initFramePacer(pacer, framesInFlight);
+
     // Render loop
-    while (!glfwWindowShouldClose(window))
+    int frameCount = 0; // Frames rendered so far
+    uint64_t frameChecksum = 0; // Last benchmark frame's pixels
+    double loopStart = glfwGetTime(); // For the null driver report
+    while (!renderThreadMode && runLoop && !glfwWindowShouldClose(window) && (maxFrames == 0 || frameCount < maxFrames))
     {
-        float currentFrame = glfwGetTime(); // Get current time
+        PROFILE_SCOPE("frame");
+        auto frameStart = std::chrono::steady_clock::now();
+        frameCount++;
+        double animationTime = beginInputFrame(); // Wall clock, or the virtual clock in a benchmark
+        float currentFrame = (float)animationTime; // Get current time
         deltaTime = currentFrame - lastFrame; // Time between frames
         lastFrame = currentFrame;
 
-        processInput(window); // Handle input
-
-        // Clear screen
-        glClearColor(0.2f, 0.3f, 0.3f, 1.0f); // Set background color
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); // Clear buffers
+        {
+            PROFILE_SCOPE("input");
+            processInput(window); // Handle input
+        }
+        {
+            PROFILE_SCOPE("frame fence");
+            waitForFrameSlot(pacer); // At most framesInFlight frames queued on the GPU
+        }
+        FrameInput input = currentFrameInput(animationTime);
+        const RenderView& renderView = renderFrame(input, deltaTime);
 
-        glUseProgram(shaderProgram); // Use the shader
-
-        // Create transformation matrices
-        glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)SCR_WIDTH / SCR_HEIGHT, 0.1f, 100.0f);
-        glm::mat4 view = glm::lookAt(cameraPos, cameraPos + cameraFront, cameraUp);
-        glm::mat4 model = glm::mat4(1.0f); // Identity matrix
-
-        // Apply transformations based on toggles
-        if (applyTranslation)
-            model = glm::translate(model, glm::vec3(1.0f, 0.0f, 0.0f));
-        if (applyRotation)
-            model = glm::rotate(model, (float)glfwGetTime(), glm::vec3(0.5f, 1.0f, 0.0f));
-        if (applyScaling)
-            model = glm::scale(model, glm::vec3(sin(glfwGetTime()) + 1.0f));
-        if (applyShearing)
+        if (benchmarkPath && frameCount == maxFrames)
+            frameChecksum = checksumFramebuffer(renderView.width, renderView.height); // Before the swap leaves it undefined
+        endInputFrame(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
         {
-            glm::mat4 shear = glm::mat4(1.0f);
-            shear[1][0] = 0.5f * sin(glfwGetTime()); // Shear on X axis
-            model *= shear;
+            PROFILE_SCOPE("swap");
+            if (!nullDriver)
+                swapRenderContext(context); // Swap front and back buffers
         }
-        if (applyReflection)
+        if (input.mouseEventTime > 0.0 && !isInputPlayback())
+            recordInputLatency(pacer, (glfwGetTime() - input.mouseEventTime) * 1000.0);
+        endPacedFrame(pacer);
+        traceFrameEnd();
         {
-            glm::mat4 reflect = glm::scale(glm::mat4(1.0f), glm::vec3(-1.0f, 1.0f, 1.0f)); // Reflect X axis
-            model *= reflect;
+            PROFILE_SCOPE("poll events");
+            glfwPollEvents(); // Handle window/input events
         }
+    }
 
-        // Pass matrices to shader
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(view));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
+    if (renderThreadMode)
+    {
+        // The render thread owns the context from here; this thread keeps the window, its events and input, and
+        // hands the render thread a snapshot per input update through a lock-free queue
+        static SpscQueue<FrameInput, INPUT_QUEUE_SIZE> inputQueue;
+        std::atomic<bool> rendering{ true };
+        std::atomic<int> renderedFrames{ 0 };
+        size_t droppedInputs = 0; // Queue full: the render thread fell far behind
+        releaseRenderContext(context);
+        std::thread renderThread([&] {
+            PROFILE_THREAD("render");
+            makeRenderContextCurrent(context);
+            FrameInput input;
+            bool haveInput = false;
+            double lastRender = glfwGetTime();
+            while (rendering.load())
+            {
+                // Newest snapshot wins; older ones were superseded before this frame started, but the oldest mouse
+                // event among them is still what this frame answers
+                for (FrameInput next; popSpsc(inputQueue, next);)
+                {
+                    double eventTime = input.mouseEventTime;
+                    input = next;
+                    if (eventTime > 0.0 && (input.mouseEventTime == 0.0 || eventTime < input.mouseEventTime))
+                        input.mouseEventTime = eventTime;
+                    haveInput = true;
+                }
+                if (!haveInput)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    continue;
+                }
+
+                PROFILE_SCOPE("frame");
+                {
+                    PROFILE_SCOPE("frame fence");
+                    waitForFrameSlot(pacer); // At most framesInFlight frames queued on the GPU
+                }
+                double now = glfwGetTime();
+                renderFrame(input, (float)(now - lastRender));
+                lastRender = now;
+                {
+                    PROFILE_SCOPE("swap");
+                    swapRenderContext(context); // Swap front and back buffers
+                }
+                if (input.mouseEventTime > 0.0)
+                {
+                    recordInputLatency(pacer, (glfwGetTime() - input.mouseEventTime) * 1000.0);
+                    input.mouseEventTime = 0.0; // Repeated frames of the same snapshot answer nothing new
+                }
+                endPacedFrame(pacer);
+                renderedFrames++;
+            }
+            releaseRenderContext(context);
+        });
+
+        while (!glfwWindowShouldClose(window))
+        {
+            {
+                PROFILE_SCOPE("poll events");
+                glfwWaitEventsTimeout(INPUT_POLL_SECONDS); // Handle window/input events, or time out to keep moving
+            }
+            double now = glfwGetTime();
+            deltaTime = (float)now - lastFrame; // Time between input updates
+            lastFrame = (float)now;
+            {
+                PROFILE_SCOPE("input");
+                processInput(window); // Handle input
+            }
+            if (!pushSpsc(inputQueue, currentFrameInput(now)))
+                droppedInputs++;
+        }
 
-        glBindVertexArray(VAO); // Bind VAO
-        glDrawArrays(GL_TRIANGLES, 0, 36); // Draw cube
+        rendering = false;
+        renderThread.join();
+        makeRenderContextCurrent(context); // Cleanup below needs the context back
+        frameCount = renderedFrames.load();
+        if (droppedInputs)
+            std::cout << "Render thread fell behind: " << droppedInputs << " input updates dropped" << std::endl;
+    }
 
-        glfwSwapBuffers(window); // Swap front and back buffers
-        glfwPollEvents(); // Handle window/input events
+    if (nullDriver)
+        printNullGlReport(frameCount, (glfwGetTime() - loopStart) * 1000.0);
+    if (benchmarkPath)
+    {
+        // The state checksum also catches input/clock regressions under NullGL, where every pixel reads back as 0
+        glm::vec3 state[2] = { camera.position, cameraForward(camera) };
+        uint64_t stateChecksum = checksumBytes(state, sizeof(state));
+        stateChecksum = checksumBytes(toggleStates, sizeof(toggleStates), stateChecksum);
+        std::cout << "Benchmark checksums: frame 0x" << std::hex << frameChecksum << ", state 0x" << stateChecksum << std::dec << std::endl;
     }
+    stopInput(); // Closes a recording, prints benchmark frame statistics
+    releaseFramePacer(pacer); // Prints how often the CPU waited for the GPU
+    printShaderPermutationStats(scenePermutations, [&](unsigned toggles) {
+        const MeshResource* mesh = streamedMesh && streamedMesh->state == RESOURCE_READY ? streamedMesh : placeholder;
+        return (double)specializedAluSavings(toggles) * mesh->drawCount; // Per vertex times vertices per draw
+    });
 
     // Cleanup
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
+    printRenderTargetStats();
+    printFrameArenaStats();
+    releaseRenderTargets(); // Deletes offscreen framebuffers and pooled textures
+    releaseFrameGraph(frameGraph); // Deletes the graph's transient textures
+    releaseUpscaler();
+    releaseShaderPrograms(); // Stops the shader watcher
+    stopTextureStreamer(); // Joins the texture workers and deletes every texture
+    stopResourceLoader(); // Joins the loader threads and deletes every mesh
+    stopGlTrace(); // Flushes the trace file
+    stopGlDebug(); // Prints the GL error and driver message totals
+    stopJobSystem();
+    releaseFrameArenas();
+    destroyRenderContext(context); // Headless contexts; a window's context goes with the window
+    stopProfiler(); // Writes out the remaining events
     glfwTerminate(); // Close application
 
-    return 0;
+    return exitCode;
 }
@@ -0,0 +1,19 @@
+#version 330 core // Use GLSL version 3.30
+in vec3 ourColor; // Color from vertex shader
+in vec3 localPos; // Object-space position from vertex shader
+out vec4 FragColor; // Final color output
+
+uniform bool useTexture; // True once the streamed texture is ready
+uniform sampler2D diffuseTexture; // Streamed texture
+
+void main()
+{
+    FragColor = vec4(ourColor, 1.0f); // Set the pixel color
+    if (useTexture)
+    {
+        // Box-project along the face normal: the meshes have no UVs
+        vec3 n = abs(cross(dFdx(localPos), dFdy(localPos)));
+        vec2 uv = n.x > n.y && n.x > n.z ? localPos.yz : (n.y > n.z ? localPos.xz : localPos.xy);
+        FragColor *= texture(diffuseTexture, uv + 0.5f); // Tint the texture with the vertex color
+    }
+}
@@ -0,0 +1,54 @@
+#version 330 core // Use GLSL version 3.30
+layout (location = 0) in vec3 aPos; // Input vertex position
+layout (location = 1) in vec3 aColor; // Input vertex color
+
+out vec3 ourColor; // Pass color to fragment shader
+out vec3 localPos; // Object-space position, used to derive texture coordinates
+
+uniform mat4 model; // Model matrix: mesh fit only, or the whole transform when the CPU built it
+uniform mat4 viewProjection; // Projection * view, multiplied once per frame on the CPU
+#ifdef STATIC_TOGGLES
+const int toggles = STATIC_TOGGLES; // Permutation specialized on the mask: untaken branches compile away
+#else
+uniform int toggles; // ToggleBit mask (SceneTransforms.h); 0 when the CPU built the model matrix
+#endif
+uniform float time; // Animation time, wrapped to [0, 2 pi)
+uniform vec4 objectParams; // Per object: xyz = offset, w = animation phase
+
+// Same chain as toggleModelMatrix: translate, rotate, scale, shear, reflect
+mat4 toggleModelMatrix(int mask, float t)
+{
+    mat4 m = mat4(1.0f);
+    if ((mask & 1) != 0) // Translation
+        m[3] = vec4(1.0f, 0.0f, 0.0f, 1.0f);
+    if ((mask & 2) != 0) // Rotation about (0.5, 1, 0)
+    {
+        vec3 axis = normalize(vec3(0.5f, 1.0f, 0.0f));
+        float c = cos(t), s = sin(t);
+        vec3 k = (1.0f - c) * axis;
+        m *= mat4(vec4(c + k.x * axis.x, k.x * axis.y + s * axis.z, k.x * axis.z - s * axis.y, 0.0f),
+                  vec4(k.y * axis.x - s * axis.z, c + k.y * axis.y, k.y * axis.z + s * axis.x, 0.0f),
+                  vec4(k.z * axis.x + s * axis.y, k.z * axis.y - s * axis.x, c + k.z * axis.z, 0.0f),
+                  vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    }
+    if ((mask & 4) != 0) // Scaling
+        m *= mat4(vec4(sin(t) + 1.0f, 0.0f, 0.0f, 0.0f), vec4(0.0f, sin(t) + 1.0f, 0.0f, 0.0f), vec4(0.0f, 0.0f, sin(t) + 1.0f, 0.0f), vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    if ((mask & 8) != 0) // Shear on X axis
+    {
+        mat4 shear = mat4(1.0f);
+        shear[1][0] = 0.5f * sin(t);
+        m *= shear;
+    }
+    if ((mask & 16) != 0) // Reflect X axis
+        m[0] = -m[0];
+    return m;
+}
+
+void main()
+{
+    mat4 animated = toggleModelMatrix(toggles, time + objectParams.w);
+    animated[3].xyz += objectParams.xyz; // translate(offset) * animated
+    gl_Position = viewProjection * (animated * (model * vec4(aPos, 1.0f))); // Matrix-vector products only
+    ourColor = aColor; // Forward vertex color to fragment shader
+    localPos = aPos; // Forward object-space position
+}
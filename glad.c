@@ -641,6 +641,2328 @@ PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
 PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
 PFNGLVIEWPORTPROC glad_glViewport = NULL;
 PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
+
+/* Debug mode: generated by tools/gen_glad_debug.py */
+#ifdef GLAD_DEBUG
+#ifndef GLAD_GL_FUNCTION
+#define GLAD_GL_FUNCTION(type, member, global) (global)
+#endif
+static void _pre_call_callback_default(const char *name, void *funcptr, int len_args, ...) {
+    (void)name; (void)funcptr; (void)len_args;
+}
+static void _post_call_callback_default(const char *name, void *funcptr, int len_args, ...) {
+    (void)name; (void)funcptr; (void)len_args;
+}
+static GLADcallback _pre_call_callback = _pre_call_callback_default;
+void glad_set_pre_callback(GLADcallback cb) {
+    _pre_call_callback = cb ? cb : _pre_call_callback_default;
+}
+static GLADcallback _post_call_callback = _post_call_callback_default;
+void glad_set_post_callback(GLADcallback cb) {
+    _post_call_callback = cb ? cb : _post_call_callback_default;
+}
+static void APIENTRY glad_debug_impl_glCullFace(GLenum arg0) {
+    _pre_call_callback("glCullFace", (void*)glad_glCullFace, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLCULLFACEPROC, CullFace, glad_glCullFace)(arg0);
+    _post_call_callback("glCullFace", (void*)glad_glCullFace, 1, arg0);
+}
+PFNGLCULLFACEPROC glad_debug_glCullFace = glad_debug_impl_glCullFace;
+static void APIENTRY glad_debug_impl_glFrontFace(GLenum arg0) {
+    _pre_call_callback("glFrontFace", (void*)glad_glFrontFace, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLFRONTFACEPROC, FrontFace, glad_glFrontFace)(arg0);
+    _post_call_callback("glFrontFace", (void*)glad_glFrontFace, 1, arg0);
+}
+PFNGLFRONTFACEPROC glad_debug_glFrontFace = glad_debug_impl_glFrontFace;
+static void APIENTRY glad_debug_impl_glHint(GLenum arg0, GLenum arg1) {
+    _pre_call_callback("glHint", (void*)glad_glHint, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLHINTPROC, Hint, glad_glHint)(arg0, arg1);
+    _post_call_callback("glHint", (void*)glad_glHint, 2, arg0, arg1);
+}
+PFNGLHINTPROC glad_debug_glHint = glad_debug_impl_glHint;
+static void APIENTRY glad_debug_impl_glLineWidth(GLfloat arg0) {
+    _pre_call_callback("glLineWidth", (void*)glad_glLineWidth, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLLINEWIDTHPROC, LineWidth, glad_glLineWidth)(arg0);
+    _post_call_callback("glLineWidth", (void*)glad_glLineWidth, 1, arg0);
+}
+PFNGLLINEWIDTHPROC glad_debug_glLineWidth = glad_debug_impl_glLineWidth;
+static void APIENTRY glad_debug_impl_glPointSize(GLfloat arg0) {
+    _pre_call_callback("glPointSize", (void*)glad_glPointSize, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLPOINTSIZEPROC, PointSize, glad_glPointSize)(arg0);
+    _post_call_callback("glPointSize", (void*)glad_glPointSize, 1, arg0);
+}
+PFNGLPOINTSIZEPROC glad_debug_glPointSize = glad_debug_impl_glPointSize;
+static void APIENTRY glad_debug_impl_glPolygonMode(GLenum arg0, GLenum arg1) {
+    _pre_call_callback("glPolygonMode", (void*)glad_glPolygonMode, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLPOLYGONMODEPROC, PolygonMode, glad_glPolygonMode)(arg0, arg1);
+    _post_call_callback("glPolygonMode", (void*)glad_glPolygonMode, 2, arg0, arg1);
+}
+PFNGLPOLYGONMODEPROC glad_debug_glPolygonMode = glad_debug_impl_glPolygonMode;
+static void APIENTRY glad_debug_impl_glScissor(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+    _pre_call_callback("glScissor", (void*)glad_glScissor, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLSCISSORPROC, Scissor, glad_glScissor)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glScissor", (void*)glad_glScissor, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLSCISSORPROC glad_debug_glScissor = glad_debug_impl_glScissor;
+static void APIENTRY glad_debug_impl_glTexParameterf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+    _pre_call_callback("glTexParameterf", (void*)glad_glTexParameterf, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLTEXPARAMETERFPROC, TexParameterf, glad_glTexParameterf)(arg0, arg1, arg2);
+    _post_call_callback("glTexParameterf", (void*)glad_glTexParameterf, 3, arg0, arg1, arg2);
+}
+PFNGLTEXPARAMETERFPROC glad_debug_glTexParameterf = glad_debug_impl_glTexParameterf;
+static void APIENTRY glad_debug_impl_glTexParameterfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+    _pre_call_callback("glTexParameterfv", (void*)glad_glTexParameterfv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLTEXPARAMETERFVPROC, TexParameterfv, glad_glTexParameterfv)(arg0, arg1, arg2);
+    _post_call_callback("glTexParameterfv", (void*)glad_glTexParameterfv, 3, arg0, arg1, arg2);
+}
+PFNGLTEXPARAMETERFVPROC glad_debug_glTexParameterfv = glad_debug_impl_glTexParameterfv;
+static void APIENTRY glad_debug_impl_glTexParameteri(GLenum arg0, GLenum arg1, GLint arg2) {
+    _pre_call_callback("glTexParameteri", (void*)glad_glTexParameteri, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLTEXPARAMETERIPROC, TexParameteri, glad_glTexParameteri)(arg0, arg1, arg2);
+    _post_call_callback("glTexParameteri", (void*)glad_glTexParameteri, 3, arg0, arg1, arg2);
+}
+PFNGLTEXPARAMETERIPROC glad_debug_glTexParameteri = glad_debug_impl_glTexParameteri;
+static void APIENTRY glad_debug_impl_glTexParameteriv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+    _pre_call_callback("glTexParameteriv", (void*)glad_glTexParameteriv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLTEXPARAMETERIVPROC, TexParameteriv, glad_glTexParameteriv)(arg0, arg1, arg2);
+    _post_call_callback("glTexParameteriv", (void*)glad_glTexParameteriv, 3, arg0, arg1, arg2);
+}
+PFNGLTEXPARAMETERIVPROC glad_debug_glTexParameteriv = glad_debug_impl_glTexParameteriv;
+static void APIENTRY glad_debug_impl_glTexImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLint arg4, GLenum arg5, GLenum arg6, const void * arg7) {
+    _pre_call_callback("glTexImage1D", (void*)glad_glTexImage1D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    GLAD_GL_FUNCTION(PFNGLTEXIMAGE1DPROC, TexImage1D, glad_glTexImage1D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    _post_call_callback("glTexImage1D", (void*)glad_glTexImage1D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+PFNGLTEXIMAGE1DPROC glad_debug_glTexImage1D = glad_debug_impl_glTexImage1D;
+static void APIENTRY glad_debug_impl_glTexImage2D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4, GLint arg5, GLenum arg6, GLenum arg7, const void * arg8) {
+    _pre_call_callback("glTexImage2D", (void*)glad_glTexImage2D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    GLAD_GL_FUNCTION(PFNGLTEXIMAGE2DPROC, TexImage2D, glad_glTexImage2D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    _post_call_callback("glTexImage2D", (void*)glad_glTexImage2D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+PFNGLTEXIMAGE2DPROC glad_debug_glTexImage2D = glad_debug_impl_glTexImage2D;
+static void APIENTRY glad_debug_impl_glDrawBuffer(GLenum arg0) {
+    _pre_call_callback("glDrawBuffer", (void*)glad_glDrawBuffer, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLDRAWBUFFERPROC, DrawBuffer, glad_glDrawBuffer)(arg0);
+    _post_call_callback("glDrawBuffer", (void*)glad_glDrawBuffer, 1, arg0);
+}
+PFNGLDRAWBUFFERPROC glad_debug_glDrawBuffer = glad_debug_impl_glDrawBuffer;
+static void APIENTRY glad_debug_impl_glClear(GLbitfield arg0) {
+    _pre_call_callback("glClear", (void*)glad_glClear, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLCLEARPROC, Clear, glad_glClear)(arg0);
+    _post_call_callback("glClear", (void*)glad_glClear, 1, arg0);
+}
+PFNGLCLEARPROC glad_debug_glClear = glad_debug_impl_glClear;
+static void APIENTRY glad_debug_impl_glClearColor(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glClearColor", (void*)glad_glClearColor, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLCLEARCOLORPROC, ClearColor, glad_glClearColor)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glClearColor", (void*)glad_glClearColor, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCLEARCOLORPROC glad_debug_glClearColor = glad_debug_impl_glClearColor;
+static void APIENTRY glad_debug_impl_glClearStencil(GLint arg0) {
+    _pre_call_callback("glClearStencil", (void*)glad_glClearStencil, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLCLEARSTENCILPROC, ClearStencil, glad_glClearStencil)(arg0);
+    _post_call_callback("glClearStencil", (void*)glad_glClearStencil, 1, arg0);
+}
+PFNGLCLEARSTENCILPROC glad_debug_glClearStencil = glad_debug_impl_glClearStencil;
+static void APIENTRY glad_debug_impl_glClearDepth(GLdouble arg0) {
+    _pre_call_callback("glClearDepth", (void*)glad_glClearDepth, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLCLEARDEPTHPROC, ClearDepth, glad_glClearDepth)(arg0);
+    _post_call_callback("glClearDepth", (void*)glad_glClearDepth, 1, arg0);
+}
+PFNGLCLEARDEPTHPROC glad_debug_glClearDepth = glad_debug_impl_glClearDepth;
+static void APIENTRY glad_debug_impl_glStencilMask(GLuint arg0) {
+    _pre_call_callback("glStencilMask", (void*)glad_glStencilMask, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLSTENCILMASKPROC, StencilMask, glad_glStencilMask)(arg0);
+    _post_call_callback("glStencilMask", (void*)glad_glStencilMask, 1, arg0);
+}
+PFNGLSTENCILMASKPROC glad_debug_glStencilMask = glad_debug_impl_glStencilMask;
+static void APIENTRY glad_debug_impl_glColorMask(GLboolean arg0, GLboolean arg1, GLboolean arg2, GLboolean arg3) {
+    _pre_call_callback("glColorMask", (void*)glad_glColorMask, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLCOLORMASKPROC, ColorMask, glad_glColorMask)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glColorMask", (void*)glad_glColorMask, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCOLORMASKPROC glad_debug_glColorMask = glad_debug_impl_glColorMask;
+static void APIENTRY glad_debug_impl_glDepthMask(GLboolean arg0) {
+    _pre_call_callback("glDepthMask", (void*)glad_glDepthMask, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLDEPTHMASKPROC, DepthMask, glad_glDepthMask)(arg0);
+    _post_call_callback("glDepthMask", (void*)glad_glDepthMask, 1, arg0);
+}
+PFNGLDEPTHMASKPROC glad_debug_glDepthMask = glad_debug_impl_glDepthMask;
+static void APIENTRY glad_debug_impl_glDisable(GLenum arg0) {
+    _pre_call_callback("glDisable", (void*)glad_glDisable, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLDISABLEPROC, Disable, glad_glDisable)(arg0);
+    _post_call_callback("glDisable", (void*)glad_glDisable, 1, arg0);
+}
+PFNGLDISABLEPROC glad_debug_glDisable = glad_debug_impl_glDisable;
+static void APIENTRY glad_debug_impl_glEnable(GLenum arg0) {
+    _pre_call_callback("glEnable", (void*)glad_glEnable, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLENABLEPROC, Enable, glad_glEnable)(arg0);
+    _post_call_callback("glEnable", (void*)glad_glEnable, 1, arg0);
+}
+PFNGLENABLEPROC glad_debug_glEnable = glad_debug_impl_glEnable;
+static void APIENTRY glad_debug_impl_glFinish(void) {
+    _pre_call_callback("glFinish", (void*)glad_glFinish, 0);
+    GLAD_GL_FUNCTION(PFNGLFINISHPROC, Finish, glad_glFinish)();
+    _post_call_callback("glFinish", (void*)glad_glFinish, 0);
+}
+PFNGLFINISHPROC glad_debug_glFinish = glad_debug_impl_glFinish;
+static void APIENTRY glad_debug_impl_glFlush(void) {
+    _pre_call_callback("glFlush", (void*)glad_glFlush, 0);
+    GLAD_GL_FUNCTION(PFNGLFLUSHPROC, Flush, glad_glFlush)();
+    _post_call_callback("glFlush", (void*)glad_glFlush, 0);
+}
+PFNGLFLUSHPROC glad_debug_glFlush = glad_debug_impl_glFlush;
+static void APIENTRY glad_debug_impl_glBlendFunc(GLenum arg0, GLenum arg1) {
+    _pre_call_callback("glBlendFunc", (void*)glad_glBlendFunc, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLBLENDFUNCPROC, BlendFunc, glad_glBlendFunc)(arg0, arg1);
+    _post_call_callback("glBlendFunc", (void*)glad_glBlendFunc, 2, arg0, arg1);
+}
+PFNGLBLENDFUNCPROC glad_debug_glBlendFunc = glad_debug_impl_glBlendFunc;
+static void APIENTRY glad_debug_impl_glLogicOp(GLenum arg0) {
+    _pre_call_callback("glLogicOp", (void*)glad_glLogicOp, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLLOGICOPPROC, LogicOp, glad_glLogicOp)(arg0);
+    _post_call_callback("glLogicOp", (void*)glad_glLogicOp, 1, arg0);
+}
+PFNGLLOGICOPPROC glad_debug_glLogicOp = glad_debug_impl_glLogicOp;
+static void APIENTRY glad_debug_impl_glStencilFunc(GLenum arg0, GLint arg1, GLuint arg2) {
+    _pre_call_callback("glStencilFunc", (void*)glad_glStencilFunc, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLSTENCILFUNCPROC, StencilFunc, glad_glStencilFunc)(arg0, arg1, arg2);
+    _post_call_callback("glStencilFunc", (void*)glad_glStencilFunc, 3, arg0, arg1, arg2);
+}
+PFNGLSTENCILFUNCPROC glad_debug_glStencilFunc = glad_debug_impl_glStencilFunc;
+static void APIENTRY glad_debug_impl_glStencilOp(GLenum arg0, GLenum arg1, GLenum arg2) {
+    _pre_call_callback("glStencilOp", (void*)glad_glStencilOp, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLSTENCILOPPROC, StencilOp, glad_glStencilOp)(arg0, arg1, arg2);
+    _post_call_callback("glStencilOp", (void*)glad_glStencilOp, 3, arg0, arg1, arg2);
+}
+PFNGLSTENCILOPPROC glad_debug_glStencilOp = glad_debug_impl_glStencilOp;
+static void APIENTRY glad_debug_impl_glDepthFunc(GLenum arg0) {
+    _pre_call_callback("glDepthFunc", (void*)glad_glDepthFunc, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLDEPTHFUNCPROC, DepthFunc, glad_glDepthFunc)(arg0);
+    _post_call_callback("glDepthFunc", (void*)glad_glDepthFunc, 1, arg0);
+}
+PFNGLDEPTHFUNCPROC glad_debug_glDepthFunc = glad_debug_impl_glDepthFunc;
+static void APIENTRY glad_debug_impl_glPixelStoref(GLenum arg0, GLfloat arg1) {
+    _pre_call_callback("glPixelStoref", (void*)glad_glPixelStoref, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLPIXELSTOREFPROC, PixelStoref, glad_glPixelStoref)(arg0, arg1);
+    _post_call_callback("glPixelStoref", (void*)glad_glPixelStoref, 2, arg0, arg1);
+}
+PFNGLPIXELSTOREFPROC glad_debug_glPixelStoref = glad_debug_impl_glPixelStoref;
+static void APIENTRY glad_debug_impl_glPixelStorei(GLenum arg0, GLint arg1) {
+    _pre_call_callback("glPixelStorei", (void*)glad_glPixelStorei, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLPIXELSTOREIPROC, PixelStorei, glad_glPixelStorei)(arg0, arg1);
+    _post_call_callback("glPixelStorei", (void*)glad_glPixelStorei, 2, arg0, arg1);
+}
+PFNGLPIXELSTOREIPROC glad_debug_glPixelStorei = glad_debug_impl_glPixelStorei;
+static void APIENTRY glad_debug_impl_glReadBuffer(GLenum arg0) {
+    _pre_call_callback("glReadBuffer", (void*)glad_glReadBuffer, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLREADBUFFERPROC, ReadBuffer, glad_glReadBuffer)(arg0);
+    _post_call_callback("glReadBuffer", (void*)glad_glReadBuffer, 1, arg0);
+}
+PFNGLREADBUFFERPROC glad_debug_glReadBuffer = glad_debug_impl_glReadBuffer;
+static void APIENTRY glad_debug_impl_glReadPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4, GLenum arg5, void * arg6) {
+    _pre_call_callback("glReadPixels", (void*)glad_glReadPixels, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    GLAD_GL_FUNCTION(PFNGLREADPIXELSPROC, ReadPixels, glad_glReadPixels)(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glReadPixels", (void*)glad_glReadPixels, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLREADPIXELSPROC glad_debug_glReadPixels = glad_debug_impl_glReadPixels;
+static void APIENTRY glad_debug_impl_glGetBooleanv(GLenum arg0, GLboolean * arg1) {
+    _pre_call_callback("glGetBooleanv", (void*)glad_glGetBooleanv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLGETBOOLEANVPROC, GetBooleanv, glad_glGetBooleanv)(arg0, arg1);
+    _post_call_callback("glGetBooleanv", (void*)glad_glGetBooleanv, 2, arg0, arg1);
+}
+PFNGLGETBOOLEANVPROC glad_debug_glGetBooleanv = glad_debug_impl_glGetBooleanv;
+static void APIENTRY glad_debug_impl_glGetDoublev(GLenum arg0, GLdouble * arg1) {
+    _pre_call_callback("glGetDoublev", (void*)glad_glGetDoublev, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLGETDOUBLEVPROC, GetDoublev, glad_glGetDoublev)(arg0, arg1);
+    _post_call_callback("glGetDoublev", (void*)glad_glGetDoublev, 2, arg0, arg1);
+}
+PFNGLGETDOUBLEVPROC glad_debug_glGetDoublev = glad_debug_impl_glGetDoublev;
+static GLenum APIENTRY glad_debug_impl_glGetError(void) {
+    GLenum ret;
+    _pre_call_callback("glGetError", (void*)glad_glGetError, 0);
+    ret = GLAD_GL_FUNCTION(PFNGLGETERRORPROC, GetError, glad_glGetError)();
+    _post_call_callback("glGetError", (void*)glad_glGetError, 0);
+    return ret;
+}
+PFNGLGETERRORPROC glad_debug_glGetError = glad_debug_impl_glGetError;
+static void APIENTRY glad_debug_impl_glGetFloatv(GLenum arg0, GLfloat * arg1) {
+    _pre_call_callback("glGetFloatv", (void*)glad_glGetFloatv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLGETFLOATVPROC, GetFloatv, glad_glGetFloatv)(arg0, arg1);
+    _post_call_callback("glGetFloatv", (void*)glad_glGetFloatv, 2, arg0, arg1);
+}
+PFNGLGETFLOATVPROC glad_debug_glGetFloatv = glad_debug_impl_glGetFloatv;
+static void APIENTRY glad_debug_impl_glGetIntegerv(GLenum arg0, GLint * arg1) {
+    _pre_call_callback("glGetIntegerv", (void*)glad_glGetIntegerv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLGETINTEGERVPROC, GetIntegerv, glad_glGetIntegerv)(arg0, arg1);
+    _post_call_callback("glGetIntegerv", (void*)glad_glGetIntegerv, 2, arg0, arg1);
+}
+PFNGLGETINTEGERVPROC glad_debug_glGetIntegerv = glad_debug_impl_glGetIntegerv;
+static const GLubyte * APIENTRY glad_debug_impl_glGetString(GLenum arg0) {
+    const GLubyte * ret;
+    _pre_call_callback("glGetString", (void*)glad_glGetString, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLGETSTRINGPROC, GetString, glad_glGetString)(arg0);
+    _post_call_callback("glGetString", (void*)glad_glGetString, 1, arg0);
+    return ret;
+}
+PFNGLGETSTRINGPROC glad_debug_glGetString = glad_debug_impl_glGetString;
+static void APIENTRY glad_debug_impl_glGetTexImage(GLenum arg0, GLint arg1, GLenum arg2, GLenum arg3, void * arg4) {
+    _pre_call_callback("glGetTexImage", (void*)glad_glGetTexImage, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLGETTEXIMAGEPROC, GetTexImage, glad_glGetTexImage)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glGetTexImage", (void*)glad_glGetTexImage, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLGETTEXIMAGEPROC glad_debug_glGetTexImage = glad_debug_impl_glGetTexImage;
+static void APIENTRY glad_debug_impl_glGetTexParameterfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetTexParameterfv", (void*)glad_glGetTexParameterfv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETTEXPARAMETERFVPROC, GetTexParameterfv, glad_glGetTexParameterfv)(arg0, arg1, arg2);
+    _post_call_callback("glGetTexParameterfv", (void*)glad_glGetTexParameterfv, 3, arg0, arg1, arg2);
+}
+PFNGLGETTEXPARAMETERFVPROC glad_debug_glGetTexParameterfv = glad_debug_impl_glGetTexParameterfv;
+static void APIENTRY glad_debug_impl_glGetTexParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetTexParameteriv", (void*)glad_glGetTexParameteriv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETTEXPARAMETERIVPROC, GetTexParameteriv, glad_glGetTexParameteriv)(arg0, arg1, arg2);
+    _post_call_callback("glGetTexParameteriv", (void*)glad_glGetTexParameteriv, 3, arg0, arg1, arg2);
+}
+PFNGLGETTEXPARAMETERIVPROC glad_debug_glGetTexParameteriv = glad_debug_impl_glGetTexParameteriv;
+static void APIENTRY glad_debug_impl_glGetTexLevelParameterfv(GLenum arg0, GLint arg1, GLenum arg2, GLfloat * arg3) {
+    _pre_call_callback("glGetTexLevelParameterfv", (void*)glad_glGetTexLevelParameterfv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLGETTEXLEVELPARAMETERFVPROC, GetTexLevelParameterfv, glad_glGetTexLevelParameterfv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetTexLevelParameterfv", (void*)glad_glGetTexLevelParameterfv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETTEXLEVELPARAMETERFVPROC glad_debug_glGetTexLevelParameterfv = glad_debug_impl_glGetTexLevelParameterfv;
+static void APIENTRY glad_debug_impl_glGetTexLevelParameteriv(GLenum arg0, GLint arg1, GLenum arg2, GLint * arg3) {
+    _pre_call_callback("glGetTexLevelParameteriv", (void*)glad_glGetTexLevelParameteriv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLGETTEXLEVELPARAMETERIVPROC, GetTexLevelParameteriv, glad_glGetTexLevelParameteriv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetTexLevelParameteriv", (void*)glad_glGetTexLevelParameteriv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETTEXLEVELPARAMETERIVPROC glad_debug_glGetTexLevelParameteriv = glad_debug_impl_glGetTexLevelParameteriv;
+static GLboolean APIENTRY glad_debug_impl_glIsEnabled(GLenum arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsEnabled", (void*)glad_glIsEnabled, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLISENABLEDPROC, IsEnabled, glad_glIsEnabled)(arg0);
+    _post_call_callback("glIsEnabled", (void*)glad_glIsEnabled, 1, arg0);
+    return ret;
+}
+PFNGLISENABLEDPROC glad_debug_glIsEnabled = glad_debug_impl_glIsEnabled;
+static void APIENTRY glad_debug_impl_glDepthRange(GLdouble arg0, GLdouble arg1) {
+    _pre_call_callback("glDepthRange", (void*)glad_glDepthRange, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLDEPTHRANGEPROC, DepthRange, glad_glDepthRange)(arg0, arg1);
+    _post_call_callback("glDepthRange", (void*)glad_glDepthRange, 2, arg0, arg1);
+}
+PFNGLDEPTHRANGEPROC glad_debug_glDepthRange = glad_debug_impl_glDepthRange;
+static void APIENTRY glad_debug_impl_glViewport(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+    _pre_call_callback("glViewport", (void*)glad_glViewport, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVIEWPORTPROC, Viewport, glad_glViewport)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glViewport", (void*)glad_glViewport, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVIEWPORTPROC glad_debug_glViewport = glad_debug_impl_glViewport;
+static void APIENTRY glad_debug_impl_glDrawArrays(GLenum arg0, GLint arg1, GLsizei arg2) {
+    _pre_call_callback("glDrawArrays", (void*)glad_glDrawArrays, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLDRAWARRAYSPROC, DrawArrays, glad_glDrawArrays)(arg0, arg1, arg2);
+    _post_call_callback("glDrawArrays", (void*)glad_glDrawArrays, 3, arg0, arg1, arg2);
+}
+PFNGLDRAWARRAYSPROC glad_debug_glDrawArrays = glad_debug_impl_glDrawArrays;
+static void APIENTRY glad_debug_impl_glDrawElements(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3) {
+    _pre_call_callback("glDrawElements", (void*)glad_glDrawElements, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLDRAWELEMENTSPROC, DrawElements, glad_glDrawElements)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glDrawElements", (void*)glad_glDrawElements, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLDRAWELEMENTSPROC glad_debug_glDrawElements = glad_debug_impl_glDrawElements;
+static void APIENTRY glad_debug_impl_glPolygonOffset(GLfloat arg0, GLfloat arg1) {
+    _pre_call_callback("glPolygonOffset", (void*)glad_glPolygonOffset, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLPOLYGONOFFSETPROC, PolygonOffset, glad_glPolygonOffset)(arg0, arg1);
+    _post_call_callback("glPolygonOffset", (void*)glad_glPolygonOffset, 2, arg0, arg1);
+}
+PFNGLPOLYGONOFFSETPROC glad_debug_glPolygonOffset = glad_debug_impl_glPolygonOffset;
+static void APIENTRY glad_debug_impl_glCopyTexImage1D(GLenum arg0, GLint arg1, GLenum arg2, GLint arg3, GLint arg4, GLsizei arg5, GLint arg6) {
+    _pre_call_callback("glCopyTexImage1D", (void*)glad_glCopyTexImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    GLAD_GL_FUNCTION(PFNGLCOPYTEXIMAGE1DPROC, CopyTexImage1D, glad_glCopyTexImage1D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glCopyTexImage1D", (void*)glad_glCopyTexImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLCOPYTEXIMAGE1DPROC glad_debug_glCopyTexImage1D = glad_debug_impl_glCopyTexImage1D;
+static void APIENTRY glad_debug_impl_glCopyTexImage2D(GLenum arg0, GLint arg1, GLenum arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLint arg7) {
+    _pre_call_callback("glCopyTexImage2D", (void*)glad_glCopyTexImage2D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    GLAD_GL_FUNCTION(PFNGLCOPYTEXIMAGE2DPROC, CopyTexImage2D, glad_glCopyTexImage2D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    _post_call_callback("glCopyTexImage2D", (void*)glad_glCopyTexImage2D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+PFNGLCOPYTEXIMAGE2DPROC glad_debug_glCopyTexImage2D = glad_debug_impl_glCopyTexImage2D;
+static void APIENTRY glad_debug_impl_glCopyTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5) {
+    _pre_call_callback("glCopyTexSubImage1D", (void*)glad_glCopyTexSubImage1D, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    GLAD_GL_FUNCTION(PFNGLCOPYTEXSUBIMAGE1DPROC, CopyTexSubImage1D, glad_glCopyTexSubImage1D)(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glCopyTexSubImage1D", (void*)glad_glCopyTexSubImage1D, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLCOPYTEXSUBIMAGE1DPROC glad_debug_glCopyTexSubImage1D = glad_debug_impl_glCopyTexSubImage1D;
+static void APIENTRY glad_debug_impl_glCopyTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLsizei arg6, GLsizei arg7) {
+    _pre_call_callback("glCopyTexSubImage2D", (void*)glad_glCopyTexSubImage2D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    GLAD_GL_FUNCTION(PFNGLCOPYTEXSUBIMAGE2DPROC, CopyTexSubImage2D, glad_glCopyTexSubImage2D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    _post_call_callback("glCopyTexSubImage2D", (void*)glad_glCopyTexSubImage2D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+PFNGLCOPYTEXSUBIMAGE2DPROC glad_debug_glCopyTexSubImage2D = glad_debug_impl_glCopyTexSubImage2D;
+static void APIENTRY glad_debug_impl_glTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+    _pre_call_callback("glTexSubImage1D", (void*)glad_glTexSubImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    GLAD_GL_FUNCTION(PFNGLTEXSUBIMAGE1DPROC, TexSubImage1D, glad_glTexSubImage1D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glTexSubImage1D", (void*)glad_glTexSubImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLTEXSUBIMAGE1DPROC glad_debug_glTexSubImage1D = glad_debug_impl_glTexSubImage1D;
+static void APIENTRY glad_debug_impl_glTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLenum arg7, const void * arg8) {
+    _pre_call_callback("glTexSubImage2D", (void*)glad_glTexSubImage2D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    GLAD_GL_FUNCTION(PFNGLTEXSUBIMAGE2DPROC, TexSubImage2D, glad_glTexSubImage2D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    _post_call_callback("glTexSubImage2D", (void*)glad_glTexSubImage2D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+PFNGLTEXSUBIMAGE2DPROC glad_debug_glTexSubImage2D = glad_debug_impl_glTexSubImage2D;
+static void APIENTRY glad_debug_impl_glBindTexture(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glBindTexture", (void*)glad_glBindTexture, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLBINDTEXTUREPROC, BindTexture, glad_glBindTexture)(arg0, arg1);
+    _post_call_callback("glBindTexture", (void*)glad_glBindTexture, 2, arg0, arg1);
+}
+PFNGLBINDTEXTUREPROC glad_debug_glBindTexture = glad_debug_impl_glBindTexture;
+static void APIENTRY glad_debug_impl_glDeleteTextures(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteTextures", (void*)glad_glDeleteTextures, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLDELETETEXTURESPROC, DeleteTextures, glad_glDeleteTextures)(arg0, arg1);
+    _post_call_callback("glDeleteTextures", (void*)glad_glDeleteTextures, 2, arg0, arg1);
+}
+PFNGLDELETETEXTURESPROC glad_debug_glDeleteTextures = glad_debug_impl_glDeleteTextures;
+static void APIENTRY glad_debug_impl_glGenTextures(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenTextures", (void*)glad_glGenTextures, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLGENTEXTURESPROC, GenTextures, glad_glGenTextures)(arg0, arg1);
+    _post_call_callback("glGenTextures", (void*)glad_glGenTextures, 2, arg0, arg1);
+}
+PFNGLGENTEXTURESPROC glad_debug_glGenTextures = glad_debug_impl_glGenTextures;
+static GLboolean APIENTRY glad_debug_impl_glIsTexture(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsTexture", (void*)glad_glIsTexture, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLISTEXTUREPROC, IsTexture, glad_glIsTexture)(arg0);
+    _post_call_callback("glIsTexture", (void*)glad_glIsTexture, 1, arg0);
+    return ret;
+}
+PFNGLISTEXTUREPROC glad_debug_glIsTexture = glad_debug_impl_glIsTexture;
+static void APIENTRY glad_debug_impl_glDrawRangeElements(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3, GLenum arg4, const void * arg5) {
+    _pre_call_callback("glDrawRangeElements", (void*)glad_glDrawRangeElements, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    GLAD_GL_FUNCTION(PFNGLDRAWRANGEELEMENTSPROC, DrawRangeElements, glad_glDrawRangeElements)(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glDrawRangeElements", (void*)glad_glDrawRangeElements, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLDRAWRANGEELEMENTSPROC glad_debug_glDrawRangeElements = glad_debug_impl_glDrawRangeElements;
+static void APIENTRY glad_debug_impl_glTexImage3D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLint arg6, GLenum arg7, GLenum arg8, const void * arg9) {
+    _pre_call_callback("glTexImage3D", (void*)glad_glTexImage3D, 10, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+    GLAD_GL_FUNCTION(PFNGLTEXIMAGE3DPROC, TexImage3D, glad_glTexImage3D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+    _post_call_callback("glTexImage3D", (void*)glad_glTexImage3D, 10, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+PFNGLTEXIMAGE3DPROC glad_debug_glTexImage3D = glad_debug_impl_glTexImage3D;
+static void APIENTRY glad_debug_impl_glTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+    _pre_call_callback("glTexSubImage3D", (void*)glad_glTexSubImage3D, 11, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+    GLAD_GL_FUNCTION(PFNGLTEXSUBIMAGE3DPROC, TexSubImage3D, glad_glTexSubImage3D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+    _post_call_callback("glTexSubImage3D", (void*)glad_glTexSubImage3D, 11, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+PFNGLTEXSUBIMAGE3DPROC glad_debug_glTexSubImage3D = glad_debug_impl_glTexSubImage3D;
+static void APIENTRY glad_debug_impl_glCopyTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLsizei arg7, GLsizei arg8) {
+    _pre_call_callback("glCopyTexSubImage3D", (void*)glad_glCopyTexSubImage3D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    GLAD_GL_FUNCTION(PFNGLCOPYTEXSUBIMAGE3DPROC, CopyTexSubImage3D, glad_glCopyTexSubImage3D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    _post_call_callback("glCopyTexSubImage3D", (void*)glad_glCopyTexSubImage3D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+PFNGLCOPYTEXSUBIMAGE3DPROC glad_debug_glCopyTexSubImage3D = glad_debug_impl_glCopyTexSubImage3D;
+static void APIENTRY glad_debug_impl_glActiveTexture(GLenum arg0) {
+    _pre_call_callback("glActiveTexture", (void*)glad_glActiveTexture, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLACTIVETEXTUREPROC, ActiveTexture, glad_glActiveTexture)(arg0);
+    _post_call_callback("glActiveTexture", (void*)glad_glActiveTexture, 1, arg0);
+}
+PFNGLACTIVETEXTUREPROC glad_debug_glActiveTexture = glad_debug_impl_glActiveTexture;
+static void APIENTRY glad_debug_impl_glSampleCoverage(GLfloat arg0, GLboolean arg1) {
+    _pre_call_callback("glSampleCoverage", (void*)glad_glSampleCoverage, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLSAMPLECOVERAGEPROC, SampleCoverage, glad_glSampleCoverage)(arg0, arg1);
+    _post_call_callback("glSampleCoverage", (void*)glad_glSampleCoverage, 2, arg0, arg1);
+}
+PFNGLSAMPLECOVERAGEPROC glad_debug_glSampleCoverage = glad_debug_impl_glSampleCoverage;
+static void APIENTRY glad_debug_impl_glCompressedTexImage3D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLint arg6, GLsizei arg7, const void * arg8) {
+    _pre_call_callback("glCompressedTexImage3D", (void*)glad_glCompressedTexImage3D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    GLAD_GL_FUNCTION(PFNGLCOMPRESSEDTEXIMAGE3DPROC, CompressedTexImage3D, glad_glCompressedTexImage3D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    _post_call_callback("glCompressedTexImage3D", (void*)glad_glCompressedTexImage3D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_debug_glCompressedTexImage3D = glad_debug_impl_glCompressedTexImage3D;
+static void APIENTRY glad_debug_impl_glCompressedTexImage2D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLint arg5, GLsizei arg6, const void * arg7) {
+    _pre_call_callback("glCompressedTexImage2D", (void*)glad_glCompressedTexImage2D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    GLAD_GL_FUNCTION(PFNGLCOMPRESSEDTEXIMAGE2DPROC, CompressedTexImage2D, glad_glCompressedTexImage2D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    _post_call_callback("glCompressedTexImage2D", (void*)glad_glCompressedTexImage2D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_debug_glCompressedTexImage2D = glad_debug_impl_glCompressedTexImage2D;
+static void APIENTRY glad_debug_impl_glCompressedTexImage1D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLint arg4, GLsizei arg5, const void * arg6) {
+    _pre_call_callback("glCompressedTexImage1D", (void*)glad_glCompressedTexImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    GLAD_GL_FUNCTION(PFNGLCOMPRESSEDTEXIMAGE1DPROC, CompressedTexImage1D, glad_glCompressedTexImage1D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glCompressedTexImage1D", (void*)glad_glCompressedTexImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_debug_glCompressedTexImage1D = glad_debug_impl_glCompressedTexImage1D;
+static void APIENTRY glad_debug_impl_glCompressedTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLsizei arg9, const void * arg10) {
+    _pre_call_callback("glCompressedTexSubImage3D", (void*)glad_glCompressedTexSubImage3D, 11, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+    GLAD_GL_FUNCTION(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, CompressedTexSubImage3D, glad_glCompressedTexSubImage3D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+    _post_call_callback("glCompressedTexSubImage3D", (void*)glad_glCompressedTexSubImage3D, 11, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_debug_glCompressedTexSubImage3D = glad_debug_impl_glCompressedTexSubImage3D;
+static void APIENTRY glad_debug_impl_glCompressedTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLsizei arg7, const void * arg8) {
+    _pre_call_callback("glCompressedTexSubImage2D", (void*)glad_glCompressedTexSubImage2D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    GLAD_GL_FUNCTION(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, CompressedTexSubImage2D, glad_glCompressedTexSubImage2D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    _post_call_callback("glCompressedTexSubImage2D", (void*)glad_glCompressedTexSubImage2D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_debug_glCompressedTexSubImage2D = glad_debug_impl_glCompressedTexSubImage2D;
+static void APIENTRY glad_debug_impl_glCompressedTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLsizei arg5, const void * arg6) {
+    _pre_call_callback("glCompressedTexSubImage1D", (void*)glad_glCompressedTexSubImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    GLAD_GL_FUNCTION(PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, CompressedTexSubImage1D, glad_glCompressedTexSubImage1D)(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glCompressedTexSubImage1D", (void*)glad_glCompressedTexSubImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_debug_glCompressedTexSubImage1D = glad_debug_impl_glCompressedTexSubImage1D;
+static void APIENTRY glad_debug_impl_glGetCompressedTexImage(GLenum arg0, GLint arg1, void * arg2) {
+    _pre_call_callback("glGetCompressedTexImage", (void*)glad_glGetCompressedTexImage, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETCOMPRESSEDTEXIMAGEPROC, GetCompressedTexImage, glad_glGetCompressedTexImage)(arg0, arg1, arg2);
+    _post_call_callback("glGetCompressedTexImage", (void*)glad_glGetCompressedTexImage, 3, arg0, arg1, arg2);
+}
+PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_debug_glGetCompressedTexImage = glad_debug_impl_glGetCompressedTexImage;
+static void APIENTRY glad_debug_impl_glBlendFuncSeparate(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3) {
+    _pre_call_callback("glBlendFuncSeparate", (void*)glad_glBlendFuncSeparate, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLBLENDFUNCSEPARATEPROC, BlendFuncSeparate, glad_glBlendFuncSeparate)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glBlendFuncSeparate", (void*)glad_glBlendFuncSeparate, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLBLENDFUNCSEPARATEPROC glad_debug_glBlendFuncSeparate = glad_debug_impl_glBlendFuncSeparate;
+static void APIENTRY glad_debug_impl_glMultiDrawArrays(GLenum arg0, const GLint * arg1, const GLsizei * arg2, GLsizei arg3) {
+    _pre_call_callback("glMultiDrawArrays", (void*)glad_glMultiDrawArrays, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLMULTIDRAWARRAYSPROC, MultiDrawArrays, glad_glMultiDrawArrays)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glMultiDrawArrays", (void*)glad_glMultiDrawArrays, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLMULTIDRAWARRAYSPROC glad_debug_glMultiDrawArrays = glad_debug_impl_glMultiDrawArrays;
+static void APIENTRY glad_debug_impl_glMultiDrawElements(GLenum arg0, const GLsizei * arg1, GLenum arg2, const void *const* arg3, GLsizei arg4) {
+    _pre_call_callback("glMultiDrawElements", (void*)glad_glMultiDrawElements, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLMULTIDRAWELEMENTSPROC, MultiDrawElements, glad_glMultiDrawElements)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glMultiDrawElements", (void*)glad_glMultiDrawElements, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLMULTIDRAWELEMENTSPROC glad_debug_glMultiDrawElements = glad_debug_impl_glMultiDrawElements;
+static void APIENTRY glad_debug_impl_glPointParameterf(GLenum arg0, GLfloat arg1) {
+    _pre_call_callback("glPointParameterf", (void*)glad_glPointParameterf, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLPOINTPARAMETERFPROC, PointParameterf, glad_glPointParameterf)(arg0, arg1);
+    _post_call_callback("glPointParameterf", (void*)glad_glPointParameterf, 2, arg0, arg1);
+}
+PFNGLPOINTPARAMETERFPROC glad_debug_glPointParameterf = glad_debug_impl_glPointParameterf;
+static void APIENTRY glad_debug_impl_glPointParameterfv(GLenum arg0, const GLfloat * arg1) {
+    _pre_call_callback("glPointParameterfv", (void*)glad_glPointParameterfv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLPOINTPARAMETERFVPROC, PointParameterfv, glad_glPointParameterfv)(arg0, arg1);
+    _post_call_callback("glPointParameterfv", (void*)glad_glPointParameterfv, 2, arg0, arg1);
+}
+PFNGLPOINTPARAMETERFVPROC glad_debug_glPointParameterfv = glad_debug_impl_glPointParameterfv;
+static void APIENTRY glad_debug_impl_glPointParameteri(GLenum arg0, GLint arg1) {
+    _pre_call_callback("glPointParameteri", (void*)glad_glPointParameteri, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLPOINTPARAMETERIPROC, PointParameteri, glad_glPointParameteri)(arg0, arg1);
+    _post_call_callback("glPointParameteri", (void*)glad_glPointParameteri, 2, arg0, arg1);
+}
+PFNGLPOINTPARAMETERIPROC glad_debug_glPointParameteri = glad_debug_impl_glPointParameteri;
+static void APIENTRY glad_debug_impl_glPointParameteriv(GLenum arg0, const GLint * arg1) {
+    _pre_call_callback("glPointParameteriv", (void*)glad_glPointParameteriv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLPOINTPARAMETERIVPROC, PointParameteriv, glad_glPointParameteriv)(arg0, arg1);
+    _post_call_callback("glPointParameteriv", (void*)glad_glPointParameteriv, 2, arg0, arg1);
+}
+PFNGLPOINTPARAMETERIVPROC glad_debug_glPointParameteriv = glad_debug_impl_glPointParameteriv;
+static void APIENTRY glad_debug_impl_glBlendColor(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glBlendColor", (void*)glad_glBlendColor, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLBLENDCOLORPROC, BlendColor, glad_glBlendColor)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glBlendColor", (void*)glad_glBlendColor, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLBLENDCOLORPROC glad_debug_glBlendColor = glad_debug_impl_glBlendColor;
+static void APIENTRY glad_debug_impl_glBlendEquation(GLenum arg0) {
+    _pre_call_callback("glBlendEquation", (void*)glad_glBlendEquation, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLBLENDEQUATIONPROC, BlendEquation, glad_glBlendEquation)(arg0);
+    _post_call_callback("glBlendEquation", (void*)glad_glBlendEquation, 1, arg0);
+}
+PFNGLBLENDEQUATIONPROC glad_debug_glBlendEquation = glad_debug_impl_glBlendEquation;
+static void APIENTRY glad_debug_impl_glGenQueries(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenQueries", (void*)glad_glGenQueries, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLGENQUERIESPROC, GenQueries, glad_glGenQueries)(arg0, arg1);
+    _post_call_callback("glGenQueries", (void*)glad_glGenQueries, 2, arg0, arg1);
+}
+PFNGLGENQUERIESPROC glad_debug_glGenQueries = glad_debug_impl_glGenQueries;
+static void APIENTRY glad_debug_impl_glDeleteQueries(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteQueries", (void*)glad_glDeleteQueries, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLDELETEQUERIESPROC, DeleteQueries, glad_glDeleteQueries)(arg0, arg1);
+    _post_call_callback("glDeleteQueries", (void*)glad_glDeleteQueries, 2, arg0, arg1);
+}
+PFNGLDELETEQUERIESPROC glad_debug_glDeleteQueries = glad_debug_impl_glDeleteQueries;
+static GLboolean APIENTRY glad_debug_impl_glIsQuery(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsQuery", (void*)glad_glIsQuery, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLISQUERYPROC, IsQuery, glad_glIsQuery)(arg0);
+    _post_call_callback("glIsQuery", (void*)glad_glIsQuery, 1, arg0);
+    return ret;
+}
+PFNGLISQUERYPROC glad_debug_glIsQuery = glad_debug_impl_glIsQuery;
+static void APIENTRY glad_debug_impl_glBeginQuery(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glBeginQuery", (void*)glad_glBeginQuery, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLBEGINQUERYPROC, BeginQuery, glad_glBeginQuery)(arg0, arg1);
+    _post_call_callback("glBeginQuery", (void*)glad_glBeginQuery, 2, arg0, arg1);
+}
+PFNGLBEGINQUERYPROC glad_debug_glBeginQuery = glad_debug_impl_glBeginQuery;
+static void APIENTRY glad_debug_impl_glEndQuery(GLenum arg0) {
+    _pre_call_callback("glEndQuery", (void*)glad_glEndQuery, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLENDQUERYPROC, EndQuery, glad_glEndQuery)(arg0);
+    _post_call_callback("glEndQuery", (void*)glad_glEndQuery, 1, arg0);
+}
+PFNGLENDQUERYPROC glad_debug_glEndQuery = glad_debug_impl_glEndQuery;
+static void APIENTRY glad_debug_impl_glGetQueryiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetQueryiv", (void*)glad_glGetQueryiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETQUERYIVPROC, GetQueryiv, glad_glGetQueryiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetQueryiv", (void*)glad_glGetQueryiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETQUERYIVPROC glad_debug_glGetQueryiv = glad_debug_impl_glGetQueryiv;
+static void APIENTRY glad_debug_impl_glGetQueryObjectiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetQueryObjectiv", (void*)glad_glGetQueryObjectiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETQUERYOBJECTIVPROC, GetQueryObjectiv, glad_glGetQueryObjectiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetQueryObjectiv", (void*)glad_glGetQueryObjectiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETQUERYOBJECTIVPROC glad_debug_glGetQueryObjectiv = glad_debug_impl_glGetQueryObjectiv;
+static void APIENTRY glad_debug_impl_glGetQueryObjectuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+    _pre_call_callback("glGetQueryObjectuiv", (void*)glad_glGetQueryObjectuiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETQUERYOBJECTUIVPROC, GetQueryObjectuiv, glad_glGetQueryObjectuiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetQueryObjectuiv", (void*)glad_glGetQueryObjectuiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETQUERYOBJECTUIVPROC glad_debug_glGetQueryObjectuiv = glad_debug_impl_glGetQueryObjectuiv;
+static void APIENTRY glad_debug_impl_glBindBuffer(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glBindBuffer", (void*)glad_glBindBuffer, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLBINDBUFFERPROC, BindBuffer, glad_glBindBuffer)(arg0, arg1);
+    _post_call_callback("glBindBuffer", (void*)glad_glBindBuffer, 2, arg0, arg1);
+}
+PFNGLBINDBUFFERPROC glad_debug_glBindBuffer = glad_debug_impl_glBindBuffer;
+static void APIENTRY glad_debug_impl_glDeleteBuffers(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteBuffers", (void*)glad_glDeleteBuffers, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLDELETEBUFFERSPROC, DeleteBuffers, glad_glDeleteBuffers)(arg0, arg1);
+    _post_call_callback("glDeleteBuffers", (void*)glad_glDeleteBuffers, 2, arg0, arg1);
+}
+PFNGLDELETEBUFFERSPROC glad_debug_glDeleteBuffers = glad_debug_impl_glDeleteBuffers;
+static void APIENTRY glad_debug_impl_glGenBuffers(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenBuffers", (void*)glad_glGenBuffers, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLGENBUFFERSPROC, GenBuffers, glad_glGenBuffers)(arg0, arg1);
+    _post_call_callback("glGenBuffers", (void*)glad_glGenBuffers, 2, arg0, arg1);
+}
+PFNGLGENBUFFERSPROC glad_debug_glGenBuffers = glad_debug_impl_glGenBuffers;
+static GLboolean APIENTRY glad_debug_impl_glIsBuffer(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsBuffer", (void*)glad_glIsBuffer, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLISBUFFERPROC, IsBuffer, glad_glIsBuffer)(arg0);
+    _post_call_callback("glIsBuffer", (void*)glad_glIsBuffer, 1, arg0);
+    return ret;
+}
+PFNGLISBUFFERPROC glad_debug_glIsBuffer = glad_debug_impl_glIsBuffer;
+static void APIENTRY glad_debug_impl_glBufferData(GLenum arg0, GLsizeiptr arg1, const void * arg2, GLenum arg3) {
+    _pre_call_callback("glBufferData", (void*)glad_glBufferData, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLBUFFERDATAPROC, BufferData, glad_glBufferData)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glBufferData", (void*)glad_glBufferData, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLBUFFERDATAPROC glad_debug_glBufferData = glad_debug_impl_glBufferData;
+static void APIENTRY glad_debug_impl_glBufferSubData(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, const void * arg3) {
+    _pre_call_callback("glBufferSubData", (void*)glad_glBufferSubData, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLBUFFERSUBDATAPROC, BufferSubData, glad_glBufferSubData)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glBufferSubData", (void*)glad_glBufferSubData, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLBUFFERSUBDATAPROC glad_debug_glBufferSubData = glad_debug_impl_glBufferSubData;
+static void APIENTRY glad_debug_impl_glGetBufferSubData(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, void * arg3) {
+    _pre_call_callback("glGetBufferSubData", (void*)glad_glGetBufferSubData, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLGETBUFFERSUBDATAPROC, GetBufferSubData, glad_glGetBufferSubData)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetBufferSubData", (void*)glad_glGetBufferSubData, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETBUFFERSUBDATAPROC glad_debug_glGetBufferSubData = glad_debug_impl_glGetBufferSubData;
+static void * APIENTRY glad_debug_impl_glMapBuffer(GLenum arg0, GLenum arg1) {
+    void * ret;
+    _pre_call_callback("glMapBuffer", (void*)glad_glMapBuffer, 2, arg0, arg1);
+    ret = GLAD_GL_FUNCTION(PFNGLMAPBUFFERPROC, MapBuffer, glad_glMapBuffer)(arg0, arg1);
+    _post_call_callback("glMapBuffer", (void*)glad_glMapBuffer, 2, arg0, arg1);
+    return ret;
+}
+PFNGLMAPBUFFERPROC glad_debug_glMapBuffer = glad_debug_impl_glMapBuffer;
+static GLboolean APIENTRY glad_debug_impl_glUnmapBuffer(GLenum arg0) {
+    GLboolean ret;
+    _pre_call_callback("glUnmapBuffer", (void*)glad_glUnmapBuffer, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLUNMAPBUFFERPROC, UnmapBuffer, glad_glUnmapBuffer)(arg0);
+    _post_call_callback("glUnmapBuffer", (void*)glad_glUnmapBuffer, 1, arg0);
+    return ret;
+}
+PFNGLUNMAPBUFFERPROC glad_debug_glUnmapBuffer = glad_debug_impl_glUnmapBuffer;
+static void APIENTRY glad_debug_impl_glGetBufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetBufferParameteriv", (void*)glad_glGetBufferParameteriv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETBUFFERPARAMETERIVPROC, GetBufferParameteriv, glad_glGetBufferParameteriv)(arg0, arg1, arg2);
+    _post_call_callback("glGetBufferParameteriv", (void*)glad_glGetBufferParameteriv, 3, arg0, arg1, arg2);
+}
+PFNGLGETBUFFERPARAMETERIVPROC glad_debug_glGetBufferParameteriv = glad_debug_impl_glGetBufferParameteriv;
+static void APIENTRY glad_debug_impl_glGetBufferPointerv(GLenum arg0, GLenum arg1, void ** arg2) {
+    _pre_call_callback("glGetBufferPointerv", (void*)glad_glGetBufferPointerv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETBUFFERPOINTERVPROC, GetBufferPointerv, glad_glGetBufferPointerv)(arg0, arg1, arg2);
+    _post_call_callback("glGetBufferPointerv", (void*)glad_glGetBufferPointerv, 3, arg0, arg1, arg2);
+}
+PFNGLGETBUFFERPOINTERVPROC glad_debug_glGetBufferPointerv = glad_debug_impl_glGetBufferPointerv;
+static void APIENTRY glad_debug_impl_glBlendEquationSeparate(GLenum arg0, GLenum arg1) {
+    _pre_call_callback("glBlendEquationSeparate", (void*)glad_glBlendEquationSeparate, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLBLENDEQUATIONSEPARATEPROC, BlendEquationSeparate, glad_glBlendEquationSeparate)(arg0, arg1);
+    _post_call_callback("glBlendEquationSeparate", (void*)glad_glBlendEquationSeparate, 2, arg0, arg1);
+}
+PFNGLBLENDEQUATIONSEPARATEPROC glad_debug_glBlendEquationSeparate = glad_debug_impl_glBlendEquationSeparate;
+static void APIENTRY glad_debug_impl_glDrawBuffers(GLsizei arg0, const GLenum * arg1) {
+    _pre_call_callback("glDrawBuffers", (void*)glad_glDrawBuffers, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLDRAWBUFFERSPROC, DrawBuffers, glad_glDrawBuffers)(arg0, arg1);
+    _post_call_callback("glDrawBuffers", (void*)glad_glDrawBuffers, 2, arg0, arg1);
+}
+PFNGLDRAWBUFFERSPROC glad_debug_glDrawBuffers = glad_debug_impl_glDrawBuffers;
+static void APIENTRY glad_debug_impl_glStencilOpSeparate(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3) {
+    _pre_call_callback("glStencilOpSeparate", (void*)glad_glStencilOpSeparate, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLSTENCILOPSEPARATEPROC, StencilOpSeparate, glad_glStencilOpSeparate)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glStencilOpSeparate", (void*)glad_glStencilOpSeparate, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLSTENCILOPSEPARATEPROC glad_debug_glStencilOpSeparate = glad_debug_impl_glStencilOpSeparate;
+static void APIENTRY glad_debug_impl_glStencilFuncSeparate(GLenum arg0, GLenum arg1, GLint arg2, GLuint arg3) {
+    _pre_call_callback("glStencilFuncSeparate", (void*)glad_glStencilFuncSeparate, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLSTENCILFUNCSEPARATEPROC, StencilFuncSeparate, glad_glStencilFuncSeparate)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glStencilFuncSeparate", (void*)glad_glStencilFuncSeparate, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLSTENCILFUNCSEPARATEPROC glad_debug_glStencilFuncSeparate = glad_debug_impl_glStencilFuncSeparate;
+static void APIENTRY glad_debug_impl_glStencilMaskSeparate(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glStencilMaskSeparate", (void*)glad_glStencilMaskSeparate, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLSTENCILMASKSEPARATEPROC, StencilMaskSeparate, glad_glStencilMaskSeparate)(arg0, arg1);
+    _post_call_callback("glStencilMaskSeparate", (void*)glad_glStencilMaskSeparate, 2, arg0, arg1);
+}
+PFNGLSTENCILMASKSEPARATEPROC glad_debug_glStencilMaskSeparate = glad_debug_impl_glStencilMaskSeparate;
+static void APIENTRY glad_debug_impl_glAttachShader(GLuint arg0, GLuint arg1) {
+    _pre_call_callback("glAttachShader", (void*)glad_glAttachShader, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLATTACHSHADERPROC, AttachShader, glad_glAttachShader)(arg0, arg1);
+    _post_call_callback("glAttachShader", (void*)glad_glAttachShader, 2, arg0, arg1);
+}
+PFNGLATTACHSHADERPROC glad_debug_glAttachShader = glad_debug_impl_glAttachShader;
+static void APIENTRY glad_debug_impl_glBindAttribLocation(GLuint arg0, GLuint arg1, const GLchar * arg2) {
+    _pre_call_callback("glBindAttribLocation", (void*)glad_glBindAttribLocation, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLBINDATTRIBLOCATIONPROC, BindAttribLocation, glad_glBindAttribLocation)(arg0, arg1, arg2);
+    _post_call_callback("glBindAttribLocation", (void*)glad_glBindAttribLocation, 3, arg0, arg1, arg2);
+}
+PFNGLBINDATTRIBLOCATIONPROC glad_debug_glBindAttribLocation = glad_debug_impl_glBindAttribLocation;
+static void APIENTRY glad_debug_impl_glCompileShader(GLuint arg0) {
+    _pre_call_callback("glCompileShader", (void*)glad_glCompileShader, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLCOMPILESHADERPROC, CompileShader, glad_glCompileShader)(arg0);
+    _post_call_callback("glCompileShader", (void*)glad_glCompileShader, 1, arg0);
+}
+PFNGLCOMPILESHADERPROC glad_debug_glCompileShader = glad_debug_impl_glCompileShader;
+static GLuint APIENTRY glad_debug_impl_glCreateProgram(void) {
+    GLuint ret;
+    _pre_call_callback("glCreateProgram", (void*)glad_glCreateProgram, 0);
+    ret = GLAD_GL_FUNCTION(PFNGLCREATEPROGRAMPROC, CreateProgram, glad_glCreateProgram)();
+    _post_call_callback("glCreateProgram", (void*)glad_glCreateProgram, 0);
+    return ret;
+}
+PFNGLCREATEPROGRAMPROC glad_debug_glCreateProgram = glad_debug_impl_glCreateProgram;
+static GLuint APIENTRY glad_debug_impl_glCreateShader(GLenum arg0) {
+    GLuint ret;
+    _pre_call_callback("glCreateShader", (void*)glad_glCreateShader, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLCREATESHADERPROC, CreateShader, glad_glCreateShader)(arg0);
+    _post_call_callback("glCreateShader", (void*)glad_glCreateShader, 1, arg0);
+    return ret;
+}
+PFNGLCREATESHADERPROC glad_debug_glCreateShader = glad_debug_impl_glCreateShader;
+static void APIENTRY glad_debug_impl_glDeleteProgram(GLuint arg0) {
+    _pre_call_callback("glDeleteProgram", (void*)glad_glDeleteProgram, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLDELETEPROGRAMPROC, DeleteProgram, glad_glDeleteProgram)(arg0);
+    _post_call_callback("glDeleteProgram", (void*)glad_glDeleteProgram, 1, arg0);
+}
+PFNGLDELETEPROGRAMPROC glad_debug_glDeleteProgram = glad_debug_impl_glDeleteProgram;
+static void APIENTRY glad_debug_impl_glDeleteShader(GLuint arg0) {
+    _pre_call_callback("glDeleteShader", (void*)glad_glDeleteShader, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLDELETESHADERPROC, DeleteShader, glad_glDeleteShader)(arg0);
+    _post_call_callback("glDeleteShader", (void*)glad_glDeleteShader, 1, arg0);
+}
+PFNGLDELETESHADERPROC glad_debug_glDeleteShader = glad_debug_impl_glDeleteShader;
+static void APIENTRY glad_debug_impl_glDetachShader(GLuint arg0, GLuint arg1) {
+    _pre_call_callback("glDetachShader", (void*)glad_glDetachShader, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLDETACHSHADERPROC, DetachShader, glad_glDetachShader)(arg0, arg1);
+    _post_call_callback("glDetachShader", (void*)glad_glDetachShader, 2, arg0, arg1);
+}
+PFNGLDETACHSHADERPROC glad_debug_glDetachShader = glad_debug_impl_glDetachShader;
+static void APIENTRY glad_debug_impl_glDisableVertexAttribArray(GLuint arg0) {
+    _pre_call_callback("glDisableVertexAttribArray", (void*)glad_glDisableVertexAttribArray, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLDISABLEVERTEXATTRIBARRAYPROC, DisableVertexAttribArray, glad_glDisableVertexAttribArray)(arg0);
+    _post_call_callback("glDisableVertexAttribArray", (void*)glad_glDisableVertexAttribArray, 1, arg0);
+}
+PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_debug_glDisableVertexAttribArray = glad_debug_impl_glDisableVertexAttribArray;
+static void APIENTRY glad_debug_impl_glEnableVertexAttribArray(GLuint arg0) {
+    _pre_call_callback("glEnableVertexAttribArray", (void*)glad_glEnableVertexAttribArray, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLENABLEVERTEXATTRIBARRAYPROC, EnableVertexAttribArray, glad_glEnableVertexAttribArray)(arg0);
+    _post_call_callback("glEnableVertexAttribArray", (void*)glad_glEnableVertexAttribArray, 1, arg0);
+}
+PFNGLENABLEVERTEXATTRIBARRAYPROC glad_debug_glEnableVertexAttribArray = glad_debug_impl_glEnableVertexAttribArray;
+static void APIENTRY glad_debug_impl_glGetActiveAttrib(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4, GLenum * arg5, GLchar * arg6) {
+    _pre_call_callback("glGetActiveAttrib", (void*)glad_glGetActiveAttrib, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    GLAD_GL_FUNCTION(PFNGLGETACTIVEATTRIBPROC, GetActiveAttrib, glad_glGetActiveAttrib)(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glGetActiveAttrib", (void*)glad_glGetActiveAttrib, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLGETACTIVEATTRIBPROC glad_debug_glGetActiveAttrib = glad_debug_impl_glGetActiveAttrib;
+static void APIENTRY glad_debug_impl_glGetActiveUniform(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4, GLenum * arg5, GLchar * arg6) {
+    _pre_call_callback("glGetActiveUniform", (void*)glad_glGetActiveUniform, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    GLAD_GL_FUNCTION(PFNGLGETACTIVEUNIFORMPROC, GetActiveUniform, glad_glGetActiveUniform)(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glGetActiveUniform", (void*)glad_glGetActiveUniform, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLGETACTIVEUNIFORMPROC glad_debug_glGetActiveUniform = glad_debug_impl_glGetActiveUniform;
+static void APIENTRY glad_debug_impl_glGetAttachedShaders(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLuint * arg3) {
+    _pre_call_callback("glGetAttachedShaders", (void*)glad_glGetAttachedShaders, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLGETATTACHEDSHADERSPROC, GetAttachedShaders, glad_glGetAttachedShaders)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetAttachedShaders", (void*)glad_glGetAttachedShaders, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETATTACHEDSHADERSPROC glad_debug_glGetAttachedShaders = glad_debug_impl_glGetAttachedShaders;
+static GLint APIENTRY glad_debug_impl_glGetAttribLocation(GLuint arg0, const GLchar * arg1) {
+    GLint ret;
+    _pre_call_callback("glGetAttribLocation", (void*)glad_glGetAttribLocation, 2, arg0, arg1);
+    ret = GLAD_GL_FUNCTION(PFNGLGETATTRIBLOCATIONPROC, GetAttribLocation, glad_glGetAttribLocation)(arg0, arg1);
+    _post_call_callback("glGetAttribLocation", (void*)glad_glGetAttribLocation, 2, arg0, arg1);
+    return ret;
+}
+PFNGLGETATTRIBLOCATIONPROC glad_debug_glGetAttribLocation = glad_debug_impl_glGetAttribLocation;
+static void APIENTRY glad_debug_impl_glGetProgramiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetProgramiv", (void*)glad_glGetProgramiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETPROGRAMIVPROC, GetProgramiv, glad_glGetProgramiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetProgramiv", (void*)glad_glGetProgramiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETPROGRAMIVPROC glad_debug_glGetProgramiv = glad_debug_impl_glGetProgramiv;
+static void APIENTRY glad_debug_impl_glGetProgramInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+    _pre_call_callback("glGetProgramInfoLog", (void*)glad_glGetProgramInfoLog, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLGETPROGRAMINFOLOGPROC, GetProgramInfoLog, glad_glGetProgramInfoLog)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetProgramInfoLog", (void*)glad_glGetProgramInfoLog, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETPROGRAMINFOLOGPROC glad_debug_glGetProgramInfoLog = glad_debug_impl_glGetProgramInfoLog;
+static void APIENTRY glad_debug_impl_glGetShaderiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetShaderiv", (void*)glad_glGetShaderiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETSHADERIVPROC, GetShaderiv, glad_glGetShaderiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetShaderiv", (void*)glad_glGetShaderiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETSHADERIVPROC glad_debug_glGetShaderiv = glad_debug_impl_glGetShaderiv;
+static void APIENTRY glad_debug_impl_glGetShaderInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+    _pre_call_callback("glGetShaderInfoLog", (void*)glad_glGetShaderInfoLog, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLGETSHADERINFOLOGPROC, GetShaderInfoLog, glad_glGetShaderInfoLog)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetShaderInfoLog", (void*)glad_glGetShaderInfoLog, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETSHADERINFOLOGPROC glad_debug_glGetShaderInfoLog = glad_debug_impl_glGetShaderInfoLog;
+static void APIENTRY glad_debug_impl_glGetShaderSource(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+    _pre_call_callback("glGetShaderSource", (void*)glad_glGetShaderSource, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLGETSHADERSOURCEPROC, GetShaderSource, glad_glGetShaderSource)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetShaderSource", (void*)glad_glGetShaderSource, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETSHADERSOURCEPROC glad_debug_glGetShaderSource = glad_debug_impl_glGetShaderSource;
+static GLint APIENTRY glad_debug_impl_glGetUniformLocation(GLuint arg0, const GLchar * arg1) {
+    GLint ret;
+    _pre_call_callback("glGetUniformLocation", (void*)glad_glGetUniformLocation, 2, arg0, arg1);
+    ret = GLAD_GL_FUNCTION(PFNGLGETUNIFORMLOCATIONPROC, GetUniformLocation, glad_glGetUniformLocation)(arg0, arg1);
+    _post_call_callback("glGetUniformLocation", (void*)glad_glGetUniformLocation, 2, arg0, arg1);
+    return ret;
+}
+PFNGLGETUNIFORMLOCATIONPROC glad_debug_glGetUniformLocation = glad_debug_impl_glGetUniformLocation;
+static void APIENTRY glad_debug_impl_glGetUniformfv(GLuint arg0, GLint arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetUniformfv", (void*)glad_glGetUniformfv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETUNIFORMFVPROC, GetUniformfv, glad_glGetUniformfv)(arg0, arg1, arg2);
+    _post_call_callback("glGetUniformfv", (void*)glad_glGetUniformfv, 3, arg0, arg1, arg2);
+}
+PFNGLGETUNIFORMFVPROC glad_debug_glGetUniformfv = glad_debug_impl_glGetUniformfv;
+static void APIENTRY glad_debug_impl_glGetUniformiv(GLuint arg0, GLint arg1, GLint * arg2) {
+    _pre_call_callback("glGetUniformiv", (void*)glad_glGetUniformiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETUNIFORMIVPROC, GetUniformiv, glad_glGetUniformiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetUniformiv", (void*)glad_glGetUniformiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETUNIFORMIVPROC glad_debug_glGetUniformiv = glad_debug_impl_glGetUniformiv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribdv(GLuint arg0, GLenum arg1, GLdouble * arg2) {
+    _pre_call_callback("glGetVertexAttribdv", (void*)glad_glGetVertexAttribdv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETVERTEXATTRIBDVPROC, GetVertexAttribdv, glad_glGetVertexAttribdv)(arg0, arg1, arg2);
+    _post_call_callback("glGetVertexAttribdv", (void*)glad_glGetVertexAttribdv, 3, arg0, arg1, arg2);
+}
+PFNGLGETVERTEXATTRIBDVPROC glad_debug_glGetVertexAttribdv = glad_debug_impl_glGetVertexAttribdv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetVertexAttribfv", (void*)glad_glGetVertexAttribfv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETVERTEXATTRIBFVPROC, GetVertexAttribfv, glad_glGetVertexAttribfv)(arg0, arg1, arg2);
+    _post_call_callback("glGetVertexAttribfv", (void*)glad_glGetVertexAttribfv, 3, arg0, arg1, arg2);
+}
+PFNGLGETVERTEXATTRIBFVPROC glad_debug_glGetVertexAttribfv = glad_debug_impl_glGetVertexAttribfv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetVertexAttribiv", (void*)glad_glGetVertexAttribiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETVERTEXATTRIBIVPROC, GetVertexAttribiv, glad_glGetVertexAttribiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetVertexAttribiv", (void*)glad_glGetVertexAttribiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETVERTEXATTRIBIVPROC glad_debug_glGetVertexAttribiv = glad_debug_impl_glGetVertexAttribiv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribPointerv(GLuint arg0, GLenum arg1, void ** arg2) {
+    _pre_call_callback("glGetVertexAttribPointerv", (void*)glad_glGetVertexAttribPointerv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETVERTEXATTRIBPOINTERVPROC, GetVertexAttribPointerv, glad_glGetVertexAttribPointerv)(arg0, arg1, arg2);
+    _post_call_callback("glGetVertexAttribPointerv", (void*)glad_glGetVertexAttribPointerv, 3, arg0, arg1, arg2);
+}
+PFNGLGETVERTEXATTRIBPOINTERVPROC glad_debug_glGetVertexAttribPointerv = glad_debug_impl_glGetVertexAttribPointerv;
+static GLboolean APIENTRY glad_debug_impl_glIsProgram(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsProgram", (void*)glad_glIsProgram, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLISPROGRAMPROC, IsProgram, glad_glIsProgram)(arg0);
+    _post_call_callback("glIsProgram", (void*)glad_glIsProgram, 1, arg0);
+    return ret;
+}
+PFNGLISPROGRAMPROC glad_debug_glIsProgram = glad_debug_impl_glIsProgram;
+static GLboolean APIENTRY glad_debug_impl_glIsShader(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsShader", (void*)glad_glIsShader, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLISSHADERPROC, IsShader, glad_glIsShader)(arg0);
+    _post_call_callback("glIsShader", (void*)glad_glIsShader, 1, arg0);
+    return ret;
+}
+PFNGLISSHADERPROC glad_debug_glIsShader = glad_debug_impl_glIsShader;
+static void APIENTRY glad_debug_impl_glLinkProgram(GLuint arg0) {
+    _pre_call_callback("glLinkProgram", (void*)glad_glLinkProgram, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLLINKPROGRAMPROC, LinkProgram, glad_glLinkProgram)(arg0);
+    _post_call_callback("glLinkProgram", (void*)glad_glLinkProgram, 1, arg0);
+}
+PFNGLLINKPROGRAMPROC glad_debug_glLinkProgram = glad_debug_impl_glLinkProgram;
+static void APIENTRY glad_debug_impl_glShaderSource(GLuint arg0, GLsizei arg1, const GLchar *const* arg2, const GLint * arg3) {
+    _pre_call_callback("glShaderSource", (void*)glad_glShaderSource, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLSHADERSOURCEPROC, ShaderSource, glad_glShaderSource)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glShaderSource", (void*)glad_glShaderSource, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLSHADERSOURCEPROC glad_debug_glShaderSource = glad_debug_impl_glShaderSource;
+static void APIENTRY glad_debug_impl_glUseProgram(GLuint arg0) {
+    _pre_call_callback("glUseProgram", (void*)glad_glUseProgram, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLUSEPROGRAMPROC, UseProgram, glad_glUseProgram)(arg0);
+    _post_call_callback("glUseProgram", (void*)glad_glUseProgram, 1, arg0);
+}
+PFNGLUSEPROGRAMPROC glad_debug_glUseProgram = glad_debug_impl_glUseProgram;
+static void APIENTRY glad_debug_impl_glUniform1f(GLint arg0, GLfloat arg1) {
+    _pre_call_callback("glUniform1f", (void*)glad_glUniform1f, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM1FPROC, Uniform1f, glad_glUniform1f)(arg0, arg1);
+    _post_call_callback("glUniform1f", (void*)glad_glUniform1f, 2, arg0, arg1);
+}
+PFNGLUNIFORM1FPROC glad_debug_glUniform1f = glad_debug_impl_glUniform1f;
+static void APIENTRY glad_debug_impl_glUniform2f(GLint arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glUniform2f", (void*)glad_glUniform2f, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM2FPROC, Uniform2f, glad_glUniform2f)(arg0, arg1, arg2);
+    _post_call_callback("glUniform2f", (void*)glad_glUniform2f, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM2FPROC glad_debug_glUniform2f = glad_debug_impl_glUniform2f;
+static void APIENTRY glad_debug_impl_glUniform3f(GLint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glUniform3f", (void*)glad_glUniform3f, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM3FPROC, Uniform3f, glad_glUniform3f)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniform3f", (void*)glad_glUniform3f, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORM3FPROC glad_debug_glUniform3f = glad_debug_impl_glUniform3f;
+static void APIENTRY glad_debug_impl_glUniform4f(GLint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+    _pre_call_callback("glUniform4f", (void*)glad_glUniform4f, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM4FPROC, Uniform4f, glad_glUniform4f)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glUniform4f", (void*)glad_glUniform4f, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLUNIFORM4FPROC glad_debug_glUniform4f = glad_debug_impl_glUniform4f;
+static void APIENTRY glad_debug_impl_glUniform1i(GLint arg0, GLint arg1) {
+    _pre_call_callback("glUniform1i", (void*)glad_glUniform1i, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM1IPROC, Uniform1i, glad_glUniform1i)(arg0, arg1);
+    _post_call_callback("glUniform1i", (void*)glad_glUniform1i, 2, arg0, arg1);
+}
+PFNGLUNIFORM1IPROC glad_debug_glUniform1i = glad_debug_impl_glUniform1i;
+static void APIENTRY glad_debug_impl_glUniform2i(GLint arg0, GLint arg1, GLint arg2) {
+    _pre_call_callback("glUniform2i", (void*)glad_glUniform2i, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM2IPROC, Uniform2i, glad_glUniform2i)(arg0, arg1, arg2);
+    _post_call_callback("glUniform2i", (void*)glad_glUniform2i, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM2IPROC glad_debug_glUniform2i = glad_debug_impl_glUniform2i;
+static void APIENTRY glad_debug_impl_glUniform3i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+    _pre_call_callback("glUniform3i", (void*)glad_glUniform3i, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM3IPROC, Uniform3i, glad_glUniform3i)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniform3i", (void*)glad_glUniform3i, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORM3IPROC glad_debug_glUniform3i = glad_debug_impl_glUniform3i;
+static void APIENTRY glad_debug_impl_glUniform4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+    _pre_call_callback("glUniform4i", (void*)glad_glUniform4i, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM4IPROC, Uniform4i, glad_glUniform4i)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glUniform4i", (void*)glad_glUniform4i, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLUNIFORM4IPROC glad_debug_glUniform4i = glad_debug_impl_glUniform4i;
+static void APIENTRY glad_debug_impl_glUniform1fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+    _pre_call_callback("glUniform1fv", (void*)glad_glUniform1fv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM1FVPROC, Uniform1fv, glad_glUniform1fv)(arg0, arg1, arg2);
+    _post_call_callback("glUniform1fv", (void*)glad_glUniform1fv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM1FVPROC glad_debug_glUniform1fv = glad_debug_impl_glUniform1fv;
+static void APIENTRY glad_debug_impl_glUniform2fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+    _pre_call_callback("glUniform2fv", (void*)glad_glUniform2fv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM2FVPROC, Uniform2fv, glad_glUniform2fv)(arg0, arg1, arg2);
+    _post_call_callback("glUniform2fv", (void*)glad_glUniform2fv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM2FVPROC glad_debug_glUniform2fv = glad_debug_impl_glUniform2fv;
+static void APIENTRY glad_debug_impl_glUniform3fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+    _pre_call_callback("glUniform3fv", (void*)glad_glUniform3fv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM3FVPROC, Uniform3fv, glad_glUniform3fv)(arg0, arg1, arg2);
+    _post_call_callback("glUniform3fv", (void*)glad_glUniform3fv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM3FVPROC glad_debug_glUniform3fv = glad_debug_impl_glUniform3fv;
+static void APIENTRY glad_debug_impl_glUniform4fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+    _pre_call_callback("glUniform4fv", (void*)glad_glUniform4fv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM4FVPROC, Uniform4fv, glad_glUniform4fv)(arg0, arg1, arg2);
+    _post_call_callback("glUniform4fv", (void*)glad_glUniform4fv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM4FVPROC glad_debug_glUniform4fv = glad_debug_impl_glUniform4fv;
+static void APIENTRY glad_debug_impl_glUniform1iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+    _pre_call_callback("glUniform1iv", (void*)glad_glUniform1iv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM1IVPROC, Uniform1iv, glad_glUniform1iv)(arg0, arg1, arg2);
+    _post_call_callback("glUniform1iv", (void*)glad_glUniform1iv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM1IVPROC glad_debug_glUniform1iv = glad_debug_impl_glUniform1iv;
+static void APIENTRY glad_debug_impl_glUniform2iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+    _pre_call_callback("glUniform2iv", (void*)glad_glUniform2iv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM2IVPROC, Uniform2iv, glad_glUniform2iv)(arg0, arg1, arg2);
+    _post_call_callback("glUniform2iv", (void*)glad_glUniform2iv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM2IVPROC glad_debug_glUniform2iv = glad_debug_impl_glUniform2iv;
+static void APIENTRY glad_debug_impl_glUniform3iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+    _pre_call_callback("glUniform3iv", (void*)glad_glUniform3iv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM3IVPROC, Uniform3iv, glad_glUniform3iv)(arg0, arg1, arg2);
+    _post_call_callback("glUniform3iv", (void*)glad_glUniform3iv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM3IVPROC glad_debug_glUniform3iv = glad_debug_impl_glUniform3iv;
+static void APIENTRY glad_debug_impl_glUniform4iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+    _pre_call_callback("glUniform4iv", (void*)glad_glUniform4iv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM4IVPROC, Uniform4iv, glad_glUniform4iv)(arg0, arg1, arg2);
+    _post_call_callback("glUniform4iv", (void*)glad_glUniform4iv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM4IVPROC glad_debug_glUniform4iv = glad_debug_impl_glUniform4iv;
+static void APIENTRY glad_debug_impl_glUniformMatrix2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix2fv", (void*)glad_glUniformMatrix2fv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX2FVPROC, UniformMatrix2fv, glad_glUniformMatrix2fv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix2fv", (void*)glad_glUniformMatrix2fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX2FVPROC glad_debug_glUniformMatrix2fv = glad_debug_impl_glUniformMatrix2fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix3fv", (void*)glad_glUniformMatrix3fv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX3FVPROC, UniformMatrix3fv, glad_glUniformMatrix3fv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix3fv", (void*)glad_glUniformMatrix3fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX3FVPROC glad_debug_glUniformMatrix3fv = glad_debug_impl_glUniformMatrix3fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix4fv", (void*)glad_glUniformMatrix4fv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX4FVPROC, UniformMatrix4fv, glad_glUniformMatrix4fv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix4fv", (void*)glad_glUniformMatrix4fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX4FVPROC glad_debug_glUniformMatrix4fv = glad_debug_impl_glUniformMatrix4fv;
+static void APIENTRY glad_debug_impl_glValidateProgram(GLuint arg0) {
+    _pre_call_callback("glValidateProgram", (void*)glad_glValidateProgram, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLVALIDATEPROGRAMPROC, ValidateProgram, glad_glValidateProgram)(arg0);
+    _post_call_callback("glValidateProgram", (void*)glad_glValidateProgram, 1, arg0);
+}
+PFNGLVALIDATEPROGRAMPROC glad_debug_glValidateProgram = glad_debug_impl_glValidateProgram;
+static void APIENTRY glad_debug_impl_glVertexAttrib1d(GLuint arg0, GLdouble arg1) {
+    _pre_call_callback("glVertexAttrib1d", (void*)glad_glVertexAttrib1d, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB1DPROC, VertexAttrib1d, glad_glVertexAttrib1d)(arg0, arg1);
+    _post_call_callback("glVertexAttrib1d", (void*)glad_glVertexAttrib1d, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB1DPROC glad_debug_glVertexAttrib1d = glad_debug_impl_glVertexAttrib1d;
+static void APIENTRY glad_debug_impl_glVertexAttrib1dv(GLuint arg0, const GLdouble * arg1) {
+    _pre_call_callback("glVertexAttrib1dv", (void*)glad_glVertexAttrib1dv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB1DVPROC, VertexAttrib1dv, glad_glVertexAttrib1dv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib1dv", (void*)glad_glVertexAttrib1dv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB1DVPROC glad_debug_glVertexAttrib1dv = glad_debug_impl_glVertexAttrib1dv;
+static void APIENTRY glad_debug_impl_glVertexAttrib1f(GLuint arg0, GLfloat arg1) {
+    _pre_call_callback("glVertexAttrib1f", (void*)glad_glVertexAttrib1f, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB1FPROC, VertexAttrib1f, glad_glVertexAttrib1f)(arg0, arg1);
+    _post_call_callback("glVertexAttrib1f", (void*)glad_glVertexAttrib1f, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB1FPROC glad_debug_glVertexAttrib1f = glad_debug_impl_glVertexAttrib1f;
+static void APIENTRY glad_debug_impl_glVertexAttrib1fv(GLuint arg0, const GLfloat * arg1) {
+    _pre_call_callback("glVertexAttrib1fv", (void*)glad_glVertexAttrib1fv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB1FVPROC, VertexAttrib1fv, glad_glVertexAttrib1fv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib1fv", (void*)glad_glVertexAttrib1fv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB1FVPROC glad_debug_glVertexAttrib1fv = glad_debug_impl_glVertexAttrib1fv;
+static void APIENTRY glad_debug_impl_glVertexAttrib1s(GLuint arg0, GLshort arg1) {
+    _pre_call_callback("glVertexAttrib1s", (void*)glad_glVertexAttrib1s, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB1SPROC, VertexAttrib1s, glad_glVertexAttrib1s)(arg0, arg1);
+    _post_call_callback("glVertexAttrib1s", (void*)glad_glVertexAttrib1s, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB1SPROC glad_debug_glVertexAttrib1s = glad_debug_impl_glVertexAttrib1s;
+static void APIENTRY glad_debug_impl_glVertexAttrib1sv(GLuint arg0, const GLshort * arg1) {
+    _pre_call_callback("glVertexAttrib1sv", (void*)glad_glVertexAttrib1sv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB1SVPROC, VertexAttrib1sv, glad_glVertexAttrib1sv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib1sv", (void*)glad_glVertexAttrib1sv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB1SVPROC glad_debug_glVertexAttrib1sv = glad_debug_impl_glVertexAttrib1sv;
+static void APIENTRY glad_debug_impl_glVertexAttrib2d(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+    _pre_call_callback("glVertexAttrib2d", (void*)glad_glVertexAttrib2d, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB2DPROC, VertexAttrib2d, glad_glVertexAttrib2d)(arg0, arg1, arg2);
+    _post_call_callback("glVertexAttrib2d", (void*)glad_glVertexAttrib2d, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEXATTRIB2DPROC glad_debug_glVertexAttrib2d = glad_debug_impl_glVertexAttrib2d;
+static void APIENTRY glad_debug_impl_glVertexAttrib2dv(GLuint arg0, const GLdouble * arg1) {
+    _pre_call_callback("glVertexAttrib2dv", (void*)glad_glVertexAttrib2dv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB2DVPROC, VertexAttrib2dv, glad_glVertexAttrib2dv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib2dv", (void*)glad_glVertexAttrib2dv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB2DVPROC glad_debug_glVertexAttrib2dv = glad_debug_impl_glVertexAttrib2dv;
+static void APIENTRY glad_debug_impl_glVertexAttrib2f(GLuint arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glVertexAttrib2f", (void*)glad_glVertexAttrib2f, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB2FPROC, VertexAttrib2f, glad_glVertexAttrib2f)(arg0, arg1, arg2);
+    _post_call_callback("glVertexAttrib2f", (void*)glad_glVertexAttrib2f, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEXATTRIB2FPROC glad_debug_glVertexAttrib2f = glad_debug_impl_glVertexAttrib2f;
+static void APIENTRY glad_debug_impl_glVertexAttrib2fv(GLuint arg0, const GLfloat * arg1) {
+    _pre_call_callback("glVertexAttrib2fv", (void*)glad_glVertexAttrib2fv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB2FVPROC, VertexAttrib2fv, glad_glVertexAttrib2fv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib2fv", (void*)glad_glVertexAttrib2fv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB2FVPROC glad_debug_glVertexAttrib2fv = glad_debug_impl_glVertexAttrib2fv;
+static void APIENTRY glad_debug_impl_glVertexAttrib2s(GLuint arg0, GLshort arg1, GLshort arg2) {
+    _pre_call_callback("glVertexAttrib2s", (void*)glad_glVertexAttrib2s, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB2SPROC, VertexAttrib2s, glad_glVertexAttrib2s)(arg0, arg1, arg2);
+    _post_call_callback("glVertexAttrib2s", (void*)glad_glVertexAttrib2s, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEXATTRIB2SPROC glad_debug_glVertexAttrib2s = glad_debug_impl_glVertexAttrib2s;
+static void APIENTRY glad_debug_impl_glVertexAttrib2sv(GLuint arg0, const GLshort * arg1) {
+    _pre_call_callback("glVertexAttrib2sv", (void*)glad_glVertexAttrib2sv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB2SVPROC, VertexAttrib2sv, glad_glVertexAttrib2sv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib2sv", (void*)glad_glVertexAttrib2sv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB2SVPROC glad_debug_glVertexAttrib2sv = glad_debug_impl_glVertexAttrib2sv;
+static void APIENTRY glad_debug_impl_glVertexAttrib3d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+    _pre_call_callback("glVertexAttrib3d", (void*)glad_glVertexAttrib3d, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB3DPROC, VertexAttrib3d, glad_glVertexAttrib3d)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttrib3d", (void*)glad_glVertexAttrib3d, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIB3DPROC glad_debug_glVertexAttrib3d = glad_debug_impl_glVertexAttrib3d;
+static void APIENTRY glad_debug_impl_glVertexAttrib3dv(GLuint arg0, const GLdouble * arg1) {
+    _pre_call_callback("glVertexAttrib3dv", (void*)glad_glVertexAttrib3dv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB3DVPROC, VertexAttrib3dv, glad_glVertexAttrib3dv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib3dv", (void*)glad_glVertexAttrib3dv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB3DVPROC glad_debug_glVertexAttrib3dv = glad_debug_impl_glVertexAttrib3dv;
+static void APIENTRY glad_debug_impl_glVertexAttrib3f(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glVertexAttrib3f", (void*)glad_glVertexAttrib3f, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB3FPROC, VertexAttrib3f, glad_glVertexAttrib3f)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttrib3f", (void*)glad_glVertexAttrib3f, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIB3FPROC glad_debug_glVertexAttrib3f = glad_debug_impl_glVertexAttrib3f;
+static void APIENTRY glad_debug_impl_glVertexAttrib3fv(GLuint arg0, const GLfloat * arg1) {
+    _pre_call_callback("glVertexAttrib3fv", (void*)glad_glVertexAttrib3fv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB3FVPROC, VertexAttrib3fv, glad_glVertexAttrib3fv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib3fv", (void*)glad_glVertexAttrib3fv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB3FVPROC glad_debug_glVertexAttrib3fv = glad_debug_impl_glVertexAttrib3fv;
+static void APIENTRY glad_debug_impl_glVertexAttrib3s(GLuint arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+    _pre_call_callback("glVertexAttrib3s", (void*)glad_glVertexAttrib3s, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB3SPROC, VertexAttrib3s, glad_glVertexAttrib3s)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttrib3s", (void*)glad_glVertexAttrib3s, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIB3SPROC glad_debug_glVertexAttrib3s = glad_debug_impl_glVertexAttrib3s;
+static void APIENTRY glad_debug_impl_glVertexAttrib3sv(GLuint arg0, const GLshort * arg1) {
+    _pre_call_callback("glVertexAttrib3sv", (void*)glad_glVertexAttrib3sv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB3SVPROC, VertexAttrib3sv, glad_glVertexAttrib3sv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib3sv", (void*)glad_glVertexAttrib3sv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB3SVPROC glad_debug_glVertexAttrib3sv = glad_debug_impl_glVertexAttrib3sv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nbv(GLuint arg0, const GLbyte * arg1) {
+    _pre_call_callback("glVertexAttrib4Nbv", (void*)glad_glVertexAttrib4Nbv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NBVPROC, VertexAttrib4Nbv, glad_glVertexAttrib4Nbv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4Nbv", (void*)glad_glVertexAttrib4Nbv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4NBVPROC glad_debug_glVertexAttrib4Nbv = glad_debug_impl_glVertexAttrib4Nbv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Niv(GLuint arg0, const GLint * arg1) {
+    _pre_call_callback("glVertexAttrib4Niv", (void*)glad_glVertexAttrib4Niv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NIVPROC, VertexAttrib4Niv, glad_glVertexAttrib4Niv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4Niv", (void*)glad_glVertexAttrib4Niv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4NIVPROC glad_debug_glVertexAttrib4Niv = glad_debug_impl_glVertexAttrib4Niv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nsv(GLuint arg0, const GLshort * arg1) {
+    _pre_call_callback("glVertexAttrib4Nsv", (void*)glad_glVertexAttrib4Nsv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NSVPROC, VertexAttrib4Nsv, glad_glVertexAttrib4Nsv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4Nsv", (void*)glad_glVertexAttrib4Nsv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4NSVPROC glad_debug_glVertexAttrib4Nsv = glad_debug_impl_glVertexAttrib4Nsv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nub(GLuint arg0, GLubyte arg1, GLubyte arg2, GLubyte arg3, GLubyte arg4) {
+    _pre_call_callback("glVertexAttrib4Nub", (void*)glad_glVertexAttrib4Nub, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NUBPROC, VertexAttrib4Nub, glad_glVertexAttrib4Nub)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttrib4Nub", (void*)glad_glVertexAttrib4Nub, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIB4NUBPROC glad_debug_glVertexAttrib4Nub = glad_debug_impl_glVertexAttrib4Nub;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nubv(GLuint arg0, const GLubyte * arg1) {
+    _pre_call_callback("glVertexAttrib4Nubv", (void*)glad_glVertexAttrib4Nubv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NUBVPROC, VertexAttrib4Nubv, glad_glVertexAttrib4Nubv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4Nubv", (void*)glad_glVertexAttrib4Nubv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4NUBVPROC glad_debug_glVertexAttrib4Nubv = glad_debug_impl_glVertexAttrib4Nubv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nuiv(GLuint arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexAttrib4Nuiv", (void*)glad_glVertexAttrib4Nuiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NUIVPROC, VertexAttrib4Nuiv, glad_glVertexAttrib4Nuiv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4Nuiv", (void*)glad_glVertexAttrib4Nuiv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4NUIVPROC glad_debug_glVertexAttrib4Nuiv = glad_debug_impl_glVertexAttrib4Nuiv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nusv(GLuint arg0, const GLushort * arg1) {
+    _pre_call_callback("glVertexAttrib4Nusv", (void*)glad_glVertexAttrib4Nusv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NUSVPROC, VertexAttrib4Nusv, glad_glVertexAttrib4Nusv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4Nusv", (void*)glad_glVertexAttrib4Nusv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4NUSVPROC glad_debug_glVertexAttrib4Nusv = glad_debug_impl_glVertexAttrib4Nusv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4bv(GLuint arg0, const GLbyte * arg1) {
+    _pre_call_callback("glVertexAttrib4bv", (void*)glad_glVertexAttrib4bv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4BVPROC, VertexAttrib4bv, glad_glVertexAttrib4bv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4bv", (void*)glad_glVertexAttrib4bv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4BVPROC glad_debug_glVertexAttrib4bv = glad_debug_impl_glVertexAttrib4bv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+    _pre_call_callback("glVertexAttrib4d", (void*)glad_glVertexAttrib4d, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4DPROC, VertexAttrib4d, glad_glVertexAttrib4d)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttrib4d", (void*)glad_glVertexAttrib4d, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIB4DPROC glad_debug_glVertexAttrib4d = glad_debug_impl_glVertexAttrib4d;
+static void APIENTRY glad_debug_impl_glVertexAttrib4dv(GLuint arg0, const GLdouble * arg1) {
+    _pre_call_callback("glVertexAttrib4dv", (void*)glad_glVertexAttrib4dv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4DVPROC, VertexAttrib4dv, glad_glVertexAttrib4dv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4dv", (void*)glad_glVertexAttrib4dv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4DVPROC glad_debug_glVertexAttrib4dv = glad_debug_impl_glVertexAttrib4dv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4f(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+    _pre_call_callback("glVertexAttrib4f", (void*)glad_glVertexAttrib4f, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4FPROC, VertexAttrib4f, glad_glVertexAttrib4f)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttrib4f", (void*)glad_glVertexAttrib4f, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIB4FPROC glad_debug_glVertexAttrib4f = glad_debug_impl_glVertexAttrib4f;
+static void APIENTRY glad_debug_impl_glVertexAttrib4fv(GLuint arg0, const GLfloat * arg1) {
+    _pre_call_callback("glVertexAttrib4fv", (void*)glad_glVertexAttrib4fv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4FVPROC, VertexAttrib4fv, glad_glVertexAttrib4fv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4fv", (void*)glad_glVertexAttrib4fv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4FVPROC glad_debug_glVertexAttrib4fv = glad_debug_impl_glVertexAttrib4fv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4iv(GLuint arg0, const GLint * arg1) {
+    _pre_call_callback("glVertexAttrib4iv", (void*)glad_glVertexAttrib4iv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4IVPROC, VertexAttrib4iv, glad_glVertexAttrib4iv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4iv", (void*)glad_glVertexAttrib4iv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4IVPROC glad_debug_glVertexAttrib4iv = glad_debug_impl_glVertexAttrib4iv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4s(GLuint arg0, GLshort arg1, GLshort arg2, GLshort arg3, GLshort arg4) {
+    _pre_call_callback("glVertexAttrib4s", (void*)glad_glVertexAttrib4s, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4SPROC, VertexAttrib4s, glad_glVertexAttrib4s)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttrib4s", (void*)glad_glVertexAttrib4s, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIB4SPROC glad_debug_glVertexAttrib4s = glad_debug_impl_glVertexAttrib4s;
+static void APIENTRY glad_debug_impl_glVertexAttrib4sv(GLuint arg0, const GLshort * arg1) {
+    _pre_call_callback("glVertexAttrib4sv", (void*)glad_glVertexAttrib4sv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4SVPROC, VertexAttrib4sv, glad_glVertexAttrib4sv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4sv", (void*)glad_glVertexAttrib4sv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4SVPROC glad_debug_glVertexAttrib4sv = glad_debug_impl_glVertexAttrib4sv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4ubv(GLuint arg0, const GLubyte * arg1) {
+    _pre_call_callback("glVertexAttrib4ubv", (void*)glad_glVertexAttrib4ubv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4UBVPROC, VertexAttrib4ubv, glad_glVertexAttrib4ubv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4ubv", (void*)glad_glVertexAttrib4ubv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4UBVPROC glad_debug_glVertexAttrib4ubv = glad_debug_impl_glVertexAttrib4ubv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4uiv(GLuint arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexAttrib4uiv", (void*)glad_glVertexAttrib4uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4UIVPROC, VertexAttrib4uiv, glad_glVertexAttrib4uiv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4uiv", (void*)glad_glVertexAttrib4uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4UIVPROC glad_debug_glVertexAttrib4uiv = glad_debug_impl_glVertexAttrib4uiv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4usv(GLuint arg0, const GLushort * arg1) {
+    _pre_call_callback("glVertexAttrib4usv", (void*)glad_glVertexAttrib4usv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4USVPROC, VertexAttrib4usv, glad_glVertexAttrib4usv)(arg0, arg1);
+    _post_call_callback("glVertexAttrib4usv", (void*)glad_glVertexAttrib4usv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4USVPROC glad_debug_glVertexAttrib4usv = glad_debug_impl_glVertexAttrib4usv;
+static void APIENTRY glad_debug_impl_glVertexAttribPointer(GLuint arg0, GLint arg1, GLenum arg2, GLboolean arg3, GLsizei arg4, const void * arg5) {
+    _pre_call_callback("glVertexAttribPointer", (void*)glad_glVertexAttribPointer, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBPOINTERPROC, VertexAttribPointer, glad_glVertexAttribPointer)(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glVertexAttribPointer", (void*)glad_glVertexAttribPointer, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLVERTEXATTRIBPOINTERPROC glad_debug_glVertexAttribPointer = glad_debug_impl_glVertexAttribPointer;
+static void APIENTRY glad_debug_impl_glUniformMatrix2x3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix2x3fv", (void*)glad_glUniformMatrix2x3fv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX2X3FVPROC, UniformMatrix2x3fv, glad_glUniformMatrix2x3fv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix2x3fv", (void*)glad_glUniformMatrix2x3fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX2X3FVPROC glad_debug_glUniformMatrix2x3fv = glad_debug_impl_glUniformMatrix2x3fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix3x2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix3x2fv", (void*)glad_glUniformMatrix3x2fv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX3X2FVPROC, UniformMatrix3x2fv, glad_glUniformMatrix3x2fv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix3x2fv", (void*)glad_glUniformMatrix3x2fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX3X2FVPROC glad_debug_glUniformMatrix3x2fv = glad_debug_impl_glUniformMatrix3x2fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix2x4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix2x4fv", (void*)glad_glUniformMatrix2x4fv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX2X4FVPROC, UniformMatrix2x4fv, glad_glUniformMatrix2x4fv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix2x4fv", (void*)glad_glUniformMatrix2x4fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX2X4FVPROC glad_debug_glUniformMatrix2x4fv = glad_debug_impl_glUniformMatrix2x4fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix4x2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix4x2fv", (void*)glad_glUniformMatrix4x2fv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX4X2FVPROC, UniformMatrix4x2fv, glad_glUniformMatrix4x2fv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix4x2fv", (void*)glad_glUniformMatrix4x2fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX4X2FVPROC glad_debug_glUniformMatrix4x2fv = glad_debug_impl_glUniformMatrix4x2fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix3x4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix3x4fv", (void*)glad_glUniformMatrix3x4fv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX3X4FVPROC, UniformMatrix3x4fv, glad_glUniformMatrix3x4fv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix3x4fv", (void*)glad_glUniformMatrix3x4fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX3X4FVPROC glad_debug_glUniformMatrix3x4fv = glad_debug_impl_glUniformMatrix3x4fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix4x3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix4x3fv", (void*)glad_glUniformMatrix4x3fv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX4X3FVPROC, UniformMatrix4x3fv, glad_glUniformMatrix4x3fv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix4x3fv", (void*)glad_glUniformMatrix4x3fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX4X3FVPROC glad_debug_glUniformMatrix4x3fv = glad_debug_impl_glUniformMatrix4x3fv;
+static void APIENTRY glad_debug_impl_glColorMaski(GLuint arg0, GLboolean arg1, GLboolean arg2, GLboolean arg3, GLboolean arg4) {
+    _pre_call_callback("glColorMaski", (void*)glad_glColorMaski, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLCOLORMASKIPROC, ColorMaski, glad_glColorMaski)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glColorMaski", (void*)glad_glColorMaski, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLCOLORMASKIPROC glad_debug_glColorMaski = glad_debug_impl_glColorMaski;
+static void APIENTRY glad_debug_impl_glGetBooleani_v(GLenum arg0, GLuint arg1, GLboolean * arg2) {
+    _pre_call_callback("glGetBooleani_v", (void*)glad_glGetBooleani_v, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETBOOLEANI_VPROC, GetBooleani_v, glad_glGetBooleani_v)(arg0, arg1, arg2);
+    _post_call_callback("glGetBooleani_v", (void*)glad_glGetBooleani_v, 3, arg0, arg1, arg2);
+}
+PFNGLGETBOOLEANI_VPROC glad_debug_glGetBooleani_v = glad_debug_impl_glGetBooleani_v;
+static void APIENTRY glad_debug_impl_glGetIntegeri_v(GLenum arg0, GLuint arg1, GLint * arg2) {
+    _pre_call_callback("glGetIntegeri_v", (void*)glad_glGetIntegeri_v, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETINTEGERI_VPROC, GetIntegeri_v, glad_glGetIntegeri_v)(arg0, arg1, arg2);
+    _post_call_callback("glGetIntegeri_v", (void*)glad_glGetIntegeri_v, 3, arg0, arg1, arg2);
+}
+PFNGLGETINTEGERI_VPROC glad_debug_glGetIntegeri_v = glad_debug_impl_glGetIntegeri_v;
+static void APIENTRY glad_debug_impl_glEnablei(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glEnablei", (void*)glad_glEnablei, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLENABLEIPROC, Enablei, glad_glEnablei)(arg0, arg1);
+    _post_call_callback("glEnablei", (void*)glad_glEnablei, 2, arg0, arg1);
+}
+PFNGLENABLEIPROC glad_debug_glEnablei = glad_debug_impl_glEnablei;
+static void APIENTRY glad_debug_impl_glDisablei(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glDisablei", (void*)glad_glDisablei, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLDISABLEIPROC, Disablei, glad_glDisablei)(arg0, arg1);
+    _post_call_callback("glDisablei", (void*)glad_glDisablei, 2, arg0, arg1);
+}
+PFNGLDISABLEIPROC glad_debug_glDisablei = glad_debug_impl_glDisablei;
+static GLboolean APIENTRY glad_debug_impl_glIsEnabledi(GLenum arg0, GLuint arg1) {
+    GLboolean ret;
+    _pre_call_callback("glIsEnabledi", (void*)glad_glIsEnabledi, 2, arg0, arg1);
+    ret = GLAD_GL_FUNCTION(PFNGLISENABLEDIPROC, IsEnabledi, glad_glIsEnabledi)(arg0, arg1);
+    _post_call_callback("glIsEnabledi", (void*)glad_glIsEnabledi, 2, arg0, arg1);
+    return ret;
+}
+PFNGLISENABLEDIPROC glad_debug_glIsEnabledi = glad_debug_impl_glIsEnabledi;
+static void APIENTRY glad_debug_impl_glBeginTransformFeedback(GLenum arg0) {
+    _pre_call_callback("glBeginTransformFeedback", (void*)glad_glBeginTransformFeedback, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLBEGINTRANSFORMFEEDBACKPROC, BeginTransformFeedback, glad_glBeginTransformFeedback)(arg0);
+    _post_call_callback("glBeginTransformFeedback", (void*)glad_glBeginTransformFeedback, 1, arg0);
+}
+PFNGLBEGINTRANSFORMFEEDBACKPROC glad_debug_glBeginTransformFeedback = glad_debug_impl_glBeginTransformFeedback;
+static void APIENTRY glad_debug_impl_glEndTransformFeedback(void) {
+    _pre_call_callback("glEndTransformFeedback", (void*)glad_glEndTransformFeedback, 0);
+    GLAD_GL_FUNCTION(PFNGLENDTRANSFORMFEEDBACKPROC, EndTransformFeedback, glad_glEndTransformFeedback)();
+    _post_call_callback("glEndTransformFeedback", (void*)glad_glEndTransformFeedback, 0);
+}
+PFNGLENDTRANSFORMFEEDBACKPROC glad_debug_glEndTransformFeedback = glad_debug_impl_glEndTransformFeedback;
+static void APIENTRY glad_debug_impl_glBindBufferRange(GLenum arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+    _pre_call_callback("glBindBufferRange", (void*)glad_glBindBufferRange, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLBINDBUFFERRANGEPROC, BindBufferRange, glad_glBindBufferRange)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glBindBufferRange", (void*)glad_glBindBufferRange, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLBINDBUFFERRANGEPROC glad_debug_glBindBufferRange = glad_debug_impl_glBindBufferRange;
+static void APIENTRY glad_debug_impl_glBindBufferBase(GLenum arg0, GLuint arg1, GLuint arg2) {
+    _pre_call_callback("glBindBufferBase", (void*)glad_glBindBufferBase, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLBINDBUFFERBASEPROC, BindBufferBase, glad_glBindBufferBase)(arg0, arg1, arg2);
+    _post_call_callback("glBindBufferBase", (void*)glad_glBindBufferBase, 3, arg0, arg1, arg2);
+}
+PFNGLBINDBUFFERBASEPROC glad_debug_glBindBufferBase = glad_debug_impl_glBindBufferBase;
+static void APIENTRY glad_debug_impl_glTransformFeedbackVaryings(GLuint arg0, GLsizei arg1, const GLchar *const* arg2, GLenum arg3) {
+    _pre_call_callback("glTransformFeedbackVaryings", (void*)glad_glTransformFeedbackVaryings, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLTRANSFORMFEEDBACKVARYINGSPROC, TransformFeedbackVaryings, glad_glTransformFeedbackVaryings)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glTransformFeedbackVaryings", (void*)glad_glTransformFeedbackVaryings, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_debug_glTransformFeedbackVaryings = glad_debug_impl_glTransformFeedbackVaryings;
+static void APIENTRY glad_debug_impl_glGetTransformFeedbackVarying(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLsizei * arg4, GLenum * arg5, GLchar * arg6) {
+    _pre_call_callback("glGetTransformFeedbackVarying", (void*)glad_glGetTransformFeedbackVarying, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    GLAD_GL_FUNCTION(PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, GetTransformFeedbackVarying, glad_glGetTransformFeedbackVarying)(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glGetTransformFeedbackVarying", (void*)glad_glGetTransformFeedbackVarying, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_debug_glGetTransformFeedbackVarying = glad_debug_impl_glGetTransformFeedbackVarying;
+static void APIENTRY glad_debug_impl_glClampColor(GLenum arg0, GLenum arg1) {
+    _pre_call_callback("glClampColor", (void*)glad_glClampColor, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLCLAMPCOLORPROC, ClampColor, glad_glClampColor)(arg0, arg1);
+    _post_call_callback("glClampColor", (void*)glad_glClampColor, 2, arg0, arg1);
+}
+PFNGLCLAMPCOLORPROC glad_debug_glClampColor = glad_debug_impl_glClampColor;
+static void APIENTRY glad_debug_impl_glBeginConditionalRender(GLuint arg0, GLenum arg1) {
+    _pre_call_callback("glBeginConditionalRender", (void*)glad_glBeginConditionalRender, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLBEGINCONDITIONALRENDERPROC, BeginConditionalRender, glad_glBeginConditionalRender)(arg0, arg1);
+    _post_call_callback("glBeginConditionalRender", (void*)glad_glBeginConditionalRender, 2, arg0, arg1);
+}
+PFNGLBEGINCONDITIONALRENDERPROC glad_debug_glBeginConditionalRender = glad_debug_impl_glBeginConditionalRender;
+static void APIENTRY glad_debug_impl_glEndConditionalRender(void) {
+    _pre_call_callback("glEndConditionalRender", (void*)glad_glEndConditionalRender, 0);
+    GLAD_GL_FUNCTION(PFNGLENDCONDITIONALRENDERPROC, EndConditionalRender, glad_glEndConditionalRender)();
+    _post_call_callback("glEndConditionalRender", (void*)glad_glEndConditionalRender, 0);
+}
+PFNGLENDCONDITIONALRENDERPROC glad_debug_glEndConditionalRender = glad_debug_impl_glEndConditionalRender;
+static void APIENTRY glad_debug_impl_glVertexAttribIPointer(GLuint arg0, GLint arg1, GLenum arg2, GLsizei arg3, const void * arg4) {
+    _pre_call_callback("glVertexAttribIPointer", (void*)glad_glVertexAttribIPointer, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBIPOINTERPROC, VertexAttribIPointer, glad_glVertexAttribIPointer)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttribIPointer", (void*)glad_glVertexAttribIPointer, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIBIPOINTERPROC glad_debug_glVertexAttribIPointer = glad_debug_impl_glVertexAttribIPointer;
+static void APIENTRY glad_debug_impl_glGetVertexAttribIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetVertexAttribIiv", (void*)glad_glGetVertexAttribIiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETVERTEXATTRIBIIVPROC, GetVertexAttribIiv, glad_glGetVertexAttribIiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetVertexAttribIiv", (void*)glad_glGetVertexAttribIiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETVERTEXATTRIBIIVPROC glad_debug_glGetVertexAttribIiv = glad_debug_impl_glGetVertexAttribIiv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+    _pre_call_callback("glGetVertexAttribIuiv", (void*)glad_glGetVertexAttribIuiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETVERTEXATTRIBIUIVPROC, GetVertexAttribIuiv, glad_glGetVertexAttribIuiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetVertexAttribIuiv", (void*)glad_glGetVertexAttribIuiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETVERTEXATTRIBIUIVPROC glad_debug_glGetVertexAttribIuiv = glad_debug_impl_glGetVertexAttribIuiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI1i(GLuint arg0, GLint arg1) {
+    _pre_call_callback("glVertexAttribI1i", (void*)glad_glVertexAttribI1i, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI1IPROC, VertexAttribI1i, glad_glVertexAttribI1i)(arg0, arg1);
+    _post_call_callback("glVertexAttribI1i", (void*)glad_glVertexAttribI1i, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI1IPROC glad_debug_glVertexAttribI1i = glad_debug_impl_glVertexAttribI1i;
+static void APIENTRY glad_debug_impl_glVertexAttribI2i(GLuint arg0, GLint arg1, GLint arg2) {
+    _pre_call_callback("glVertexAttribI2i", (void*)glad_glVertexAttribI2i, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI2IPROC, VertexAttribI2i, glad_glVertexAttribI2i)(arg0, arg1, arg2);
+    _post_call_callback("glVertexAttribI2i", (void*)glad_glVertexAttribI2i, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEXATTRIBI2IPROC glad_debug_glVertexAttribI2i = glad_debug_impl_glVertexAttribI2i;
+static void APIENTRY glad_debug_impl_glVertexAttribI3i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3) {
+    _pre_call_callback("glVertexAttribI3i", (void*)glad_glVertexAttribI3i, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI3IPROC, VertexAttribI3i, glad_glVertexAttribI3i)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribI3i", (void*)glad_glVertexAttribI3i, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBI3IPROC glad_debug_glVertexAttribI3i = glad_debug_impl_glVertexAttribI3i;
+static void APIENTRY glad_debug_impl_glVertexAttribI4i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+    _pre_call_callback("glVertexAttribI4i", (void*)glad_glVertexAttribI4i, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4IPROC, VertexAttribI4i, glad_glVertexAttribI4i)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttribI4i", (void*)glad_glVertexAttribI4i, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIBI4IPROC glad_debug_glVertexAttribI4i = glad_debug_impl_glVertexAttribI4i;
+static void APIENTRY glad_debug_impl_glVertexAttribI1ui(GLuint arg0, GLuint arg1) {
+    _pre_call_callback("glVertexAttribI1ui", (void*)glad_glVertexAttribI1ui, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI1UIPROC, VertexAttribI1ui, glad_glVertexAttribI1ui)(arg0, arg1);
+    _post_call_callback("glVertexAttribI1ui", (void*)glad_glVertexAttribI1ui, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI1UIPROC glad_debug_glVertexAttribI1ui = glad_debug_impl_glVertexAttribI1ui;
+static void APIENTRY glad_debug_impl_glVertexAttribI2ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+    _pre_call_callback("glVertexAttribI2ui", (void*)glad_glVertexAttribI2ui, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI2UIPROC, VertexAttribI2ui, glad_glVertexAttribI2ui)(arg0, arg1, arg2);
+    _post_call_callback("glVertexAttribI2ui", (void*)glad_glVertexAttribI2ui, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEXATTRIBI2UIPROC glad_debug_glVertexAttribI2ui = glad_debug_impl_glVertexAttribI2ui;
+static void APIENTRY glad_debug_impl_glVertexAttribI3ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+    _pre_call_callback("glVertexAttribI3ui", (void*)glad_glVertexAttribI3ui, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI3UIPROC, VertexAttribI3ui, glad_glVertexAttribI3ui)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribI3ui", (void*)glad_glVertexAttribI3ui, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBI3UIPROC glad_debug_glVertexAttribI3ui = glad_debug_impl_glVertexAttribI3ui;
+static void APIENTRY glad_debug_impl_glVertexAttribI4ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+    _pre_call_callback("glVertexAttribI4ui", (void*)glad_glVertexAttribI4ui, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4UIPROC, VertexAttribI4ui, glad_glVertexAttribI4ui)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttribI4ui", (void*)glad_glVertexAttribI4ui, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIBI4UIPROC glad_debug_glVertexAttribI4ui = glad_debug_impl_glVertexAttribI4ui;
+static void APIENTRY glad_debug_impl_glVertexAttribI1iv(GLuint arg0, const GLint * arg1) {
+    _pre_call_callback("glVertexAttribI1iv", (void*)glad_glVertexAttribI1iv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI1IVPROC, VertexAttribI1iv, glad_glVertexAttribI1iv)(arg0, arg1);
+    _post_call_callback("glVertexAttribI1iv", (void*)glad_glVertexAttribI1iv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI1IVPROC glad_debug_glVertexAttribI1iv = glad_debug_impl_glVertexAttribI1iv;
+static void APIENTRY glad_debug_impl_glVertexAttribI2iv(GLuint arg0, const GLint * arg1) {
+    _pre_call_callback("glVertexAttribI2iv", (void*)glad_glVertexAttribI2iv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI2IVPROC, VertexAttribI2iv, glad_glVertexAttribI2iv)(arg0, arg1);
+    _post_call_callback("glVertexAttribI2iv", (void*)glad_glVertexAttribI2iv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI2IVPROC glad_debug_glVertexAttribI2iv = glad_debug_impl_glVertexAttribI2iv;
+static void APIENTRY glad_debug_impl_glVertexAttribI3iv(GLuint arg0, const GLint * arg1) {
+    _pre_call_callback("glVertexAttribI3iv", (void*)glad_glVertexAttribI3iv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI3IVPROC, VertexAttribI3iv, glad_glVertexAttribI3iv)(arg0, arg1);
+    _post_call_callback("glVertexAttribI3iv", (void*)glad_glVertexAttribI3iv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI3IVPROC glad_debug_glVertexAttribI3iv = glad_debug_impl_glVertexAttribI3iv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4iv(GLuint arg0, const GLint * arg1) {
+    _pre_call_callback("glVertexAttribI4iv", (void*)glad_glVertexAttribI4iv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4IVPROC, VertexAttribI4iv, glad_glVertexAttribI4iv)(arg0, arg1);
+    _post_call_callback("glVertexAttribI4iv", (void*)glad_glVertexAttribI4iv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI4IVPROC glad_debug_glVertexAttribI4iv = glad_debug_impl_glVertexAttribI4iv;
+static void APIENTRY glad_debug_impl_glVertexAttribI1uiv(GLuint arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexAttribI1uiv", (void*)glad_glVertexAttribI1uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI1UIVPROC, VertexAttribI1uiv, glad_glVertexAttribI1uiv)(arg0, arg1);
+    _post_call_callback("glVertexAttribI1uiv", (void*)glad_glVertexAttribI1uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI1UIVPROC glad_debug_glVertexAttribI1uiv = glad_debug_impl_glVertexAttribI1uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI2uiv(GLuint arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexAttribI2uiv", (void*)glad_glVertexAttribI2uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI2UIVPROC, VertexAttribI2uiv, glad_glVertexAttribI2uiv)(arg0, arg1);
+    _post_call_callback("glVertexAttribI2uiv", (void*)glad_glVertexAttribI2uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI2UIVPROC glad_debug_glVertexAttribI2uiv = glad_debug_impl_glVertexAttribI2uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI3uiv(GLuint arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexAttribI3uiv", (void*)glad_glVertexAttribI3uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI3UIVPROC, VertexAttribI3uiv, glad_glVertexAttribI3uiv)(arg0, arg1);
+    _post_call_callback("glVertexAttribI3uiv", (void*)glad_glVertexAttribI3uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI3UIVPROC glad_debug_glVertexAttribI3uiv = glad_debug_impl_glVertexAttribI3uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4uiv(GLuint arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexAttribI4uiv", (void*)glad_glVertexAttribI4uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4UIVPROC, VertexAttribI4uiv, glad_glVertexAttribI4uiv)(arg0, arg1);
+    _post_call_callback("glVertexAttribI4uiv", (void*)glad_glVertexAttribI4uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI4UIVPROC glad_debug_glVertexAttribI4uiv = glad_debug_impl_glVertexAttribI4uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4bv(GLuint arg0, const GLbyte * arg1) {
+    _pre_call_callback("glVertexAttribI4bv", (void*)glad_glVertexAttribI4bv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4BVPROC, VertexAttribI4bv, glad_glVertexAttribI4bv)(arg0, arg1);
+    _post_call_callback("glVertexAttribI4bv", (void*)glad_glVertexAttribI4bv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI4BVPROC glad_debug_glVertexAttribI4bv = glad_debug_impl_glVertexAttribI4bv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4sv(GLuint arg0, const GLshort * arg1) {
+    _pre_call_callback("glVertexAttribI4sv", (void*)glad_glVertexAttribI4sv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4SVPROC, VertexAttribI4sv, glad_glVertexAttribI4sv)(arg0, arg1);
+    _post_call_callback("glVertexAttribI4sv", (void*)glad_glVertexAttribI4sv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI4SVPROC glad_debug_glVertexAttribI4sv = glad_debug_impl_glVertexAttribI4sv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4ubv(GLuint arg0, const GLubyte * arg1) {
+    _pre_call_callback("glVertexAttribI4ubv", (void*)glad_glVertexAttribI4ubv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4UBVPROC, VertexAttribI4ubv, glad_glVertexAttribI4ubv)(arg0, arg1);
+    _post_call_callback("glVertexAttribI4ubv", (void*)glad_glVertexAttribI4ubv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI4UBVPROC glad_debug_glVertexAttribI4ubv = glad_debug_impl_glVertexAttribI4ubv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4usv(GLuint arg0, const GLushort * arg1) {
+    _pre_call_callback("glVertexAttribI4usv", (void*)glad_glVertexAttribI4usv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4USVPROC, VertexAttribI4usv, glad_glVertexAttribI4usv)(arg0, arg1);
+    _post_call_callback("glVertexAttribI4usv", (void*)glad_glVertexAttribI4usv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI4USVPROC glad_debug_glVertexAttribI4usv = glad_debug_impl_glVertexAttribI4usv;
+static void APIENTRY glad_debug_impl_glGetUniformuiv(GLuint arg0, GLint arg1, GLuint * arg2) {
+    _pre_call_callback("glGetUniformuiv", (void*)glad_glGetUniformuiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETUNIFORMUIVPROC, GetUniformuiv, glad_glGetUniformuiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetUniformuiv", (void*)glad_glGetUniformuiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETUNIFORMUIVPROC glad_debug_glGetUniformuiv = glad_debug_impl_glGetUniformuiv;
+static void APIENTRY glad_debug_impl_glBindFragDataLocation(GLuint arg0, GLuint arg1, const GLchar * arg2) {
+    _pre_call_callback("glBindFragDataLocation", (void*)glad_glBindFragDataLocation, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLBINDFRAGDATALOCATIONPROC, BindFragDataLocation, glad_glBindFragDataLocation)(arg0, arg1, arg2);
+    _post_call_callback("glBindFragDataLocation", (void*)glad_glBindFragDataLocation, 3, arg0, arg1, arg2);
+}
+PFNGLBINDFRAGDATALOCATIONPROC glad_debug_glBindFragDataLocation = glad_debug_impl_glBindFragDataLocation;
+static GLint APIENTRY glad_debug_impl_glGetFragDataLocation(GLuint arg0, const GLchar * arg1) {
+    GLint ret;
+    _pre_call_callback("glGetFragDataLocation", (void*)glad_glGetFragDataLocation, 2, arg0, arg1);
+    ret = GLAD_GL_FUNCTION(PFNGLGETFRAGDATALOCATIONPROC, GetFragDataLocation, glad_glGetFragDataLocation)(arg0, arg1);
+    _post_call_callback("glGetFragDataLocation", (void*)glad_glGetFragDataLocation, 2, arg0, arg1);
+    return ret;
+}
+PFNGLGETFRAGDATALOCATIONPROC glad_debug_glGetFragDataLocation = glad_debug_impl_glGetFragDataLocation;
+static void APIENTRY glad_debug_impl_glUniform1ui(GLint arg0, GLuint arg1) {
+    _pre_call_callback("glUniform1ui", (void*)glad_glUniform1ui, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM1UIPROC, Uniform1ui, glad_glUniform1ui)(arg0, arg1);
+    _post_call_callback("glUniform1ui", (void*)glad_glUniform1ui, 2, arg0, arg1);
+}
+PFNGLUNIFORM1UIPROC glad_debug_glUniform1ui = glad_debug_impl_glUniform1ui;
+static void APIENTRY glad_debug_impl_glUniform2ui(GLint arg0, GLuint arg1, GLuint arg2) {
+    _pre_call_callback("glUniform2ui", (void*)glad_glUniform2ui, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM2UIPROC, Uniform2ui, glad_glUniform2ui)(arg0, arg1, arg2);
+    _post_call_callback("glUniform2ui", (void*)glad_glUniform2ui, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM2UIPROC glad_debug_glUniform2ui = glad_debug_impl_glUniform2ui;
+static void APIENTRY glad_debug_impl_glUniform3ui(GLint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+    _pre_call_callback("glUniform3ui", (void*)glad_glUniform3ui, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM3UIPROC, Uniform3ui, glad_glUniform3ui)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniform3ui", (void*)glad_glUniform3ui, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORM3UIPROC glad_debug_glUniform3ui = glad_debug_impl_glUniform3ui;
+static void APIENTRY glad_debug_impl_glUniform4ui(GLint arg0, GLuint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+    _pre_call_callback("glUniform4ui", (void*)glad_glUniform4ui, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM4UIPROC, Uniform4ui, glad_glUniform4ui)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glUniform4ui", (void*)glad_glUniform4ui, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLUNIFORM4UIPROC glad_debug_glUniform4ui = glad_debug_impl_glUniform4ui;
+static void APIENTRY glad_debug_impl_glUniform1uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+    _pre_call_callback("glUniform1uiv", (void*)glad_glUniform1uiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM1UIVPROC, Uniform1uiv, glad_glUniform1uiv)(arg0, arg1, arg2);
+    _post_call_callback("glUniform1uiv", (void*)glad_glUniform1uiv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM1UIVPROC glad_debug_glUniform1uiv = glad_debug_impl_glUniform1uiv;
+static void APIENTRY glad_debug_impl_glUniform2uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+    _pre_call_callback("glUniform2uiv", (void*)glad_glUniform2uiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM2UIVPROC, Uniform2uiv, glad_glUniform2uiv)(arg0, arg1, arg2);
+    _post_call_callback("glUniform2uiv", (void*)glad_glUniform2uiv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM2UIVPROC glad_debug_glUniform2uiv = glad_debug_impl_glUniform2uiv;
+static void APIENTRY glad_debug_impl_glUniform3uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+    _pre_call_callback("glUniform3uiv", (void*)glad_glUniform3uiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM3UIVPROC, Uniform3uiv, glad_glUniform3uiv)(arg0, arg1, arg2);
+    _post_call_callback("glUniform3uiv", (void*)glad_glUniform3uiv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM3UIVPROC glad_debug_glUniform3uiv = glad_debug_impl_glUniform3uiv;
+static void APIENTRY glad_debug_impl_glUniform4uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+    _pre_call_callback("glUniform4uiv", (void*)glad_glUniform4uiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORM4UIVPROC, Uniform4uiv, glad_glUniform4uiv)(arg0, arg1, arg2);
+    _post_call_callback("glUniform4uiv", (void*)glad_glUniform4uiv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM4UIVPROC glad_debug_glUniform4uiv = glad_debug_impl_glUniform4uiv;
+static void APIENTRY glad_debug_impl_glTexParameterIiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+    _pre_call_callback("glTexParameterIiv", (void*)glad_glTexParameterIiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLTEXPARAMETERIIVPROC, TexParameterIiv, glad_glTexParameterIiv)(arg0, arg1, arg2);
+    _post_call_callback("glTexParameterIiv", (void*)glad_glTexParameterIiv, 3, arg0, arg1, arg2);
+}
+PFNGLTEXPARAMETERIIVPROC glad_debug_glTexParameterIiv = glad_debug_impl_glTexParameterIiv;
+static void APIENTRY glad_debug_impl_glTexParameterIuiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+    _pre_call_callback("glTexParameterIuiv", (void*)glad_glTexParameterIuiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLTEXPARAMETERIUIVPROC, TexParameterIuiv, glad_glTexParameterIuiv)(arg0, arg1, arg2);
+    _post_call_callback("glTexParameterIuiv", (void*)glad_glTexParameterIuiv, 3, arg0, arg1, arg2);
+}
+PFNGLTEXPARAMETERIUIVPROC glad_debug_glTexParameterIuiv = glad_debug_impl_glTexParameterIuiv;
+static void APIENTRY glad_debug_impl_glGetTexParameterIiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetTexParameterIiv", (void*)glad_glGetTexParameterIiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETTEXPARAMETERIIVPROC, GetTexParameterIiv, glad_glGetTexParameterIiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetTexParameterIiv", (void*)glad_glGetTexParameterIiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETTEXPARAMETERIIVPROC glad_debug_glGetTexParameterIiv = glad_debug_impl_glGetTexParameterIiv;
+static void APIENTRY glad_debug_impl_glGetTexParameterIuiv(GLenum arg0, GLenum arg1, GLuint * arg2) {
+    _pre_call_callback("glGetTexParameterIuiv", (void*)glad_glGetTexParameterIuiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETTEXPARAMETERIUIVPROC, GetTexParameterIuiv, glad_glGetTexParameterIuiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetTexParameterIuiv", (void*)glad_glGetTexParameterIuiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETTEXPARAMETERIUIVPROC glad_debug_glGetTexParameterIuiv = glad_debug_impl_glGetTexParameterIuiv;
+static void APIENTRY glad_debug_impl_glClearBufferiv(GLenum arg0, GLint arg1, const GLint * arg2) {
+    _pre_call_callback("glClearBufferiv", (void*)glad_glClearBufferiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLCLEARBUFFERIVPROC, ClearBufferiv, glad_glClearBufferiv)(arg0, arg1, arg2);
+    _post_call_callback("glClearBufferiv", (void*)glad_glClearBufferiv, 3, arg0, arg1, arg2);
+}
+PFNGLCLEARBUFFERIVPROC glad_debug_glClearBufferiv = glad_debug_impl_glClearBufferiv;
+static void APIENTRY glad_debug_impl_glClearBufferuiv(GLenum arg0, GLint arg1, const GLuint * arg2) {
+    _pre_call_callback("glClearBufferuiv", (void*)glad_glClearBufferuiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLCLEARBUFFERUIVPROC, ClearBufferuiv, glad_glClearBufferuiv)(arg0, arg1, arg2);
+    _post_call_callback("glClearBufferuiv", (void*)glad_glClearBufferuiv, 3, arg0, arg1, arg2);
+}
+PFNGLCLEARBUFFERUIVPROC glad_debug_glClearBufferuiv = glad_debug_impl_glClearBufferuiv;
+static void APIENTRY glad_debug_impl_glClearBufferfv(GLenum arg0, GLint arg1, const GLfloat * arg2) {
+    _pre_call_callback("glClearBufferfv", (void*)glad_glClearBufferfv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLCLEARBUFFERFVPROC, ClearBufferfv, glad_glClearBufferfv)(arg0, arg1, arg2);
+    _post_call_callback("glClearBufferfv", (void*)glad_glClearBufferfv, 3, arg0, arg1, arg2);
+}
+PFNGLCLEARBUFFERFVPROC glad_debug_glClearBufferfv = glad_debug_impl_glClearBufferfv;
+static void APIENTRY glad_debug_impl_glClearBufferfi(GLenum arg0, GLint arg1, GLfloat arg2, GLint arg3) {
+    _pre_call_callback("glClearBufferfi", (void*)glad_glClearBufferfi, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLCLEARBUFFERFIPROC, ClearBufferfi, glad_glClearBufferfi)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glClearBufferfi", (void*)glad_glClearBufferfi, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCLEARBUFFERFIPROC glad_debug_glClearBufferfi = glad_debug_impl_glClearBufferfi;
+static const GLubyte * APIENTRY glad_debug_impl_glGetStringi(GLenum arg0, GLuint arg1) {
+    const GLubyte * ret;
+    _pre_call_callback("glGetStringi", (void*)glad_glGetStringi, 2, arg0, arg1);
+    ret = GLAD_GL_FUNCTION(PFNGLGETSTRINGIPROC, GetStringi, glad_glGetStringi)(arg0, arg1);
+    _post_call_callback("glGetStringi", (void*)glad_glGetStringi, 2, arg0, arg1);
+    return ret;
+}
+PFNGLGETSTRINGIPROC glad_debug_glGetStringi = glad_debug_impl_glGetStringi;
+static GLboolean APIENTRY glad_debug_impl_glIsRenderbuffer(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsRenderbuffer", (void*)glad_glIsRenderbuffer, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLISRENDERBUFFERPROC, IsRenderbuffer, glad_glIsRenderbuffer)(arg0);
+    _post_call_callback("glIsRenderbuffer", (void*)glad_glIsRenderbuffer, 1, arg0);
+    return ret;
+}
+PFNGLISRENDERBUFFERPROC glad_debug_glIsRenderbuffer = glad_debug_impl_glIsRenderbuffer;
+static void APIENTRY glad_debug_impl_glBindRenderbuffer(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glBindRenderbuffer", (void*)glad_glBindRenderbuffer, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLBINDRENDERBUFFERPROC, BindRenderbuffer, glad_glBindRenderbuffer)(arg0, arg1);
+    _post_call_callback("glBindRenderbuffer", (void*)glad_glBindRenderbuffer, 2, arg0, arg1);
+}
+PFNGLBINDRENDERBUFFERPROC glad_debug_glBindRenderbuffer = glad_debug_impl_glBindRenderbuffer;
+static void APIENTRY glad_debug_impl_glDeleteRenderbuffers(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteRenderbuffers", (void*)glad_glDeleteRenderbuffers, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLDELETERENDERBUFFERSPROC, DeleteRenderbuffers, glad_glDeleteRenderbuffers)(arg0, arg1);
+    _post_call_callback("glDeleteRenderbuffers", (void*)glad_glDeleteRenderbuffers, 2, arg0, arg1);
+}
+PFNGLDELETERENDERBUFFERSPROC glad_debug_glDeleteRenderbuffers = glad_debug_impl_glDeleteRenderbuffers;
+static void APIENTRY glad_debug_impl_glGenRenderbuffers(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenRenderbuffers", (void*)glad_glGenRenderbuffers, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLGENRENDERBUFFERSPROC, GenRenderbuffers, glad_glGenRenderbuffers)(arg0, arg1);
+    _post_call_callback("glGenRenderbuffers", (void*)glad_glGenRenderbuffers, 2, arg0, arg1);
+}
+PFNGLGENRENDERBUFFERSPROC glad_debug_glGenRenderbuffers = glad_debug_impl_glGenRenderbuffers;
+static void APIENTRY glad_debug_impl_glRenderbufferStorage(GLenum arg0, GLenum arg1, GLsizei arg2, GLsizei arg3) {
+    _pre_call_callback("glRenderbufferStorage", (void*)glad_glRenderbufferStorage, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLRENDERBUFFERSTORAGEPROC, RenderbufferStorage, glad_glRenderbufferStorage)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glRenderbufferStorage", (void*)glad_glRenderbufferStorage, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLRENDERBUFFERSTORAGEPROC glad_debug_glRenderbufferStorage = glad_debug_impl_glRenderbufferStorage;
+static void APIENTRY glad_debug_impl_glGetRenderbufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetRenderbufferParameteriv", (void*)glad_glGetRenderbufferParameteriv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETRENDERBUFFERPARAMETERIVPROC, GetRenderbufferParameteriv, glad_glGetRenderbufferParameteriv)(arg0, arg1, arg2);
+    _post_call_callback("glGetRenderbufferParameteriv", (void*)glad_glGetRenderbufferParameteriv, 3, arg0, arg1, arg2);
+}
+PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_debug_glGetRenderbufferParameteriv = glad_debug_impl_glGetRenderbufferParameteriv;
+static GLboolean APIENTRY glad_debug_impl_glIsFramebuffer(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsFramebuffer", (void*)glad_glIsFramebuffer, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLISFRAMEBUFFERPROC, IsFramebuffer, glad_glIsFramebuffer)(arg0);
+    _post_call_callback("glIsFramebuffer", (void*)glad_glIsFramebuffer, 1, arg0);
+    return ret;
+}
+PFNGLISFRAMEBUFFERPROC glad_debug_glIsFramebuffer = glad_debug_impl_glIsFramebuffer;
+static void APIENTRY glad_debug_impl_glBindFramebuffer(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glBindFramebuffer", (void*)glad_glBindFramebuffer, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLBINDFRAMEBUFFERPROC, BindFramebuffer, glad_glBindFramebuffer)(arg0, arg1);
+    _post_call_callback("glBindFramebuffer", (void*)glad_glBindFramebuffer, 2, arg0, arg1);
+}
+PFNGLBINDFRAMEBUFFERPROC glad_debug_glBindFramebuffer = glad_debug_impl_glBindFramebuffer;
+static void APIENTRY glad_debug_impl_glDeleteFramebuffers(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteFramebuffers", (void*)glad_glDeleteFramebuffers, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLDELETEFRAMEBUFFERSPROC, DeleteFramebuffers, glad_glDeleteFramebuffers)(arg0, arg1);
+    _post_call_callback("glDeleteFramebuffers", (void*)glad_glDeleteFramebuffers, 2, arg0, arg1);
+}
+PFNGLDELETEFRAMEBUFFERSPROC glad_debug_glDeleteFramebuffers = glad_debug_impl_glDeleteFramebuffers;
+static void APIENTRY glad_debug_impl_glGenFramebuffers(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenFramebuffers", (void*)glad_glGenFramebuffers, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLGENFRAMEBUFFERSPROC, GenFramebuffers, glad_glGenFramebuffers)(arg0, arg1);
+    _post_call_callback("glGenFramebuffers", (void*)glad_glGenFramebuffers, 2, arg0, arg1);
+}
+PFNGLGENFRAMEBUFFERSPROC glad_debug_glGenFramebuffers = glad_debug_impl_glGenFramebuffers;
+static GLenum APIENTRY glad_debug_impl_glCheckFramebufferStatus(GLenum arg0) {
+    GLenum ret;
+    _pre_call_callback("glCheckFramebufferStatus", (void*)glad_glCheckFramebufferStatus, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLCHECKFRAMEBUFFERSTATUSPROC, CheckFramebufferStatus, glad_glCheckFramebufferStatus)(arg0);
+    _post_call_callback("glCheckFramebufferStatus", (void*)glad_glCheckFramebufferStatus, 1, arg0);
+    return ret;
+}
+PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_debug_glCheckFramebufferStatus = glad_debug_impl_glCheckFramebufferStatus;
+static void APIENTRY glad_debug_impl_glFramebufferTexture1D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4) {
+    _pre_call_callback("glFramebufferTexture1D", (void*)glad_glFramebufferTexture1D, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLFRAMEBUFFERTEXTURE1DPROC, FramebufferTexture1D, glad_glFramebufferTexture1D)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glFramebufferTexture1D", (void*)glad_glFramebufferTexture1D, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLFRAMEBUFFERTEXTURE1DPROC glad_debug_glFramebufferTexture1D = glad_debug_impl_glFramebufferTexture1D;
+static void APIENTRY glad_debug_impl_glFramebufferTexture2D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4) {
+    _pre_call_callback("glFramebufferTexture2D", (void*)glad_glFramebufferTexture2D, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLFRAMEBUFFERTEXTURE2DPROC, FramebufferTexture2D, glad_glFramebufferTexture2D)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glFramebufferTexture2D", (void*)glad_glFramebufferTexture2D, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLFRAMEBUFFERTEXTURE2DPROC glad_debug_glFramebufferTexture2D = glad_debug_impl_glFramebufferTexture2D;
+static void APIENTRY glad_debug_impl_glFramebufferTexture3D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4, GLint arg5) {
+    _pre_call_callback("glFramebufferTexture3D", (void*)glad_glFramebufferTexture3D, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    GLAD_GL_FUNCTION(PFNGLFRAMEBUFFERTEXTURE3DPROC, FramebufferTexture3D, glad_glFramebufferTexture3D)(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glFramebufferTexture3D", (void*)glad_glFramebufferTexture3D, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLFRAMEBUFFERTEXTURE3DPROC glad_debug_glFramebufferTexture3D = glad_debug_impl_glFramebufferTexture3D;
+static void APIENTRY glad_debug_impl_glFramebufferRenderbuffer(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3) {
+    _pre_call_callback("glFramebufferRenderbuffer", (void*)glad_glFramebufferRenderbuffer, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLFRAMEBUFFERRENDERBUFFERPROC, FramebufferRenderbuffer, glad_glFramebufferRenderbuffer)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glFramebufferRenderbuffer", (void*)glad_glFramebufferRenderbuffer, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_debug_glFramebufferRenderbuffer = glad_debug_impl_glFramebufferRenderbuffer;
+static void APIENTRY glad_debug_impl_glGetFramebufferAttachmentParameteriv(GLenum arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+    _pre_call_callback("glGetFramebufferAttachmentParameteriv", (void*)glad_glGetFramebufferAttachmentParameteriv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, GetFramebufferAttachmentParameteriv, glad_glGetFramebufferAttachmentParameteriv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetFramebufferAttachmentParameteriv", (void*)glad_glGetFramebufferAttachmentParameteriv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_debug_glGetFramebufferAttachmentParameteriv = glad_debug_impl_glGetFramebufferAttachmentParameteriv;
+static void APIENTRY glad_debug_impl_glGenerateMipmap(GLenum arg0) {
+    _pre_call_callback("glGenerateMipmap", (void*)glad_glGenerateMipmap, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLGENERATEMIPMAPPROC, GenerateMipmap, glad_glGenerateMipmap)(arg0);
+    _post_call_callback("glGenerateMipmap", (void*)glad_glGenerateMipmap, 1, arg0);
+}
+PFNGLGENERATEMIPMAPPROC glad_debug_glGenerateMipmap = glad_debug_impl_glGenerateMipmap;
+static void APIENTRY glad_debug_impl_glBlitFramebuffer(GLint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLint arg7, GLbitfield arg8, GLenum arg9) {
+    _pre_call_callback("glBlitFramebuffer", (void*)glad_glBlitFramebuffer, 10, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+    GLAD_GL_FUNCTION(PFNGLBLITFRAMEBUFFERPROC, BlitFramebuffer, glad_glBlitFramebuffer)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+    _post_call_callback("glBlitFramebuffer", (void*)glad_glBlitFramebuffer, 10, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+PFNGLBLITFRAMEBUFFERPROC glad_debug_glBlitFramebuffer = glad_debug_impl_glBlitFramebuffer;
+static void APIENTRY glad_debug_impl_glRenderbufferStorageMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+    _pre_call_callback("glRenderbufferStorageMultisample", (void*)glad_glRenderbufferStorageMultisample, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, RenderbufferStorageMultisample, glad_glRenderbufferStorageMultisample)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glRenderbufferStorageMultisample", (void*)glad_glRenderbufferStorageMultisample, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_debug_glRenderbufferStorageMultisample = glad_debug_impl_glRenderbufferStorageMultisample;
+static void APIENTRY glad_debug_impl_glFramebufferTextureLayer(GLenum arg0, GLenum arg1, GLuint arg2, GLint arg3, GLint arg4) {
+    _pre_call_callback("glFramebufferTextureLayer", (void*)glad_glFramebufferTextureLayer, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLFRAMEBUFFERTEXTURELAYERPROC, FramebufferTextureLayer, glad_glFramebufferTextureLayer)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glFramebufferTextureLayer", (void*)glad_glFramebufferTextureLayer, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_debug_glFramebufferTextureLayer = glad_debug_impl_glFramebufferTextureLayer;
+static void * APIENTRY glad_debug_impl_glMapBufferRange(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, GLbitfield arg3) {
+    void * ret;
+    _pre_call_callback("glMapBufferRange", (void*)glad_glMapBufferRange, 4, arg0, arg1, arg2, arg3);
+    ret = GLAD_GL_FUNCTION(PFNGLMAPBUFFERRANGEPROC, MapBufferRange, glad_glMapBufferRange)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glMapBufferRange", (void*)glad_glMapBufferRange, 4, arg0, arg1, arg2, arg3);
+    return ret;
+}
+PFNGLMAPBUFFERRANGEPROC glad_debug_glMapBufferRange = glad_debug_impl_glMapBufferRange;
+static void APIENTRY glad_debug_impl_glFlushMappedBufferRange(GLenum arg0, GLintptr arg1, GLsizeiptr arg2) {
+    _pre_call_callback("glFlushMappedBufferRange", (void*)glad_glFlushMappedBufferRange, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLFLUSHMAPPEDBUFFERRANGEPROC, FlushMappedBufferRange, glad_glFlushMappedBufferRange)(arg0, arg1, arg2);
+    _post_call_callback("glFlushMappedBufferRange", (void*)glad_glFlushMappedBufferRange, 3, arg0, arg1, arg2);
+}
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_debug_glFlushMappedBufferRange = glad_debug_impl_glFlushMappedBufferRange;
+static void APIENTRY glad_debug_impl_glBindVertexArray(GLuint arg0) {
+    _pre_call_callback("glBindVertexArray", (void*)glad_glBindVertexArray, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLBINDVERTEXARRAYPROC, BindVertexArray, glad_glBindVertexArray)(arg0);
+    _post_call_callback("glBindVertexArray", (void*)glad_glBindVertexArray, 1, arg0);
+}
+PFNGLBINDVERTEXARRAYPROC glad_debug_glBindVertexArray = glad_debug_impl_glBindVertexArray;
+static void APIENTRY glad_debug_impl_glDeleteVertexArrays(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteVertexArrays", (void*)glad_glDeleteVertexArrays, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLDELETEVERTEXARRAYSPROC, DeleteVertexArrays, glad_glDeleteVertexArrays)(arg0, arg1);
+    _post_call_callback("glDeleteVertexArrays", (void*)glad_glDeleteVertexArrays, 2, arg0, arg1);
+}
+PFNGLDELETEVERTEXARRAYSPROC glad_debug_glDeleteVertexArrays = glad_debug_impl_glDeleteVertexArrays;
+static void APIENTRY glad_debug_impl_glGenVertexArrays(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenVertexArrays", (void*)glad_glGenVertexArrays, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLGENVERTEXARRAYSPROC, GenVertexArrays, glad_glGenVertexArrays)(arg0, arg1);
+    _post_call_callback("glGenVertexArrays", (void*)glad_glGenVertexArrays, 2, arg0, arg1);
+}
+PFNGLGENVERTEXARRAYSPROC glad_debug_glGenVertexArrays = glad_debug_impl_glGenVertexArrays;
+static GLboolean APIENTRY glad_debug_impl_glIsVertexArray(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsVertexArray", (void*)glad_glIsVertexArray, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLISVERTEXARRAYPROC, IsVertexArray, glad_glIsVertexArray)(arg0);
+    _post_call_callback("glIsVertexArray", (void*)glad_glIsVertexArray, 1, arg0);
+    return ret;
+}
+PFNGLISVERTEXARRAYPROC glad_debug_glIsVertexArray = glad_debug_impl_glIsVertexArray;
+static void APIENTRY glad_debug_impl_glDrawArraysInstanced(GLenum arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+    _pre_call_callback("glDrawArraysInstanced", (void*)glad_glDrawArraysInstanced, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLDRAWARRAYSINSTANCEDPROC, DrawArraysInstanced, glad_glDrawArraysInstanced)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glDrawArraysInstanced", (void*)glad_glDrawArraysInstanced, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLDRAWARRAYSINSTANCEDPROC glad_debug_glDrawArraysInstanced = glad_debug_impl_glDrawArraysInstanced;
+static void APIENTRY glad_debug_impl_glDrawElementsInstanced(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4) {
+    _pre_call_callback("glDrawElementsInstanced", (void*)glad_glDrawElementsInstanced, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLDRAWELEMENTSINSTANCEDPROC, DrawElementsInstanced, glad_glDrawElementsInstanced)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glDrawElementsInstanced", (void*)glad_glDrawElementsInstanced, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLDRAWELEMENTSINSTANCEDPROC glad_debug_glDrawElementsInstanced = glad_debug_impl_glDrawElementsInstanced;
+static void APIENTRY glad_debug_impl_glTexBuffer(GLenum arg0, GLenum arg1, GLuint arg2) {
+    _pre_call_callback("glTexBuffer", (void*)glad_glTexBuffer, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLTEXBUFFERPROC, TexBuffer, glad_glTexBuffer)(arg0, arg1, arg2);
+    _post_call_callback("glTexBuffer", (void*)glad_glTexBuffer, 3, arg0, arg1, arg2);
+}
+PFNGLTEXBUFFERPROC glad_debug_glTexBuffer = glad_debug_impl_glTexBuffer;
+static void APIENTRY glad_debug_impl_glPrimitiveRestartIndex(GLuint arg0) {
+    _pre_call_callback("glPrimitiveRestartIndex", (void*)glad_glPrimitiveRestartIndex, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLPRIMITIVERESTARTINDEXPROC, PrimitiveRestartIndex, glad_glPrimitiveRestartIndex)(arg0);
+    _post_call_callback("glPrimitiveRestartIndex", (void*)glad_glPrimitiveRestartIndex, 1, arg0);
+}
+PFNGLPRIMITIVERESTARTINDEXPROC glad_debug_glPrimitiveRestartIndex = glad_debug_impl_glPrimitiveRestartIndex;
+static void APIENTRY glad_debug_impl_glCopyBufferSubData(GLenum arg0, GLenum arg1, GLintptr arg2, GLintptr arg3, GLsizeiptr arg4) {
+    _pre_call_callback("glCopyBufferSubData", (void*)glad_glCopyBufferSubData, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLCOPYBUFFERSUBDATAPROC, CopyBufferSubData, glad_glCopyBufferSubData)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glCopyBufferSubData", (void*)glad_glCopyBufferSubData, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLCOPYBUFFERSUBDATAPROC glad_debug_glCopyBufferSubData = glad_debug_impl_glCopyBufferSubData;
+static void APIENTRY glad_debug_impl_glGetUniformIndices(GLuint arg0, GLsizei arg1, const GLchar *const* arg2, GLuint * arg3) {
+    _pre_call_callback("glGetUniformIndices", (void*)glad_glGetUniformIndices, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLGETUNIFORMINDICESPROC, GetUniformIndices, glad_glGetUniformIndices)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetUniformIndices", (void*)glad_glGetUniformIndices, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETUNIFORMINDICESPROC glad_debug_glGetUniformIndices = glad_debug_impl_glGetUniformIndices;
+static void APIENTRY glad_debug_impl_glGetActiveUniformsiv(GLuint arg0, GLsizei arg1, const GLuint * arg2, GLenum arg3, GLint * arg4) {
+    _pre_call_callback("glGetActiveUniformsiv", (void*)glad_glGetActiveUniformsiv, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLGETACTIVEUNIFORMSIVPROC, GetActiveUniformsiv, glad_glGetActiveUniformsiv)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glGetActiveUniformsiv", (void*)glad_glGetActiveUniformsiv, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLGETACTIVEUNIFORMSIVPROC glad_debug_glGetActiveUniformsiv = glad_debug_impl_glGetActiveUniformsiv;
+static void APIENTRY glad_debug_impl_glGetActiveUniformName(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+    _pre_call_callback("glGetActiveUniformName", (void*)glad_glGetActiveUniformName, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLGETACTIVEUNIFORMNAMEPROC, GetActiveUniformName, glad_glGetActiveUniformName)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glGetActiveUniformName", (void*)glad_glGetActiveUniformName, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLGETACTIVEUNIFORMNAMEPROC glad_debug_glGetActiveUniformName = glad_debug_impl_glGetActiveUniformName;
+static GLuint APIENTRY glad_debug_impl_glGetUniformBlockIndex(GLuint arg0, const GLchar * arg1) {
+    GLuint ret;
+    _pre_call_callback("glGetUniformBlockIndex", (void*)glad_glGetUniformBlockIndex, 2, arg0, arg1);
+    ret = GLAD_GL_FUNCTION(PFNGLGETUNIFORMBLOCKINDEXPROC, GetUniformBlockIndex, glad_glGetUniformBlockIndex)(arg0, arg1);
+    _post_call_callback("glGetUniformBlockIndex", (void*)glad_glGetUniformBlockIndex, 2, arg0, arg1);
+    return ret;
+}
+PFNGLGETUNIFORMBLOCKINDEXPROC glad_debug_glGetUniformBlockIndex = glad_debug_impl_glGetUniformBlockIndex;
+static void APIENTRY glad_debug_impl_glGetActiveUniformBlockiv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+    _pre_call_callback("glGetActiveUniformBlockiv", (void*)glad_glGetActiveUniformBlockiv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLGETACTIVEUNIFORMBLOCKIVPROC, GetActiveUniformBlockiv, glad_glGetActiveUniformBlockiv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetActiveUniformBlockiv", (void*)glad_glGetActiveUniformBlockiv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_debug_glGetActiveUniformBlockiv = glad_debug_impl_glGetActiveUniformBlockiv;
+static void APIENTRY glad_debug_impl_glGetActiveUniformBlockName(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+    _pre_call_callback("glGetActiveUniformBlockName", (void*)glad_glGetActiveUniformBlockName, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, GetActiveUniformBlockName, glad_glGetActiveUniformBlockName)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glGetActiveUniformBlockName", (void*)glad_glGetActiveUniformBlockName, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_debug_glGetActiveUniformBlockName = glad_debug_impl_glGetActiveUniformBlockName;
+static void APIENTRY glad_debug_impl_glUniformBlockBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+    _pre_call_callback("glUniformBlockBinding", (void*)glad_glUniformBlockBinding, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLUNIFORMBLOCKBINDINGPROC, UniformBlockBinding, glad_glUniformBlockBinding)(arg0, arg1, arg2);
+    _post_call_callback("glUniformBlockBinding", (void*)glad_glUniformBlockBinding, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORMBLOCKBINDINGPROC glad_debug_glUniformBlockBinding = glad_debug_impl_glUniformBlockBinding;
+static void APIENTRY glad_debug_impl_glDrawElementsBaseVertex(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLint arg4) {
+    _pre_call_callback("glDrawElementsBaseVertex", (void*)glad_glDrawElementsBaseVertex, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLDRAWELEMENTSBASEVERTEXPROC, DrawElementsBaseVertex, glad_glDrawElementsBaseVertex)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glDrawElementsBaseVertex", (void*)glad_glDrawElementsBaseVertex, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLDRAWELEMENTSBASEVERTEXPROC glad_debug_glDrawElementsBaseVertex = glad_debug_impl_glDrawElementsBaseVertex;
+static void APIENTRY glad_debug_impl_glDrawRangeElementsBaseVertex(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3, GLenum arg4, const void * arg5, GLint arg6) {
+    _pre_call_callback("glDrawRangeElementsBaseVertex", (void*)glad_glDrawRangeElementsBaseVertex, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    GLAD_GL_FUNCTION(PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, DrawRangeElementsBaseVertex, glad_glDrawRangeElementsBaseVertex)(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glDrawRangeElementsBaseVertex", (void*)glad_glDrawRangeElementsBaseVertex, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_debug_glDrawRangeElementsBaseVertex = glad_debug_impl_glDrawRangeElementsBaseVertex;
+static void APIENTRY glad_debug_impl_glDrawElementsInstancedBaseVertex(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLint arg5) {
+    _pre_call_callback("glDrawElementsInstancedBaseVertex", (void*)glad_glDrawElementsInstancedBaseVertex, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    GLAD_GL_FUNCTION(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, DrawElementsInstancedBaseVertex, glad_glDrawElementsInstancedBaseVertex)(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glDrawElementsInstancedBaseVertex", (void*)glad_glDrawElementsInstancedBaseVertex, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_debug_glDrawElementsInstancedBaseVertex = glad_debug_impl_glDrawElementsInstancedBaseVertex;
+static void APIENTRY glad_debug_impl_glMultiDrawElementsBaseVertex(GLenum arg0, const GLsizei * arg1, GLenum arg2, const void *const* arg3, GLsizei arg4, const GLint * arg5) {
+    _pre_call_callback("glMultiDrawElementsBaseVertex", (void*)glad_glMultiDrawElementsBaseVertex, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    GLAD_GL_FUNCTION(PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, MultiDrawElementsBaseVertex, glad_glMultiDrawElementsBaseVertex)(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glMultiDrawElementsBaseVertex", (void*)glad_glMultiDrawElementsBaseVertex, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_debug_glMultiDrawElementsBaseVertex = glad_debug_impl_glMultiDrawElementsBaseVertex;
+static void APIENTRY glad_debug_impl_glProvokingVertex(GLenum arg0) {
+    _pre_call_callback("glProvokingVertex", (void*)glad_glProvokingVertex, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLPROVOKINGVERTEXPROC, ProvokingVertex, glad_glProvokingVertex)(arg0);
+    _post_call_callback("glProvokingVertex", (void*)glad_glProvokingVertex, 1, arg0);
+}
+PFNGLPROVOKINGVERTEXPROC glad_debug_glProvokingVertex = glad_debug_impl_glProvokingVertex;
+static GLsync APIENTRY glad_debug_impl_glFenceSync(GLenum arg0, GLbitfield arg1) {
+    GLsync ret;
+    _pre_call_callback("glFenceSync", (void*)glad_glFenceSync, 2, arg0, arg1);
+    ret = GLAD_GL_FUNCTION(PFNGLFENCESYNCPROC, FenceSync, glad_glFenceSync)(arg0, arg1);
+    _post_call_callback("glFenceSync", (void*)glad_glFenceSync, 2, arg0, arg1);
+    return ret;
+}
+PFNGLFENCESYNCPROC glad_debug_glFenceSync = glad_debug_impl_glFenceSync;
+static GLboolean APIENTRY glad_debug_impl_glIsSync(GLsync arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsSync", (void*)glad_glIsSync, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLISSYNCPROC, IsSync, glad_glIsSync)(arg0);
+    _post_call_callback("glIsSync", (void*)glad_glIsSync, 1, arg0);
+    return ret;
+}
+PFNGLISSYNCPROC glad_debug_glIsSync = glad_debug_impl_glIsSync;
+static void APIENTRY glad_debug_impl_glDeleteSync(GLsync arg0) {
+    _pre_call_callback("glDeleteSync", (void*)glad_glDeleteSync, 1, arg0);
+    GLAD_GL_FUNCTION(PFNGLDELETESYNCPROC, DeleteSync, glad_glDeleteSync)(arg0);
+    _post_call_callback("glDeleteSync", (void*)glad_glDeleteSync, 1, arg0);
+}
+PFNGLDELETESYNCPROC glad_debug_glDeleteSync = glad_debug_impl_glDeleteSync;
+static GLenum APIENTRY glad_debug_impl_glClientWaitSync(GLsync arg0, GLbitfield arg1, GLuint64 arg2) {
+    GLenum ret;
+    _pre_call_callback("glClientWaitSync", (void*)glad_glClientWaitSync, 3, arg0, arg1, arg2);
+    ret = GLAD_GL_FUNCTION(PFNGLCLIENTWAITSYNCPROC, ClientWaitSync, glad_glClientWaitSync)(arg0, arg1, arg2);
+    _post_call_callback("glClientWaitSync", (void*)glad_glClientWaitSync, 3, arg0, arg1, arg2);
+    return ret;
+}
+PFNGLCLIENTWAITSYNCPROC glad_debug_glClientWaitSync = glad_debug_impl_glClientWaitSync;
+static void APIENTRY glad_debug_impl_glWaitSync(GLsync arg0, GLbitfield arg1, GLuint64 arg2) {
+    _pre_call_callback("glWaitSync", (void*)glad_glWaitSync, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLWAITSYNCPROC, WaitSync, glad_glWaitSync)(arg0, arg1, arg2);
+    _post_call_callback("glWaitSync", (void*)glad_glWaitSync, 3, arg0, arg1, arg2);
+}
+PFNGLWAITSYNCPROC glad_debug_glWaitSync = glad_debug_impl_glWaitSync;
+static void APIENTRY glad_debug_impl_glGetInteger64v(GLenum arg0, GLint64 * arg1) {
+    _pre_call_callback("glGetInteger64v", (void*)glad_glGetInteger64v, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLGETINTEGER64VPROC, GetInteger64v, glad_glGetInteger64v)(arg0, arg1);
+    _post_call_callback("glGetInteger64v", (void*)glad_glGetInteger64v, 2, arg0, arg1);
+}
+PFNGLGETINTEGER64VPROC glad_debug_glGetInteger64v = glad_debug_impl_glGetInteger64v;
+static void APIENTRY glad_debug_impl_glGetSynciv(GLsync arg0, GLenum arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4) {
+    _pre_call_callback("glGetSynciv", (void*)glad_glGetSynciv, 5, arg0, arg1, arg2, arg3, arg4);
+    GLAD_GL_FUNCTION(PFNGLGETSYNCIVPROC, GetSynciv, glad_glGetSynciv)(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glGetSynciv", (void*)glad_glGetSynciv, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLGETSYNCIVPROC glad_debug_glGetSynciv = glad_debug_impl_glGetSynciv;
+static void APIENTRY glad_debug_impl_glGetInteger64i_v(GLenum arg0, GLuint arg1, GLint64 * arg2) {
+    _pre_call_callback("glGetInteger64i_v", (void*)glad_glGetInteger64i_v, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETINTEGER64I_VPROC, GetInteger64i_v, glad_glGetInteger64i_v)(arg0, arg1, arg2);
+    _post_call_callback("glGetInteger64i_v", (void*)glad_glGetInteger64i_v, 3, arg0, arg1, arg2);
+}
+PFNGLGETINTEGER64I_VPROC glad_debug_glGetInteger64i_v = glad_debug_impl_glGetInteger64i_v;
+static void APIENTRY glad_debug_impl_glGetBufferParameteri64v(GLenum arg0, GLenum arg1, GLint64 * arg2) {
+    _pre_call_callback("glGetBufferParameteri64v", (void*)glad_glGetBufferParameteri64v, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETBUFFERPARAMETERI64VPROC, GetBufferParameteri64v, glad_glGetBufferParameteri64v)(arg0, arg1, arg2);
+    _post_call_callback("glGetBufferParameteri64v", (void*)glad_glGetBufferParameteri64v, 3, arg0, arg1, arg2);
+}
+PFNGLGETBUFFERPARAMETERI64VPROC glad_debug_glGetBufferParameteri64v = glad_debug_impl_glGetBufferParameteri64v;
+static void APIENTRY glad_debug_impl_glFramebufferTexture(GLenum arg0, GLenum arg1, GLuint arg2, GLint arg3) {
+    _pre_call_callback("glFramebufferTexture", (void*)glad_glFramebufferTexture, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLFRAMEBUFFERTEXTUREPROC, FramebufferTexture, glad_glFramebufferTexture)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glFramebufferTexture", (void*)glad_glFramebufferTexture, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLFRAMEBUFFERTEXTUREPROC glad_debug_glFramebufferTexture = glad_debug_impl_glFramebufferTexture;
+static void APIENTRY glad_debug_impl_glTexImage2DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+    _pre_call_callback("glTexImage2DMultisample", (void*)glad_glTexImage2DMultisample, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    GLAD_GL_FUNCTION(PFNGLTEXIMAGE2DMULTISAMPLEPROC, TexImage2DMultisample, glad_glTexImage2DMultisample)(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glTexImage2DMultisample", (void*)glad_glTexImage2DMultisample, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_debug_glTexImage2DMultisample = glad_debug_impl_glTexImage2DMultisample;
+static void APIENTRY glad_debug_impl_glTexImage3DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+    _pre_call_callback("glTexImage3DMultisample", (void*)glad_glTexImage3DMultisample, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    GLAD_GL_FUNCTION(PFNGLTEXIMAGE3DMULTISAMPLEPROC, TexImage3DMultisample, glad_glTexImage3DMultisample)(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glTexImage3DMultisample", (void*)glad_glTexImage3DMultisample, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_debug_glTexImage3DMultisample = glad_debug_impl_glTexImage3DMultisample;
+static void APIENTRY glad_debug_impl_glGetMultisamplefv(GLenum arg0, GLuint arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetMultisamplefv", (void*)glad_glGetMultisamplefv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETMULTISAMPLEFVPROC, GetMultisamplefv, glad_glGetMultisamplefv)(arg0, arg1, arg2);
+    _post_call_callback("glGetMultisamplefv", (void*)glad_glGetMultisamplefv, 3, arg0, arg1, arg2);
+}
+PFNGLGETMULTISAMPLEFVPROC glad_debug_glGetMultisamplefv = glad_debug_impl_glGetMultisamplefv;
+static void APIENTRY glad_debug_impl_glSampleMaski(GLuint arg0, GLbitfield arg1) {
+    _pre_call_callback("glSampleMaski", (void*)glad_glSampleMaski, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLSAMPLEMASKIPROC, SampleMaski, glad_glSampleMaski)(arg0, arg1);
+    _post_call_callback("glSampleMaski", (void*)glad_glSampleMaski, 2, arg0, arg1);
+}
+PFNGLSAMPLEMASKIPROC glad_debug_glSampleMaski = glad_debug_impl_glSampleMaski;
+static void APIENTRY glad_debug_impl_glBindFragDataLocationIndexed(GLuint arg0, GLuint arg1, GLuint arg2, const GLchar * arg3) {
+    _pre_call_callback("glBindFragDataLocationIndexed", (void*)glad_glBindFragDataLocationIndexed, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, BindFragDataLocationIndexed, glad_glBindFragDataLocationIndexed)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glBindFragDataLocationIndexed", (void*)glad_glBindFragDataLocationIndexed, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_debug_glBindFragDataLocationIndexed = glad_debug_impl_glBindFragDataLocationIndexed;
+static GLint APIENTRY glad_debug_impl_glGetFragDataIndex(GLuint arg0, const GLchar * arg1) {
+    GLint ret;
+    _pre_call_callback("glGetFragDataIndex", (void*)glad_glGetFragDataIndex, 2, arg0, arg1);
+    ret = GLAD_GL_FUNCTION(PFNGLGETFRAGDATAINDEXPROC, GetFragDataIndex, glad_glGetFragDataIndex)(arg0, arg1);
+    _post_call_callback("glGetFragDataIndex", (void*)glad_glGetFragDataIndex, 2, arg0, arg1);
+    return ret;
+}
+PFNGLGETFRAGDATAINDEXPROC glad_debug_glGetFragDataIndex = glad_debug_impl_glGetFragDataIndex;
+static void APIENTRY glad_debug_impl_glGenSamplers(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenSamplers", (void*)glad_glGenSamplers, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLGENSAMPLERSPROC, GenSamplers, glad_glGenSamplers)(arg0, arg1);
+    _post_call_callback("glGenSamplers", (void*)glad_glGenSamplers, 2, arg0, arg1);
+}
+PFNGLGENSAMPLERSPROC glad_debug_glGenSamplers = glad_debug_impl_glGenSamplers;
+static void APIENTRY glad_debug_impl_glDeleteSamplers(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteSamplers", (void*)glad_glDeleteSamplers, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLDELETESAMPLERSPROC, DeleteSamplers, glad_glDeleteSamplers)(arg0, arg1);
+    _post_call_callback("glDeleteSamplers", (void*)glad_glDeleteSamplers, 2, arg0, arg1);
+}
+PFNGLDELETESAMPLERSPROC glad_debug_glDeleteSamplers = glad_debug_impl_glDeleteSamplers;
+static GLboolean APIENTRY glad_debug_impl_glIsSampler(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsSampler", (void*)glad_glIsSampler, 1, arg0);
+    ret = GLAD_GL_FUNCTION(PFNGLISSAMPLERPROC, IsSampler, glad_glIsSampler)(arg0);
+    _post_call_callback("glIsSampler", (void*)glad_glIsSampler, 1, arg0);
+    return ret;
+}
+PFNGLISSAMPLERPROC glad_debug_glIsSampler = glad_debug_impl_glIsSampler;
+static void APIENTRY glad_debug_impl_glBindSampler(GLuint arg0, GLuint arg1) {
+    _pre_call_callback("glBindSampler", (void*)glad_glBindSampler, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLBINDSAMPLERPROC, BindSampler, glad_glBindSampler)(arg0, arg1);
+    _post_call_callback("glBindSampler", (void*)glad_glBindSampler, 2, arg0, arg1);
+}
+PFNGLBINDSAMPLERPROC glad_debug_glBindSampler = glad_debug_impl_glBindSampler;
+static void APIENTRY glad_debug_impl_glSamplerParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+    _pre_call_callback("glSamplerParameteri", (void*)glad_glSamplerParameteri, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLSAMPLERPARAMETERIPROC, SamplerParameteri, glad_glSamplerParameteri)(arg0, arg1, arg2);
+    _post_call_callback("glSamplerParameteri", (void*)glad_glSamplerParameteri, 3, arg0, arg1, arg2);
+}
+PFNGLSAMPLERPARAMETERIPROC glad_debug_glSamplerParameteri = glad_debug_impl_glSamplerParameteri;
+static void APIENTRY glad_debug_impl_glSamplerParameteriv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+    _pre_call_callback("glSamplerParameteriv", (void*)glad_glSamplerParameteriv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLSAMPLERPARAMETERIVPROC, SamplerParameteriv, glad_glSamplerParameteriv)(arg0, arg1, arg2);
+    _post_call_callback("glSamplerParameteriv", (void*)glad_glSamplerParameteriv, 3, arg0, arg1, arg2);
+}
+PFNGLSAMPLERPARAMETERIVPROC glad_debug_glSamplerParameteriv = glad_debug_impl_glSamplerParameteriv;
+static void APIENTRY glad_debug_impl_glSamplerParameterf(GLuint arg0, GLenum arg1, GLfloat arg2) {
+    _pre_call_callback("glSamplerParameterf", (void*)glad_glSamplerParameterf, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLSAMPLERPARAMETERFPROC, SamplerParameterf, glad_glSamplerParameterf)(arg0, arg1, arg2);
+    _post_call_callback("glSamplerParameterf", (void*)glad_glSamplerParameterf, 3, arg0, arg1, arg2);
+}
+PFNGLSAMPLERPARAMETERFPROC glad_debug_glSamplerParameterf = glad_debug_impl_glSamplerParameterf;
+static void APIENTRY glad_debug_impl_glSamplerParameterfv(GLuint arg0, GLenum arg1, const GLfloat * arg2) {
+    _pre_call_callback("glSamplerParameterfv", (void*)glad_glSamplerParameterfv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLSAMPLERPARAMETERFVPROC, SamplerParameterfv, glad_glSamplerParameterfv)(arg0, arg1, arg2);
+    _post_call_callback("glSamplerParameterfv", (void*)glad_glSamplerParameterfv, 3, arg0, arg1, arg2);
+}
+PFNGLSAMPLERPARAMETERFVPROC glad_debug_glSamplerParameterfv = glad_debug_impl_glSamplerParameterfv;
+static void APIENTRY glad_debug_impl_glSamplerParameterIiv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+    _pre_call_callback("glSamplerParameterIiv", (void*)glad_glSamplerParameterIiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLSAMPLERPARAMETERIIVPROC, SamplerParameterIiv, glad_glSamplerParameterIiv)(arg0, arg1, arg2);
+    _post_call_callback("glSamplerParameterIiv", (void*)glad_glSamplerParameterIiv, 3, arg0, arg1, arg2);
+}
+PFNGLSAMPLERPARAMETERIIVPROC glad_debug_glSamplerParameterIiv = glad_debug_impl_glSamplerParameterIiv;
+static void APIENTRY glad_debug_impl_glSamplerParameterIuiv(GLuint arg0, GLenum arg1, const GLuint * arg2) {
+    _pre_call_callback("glSamplerParameterIuiv", (void*)glad_glSamplerParameterIuiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLSAMPLERPARAMETERIUIVPROC, SamplerParameterIuiv, glad_glSamplerParameterIuiv)(arg0, arg1, arg2);
+    _post_call_callback("glSamplerParameterIuiv", (void*)glad_glSamplerParameterIuiv, 3, arg0, arg1, arg2);
+}
+PFNGLSAMPLERPARAMETERIUIVPROC glad_debug_glSamplerParameterIuiv = glad_debug_impl_glSamplerParameterIuiv;
+static void APIENTRY glad_debug_impl_glGetSamplerParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetSamplerParameteriv", (void*)glad_glGetSamplerParameteriv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETSAMPLERPARAMETERIVPROC, GetSamplerParameteriv, glad_glGetSamplerParameteriv)(arg0, arg1, arg2);
+    _post_call_callback("glGetSamplerParameteriv", (void*)glad_glGetSamplerParameteriv, 3, arg0, arg1, arg2);
+}
+PFNGLGETSAMPLERPARAMETERIVPROC glad_debug_glGetSamplerParameteriv = glad_debug_impl_glGetSamplerParameteriv;
+static void APIENTRY glad_debug_impl_glGetSamplerParameterIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetSamplerParameterIiv", (void*)glad_glGetSamplerParameterIiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETSAMPLERPARAMETERIIVPROC, GetSamplerParameterIiv, glad_glGetSamplerParameterIiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetSamplerParameterIiv", (void*)glad_glGetSamplerParameterIiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETSAMPLERPARAMETERIIVPROC glad_debug_glGetSamplerParameterIiv = glad_debug_impl_glGetSamplerParameterIiv;
+static void APIENTRY glad_debug_impl_glGetSamplerParameterfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetSamplerParameterfv", (void*)glad_glGetSamplerParameterfv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETSAMPLERPARAMETERFVPROC, GetSamplerParameterfv, glad_glGetSamplerParameterfv)(arg0, arg1, arg2);
+    _post_call_callback("glGetSamplerParameterfv", (void*)glad_glGetSamplerParameterfv, 3, arg0, arg1, arg2);
+}
+PFNGLGETSAMPLERPARAMETERFVPROC glad_debug_glGetSamplerParameterfv = glad_debug_impl_glGetSamplerParameterfv;
+static void APIENTRY glad_debug_impl_glGetSamplerParameterIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+    _pre_call_callback("glGetSamplerParameterIuiv", (void*)glad_glGetSamplerParameterIuiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETSAMPLERPARAMETERIUIVPROC, GetSamplerParameterIuiv, glad_glGetSamplerParameterIuiv)(arg0, arg1, arg2);
+    _post_call_callback("glGetSamplerParameterIuiv", (void*)glad_glGetSamplerParameterIuiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETSAMPLERPARAMETERIUIVPROC glad_debug_glGetSamplerParameterIuiv = glad_debug_impl_glGetSamplerParameterIuiv;
+static void APIENTRY glad_debug_impl_glQueryCounter(GLuint arg0, GLenum arg1) {
+    _pre_call_callback("glQueryCounter", (void*)glad_glQueryCounter, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLQUERYCOUNTERPROC, QueryCounter, glad_glQueryCounter)(arg0, arg1);
+    _post_call_callback("glQueryCounter", (void*)glad_glQueryCounter, 2, arg0, arg1);
+}
+PFNGLQUERYCOUNTERPROC glad_debug_glQueryCounter = glad_debug_impl_glQueryCounter;
+static void APIENTRY glad_debug_impl_glGetQueryObjecti64v(GLuint arg0, GLenum arg1, GLint64 * arg2) {
+    _pre_call_callback("glGetQueryObjecti64v", (void*)glad_glGetQueryObjecti64v, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETQUERYOBJECTI64VPROC, GetQueryObjecti64v, glad_glGetQueryObjecti64v)(arg0, arg1, arg2);
+    _post_call_callback("glGetQueryObjecti64v", (void*)glad_glGetQueryObjecti64v, 3, arg0, arg1, arg2);
+}
+PFNGLGETQUERYOBJECTI64VPROC glad_debug_glGetQueryObjecti64v = glad_debug_impl_glGetQueryObjecti64v;
+static void APIENTRY glad_debug_impl_glGetQueryObjectui64v(GLuint arg0, GLenum arg1, GLuint64 * arg2) {
+    _pre_call_callback("glGetQueryObjectui64v", (void*)glad_glGetQueryObjectui64v, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLGETQUERYOBJECTUI64VPROC, GetQueryObjectui64v, glad_glGetQueryObjectui64v)(arg0, arg1, arg2);
+    _post_call_callback("glGetQueryObjectui64v", (void*)glad_glGetQueryObjectui64v, 3, arg0, arg1, arg2);
+}
+PFNGLGETQUERYOBJECTUI64VPROC glad_debug_glGetQueryObjectui64v = glad_debug_impl_glGetQueryObjectui64v;
+static void APIENTRY glad_debug_impl_glVertexAttribDivisor(GLuint arg0, GLuint arg1) {
+    _pre_call_callback("glVertexAttribDivisor", (void*)glad_glVertexAttribDivisor, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBDIVISORPROC, VertexAttribDivisor, glad_glVertexAttribDivisor)(arg0, arg1);
+    _post_call_callback("glVertexAttribDivisor", (void*)glad_glVertexAttribDivisor, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBDIVISORPROC glad_debug_glVertexAttribDivisor = glad_debug_impl_glVertexAttribDivisor;
+static void APIENTRY glad_debug_impl_glVertexAttribP1ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+    _pre_call_callback("glVertexAttribP1ui", (void*)glad_glVertexAttribP1ui, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP1UIPROC, VertexAttribP1ui, glad_glVertexAttribP1ui)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP1ui", (void*)glad_glVertexAttribP1ui, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP1UIPROC glad_debug_glVertexAttribP1ui = glad_debug_impl_glVertexAttribP1ui;
+static void APIENTRY glad_debug_impl_glVertexAttribP1uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+    _pre_call_callback("glVertexAttribP1uiv", (void*)glad_glVertexAttribP1uiv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP1UIVPROC, VertexAttribP1uiv, glad_glVertexAttribP1uiv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP1uiv", (void*)glad_glVertexAttribP1uiv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP1UIVPROC glad_debug_glVertexAttribP1uiv = glad_debug_impl_glVertexAttribP1uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribP2ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+    _pre_call_callback("glVertexAttribP2ui", (void*)glad_glVertexAttribP2ui, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP2UIPROC, VertexAttribP2ui, glad_glVertexAttribP2ui)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP2ui", (void*)glad_glVertexAttribP2ui, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP2UIPROC glad_debug_glVertexAttribP2ui = glad_debug_impl_glVertexAttribP2ui;
+static void APIENTRY glad_debug_impl_glVertexAttribP2uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+    _pre_call_callback("glVertexAttribP2uiv", (void*)glad_glVertexAttribP2uiv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP2UIVPROC, VertexAttribP2uiv, glad_glVertexAttribP2uiv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP2uiv", (void*)glad_glVertexAttribP2uiv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP2UIVPROC glad_debug_glVertexAttribP2uiv = glad_debug_impl_glVertexAttribP2uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribP3ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+    _pre_call_callback("glVertexAttribP3ui", (void*)glad_glVertexAttribP3ui, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP3UIPROC, VertexAttribP3ui, glad_glVertexAttribP3ui)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP3ui", (void*)glad_glVertexAttribP3ui, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP3UIPROC glad_debug_glVertexAttribP3ui = glad_debug_impl_glVertexAttribP3ui;
+static void APIENTRY glad_debug_impl_glVertexAttribP3uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+    _pre_call_callback("glVertexAttribP3uiv", (void*)glad_glVertexAttribP3uiv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP3UIVPROC, VertexAttribP3uiv, glad_glVertexAttribP3uiv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP3uiv", (void*)glad_glVertexAttribP3uiv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP3UIVPROC glad_debug_glVertexAttribP3uiv = glad_debug_impl_glVertexAttribP3uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribP4ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+    _pre_call_callback("glVertexAttribP4ui", (void*)glad_glVertexAttribP4ui, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP4UIPROC, VertexAttribP4ui, glad_glVertexAttribP4ui)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP4ui", (void*)glad_glVertexAttribP4ui, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP4UIPROC glad_debug_glVertexAttribP4ui = glad_debug_impl_glVertexAttribP4ui;
+static void APIENTRY glad_debug_impl_glVertexAttribP4uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+    _pre_call_callback("glVertexAttribP4uiv", (void*)glad_glVertexAttribP4uiv, 4, arg0, arg1, arg2, arg3);
+    GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP4UIVPROC, VertexAttribP4uiv, glad_glVertexAttribP4uiv)(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP4uiv", (void*)glad_glVertexAttribP4uiv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP4UIVPROC glad_debug_glVertexAttribP4uiv = glad_debug_impl_glVertexAttribP4uiv;
+static void APIENTRY glad_debug_impl_glVertexP2ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glVertexP2ui", (void*)glad_glVertexP2ui, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXP2UIPROC, VertexP2ui, glad_glVertexP2ui)(arg0, arg1);
+    _post_call_callback("glVertexP2ui", (void*)glad_glVertexP2ui, 2, arg0, arg1);
+}
+PFNGLVERTEXP2UIPROC glad_debug_glVertexP2ui = glad_debug_impl_glVertexP2ui;
+static void APIENTRY glad_debug_impl_glVertexP2uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexP2uiv", (void*)glad_glVertexP2uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXP2UIVPROC, VertexP2uiv, glad_glVertexP2uiv)(arg0, arg1);
+    _post_call_callback("glVertexP2uiv", (void*)glad_glVertexP2uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXP2UIVPROC glad_debug_glVertexP2uiv = glad_debug_impl_glVertexP2uiv;
+static void APIENTRY glad_debug_impl_glVertexP3ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glVertexP3ui", (void*)glad_glVertexP3ui, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXP3UIPROC, VertexP3ui, glad_glVertexP3ui)(arg0, arg1);
+    _post_call_callback("glVertexP3ui", (void*)glad_glVertexP3ui, 2, arg0, arg1);
+}
+PFNGLVERTEXP3UIPROC glad_debug_glVertexP3ui = glad_debug_impl_glVertexP3ui;
+static void APIENTRY glad_debug_impl_glVertexP3uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexP3uiv", (void*)glad_glVertexP3uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXP3UIVPROC, VertexP3uiv, glad_glVertexP3uiv)(arg0, arg1);
+    _post_call_callback("glVertexP3uiv", (void*)glad_glVertexP3uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXP3UIVPROC glad_debug_glVertexP3uiv = glad_debug_impl_glVertexP3uiv;
+static void APIENTRY glad_debug_impl_glVertexP4ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glVertexP4ui", (void*)glad_glVertexP4ui, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXP4UIPROC, VertexP4ui, glad_glVertexP4ui)(arg0, arg1);
+    _post_call_callback("glVertexP4ui", (void*)glad_glVertexP4ui, 2, arg0, arg1);
+}
+PFNGLVERTEXP4UIPROC glad_debug_glVertexP4ui = glad_debug_impl_glVertexP4ui;
+static void APIENTRY glad_debug_impl_glVertexP4uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexP4uiv", (void*)glad_glVertexP4uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLVERTEXP4UIVPROC, VertexP4uiv, glad_glVertexP4uiv)(arg0, arg1);
+    _post_call_callback("glVertexP4uiv", (void*)glad_glVertexP4uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXP4UIVPROC glad_debug_glVertexP4uiv = glad_debug_impl_glVertexP4uiv;
+static void APIENTRY glad_debug_impl_glTexCoordP1ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glTexCoordP1ui", (void*)glad_glTexCoordP1ui, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLTEXCOORDP1UIPROC, TexCoordP1ui, glad_glTexCoordP1ui)(arg0, arg1);
+    _post_call_callback("glTexCoordP1ui", (void*)glad_glTexCoordP1ui, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP1UIPROC glad_debug_glTexCoordP1ui = glad_debug_impl_glTexCoordP1ui;
+static void APIENTRY glad_debug_impl_glTexCoordP1uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glTexCoordP1uiv", (void*)glad_glTexCoordP1uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLTEXCOORDP1UIVPROC, TexCoordP1uiv, glad_glTexCoordP1uiv)(arg0, arg1);
+    _post_call_callback("glTexCoordP1uiv", (void*)glad_glTexCoordP1uiv, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP1UIVPROC glad_debug_glTexCoordP1uiv = glad_debug_impl_glTexCoordP1uiv;
+static void APIENTRY glad_debug_impl_glTexCoordP2ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glTexCoordP2ui", (void*)glad_glTexCoordP2ui, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLTEXCOORDP2UIPROC, TexCoordP2ui, glad_glTexCoordP2ui)(arg0, arg1);
+    _post_call_callback("glTexCoordP2ui", (void*)glad_glTexCoordP2ui, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP2UIPROC glad_debug_glTexCoordP2ui = glad_debug_impl_glTexCoordP2ui;
+static void APIENTRY glad_debug_impl_glTexCoordP2uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glTexCoordP2uiv", (void*)glad_glTexCoordP2uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLTEXCOORDP2UIVPROC, TexCoordP2uiv, glad_glTexCoordP2uiv)(arg0, arg1);
+    _post_call_callback("glTexCoordP2uiv", (void*)glad_glTexCoordP2uiv, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP2UIVPROC glad_debug_glTexCoordP2uiv = glad_debug_impl_glTexCoordP2uiv;
+static void APIENTRY glad_debug_impl_glTexCoordP3ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glTexCoordP3ui", (void*)glad_glTexCoordP3ui, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLTEXCOORDP3UIPROC, TexCoordP3ui, glad_glTexCoordP3ui)(arg0, arg1);
+    _post_call_callback("glTexCoordP3ui", (void*)glad_glTexCoordP3ui, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP3UIPROC glad_debug_glTexCoordP3ui = glad_debug_impl_glTexCoordP3ui;
+static void APIENTRY glad_debug_impl_glTexCoordP3uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glTexCoordP3uiv", (void*)glad_glTexCoordP3uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLTEXCOORDP3UIVPROC, TexCoordP3uiv, glad_glTexCoordP3uiv)(arg0, arg1);
+    _post_call_callback("glTexCoordP3uiv", (void*)glad_glTexCoordP3uiv, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP3UIVPROC glad_debug_glTexCoordP3uiv = glad_debug_impl_glTexCoordP3uiv;
+static void APIENTRY glad_debug_impl_glTexCoordP4ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glTexCoordP4ui", (void*)glad_glTexCoordP4ui, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLTEXCOORDP4UIPROC, TexCoordP4ui, glad_glTexCoordP4ui)(arg0, arg1);
+    _post_call_callback("glTexCoordP4ui", (void*)glad_glTexCoordP4ui, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP4UIPROC glad_debug_glTexCoordP4ui = glad_debug_impl_glTexCoordP4ui;
+static void APIENTRY glad_debug_impl_glTexCoordP4uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glTexCoordP4uiv", (void*)glad_glTexCoordP4uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLTEXCOORDP4UIVPROC, TexCoordP4uiv, glad_glTexCoordP4uiv)(arg0, arg1);
+    _post_call_callback("glTexCoordP4uiv", (void*)glad_glTexCoordP4uiv, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP4UIVPROC glad_debug_glTexCoordP4uiv = glad_debug_impl_glTexCoordP4uiv;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP1ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+    _pre_call_callback("glMultiTexCoordP1ui", (void*)glad_glMultiTexCoordP1ui, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP1UIPROC, MultiTexCoordP1ui, glad_glMultiTexCoordP1ui)(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP1ui", (void*)glad_glMultiTexCoordP1ui, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP1UIPROC glad_debug_glMultiTexCoordP1ui = glad_debug_impl_glMultiTexCoordP1ui;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP1uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+    _pre_call_callback("glMultiTexCoordP1uiv", (void*)glad_glMultiTexCoordP1uiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP1UIVPROC, MultiTexCoordP1uiv, glad_glMultiTexCoordP1uiv)(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP1uiv", (void*)glad_glMultiTexCoordP1uiv, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP1UIVPROC glad_debug_glMultiTexCoordP1uiv = glad_debug_impl_glMultiTexCoordP1uiv;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP2ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+    _pre_call_callback("glMultiTexCoordP2ui", (void*)glad_glMultiTexCoordP2ui, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP2UIPROC, MultiTexCoordP2ui, glad_glMultiTexCoordP2ui)(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP2ui", (void*)glad_glMultiTexCoordP2ui, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP2UIPROC glad_debug_glMultiTexCoordP2ui = glad_debug_impl_glMultiTexCoordP2ui;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP2uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+    _pre_call_callback("glMultiTexCoordP2uiv", (void*)glad_glMultiTexCoordP2uiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP2UIVPROC, MultiTexCoordP2uiv, glad_glMultiTexCoordP2uiv)(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP2uiv", (void*)glad_glMultiTexCoordP2uiv, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP2UIVPROC glad_debug_glMultiTexCoordP2uiv = glad_debug_impl_glMultiTexCoordP2uiv;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP3ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+    _pre_call_callback("glMultiTexCoordP3ui", (void*)glad_glMultiTexCoordP3ui, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP3UIPROC, MultiTexCoordP3ui, glad_glMultiTexCoordP3ui)(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP3ui", (void*)glad_glMultiTexCoordP3ui, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP3UIPROC glad_debug_glMultiTexCoordP3ui = glad_debug_impl_glMultiTexCoordP3ui;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP3uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+    _pre_call_callback("glMultiTexCoordP3uiv", (void*)glad_glMultiTexCoordP3uiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP3UIVPROC, MultiTexCoordP3uiv, glad_glMultiTexCoordP3uiv)(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP3uiv", (void*)glad_glMultiTexCoordP3uiv, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP3UIVPROC glad_debug_glMultiTexCoordP3uiv = glad_debug_impl_glMultiTexCoordP3uiv;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP4ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+    _pre_call_callback("glMultiTexCoordP4ui", (void*)glad_glMultiTexCoordP4ui, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP4UIPROC, MultiTexCoordP4ui, glad_glMultiTexCoordP4ui)(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP4ui", (void*)glad_glMultiTexCoordP4ui, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP4UIPROC glad_debug_glMultiTexCoordP4ui = glad_debug_impl_glMultiTexCoordP4ui;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP4uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+    _pre_call_callback("glMultiTexCoordP4uiv", (void*)glad_glMultiTexCoordP4uiv, 3, arg0, arg1, arg2);
+    GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP4UIVPROC, MultiTexCoordP4uiv, glad_glMultiTexCoordP4uiv)(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP4uiv", (void*)glad_glMultiTexCoordP4uiv, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP4UIVPROC glad_debug_glMultiTexCoordP4uiv = glad_debug_impl_glMultiTexCoordP4uiv;
+static void APIENTRY glad_debug_impl_glNormalP3ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glNormalP3ui", (void*)glad_glNormalP3ui, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLNORMALP3UIPROC, NormalP3ui, glad_glNormalP3ui)(arg0, arg1);
+    _post_call_callback("glNormalP3ui", (void*)glad_glNormalP3ui, 2, arg0, arg1);
+}
+PFNGLNORMALP3UIPROC glad_debug_glNormalP3ui = glad_debug_impl_glNormalP3ui;
+static void APIENTRY glad_debug_impl_glNormalP3uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glNormalP3uiv", (void*)glad_glNormalP3uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLNORMALP3UIVPROC, NormalP3uiv, glad_glNormalP3uiv)(arg0, arg1);
+    _post_call_callback("glNormalP3uiv", (void*)glad_glNormalP3uiv, 2, arg0, arg1);
+}
+PFNGLNORMALP3UIVPROC glad_debug_glNormalP3uiv = glad_debug_impl_glNormalP3uiv;
+static void APIENTRY glad_debug_impl_glColorP3ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glColorP3ui", (void*)glad_glColorP3ui, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLCOLORP3UIPROC, ColorP3ui, glad_glColorP3ui)(arg0, arg1);
+    _post_call_callback("glColorP3ui", (void*)glad_glColorP3ui, 2, arg0, arg1);
+}
+PFNGLCOLORP3UIPROC glad_debug_glColorP3ui = glad_debug_impl_glColorP3ui;
+static void APIENTRY glad_debug_impl_glColorP3uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glColorP3uiv", (void*)glad_glColorP3uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLCOLORP3UIVPROC, ColorP3uiv, glad_glColorP3uiv)(arg0, arg1);
+    _post_call_callback("glColorP3uiv", (void*)glad_glColorP3uiv, 2, arg0, arg1);
+}
+PFNGLCOLORP3UIVPROC glad_debug_glColorP3uiv = glad_debug_impl_glColorP3uiv;
+static void APIENTRY glad_debug_impl_glColorP4ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glColorP4ui", (void*)glad_glColorP4ui, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLCOLORP4UIPROC, ColorP4ui, glad_glColorP4ui)(arg0, arg1);
+    _post_call_callback("glColorP4ui", (void*)glad_glColorP4ui, 2, arg0, arg1);
+}
+PFNGLCOLORP4UIPROC glad_debug_glColorP4ui = glad_debug_impl_glColorP4ui;
+static void APIENTRY glad_debug_impl_glColorP4uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glColorP4uiv", (void*)glad_glColorP4uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLCOLORP4UIVPROC, ColorP4uiv, glad_glColorP4uiv)(arg0, arg1);
+    _post_call_callback("glColorP4uiv", (void*)glad_glColorP4uiv, 2, arg0, arg1);
+}
+PFNGLCOLORP4UIVPROC glad_debug_glColorP4uiv = glad_debug_impl_glColorP4uiv;
+static void APIENTRY glad_debug_impl_glSecondaryColorP3ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glSecondaryColorP3ui", (void*)glad_glSecondaryColorP3ui, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLSECONDARYCOLORP3UIPROC, SecondaryColorP3ui, glad_glSecondaryColorP3ui)(arg0, arg1);
+    _post_call_callback("glSecondaryColorP3ui", (void*)glad_glSecondaryColorP3ui, 2, arg0, arg1);
+}
+PFNGLSECONDARYCOLORP3UIPROC glad_debug_glSecondaryColorP3ui = glad_debug_impl_glSecondaryColorP3ui;
+static void APIENTRY glad_debug_impl_glSecondaryColorP3uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glSecondaryColorP3uiv", (void*)glad_glSecondaryColorP3uiv, 2, arg0, arg1);
+    GLAD_GL_FUNCTION(PFNGLSECONDARYCOLORP3UIVPROC, SecondaryColorP3uiv, glad_glSecondaryColorP3uiv)(arg0, arg1);
+    _post_call_callback("glSecondaryColorP3uiv", (void*)glad_glSecondaryColorP3uiv, 2, arg0, arg1);
+}
+PFNGLSECONDARYCOLORP3UIVPROC glad_debug_glSecondaryColorP3uiv = glad_debug_impl_glSecondaryColorP3uiv;
+#endif
+/* End of debug mode */
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1117,9 +3439,9 @@ static void find_coreGL(void) {
 
 int gladLoadGLLoader(GLADloadproc load) {
 	GLVersion.major = 0; GLVersion.minor = 0;
-	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
-	if(glGetString == NULL) return 0;
-	if(glGetString(GL_VERSION) == NULL) return 0;
+	glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glad_glGetString == NULL) return 0;
+	if(glad_glGetString(GL_VERSION) == NULL) return 0;
 	find_coreGL();
 	load_GL_VERSION_1_0(load);
 	load_GL_VERSION_1_1(load);
@@ -1138,3 +3460,828 @@ int gladLoadGLLoader(GLADloadproc load) {
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+/* Per-context function tables: generated by tools/gen_glad_context.py */
+#if defined(_MSC_VER)
+#define GLAD_THREAD_LOCAL __declspec(thread)
+#else
+#define GLAD_THREAD_LOCAL __thread
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define GLAD_GL_SET_MULTIPLE_TABLES() _InterlockedExchange((volatile long *)&glad_gl_multiple_tables, 1)
+#else
+#define GLAD_GL_SET_MULTIPLE_TABLES() __atomic_store_n(&glad_gl_multiple_tables, 1, __ATOMIC_RELAXED)
+#endif
+int glad_gl_multiple_tables = 0; /* Only ever goes from 0 to 1, atomically: gl* calls on other threads read it */
+static GLAD_THREAD_LOCAL const GladGLContext *glad_gl_current_table = NULL;
+
+static int glad_gl_table_matches_globals(const GladGLContext *context) {
+    return context->CullFace == glad_glCullFace
+        && context->FrontFace == glad_glFrontFace
+        && context->Hint == glad_glHint
+        && context->LineWidth == glad_glLineWidth
+        && context->PointSize == glad_glPointSize
+        && context->PolygonMode == glad_glPolygonMode
+        && context->Scissor == glad_glScissor
+        && context->TexParameterf == glad_glTexParameterf
+        && context->TexParameterfv == glad_glTexParameterfv
+        && context->TexParameteri == glad_glTexParameteri
+        && context->TexParameteriv == glad_glTexParameteriv
+        && context->TexImage1D == glad_glTexImage1D
+        && context->TexImage2D == glad_glTexImage2D
+        && context->DrawBuffer == glad_glDrawBuffer
+        && context->Clear == glad_glClear
+        && context->ClearColor == glad_glClearColor
+        && context->ClearStencil == glad_glClearStencil
+        && context->ClearDepth == glad_glClearDepth
+        && context->StencilMask == glad_glStencilMask
+        && context->ColorMask == glad_glColorMask
+        && context->DepthMask == glad_glDepthMask
+        && context->Disable == glad_glDisable
+        && context->Enable == glad_glEnable
+        && context->Finish == glad_glFinish
+        && context->Flush == glad_glFlush
+        && context->BlendFunc == glad_glBlendFunc
+        && context->LogicOp == glad_glLogicOp
+        && context->StencilFunc == glad_glStencilFunc
+        && context->StencilOp == glad_glStencilOp
+        && context->DepthFunc == glad_glDepthFunc
+        && context->PixelStoref == glad_glPixelStoref
+        && context->PixelStorei == glad_glPixelStorei
+        && context->ReadBuffer == glad_glReadBuffer
+        && context->ReadPixels == glad_glReadPixels
+        && context->GetBooleanv == glad_glGetBooleanv
+        && context->GetDoublev == glad_glGetDoublev
+        && context->GetError == glad_glGetError
+        && context->GetFloatv == glad_glGetFloatv
+        && context->GetIntegerv == glad_glGetIntegerv
+        && context->GetString == glad_glGetString
+        && context->GetTexImage == glad_glGetTexImage
+        && context->GetTexParameterfv == glad_glGetTexParameterfv
+        && context->GetTexParameteriv == glad_glGetTexParameteriv
+        && context->GetTexLevelParameterfv == glad_glGetTexLevelParameterfv
+        && context->GetTexLevelParameteriv == glad_glGetTexLevelParameteriv
+        && context->IsEnabled == glad_glIsEnabled
+        && context->DepthRange == glad_glDepthRange
+        && context->Viewport == glad_glViewport
+        && context->DrawArrays == glad_glDrawArrays
+        && context->DrawElements == glad_glDrawElements
+        && context->PolygonOffset == glad_glPolygonOffset
+        && context->CopyTexImage1D == glad_glCopyTexImage1D
+        && context->CopyTexImage2D == glad_glCopyTexImage2D
+        && context->CopyTexSubImage1D == glad_glCopyTexSubImage1D
+        && context->CopyTexSubImage2D == glad_glCopyTexSubImage2D
+        && context->TexSubImage1D == glad_glTexSubImage1D
+        && context->TexSubImage2D == glad_glTexSubImage2D
+        && context->BindTexture == glad_glBindTexture
+        && context->DeleteTextures == glad_glDeleteTextures
+        && context->GenTextures == glad_glGenTextures
+        && context->IsTexture == glad_glIsTexture
+        && context->DrawRangeElements == glad_glDrawRangeElements
+        && context->TexImage3D == glad_glTexImage3D
+        && context->TexSubImage3D == glad_glTexSubImage3D
+        && context->CopyTexSubImage3D == glad_glCopyTexSubImage3D
+        && context->ActiveTexture == glad_glActiveTexture
+        && context->SampleCoverage == glad_glSampleCoverage
+        && context->CompressedTexImage3D == glad_glCompressedTexImage3D
+        && context->CompressedTexImage2D == glad_glCompressedTexImage2D
+        && context->CompressedTexImage1D == glad_glCompressedTexImage1D
+        && context->CompressedTexSubImage3D == glad_glCompressedTexSubImage3D
+        && context->CompressedTexSubImage2D == glad_glCompressedTexSubImage2D
+        && context->CompressedTexSubImage1D == glad_glCompressedTexSubImage1D
+        && context->GetCompressedTexImage == glad_glGetCompressedTexImage
+        && context->BlendFuncSeparate == glad_glBlendFuncSeparate
+        && context->MultiDrawArrays == glad_glMultiDrawArrays
+        && context->MultiDrawElements == glad_glMultiDrawElements
+        && context->PointParameterf == glad_glPointParameterf
+        && context->PointParameterfv == glad_glPointParameterfv
+        && context->PointParameteri == glad_glPointParameteri
+        && context->PointParameteriv == glad_glPointParameteriv
+        && context->BlendColor == glad_glBlendColor
+        && context->BlendEquation == glad_glBlendEquation
+        && context->GenQueries == glad_glGenQueries
+        && context->DeleteQueries == glad_glDeleteQueries
+        && context->IsQuery == glad_glIsQuery
+        && context->BeginQuery == glad_glBeginQuery
+        && context->EndQuery == glad_glEndQuery
+        && context->GetQueryiv == glad_glGetQueryiv
+        && context->GetQueryObjectiv == glad_glGetQueryObjectiv
+        && context->GetQueryObjectuiv == glad_glGetQueryObjectuiv
+        && context->BindBuffer == glad_glBindBuffer
+        && context->DeleteBuffers == glad_glDeleteBuffers
+        && context->GenBuffers == glad_glGenBuffers
+        && context->IsBuffer == glad_glIsBuffer
+        && context->BufferData == glad_glBufferData
+        && context->BufferSubData == glad_glBufferSubData
+        && context->GetBufferSubData == glad_glGetBufferSubData
+        && context->MapBuffer == glad_glMapBuffer
+        && context->UnmapBuffer == glad_glUnmapBuffer
+        && context->GetBufferParameteriv == glad_glGetBufferParameteriv
+        && context->GetBufferPointerv == glad_glGetBufferPointerv
+        && context->BlendEquationSeparate == glad_glBlendEquationSeparate
+        && context->DrawBuffers == glad_glDrawBuffers
+        && context->StencilOpSeparate == glad_glStencilOpSeparate
+        && context->StencilFuncSeparate == glad_glStencilFuncSeparate
+        && context->StencilMaskSeparate == glad_glStencilMaskSeparate
+        && context->AttachShader == glad_glAttachShader
+        && context->BindAttribLocation == glad_glBindAttribLocation
+        && context->CompileShader == glad_glCompileShader
+        && context->CreateProgram == glad_glCreateProgram
+        && context->CreateShader == glad_glCreateShader
+        && context->DeleteProgram == glad_glDeleteProgram
+        && context->DeleteShader == glad_glDeleteShader
+        && context->DetachShader == glad_glDetachShader
+        && context->DisableVertexAttribArray == glad_glDisableVertexAttribArray
+        && context->EnableVertexAttribArray == glad_glEnableVertexAttribArray
+        && context->GetActiveAttrib == glad_glGetActiveAttrib
+        && context->GetActiveUniform == glad_glGetActiveUniform
+        && context->GetAttachedShaders == glad_glGetAttachedShaders
+        && context->GetAttribLocation == glad_glGetAttribLocation
+        && context->GetProgramiv == glad_glGetProgramiv
+        && context->GetProgramInfoLog == glad_glGetProgramInfoLog
+        && context->GetShaderiv == glad_glGetShaderiv
+        && context->GetShaderInfoLog == glad_glGetShaderInfoLog
+        && context->GetShaderSource == glad_glGetShaderSource
+        && context->GetUniformLocation == glad_glGetUniformLocation
+        && context->GetUniformfv == glad_glGetUniformfv
+        && context->GetUniformiv == glad_glGetUniformiv
+        && context->GetVertexAttribdv == glad_glGetVertexAttribdv
+        && context->GetVertexAttribfv == glad_glGetVertexAttribfv
+        && context->GetVertexAttribiv == glad_glGetVertexAttribiv
+        && context->GetVertexAttribPointerv == glad_glGetVertexAttribPointerv
+        && context->IsProgram == glad_glIsProgram
+        && context->IsShader == glad_glIsShader
+        && context->LinkProgram == glad_glLinkProgram
+        && context->ShaderSource == glad_glShaderSource
+        && context->UseProgram == glad_glUseProgram
+        && context->Uniform1f == glad_glUniform1f
+        && context->Uniform2f == glad_glUniform2f
+        && context->Uniform3f == glad_glUniform3f
+        && context->Uniform4f == glad_glUniform4f
+        && context->Uniform1i == glad_glUniform1i
+        && context->Uniform2i == glad_glUniform2i
+        && context->Uniform3i == glad_glUniform3i
+        && context->Uniform4i == glad_glUniform4i
+        && context->Uniform1fv == glad_glUniform1fv
+        && context->Uniform2fv == glad_glUniform2fv
+        && context->Uniform3fv == glad_glUniform3fv
+        && context->Uniform4fv == glad_glUniform4fv
+        && context->Uniform1iv == glad_glUniform1iv
+        && context->Uniform2iv == glad_glUniform2iv
+        && context->Uniform3iv == glad_glUniform3iv
+        && context->Uniform4iv == glad_glUniform4iv
+        && context->UniformMatrix2fv == glad_glUniformMatrix2fv
+        && context->UniformMatrix3fv == glad_glUniformMatrix3fv
+        && context->UniformMatrix4fv == glad_glUniformMatrix4fv
+        && context->ValidateProgram == glad_glValidateProgram
+        && context->VertexAttrib1d == glad_glVertexAttrib1d
+        && context->VertexAttrib1dv == glad_glVertexAttrib1dv
+        && context->VertexAttrib1f == glad_glVertexAttrib1f
+        && context->VertexAttrib1fv == glad_glVertexAttrib1fv
+        && context->VertexAttrib1s == glad_glVertexAttrib1s
+        && context->VertexAttrib1sv == glad_glVertexAttrib1sv
+        && context->VertexAttrib2d == glad_glVertexAttrib2d
+        && context->VertexAttrib2dv == glad_glVertexAttrib2dv
+        && context->VertexAttrib2f == glad_glVertexAttrib2f
+        && context->VertexAttrib2fv == glad_glVertexAttrib2fv
+        && context->VertexAttrib2s == glad_glVertexAttrib2s
+        && context->VertexAttrib2sv == glad_glVertexAttrib2sv
+        && context->VertexAttrib3d == glad_glVertexAttrib3d
+        && context->VertexAttrib3dv == glad_glVertexAttrib3dv
+        && context->VertexAttrib3f == glad_glVertexAttrib3f
+        && context->VertexAttrib3fv == glad_glVertexAttrib3fv
+        && context->VertexAttrib3s == glad_glVertexAttrib3s
+        && context->VertexAttrib3sv == glad_glVertexAttrib3sv
+        && context->VertexAttrib4Nbv == glad_glVertexAttrib4Nbv
+        && context->VertexAttrib4Niv == glad_glVertexAttrib4Niv
+        && context->VertexAttrib4Nsv == glad_glVertexAttrib4Nsv
+        && context->VertexAttrib4Nub == glad_glVertexAttrib4Nub
+        && context->VertexAttrib4Nubv == glad_glVertexAttrib4Nubv
+        && context->VertexAttrib4Nuiv == glad_glVertexAttrib4Nuiv
+        && context->VertexAttrib4Nusv == glad_glVertexAttrib4Nusv
+        && context->VertexAttrib4bv == glad_glVertexAttrib4bv
+        && context->VertexAttrib4d == glad_glVertexAttrib4d
+        && context->VertexAttrib4dv == glad_glVertexAttrib4dv
+        && context->VertexAttrib4f == glad_glVertexAttrib4f
+        && context->VertexAttrib4fv == glad_glVertexAttrib4fv
+        && context->VertexAttrib4iv == glad_glVertexAttrib4iv
+        && context->VertexAttrib4s == glad_glVertexAttrib4s
+        && context->VertexAttrib4sv == glad_glVertexAttrib4sv
+        && context->VertexAttrib4ubv == glad_glVertexAttrib4ubv
+        && context->VertexAttrib4uiv == glad_glVertexAttrib4uiv
+        && context->VertexAttrib4usv == glad_glVertexAttrib4usv
+        && context->VertexAttribPointer == glad_glVertexAttribPointer
+        && context->UniformMatrix2x3fv == glad_glUniformMatrix2x3fv
+        && context->UniformMatrix3x2fv == glad_glUniformMatrix3x2fv
+        && context->UniformMatrix2x4fv == glad_glUniformMatrix2x4fv
+        && context->UniformMatrix4x2fv == glad_glUniformMatrix4x2fv
+        && context->UniformMatrix3x4fv == glad_glUniformMatrix3x4fv
+        && context->UniformMatrix4x3fv == glad_glUniformMatrix4x3fv
+        && context->ColorMaski == glad_glColorMaski
+        && context->GetBooleani_v == glad_glGetBooleani_v
+        && context->GetIntegeri_v == glad_glGetIntegeri_v
+        && context->Enablei == glad_glEnablei
+        && context->Disablei == glad_glDisablei
+        && context->IsEnabledi == glad_glIsEnabledi
+        && context->BeginTransformFeedback == glad_glBeginTransformFeedback
+        && context->EndTransformFeedback == glad_glEndTransformFeedback
+        && context->BindBufferRange == glad_glBindBufferRange
+        && context->BindBufferBase == glad_glBindBufferBase
+        && context->TransformFeedbackVaryings == glad_glTransformFeedbackVaryings
+        && context->GetTransformFeedbackVarying == glad_glGetTransformFeedbackVarying
+        && context->ClampColor == glad_glClampColor
+        && context->BeginConditionalRender == glad_glBeginConditionalRender
+        && context->EndConditionalRender == glad_glEndConditionalRender
+        && context->VertexAttribIPointer == glad_glVertexAttribIPointer
+        && context->GetVertexAttribIiv == glad_glGetVertexAttribIiv
+        && context->GetVertexAttribIuiv == glad_glGetVertexAttribIuiv
+        && context->VertexAttribI1i == glad_glVertexAttribI1i
+        && context->VertexAttribI2i == glad_glVertexAttribI2i
+        && context->VertexAttribI3i == glad_glVertexAttribI3i
+        && context->VertexAttribI4i == glad_glVertexAttribI4i
+        && context->VertexAttribI1ui == glad_glVertexAttribI1ui
+        && context->VertexAttribI2ui == glad_glVertexAttribI2ui
+        && context->VertexAttribI3ui == glad_glVertexAttribI3ui
+        && context->VertexAttribI4ui == glad_glVertexAttribI4ui
+        && context->VertexAttribI1iv == glad_glVertexAttribI1iv
+        && context->VertexAttribI2iv == glad_glVertexAttribI2iv
+        && context->VertexAttribI3iv == glad_glVertexAttribI3iv
+        && context->VertexAttribI4iv == glad_glVertexAttribI4iv
+        && context->VertexAttribI1uiv == glad_glVertexAttribI1uiv
+        && context->VertexAttribI2uiv == glad_glVertexAttribI2uiv
+        && context->VertexAttribI3uiv == glad_glVertexAttribI3uiv
+        && context->VertexAttribI4uiv == glad_glVertexAttribI4uiv
+        && context->VertexAttribI4bv == glad_glVertexAttribI4bv
+        && context->VertexAttribI4sv == glad_glVertexAttribI4sv
+        && context->VertexAttribI4ubv == glad_glVertexAttribI4ubv
+        && context->VertexAttribI4usv == glad_glVertexAttribI4usv
+        && context->GetUniformuiv == glad_glGetUniformuiv
+        && context->BindFragDataLocation == glad_glBindFragDataLocation
+        && context->GetFragDataLocation == glad_glGetFragDataLocation
+        && context->Uniform1ui == glad_glUniform1ui
+        && context->Uniform2ui == glad_glUniform2ui
+        && context->Uniform3ui == glad_glUniform3ui
+        && context->Uniform4ui == glad_glUniform4ui
+        && context->Uniform1uiv == glad_glUniform1uiv
+        && context->Uniform2uiv == glad_glUniform2uiv
+        && context->Uniform3uiv == glad_glUniform3uiv
+        && context->Uniform4uiv == glad_glUniform4uiv
+        && context->TexParameterIiv == glad_glTexParameterIiv
+        && context->TexParameterIuiv == glad_glTexParameterIuiv
+        && context->GetTexParameterIiv == glad_glGetTexParameterIiv
+        && context->GetTexParameterIuiv == glad_glGetTexParameterIuiv
+        && context->ClearBufferiv == glad_glClearBufferiv
+        && context->ClearBufferuiv == glad_glClearBufferuiv
+        && context->ClearBufferfv == glad_glClearBufferfv
+        && context->ClearBufferfi == glad_glClearBufferfi
+        && context->GetStringi == glad_glGetStringi
+        && context->IsRenderbuffer == glad_glIsRenderbuffer
+        && context->BindRenderbuffer == glad_glBindRenderbuffer
+        && context->DeleteRenderbuffers == glad_glDeleteRenderbuffers
+        && context->GenRenderbuffers == glad_glGenRenderbuffers
+        && context->RenderbufferStorage == glad_glRenderbufferStorage
+        && context->GetRenderbufferParameteriv == glad_glGetRenderbufferParameteriv
+        && context->IsFramebuffer == glad_glIsFramebuffer
+        && context->BindFramebuffer == glad_glBindFramebuffer
+        && context->DeleteFramebuffers == glad_glDeleteFramebuffers
+        && context->GenFramebuffers == glad_glGenFramebuffers
+        && context->CheckFramebufferStatus == glad_glCheckFramebufferStatus
+        && context->FramebufferTexture1D == glad_glFramebufferTexture1D
+        && context->FramebufferTexture2D == glad_glFramebufferTexture2D
+        && context->FramebufferTexture3D == glad_glFramebufferTexture3D
+        && context->FramebufferRenderbuffer == glad_glFramebufferRenderbuffer
+        && context->GetFramebufferAttachmentParameteriv == glad_glGetFramebufferAttachmentParameteriv
+        && context->GenerateMipmap == glad_glGenerateMipmap
+        && context->BlitFramebuffer == glad_glBlitFramebuffer
+        && context->RenderbufferStorageMultisample == glad_glRenderbufferStorageMultisample
+        && context->FramebufferTextureLayer == glad_glFramebufferTextureLayer
+        && context->MapBufferRange == glad_glMapBufferRange
+        && context->FlushMappedBufferRange == glad_glFlushMappedBufferRange
+        && context->BindVertexArray == glad_glBindVertexArray
+        && context->DeleteVertexArrays == glad_glDeleteVertexArrays
+        && context->GenVertexArrays == glad_glGenVertexArrays
+        && context->IsVertexArray == glad_glIsVertexArray
+        && context->DrawArraysInstanced == glad_glDrawArraysInstanced
+        && context->DrawElementsInstanced == glad_glDrawElementsInstanced
+        && context->TexBuffer == glad_glTexBuffer
+        && context->PrimitiveRestartIndex == glad_glPrimitiveRestartIndex
+        && context->CopyBufferSubData == glad_glCopyBufferSubData
+        && context->GetUniformIndices == glad_glGetUniformIndices
+        && context->GetActiveUniformsiv == glad_glGetActiveUniformsiv
+        && context->GetActiveUniformName == glad_glGetActiveUniformName
+        && context->GetUniformBlockIndex == glad_glGetUniformBlockIndex
+        && context->GetActiveUniformBlockiv == glad_glGetActiveUniformBlockiv
+        && context->GetActiveUniformBlockName == glad_glGetActiveUniformBlockName
+        && context->UniformBlockBinding == glad_glUniformBlockBinding
+        && context->DrawElementsBaseVertex == glad_glDrawElementsBaseVertex
+        && context->DrawRangeElementsBaseVertex == glad_glDrawRangeElementsBaseVertex
+        && context->DrawElementsInstancedBaseVertex == glad_glDrawElementsInstancedBaseVertex
+        && context->MultiDrawElementsBaseVertex == glad_glMultiDrawElementsBaseVertex
+        && context->ProvokingVertex == glad_glProvokingVertex
+        && context->FenceSync == glad_glFenceSync
+        && context->IsSync == glad_glIsSync
+        && context->DeleteSync == glad_glDeleteSync
+        && context->ClientWaitSync == glad_glClientWaitSync
+        && context->WaitSync == glad_glWaitSync
+        && context->GetInteger64v == glad_glGetInteger64v
+        && context->GetSynciv == glad_glGetSynciv
+        && context->GetInteger64i_v == glad_glGetInteger64i_v
+        && context->GetBufferParameteri64v == glad_glGetBufferParameteri64v
+        && context->FramebufferTexture == glad_glFramebufferTexture
+        && context->TexImage2DMultisample == glad_glTexImage2DMultisample
+        && context->TexImage3DMultisample == glad_glTexImage3DMultisample
+        && context->GetMultisamplefv == glad_glGetMultisamplefv
+        && context->SampleMaski == glad_glSampleMaski
+        && context->BindFragDataLocationIndexed == glad_glBindFragDataLocationIndexed
+        && context->GetFragDataIndex == glad_glGetFragDataIndex
+        && context->GenSamplers == glad_glGenSamplers
+        && context->DeleteSamplers == glad_glDeleteSamplers
+        && context->IsSampler == glad_glIsSampler
+        && context->BindSampler == glad_glBindSampler
+        && context->SamplerParameteri == glad_glSamplerParameteri
+        && context->SamplerParameteriv == glad_glSamplerParameteriv
+        && context->SamplerParameterf == glad_glSamplerParameterf
+        && context->SamplerParameterfv == glad_glSamplerParameterfv
+        && context->SamplerParameterIiv == glad_glSamplerParameterIiv
+        && context->SamplerParameterIuiv == glad_glSamplerParameterIuiv
+        && context->GetSamplerParameteriv == glad_glGetSamplerParameteriv
+        && context->GetSamplerParameterIiv == glad_glGetSamplerParameterIiv
+        && context->GetSamplerParameterfv == glad_glGetSamplerParameterfv
+        && context->GetSamplerParameterIuiv == glad_glGetSamplerParameterIuiv
+        && context->QueryCounter == glad_glQueryCounter
+        && context->GetQueryObjecti64v == glad_glGetQueryObjecti64v
+        && context->GetQueryObjectui64v == glad_glGetQueryObjectui64v
+        && context->VertexAttribDivisor == glad_glVertexAttribDivisor
+        && context->VertexAttribP1ui == glad_glVertexAttribP1ui
+        && context->VertexAttribP1uiv == glad_glVertexAttribP1uiv
+        && context->VertexAttribP2ui == glad_glVertexAttribP2ui
+        && context->VertexAttribP2uiv == glad_glVertexAttribP2uiv
+        && context->VertexAttribP3ui == glad_glVertexAttribP3ui
+        && context->VertexAttribP3uiv == glad_glVertexAttribP3uiv
+        && context->VertexAttribP4ui == glad_glVertexAttribP4ui
+        && context->VertexAttribP4uiv == glad_glVertexAttribP4uiv
+        && context->VertexP2ui == glad_glVertexP2ui
+        && context->VertexP2uiv == glad_glVertexP2uiv
+        && context->VertexP3ui == glad_glVertexP3ui
+        && context->VertexP3uiv == glad_glVertexP3uiv
+        && context->VertexP4ui == glad_glVertexP4ui
+        && context->VertexP4uiv == glad_glVertexP4uiv
+        && context->TexCoordP1ui == glad_glTexCoordP1ui
+        && context->TexCoordP1uiv == glad_glTexCoordP1uiv
+        && context->TexCoordP2ui == glad_glTexCoordP2ui
+        && context->TexCoordP2uiv == glad_glTexCoordP2uiv
+        && context->TexCoordP3ui == glad_glTexCoordP3ui
+        && context->TexCoordP3uiv == glad_glTexCoordP3uiv
+        && context->TexCoordP4ui == glad_glTexCoordP4ui
+        && context->TexCoordP4uiv == glad_glTexCoordP4uiv
+        && context->MultiTexCoordP1ui == glad_glMultiTexCoordP1ui
+        && context->MultiTexCoordP1uiv == glad_glMultiTexCoordP1uiv
+        && context->MultiTexCoordP2ui == glad_glMultiTexCoordP2ui
+        && context->MultiTexCoordP2uiv == glad_glMultiTexCoordP2uiv
+        && context->MultiTexCoordP3ui == glad_glMultiTexCoordP3ui
+        && context->MultiTexCoordP3uiv == glad_glMultiTexCoordP3uiv
+        && context->MultiTexCoordP4ui == glad_glMultiTexCoordP4ui
+        && context->MultiTexCoordP4uiv == glad_glMultiTexCoordP4uiv
+        && context->NormalP3ui == glad_glNormalP3ui
+        && context->NormalP3uiv == glad_glNormalP3uiv
+        && context->ColorP3ui == glad_glColorP3ui
+        && context->ColorP3uiv == glad_glColorP3uiv
+        && context->ColorP4ui == glad_glColorP4ui
+        && context->ColorP4uiv == glad_glColorP4uiv
+        && context->SecondaryColorP3ui == glad_glSecondaryColorP3ui
+        && context->SecondaryColorP3uiv == glad_glSecondaryColorP3uiv;
+}
+
+int gladLoadGLContext(GladGLContext *context, GLADloadproc load) {
+    const char *version;
+    int major = 0, minor = 0;
+    memset(context, 0, sizeof(*context));
+    context->GetString = (PFNGLGETSTRINGPROC)load("glGetString");
+    if(context->GetString == NULL) return 0;
+    version = (const char *)context->GetString(GL_VERSION);
+    if(version == NULL) return 0;
+    while(*version && (*version < '0' || *version > '9')) version++; /* "OpenGL ES " and similar prefixes */
+#ifdef _MSC_VER
+    sscanf_s(version, "%d.%d", &major, &minor);
+#else
+    sscanf(version, "%d.%d", &major, &minor);
+#endif
+    context->version.major = major; context->version.minor = minor;
+    if(major > 1 || (major == 1 && minor >= 0)) {
+        context->CullFace = (PFNGLCULLFACEPROC)load("glCullFace");
+        context->FrontFace = (PFNGLFRONTFACEPROC)load("glFrontFace");
+        context->Hint = (PFNGLHINTPROC)load("glHint");
+        context->LineWidth = (PFNGLLINEWIDTHPROC)load("glLineWidth");
+        context->PointSize = (PFNGLPOINTSIZEPROC)load("glPointSize");
+        context->PolygonMode = (PFNGLPOLYGONMODEPROC)load("glPolygonMode");
+        context->Scissor = (PFNGLSCISSORPROC)load("glScissor");
+        context->TexParameterf = (PFNGLTEXPARAMETERFPROC)load("glTexParameterf");
+        context->TexParameterfv = (PFNGLTEXPARAMETERFVPROC)load("glTexParameterfv");
+        context->TexParameteri = (PFNGLTEXPARAMETERIPROC)load("glTexParameteri");
+        context->TexParameteriv = (PFNGLTEXPARAMETERIVPROC)load("glTexParameteriv");
+        context->TexImage1D = (PFNGLTEXIMAGE1DPROC)load("glTexImage1D");
+        context->TexImage2D = (PFNGLTEXIMAGE2DPROC)load("glTexImage2D");
+        context->DrawBuffer = (PFNGLDRAWBUFFERPROC)load("glDrawBuffer");
+        context->Clear = (PFNGLCLEARPROC)load("glClear");
+        context->ClearColor = (PFNGLCLEARCOLORPROC)load("glClearColor");
+        context->ClearStencil = (PFNGLCLEARSTENCILPROC)load("glClearStencil");
+        context->ClearDepth = (PFNGLCLEARDEPTHPROC)load("glClearDepth");
+        context->StencilMask = (PFNGLSTENCILMASKPROC)load("glStencilMask");
+        context->ColorMask = (PFNGLCOLORMASKPROC)load("glColorMask");
+        context->DepthMask = (PFNGLDEPTHMASKPROC)load("glDepthMask");
+        context->Disable = (PFNGLDISABLEPROC)load("glDisable");
+        context->Enable = (PFNGLENABLEPROC)load("glEnable");
+        context->Finish = (PFNGLFINISHPROC)load("glFinish");
+        context->Flush = (PFNGLFLUSHPROC)load("glFlush");
+        context->BlendFunc = (PFNGLBLENDFUNCPROC)load("glBlendFunc");
+        context->LogicOp = (PFNGLLOGICOPPROC)load("glLogicOp");
+        context->StencilFunc = (PFNGLSTENCILFUNCPROC)load("glStencilFunc");
+        context->StencilOp = (PFNGLSTENCILOPPROC)load("glStencilOp");
+        context->DepthFunc = (PFNGLDEPTHFUNCPROC)load("glDepthFunc");
+        context->PixelStoref = (PFNGLPIXELSTOREFPROC)load("glPixelStoref");
+        context->PixelStorei = (PFNGLPIXELSTOREIPROC)load("glPixelStorei");
+        context->ReadBuffer = (PFNGLREADBUFFERPROC)load("glReadBuffer");
+        context->ReadPixels = (PFNGLREADPIXELSPROC)load("glReadPixels");
+        context->GetBooleanv = (PFNGLGETBOOLEANVPROC)load("glGetBooleanv");
+        context->GetDoublev = (PFNGLGETDOUBLEVPROC)load("glGetDoublev");
+        context->GetError = (PFNGLGETERRORPROC)load("glGetError");
+        context->GetFloatv = (PFNGLGETFLOATVPROC)load("glGetFloatv");
+        context->GetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
+        context->GetString = (PFNGLGETSTRINGPROC)load("glGetString");
+        context->GetTexImage = (PFNGLGETTEXIMAGEPROC)load("glGetTexImage");
+        context->GetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)load("glGetTexParameterfv");
+        context->GetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)load("glGetTexParameteriv");
+        context->GetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)load("glGetTexLevelParameterfv");
+        context->GetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)load("glGetTexLevelParameteriv");
+        context->IsEnabled = (PFNGLISENABLEDPROC)load("glIsEnabled");
+        context->DepthRange = (PFNGLDEPTHRANGEPROC)load("glDepthRange");
+        context->Viewport = (PFNGLVIEWPORTPROC)load("glViewport");
+    }
+    if(major > 1 || (major == 1 && minor >= 1)) {
+        context->DrawArrays = (PFNGLDRAWARRAYSPROC)load("glDrawArrays");
+        context->DrawElements = (PFNGLDRAWELEMENTSPROC)load("glDrawElements");
+        context->PolygonOffset = (PFNGLPOLYGONOFFSETPROC)load("glPolygonOffset");
+        context->CopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)load("glCopyTexImage1D");
+        context->CopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)load("glCopyTexImage2D");
+        context->CopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)load("glCopyTexSubImage1D");
+        context->CopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)load("glCopyTexSubImage2D");
+        context->TexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)load("glTexSubImage1D");
+        context->TexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)load("glTexSubImage2D");
+        context->BindTexture = (PFNGLBINDTEXTUREPROC)load("glBindTexture");
+        context->DeleteTextures = (PFNGLDELETETEXTURESPROC)load("glDeleteTextures");
+        context->GenTextures = (PFNGLGENTEXTURESPROC)load("glGenTextures");
+        context->IsTexture = (PFNGLISTEXTUREPROC)load("glIsTexture");
+    }
+    if(major > 1 || (major == 1 && minor >= 2)) {
+        context->DrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)load("glDrawRangeElements");
+        context->TexImage3D = (PFNGLTEXIMAGE3DPROC)load("glTexImage3D");
+        context->TexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)load("glTexSubImage3D");
+        context->CopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)load("glCopyTexSubImage3D");
+    }
+    if(major > 1 || (major == 1 && minor >= 3)) {
+        context->ActiveTexture = (PFNGLACTIVETEXTUREPROC)load("glActiveTexture");
+        context->SampleCoverage = (PFNGLSAMPLECOVERAGEPROC)load("glSampleCoverage");
+        context->CompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)load("glCompressedTexImage3D");
+        context->CompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)load("glCompressedTexImage2D");
+        context->CompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)load("glCompressedTexImage1D");
+        context->CompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)load("glCompressedTexSubImage3D");
+        context->CompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)load("glCompressedTexSubImage2D");
+        context->CompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)load("glCompressedTexSubImage1D");
+        context->GetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)load("glGetCompressedTexImage");
+    }
+    if(major > 1 || (major == 1 && minor >= 4)) {
+        context->BlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)load("glBlendFuncSeparate");
+        context->MultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)load("glMultiDrawArrays");
+        context->MultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)load("glMultiDrawElements");
+        context->PointParameterf = (PFNGLPOINTPARAMETERFPROC)load("glPointParameterf");
+        context->PointParameterfv = (PFNGLPOINTPARAMETERFVPROC)load("glPointParameterfv");
+        context->PointParameteri = (PFNGLPOINTPARAMETERIPROC)load("glPointParameteri");
+        context->PointParameteriv = (PFNGLPOINTPARAMETERIVPROC)load("glPointParameteriv");
+        context->BlendColor = (PFNGLBLENDCOLORPROC)load("glBlendColor");
+        context->BlendEquation = (PFNGLBLENDEQUATIONPROC)load("glBlendEquation");
+    }
+    if(major > 1 || (major == 1 && minor >= 5)) {
+        context->GenQueries = (PFNGLGENQUERIESPROC)load("glGenQueries");
+        context->DeleteQueries = (PFNGLDELETEQUERIESPROC)load("glDeleteQueries");
+        context->IsQuery = (PFNGLISQUERYPROC)load("glIsQuery");
+        context->BeginQuery = (PFNGLBEGINQUERYPROC)load("glBeginQuery");
+        context->EndQuery = (PFNGLENDQUERYPROC)load("glEndQuery");
+        context->GetQueryiv = (PFNGLGETQUERYIVPROC)load("glGetQueryiv");
+        context->GetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)load("glGetQueryObjectiv");
+        context->GetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)load("glGetQueryObjectuiv");
+        context->BindBuffer = (PFNGLBINDBUFFERPROC)load("glBindBuffer");
+        context->DeleteBuffers = (PFNGLDELETEBUFFERSPROC)load("glDeleteBuffers");
+        context->GenBuffers = (PFNGLGENBUFFERSPROC)load("glGenBuffers");
+        context->IsBuffer = (PFNGLISBUFFERPROC)load("glIsBuffer");
+        context->BufferData = (PFNGLBUFFERDATAPROC)load("glBufferData");
+        context->BufferSubData = (PFNGLBUFFERSUBDATAPROC)load("glBufferSubData");
+        context->GetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)load("glGetBufferSubData");
+        context->MapBuffer = (PFNGLMAPBUFFERPROC)load("glMapBuffer");
+        context->UnmapBuffer = (PFNGLUNMAPBUFFERPROC)load("glUnmapBuffer");
+        context->GetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)load("glGetBufferParameteriv");
+        context->GetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)load("glGetBufferPointerv");
+    }
+    if(major > 2 || (major == 2 && minor >= 0)) {
+        context->BlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)load("glBlendEquationSeparate");
+        context->DrawBuffers = (PFNGLDRAWBUFFERSPROC)load("glDrawBuffers");
+        context->StencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)load("glStencilOpSeparate");
+        context->StencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)load("glStencilFuncSeparate");
+        context->StencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)load("glStencilMaskSeparate");
+        context->AttachShader = (PFNGLATTACHSHADERPROC)load("glAttachShader");
+        context->BindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)load("glBindAttribLocation");
+        context->CompileShader = (PFNGLCOMPILESHADERPROC)load("glCompileShader");
+        context->CreateProgram = (PFNGLCREATEPROGRAMPROC)load("glCreateProgram");
+        context->CreateShader = (PFNGLCREATESHADERPROC)load("glCreateShader");
+        context->DeleteProgram = (PFNGLDELETEPROGRAMPROC)load("glDeleteProgram");
+        context->DeleteShader = (PFNGLDELETESHADERPROC)load("glDeleteShader");
+        context->DetachShader = (PFNGLDETACHSHADERPROC)load("glDetachShader");
+        context->DisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)load("glDisableVertexAttribArray");
+        context->EnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)load("glEnableVertexAttribArray");
+        context->GetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)load("glGetActiveAttrib");
+        context->GetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)load("glGetActiveUniform");
+        context->GetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)load("glGetAttachedShaders");
+        context->GetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)load("glGetAttribLocation");
+        context->GetProgramiv = (PFNGLGETPROGRAMIVPROC)load("glGetProgramiv");
+        context->GetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)load("glGetProgramInfoLog");
+        context->GetShaderiv = (PFNGLGETSHADERIVPROC)load("glGetShaderiv");
+        context->GetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)load("glGetShaderInfoLog");
+        context->GetShaderSource = (PFNGLGETSHADERSOURCEPROC)load("glGetShaderSource");
+        context->GetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)load("glGetUniformLocation");
+        context->GetUniformfv = (PFNGLGETUNIFORMFVPROC)load("glGetUniformfv");
+        context->GetUniformiv = (PFNGLGETUNIFORMIVPROC)load("glGetUniformiv");
+        context->GetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)load("glGetVertexAttribdv");
+        context->GetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)load("glGetVertexAttribfv");
+        context->GetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)load("glGetVertexAttribiv");
+        context->GetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)load("glGetVertexAttribPointerv");
+        context->IsProgram = (PFNGLISPROGRAMPROC)load("glIsProgram");
+        context->IsShader = (PFNGLISSHADERPROC)load("glIsShader");
+        context->LinkProgram = (PFNGLLINKPROGRAMPROC)load("glLinkProgram");
+        context->ShaderSource = (PFNGLSHADERSOURCEPROC)load("glShaderSource");
+        context->UseProgram = (PFNGLUSEPROGRAMPROC)load("glUseProgram");
+        context->Uniform1f = (PFNGLUNIFORM1FPROC)load("glUniform1f");
+        context->Uniform2f = (PFNGLUNIFORM2FPROC)load("glUniform2f");
+        context->Uniform3f = (PFNGLUNIFORM3FPROC)load("glUniform3f");
+        context->Uniform4f = (PFNGLUNIFORM4FPROC)load("glUniform4f");
+        context->Uniform1i = (PFNGLUNIFORM1IPROC)load("glUniform1i");
+        context->Uniform2i = (PFNGLUNIFORM2IPROC)load("glUniform2i");
+        context->Uniform3i = (PFNGLUNIFORM3IPROC)load("glUniform3i");
+        context->Uniform4i = (PFNGLUNIFORM4IPROC)load("glUniform4i");
+        context->Uniform1fv = (PFNGLUNIFORM1FVPROC)load("glUniform1fv");
+        context->Uniform2fv = (PFNGLUNIFORM2FVPROC)load("glUniform2fv");
+        context->Uniform3fv = (PFNGLUNIFORM3FVPROC)load("glUniform3fv");
+        context->Uniform4fv = (PFNGLUNIFORM4FVPROC)load("glUniform4fv");
+        context->Uniform1iv = (PFNGLUNIFORM1IVPROC)load("glUniform1iv");
+        context->Uniform2iv = (PFNGLUNIFORM2IVPROC)load("glUniform2iv");
+        context->Uniform3iv = (PFNGLUNIFORM3IVPROC)load("glUniform3iv");
+        context->Uniform4iv = (PFNGLUNIFORM4IVPROC)load("glUniform4iv");
+        context->UniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)load("glUniformMatrix2fv");
+        context->UniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)load("glUniformMatrix3fv");
+        context->UniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)load("glUniformMatrix4fv");
+        context->ValidateProgram = (PFNGLVALIDATEPROGRAMPROC)load("glValidateProgram");
+        context->VertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)load("glVertexAttrib1d");
+        context->VertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)load("glVertexAttrib1dv");
+        context->VertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)load("glVertexAttrib1f");
+        context->VertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)load("glVertexAttrib1fv");
+        context->VertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)load("glVertexAttrib1s");
+        context->VertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)load("glVertexAttrib1sv");
+        context->VertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)load("glVertexAttrib2d");
+        context->VertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)load("glVertexAttrib2dv");
+        context->VertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)load("glVertexAttrib2f");
+        context->VertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)load("glVertexAttrib2fv");
+        context->VertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)load("glVertexAttrib2s");
+        context->VertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)load("glVertexAttrib2sv");
+        context->VertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)load("glVertexAttrib3d");
+        context->VertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)load("glVertexAttrib3dv");
+        context->VertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)load("glVertexAttrib3f");
+        context->VertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)load("glVertexAttrib3fv");
+        context->VertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)load("glVertexAttrib3s");
+        context->VertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)load("glVertexAttrib3sv");
+        context->VertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)load("glVertexAttrib4Nbv");
+        context->VertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)load("glVertexAttrib4Niv");
+        context->VertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)load("glVertexAttrib4Nsv");
+        context->VertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)load("glVertexAttrib4Nub");
+        context->VertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)load("glVertexAttrib4Nubv");
+        context->VertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)load("glVertexAttrib4Nuiv");
+        context->VertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)load("glVertexAttrib4Nusv");
+        context->VertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)load("glVertexAttrib4bv");
+        context->VertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)load("glVertexAttrib4d");
+        context->VertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)load("glVertexAttrib4dv");
+        context->VertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)load("glVertexAttrib4f");
+        context->VertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)load("glVertexAttrib4fv");
+        context->VertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)load("glVertexAttrib4iv");
+        context->VertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)load("glVertexAttrib4s");
+        context->VertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)load("glVertexAttrib4sv");
+        context->VertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)load("glVertexAttrib4ubv");
+        context->VertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)load("glVertexAttrib4uiv");
+        context->VertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)load("glVertexAttrib4usv");
+        context->VertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)load("glVertexAttribPointer");
+    }
+    if(major > 2 || (major == 2 && minor >= 1)) {
+        context->UniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)load("glUniformMatrix2x3fv");
+        context->UniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)load("glUniformMatrix3x2fv");
+        context->UniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)load("glUniformMatrix2x4fv");
+        context->UniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)load("glUniformMatrix4x2fv");
+        context->UniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)load("glUniformMatrix3x4fv");
+        context->UniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)load("glUniformMatrix4x3fv");
+    }
+    if(major > 3 || (major == 3 && minor >= 0)) {
+        context->ColorMaski = (PFNGLCOLORMASKIPROC)load("glColorMaski");
+        context->GetBooleani_v = (PFNGLGETBOOLEANI_VPROC)load("glGetBooleani_v");
+        context->GetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+        context->Enablei = (PFNGLENABLEIPROC)load("glEnablei");
+        context->Disablei = (PFNGLDISABLEIPROC)load("glDisablei");
+        context->IsEnabledi = (PFNGLISENABLEDIPROC)load("glIsEnabledi");
+        context->BeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)load("glBeginTransformFeedback");
+        context->EndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)load("glEndTransformFeedback");
+        context->BindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+        context->BindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+        context->TransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)load("glTransformFeedbackVaryings");
+        context->GetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)load("glGetTransformFeedbackVarying");
+        context->ClampColor = (PFNGLCLAMPCOLORPROC)load("glClampColor");
+        context->BeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)load("glBeginConditionalRender");
+        context->EndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)load("glEndConditionalRender");
+        context->VertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)load("glVertexAttribIPointer");
+        context->GetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)load("glGetVertexAttribIiv");
+        context->GetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)load("glGetVertexAttribIuiv");
+        context->VertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)load("glVertexAttribI1i");
+        context->VertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)load("glVertexAttribI2i");
+        context->VertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)load("glVertexAttribI3i");
+        context->VertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)load("glVertexAttribI4i");
+        context->VertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)load("glVertexAttribI1ui");
+        context->VertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)load("glVertexAttribI2ui");
+        context->VertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)load("glVertexAttribI3ui");
+        context->VertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)load("glVertexAttribI4ui");
+        context->VertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)load("glVertexAttribI1iv");
+        context->VertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)load("glVertexAttribI2iv");
+        context->VertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)load("glVertexAttribI3iv");
+        context->VertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)load("glVertexAttribI4iv");
+        context->VertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)load("glVertexAttribI1uiv");
+        context->VertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)load("glVertexAttribI2uiv");
+        context->VertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)load("glVertexAttribI3uiv");
+        context->VertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)load("glVertexAttribI4uiv");
+        context->VertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)load("glVertexAttribI4bv");
+        context->VertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)load("glVertexAttribI4sv");
+        context->VertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)load("glVertexAttribI4ubv");
+        context->VertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)load("glVertexAttribI4usv");
+        context->GetUniformuiv = (PFNGLGETUNIFORMUIVPROC)load("glGetUniformuiv");
+        context->BindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)load("glBindFragDataLocation");
+        context->GetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)load("glGetFragDataLocation");
+        context->Uniform1ui = (PFNGLUNIFORM1UIPROC)load("glUniform1ui");
+        context->Uniform2ui = (PFNGLUNIFORM2UIPROC)load("glUniform2ui");
+        context->Uniform3ui = (PFNGLUNIFORM3UIPROC)load("glUniform3ui");
+        context->Uniform4ui = (PFNGLUNIFORM4UIPROC)load("glUniform4ui");
+        context->Uniform1uiv = (PFNGLUNIFORM1UIVPROC)load("glUniform1uiv");
+        context->Uniform2uiv = (PFNGLUNIFORM2UIVPROC)load("glUniform2uiv");
+        context->Uniform3uiv = (PFNGLUNIFORM3UIVPROC)load("glUniform3uiv");
+        context->Uniform4uiv = (PFNGLUNIFORM4UIVPROC)load("glUniform4uiv");
+        context->TexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)load("glTexParameterIiv");
+        context->TexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)load("glTexParameterIuiv");
+        context->GetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)load("glGetTexParameterIiv");
+        context->GetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)load("glGetTexParameterIuiv");
+        context->ClearBufferiv = (PFNGLCLEARBUFFERIVPROC)load("glClearBufferiv");
+        context->ClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)load("glClearBufferuiv");
+        context->ClearBufferfv = (PFNGLCLEARBUFFERFVPROC)load("glClearBufferfv");
+        context->ClearBufferfi = (PFNGLCLEARBUFFERFIPROC)load("glClearBufferfi");
+        context->GetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
+        context->IsRenderbuffer = (PFNGLISRENDERBUFFERPROC)load("glIsRenderbuffer");
+        context->BindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)load("glBindRenderbuffer");
+        context->DeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)load("glDeleteRenderbuffers");
+        context->GenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)load("glGenRenderbuffers");
+        context->RenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)load("glRenderbufferStorage");
+        context->GetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)load("glGetRenderbufferParameteriv");
+        context->IsFramebuffer = (PFNGLISFRAMEBUFFERPROC)load("glIsFramebuffer");
+        context->BindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)load("glBindFramebuffer");
+        context->DeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)load("glDeleteFramebuffers");
+        context->GenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)load("glGenFramebuffers");
+        context->CheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)load("glCheckFramebufferStatus");
+        context->FramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)load("glFramebufferTexture1D");
+        context->FramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)load("glFramebufferTexture2D");
+        context->FramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)load("glFramebufferTexture3D");
+        context->FramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)load("glFramebufferRenderbuffer");
+        context->GetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetFramebufferAttachmentParameteriv");
+        context->GenerateMipmap = (PFNGLGENERATEMIPMAPPROC)load("glGenerateMipmap");
+        context->BlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)load("glBlitFramebuffer");
+        context->RenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glRenderbufferStorageMultisample");
+        context->FramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)load("glFramebufferTextureLayer");
+        context->MapBufferRange = (PFNGLMAPBUFFERRANGEPROC)load("glMapBufferRange");
+        context->FlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)load("glFlushMappedBufferRange");
+        context->BindVertexArray = (PFNGLBINDVERTEXARRAYPROC)load("glBindVertexArray");
+        context->DeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)load("glDeleteVertexArrays");
+        context->GenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)load("glGenVertexArrays");
+        context->IsVertexArray = (PFNGLISVERTEXARRAYPROC)load("glIsVertexArray");
+    }
+    if(major > 3 || (major == 3 && minor >= 1)) {
+        context->DrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)load("glDrawArraysInstanced");
+        context->DrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)load("glDrawElementsInstanced");
+        context->TexBuffer = (PFNGLTEXBUFFERPROC)load("glTexBuffer");
+        context->PrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)load("glPrimitiveRestartIndex");
+        context->CopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)load("glCopyBufferSubData");
+        context->GetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)load("glGetUniformIndices");
+        context->GetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)load("glGetActiveUniformsiv");
+        context->GetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)load("glGetActiveUniformName");
+        context->GetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)load("glGetUniformBlockIndex");
+        context->GetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)load("glGetActiveUniformBlockiv");
+        context->GetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)load("glGetActiveUniformBlockName");
+        context->UniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)load("glUniformBlockBinding");
+        context->BindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+        context->BindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+        context->GetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+    }
+    if(major > 3 || (major == 3 && minor >= 2)) {
+        context->DrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)load("glDrawElementsBaseVertex");
+        context->DrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)load("glDrawRangeElementsBaseVertex");
+        context->DrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)load("glDrawElementsInstancedBaseVertex");
+        context->MultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)load("glMultiDrawElementsBaseVertex");
+        context->ProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)load("glProvokingVertex");
+        context->FenceSync = (PFNGLFENCESYNCPROC)load("glFenceSync");
+        context->IsSync = (PFNGLISSYNCPROC)load("glIsSync");
+        context->DeleteSync = (PFNGLDELETESYNCPROC)load("glDeleteSync");
+        context->ClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)load("glClientWaitSync");
+        context->WaitSync = (PFNGLWAITSYNCPROC)load("glWaitSync");
+        context->GetInteger64v = (PFNGLGETINTEGER64VPROC)load("glGetInteger64v");
+        context->GetSynciv = (PFNGLGETSYNCIVPROC)load("glGetSynciv");
+        context->GetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)load("glGetInteger64i_v");
+        context->GetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)load("glGetBufferParameteri64v");
+        context->FramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)load("glFramebufferTexture");
+        context->TexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)load("glTexImage2DMultisample");
+        context->TexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)load("glTexImage3DMultisample");
+        context->GetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)load("glGetMultisamplefv");
+        context->SampleMaski = (PFNGLSAMPLEMASKIPROC)load("glSampleMaski");
+    }
+    if(major > 3 || (major == 3 && minor >= 3)) {
+        context->BindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)load("glBindFragDataLocationIndexed");
+        context->GetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)load("glGetFragDataIndex");
+        context->GenSamplers = (PFNGLGENSAMPLERSPROC)load("glGenSamplers");
+        context->DeleteSamplers = (PFNGLDELETESAMPLERSPROC)load("glDeleteSamplers");
+        context->IsSampler = (PFNGLISSAMPLERPROC)load("glIsSampler");
+        context->BindSampler = (PFNGLBINDSAMPLERPROC)load("glBindSampler");
+        context->SamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)load("glSamplerParameteri");
+        context->SamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)load("glSamplerParameteriv");
+        context->SamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)load("glSamplerParameterf");
+        context->SamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)load("glSamplerParameterfv");
+        context->SamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)load("glSamplerParameterIiv");
+        context->SamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)load("glSamplerParameterIuiv");
+        context->GetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)load("glGetSamplerParameteriv");
+        context->GetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)load("glGetSamplerParameterIiv");
+        context->GetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)load("glGetSamplerParameterfv");
+        context->GetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)load("glGetSamplerParameterIuiv");
+        context->QueryCounter = (PFNGLQUERYCOUNTERPROC)load("glQueryCounter");
+        context->GetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)load("glGetQueryObjecti64v");
+        context->GetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)load("glGetQueryObjectui64v");
+        context->VertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)load("glVertexAttribDivisor");
+        context->VertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)load("glVertexAttribP1ui");
+        context->VertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)load("glVertexAttribP1uiv");
+        context->VertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)load("glVertexAttribP2ui");
+        context->VertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)load("glVertexAttribP2uiv");
+        context->VertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)load("glVertexAttribP3ui");
+        context->VertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)load("glVertexAttribP3uiv");
+        context->VertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)load("glVertexAttribP4ui");
+        context->VertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)load("glVertexAttribP4uiv");
+        context->VertexP2ui = (PFNGLVERTEXP2UIPROC)load("glVertexP2ui");
+        context->VertexP2uiv = (PFNGLVERTEXP2UIVPROC)load("glVertexP2uiv");
+        context->VertexP3ui = (PFNGLVERTEXP3UIPROC)load("glVertexP3ui");
+        context->VertexP3uiv = (PFNGLVERTEXP3UIVPROC)load("glVertexP3uiv");
+        context->VertexP4ui = (PFNGLVERTEXP4UIPROC)load("glVertexP4ui");
+        context->VertexP4uiv = (PFNGLVERTEXP4UIVPROC)load("glVertexP4uiv");
+        context->TexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)load("glTexCoordP1ui");
+        context->TexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)load("glTexCoordP1uiv");
+        context->TexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)load("glTexCoordP2ui");
+        context->TexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)load("glTexCoordP2uiv");
+        context->TexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)load("glTexCoordP3ui");
+        context->TexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)load("glTexCoordP3uiv");
+        context->TexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)load("glTexCoordP4ui");
+        context->TexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)load("glTexCoordP4uiv");
+        context->MultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)load("glMultiTexCoordP1ui");
+        context->MultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)load("glMultiTexCoordP1uiv");
+        context->MultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)load("glMultiTexCoordP2ui");
+        context->MultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)load("glMultiTexCoordP2uiv");
+        context->MultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)load("glMultiTexCoordP3ui");
+        context->MultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)load("glMultiTexCoordP3uiv");
+        context->MultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)load("glMultiTexCoordP4ui");
+        context->MultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)load("glMultiTexCoordP4uiv");
+        context->NormalP3ui = (PFNGLNORMALP3UIPROC)load("glNormalP3ui");
+        context->NormalP3uiv = (PFNGLNORMALP3UIVPROC)load("glNormalP3uiv");
+        context->ColorP3ui = (PFNGLCOLORP3UIPROC)load("glColorP3ui");
+        context->ColorP3uiv = (PFNGLCOLORP3UIVPROC)load("glColorP3uiv");
+        context->ColorP4ui = (PFNGLCOLORP4UIPROC)load("glColorP4ui");
+        context->ColorP4uiv = (PFNGLCOLORP4UIVPROC)load("glColorP4uiv");
+        context->SecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
+        context->SecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
+    }
+    if(!glad_gl_table_matches_globals(context)) GLAD_GL_SET_MULTIPLE_TABLES(); /* Leaves the fast path for good */
+    return major != 0 || minor != 0;
+}
+
+void gladSetGLContext(const GladGLContext *context) {
+    glad_gl_current_table = context;
+}
+
+const GladGLContext *gladGetGLContext(void) {
+    return glad_gl_current_table;
+}
+
+void *gladGLContextFunction(size_t offset, void *global) {
+    const GladGLContext *context = glad_gl_current_table;
+    return context ? *(void * const *)((const char *)context + offset) : global;
+}
+/* End of per-context function tables */
@@ -2122,6 +2122,2283 @@ GLAPI PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv;
 #define glSecondaryColorP3uiv glad_glSecondaryColorP3uiv
 #endif
 
+/* Per-context function tables: generated by tools/gen_glad_context.py */
+#include <stddef.h>
+typedef struct GladGLContext {
+    struct gladGLversionStruct version;
+    PFNGLCULLFACEPROC CullFace;
+    PFNGLFRONTFACEPROC FrontFace;
+    PFNGLHINTPROC Hint;
+    PFNGLLINEWIDTHPROC LineWidth;
+    PFNGLPOINTSIZEPROC PointSize;
+    PFNGLPOLYGONMODEPROC PolygonMode;
+    PFNGLSCISSORPROC Scissor;
+    PFNGLTEXPARAMETERFPROC TexParameterf;
+    PFNGLTEXPARAMETERFVPROC TexParameterfv;
+    PFNGLTEXPARAMETERIPROC TexParameteri;
+    PFNGLTEXPARAMETERIVPROC TexParameteriv;
+    PFNGLTEXIMAGE1DPROC TexImage1D;
+    PFNGLTEXIMAGE2DPROC TexImage2D;
+    PFNGLDRAWBUFFERPROC DrawBuffer;
+    PFNGLCLEARPROC Clear;
+    PFNGLCLEARCOLORPROC ClearColor;
+    PFNGLCLEARSTENCILPROC ClearStencil;
+    PFNGLCLEARDEPTHPROC ClearDepth;
+    PFNGLSTENCILMASKPROC StencilMask;
+    PFNGLCOLORMASKPROC ColorMask;
+    PFNGLDEPTHMASKPROC DepthMask;
+    PFNGLDISABLEPROC Disable;
+    PFNGLENABLEPROC Enable;
+    PFNGLFINISHPROC Finish;
+    PFNGLFLUSHPROC Flush;
+    PFNGLBLENDFUNCPROC BlendFunc;
+    PFNGLLOGICOPPROC LogicOp;
+    PFNGLSTENCILFUNCPROC StencilFunc;
+    PFNGLSTENCILOPPROC StencilOp;
+    PFNGLDEPTHFUNCPROC DepthFunc;
+    PFNGLPIXELSTOREFPROC PixelStoref;
+    PFNGLPIXELSTOREIPROC PixelStorei;
+    PFNGLREADBUFFERPROC ReadBuffer;
+    PFNGLREADPIXELSPROC ReadPixels;
+    PFNGLGETBOOLEANVPROC GetBooleanv;
+    PFNGLGETDOUBLEVPROC GetDoublev;
+    PFNGLGETERRORPROC GetError;
+    PFNGLGETFLOATVPROC GetFloatv;
+    PFNGLGETINTEGERVPROC GetIntegerv;
+    PFNGLGETSTRINGPROC GetString;
+    PFNGLGETTEXIMAGEPROC GetTexImage;
+    PFNGLGETTEXPARAMETERFVPROC GetTexParameterfv;
+    PFNGLGETTEXPARAMETERIVPROC GetTexParameteriv;
+    PFNGLGETTEXLEVELPARAMETERFVPROC GetTexLevelParameterfv;
+    PFNGLGETTEXLEVELPARAMETERIVPROC GetTexLevelParameteriv;
+    PFNGLISENABLEDPROC IsEnabled;
+    PFNGLDEPTHRANGEPROC DepthRange;
+    PFNGLVIEWPORTPROC Viewport;
+    PFNGLDRAWARRAYSPROC DrawArrays;
+    PFNGLDRAWELEMENTSPROC DrawElements;
+    PFNGLPOLYGONOFFSETPROC PolygonOffset;
+    PFNGLCOPYTEXIMAGE1DPROC CopyTexImage1D;
+    PFNGLCOPYTEXIMAGE2DPROC CopyTexImage2D;
+    PFNGLCOPYTEXSUBIMAGE1DPROC CopyTexSubImage1D;
+    PFNGLCOPYTEXSUBIMAGE2DPROC CopyTexSubImage2D;
+    PFNGLTEXSUBIMAGE1DPROC TexSubImage1D;
+    PFNGLTEXSUBIMAGE2DPROC TexSubImage2D;
+    PFNGLBINDTEXTUREPROC BindTexture;
+    PFNGLDELETETEXTURESPROC DeleteTextures;
+    PFNGLGENTEXTURESPROC GenTextures;
+    PFNGLISTEXTUREPROC IsTexture;
+    PFNGLDRAWRANGEELEMENTSPROC DrawRangeElements;
+    PFNGLTEXIMAGE3DPROC TexImage3D;
+    PFNGLTEXSUBIMAGE3DPROC TexSubImage3D;
+    PFNGLCOPYTEXSUBIMAGE3DPROC CopyTexSubImage3D;
+    PFNGLACTIVETEXTUREPROC ActiveTexture;
+    PFNGLSAMPLECOVERAGEPROC SampleCoverage;
+    PFNGLCOMPRESSEDTEXIMAGE3DPROC CompressedTexImage3D;
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC CompressedTexImage2D;
+    PFNGLCOMPRESSEDTEXIMAGE1DPROC CompressedTexImage1D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC CompressedTexSubImage3D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC CompressedTexSubImage2D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC CompressedTexSubImage1D;
+    PFNGLGETCOMPRESSEDTEXIMAGEPROC GetCompressedTexImage;
+    PFNGLBLENDFUNCSEPARATEPROC BlendFuncSeparate;
+    PFNGLMULTIDRAWARRAYSPROC MultiDrawArrays;
+    PFNGLMULTIDRAWELEMENTSPROC MultiDrawElements;
+    PFNGLPOINTPARAMETERFPROC PointParameterf;
+    PFNGLPOINTPARAMETERFVPROC PointParameterfv;
+    PFNGLPOINTPARAMETERIPROC PointParameteri;
+    PFNGLPOINTPARAMETERIVPROC PointParameteriv;
+    PFNGLBLENDCOLORPROC BlendColor;
+    PFNGLBLENDEQUATIONPROC BlendEquation;
+    PFNGLGENQUERIESPROC GenQueries;
+    PFNGLDELETEQUERIESPROC DeleteQueries;
+    PFNGLISQUERYPROC IsQuery;
+    PFNGLBEGINQUERYPROC BeginQuery;
+    PFNGLENDQUERYPROC EndQuery;
+    PFNGLGETQUERYIVPROC GetQueryiv;
+    PFNGLGETQUERYOBJECTIVPROC GetQueryObjectiv;
+    PFNGLGETQUERYOBJECTUIVPROC GetQueryObjectuiv;
+    PFNGLBINDBUFFERPROC BindBuffer;
+    PFNGLDELETEBUFFERSPROC DeleteBuffers;
+    PFNGLGENBUFFERSPROC GenBuffers;
+    PFNGLISBUFFERPROC IsBuffer;
+    PFNGLBUFFERDATAPROC BufferData;
+    PFNGLBUFFERSUBDATAPROC BufferSubData;
+    PFNGLGETBUFFERSUBDATAPROC GetBufferSubData;
+    PFNGLMAPBUFFERPROC MapBuffer;
+    PFNGLUNMAPBUFFERPROC UnmapBuffer;
+    PFNGLGETBUFFERPARAMETERIVPROC GetBufferParameteriv;
+    PFNGLGETBUFFERPOINTERVPROC GetBufferPointerv;
+    PFNGLBLENDEQUATIONSEPARATEPROC BlendEquationSeparate;
+    PFNGLDRAWBUFFERSPROC DrawBuffers;
+    PFNGLSTENCILOPSEPARATEPROC StencilOpSeparate;
+    PFNGLSTENCILFUNCSEPARATEPROC StencilFuncSeparate;
+    PFNGLSTENCILMASKSEPARATEPROC StencilMaskSeparate;
+    PFNGLATTACHSHADERPROC AttachShader;
+    PFNGLBINDATTRIBLOCATIONPROC BindAttribLocation;
+    PFNGLCOMPILESHADERPROC CompileShader;
+    PFNGLCREATEPROGRAMPROC CreateProgram;
+    PFNGLCREATESHADERPROC CreateShader;
+    PFNGLDELETEPROGRAMPROC DeleteProgram;
+    PFNGLDELETESHADERPROC DeleteShader;
+    PFNGLDETACHSHADERPROC DetachShader;
+    PFNGLDISABLEVERTEXATTRIBARRAYPROC DisableVertexAttribArray;
+    PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+    PFNGLGETACTIVEATTRIBPROC GetActiveAttrib;
+    PFNGLGETACTIVEUNIFORMPROC GetActiveUniform;
+    PFNGLGETATTACHEDSHADERSPROC GetAttachedShaders;
+    PFNGLGETATTRIBLOCATIONPROC GetAttribLocation;
+    PFNGLGETPROGRAMIVPROC GetProgramiv;
+    PFNGLGETPROGRAMINFOLOGPROC GetProgramInfoLog;
+    PFNGLGETSHADERIVPROC GetShaderiv;
+    PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog;
+    PFNGLGETSHADERSOURCEPROC GetShaderSource;
+    PFNGLGETUNIFORMLOCATIONPROC GetUniformLocation;
+    PFNGLGETUNIFORMFVPROC GetUniformfv;
+    PFNGLGETUNIFORMIVPROC GetUniformiv;
+    PFNGLGETVERTEXATTRIBDVPROC GetVertexAttribdv;
+    PFNGLGETVERTEXATTRIBFVPROC GetVertexAttribfv;
+    PFNGLGETVERTEXATTRIBIVPROC GetVertexAttribiv;
+    PFNGLGETVERTEXATTRIBPOINTERVPROC GetVertexAttribPointerv;
+    PFNGLISPROGRAMPROC IsProgram;
+    PFNGLISSHADERPROC IsShader;
+    PFNGLLINKPROGRAMPROC LinkProgram;
+    PFNGLSHADERSOURCEPROC ShaderSource;
+    PFNGLUSEPROGRAMPROC UseProgram;
+    PFNGLUNIFORM1FPROC Uniform1f;
+    PFNGLUNIFORM2FPROC Uniform2f;
+    PFNGLUNIFORM3FPROC Uniform3f;
+    PFNGLUNIFORM4FPROC Uniform4f;
+    PFNGLUNIFORM1IPROC Uniform1i;
+    PFNGLUNIFORM2IPROC Uniform2i;
+    PFNGLUNIFORM3IPROC Uniform3i;
+    PFNGLUNIFORM4IPROC Uniform4i;
+    PFNGLUNIFORM1FVPROC Uniform1fv;
+    PFNGLUNIFORM2FVPROC Uniform2fv;
+    PFNGLUNIFORM3FVPROC Uniform3fv;
+    PFNGLUNIFORM4FVPROC Uniform4fv;
+    PFNGLUNIFORM1IVPROC Uniform1iv;
+    PFNGLUNIFORM2IVPROC Uniform2iv;
+    PFNGLUNIFORM3IVPROC Uniform3iv;
+    PFNGLUNIFORM4IVPROC Uniform4iv;
+    PFNGLUNIFORMMATRIX2FVPROC UniformMatrix2fv;
+    PFNGLUNIFORMMATRIX3FVPROC UniformMatrix3fv;
+    PFNGLUNIFORMMATRIX4FVPROC UniformMatrix4fv;
+    PFNGLVALIDATEPROGRAMPROC ValidateProgram;
+    PFNGLVERTEXATTRIB1DPROC VertexAttrib1d;
+    PFNGLVERTEXATTRIB1DVPROC VertexAttrib1dv;
+    PFNGLVERTEXATTRIB1FPROC VertexAttrib1f;
+    PFNGLVERTEXATTRIB1FVPROC VertexAttrib1fv;
+    PFNGLVERTEXATTRIB1SPROC VertexAttrib1s;
+    PFNGLVERTEXATTRIB1SVPROC VertexAttrib1sv;
+    PFNGLVERTEXATTRIB2DPROC VertexAttrib2d;
+    PFNGLVERTEXATTRIB2DVPROC VertexAttrib2dv;
+    PFNGLVERTEXATTRIB2FPROC VertexAttrib2f;
+    PFNGLVERTEXATTRIB2FVPROC VertexAttrib2fv;
+    PFNGLVERTEXATTRIB2SPROC VertexAttrib2s;
+    PFNGLVERTEXATTRIB2SVPROC VertexAttrib2sv;
+    PFNGLVERTEXATTRIB3DPROC VertexAttrib3d;
+    PFNGLVERTEXATTRIB3DVPROC VertexAttrib3dv;
+    PFNGLVERTEXATTRIB3FPROC VertexAttrib3f;
+    PFNGLVERTEXATTRIB3FVPROC VertexAttrib3fv;
+    PFNGLVERTEXATTRIB3SPROC VertexAttrib3s;
+    PFNGLVERTEXATTRIB3SVPROC VertexAttrib3sv;
+    PFNGLVERTEXATTRIB4NBVPROC VertexAttrib4Nbv;
+    PFNGLVERTEXATTRIB4NIVPROC VertexAttrib4Niv;
+    PFNGLVERTEXATTRIB4NSVPROC VertexAttrib4Nsv;
+    PFNGLVERTEXATTRIB4NUBPROC VertexAttrib4Nub;
+    PFNGLVERTEXATTRIB4NUBVPROC VertexAttrib4Nubv;
+    PFNGLVERTEXATTRIB4NUIVPROC VertexAttrib4Nuiv;
+    PFNGLVERTEXATTRIB4NUSVPROC VertexAttrib4Nusv;
+    PFNGLVERTEXATTRIB4BVPROC VertexAttrib4bv;
+    PFNGLVERTEXATTRIB4DPROC VertexAttrib4d;
+    PFNGLVERTEXATTRIB4DVPROC VertexAttrib4dv;
+    PFNGLVERTEXATTRIB4FPROC VertexAttrib4f;
+    PFNGLVERTEXATTRIB4FVPROC VertexAttrib4fv;
+    PFNGLVERTEXATTRIB4IVPROC VertexAttrib4iv;
+    PFNGLVERTEXATTRIB4SPROC VertexAttrib4s;
+    PFNGLVERTEXATTRIB4SVPROC VertexAttrib4sv;
+    PFNGLVERTEXATTRIB4UBVPROC VertexAttrib4ubv;
+    PFNGLVERTEXATTRIB4UIVPROC VertexAttrib4uiv;
+    PFNGLVERTEXATTRIB4USVPROC VertexAttrib4usv;
+    PFNGLVERTEXATTRIBPOINTERPROC VertexAttribPointer;
+    PFNGLUNIFORMMATRIX2X3FVPROC UniformMatrix2x3fv;
+    PFNGLUNIFORMMATRIX3X2FVPROC UniformMatrix3x2fv;
+    PFNGLUNIFORMMATRIX2X4FVPROC UniformMatrix2x4fv;
+    PFNGLUNIFORMMATRIX4X2FVPROC UniformMatrix4x2fv;
+    PFNGLUNIFORMMATRIX3X4FVPROC UniformMatrix3x4fv;
+    PFNGLUNIFORMMATRIX4X3FVPROC UniformMatrix4x3fv;
+    PFNGLCOLORMASKIPROC ColorMaski;
+    PFNGLGETBOOLEANI_VPROC GetBooleani_v;
+    PFNGLGETINTEGERI_VPROC GetIntegeri_v;
+    PFNGLENABLEIPROC Enablei;
+    PFNGLDISABLEIPROC Disablei;
+    PFNGLISENABLEDIPROC IsEnabledi;
+    PFNGLBEGINTRANSFORMFEEDBACKPROC BeginTransformFeedback;
+    PFNGLENDTRANSFORMFEEDBACKPROC EndTransformFeedback;
+    PFNGLBINDBUFFERRANGEPROC BindBufferRange;
+    PFNGLBINDBUFFERBASEPROC BindBufferBase;
+    PFNGLTRANSFORMFEEDBACKVARYINGSPROC TransformFeedbackVaryings;
+    PFNGLGETTRANSFORMFEEDBACKVARYINGPROC GetTransformFeedbackVarying;
+    PFNGLCLAMPCOLORPROC ClampColor;
+    PFNGLBEGINCONDITIONALRENDERPROC BeginConditionalRender;
+    PFNGLENDCONDITIONALRENDERPROC EndConditionalRender;
+    PFNGLVERTEXATTRIBIPOINTERPROC VertexAttribIPointer;
+    PFNGLGETVERTEXATTRIBIIVPROC GetVertexAttribIiv;
+    PFNGLGETVERTEXATTRIBIUIVPROC GetVertexAttribIuiv;
+    PFNGLVERTEXATTRIBI1IPROC VertexAttribI1i;
+    PFNGLVERTEXATTRIBI2IPROC VertexAttribI2i;
+    PFNGLVERTEXATTRIBI3IPROC VertexAttribI3i;
+    PFNGLVERTEXATTRIBI4IPROC VertexAttribI4i;
+    PFNGLVERTEXATTRIBI1UIPROC VertexAttribI1ui;
+    PFNGLVERTEXATTRIBI2UIPROC VertexAttribI2ui;
+    PFNGLVERTEXATTRIBI3UIPROC VertexAttribI3ui;
+    PFNGLVERTEXATTRIBI4UIPROC VertexAttribI4ui;
+    PFNGLVERTEXATTRIBI1IVPROC VertexAttribI1iv;
+    PFNGLVERTEXATTRIBI2IVPROC VertexAttribI2iv;
+    PFNGLVERTEXATTRIBI3IVPROC VertexAttribI3iv;
+    PFNGLVERTEXATTRIBI4IVPROC VertexAttribI4iv;
+    PFNGLVERTEXATTRIBI1UIVPROC VertexAttribI1uiv;
+    PFNGLVERTEXATTRIBI2UIVPROC VertexAttribI2uiv;
+    PFNGLVERTEXATTRIBI3UIVPROC VertexAttribI3uiv;
+    PFNGLVERTEXATTRIBI4UIVPROC VertexAttribI4uiv;
+    PFNGLVERTEXATTRIBI4BVPROC VertexAttribI4bv;
+    PFNGLVERTEXATTRIBI4SVPROC VertexAttribI4sv;
+    PFNGLVERTEXATTRIBI4UBVPROC VertexAttribI4ubv;
+    PFNGLVERTEXATTRIBI4USVPROC VertexAttribI4usv;
+    PFNGLGETUNIFORMUIVPROC GetUniformuiv;
+    PFNGLBINDFRAGDATALOCATIONPROC BindFragDataLocation;
+    PFNGLGETFRAGDATALOCATIONPROC GetFragDataLocation;
+    PFNGLUNIFORM1UIPROC Uniform1ui;
+    PFNGLUNIFORM2UIPROC Uniform2ui;
+    PFNGLUNIFORM3UIPROC Uniform3ui;
+    PFNGLUNIFORM4UIPROC Uniform4ui;
+    PFNGLUNIFORM1UIVPROC Uniform1uiv;
+    PFNGLUNIFORM2UIVPROC Uniform2uiv;
+    PFNGLUNIFORM3UIVPROC Uniform3uiv;
+    PFNGLUNIFORM4UIVPROC Uniform4uiv;
+    PFNGLTEXPARAMETERIIVPROC TexParameterIiv;
+    PFNGLTEXPARAMETERIUIVPROC TexParameterIuiv;
+    PFNGLGETTEXPARAMETERIIVPROC GetTexParameterIiv;
+    PFNGLGETTEXPARAMETERIUIVPROC GetTexParameterIuiv;
+    PFNGLCLEARBUFFERIVPROC ClearBufferiv;
+    PFNGLCLEARBUFFERUIVPROC ClearBufferuiv;
+    PFNGLCLEARBUFFERFVPROC ClearBufferfv;
+    PFNGLCLEARBUFFERFIPROC ClearBufferfi;
+    PFNGLGETSTRINGIPROC GetStringi;
+    PFNGLISRENDERBUFFERPROC IsRenderbuffer;
+    PFNGLBINDRENDERBUFFERPROC BindRenderbuffer;
+    PFNGLDELETERENDERBUFFERSPROC DeleteRenderbuffers;
+    PFNGLGENRENDERBUFFERSPROC GenRenderbuffers;
+    PFNGLRENDERBUFFERSTORAGEPROC RenderbufferStorage;
+    PFNGLGETRENDERBUFFERPARAMETERIVPROC GetRenderbufferParameteriv;
+    PFNGLISFRAMEBUFFERPROC IsFramebuffer;
+    PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+    PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers;
+    PFNGLGENFRAMEBUFFERSPROC GenFramebuffers;
+    PFNGLCHECKFRAMEBUFFERSTATUSPROC CheckFramebufferStatus;
+    PFNGLFRAMEBUFFERTEXTURE1DPROC FramebufferTexture1D;
+    PFNGLFRAMEBUFFERTEXTURE2DPROC FramebufferTexture2D;
+    PFNGLFRAMEBUFFERTEXTURE3DPROC FramebufferTexture3D;
+    PFNGLFRAMEBUFFERRENDERBUFFERPROC FramebufferRenderbuffer;
+    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetFramebufferAttachmentParameteriv;
+    PFNGLGENERATEMIPMAPPROC GenerateMipmap;
+    PFNGLBLITFRAMEBUFFERPROC BlitFramebuffer;
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC RenderbufferStorageMultisample;
+    PFNGLFRAMEBUFFERTEXTURELAYERPROC FramebufferTextureLayer;
+    PFNGLMAPBUFFERRANGEPROC MapBufferRange;
+    PFNGLFLUSHMAPPEDBUFFERRANGEPROC FlushMappedBufferRange;
+    PFNGLBINDVERTEXARRAYPROC BindVertexArray;
+    PFNGLDELETEVERTEXARRAYSPROC DeleteVertexArrays;
+    PFNGLGENVERTEXARRAYSPROC GenVertexArrays;
+    PFNGLISVERTEXARRAYPROC IsVertexArray;
+    PFNGLDRAWARRAYSINSTANCEDPROC DrawArraysInstanced;
+    PFNGLDRAWELEMENTSINSTANCEDPROC DrawElementsInstanced;
+    PFNGLTEXBUFFERPROC TexBuffer;
+    PFNGLPRIMITIVERESTARTINDEXPROC PrimitiveRestartIndex;
+    PFNGLCOPYBUFFERSUBDATAPROC CopyBufferSubData;
+    PFNGLGETUNIFORMINDICESPROC GetUniformIndices;
+    PFNGLGETACTIVEUNIFORMSIVPROC GetActiveUniformsiv;
+    PFNGLGETACTIVEUNIFORMNAMEPROC GetActiveUniformName;
+    PFNGLGETUNIFORMBLOCKINDEXPROC GetUniformBlockIndex;
+    PFNGLGETACTIVEUNIFORMBLOCKIVPROC GetActiveUniformBlockiv;
+    PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC GetActiveUniformBlockName;
+    PFNGLUNIFORMBLOCKBINDINGPROC UniformBlockBinding;
+    PFNGLDRAWELEMENTSBASEVERTEXPROC DrawElementsBaseVertex;
+    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC DrawRangeElementsBaseVertex;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC DrawElementsInstancedBaseVertex;
+    PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC MultiDrawElementsBaseVertex;
+    PFNGLPROVOKINGVERTEXPROC ProvokingVertex;
+    PFNGLFENCESYNCPROC FenceSync;
+    PFNGLISSYNCPROC IsSync;
+    PFNGLDELETESYNCPROC DeleteSync;
+    PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+    PFNGLWAITSYNCPROC WaitSync;
+    PFNGLGETINTEGER64VPROC GetInteger64v;
+    PFNGLGETSYNCIVPROC GetSynciv;
+    PFNGLGETINTEGER64I_VPROC GetInteger64i_v;
+    PFNGLGETBUFFERPARAMETERI64VPROC GetBufferParameteri64v;
+    PFNGLFRAMEBUFFERTEXTUREPROC FramebufferTexture;
+    PFNGLTEXIMAGE2DMULTISAMPLEPROC TexImage2DMultisample;
+    PFNGLTEXIMAGE3DMULTISAMPLEPROC TexImage3DMultisample;
+    PFNGLGETMULTISAMPLEFVPROC GetMultisamplefv;
+    PFNGLSAMPLEMASKIPROC SampleMaski;
+    PFNGLBINDFRAGDATALOCATIONINDEXEDPROC BindFragDataLocationIndexed;
+    PFNGLGETFRAGDATAINDEXPROC GetFragDataIndex;
+    PFNGLGENSAMPLERSPROC GenSamplers;
+    PFNGLDELETESAMPLERSPROC DeleteSamplers;
+    PFNGLISSAMPLERPROC IsSampler;
+    PFNGLBINDSAMPLERPROC BindSampler;
+    PFNGLSAMPLERPARAMETERIPROC SamplerParameteri;
+    PFNGLSAMPLERPARAMETERIVPROC SamplerParameteriv;
+    PFNGLSAMPLERPARAMETERFPROC SamplerParameterf;
+    PFNGLSAMPLERPARAMETERFVPROC SamplerParameterfv;
+    PFNGLSAMPLERPARAMETERIIVPROC SamplerParameterIiv;
+    PFNGLSAMPLERPARAMETERIUIVPROC SamplerParameterIuiv;
+    PFNGLGETSAMPLERPARAMETERIVPROC GetSamplerParameteriv;
+    PFNGLGETSAMPLERPARAMETERIIVPROC GetSamplerParameterIiv;
+    PFNGLGETSAMPLERPARAMETERFVPROC GetSamplerParameterfv;
+    PFNGLGETSAMPLERPARAMETERIUIVPROC GetSamplerParameterIuiv;
+    PFNGLQUERYCOUNTERPROC QueryCounter;
+    PFNGLGETQUERYOBJECTI64VPROC GetQueryObjecti64v;
+    PFNGLGETQUERYOBJECTUI64VPROC GetQueryObjectui64v;
+    PFNGLVERTEXATTRIBDIVISORPROC VertexAttribDivisor;
+    PFNGLVERTEXATTRIBP1UIPROC VertexAttribP1ui;
+    PFNGLVERTEXATTRIBP1UIVPROC VertexAttribP1uiv;
+    PFNGLVERTEXATTRIBP2UIPROC VertexAttribP2ui;
+    PFNGLVERTEXATTRIBP2UIVPROC VertexAttribP2uiv;
+    PFNGLVERTEXATTRIBP3UIPROC VertexAttribP3ui;
+    PFNGLVERTEXATTRIBP3UIVPROC VertexAttribP3uiv;
+    PFNGLVERTEXATTRIBP4UIPROC VertexAttribP4ui;
+    PFNGLVERTEXATTRIBP4UIVPROC VertexAttribP4uiv;
+    PFNGLVERTEXP2UIPROC VertexP2ui;
+    PFNGLVERTEXP2UIVPROC VertexP2uiv;
+    PFNGLVERTEXP3UIPROC VertexP3ui;
+    PFNGLVERTEXP3UIVPROC VertexP3uiv;
+    PFNGLVERTEXP4UIPROC VertexP4ui;
+    PFNGLVERTEXP4UIVPROC VertexP4uiv;
+    PFNGLTEXCOORDP1UIPROC TexCoordP1ui;
+    PFNGLTEXCOORDP1UIVPROC TexCoordP1uiv;
+    PFNGLTEXCOORDP2UIPROC TexCoordP2ui;
+    PFNGLTEXCOORDP2UIVPROC TexCoordP2uiv;
+    PFNGLTEXCOORDP3UIPROC TexCoordP3ui;
+    PFNGLTEXCOORDP3UIVPROC TexCoordP3uiv;
+    PFNGLTEXCOORDP4UIPROC TexCoordP4ui;
+    PFNGLTEXCOORDP4UIVPROC TexCoordP4uiv;
+    PFNGLMULTITEXCOORDP1UIPROC MultiTexCoordP1ui;
+    PFNGLMULTITEXCOORDP1UIVPROC MultiTexCoordP1uiv;
+    PFNGLMULTITEXCOORDP2UIPROC MultiTexCoordP2ui;
+    PFNGLMULTITEXCOORDP2UIVPROC MultiTexCoordP2uiv;
+    PFNGLMULTITEXCOORDP3UIPROC MultiTexCoordP3ui;
+    PFNGLMULTITEXCOORDP3UIVPROC MultiTexCoordP3uiv;
+    PFNGLMULTITEXCOORDP4UIPROC MultiTexCoordP4ui;
+    PFNGLMULTITEXCOORDP4UIVPROC MultiTexCoordP4uiv;
+    PFNGLNORMALP3UIPROC NormalP3ui;
+    PFNGLNORMALP3UIVPROC NormalP3uiv;
+    PFNGLCOLORP3UIPROC ColorP3ui;
+    PFNGLCOLORP3UIVPROC ColorP3uiv;
+    PFNGLCOLORP4UIPROC ColorP4ui;
+    PFNGLCOLORP4UIVPROC ColorP4uiv;
+    PFNGLSECONDARYCOLORP3UIPROC SecondaryColorP3ui;
+    PFNGLSECONDARYCOLORP3UIVPROC SecondaryColorP3uiv;
+} GladGLContext;
+GLAPI int gladLoadGLContext(GladGLContext *context, GLADloadproc load);
+GLAPI void gladSetGLContext(const GladGLContext *context);
+GLAPI const GladGLContext *gladGetGLContext(void);
+GLAPI void *gladGLContextFunction(size_t offset, void *global);
+GLAPI int glad_gl_multiple_tables;
+#ifdef GLAD_MX
+/* Read on every call from every thread while another thread may load a table: a relaxed atomic load,
+   which is a plain load on x86 and ARM */
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define GLAD_GL_MULTIPLE_TABLES() __iso_volatile_load32((const volatile __int32 *)&glad_gl_multiple_tables)
+#else
+#define GLAD_GL_MULTIPLE_TABLES() __atomic_load_n(&glad_gl_multiple_tables, __ATOMIC_RELAXED)
+#endif
+#define GLAD_GL_FUNCTION(type, member, global) (GLAD_GL_MULTIPLE_TABLES() ? (type)gladGLContextFunction(offsetof(GladGLContext, member), (void*)(global)) : (global))
+#undef glCullFace
+#define glCullFace GLAD_GL_FUNCTION(PFNGLCULLFACEPROC, CullFace, glad_glCullFace)
+#undef glFrontFace
+#define glFrontFace GLAD_GL_FUNCTION(PFNGLFRONTFACEPROC, FrontFace, glad_glFrontFace)
+#undef glHint
+#define glHint GLAD_GL_FUNCTION(PFNGLHINTPROC, Hint, glad_glHint)
+#undef glLineWidth
+#define glLineWidth GLAD_GL_FUNCTION(PFNGLLINEWIDTHPROC, LineWidth, glad_glLineWidth)
+#undef glPointSize
+#define glPointSize GLAD_GL_FUNCTION(PFNGLPOINTSIZEPROC, PointSize, glad_glPointSize)
+#undef glPolygonMode
+#define glPolygonMode GLAD_GL_FUNCTION(PFNGLPOLYGONMODEPROC, PolygonMode, glad_glPolygonMode)
+#undef glScissor
+#define glScissor GLAD_GL_FUNCTION(PFNGLSCISSORPROC, Scissor, glad_glScissor)
+#undef glTexParameterf
+#define glTexParameterf GLAD_GL_FUNCTION(PFNGLTEXPARAMETERFPROC, TexParameterf, glad_glTexParameterf)
+#undef glTexParameterfv
+#define glTexParameterfv GLAD_GL_FUNCTION(PFNGLTEXPARAMETERFVPROC, TexParameterfv, glad_glTexParameterfv)
+#undef glTexParameteri
+#define glTexParameteri GLAD_GL_FUNCTION(PFNGLTEXPARAMETERIPROC, TexParameteri, glad_glTexParameteri)
+#undef glTexParameteriv
+#define glTexParameteriv GLAD_GL_FUNCTION(PFNGLTEXPARAMETERIVPROC, TexParameteriv, glad_glTexParameteriv)
+#undef glTexImage1D
+#define glTexImage1D GLAD_GL_FUNCTION(PFNGLTEXIMAGE1DPROC, TexImage1D, glad_glTexImage1D)
+#undef glTexImage2D
+#define glTexImage2D GLAD_GL_FUNCTION(PFNGLTEXIMAGE2DPROC, TexImage2D, glad_glTexImage2D)
+#undef glDrawBuffer
+#define glDrawBuffer GLAD_GL_FUNCTION(PFNGLDRAWBUFFERPROC, DrawBuffer, glad_glDrawBuffer)
+#undef glClear
+#define glClear GLAD_GL_FUNCTION(PFNGLCLEARPROC, Clear, glad_glClear)
+#undef glClearColor
+#define glClearColor GLAD_GL_FUNCTION(PFNGLCLEARCOLORPROC, ClearColor, glad_glClearColor)
+#undef glClearStencil
+#define glClearStencil GLAD_GL_FUNCTION(PFNGLCLEARSTENCILPROC, ClearStencil, glad_glClearStencil)
+#undef glClearDepth
+#define glClearDepth GLAD_GL_FUNCTION(PFNGLCLEARDEPTHPROC, ClearDepth, glad_glClearDepth)
+#undef glStencilMask
+#define glStencilMask GLAD_GL_FUNCTION(PFNGLSTENCILMASKPROC, StencilMask, glad_glStencilMask)
+#undef glColorMask
+#define glColorMask GLAD_GL_FUNCTION(PFNGLCOLORMASKPROC, ColorMask, glad_glColorMask)
+#undef glDepthMask
+#define glDepthMask GLAD_GL_FUNCTION(PFNGLDEPTHMASKPROC, DepthMask, glad_glDepthMask)
+#undef glDisable
+#define glDisable GLAD_GL_FUNCTION(PFNGLDISABLEPROC, Disable, glad_glDisable)
+#undef glEnable
+#define glEnable GLAD_GL_FUNCTION(PFNGLENABLEPROC, Enable, glad_glEnable)
+#undef glFinish
+#define glFinish GLAD_GL_FUNCTION(PFNGLFINISHPROC, Finish, glad_glFinish)
+#undef glFlush
+#define glFlush GLAD_GL_FUNCTION(PFNGLFLUSHPROC, Flush, glad_glFlush)
+#undef glBlendFunc
+#define glBlendFunc GLAD_GL_FUNCTION(PFNGLBLENDFUNCPROC, BlendFunc, glad_glBlendFunc)
+#undef glLogicOp
+#define glLogicOp GLAD_GL_FUNCTION(PFNGLLOGICOPPROC, LogicOp, glad_glLogicOp)
+#undef glStencilFunc
+#define glStencilFunc GLAD_GL_FUNCTION(PFNGLSTENCILFUNCPROC, StencilFunc, glad_glStencilFunc)
+#undef glStencilOp
+#define glStencilOp GLAD_GL_FUNCTION(PFNGLSTENCILOPPROC, StencilOp, glad_glStencilOp)
+#undef glDepthFunc
+#define glDepthFunc GLAD_GL_FUNCTION(PFNGLDEPTHFUNCPROC, DepthFunc, glad_glDepthFunc)
+#undef glPixelStoref
+#define glPixelStoref GLAD_GL_FUNCTION(PFNGLPIXELSTOREFPROC, PixelStoref, glad_glPixelStoref)
+#undef glPixelStorei
+#define glPixelStorei GLAD_GL_FUNCTION(PFNGLPIXELSTOREIPROC, PixelStorei, glad_glPixelStorei)
+#undef glReadBuffer
+#define glReadBuffer GLAD_GL_FUNCTION(PFNGLREADBUFFERPROC, ReadBuffer, glad_glReadBuffer)
+#undef glReadPixels
+#define glReadPixels GLAD_GL_FUNCTION(PFNGLREADPIXELSPROC, ReadPixels, glad_glReadPixels)
+#undef glGetBooleanv
+#define glGetBooleanv GLAD_GL_FUNCTION(PFNGLGETBOOLEANVPROC, GetBooleanv, glad_glGetBooleanv)
+#undef glGetDoublev
+#define glGetDoublev GLAD_GL_FUNCTION(PFNGLGETDOUBLEVPROC, GetDoublev, glad_glGetDoublev)
+#undef glGetError
+#define glGetError GLAD_GL_FUNCTION(PFNGLGETERRORPROC, GetError, glad_glGetError)
+#undef glGetFloatv
+#define glGetFloatv GLAD_GL_FUNCTION(PFNGLGETFLOATVPROC, GetFloatv, glad_glGetFloatv)
+#undef glGetIntegerv
+#define glGetIntegerv GLAD_GL_FUNCTION(PFNGLGETINTEGERVPROC, GetIntegerv, glad_glGetIntegerv)
+#undef glGetString
+#define glGetString GLAD_GL_FUNCTION(PFNGLGETSTRINGPROC, GetString, glad_glGetString)
+#undef glGetTexImage
+#define glGetTexImage GLAD_GL_FUNCTION(PFNGLGETTEXIMAGEPROC, GetTexImage, glad_glGetTexImage)
+#undef glGetTexParameterfv
+#define glGetTexParameterfv GLAD_GL_FUNCTION(PFNGLGETTEXPARAMETERFVPROC, GetTexParameterfv, glad_glGetTexParameterfv)
+#undef glGetTexParameteriv
+#define glGetTexParameteriv GLAD_GL_FUNCTION(PFNGLGETTEXPARAMETERIVPROC, GetTexParameteriv, glad_glGetTexParameteriv)
+#undef glGetTexLevelParameterfv
+#define glGetTexLevelParameterfv GLAD_GL_FUNCTION(PFNGLGETTEXLEVELPARAMETERFVPROC, GetTexLevelParameterfv, glad_glGetTexLevelParameterfv)
+#undef glGetTexLevelParameteriv
+#define glGetTexLevelParameteriv GLAD_GL_FUNCTION(PFNGLGETTEXLEVELPARAMETERIVPROC, GetTexLevelParameteriv, glad_glGetTexLevelParameteriv)
+#undef glIsEnabled
+#define glIsEnabled GLAD_GL_FUNCTION(PFNGLISENABLEDPROC, IsEnabled, glad_glIsEnabled)
+#undef glDepthRange
+#define glDepthRange GLAD_GL_FUNCTION(PFNGLDEPTHRANGEPROC, DepthRange, glad_glDepthRange)
+#undef glViewport
+#define glViewport GLAD_GL_FUNCTION(PFNGLVIEWPORTPROC, Viewport, glad_glViewport)
+#undef glDrawArrays
+#define glDrawArrays GLAD_GL_FUNCTION(PFNGLDRAWARRAYSPROC, DrawArrays, glad_glDrawArrays)
+#undef glDrawElements
+#define glDrawElements GLAD_GL_FUNCTION(PFNGLDRAWELEMENTSPROC, DrawElements, glad_glDrawElements)
+#undef glPolygonOffset
+#define glPolygonOffset GLAD_GL_FUNCTION(PFNGLPOLYGONOFFSETPROC, PolygonOffset, glad_glPolygonOffset)
+#undef glCopyTexImage1D
+#define glCopyTexImage1D GLAD_GL_FUNCTION(PFNGLCOPYTEXIMAGE1DPROC, CopyTexImage1D, glad_glCopyTexImage1D)
+#undef glCopyTexImage2D
+#define glCopyTexImage2D GLAD_GL_FUNCTION(PFNGLCOPYTEXIMAGE2DPROC, CopyTexImage2D, glad_glCopyTexImage2D)
+#undef glCopyTexSubImage1D
+#define glCopyTexSubImage1D GLAD_GL_FUNCTION(PFNGLCOPYTEXSUBIMAGE1DPROC, CopyTexSubImage1D, glad_glCopyTexSubImage1D)
+#undef glCopyTexSubImage2D
+#define glCopyTexSubImage2D GLAD_GL_FUNCTION(PFNGLCOPYTEXSUBIMAGE2DPROC, CopyTexSubImage2D, glad_glCopyTexSubImage2D)
+#undef glTexSubImage1D
+#define glTexSubImage1D GLAD_GL_FUNCTION(PFNGLTEXSUBIMAGE1DPROC, TexSubImage1D, glad_glTexSubImage1D)
+#undef glTexSubImage2D
+#define glTexSubImage2D GLAD_GL_FUNCTION(PFNGLTEXSUBIMAGE2DPROC, TexSubImage2D, glad_glTexSubImage2D)
+#undef glBindTexture
+#define glBindTexture GLAD_GL_FUNCTION(PFNGLBINDTEXTUREPROC, BindTexture, glad_glBindTexture)
+#undef glDeleteTextures
+#define glDeleteTextures GLAD_GL_FUNCTION(PFNGLDELETETEXTURESPROC, DeleteTextures, glad_glDeleteTextures)
+#undef glGenTextures
+#define glGenTextures GLAD_GL_FUNCTION(PFNGLGENTEXTURESPROC, GenTextures, glad_glGenTextures)
+#undef glIsTexture
+#define glIsTexture GLAD_GL_FUNCTION(PFNGLISTEXTUREPROC, IsTexture, glad_glIsTexture)
+#undef glDrawRangeElements
+#define glDrawRangeElements GLAD_GL_FUNCTION(PFNGLDRAWRANGEELEMENTSPROC, DrawRangeElements, glad_glDrawRangeElements)
+#undef glTexImage3D
+#define glTexImage3D GLAD_GL_FUNCTION(PFNGLTEXIMAGE3DPROC, TexImage3D, glad_glTexImage3D)
+#undef glTexSubImage3D
+#define glTexSubImage3D GLAD_GL_FUNCTION(PFNGLTEXSUBIMAGE3DPROC, TexSubImage3D, glad_glTexSubImage3D)
+#undef glCopyTexSubImage3D
+#define glCopyTexSubImage3D GLAD_GL_FUNCTION(PFNGLCOPYTEXSUBIMAGE3DPROC, CopyTexSubImage3D, glad_glCopyTexSubImage3D)
+#undef glActiveTexture
+#define glActiveTexture GLAD_GL_FUNCTION(PFNGLACTIVETEXTUREPROC, ActiveTexture, glad_glActiveTexture)
+#undef glSampleCoverage
+#define glSampleCoverage GLAD_GL_FUNCTION(PFNGLSAMPLECOVERAGEPROC, SampleCoverage, glad_glSampleCoverage)
+#undef glCompressedTexImage3D
+#define glCompressedTexImage3D GLAD_GL_FUNCTION(PFNGLCOMPRESSEDTEXIMAGE3DPROC, CompressedTexImage3D, glad_glCompressedTexImage3D)
+#undef glCompressedTexImage2D
+#define glCompressedTexImage2D GLAD_GL_FUNCTION(PFNGLCOMPRESSEDTEXIMAGE2DPROC, CompressedTexImage2D, glad_glCompressedTexImage2D)
+#undef glCompressedTexImage1D
+#define glCompressedTexImage1D GLAD_GL_FUNCTION(PFNGLCOMPRESSEDTEXIMAGE1DPROC, CompressedTexImage1D, glad_glCompressedTexImage1D)
+#undef glCompressedTexSubImage3D
+#define glCompressedTexSubImage3D GLAD_GL_FUNCTION(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, CompressedTexSubImage3D, glad_glCompressedTexSubImage3D)
+#undef glCompressedTexSubImage2D
+#define glCompressedTexSubImage2D GLAD_GL_FUNCTION(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, CompressedTexSubImage2D, glad_glCompressedTexSubImage2D)
+#undef glCompressedTexSubImage1D
+#define glCompressedTexSubImage1D GLAD_GL_FUNCTION(PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, CompressedTexSubImage1D, glad_glCompressedTexSubImage1D)
+#undef glGetCompressedTexImage
+#define glGetCompressedTexImage GLAD_GL_FUNCTION(PFNGLGETCOMPRESSEDTEXIMAGEPROC, GetCompressedTexImage, glad_glGetCompressedTexImage)
+#undef glBlendFuncSeparate
+#define glBlendFuncSeparate GLAD_GL_FUNCTION(PFNGLBLENDFUNCSEPARATEPROC, BlendFuncSeparate, glad_glBlendFuncSeparate)
+#undef glMultiDrawArrays
+#define glMultiDrawArrays GLAD_GL_FUNCTION(PFNGLMULTIDRAWARRAYSPROC, MultiDrawArrays, glad_glMultiDrawArrays)
+#undef glMultiDrawElements
+#define glMultiDrawElements GLAD_GL_FUNCTION(PFNGLMULTIDRAWELEMENTSPROC, MultiDrawElements, glad_glMultiDrawElements)
+#undef glPointParameterf
+#define glPointParameterf GLAD_GL_FUNCTION(PFNGLPOINTPARAMETERFPROC, PointParameterf, glad_glPointParameterf)
+#undef glPointParameterfv
+#define glPointParameterfv GLAD_GL_FUNCTION(PFNGLPOINTPARAMETERFVPROC, PointParameterfv, glad_glPointParameterfv)
+#undef glPointParameteri
+#define glPointParameteri GLAD_GL_FUNCTION(PFNGLPOINTPARAMETERIPROC, PointParameteri, glad_glPointParameteri)
+#undef glPointParameteriv
+#define glPointParameteriv GLAD_GL_FUNCTION(PFNGLPOINTPARAMETERIVPROC, PointParameteriv, glad_glPointParameteriv)
+#undef glBlendColor
+#define glBlendColor GLAD_GL_FUNCTION(PFNGLBLENDCOLORPROC, BlendColor, glad_glBlendColor)
+#undef glBlendEquation
+#define glBlendEquation GLAD_GL_FUNCTION(PFNGLBLENDEQUATIONPROC, BlendEquation, glad_glBlendEquation)
+#undef glGenQueries
+#define glGenQueries GLAD_GL_FUNCTION(PFNGLGENQUERIESPROC, GenQueries, glad_glGenQueries)
+#undef glDeleteQueries
+#define glDeleteQueries GLAD_GL_FUNCTION(PFNGLDELETEQUERIESPROC, DeleteQueries, glad_glDeleteQueries)
+#undef glIsQuery
+#define glIsQuery GLAD_GL_FUNCTION(PFNGLISQUERYPROC, IsQuery, glad_glIsQuery)
+#undef glBeginQuery
+#define glBeginQuery GLAD_GL_FUNCTION(PFNGLBEGINQUERYPROC, BeginQuery, glad_glBeginQuery)
+#undef glEndQuery
+#define glEndQuery GLAD_GL_FUNCTION(PFNGLENDQUERYPROC, EndQuery, glad_glEndQuery)
+#undef glGetQueryiv
+#define glGetQueryiv GLAD_GL_FUNCTION(PFNGLGETQUERYIVPROC, GetQueryiv, glad_glGetQueryiv)
+#undef glGetQueryObjectiv
+#define glGetQueryObjectiv GLAD_GL_FUNCTION(PFNGLGETQUERYOBJECTIVPROC, GetQueryObjectiv, glad_glGetQueryObjectiv)
+#undef glGetQueryObjectuiv
+#define glGetQueryObjectuiv GLAD_GL_FUNCTION(PFNGLGETQUERYOBJECTUIVPROC, GetQueryObjectuiv, glad_glGetQueryObjectuiv)
+#undef glBindBuffer
+#define glBindBuffer GLAD_GL_FUNCTION(PFNGLBINDBUFFERPROC, BindBuffer, glad_glBindBuffer)
+#undef glDeleteBuffers
+#define glDeleteBuffers GLAD_GL_FUNCTION(PFNGLDELETEBUFFERSPROC, DeleteBuffers, glad_glDeleteBuffers)
+#undef glGenBuffers
+#define glGenBuffers GLAD_GL_FUNCTION(PFNGLGENBUFFERSPROC, GenBuffers, glad_glGenBuffers)
+#undef glIsBuffer
+#define glIsBuffer GLAD_GL_FUNCTION(PFNGLISBUFFERPROC, IsBuffer, glad_glIsBuffer)
+#undef glBufferData
+#define glBufferData GLAD_GL_FUNCTION(PFNGLBUFFERDATAPROC, BufferData, glad_glBufferData)
+#undef glBufferSubData
+#define glBufferSubData GLAD_GL_FUNCTION(PFNGLBUFFERSUBDATAPROC, BufferSubData, glad_glBufferSubData)
+#undef glGetBufferSubData
+#define glGetBufferSubData GLAD_GL_FUNCTION(PFNGLGETBUFFERSUBDATAPROC, GetBufferSubData, glad_glGetBufferSubData)
+#undef glMapBuffer
+#define glMapBuffer GLAD_GL_FUNCTION(PFNGLMAPBUFFERPROC, MapBuffer, glad_glMapBuffer)
+#undef glUnmapBuffer
+#define glUnmapBuffer GLAD_GL_FUNCTION(PFNGLUNMAPBUFFERPROC, UnmapBuffer, glad_glUnmapBuffer)
+#undef glGetBufferParameteriv
+#define glGetBufferParameteriv GLAD_GL_FUNCTION(PFNGLGETBUFFERPARAMETERIVPROC, GetBufferParameteriv, glad_glGetBufferParameteriv)
+#undef glGetBufferPointerv
+#define glGetBufferPointerv GLAD_GL_FUNCTION(PFNGLGETBUFFERPOINTERVPROC, GetBufferPointerv, glad_glGetBufferPointerv)
+#undef glBlendEquationSeparate
+#define glBlendEquationSeparate GLAD_GL_FUNCTION(PFNGLBLENDEQUATIONSEPARATEPROC, BlendEquationSeparate, glad_glBlendEquationSeparate)
+#undef glDrawBuffers
+#define glDrawBuffers GLAD_GL_FUNCTION(PFNGLDRAWBUFFERSPROC, DrawBuffers, glad_glDrawBuffers)
+#undef glStencilOpSeparate
+#define glStencilOpSeparate GLAD_GL_FUNCTION(PFNGLSTENCILOPSEPARATEPROC, StencilOpSeparate, glad_glStencilOpSeparate)
+#undef glStencilFuncSeparate
+#define glStencilFuncSeparate GLAD_GL_FUNCTION(PFNGLSTENCILFUNCSEPARATEPROC, StencilFuncSeparate, glad_glStencilFuncSeparate)
+#undef glStencilMaskSeparate
+#define glStencilMaskSeparate GLAD_GL_FUNCTION(PFNGLSTENCILMASKSEPARATEPROC, StencilMaskSeparate, glad_glStencilMaskSeparate)
+#undef glAttachShader
+#define glAttachShader GLAD_GL_FUNCTION(PFNGLATTACHSHADERPROC, AttachShader, glad_glAttachShader)
+#undef glBindAttribLocation
+#define glBindAttribLocation GLAD_GL_FUNCTION(PFNGLBINDATTRIBLOCATIONPROC, BindAttribLocation, glad_glBindAttribLocation)
+#undef glCompileShader
+#define glCompileShader GLAD_GL_FUNCTION(PFNGLCOMPILESHADERPROC, CompileShader, glad_glCompileShader)
+#undef glCreateProgram
+#define glCreateProgram GLAD_GL_FUNCTION(PFNGLCREATEPROGRAMPROC, CreateProgram, glad_glCreateProgram)
+#undef glCreateShader
+#define glCreateShader GLAD_GL_FUNCTION(PFNGLCREATESHADERPROC, CreateShader, glad_glCreateShader)
+#undef glDeleteProgram
+#define glDeleteProgram GLAD_GL_FUNCTION(PFNGLDELETEPROGRAMPROC, DeleteProgram, glad_glDeleteProgram)
+#undef glDeleteShader
+#define glDeleteShader GLAD_GL_FUNCTION(PFNGLDELETESHADERPROC, DeleteShader, glad_glDeleteShader)
+#undef glDetachShader
+#define glDetachShader GLAD_GL_FUNCTION(PFNGLDETACHSHADERPROC, DetachShader, glad_glDetachShader)
+#undef glDisableVertexAttribArray
+#define glDisableVertexAttribArray GLAD_GL_FUNCTION(PFNGLDISABLEVERTEXATTRIBARRAYPROC, DisableVertexAttribArray, glad_glDisableVertexAttribArray)
+#undef glEnableVertexAttribArray
+#define glEnableVertexAttribArray GLAD_GL_FUNCTION(PFNGLENABLEVERTEXATTRIBARRAYPROC, EnableVertexAttribArray, glad_glEnableVertexAttribArray)
+#undef glGetActiveAttrib
+#define glGetActiveAttrib GLAD_GL_FUNCTION(PFNGLGETACTIVEATTRIBPROC, GetActiveAttrib, glad_glGetActiveAttrib)
+#undef glGetActiveUniform
+#define glGetActiveUniform GLAD_GL_FUNCTION(PFNGLGETACTIVEUNIFORMPROC, GetActiveUniform, glad_glGetActiveUniform)
+#undef glGetAttachedShaders
+#define glGetAttachedShaders GLAD_GL_FUNCTION(PFNGLGETATTACHEDSHADERSPROC, GetAttachedShaders, glad_glGetAttachedShaders)
+#undef glGetAttribLocation
+#define glGetAttribLocation GLAD_GL_FUNCTION(PFNGLGETATTRIBLOCATIONPROC, GetAttribLocation, glad_glGetAttribLocation)
+#undef glGetProgramiv
+#define glGetProgramiv GLAD_GL_FUNCTION(PFNGLGETPROGRAMIVPROC, GetProgramiv, glad_glGetProgramiv)
+#undef glGetProgramInfoLog
+#define glGetProgramInfoLog GLAD_GL_FUNCTION(PFNGLGETPROGRAMINFOLOGPROC, GetProgramInfoLog, glad_glGetProgramInfoLog)
+#undef glGetShaderiv
+#define glGetShaderiv GLAD_GL_FUNCTION(PFNGLGETSHADERIVPROC, GetShaderiv, glad_glGetShaderiv)
+#undef glGetShaderInfoLog
+#define glGetShaderInfoLog GLAD_GL_FUNCTION(PFNGLGETSHADERINFOLOGPROC, GetShaderInfoLog, glad_glGetShaderInfoLog)
+#undef glGetShaderSource
+#define glGetShaderSource GLAD_GL_FUNCTION(PFNGLGETSHADERSOURCEPROC, GetShaderSource, glad_glGetShaderSource)
+#undef glGetUniformLocation
+#define glGetUniformLocation GLAD_GL_FUNCTION(PFNGLGETUNIFORMLOCATIONPROC, GetUniformLocation, glad_glGetUniformLocation)
+#undef glGetUniformfv
+#define glGetUniformfv GLAD_GL_FUNCTION(PFNGLGETUNIFORMFVPROC, GetUniformfv, glad_glGetUniformfv)
+#undef glGetUniformiv
+#define glGetUniformiv GLAD_GL_FUNCTION(PFNGLGETUNIFORMIVPROC, GetUniformiv, glad_glGetUniformiv)
+#undef glGetVertexAttribdv
+#define glGetVertexAttribdv GLAD_GL_FUNCTION(PFNGLGETVERTEXATTRIBDVPROC, GetVertexAttribdv, glad_glGetVertexAttribdv)
+#undef glGetVertexAttribfv
+#define glGetVertexAttribfv GLAD_GL_FUNCTION(PFNGLGETVERTEXATTRIBFVPROC, GetVertexAttribfv, glad_glGetVertexAttribfv)
+#undef glGetVertexAttribiv
+#define glGetVertexAttribiv GLAD_GL_FUNCTION(PFNGLGETVERTEXATTRIBIVPROC, GetVertexAttribiv, glad_glGetVertexAttribiv)
+#undef glGetVertexAttribPointerv
+#define glGetVertexAttribPointerv GLAD_GL_FUNCTION(PFNGLGETVERTEXATTRIBPOINTERVPROC, GetVertexAttribPointerv, glad_glGetVertexAttribPointerv)
+#undef glIsProgram
+#define glIsProgram GLAD_GL_FUNCTION(PFNGLISPROGRAMPROC, IsProgram, glad_glIsProgram)
+#undef glIsShader
+#define glIsShader GLAD_GL_FUNCTION(PFNGLISSHADERPROC, IsShader, glad_glIsShader)
+#undef glLinkProgram
+#define glLinkProgram GLAD_GL_FUNCTION(PFNGLLINKPROGRAMPROC, LinkProgram, glad_glLinkProgram)
+#undef glShaderSource
+#define glShaderSource GLAD_GL_FUNCTION(PFNGLSHADERSOURCEPROC, ShaderSource, glad_glShaderSource)
+#undef glUseProgram
+#define glUseProgram GLAD_GL_FUNCTION(PFNGLUSEPROGRAMPROC, UseProgram, glad_glUseProgram)
+#undef glUniform1f
+#define glUniform1f GLAD_GL_FUNCTION(PFNGLUNIFORM1FPROC, Uniform1f, glad_glUniform1f)
+#undef glUniform2f
+#define glUniform2f GLAD_GL_FUNCTION(PFNGLUNIFORM2FPROC, Uniform2f, glad_glUniform2f)
+#undef glUniform3f
+#define glUniform3f GLAD_GL_FUNCTION(PFNGLUNIFORM3FPROC, Uniform3f, glad_glUniform3f)
+#undef glUniform4f
+#define glUniform4f GLAD_GL_FUNCTION(PFNGLUNIFORM4FPROC, Uniform4f, glad_glUniform4f)
+#undef glUniform1i
+#define glUniform1i GLAD_GL_FUNCTION(PFNGLUNIFORM1IPROC, Uniform1i, glad_glUniform1i)
+#undef glUniform2i
+#define glUniform2i GLAD_GL_FUNCTION(PFNGLUNIFORM2IPROC, Uniform2i, glad_glUniform2i)
+#undef glUniform3i
+#define glUniform3i GLAD_GL_FUNCTION(PFNGLUNIFORM3IPROC, Uniform3i, glad_glUniform3i)
+#undef glUniform4i
+#define glUniform4i GLAD_GL_FUNCTION(PFNGLUNIFORM4IPROC, Uniform4i, glad_glUniform4i)
+#undef glUniform1fv
+#define glUniform1fv GLAD_GL_FUNCTION(PFNGLUNIFORM1FVPROC, Uniform1fv, glad_glUniform1fv)
+#undef glUniform2fv
+#define glUniform2fv GLAD_GL_FUNCTION(PFNGLUNIFORM2FVPROC, Uniform2fv, glad_glUniform2fv)
+#undef glUniform3fv
+#define glUniform3fv GLAD_GL_FUNCTION(PFNGLUNIFORM3FVPROC, Uniform3fv, glad_glUniform3fv)
+#undef glUniform4fv
+#define glUniform4fv GLAD_GL_FUNCTION(PFNGLUNIFORM4FVPROC, Uniform4fv, glad_glUniform4fv)
+#undef glUniform1iv
+#define glUniform1iv GLAD_GL_FUNCTION(PFNGLUNIFORM1IVPROC, Uniform1iv, glad_glUniform1iv)
+#undef glUniform2iv
+#define glUniform2iv GLAD_GL_FUNCTION(PFNGLUNIFORM2IVPROC, Uniform2iv, glad_glUniform2iv)
+#undef glUniform3iv
+#define glUniform3iv GLAD_GL_FUNCTION(PFNGLUNIFORM3IVPROC, Uniform3iv, glad_glUniform3iv)
+#undef glUniform4iv
+#define glUniform4iv GLAD_GL_FUNCTION(PFNGLUNIFORM4IVPROC, Uniform4iv, glad_glUniform4iv)
+#undef glUniformMatrix2fv
+#define glUniformMatrix2fv GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX2FVPROC, UniformMatrix2fv, glad_glUniformMatrix2fv)
+#undef glUniformMatrix3fv
+#define glUniformMatrix3fv GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX3FVPROC, UniformMatrix3fv, glad_glUniformMatrix3fv)
+#undef glUniformMatrix4fv
+#define glUniformMatrix4fv GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX4FVPROC, UniformMatrix4fv, glad_glUniformMatrix4fv)
+#undef glValidateProgram
+#define glValidateProgram GLAD_GL_FUNCTION(PFNGLVALIDATEPROGRAMPROC, ValidateProgram, glad_glValidateProgram)
+#undef glVertexAttrib1d
+#define glVertexAttrib1d GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB1DPROC, VertexAttrib1d, glad_glVertexAttrib1d)
+#undef glVertexAttrib1dv
+#define glVertexAttrib1dv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB1DVPROC, VertexAttrib1dv, glad_glVertexAttrib1dv)
+#undef glVertexAttrib1f
+#define glVertexAttrib1f GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB1FPROC, VertexAttrib1f, glad_glVertexAttrib1f)
+#undef glVertexAttrib1fv
+#define glVertexAttrib1fv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB1FVPROC, VertexAttrib1fv, glad_glVertexAttrib1fv)
+#undef glVertexAttrib1s
+#define glVertexAttrib1s GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB1SPROC, VertexAttrib1s, glad_glVertexAttrib1s)
+#undef glVertexAttrib1sv
+#define glVertexAttrib1sv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB1SVPROC, VertexAttrib1sv, glad_glVertexAttrib1sv)
+#undef glVertexAttrib2d
+#define glVertexAttrib2d GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB2DPROC, VertexAttrib2d, glad_glVertexAttrib2d)
+#undef glVertexAttrib2dv
+#define glVertexAttrib2dv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB2DVPROC, VertexAttrib2dv, glad_glVertexAttrib2dv)
+#undef glVertexAttrib2f
+#define glVertexAttrib2f GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB2FPROC, VertexAttrib2f, glad_glVertexAttrib2f)
+#undef glVertexAttrib2fv
+#define glVertexAttrib2fv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB2FVPROC, VertexAttrib2fv, glad_glVertexAttrib2fv)
+#undef glVertexAttrib2s
+#define glVertexAttrib2s GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB2SPROC, VertexAttrib2s, glad_glVertexAttrib2s)
+#undef glVertexAttrib2sv
+#define glVertexAttrib2sv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB2SVPROC, VertexAttrib2sv, glad_glVertexAttrib2sv)
+#undef glVertexAttrib3d
+#define glVertexAttrib3d GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB3DPROC, VertexAttrib3d, glad_glVertexAttrib3d)
+#undef glVertexAttrib3dv
+#define glVertexAttrib3dv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB3DVPROC, VertexAttrib3dv, glad_glVertexAttrib3dv)
+#undef glVertexAttrib3f
+#define glVertexAttrib3f GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB3FPROC, VertexAttrib3f, glad_glVertexAttrib3f)
+#undef glVertexAttrib3fv
+#define glVertexAttrib3fv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB3FVPROC, VertexAttrib3fv, glad_glVertexAttrib3fv)
+#undef glVertexAttrib3s
+#define glVertexAttrib3s GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB3SPROC, VertexAttrib3s, glad_glVertexAttrib3s)
+#undef glVertexAttrib3sv
+#define glVertexAttrib3sv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB3SVPROC, VertexAttrib3sv, glad_glVertexAttrib3sv)
+#undef glVertexAttrib4Nbv
+#define glVertexAttrib4Nbv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NBVPROC, VertexAttrib4Nbv, glad_glVertexAttrib4Nbv)
+#undef glVertexAttrib4Niv
+#define glVertexAttrib4Niv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NIVPROC, VertexAttrib4Niv, glad_glVertexAttrib4Niv)
+#undef glVertexAttrib4Nsv
+#define glVertexAttrib4Nsv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NSVPROC, VertexAttrib4Nsv, glad_glVertexAttrib4Nsv)
+#undef glVertexAttrib4Nub
+#define glVertexAttrib4Nub GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NUBPROC, VertexAttrib4Nub, glad_glVertexAttrib4Nub)
+#undef glVertexAttrib4Nubv
+#define glVertexAttrib4Nubv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NUBVPROC, VertexAttrib4Nubv, glad_glVertexAttrib4Nubv)
+#undef glVertexAttrib4Nuiv
+#define glVertexAttrib4Nuiv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NUIVPROC, VertexAttrib4Nuiv, glad_glVertexAttrib4Nuiv)
+#undef glVertexAttrib4Nusv
+#define glVertexAttrib4Nusv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4NUSVPROC, VertexAttrib4Nusv, glad_glVertexAttrib4Nusv)
+#undef glVertexAttrib4bv
+#define glVertexAttrib4bv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4BVPROC, VertexAttrib4bv, glad_glVertexAttrib4bv)
+#undef glVertexAttrib4d
+#define glVertexAttrib4d GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4DPROC, VertexAttrib4d, glad_glVertexAttrib4d)
+#undef glVertexAttrib4dv
+#define glVertexAttrib4dv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4DVPROC, VertexAttrib4dv, glad_glVertexAttrib4dv)
+#undef glVertexAttrib4f
+#define glVertexAttrib4f GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4FPROC, VertexAttrib4f, glad_glVertexAttrib4f)
+#undef glVertexAttrib4fv
+#define glVertexAttrib4fv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4FVPROC, VertexAttrib4fv, glad_glVertexAttrib4fv)
+#undef glVertexAttrib4iv
+#define glVertexAttrib4iv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4IVPROC, VertexAttrib4iv, glad_glVertexAttrib4iv)
+#undef glVertexAttrib4s
+#define glVertexAttrib4s GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4SPROC, VertexAttrib4s, glad_glVertexAttrib4s)
+#undef glVertexAttrib4sv
+#define glVertexAttrib4sv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4SVPROC, VertexAttrib4sv, glad_glVertexAttrib4sv)
+#undef glVertexAttrib4ubv
+#define glVertexAttrib4ubv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4UBVPROC, VertexAttrib4ubv, glad_glVertexAttrib4ubv)
+#undef glVertexAttrib4uiv
+#define glVertexAttrib4uiv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4UIVPROC, VertexAttrib4uiv, glad_glVertexAttrib4uiv)
+#undef glVertexAttrib4usv
+#define glVertexAttrib4usv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIB4USVPROC, VertexAttrib4usv, glad_glVertexAttrib4usv)
+#undef glVertexAttribPointer
+#define glVertexAttribPointer GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBPOINTERPROC, VertexAttribPointer, glad_glVertexAttribPointer)
+#undef glUniformMatrix2x3fv
+#define glUniformMatrix2x3fv GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX2X3FVPROC, UniformMatrix2x3fv, glad_glUniformMatrix2x3fv)
+#undef glUniformMatrix3x2fv
+#define glUniformMatrix3x2fv GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX3X2FVPROC, UniformMatrix3x2fv, glad_glUniformMatrix3x2fv)
+#undef glUniformMatrix2x4fv
+#define glUniformMatrix2x4fv GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX2X4FVPROC, UniformMatrix2x4fv, glad_glUniformMatrix2x4fv)
+#undef glUniformMatrix4x2fv
+#define glUniformMatrix4x2fv GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX4X2FVPROC, UniformMatrix4x2fv, glad_glUniformMatrix4x2fv)
+#undef glUniformMatrix3x4fv
+#define glUniformMatrix3x4fv GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX3X4FVPROC, UniformMatrix3x4fv, glad_glUniformMatrix3x4fv)
+#undef glUniformMatrix4x3fv
+#define glUniformMatrix4x3fv GLAD_GL_FUNCTION(PFNGLUNIFORMMATRIX4X3FVPROC, UniformMatrix4x3fv, glad_glUniformMatrix4x3fv)
+#undef glColorMaski
+#define glColorMaski GLAD_GL_FUNCTION(PFNGLCOLORMASKIPROC, ColorMaski, glad_glColorMaski)
+#undef glGetBooleani_v
+#define glGetBooleani_v GLAD_GL_FUNCTION(PFNGLGETBOOLEANI_VPROC, GetBooleani_v, glad_glGetBooleani_v)
+#undef glGetIntegeri_v
+#define glGetIntegeri_v GLAD_GL_FUNCTION(PFNGLGETINTEGERI_VPROC, GetIntegeri_v, glad_glGetIntegeri_v)
+#undef glEnablei
+#define glEnablei GLAD_GL_FUNCTION(PFNGLENABLEIPROC, Enablei, glad_glEnablei)
+#undef glDisablei
+#define glDisablei GLAD_GL_FUNCTION(PFNGLDISABLEIPROC, Disablei, glad_glDisablei)
+#undef glIsEnabledi
+#define glIsEnabledi GLAD_GL_FUNCTION(PFNGLISENABLEDIPROC, IsEnabledi, glad_glIsEnabledi)
+#undef glBeginTransformFeedback
+#define glBeginTransformFeedback GLAD_GL_FUNCTION(PFNGLBEGINTRANSFORMFEEDBACKPROC, BeginTransformFeedback, glad_glBeginTransformFeedback)
+#undef glEndTransformFeedback
+#define glEndTransformFeedback GLAD_GL_FUNCTION(PFNGLENDTRANSFORMFEEDBACKPROC, EndTransformFeedback, glad_glEndTransformFeedback)
+#undef glBindBufferRange
+#define glBindBufferRange GLAD_GL_FUNCTION(PFNGLBINDBUFFERRANGEPROC, BindBufferRange, glad_glBindBufferRange)
+#undef glBindBufferBase
+#define glBindBufferBase GLAD_GL_FUNCTION(PFNGLBINDBUFFERBASEPROC, BindBufferBase, glad_glBindBufferBase)
+#undef glTransformFeedbackVaryings
+#define glTransformFeedbackVaryings GLAD_GL_FUNCTION(PFNGLTRANSFORMFEEDBACKVARYINGSPROC, TransformFeedbackVaryings, glad_glTransformFeedbackVaryings)
+#undef glGetTransformFeedbackVarying
+#define glGetTransformFeedbackVarying GLAD_GL_FUNCTION(PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, GetTransformFeedbackVarying, glad_glGetTransformFeedbackVarying)
+#undef glClampColor
+#define glClampColor GLAD_GL_FUNCTION(PFNGLCLAMPCOLORPROC, ClampColor, glad_glClampColor)
+#undef glBeginConditionalRender
+#define glBeginConditionalRender GLAD_GL_FUNCTION(PFNGLBEGINCONDITIONALRENDERPROC, BeginConditionalRender, glad_glBeginConditionalRender)
+#undef glEndConditionalRender
+#define glEndConditionalRender GLAD_GL_FUNCTION(PFNGLENDCONDITIONALRENDERPROC, EndConditionalRender, glad_glEndConditionalRender)
+#undef glVertexAttribIPointer
+#define glVertexAttribIPointer GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBIPOINTERPROC, VertexAttribIPointer, glad_glVertexAttribIPointer)
+#undef glGetVertexAttribIiv
+#define glGetVertexAttribIiv GLAD_GL_FUNCTION(PFNGLGETVERTEXATTRIBIIVPROC, GetVertexAttribIiv, glad_glGetVertexAttribIiv)
+#undef glGetVertexAttribIuiv
+#define glGetVertexAttribIuiv GLAD_GL_FUNCTION(PFNGLGETVERTEXATTRIBIUIVPROC, GetVertexAttribIuiv, glad_glGetVertexAttribIuiv)
+#undef glVertexAttribI1i
+#define glVertexAttribI1i GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI1IPROC, VertexAttribI1i, glad_glVertexAttribI1i)
+#undef glVertexAttribI2i
+#define glVertexAttribI2i GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI2IPROC, VertexAttribI2i, glad_glVertexAttribI2i)
+#undef glVertexAttribI3i
+#define glVertexAttribI3i GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI3IPROC, VertexAttribI3i, glad_glVertexAttribI3i)
+#undef glVertexAttribI4i
+#define glVertexAttribI4i GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4IPROC, VertexAttribI4i, glad_glVertexAttribI4i)
+#undef glVertexAttribI1ui
+#define glVertexAttribI1ui GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI1UIPROC, VertexAttribI1ui, glad_glVertexAttribI1ui)
+#undef glVertexAttribI2ui
+#define glVertexAttribI2ui GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI2UIPROC, VertexAttribI2ui, glad_glVertexAttribI2ui)
+#undef glVertexAttribI3ui
+#define glVertexAttribI3ui GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI3UIPROC, VertexAttribI3ui, glad_glVertexAttribI3ui)
+#undef glVertexAttribI4ui
+#define glVertexAttribI4ui GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4UIPROC, VertexAttribI4ui, glad_glVertexAttribI4ui)
+#undef glVertexAttribI1iv
+#define glVertexAttribI1iv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI1IVPROC, VertexAttribI1iv, glad_glVertexAttribI1iv)
+#undef glVertexAttribI2iv
+#define glVertexAttribI2iv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI2IVPROC, VertexAttribI2iv, glad_glVertexAttribI2iv)
+#undef glVertexAttribI3iv
+#define glVertexAttribI3iv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI3IVPROC, VertexAttribI3iv, glad_glVertexAttribI3iv)
+#undef glVertexAttribI4iv
+#define glVertexAttribI4iv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4IVPROC, VertexAttribI4iv, glad_glVertexAttribI4iv)
+#undef glVertexAttribI1uiv
+#define glVertexAttribI1uiv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI1UIVPROC, VertexAttribI1uiv, glad_glVertexAttribI1uiv)
+#undef glVertexAttribI2uiv
+#define glVertexAttribI2uiv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI2UIVPROC, VertexAttribI2uiv, glad_glVertexAttribI2uiv)
+#undef glVertexAttribI3uiv
+#define glVertexAttribI3uiv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI3UIVPROC, VertexAttribI3uiv, glad_glVertexAttribI3uiv)
+#undef glVertexAttribI4uiv
+#define glVertexAttribI4uiv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4UIVPROC, VertexAttribI4uiv, glad_glVertexAttribI4uiv)
+#undef glVertexAttribI4bv
+#define glVertexAttribI4bv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4BVPROC, VertexAttribI4bv, glad_glVertexAttribI4bv)
+#undef glVertexAttribI4sv
+#define glVertexAttribI4sv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4SVPROC, VertexAttribI4sv, glad_glVertexAttribI4sv)
+#undef glVertexAttribI4ubv
+#define glVertexAttribI4ubv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4UBVPROC, VertexAttribI4ubv, glad_glVertexAttribI4ubv)
+#undef glVertexAttribI4usv
+#define glVertexAttribI4usv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBI4USVPROC, VertexAttribI4usv, glad_glVertexAttribI4usv)
+#undef glGetUniformuiv
+#define glGetUniformuiv GLAD_GL_FUNCTION(PFNGLGETUNIFORMUIVPROC, GetUniformuiv, glad_glGetUniformuiv)
+#undef glBindFragDataLocation
+#define glBindFragDataLocation GLAD_GL_FUNCTION(PFNGLBINDFRAGDATALOCATIONPROC, BindFragDataLocation, glad_glBindFragDataLocation)
+#undef glGetFragDataLocation
+#define glGetFragDataLocation GLAD_GL_FUNCTION(PFNGLGETFRAGDATALOCATIONPROC, GetFragDataLocation, glad_glGetFragDataLocation)
+#undef glUniform1ui
+#define glUniform1ui GLAD_GL_FUNCTION(PFNGLUNIFORM1UIPROC, Uniform1ui, glad_glUniform1ui)
+#undef glUniform2ui
+#define glUniform2ui GLAD_GL_FUNCTION(PFNGLUNIFORM2UIPROC, Uniform2ui, glad_glUniform2ui)
+#undef glUniform3ui
+#define glUniform3ui GLAD_GL_FUNCTION(PFNGLUNIFORM3UIPROC, Uniform3ui, glad_glUniform3ui)
+#undef glUniform4ui
+#define glUniform4ui GLAD_GL_FUNCTION(PFNGLUNIFORM4UIPROC, Uniform4ui, glad_glUniform4ui)
+#undef glUniform1uiv
+#define glUniform1uiv GLAD_GL_FUNCTION(PFNGLUNIFORM1UIVPROC, Uniform1uiv, glad_glUniform1uiv)
+#undef glUniform2uiv
+#define glUniform2uiv GLAD_GL_FUNCTION(PFNGLUNIFORM2UIVPROC, Uniform2uiv, glad_glUniform2uiv)
+#undef glUniform3uiv
+#define glUniform3uiv GLAD_GL_FUNCTION(PFNGLUNIFORM3UIVPROC, Uniform3uiv, glad_glUniform3uiv)
+#undef glUniform4uiv
+#define glUniform4uiv GLAD_GL_FUNCTION(PFNGLUNIFORM4UIVPROC, Uniform4uiv, glad_glUniform4uiv)
+#undef glTexParameterIiv
+#define glTexParameterIiv GLAD_GL_FUNCTION(PFNGLTEXPARAMETERIIVPROC, TexParameterIiv, glad_glTexParameterIiv)
+#undef glTexParameterIuiv
+#define glTexParameterIuiv GLAD_GL_FUNCTION(PFNGLTEXPARAMETERIUIVPROC, TexParameterIuiv, glad_glTexParameterIuiv)
+#undef glGetTexParameterIiv
+#define glGetTexParameterIiv GLAD_GL_FUNCTION(PFNGLGETTEXPARAMETERIIVPROC, GetTexParameterIiv, glad_glGetTexParameterIiv)
+#undef glGetTexParameterIuiv
+#define glGetTexParameterIuiv GLAD_GL_FUNCTION(PFNGLGETTEXPARAMETERIUIVPROC, GetTexParameterIuiv, glad_glGetTexParameterIuiv)
+#undef glClearBufferiv
+#define glClearBufferiv GLAD_GL_FUNCTION(PFNGLCLEARBUFFERIVPROC, ClearBufferiv, glad_glClearBufferiv)
+#undef glClearBufferuiv
+#define glClearBufferuiv GLAD_GL_FUNCTION(PFNGLCLEARBUFFERUIVPROC, ClearBufferuiv, glad_glClearBufferuiv)
+#undef glClearBufferfv
+#define glClearBufferfv GLAD_GL_FUNCTION(PFNGLCLEARBUFFERFVPROC, ClearBufferfv, glad_glClearBufferfv)
+#undef glClearBufferfi
+#define glClearBufferfi GLAD_GL_FUNCTION(PFNGLCLEARBUFFERFIPROC, ClearBufferfi, glad_glClearBufferfi)
+#undef glGetStringi
+#define glGetStringi GLAD_GL_FUNCTION(PFNGLGETSTRINGIPROC, GetStringi, glad_glGetStringi)
+#undef glIsRenderbuffer
+#define glIsRenderbuffer GLAD_GL_FUNCTION(PFNGLISRENDERBUFFERPROC, IsRenderbuffer, glad_glIsRenderbuffer)
+#undef glBindRenderbuffer
+#define glBindRenderbuffer GLAD_GL_FUNCTION(PFNGLBINDRENDERBUFFERPROC, BindRenderbuffer, glad_glBindRenderbuffer)
+#undef glDeleteRenderbuffers
+#define glDeleteRenderbuffers GLAD_GL_FUNCTION(PFNGLDELETERENDERBUFFERSPROC, DeleteRenderbuffers, glad_glDeleteRenderbuffers)
+#undef glGenRenderbuffers
+#define glGenRenderbuffers GLAD_GL_FUNCTION(PFNGLGENRENDERBUFFERSPROC, GenRenderbuffers, glad_glGenRenderbuffers)
+#undef glRenderbufferStorage
+#define glRenderbufferStorage GLAD_GL_FUNCTION(PFNGLRENDERBUFFERSTORAGEPROC, RenderbufferStorage, glad_glRenderbufferStorage)
+#undef glGetRenderbufferParameteriv
+#define glGetRenderbufferParameteriv GLAD_GL_FUNCTION(PFNGLGETRENDERBUFFERPARAMETERIVPROC, GetRenderbufferParameteriv, glad_glGetRenderbufferParameteriv)
+#undef glIsFramebuffer
+#define glIsFramebuffer GLAD_GL_FUNCTION(PFNGLISFRAMEBUFFERPROC, IsFramebuffer, glad_glIsFramebuffer)
+#undef glBindFramebuffer
+#define glBindFramebuffer GLAD_GL_FUNCTION(PFNGLBINDFRAMEBUFFERPROC, BindFramebuffer, glad_glBindFramebuffer)
+#undef glDeleteFramebuffers
+#define glDeleteFramebuffers GLAD_GL_FUNCTION(PFNGLDELETEFRAMEBUFFERSPROC, DeleteFramebuffers, glad_glDeleteFramebuffers)
+#undef glGenFramebuffers
+#define glGenFramebuffers GLAD_GL_FUNCTION(PFNGLGENFRAMEBUFFERSPROC, GenFramebuffers, glad_glGenFramebuffers)
+#undef glCheckFramebufferStatus
+#define glCheckFramebufferStatus GLAD_GL_FUNCTION(PFNGLCHECKFRAMEBUFFERSTATUSPROC, CheckFramebufferStatus, glad_glCheckFramebufferStatus)
+#undef glFramebufferTexture1D
+#define glFramebufferTexture1D GLAD_GL_FUNCTION(PFNGLFRAMEBUFFERTEXTURE1DPROC, FramebufferTexture1D, glad_glFramebufferTexture1D)
+#undef glFramebufferTexture2D
+#define glFramebufferTexture2D GLAD_GL_FUNCTION(PFNGLFRAMEBUFFERTEXTURE2DPROC, FramebufferTexture2D, glad_glFramebufferTexture2D)
+#undef glFramebufferTexture3D
+#define glFramebufferTexture3D GLAD_GL_FUNCTION(PFNGLFRAMEBUFFERTEXTURE3DPROC, FramebufferTexture3D, glad_glFramebufferTexture3D)
+#undef glFramebufferRenderbuffer
+#define glFramebufferRenderbuffer GLAD_GL_FUNCTION(PFNGLFRAMEBUFFERRENDERBUFFERPROC, FramebufferRenderbuffer, glad_glFramebufferRenderbuffer)
+#undef glGetFramebufferAttachmentParameteriv
+#define glGetFramebufferAttachmentParameteriv GLAD_GL_FUNCTION(PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, GetFramebufferAttachmentParameteriv, glad_glGetFramebufferAttachmentParameteriv)
+#undef glGenerateMipmap
+#define glGenerateMipmap GLAD_GL_FUNCTION(PFNGLGENERATEMIPMAPPROC, GenerateMipmap, glad_glGenerateMipmap)
+#undef glBlitFramebuffer
+#define glBlitFramebuffer GLAD_GL_FUNCTION(PFNGLBLITFRAMEBUFFERPROC, BlitFramebuffer, glad_glBlitFramebuffer)
+#undef glRenderbufferStorageMultisample
+#define glRenderbufferStorageMultisample GLAD_GL_FUNCTION(PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, RenderbufferStorageMultisample, glad_glRenderbufferStorageMultisample)
+#undef glFramebufferTextureLayer
+#define glFramebufferTextureLayer GLAD_GL_FUNCTION(PFNGLFRAMEBUFFERTEXTURELAYERPROC, FramebufferTextureLayer, glad_glFramebufferTextureLayer)
+#undef glMapBufferRange
+#define glMapBufferRange GLAD_GL_FUNCTION(PFNGLMAPBUFFERRANGEPROC, MapBufferRange, glad_glMapBufferRange)
+#undef glFlushMappedBufferRange
+#define glFlushMappedBufferRange GLAD_GL_FUNCTION(PFNGLFLUSHMAPPEDBUFFERRANGEPROC, FlushMappedBufferRange, glad_glFlushMappedBufferRange)
+#undef glBindVertexArray
+#define glBindVertexArray GLAD_GL_FUNCTION(PFNGLBINDVERTEXARRAYPROC, BindVertexArray, glad_glBindVertexArray)
+#undef glDeleteVertexArrays
+#define glDeleteVertexArrays GLAD_GL_FUNCTION(PFNGLDELETEVERTEXARRAYSPROC, DeleteVertexArrays, glad_glDeleteVertexArrays)
+#undef glGenVertexArrays
+#define glGenVertexArrays GLAD_GL_FUNCTION(PFNGLGENVERTEXARRAYSPROC, GenVertexArrays, glad_glGenVertexArrays)
+#undef glIsVertexArray
+#define glIsVertexArray GLAD_GL_FUNCTION(PFNGLISVERTEXARRAYPROC, IsVertexArray, glad_glIsVertexArray)
+#undef glDrawArraysInstanced
+#define glDrawArraysInstanced GLAD_GL_FUNCTION(PFNGLDRAWARRAYSINSTANCEDPROC, DrawArraysInstanced, glad_glDrawArraysInstanced)
+#undef glDrawElementsInstanced
+#define glDrawElementsInstanced GLAD_GL_FUNCTION(PFNGLDRAWELEMENTSINSTANCEDPROC, DrawElementsInstanced, glad_glDrawElementsInstanced)
+#undef glTexBuffer
+#define glTexBuffer GLAD_GL_FUNCTION(PFNGLTEXBUFFERPROC, TexBuffer, glad_glTexBuffer)
+#undef glPrimitiveRestartIndex
+#define glPrimitiveRestartIndex GLAD_GL_FUNCTION(PFNGLPRIMITIVERESTARTINDEXPROC, PrimitiveRestartIndex, glad_glPrimitiveRestartIndex)
+#undef glCopyBufferSubData
+#define glCopyBufferSubData GLAD_GL_FUNCTION(PFNGLCOPYBUFFERSUBDATAPROC, CopyBufferSubData, glad_glCopyBufferSubData)
+#undef glGetUniformIndices
+#define glGetUniformIndices GLAD_GL_FUNCTION(PFNGLGETUNIFORMINDICESPROC, GetUniformIndices, glad_glGetUniformIndices)
+#undef glGetActiveUniformsiv
+#define glGetActiveUniformsiv GLAD_GL_FUNCTION(PFNGLGETACTIVEUNIFORMSIVPROC, GetActiveUniformsiv, glad_glGetActiveUniformsiv)
+#undef glGetActiveUniformName
+#define glGetActiveUniformName GLAD_GL_FUNCTION(PFNGLGETACTIVEUNIFORMNAMEPROC, GetActiveUniformName, glad_glGetActiveUniformName)
+#undef glGetUniformBlockIndex
+#define glGetUniformBlockIndex GLAD_GL_FUNCTION(PFNGLGETUNIFORMBLOCKINDEXPROC, GetUniformBlockIndex, glad_glGetUniformBlockIndex)
+#undef glGetActiveUniformBlockiv
+#define glGetActiveUniformBlockiv GLAD_GL_FUNCTION(PFNGLGETACTIVEUNIFORMBLOCKIVPROC, GetActiveUniformBlockiv, glad_glGetActiveUniformBlockiv)
+#undef glGetActiveUniformBlockName
+#define glGetActiveUniformBlockName GLAD_GL_FUNCTION(PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, GetActiveUniformBlockName, glad_glGetActiveUniformBlockName)
+#undef glUniformBlockBinding
+#define glUniformBlockBinding GLAD_GL_FUNCTION(PFNGLUNIFORMBLOCKBINDINGPROC, UniformBlockBinding, glad_glUniformBlockBinding)
+#undef glDrawElementsBaseVertex
+#define glDrawElementsBaseVertex GLAD_GL_FUNCTION(PFNGLDRAWELEMENTSBASEVERTEXPROC, DrawElementsBaseVertex, glad_glDrawElementsBaseVertex)
+#undef glDrawRangeElementsBaseVertex
+#define glDrawRangeElementsBaseVertex GLAD_GL_FUNCTION(PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, DrawRangeElementsBaseVertex, glad_glDrawRangeElementsBaseVertex)
+#undef glDrawElementsInstancedBaseVertex
+#define glDrawElementsInstancedBaseVertex GLAD_GL_FUNCTION(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, DrawElementsInstancedBaseVertex, glad_glDrawElementsInstancedBaseVertex)
+#undef glMultiDrawElementsBaseVertex
+#define glMultiDrawElementsBaseVertex GLAD_GL_FUNCTION(PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, MultiDrawElementsBaseVertex, glad_glMultiDrawElementsBaseVertex)
+#undef glProvokingVertex
+#define glProvokingVertex GLAD_GL_FUNCTION(PFNGLPROVOKINGVERTEXPROC, ProvokingVertex, glad_glProvokingVertex)
+#undef glFenceSync
+#define glFenceSync GLAD_GL_FUNCTION(PFNGLFENCESYNCPROC, FenceSync, glad_glFenceSync)
+#undef glIsSync
+#define glIsSync GLAD_GL_FUNCTION(PFNGLISSYNCPROC, IsSync, glad_glIsSync)
+#undef glDeleteSync
+#define glDeleteSync GLAD_GL_FUNCTION(PFNGLDELETESYNCPROC, DeleteSync, glad_glDeleteSync)
+#undef glClientWaitSync
+#define glClientWaitSync GLAD_GL_FUNCTION(PFNGLCLIENTWAITSYNCPROC, ClientWaitSync, glad_glClientWaitSync)
+#undef glWaitSync
+#define glWaitSync GLAD_GL_FUNCTION(PFNGLWAITSYNCPROC, WaitSync, glad_glWaitSync)
+#undef glGetInteger64v
+#define glGetInteger64v GLAD_GL_FUNCTION(PFNGLGETINTEGER64VPROC, GetInteger64v, glad_glGetInteger64v)
+#undef glGetSynciv
+#define glGetSynciv GLAD_GL_FUNCTION(PFNGLGETSYNCIVPROC, GetSynciv, glad_glGetSynciv)
+#undef glGetInteger64i_v
+#define glGetInteger64i_v GLAD_GL_FUNCTION(PFNGLGETINTEGER64I_VPROC, GetInteger64i_v, glad_glGetInteger64i_v)
+#undef glGetBufferParameteri64v
+#define glGetBufferParameteri64v GLAD_GL_FUNCTION(PFNGLGETBUFFERPARAMETERI64VPROC, GetBufferParameteri64v, glad_glGetBufferParameteri64v)
+#undef glFramebufferTexture
+#define glFramebufferTexture GLAD_GL_FUNCTION(PFNGLFRAMEBUFFERTEXTUREPROC, FramebufferTexture, glad_glFramebufferTexture)
+#undef glTexImage2DMultisample
+#define glTexImage2DMultisample GLAD_GL_FUNCTION(PFNGLTEXIMAGE2DMULTISAMPLEPROC, TexImage2DMultisample, glad_glTexImage2DMultisample)
+#undef glTexImage3DMultisample
+#define glTexImage3DMultisample GLAD_GL_FUNCTION(PFNGLTEXIMAGE3DMULTISAMPLEPROC, TexImage3DMultisample, glad_glTexImage3DMultisample)
+#undef glGetMultisamplefv
+#define glGetMultisamplefv GLAD_GL_FUNCTION(PFNGLGETMULTISAMPLEFVPROC, GetMultisamplefv, glad_glGetMultisamplefv)
+#undef glSampleMaski
+#define glSampleMaski GLAD_GL_FUNCTION(PFNGLSAMPLEMASKIPROC, SampleMaski, glad_glSampleMaski)
+#undef glBindFragDataLocationIndexed
+#define glBindFragDataLocationIndexed GLAD_GL_FUNCTION(PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, BindFragDataLocationIndexed, glad_glBindFragDataLocationIndexed)
+#undef glGetFragDataIndex
+#define glGetFragDataIndex GLAD_GL_FUNCTION(PFNGLGETFRAGDATAINDEXPROC, GetFragDataIndex, glad_glGetFragDataIndex)
+#undef glGenSamplers
+#define glGenSamplers GLAD_GL_FUNCTION(PFNGLGENSAMPLERSPROC, GenSamplers, glad_glGenSamplers)
+#undef glDeleteSamplers
+#define glDeleteSamplers GLAD_GL_FUNCTION(PFNGLDELETESAMPLERSPROC, DeleteSamplers, glad_glDeleteSamplers)
+#undef glIsSampler
+#define glIsSampler GLAD_GL_FUNCTION(PFNGLISSAMPLERPROC, IsSampler, glad_glIsSampler)
+#undef glBindSampler
+#define glBindSampler GLAD_GL_FUNCTION(PFNGLBINDSAMPLERPROC, BindSampler, glad_glBindSampler)
+#undef glSamplerParameteri
+#define glSamplerParameteri GLAD_GL_FUNCTION(PFNGLSAMPLERPARAMETERIPROC, SamplerParameteri, glad_glSamplerParameteri)
+#undef glSamplerParameteriv
+#define glSamplerParameteriv GLAD_GL_FUNCTION(PFNGLSAMPLERPARAMETERIVPROC, SamplerParameteriv, glad_glSamplerParameteriv)
+#undef glSamplerParameterf
+#define glSamplerParameterf GLAD_GL_FUNCTION(PFNGLSAMPLERPARAMETERFPROC, SamplerParameterf, glad_glSamplerParameterf)
+#undef glSamplerParameterfv
+#define glSamplerParameterfv GLAD_GL_FUNCTION(PFNGLSAMPLERPARAMETERFVPROC, SamplerParameterfv, glad_glSamplerParameterfv)
+#undef glSamplerParameterIiv
+#define glSamplerParameterIiv GLAD_GL_FUNCTION(PFNGLSAMPLERPARAMETERIIVPROC, SamplerParameterIiv, glad_glSamplerParameterIiv)
+#undef glSamplerParameterIuiv
+#define glSamplerParameterIuiv GLAD_GL_FUNCTION(PFNGLSAMPLERPARAMETERIUIVPROC, SamplerParameterIuiv, glad_glSamplerParameterIuiv)
+#undef glGetSamplerParameteriv
+#define glGetSamplerParameteriv GLAD_GL_FUNCTION(PFNGLGETSAMPLERPARAMETERIVPROC, GetSamplerParameteriv, glad_glGetSamplerParameteriv)
+#undef glGetSamplerParameterIiv
+#define glGetSamplerParameterIiv GLAD_GL_FUNCTION(PFNGLGETSAMPLERPARAMETERIIVPROC, GetSamplerParameterIiv, glad_glGetSamplerParameterIiv)
+#undef glGetSamplerParameterfv
+#define glGetSamplerParameterfv GLAD_GL_FUNCTION(PFNGLGETSAMPLERPARAMETERFVPROC, GetSamplerParameterfv, glad_glGetSamplerParameterfv)
+#undef glGetSamplerParameterIuiv
+#define glGetSamplerParameterIuiv GLAD_GL_FUNCTION(PFNGLGETSAMPLERPARAMETERIUIVPROC, GetSamplerParameterIuiv, glad_glGetSamplerParameterIuiv)
+#undef glQueryCounter
+#define glQueryCounter GLAD_GL_FUNCTION(PFNGLQUERYCOUNTERPROC, QueryCounter, glad_glQueryCounter)
+#undef glGetQueryObjecti64v
+#define glGetQueryObjecti64v GLAD_GL_FUNCTION(PFNGLGETQUERYOBJECTI64VPROC, GetQueryObjecti64v, glad_glGetQueryObjecti64v)
+#undef glGetQueryObjectui64v
+#define glGetQueryObjectui64v GLAD_GL_FUNCTION(PFNGLGETQUERYOBJECTUI64VPROC, GetQueryObjectui64v, glad_glGetQueryObjectui64v)
+#undef glVertexAttribDivisor
+#define glVertexAttribDivisor GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBDIVISORPROC, VertexAttribDivisor, glad_glVertexAttribDivisor)
+#undef glVertexAttribP1ui
+#define glVertexAttribP1ui GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP1UIPROC, VertexAttribP1ui, glad_glVertexAttribP1ui)
+#undef glVertexAttribP1uiv
+#define glVertexAttribP1uiv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP1UIVPROC, VertexAttribP1uiv, glad_glVertexAttribP1uiv)
+#undef glVertexAttribP2ui
+#define glVertexAttribP2ui GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP2UIPROC, VertexAttribP2ui, glad_glVertexAttribP2ui)
+#undef glVertexAttribP2uiv
+#define glVertexAttribP2uiv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP2UIVPROC, VertexAttribP2uiv, glad_glVertexAttribP2uiv)
+#undef glVertexAttribP3ui
+#define glVertexAttribP3ui GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP3UIPROC, VertexAttribP3ui, glad_glVertexAttribP3ui)
+#undef glVertexAttribP3uiv
+#define glVertexAttribP3uiv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP3UIVPROC, VertexAttribP3uiv, glad_glVertexAttribP3uiv)
+#undef glVertexAttribP4ui
+#define glVertexAttribP4ui GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP4UIPROC, VertexAttribP4ui, glad_glVertexAttribP4ui)
+#undef glVertexAttribP4uiv
+#define glVertexAttribP4uiv GLAD_GL_FUNCTION(PFNGLVERTEXATTRIBP4UIVPROC, VertexAttribP4uiv, glad_glVertexAttribP4uiv)
+#undef glVertexP2ui
+#define glVertexP2ui GLAD_GL_FUNCTION(PFNGLVERTEXP2UIPROC, VertexP2ui, glad_glVertexP2ui)
+#undef glVertexP2uiv
+#define glVertexP2uiv GLAD_GL_FUNCTION(PFNGLVERTEXP2UIVPROC, VertexP2uiv, glad_glVertexP2uiv)
+#undef glVertexP3ui
+#define glVertexP3ui GLAD_GL_FUNCTION(PFNGLVERTEXP3UIPROC, VertexP3ui, glad_glVertexP3ui)
+#undef glVertexP3uiv
+#define glVertexP3uiv GLAD_GL_FUNCTION(PFNGLVERTEXP3UIVPROC, VertexP3uiv, glad_glVertexP3uiv)
+#undef glVertexP4ui
+#define glVertexP4ui GLAD_GL_FUNCTION(PFNGLVERTEXP4UIPROC, VertexP4ui, glad_glVertexP4ui)
+#undef glVertexP4uiv
+#define glVertexP4uiv GLAD_GL_FUNCTION(PFNGLVERTEXP4UIVPROC, VertexP4uiv, glad_glVertexP4uiv)
+#undef glTexCoordP1ui
+#define glTexCoordP1ui GLAD_GL_FUNCTION(PFNGLTEXCOORDP1UIPROC, TexCoordP1ui, glad_glTexCoordP1ui)
+#undef glTexCoordP1uiv
+#define glTexCoordP1uiv GLAD_GL_FUNCTION(PFNGLTEXCOORDP1UIVPROC, TexCoordP1uiv, glad_glTexCoordP1uiv)
+#undef glTexCoordP2ui
+#define glTexCoordP2ui GLAD_GL_FUNCTION(PFNGLTEXCOORDP2UIPROC, TexCoordP2ui, glad_glTexCoordP2ui)
+#undef glTexCoordP2uiv
+#define glTexCoordP2uiv GLAD_GL_FUNCTION(PFNGLTEXCOORDP2UIVPROC, TexCoordP2uiv, glad_glTexCoordP2uiv)
+#undef glTexCoordP3ui
+#define glTexCoordP3ui GLAD_GL_FUNCTION(PFNGLTEXCOORDP3UIPROC, TexCoordP3ui, glad_glTexCoordP3ui)
+#undef glTexCoordP3uiv
+#define glTexCoordP3uiv GLAD_GL_FUNCTION(PFNGLTEXCOORDP3UIVPROC, TexCoordP3uiv, glad_glTexCoordP3uiv)
+#undef glTexCoordP4ui
+#define glTexCoordP4ui GLAD_GL_FUNCTION(PFNGLTEXCOORDP4UIPROC, TexCoordP4ui, glad_glTexCoordP4ui)
+#undef glTexCoordP4uiv
+#define glTexCoordP4uiv GLAD_GL_FUNCTION(PFNGLTEXCOORDP4UIVPROC, TexCoordP4uiv, glad_glTexCoordP4uiv)
+#undef glMultiTexCoordP1ui
+#define glMultiTexCoordP1ui GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP1UIPROC, MultiTexCoordP1ui, glad_glMultiTexCoordP1ui)
+#undef glMultiTexCoordP1uiv
+#define glMultiTexCoordP1uiv GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP1UIVPROC, MultiTexCoordP1uiv, glad_glMultiTexCoordP1uiv)
+#undef glMultiTexCoordP2ui
+#define glMultiTexCoordP2ui GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP2UIPROC, MultiTexCoordP2ui, glad_glMultiTexCoordP2ui)
+#undef glMultiTexCoordP2uiv
+#define glMultiTexCoordP2uiv GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP2UIVPROC, MultiTexCoordP2uiv, glad_glMultiTexCoordP2uiv)
+#undef glMultiTexCoordP3ui
+#define glMultiTexCoordP3ui GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP3UIPROC, MultiTexCoordP3ui, glad_glMultiTexCoordP3ui)
+#undef glMultiTexCoordP3uiv
+#define glMultiTexCoordP3uiv GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP3UIVPROC, MultiTexCoordP3uiv, glad_glMultiTexCoordP3uiv)
+#undef glMultiTexCoordP4ui
+#define glMultiTexCoordP4ui GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP4UIPROC, MultiTexCoordP4ui, glad_glMultiTexCoordP4ui)
+#undef glMultiTexCoordP4uiv
+#define glMultiTexCoordP4uiv GLAD_GL_FUNCTION(PFNGLMULTITEXCOORDP4UIVPROC, MultiTexCoordP4uiv, glad_glMultiTexCoordP4uiv)
+#undef glNormalP3ui
+#define glNormalP3ui GLAD_GL_FUNCTION(PFNGLNORMALP3UIPROC, NormalP3ui, glad_glNormalP3ui)
+#undef glNormalP3uiv
+#define glNormalP3uiv GLAD_GL_FUNCTION(PFNGLNORMALP3UIVPROC, NormalP3uiv, glad_glNormalP3uiv)
+#undef glColorP3ui
+#define glColorP3ui GLAD_GL_FUNCTION(PFNGLCOLORP3UIPROC, ColorP3ui, glad_glColorP3ui)
+#undef glColorP3uiv
+#define glColorP3uiv GLAD_GL_FUNCTION(PFNGLCOLORP3UIVPROC, ColorP3uiv, glad_glColorP3uiv)
+#undef glColorP4ui
+#define glColorP4ui GLAD_GL_FUNCTION(PFNGLCOLORP4UIPROC, ColorP4ui, glad_glColorP4ui)
+#undef glColorP4uiv
+#define glColorP4uiv GLAD_GL_FUNCTION(PFNGLCOLORP4UIVPROC, ColorP4uiv, glad_glColorP4uiv)
+#undef glSecondaryColorP3ui
+#define glSecondaryColorP3ui GLAD_GL_FUNCTION(PFNGLSECONDARYCOLORP3UIPROC, SecondaryColorP3ui, glad_glSecondaryColorP3ui)
+#undef glSecondaryColorP3uiv
+#define glSecondaryColorP3uiv GLAD_GL_FUNCTION(PFNGLSECONDARYCOLORP3UIVPROC, SecondaryColorP3uiv, glad_glSecondaryColorP3uiv)
+#else
+#define GLAD_GL_FUNCTION(type, member, global) (global)
+#endif
+/* End of per-context function tables */
+
+/* Debug mode: generated by tools/gen_glad_debug.py */
+#ifdef GLAD_DEBUG
+typedef void (* GLADcallback)(const char *name, void *funcptr, int len_args, ...);
+GLAPI void glad_set_pre_callback(GLADcallback cb);
+GLAPI void glad_set_post_callback(GLADcallback cb);
+GLAPI PFNGLCULLFACEPROC glad_debug_glCullFace;
+#undef glCullFace
+#define glCullFace glad_debug_glCullFace
+GLAPI PFNGLFRONTFACEPROC glad_debug_glFrontFace;
+#undef glFrontFace
+#define glFrontFace glad_debug_glFrontFace
+GLAPI PFNGLHINTPROC glad_debug_glHint;
+#undef glHint
+#define glHint glad_debug_glHint
+GLAPI PFNGLLINEWIDTHPROC glad_debug_glLineWidth;
+#undef glLineWidth
+#define glLineWidth glad_debug_glLineWidth
+GLAPI PFNGLPOINTSIZEPROC glad_debug_glPointSize;
+#undef glPointSize
+#define glPointSize glad_debug_glPointSize
+GLAPI PFNGLPOLYGONMODEPROC glad_debug_glPolygonMode;
+#undef glPolygonMode
+#define glPolygonMode glad_debug_glPolygonMode
+GLAPI PFNGLSCISSORPROC glad_debug_glScissor;
+#undef glScissor
+#define glScissor glad_debug_glScissor
+GLAPI PFNGLTEXPARAMETERFPROC glad_debug_glTexParameterf;
+#undef glTexParameterf
+#define glTexParameterf glad_debug_glTexParameterf
+GLAPI PFNGLTEXPARAMETERFVPROC glad_debug_glTexParameterfv;
+#undef glTexParameterfv
+#define glTexParameterfv glad_debug_glTexParameterfv
+GLAPI PFNGLTEXPARAMETERIPROC glad_debug_glTexParameteri;
+#undef glTexParameteri
+#define glTexParameteri glad_debug_glTexParameteri
+GLAPI PFNGLTEXPARAMETERIVPROC glad_debug_glTexParameteriv;
+#undef glTexParameteriv
+#define glTexParameteriv glad_debug_glTexParameteriv
+GLAPI PFNGLTEXIMAGE1DPROC glad_debug_glTexImage1D;
+#undef glTexImage1D
+#define glTexImage1D glad_debug_glTexImage1D
+GLAPI PFNGLTEXIMAGE2DPROC glad_debug_glTexImage2D;
+#undef glTexImage2D
+#define glTexImage2D glad_debug_glTexImage2D
+GLAPI PFNGLDRAWBUFFERPROC glad_debug_glDrawBuffer;
+#undef glDrawBuffer
+#define glDrawBuffer glad_debug_glDrawBuffer
+GLAPI PFNGLCLEARPROC glad_debug_glClear;
+#undef glClear
+#define glClear glad_debug_glClear
+GLAPI PFNGLCLEARCOLORPROC glad_debug_glClearColor;
+#undef glClearColor
+#define glClearColor glad_debug_glClearColor
+GLAPI PFNGLCLEARSTENCILPROC glad_debug_glClearStencil;
+#undef glClearStencil
+#define glClearStencil glad_debug_glClearStencil
+GLAPI PFNGLCLEARDEPTHPROC glad_debug_glClearDepth;
+#undef glClearDepth
+#define glClearDepth glad_debug_glClearDepth
+GLAPI PFNGLSTENCILMASKPROC glad_debug_glStencilMask;
+#undef glStencilMask
+#define glStencilMask glad_debug_glStencilMask
+GLAPI PFNGLCOLORMASKPROC glad_debug_glColorMask;
+#undef glColorMask
+#define glColorMask glad_debug_glColorMask
+GLAPI PFNGLDEPTHMASKPROC glad_debug_glDepthMask;
+#undef glDepthMask
+#define glDepthMask glad_debug_glDepthMask
+GLAPI PFNGLDISABLEPROC glad_debug_glDisable;
+#undef glDisable
+#define glDisable glad_debug_glDisable
+GLAPI PFNGLENABLEPROC glad_debug_glEnable;
+#undef glEnable
+#define glEnable glad_debug_glEnable
+GLAPI PFNGLFINISHPROC glad_debug_glFinish;
+#undef glFinish
+#define glFinish glad_debug_glFinish
+GLAPI PFNGLFLUSHPROC glad_debug_glFlush;
+#undef glFlush
+#define glFlush glad_debug_glFlush
+GLAPI PFNGLBLENDFUNCPROC glad_debug_glBlendFunc;
+#undef glBlendFunc
+#define glBlendFunc glad_debug_glBlendFunc
+GLAPI PFNGLLOGICOPPROC glad_debug_glLogicOp;
+#undef glLogicOp
+#define glLogicOp glad_debug_glLogicOp
+GLAPI PFNGLSTENCILFUNCPROC glad_debug_glStencilFunc;
+#undef glStencilFunc
+#define glStencilFunc glad_debug_glStencilFunc
+GLAPI PFNGLSTENCILOPPROC glad_debug_glStencilOp;
+#undef glStencilOp
+#define glStencilOp glad_debug_glStencilOp
+GLAPI PFNGLDEPTHFUNCPROC glad_debug_glDepthFunc;
+#undef glDepthFunc
+#define glDepthFunc glad_debug_glDepthFunc
+GLAPI PFNGLPIXELSTOREFPROC glad_debug_glPixelStoref;
+#undef glPixelStoref
+#define glPixelStoref glad_debug_glPixelStoref
+GLAPI PFNGLPIXELSTOREIPROC glad_debug_glPixelStorei;
+#undef glPixelStorei
+#define glPixelStorei glad_debug_glPixelStorei
+GLAPI PFNGLREADBUFFERPROC glad_debug_glReadBuffer;
+#undef glReadBuffer
+#define glReadBuffer glad_debug_glReadBuffer
+GLAPI PFNGLREADPIXELSPROC glad_debug_glReadPixels;
+#undef glReadPixels
+#define glReadPixels glad_debug_glReadPixels
+GLAPI PFNGLGETBOOLEANVPROC glad_debug_glGetBooleanv;
+#undef glGetBooleanv
+#define glGetBooleanv glad_debug_glGetBooleanv
+GLAPI PFNGLGETDOUBLEVPROC glad_debug_glGetDoublev;
+#undef glGetDoublev
+#define glGetDoublev glad_debug_glGetDoublev
+GLAPI PFNGLGETERRORPROC glad_debug_glGetError;
+#undef glGetError
+#define glGetError glad_debug_glGetError
+GLAPI PFNGLGETFLOATVPROC glad_debug_glGetFloatv;
+#undef glGetFloatv
+#define glGetFloatv glad_debug_glGetFloatv
+GLAPI PFNGLGETINTEGERVPROC glad_debug_glGetIntegerv;
+#undef glGetIntegerv
+#define glGetIntegerv glad_debug_glGetIntegerv
+GLAPI PFNGLGETSTRINGPROC glad_debug_glGetString;
+#undef glGetString
+#define glGetString glad_debug_glGetString
+GLAPI PFNGLGETTEXIMAGEPROC glad_debug_glGetTexImage;
+#undef glGetTexImage
+#define glGetTexImage glad_debug_glGetTexImage
+GLAPI PFNGLGETTEXPARAMETERFVPROC glad_debug_glGetTexParameterfv;
+#undef glGetTexParameterfv
+#define glGetTexParameterfv glad_debug_glGetTexParameterfv
+GLAPI PFNGLGETTEXPARAMETERIVPROC glad_debug_glGetTexParameteriv;
+#undef glGetTexParameteriv
+#define glGetTexParameteriv glad_debug_glGetTexParameteriv
+GLAPI PFNGLGETTEXLEVELPARAMETERFVPROC glad_debug_glGetTexLevelParameterfv;
+#undef glGetTexLevelParameterfv
+#define glGetTexLevelParameterfv glad_debug_glGetTexLevelParameterfv
+GLAPI PFNGLGETTEXLEVELPARAMETERIVPROC glad_debug_glGetTexLevelParameteriv;
+#undef glGetTexLevelParameteriv
+#define glGetTexLevelParameteriv glad_debug_glGetTexLevelParameteriv
+GLAPI PFNGLISENABLEDPROC glad_debug_glIsEnabled;
+#undef glIsEnabled
+#define glIsEnabled glad_debug_glIsEnabled
+GLAPI PFNGLDEPTHRANGEPROC glad_debug_glDepthRange;
+#undef glDepthRange
+#define glDepthRange glad_debug_glDepthRange
+GLAPI PFNGLVIEWPORTPROC glad_debug_glViewport;
+#undef glViewport
+#define glViewport glad_debug_glViewport
+GLAPI PFNGLDRAWARRAYSPROC glad_debug_glDrawArrays;
+#undef glDrawArrays
+#define glDrawArrays glad_debug_glDrawArrays
+GLAPI PFNGLDRAWELEMENTSPROC glad_debug_glDrawElements;
+#undef glDrawElements
+#define glDrawElements glad_debug_glDrawElements
+GLAPI PFNGLPOLYGONOFFSETPROC glad_debug_glPolygonOffset;
+#undef glPolygonOffset
+#define glPolygonOffset glad_debug_glPolygonOffset
+GLAPI PFNGLCOPYTEXIMAGE1DPROC glad_debug_glCopyTexImage1D;
+#undef glCopyTexImage1D
+#define glCopyTexImage1D glad_debug_glCopyTexImage1D
+GLAPI PFNGLCOPYTEXIMAGE2DPROC glad_debug_glCopyTexImage2D;
+#undef glCopyTexImage2D
+#define glCopyTexImage2D glad_debug_glCopyTexImage2D
+GLAPI PFNGLCOPYTEXSUBIMAGE1DPROC glad_debug_glCopyTexSubImage1D;
+#undef glCopyTexSubImage1D
+#define glCopyTexSubImage1D glad_debug_glCopyTexSubImage1D
+GLAPI PFNGLCOPYTEXSUBIMAGE2DPROC glad_debug_glCopyTexSubImage2D;
+#undef glCopyTexSubImage2D
+#define glCopyTexSubImage2D glad_debug_glCopyTexSubImage2D
+GLAPI PFNGLTEXSUBIMAGE1DPROC glad_debug_glTexSubImage1D;
+#undef glTexSubImage1D
+#define glTexSubImage1D glad_debug_glTexSubImage1D
+GLAPI PFNGLTEXSUBIMAGE2DPROC glad_debug_glTexSubImage2D;
+#undef glTexSubImage2D
+#define glTexSubImage2D glad_debug_glTexSubImage2D
+GLAPI PFNGLBINDTEXTUREPROC glad_debug_glBindTexture;
+#undef glBindTexture
+#define glBindTexture glad_debug_glBindTexture
+GLAPI PFNGLDELETETEXTURESPROC glad_debug_glDeleteTextures;
+#undef glDeleteTextures
+#define glDeleteTextures glad_debug_glDeleteTextures
+GLAPI PFNGLGENTEXTURESPROC glad_debug_glGenTextures;
+#undef glGenTextures
+#define glGenTextures glad_debug_glGenTextures
+GLAPI PFNGLISTEXTUREPROC glad_debug_glIsTexture;
+#undef glIsTexture
+#define glIsTexture glad_debug_glIsTexture
+GLAPI PFNGLDRAWRANGEELEMENTSPROC glad_debug_glDrawRangeElements;
+#undef glDrawRangeElements
+#define glDrawRangeElements glad_debug_glDrawRangeElements
+GLAPI PFNGLTEXIMAGE3DPROC glad_debug_glTexImage3D;
+#undef glTexImage3D
+#define glTexImage3D glad_debug_glTexImage3D
+GLAPI PFNGLTEXSUBIMAGE3DPROC glad_debug_glTexSubImage3D;
+#undef glTexSubImage3D
+#define glTexSubImage3D glad_debug_glTexSubImage3D
+GLAPI PFNGLCOPYTEXSUBIMAGE3DPROC glad_debug_glCopyTexSubImage3D;
+#undef glCopyTexSubImage3D
+#define glCopyTexSubImage3D glad_debug_glCopyTexSubImage3D
+GLAPI PFNGLACTIVETEXTUREPROC glad_debug_glActiveTexture;
+#undef glActiveTexture
+#define glActiveTexture glad_debug_glActiveTexture
+GLAPI PFNGLSAMPLECOVERAGEPROC glad_debug_glSampleCoverage;
+#undef glSampleCoverage
+#define glSampleCoverage glad_debug_glSampleCoverage
+GLAPI PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_debug_glCompressedTexImage3D;
+#undef glCompressedTexImage3D
+#define glCompressedTexImage3D glad_debug_glCompressedTexImage3D
+GLAPI PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_debug_glCompressedTexImage2D;
+#undef glCompressedTexImage2D
+#define glCompressedTexImage2D glad_debug_glCompressedTexImage2D
+GLAPI PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_debug_glCompressedTexImage1D;
+#undef glCompressedTexImage1D
+#define glCompressedTexImage1D glad_debug_glCompressedTexImage1D
+GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_debug_glCompressedTexSubImage3D;
+#undef glCompressedTexSubImage3D
+#define glCompressedTexSubImage3D glad_debug_glCompressedTexSubImage3D
+GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_debug_glCompressedTexSubImage2D;
+#undef glCompressedTexSubImage2D
+#define glCompressedTexSubImage2D glad_debug_glCompressedTexSubImage2D
+GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_debug_glCompressedTexSubImage1D;
+#undef glCompressedTexSubImage1D
+#define glCompressedTexSubImage1D glad_debug_glCompressedTexSubImage1D
+GLAPI PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_debug_glGetCompressedTexImage;
+#undef glGetCompressedTexImage
+#define glGetCompressedTexImage glad_debug_glGetCompressedTexImage
+GLAPI PFNGLBLENDFUNCSEPARATEPROC glad_debug_glBlendFuncSeparate;
+#undef glBlendFuncSeparate
+#define glBlendFuncSeparate glad_debug_glBlendFuncSeparate
+GLAPI PFNGLMULTIDRAWARRAYSPROC glad_debug_glMultiDrawArrays;
+#undef glMultiDrawArrays
+#define glMultiDrawArrays glad_debug_glMultiDrawArrays
+GLAPI PFNGLMULTIDRAWELEMENTSPROC glad_debug_glMultiDrawElements;
+#undef glMultiDrawElements
+#define glMultiDrawElements glad_debug_glMultiDrawElements
+GLAPI PFNGLPOINTPARAMETERFPROC glad_debug_glPointParameterf;
+#undef glPointParameterf
+#define glPointParameterf glad_debug_glPointParameterf
+GLAPI PFNGLPOINTPARAMETERFVPROC glad_debug_glPointParameterfv;
+#undef glPointParameterfv
+#define glPointParameterfv glad_debug_glPointParameterfv
+GLAPI PFNGLPOINTPARAMETERIPROC glad_debug_glPointParameteri;
+#undef glPointParameteri
+#define glPointParameteri glad_debug_glPointParameteri
+GLAPI PFNGLPOINTPARAMETERIVPROC glad_debug_glPointParameteriv;
+#undef glPointParameteriv
+#define glPointParameteriv glad_debug_glPointParameteriv
+GLAPI PFNGLBLENDCOLORPROC glad_debug_glBlendColor;
+#undef glBlendColor
+#define glBlendColor glad_debug_glBlendColor
+GLAPI PFNGLBLENDEQUATIONPROC glad_debug_glBlendEquation;
+#undef glBlendEquation
+#define glBlendEquation glad_debug_glBlendEquation
+GLAPI PFNGLGENQUERIESPROC glad_debug_glGenQueries;
+#undef glGenQueries
+#define glGenQueries glad_debug_glGenQueries
+GLAPI PFNGLDELETEQUERIESPROC glad_debug_glDeleteQueries;
+#undef glDeleteQueries
+#define glDeleteQueries glad_debug_glDeleteQueries
+GLAPI PFNGLISQUERYPROC glad_debug_glIsQuery;
+#undef glIsQuery
+#define glIsQuery glad_debug_glIsQuery
+GLAPI PFNGLBEGINQUERYPROC glad_debug_glBeginQuery;
+#undef glBeginQuery
+#define glBeginQuery glad_debug_glBeginQuery
+GLAPI PFNGLENDQUERYPROC glad_debug_glEndQuery;
+#undef glEndQuery
+#define glEndQuery glad_debug_glEndQuery
+GLAPI PFNGLGETQUERYIVPROC glad_debug_glGetQueryiv;
+#undef glGetQueryiv
+#define glGetQueryiv glad_debug_glGetQueryiv
+GLAPI PFNGLGETQUERYOBJECTIVPROC glad_debug_glGetQueryObjectiv;
+#undef glGetQueryObjectiv
+#define glGetQueryObjectiv glad_debug_glGetQueryObjectiv
+GLAPI PFNGLGETQUERYOBJECTUIVPROC glad_debug_glGetQueryObjectuiv;
+#undef glGetQueryObjectuiv
+#define glGetQueryObjectuiv glad_debug_glGetQueryObjectuiv
+GLAPI PFNGLBINDBUFFERPROC glad_debug_glBindBuffer;
+#undef glBindBuffer
+#define glBindBuffer glad_debug_glBindBuffer
+GLAPI PFNGLDELETEBUFFERSPROC glad_debug_glDeleteBuffers;
+#undef glDeleteBuffers
+#define glDeleteBuffers glad_debug_glDeleteBuffers
+GLAPI PFNGLGENBUFFERSPROC glad_debug_glGenBuffers;
+#undef glGenBuffers
+#define glGenBuffers glad_debug_glGenBuffers
+GLAPI PFNGLISBUFFERPROC glad_debug_glIsBuffer;
+#undef glIsBuffer
+#define glIsBuffer glad_debug_glIsBuffer
+GLAPI PFNGLBUFFERDATAPROC glad_debug_glBufferData;
+#undef glBufferData
+#define glBufferData glad_debug_glBufferData
+GLAPI PFNGLBUFFERSUBDATAPROC glad_debug_glBufferSubData;
+#undef glBufferSubData
+#define glBufferSubData glad_debug_glBufferSubData
+GLAPI PFNGLGETBUFFERSUBDATAPROC glad_debug_glGetBufferSubData;
+#undef glGetBufferSubData
+#define glGetBufferSubData glad_debug_glGetBufferSubData
+GLAPI PFNGLMAPBUFFERPROC glad_debug_glMapBuffer;
+#undef glMapBuffer
+#define glMapBuffer glad_debug_glMapBuffer
+GLAPI PFNGLUNMAPBUFFERPROC glad_debug_glUnmapBuffer;
+#undef glUnmapBuffer
+#define glUnmapBuffer glad_debug_glUnmapBuffer
+GLAPI PFNGLGETBUFFERPARAMETERIVPROC glad_debug_glGetBufferParameteriv;
+#undef glGetBufferParameteriv
+#define glGetBufferParameteriv glad_debug_glGetBufferParameteriv
+GLAPI PFNGLGETBUFFERPOINTERVPROC glad_debug_glGetBufferPointerv;
+#undef glGetBufferPointerv
+#define glGetBufferPointerv glad_debug_glGetBufferPointerv
+GLAPI PFNGLBLENDEQUATIONSEPARATEPROC glad_debug_glBlendEquationSeparate;
+#undef glBlendEquationSeparate
+#define glBlendEquationSeparate glad_debug_glBlendEquationSeparate
+GLAPI PFNGLDRAWBUFFERSPROC glad_debug_glDrawBuffers;
+#undef glDrawBuffers
+#define glDrawBuffers glad_debug_glDrawBuffers
+GLAPI PFNGLSTENCILOPSEPARATEPROC glad_debug_glStencilOpSeparate;
+#undef glStencilOpSeparate
+#define glStencilOpSeparate glad_debug_glStencilOpSeparate
+GLAPI PFNGLSTENCILFUNCSEPARATEPROC glad_debug_glStencilFuncSeparate;
+#undef glStencilFuncSeparate
+#define glStencilFuncSeparate glad_debug_glStencilFuncSeparate
+GLAPI PFNGLSTENCILMASKSEPARATEPROC glad_debug_glStencilMaskSeparate;
+#undef glStencilMaskSeparate
+#define glStencilMaskSeparate glad_debug_glStencilMaskSeparate
+GLAPI PFNGLATTACHSHADERPROC glad_debug_glAttachShader;
+#undef glAttachShader
+#define glAttachShader glad_debug_glAttachShader
+GLAPI PFNGLBINDATTRIBLOCATIONPROC glad_debug_glBindAttribLocation;
+#undef glBindAttribLocation
+#define glBindAttribLocation glad_debug_glBindAttribLocation
+GLAPI PFNGLCOMPILESHADERPROC glad_debug_glCompileShader;
+#undef glCompileShader
+#define glCompileShader glad_debug_glCompileShader
+GLAPI PFNGLCREATEPROGRAMPROC glad_debug_glCreateProgram;
+#undef glCreateProgram
+#define glCreateProgram glad_debug_glCreateProgram
+GLAPI PFNGLCREATESHADERPROC glad_debug_glCreateShader;
+#undef glCreateShader
+#define glCreateShader glad_debug_glCreateShader
+GLAPI PFNGLDELETEPROGRAMPROC glad_debug_glDeleteProgram;
+#undef glDeleteProgram
+#define glDeleteProgram glad_debug_glDeleteProgram
+GLAPI PFNGLDELETESHADERPROC glad_debug_glDeleteShader;
+#undef glDeleteShader
+#define glDeleteShader glad_debug_glDeleteShader
+GLAPI PFNGLDETACHSHADERPROC glad_debug_glDetachShader;
+#undef glDetachShader
+#define glDetachShader glad_debug_glDetachShader
+GLAPI PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_debug_glDisableVertexAttribArray;
+#undef glDisableVertexAttribArray
+#define glDisableVertexAttribArray glad_debug_glDisableVertexAttribArray
+GLAPI PFNGLENABLEVERTEXATTRIBARRAYPROC glad_debug_glEnableVertexAttribArray;
+#undef glEnableVertexAttribArray
+#define glEnableVertexAttribArray glad_debug_glEnableVertexAttribArray
+GLAPI PFNGLGETACTIVEATTRIBPROC glad_debug_glGetActiveAttrib;
+#undef glGetActiveAttrib
+#define glGetActiveAttrib glad_debug_glGetActiveAttrib
+GLAPI PFNGLGETACTIVEUNIFORMPROC glad_debug_glGetActiveUniform;
+#undef glGetActiveUniform
+#define glGetActiveUniform glad_debug_glGetActiveUniform
+GLAPI PFNGLGETATTACHEDSHADERSPROC glad_debug_glGetAttachedShaders;
+#undef glGetAttachedShaders
+#define glGetAttachedShaders glad_debug_glGetAttachedShaders
+GLAPI PFNGLGETATTRIBLOCATIONPROC glad_debug_glGetAttribLocation;
+#undef glGetAttribLocation
+#define glGetAttribLocation glad_debug_glGetAttribLocation
+GLAPI PFNGLGETPROGRAMIVPROC glad_debug_glGetProgramiv;
+#undef glGetProgramiv
+#define glGetProgramiv glad_debug_glGetProgramiv
+GLAPI PFNGLGETPROGRAMINFOLOGPROC glad_debug_glGetProgramInfoLog;
+#undef glGetProgramInfoLog
+#define glGetProgramInfoLog glad_debug_glGetProgramInfoLog
+GLAPI PFNGLGETSHADERIVPROC glad_debug_glGetShaderiv;
+#undef glGetShaderiv
+#define glGetShaderiv glad_debug_glGetShaderiv
+GLAPI PFNGLGETSHADERINFOLOGPROC glad_debug_glGetShaderInfoLog;
+#undef glGetShaderInfoLog
+#define glGetShaderInfoLog glad_debug_glGetShaderInfoLog
+GLAPI PFNGLGETSHADERSOURCEPROC glad_debug_glGetShaderSource;
+#undef glGetShaderSource
+#define glGetShaderSource glad_debug_glGetShaderSource
+GLAPI PFNGLGETUNIFORMLOCATIONPROC glad_debug_glGetUniformLocation;
+#undef glGetUniformLocation
+#define glGetUniformLocation glad_debug_glGetUniformLocation
+GLAPI PFNGLGETUNIFORMFVPROC glad_debug_glGetUniformfv;
+#undef glGetUniformfv
+#define glGetUniformfv glad_debug_glGetUniformfv
+GLAPI PFNGLGETUNIFORMIVPROC glad_debug_glGetUniformiv;
+#undef glGetUniformiv
+#define glGetUniformiv glad_debug_glGetUniformiv
+GLAPI PFNGLGETVERTEXATTRIBDVPROC glad_debug_glGetVertexAttribdv;
+#undef glGetVertexAttribdv
+#define glGetVertexAttribdv glad_debug_glGetVertexAttribdv
+GLAPI PFNGLGETVERTEXATTRIBFVPROC glad_debug_glGetVertexAttribfv;
+#undef glGetVertexAttribfv
+#define glGetVertexAttribfv glad_debug_glGetVertexAttribfv
+GLAPI PFNGLGETVERTEXATTRIBIVPROC glad_debug_glGetVertexAttribiv;
+#undef glGetVertexAttribiv
+#define glGetVertexAttribiv glad_debug_glGetVertexAttribiv
+GLAPI PFNGLGETVERTEXATTRIBPOINTERVPROC glad_debug_glGetVertexAttribPointerv;
+#undef glGetVertexAttribPointerv
+#define glGetVertexAttribPointerv glad_debug_glGetVertexAttribPointerv
+GLAPI PFNGLISPROGRAMPROC glad_debug_glIsProgram;
+#undef glIsProgram
+#define glIsProgram glad_debug_glIsProgram
+GLAPI PFNGLISSHADERPROC glad_debug_glIsShader;
+#undef glIsShader
+#define glIsShader glad_debug_glIsShader
+GLAPI PFNGLLINKPROGRAMPROC glad_debug_glLinkProgram;
+#undef glLinkProgram
+#define glLinkProgram glad_debug_glLinkProgram
+GLAPI PFNGLSHADERSOURCEPROC glad_debug_glShaderSource;
+#undef glShaderSource
+#define glShaderSource glad_debug_glShaderSource
+GLAPI PFNGLUSEPROGRAMPROC glad_debug_glUseProgram;
+#undef glUseProgram
+#define glUseProgram glad_debug_glUseProgram
+GLAPI PFNGLUNIFORM1FPROC glad_debug_glUniform1f;
+#undef glUniform1f
+#define glUniform1f glad_debug_glUniform1f
+GLAPI PFNGLUNIFORM2FPROC glad_debug_glUniform2f;
+#undef glUniform2f
+#define glUniform2f glad_debug_glUniform2f
+GLAPI PFNGLUNIFORM3FPROC glad_debug_glUniform3f;
+#undef glUniform3f
+#define glUniform3f glad_debug_glUniform3f
+GLAPI PFNGLUNIFORM4FPROC glad_debug_glUniform4f;
+#undef glUniform4f
+#define glUniform4f glad_debug_glUniform4f
+GLAPI PFNGLUNIFORM1IPROC glad_debug_glUniform1i;
+#undef glUniform1i
+#define glUniform1i glad_debug_glUniform1i
+GLAPI PFNGLUNIFORM2IPROC glad_debug_glUniform2i;
+#undef glUniform2i
+#define glUniform2i glad_debug_glUniform2i
+GLAPI PFNGLUNIFORM3IPROC glad_debug_glUniform3i;
+#undef glUniform3i
+#define glUniform3i glad_debug_glUniform3i
+GLAPI PFNGLUNIFORM4IPROC glad_debug_glUniform4i;
+#undef glUniform4i
+#define glUniform4i glad_debug_glUniform4i
+GLAPI PFNGLUNIFORM1FVPROC glad_debug_glUniform1fv;
+#undef glUniform1fv
+#define glUniform1fv glad_debug_glUniform1fv
+GLAPI PFNGLUNIFORM2FVPROC glad_debug_glUniform2fv;
+#undef glUniform2fv
+#define glUniform2fv glad_debug_glUniform2fv
+GLAPI PFNGLUNIFORM3FVPROC glad_debug_glUniform3fv;
+#undef glUniform3fv
+#define glUniform3fv glad_debug_glUniform3fv
+GLAPI PFNGLUNIFORM4FVPROC glad_debug_glUniform4fv;
+#undef glUniform4fv
+#define glUniform4fv glad_debug_glUniform4fv
+GLAPI PFNGLUNIFORM1IVPROC glad_debug_glUniform1iv;
+#undef glUniform1iv
+#define glUniform1iv glad_debug_glUniform1iv
+GLAPI PFNGLUNIFORM2IVPROC glad_debug_glUniform2iv;
+#undef glUniform2iv
+#define glUniform2iv glad_debug_glUniform2iv
+GLAPI PFNGLUNIFORM3IVPROC glad_debug_glUniform3iv;
+#undef glUniform3iv
+#define glUniform3iv glad_debug_glUniform3iv
+GLAPI PFNGLUNIFORM4IVPROC glad_debug_glUniform4iv;
+#undef glUniform4iv
+#define glUniform4iv glad_debug_glUniform4iv
+GLAPI PFNGLUNIFORMMATRIX2FVPROC glad_debug_glUniformMatrix2fv;
+#undef glUniformMatrix2fv
+#define glUniformMatrix2fv glad_debug_glUniformMatrix2fv
+GLAPI PFNGLUNIFORMMATRIX3FVPROC glad_debug_glUniformMatrix3fv;
+#undef glUniformMatrix3fv
+#define glUniformMatrix3fv glad_debug_glUniformMatrix3fv
+GLAPI PFNGLUNIFORMMATRIX4FVPROC glad_debug_glUniformMatrix4fv;
+#undef glUniformMatrix4fv
+#define glUniformMatrix4fv glad_debug_glUniformMatrix4fv
+GLAPI PFNGLVALIDATEPROGRAMPROC glad_debug_glValidateProgram;
+#undef glValidateProgram
+#define glValidateProgram glad_debug_glValidateProgram
+GLAPI PFNGLVERTEXATTRIB1DPROC glad_debug_glVertexAttrib1d;
+#undef glVertexAttrib1d
+#define glVertexAttrib1d glad_debug_glVertexAttrib1d
+GLAPI PFNGLVERTEXATTRIB1DVPROC glad_debug_glVertexAttrib1dv;
+#undef glVertexAttrib1dv
+#define glVertexAttrib1dv glad_debug_glVertexAttrib1dv
+GLAPI PFNGLVERTEXATTRIB1FPROC glad_debug_glVertexAttrib1f;
+#undef glVertexAttrib1f
+#define glVertexAttrib1f glad_debug_glVertexAttrib1f
+GLAPI PFNGLVERTEXATTRIB1FVPROC glad_debug_glVertexAttrib1fv;
+#undef glVertexAttrib1fv
+#define glVertexAttrib1fv glad_debug_glVertexAttrib1fv
+GLAPI PFNGLVERTEXATTRIB1SPROC glad_debug_glVertexAttrib1s;
+#undef glVertexAttrib1s
+#define glVertexAttrib1s glad_debug_glVertexAttrib1s
+GLAPI PFNGLVERTEXATTRIB1SVPROC glad_debug_glVertexAttrib1sv;
+#undef glVertexAttrib1sv
+#define glVertexAttrib1sv glad_debug_glVertexAttrib1sv
+GLAPI PFNGLVERTEXATTRIB2DPROC glad_debug_glVertexAttrib2d;
+#undef glVertexAttrib2d
+#define glVertexAttrib2d glad_debug_glVertexAttrib2d
+GLAPI PFNGLVERTEXATTRIB2DVPROC glad_debug_glVertexAttrib2dv;
+#undef glVertexAttrib2dv
+#define glVertexAttrib2dv glad_debug_glVertexAttrib2dv
+GLAPI PFNGLVERTEXATTRIB2FPROC glad_debug_glVertexAttrib2f;
+#undef glVertexAttrib2f
+#define glVertexAttrib2f glad_debug_glVertexAttrib2f
+GLAPI PFNGLVERTEXATTRIB2FVPROC glad_debug_glVertexAttrib2fv;
+#undef glVertexAttrib2fv
+#define glVertexAttrib2fv glad_debug_glVertexAttrib2fv
+GLAPI PFNGLVERTEXATTRIB2SPROC glad_debug_glVertexAttrib2s;
+#undef glVertexAttrib2s
+#define glVertexAttrib2s glad_debug_glVertexAttrib2s
+GLAPI PFNGLVERTEXATTRIB2SVPROC glad_debug_glVertexAttrib2sv;
+#undef glVertexAttrib2sv
+#define glVertexAttrib2sv glad_debug_glVertexAttrib2sv
+GLAPI PFNGLVERTEXATTRIB3DPROC glad_debug_glVertexAttrib3d;
+#undef glVertexAttrib3d
+#define glVertexAttrib3d glad_debug_glVertexAttrib3d
+GLAPI PFNGLVERTEXATTRIB3DVPROC glad_debug_glVertexAttrib3dv;
+#undef glVertexAttrib3dv
+#define glVertexAttrib3dv glad_debug_glVertexAttrib3dv
+GLAPI PFNGLVERTEXATTRIB3FPROC glad_debug_glVertexAttrib3f;
+#undef glVertexAttrib3f
+#define glVertexAttrib3f glad_debug_glVertexAttrib3f
+GLAPI PFNGLVERTEXATTRIB3FVPROC glad_debug_glVertexAttrib3fv;
+#undef glVertexAttrib3fv
+#define glVertexAttrib3fv glad_debug_glVertexAttrib3fv
+GLAPI PFNGLVERTEXATTRIB3SPROC glad_debug_glVertexAttrib3s;
+#undef glVertexAttrib3s
+#define glVertexAttrib3s glad_debug_glVertexAttrib3s
+GLAPI PFNGLVERTEXATTRIB3SVPROC glad_debug_glVertexAttrib3sv;
+#undef glVertexAttrib3sv
+#define glVertexAttrib3sv glad_debug_glVertexAttrib3sv
+GLAPI PFNGLVERTEXATTRIB4NBVPROC glad_debug_glVertexAttrib4Nbv;
+#undef glVertexAttrib4Nbv
+#define glVertexAttrib4Nbv glad_debug_glVertexAttrib4Nbv
+GLAPI PFNGLVERTEXATTRIB4NIVPROC glad_debug_glVertexAttrib4Niv;
+#undef glVertexAttrib4Niv
+#define glVertexAttrib4Niv glad_debug_glVertexAttrib4Niv
+GLAPI PFNGLVERTEXATTRIB4NSVPROC glad_debug_glVertexAttrib4Nsv;
+#undef glVertexAttrib4Nsv
+#define glVertexAttrib4Nsv glad_debug_glVertexAttrib4Nsv
+GLAPI PFNGLVERTEXATTRIB4NUBPROC glad_debug_glVertexAttrib4Nub;
+#undef glVertexAttrib4Nub
+#define glVertexAttrib4Nub glad_debug_glVertexAttrib4Nub
+GLAPI PFNGLVERTEXATTRIB4NUBVPROC glad_debug_glVertexAttrib4Nubv;
+#undef glVertexAttrib4Nubv
+#define glVertexAttrib4Nubv glad_debug_glVertexAttrib4Nubv
+GLAPI PFNGLVERTEXATTRIB4NUIVPROC glad_debug_glVertexAttrib4Nuiv;
+#undef glVertexAttrib4Nuiv
+#define glVertexAttrib4Nuiv glad_debug_glVertexAttrib4Nuiv
+GLAPI PFNGLVERTEXATTRIB4NUSVPROC glad_debug_glVertexAttrib4Nusv;
+#undef glVertexAttrib4Nusv
+#define glVertexAttrib4Nusv glad_debug_glVertexAttrib4Nusv
+GLAPI PFNGLVERTEXATTRIB4BVPROC glad_debug_glVertexAttrib4bv;
+#undef glVertexAttrib4bv
+#define glVertexAttrib4bv glad_debug_glVertexAttrib4bv
+GLAPI PFNGLVERTEXATTRIB4DPROC glad_debug_glVertexAttrib4d;
+#undef glVertexAttrib4d
+#define glVertexAttrib4d glad_debug_glVertexAttrib4d
+GLAPI PFNGLVERTEXATTRIB4DVPROC glad_debug_glVertexAttrib4dv;
+#undef glVertexAttrib4dv
+#define glVertexAttrib4dv glad_debug_glVertexAttrib4dv
+GLAPI PFNGLVERTEXATTRIB4FPROC glad_debug_glVertexAttrib4f;
+#undef glVertexAttrib4f
+#define glVertexAttrib4f glad_debug_glVertexAttrib4f
+GLAPI PFNGLVERTEXATTRIB4FVPROC glad_debug_glVertexAttrib4fv;
+#undef glVertexAttrib4fv
+#define glVertexAttrib4fv glad_debug_glVertexAttrib4fv
+GLAPI PFNGLVERTEXATTRIB4IVPROC glad_debug_glVertexAttrib4iv;
+#undef glVertexAttrib4iv
+#define glVertexAttrib4iv glad_debug_glVertexAttrib4iv
+GLAPI PFNGLVERTEXATTRIB4SPROC glad_debug_glVertexAttrib4s;
+#undef glVertexAttrib4s
+#define glVertexAttrib4s glad_debug_glVertexAttrib4s
+GLAPI PFNGLVERTEXATTRIB4SVPROC glad_debug_glVertexAttrib4sv;
+#undef glVertexAttrib4sv
+#define glVertexAttrib4sv glad_debug_glVertexAttrib4sv
+GLAPI PFNGLVERTEXATTRIB4UBVPROC glad_debug_glVertexAttrib4ubv;
+#undef glVertexAttrib4ubv
+#define glVertexAttrib4ubv glad_debug_glVertexAttrib4ubv
+GLAPI PFNGLVERTEXATTRIB4UIVPROC glad_debug_glVertexAttrib4uiv;
+#undef glVertexAttrib4uiv
+#define glVertexAttrib4uiv glad_debug_glVertexAttrib4uiv
+GLAPI PFNGLVERTEXATTRIB4USVPROC glad_debug_glVertexAttrib4usv;
+#undef glVertexAttrib4usv
+#define glVertexAttrib4usv glad_debug_glVertexAttrib4usv
+GLAPI PFNGLVERTEXATTRIBPOINTERPROC glad_debug_glVertexAttribPointer;
+#undef glVertexAttribPointer
+#define glVertexAttribPointer glad_debug_glVertexAttribPointer
+GLAPI PFNGLUNIFORMMATRIX2X3FVPROC glad_debug_glUniformMatrix2x3fv;
+#undef glUniformMatrix2x3fv
+#define glUniformMatrix2x3fv glad_debug_glUniformMatrix2x3fv
+GLAPI PFNGLUNIFORMMATRIX3X2FVPROC glad_debug_glUniformMatrix3x2fv;
+#undef glUniformMatrix3x2fv
+#define glUniformMatrix3x2fv glad_debug_glUniformMatrix3x2fv
+GLAPI PFNGLUNIFORMMATRIX2X4FVPROC glad_debug_glUniformMatrix2x4fv;
+#undef glUniformMatrix2x4fv
+#define glUniformMatrix2x4fv glad_debug_glUniformMatrix2x4fv
+GLAPI PFNGLUNIFORMMATRIX4X2FVPROC glad_debug_glUniformMatrix4x2fv;
+#undef glUniformMatrix4x2fv
+#define glUniformMatrix4x2fv glad_debug_glUniformMatrix4x2fv
+GLAPI PFNGLUNIFORMMATRIX3X4FVPROC glad_debug_glUniformMatrix3x4fv;
+#undef glUniformMatrix3x4fv
+#define glUniformMatrix3x4fv glad_debug_glUniformMatrix3x4fv
+GLAPI PFNGLUNIFORMMATRIX4X3FVPROC glad_debug_glUniformMatrix4x3fv;
+#undef glUniformMatrix4x3fv
+#define glUniformMatrix4x3fv glad_debug_glUniformMatrix4x3fv
+GLAPI PFNGLCOLORMASKIPROC glad_debug_glColorMaski;
+#undef glColorMaski
+#define glColorMaski glad_debug_glColorMaski
+GLAPI PFNGLGETBOOLEANI_VPROC glad_debug_glGetBooleani_v;
+#undef glGetBooleani_v
+#define glGetBooleani_v glad_debug_glGetBooleani_v
+GLAPI PFNGLGETINTEGERI_VPROC glad_debug_glGetIntegeri_v;
+#undef glGetIntegeri_v
+#define glGetIntegeri_v glad_debug_glGetIntegeri_v
+GLAPI PFNGLENABLEIPROC glad_debug_glEnablei;
+#undef glEnablei
+#define glEnablei glad_debug_glEnablei
+GLAPI PFNGLDISABLEIPROC glad_debug_glDisablei;
+#undef glDisablei
+#define glDisablei glad_debug_glDisablei
+GLAPI PFNGLISENABLEDIPROC glad_debug_glIsEnabledi;
+#undef glIsEnabledi
+#define glIsEnabledi glad_debug_glIsEnabledi
+GLAPI PFNGLBEGINTRANSFORMFEEDBACKPROC glad_debug_glBeginTransformFeedback;
+#undef glBeginTransformFeedback
+#define glBeginTransformFeedback glad_debug_glBeginTransformFeedback
+GLAPI PFNGLENDTRANSFORMFEEDBACKPROC glad_debug_glEndTransformFeedback;
+#undef glEndTransformFeedback
+#define glEndTransformFeedback glad_debug_glEndTransformFeedback
+GLAPI PFNGLBINDBUFFERRANGEPROC glad_debug_glBindBufferRange;
+#undef glBindBufferRange
+#define glBindBufferRange glad_debug_glBindBufferRange
+GLAPI PFNGLBINDBUFFERBASEPROC glad_debug_glBindBufferBase;
+#undef glBindBufferBase
+#define glBindBufferBase glad_debug_glBindBufferBase
+GLAPI PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_debug_glTransformFeedbackVaryings;
+#undef glTransformFeedbackVaryings
+#define glTransformFeedbackVaryings glad_debug_glTransformFeedbackVaryings
+GLAPI PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_debug_glGetTransformFeedbackVarying;
+#undef glGetTransformFeedbackVarying
+#define glGetTransformFeedbackVarying glad_debug_glGetTransformFeedbackVarying
+GLAPI PFNGLCLAMPCOLORPROC glad_debug_glClampColor;
+#undef glClampColor
+#define glClampColor glad_debug_glClampColor
+GLAPI PFNGLBEGINCONDITIONALRENDERPROC glad_debug_glBeginConditionalRender;
+#undef glBeginConditionalRender
+#define glBeginConditionalRender glad_debug_glBeginConditionalRender
+GLAPI PFNGLENDCONDITIONALRENDERPROC glad_debug_glEndConditionalRender;
+#undef glEndConditionalRender
+#define glEndConditionalRender glad_debug_glEndConditionalRender
+GLAPI PFNGLVERTEXATTRIBIPOINTERPROC glad_debug_glVertexAttribIPointer;
+#undef glVertexAttribIPointer
+#define glVertexAttribIPointer glad_debug_glVertexAttribIPointer
+GLAPI PFNGLGETVERTEXATTRIBIIVPROC glad_debug_glGetVertexAttribIiv;
+#undef glGetVertexAttribIiv
+#define glGetVertexAttribIiv glad_debug_glGetVertexAttribIiv
+GLAPI PFNGLGETVERTEXATTRIBIUIVPROC glad_debug_glGetVertexAttribIuiv;
+#undef glGetVertexAttribIuiv
+#define glGetVertexAttribIuiv glad_debug_glGetVertexAttribIuiv
+GLAPI PFNGLVERTEXATTRIBI1IPROC glad_debug_glVertexAttribI1i;
+#undef glVertexAttribI1i
+#define glVertexAttribI1i glad_debug_glVertexAttribI1i
+GLAPI PFNGLVERTEXATTRIBI2IPROC glad_debug_glVertexAttribI2i;
+#undef glVertexAttribI2i
+#define glVertexAttribI2i glad_debug_glVertexAttribI2i
+GLAPI PFNGLVERTEXATTRIBI3IPROC glad_debug_glVertexAttribI3i;
+#undef glVertexAttribI3i
+#define glVertexAttribI3i glad_debug_glVertexAttribI3i
+GLAPI PFNGLVERTEXATTRIBI4IPROC glad_debug_glVertexAttribI4i;
+#undef glVertexAttribI4i
+#define glVertexAttribI4i glad_debug_glVertexAttribI4i
+GLAPI PFNGLVERTEXATTRIBI1UIPROC glad_debug_glVertexAttribI1ui;
+#undef glVertexAttribI1ui
+#define glVertexAttribI1ui glad_debug_glVertexAttribI1ui
+GLAPI PFNGLVERTEXATTRIBI2UIPROC glad_debug_glVertexAttribI2ui;
+#undef glVertexAttribI2ui
+#define glVertexAttribI2ui glad_debug_glVertexAttribI2ui
+GLAPI PFNGLVERTEXATTRIBI3UIPROC glad_debug_glVertexAttribI3ui;
+#undef glVertexAttribI3ui
+#define glVertexAttribI3ui glad_debug_glVertexAttribI3ui
+GLAPI PFNGLVERTEXATTRIBI4UIPROC glad_debug_glVertexAttribI4ui;
+#undef glVertexAttribI4ui
+#define glVertexAttribI4ui glad_debug_glVertexAttribI4ui
+GLAPI PFNGLVERTEXATTRIBI1IVPROC glad_debug_glVertexAttribI1iv;
+#undef glVertexAttribI1iv
+#define glVertexAttribI1iv glad_debug_glVertexAttribI1iv
+GLAPI PFNGLVERTEXATTRIBI2IVPROC glad_debug_glVertexAttribI2iv;
+#undef glVertexAttribI2iv
+#define glVertexAttribI2iv glad_debug_glVertexAttribI2iv
+GLAPI PFNGLVERTEXATTRIBI3IVPROC glad_debug_glVertexAttribI3iv;
+#undef glVertexAttribI3iv
+#define glVertexAttribI3iv glad_debug_glVertexAttribI3iv
+GLAPI PFNGLVERTEXATTRIBI4IVPROC glad_debug_glVertexAttribI4iv;
+#undef glVertexAttribI4iv
+#define glVertexAttribI4iv glad_debug_glVertexAttribI4iv
+GLAPI PFNGLVERTEXATTRIBI1UIVPROC glad_debug_glVertexAttribI1uiv;
+#undef glVertexAttribI1uiv
+#define glVertexAttribI1uiv glad_debug_glVertexAttribI1uiv
+GLAPI PFNGLVERTEXATTRIBI2UIVPROC glad_debug_glVertexAttribI2uiv;
+#undef glVertexAttribI2uiv
+#define glVertexAttribI2uiv glad_debug_glVertexAttribI2uiv
+GLAPI PFNGLVERTEXATTRIBI3UIVPROC glad_debug_glVertexAttribI3uiv;
+#undef glVertexAttribI3uiv
+#define glVertexAttribI3uiv glad_debug_glVertexAttribI3uiv
+GLAPI PFNGLVERTEXATTRIBI4UIVPROC glad_debug_glVertexAttribI4uiv;
+#undef glVertexAttribI4uiv
+#define glVertexAttribI4uiv glad_debug_glVertexAttribI4uiv
+GLAPI PFNGLVERTEXATTRIBI4BVPROC glad_debug_glVertexAttribI4bv;
+#undef glVertexAttribI4bv
+#define glVertexAttribI4bv glad_debug_glVertexAttribI4bv
+GLAPI PFNGLVERTEXATTRIBI4SVPROC glad_debug_glVertexAttribI4sv;
+#undef glVertexAttribI4sv
+#define glVertexAttribI4sv glad_debug_glVertexAttribI4sv
+GLAPI PFNGLVERTEXATTRIBI4UBVPROC glad_debug_glVertexAttribI4ubv;
+#undef glVertexAttribI4ubv
+#define glVertexAttribI4ubv glad_debug_glVertexAttribI4ubv
+GLAPI PFNGLVERTEXATTRIBI4USVPROC glad_debug_glVertexAttribI4usv;
+#undef glVertexAttribI4usv
+#define glVertexAttribI4usv glad_debug_glVertexAttribI4usv
+GLAPI PFNGLGETUNIFORMUIVPROC glad_debug_glGetUniformuiv;
+#undef glGetUniformuiv
+#define glGetUniformuiv glad_debug_glGetUniformuiv
+GLAPI PFNGLBINDFRAGDATALOCATIONPROC glad_debug_glBindFragDataLocation;
+#undef glBindFragDataLocation
+#define glBindFragDataLocation glad_debug_glBindFragDataLocation
+GLAPI PFNGLGETFRAGDATALOCATIONPROC glad_debug_glGetFragDataLocation;
+#undef glGetFragDataLocation
+#define glGetFragDataLocation glad_debug_glGetFragDataLocation
+GLAPI PFNGLUNIFORM1UIPROC glad_debug_glUniform1ui;
+#undef glUniform1ui
+#define glUniform1ui glad_debug_glUniform1ui
+GLAPI PFNGLUNIFORM2UIPROC glad_debug_glUniform2ui;
+#undef glUniform2ui
+#define glUniform2ui glad_debug_glUniform2ui
+GLAPI PFNGLUNIFORM3UIPROC glad_debug_glUniform3ui;
+#undef glUniform3ui
+#define glUniform3ui glad_debug_glUniform3ui
+GLAPI PFNGLUNIFORM4UIPROC glad_debug_glUniform4ui;
+#undef glUniform4ui
+#define glUniform4ui glad_debug_glUniform4ui
+GLAPI PFNGLUNIFORM1UIVPROC glad_debug_glUniform1uiv;
+#undef glUniform1uiv
+#define glUniform1uiv glad_debug_glUniform1uiv
+GLAPI PFNGLUNIFORM2UIVPROC glad_debug_glUniform2uiv;
+#undef glUniform2uiv
+#define glUniform2uiv glad_debug_glUniform2uiv
+GLAPI PFNGLUNIFORM3UIVPROC glad_debug_glUniform3uiv;
+#undef glUniform3uiv
+#define glUniform3uiv glad_debug_glUniform3uiv
+GLAPI PFNGLUNIFORM4UIVPROC glad_debug_glUniform4uiv;
+#undef glUniform4uiv
+#define glUniform4uiv glad_debug_glUniform4uiv
+GLAPI PFNGLTEXPARAMETERIIVPROC glad_debug_glTexParameterIiv;
+#undef glTexParameterIiv
+#define glTexParameterIiv glad_debug_glTexParameterIiv
+GLAPI PFNGLTEXPARAMETERIUIVPROC glad_debug_glTexParameterIuiv;
+#undef glTexParameterIuiv
+#define glTexParameterIuiv glad_debug_glTexParameterIuiv
+GLAPI PFNGLGETTEXPARAMETERIIVPROC glad_debug_glGetTexParameterIiv;
+#undef glGetTexParameterIiv
+#define glGetTexParameterIiv glad_debug_glGetTexParameterIiv
+GLAPI PFNGLGETTEXPARAMETERIUIVPROC glad_debug_glGetTexParameterIuiv;
+#undef glGetTexParameterIuiv
+#define glGetTexParameterIuiv glad_debug_glGetTexParameterIuiv
+GLAPI PFNGLCLEARBUFFERIVPROC glad_debug_glClearBufferiv;
+#undef glClearBufferiv
+#define glClearBufferiv glad_debug_glClearBufferiv
+GLAPI PFNGLCLEARBUFFERUIVPROC glad_debug_glClearBufferuiv;
+#undef glClearBufferuiv
+#define glClearBufferuiv glad_debug_glClearBufferuiv
+GLAPI PFNGLCLEARBUFFERFVPROC glad_debug_glClearBufferfv;
+#undef glClearBufferfv
+#define glClearBufferfv glad_debug_glClearBufferfv
+GLAPI PFNGLCLEARBUFFERFIPROC glad_debug_glClearBufferfi;
+#undef glClearBufferfi
+#define glClearBufferfi glad_debug_glClearBufferfi
+GLAPI PFNGLGETSTRINGIPROC glad_debug_glGetStringi;
+#undef glGetStringi
+#define glGetStringi glad_debug_glGetStringi
+GLAPI PFNGLISRENDERBUFFERPROC glad_debug_glIsRenderbuffer;
+#undef glIsRenderbuffer
+#define glIsRenderbuffer glad_debug_glIsRenderbuffer
+GLAPI PFNGLBINDRENDERBUFFERPROC glad_debug_glBindRenderbuffer;
+#undef glBindRenderbuffer
+#define glBindRenderbuffer glad_debug_glBindRenderbuffer
+GLAPI PFNGLDELETERENDERBUFFERSPROC glad_debug_glDeleteRenderbuffers;
+#undef glDeleteRenderbuffers
+#define glDeleteRenderbuffers glad_debug_glDeleteRenderbuffers
+GLAPI PFNGLGENRENDERBUFFERSPROC glad_debug_glGenRenderbuffers;
+#undef glGenRenderbuffers
+#define glGenRenderbuffers glad_debug_glGenRenderbuffers
+GLAPI PFNGLRENDERBUFFERSTORAGEPROC glad_debug_glRenderbufferStorage;
+#undef glRenderbufferStorage
+#define glRenderbufferStorage glad_debug_glRenderbufferStorage
+GLAPI PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_debug_glGetRenderbufferParameteriv;
+#undef glGetRenderbufferParameteriv
+#define glGetRenderbufferParameteriv glad_debug_glGetRenderbufferParameteriv
+GLAPI PFNGLISFRAMEBUFFERPROC glad_debug_glIsFramebuffer;
+#undef glIsFramebuffer
+#define glIsFramebuffer glad_debug_glIsFramebuffer
+GLAPI PFNGLBINDFRAMEBUFFERPROC glad_debug_glBindFramebuffer;
+#undef glBindFramebuffer
+#define glBindFramebuffer glad_debug_glBindFramebuffer
+GLAPI PFNGLDELETEFRAMEBUFFERSPROC glad_debug_glDeleteFramebuffers;
+#undef glDeleteFramebuffers
+#define glDeleteFramebuffers glad_debug_glDeleteFramebuffers
+GLAPI PFNGLGENFRAMEBUFFERSPROC glad_debug_glGenFramebuffers;
+#undef glGenFramebuffers
+#define glGenFramebuffers glad_debug_glGenFramebuffers
+GLAPI PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_debug_glCheckFramebufferStatus;
+#undef glCheckFramebufferStatus
+#define glCheckFramebufferStatus glad_debug_glCheckFramebufferStatus
+GLAPI PFNGLFRAMEBUFFERTEXTURE1DPROC glad_debug_glFramebufferTexture1D;
+#undef glFramebufferTexture1D
+#define glFramebufferTexture1D glad_debug_glFramebufferTexture1D
+GLAPI PFNGLFRAMEBUFFERTEXTURE2DPROC glad_debug_glFramebufferTexture2D;
+#undef glFramebufferTexture2D
+#define glFramebufferTexture2D glad_debug_glFramebufferTexture2D
+GLAPI PFNGLFRAMEBUFFERTEXTURE3DPROC glad_debug_glFramebufferTexture3D;
+#undef glFramebufferTexture3D
+#define glFramebufferTexture3D glad_debug_glFramebufferTexture3D
+GLAPI PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_debug_glFramebufferRenderbuffer;
+#undef glFramebufferRenderbuffer
+#define glFramebufferRenderbuffer glad_debug_glFramebufferRenderbuffer
+GLAPI PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_debug_glGetFramebufferAttachmentParameteriv;
+#undef glGetFramebufferAttachmentParameteriv
+#define glGetFramebufferAttachmentParameteriv glad_debug_glGetFramebufferAttachmentParameteriv
+GLAPI PFNGLGENERATEMIPMAPPROC glad_debug_glGenerateMipmap;
+#undef glGenerateMipmap
+#define glGenerateMipmap glad_debug_glGenerateMipmap
+GLAPI PFNGLBLITFRAMEBUFFERPROC glad_debug_glBlitFramebuffer;
+#undef glBlitFramebuffer
+#define glBlitFramebuffer glad_debug_glBlitFramebuffer
+GLAPI PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_debug_glRenderbufferStorageMultisample;
+#undef glRenderbufferStorageMultisample
+#define glRenderbufferStorageMultisample glad_debug_glRenderbufferStorageMultisample
+GLAPI PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_debug_glFramebufferTextureLayer;
+#undef glFramebufferTextureLayer
+#define glFramebufferTextureLayer glad_debug_glFramebufferTextureLayer
+GLAPI PFNGLMAPBUFFERRANGEPROC glad_debug_glMapBufferRange;
+#undef glMapBufferRange
+#define glMapBufferRange glad_debug_glMapBufferRange
+GLAPI PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_debug_glFlushMappedBufferRange;
+#undef glFlushMappedBufferRange
+#define glFlushMappedBufferRange glad_debug_glFlushMappedBufferRange
+GLAPI PFNGLBINDVERTEXARRAYPROC glad_debug_glBindVertexArray;
+#undef glBindVertexArray
+#define glBindVertexArray glad_debug_glBindVertexArray
+GLAPI PFNGLDELETEVERTEXARRAYSPROC glad_debug_glDeleteVertexArrays;
+#undef glDeleteVertexArrays
+#define glDeleteVertexArrays glad_debug_glDeleteVertexArrays
+GLAPI PFNGLGENVERTEXARRAYSPROC glad_debug_glGenVertexArrays;
+#undef glGenVertexArrays
+#define glGenVertexArrays glad_debug_glGenVertexArrays
+GLAPI PFNGLISVERTEXARRAYPROC glad_debug_glIsVertexArray;
+#undef glIsVertexArray
+#define glIsVertexArray glad_debug_glIsVertexArray
+GLAPI PFNGLDRAWARRAYSINSTANCEDPROC glad_debug_glDrawArraysInstanced;
+#undef glDrawArraysInstanced
+#define glDrawArraysInstanced glad_debug_glDrawArraysInstanced
+GLAPI PFNGLDRAWELEMENTSINSTANCEDPROC glad_debug_glDrawElementsInstanced;
+#undef glDrawElementsInstanced
+#define glDrawElementsInstanced glad_debug_glDrawElementsInstanced
+GLAPI PFNGLTEXBUFFERPROC glad_debug_glTexBuffer;
+#undef glTexBuffer
+#define glTexBuffer glad_debug_glTexBuffer
+GLAPI PFNGLPRIMITIVERESTARTINDEXPROC glad_debug_glPrimitiveRestartIndex;
+#undef glPrimitiveRestartIndex
+#define glPrimitiveRestartIndex glad_debug_glPrimitiveRestartIndex
+GLAPI PFNGLCOPYBUFFERSUBDATAPROC glad_debug_glCopyBufferSubData;
+#undef glCopyBufferSubData
+#define glCopyBufferSubData glad_debug_glCopyBufferSubData
+GLAPI PFNGLGETUNIFORMINDICESPROC glad_debug_glGetUniformIndices;
+#undef glGetUniformIndices
+#define glGetUniformIndices glad_debug_glGetUniformIndices
+GLAPI PFNGLGETACTIVEUNIFORMSIVPROC glad_debug_glGetActiveUniformsiv;
+#undef glGetActiveUniformsiv
+#define glGetActiveUniformsiv glad_debug_glGetActiveUniformsiv
+GLAPI PFNGLGETACTIVEUNIFORMNAMEPROC glad_debug_glGetActiveUniformName;
+#undef glGetActiveUniformName
+#define glGetActiveUniformName glad_debug_glGetActiveUniformName
+GLAPI PFNGLGETUNIFORMBLOCKINDEXPROC glad_debug_glGetUniformBlockIndex;
+#undef glGetUniformBlockIndex
+#define glGetUniformBlockIndex glad_debug_glGetUniformBlockIndex
+GLAPI PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_debug_glGetActiveUniformBlockiv;
+#undef glGetActiveUniformBlockiv
+#define glGetActiveUniformBlockiv glad_debug_glGetActiveUniformBlockiv
+GLAPI PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_debug_glGetActiveUniformBlockName;
+#undef glGetActiveUniformBlockName
+#define glGetActiveUniformBlockName glad_debug_glGetActiveUniformBlockName
+GLAPI PFNGLUNIFORMBLOCKBINDINGPROC glad_debug_glUniformBlockBinding;
+#undef glUniformBlockBinding
+#define glUniformBlockBinding glad_debug_glUniformBlockBinding
+GLAPI PFNGLDRAWELEMENTSBASEVERTEXPROC glad_debug_glDrawElementsBaseVertex;
+#undef glDrawElementsBaseVertex
+#define glDrawElementsBaseVertex glad_debug_glDrawElementsBaseVertex
+GLAPI PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_debug_glDrawRangeElementsBaseVertex;
+#undef glDrawRangeElementsBaseVertex
+#define glDrawRangeElementsBaseVertex glad_debug_glDrawRangeElementsBaseVertex
+GLAPI PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_debug_glDrawElementsInstancedBaseVertex;
+#undef glDrawElementsInstancedBaseVertex
+#define glDrawElementsInstancedBaseVertex glad_debug_glDrawElementsInstancedBaseVertex
+GLAPI PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_debug_glMultiDrawElementsBaseVertex;
+#undef glMultiDrawElementsBaseVertex
+#define glMultiDrawElementsBaseVertex glad_debug_glMultiDrawElementsBaseVertex
+GLAPI PFNGLPROVOKINGVERTEXPROC glad_debug_glProvokingVertex;
+#undef glProvokingVertex
+#define glProvokingVertex glad_debug_glProvokingVertex
+GLAPI PFNGLFENCESYNCPROC glad_debug_glFenceSync;
+#undef glFenceSync
+#define glFenceSync glad_debug_glFenceSync
+GLAPI PFNGLISSYNCPROC glad_debug_glIsSync;
+#undef glIsSync
+#define glIsSync glad_debug_glIsSync
+GLAPI PFNGLDELETESYNCPROC glad_debug_glDeleteSync;
+#undef glDeleteSync
+#define glDeleteSync glad_debug_glDeleteSync
+GLAPI PFNGLCLIENTWAITSYNCPROC glad_debug_glClientWaitSync;
+#undef glClientWaitSync
+#define glClientWaitSync glad_debug_glClientWaitSync
+GLAPI PFNGLWAITSYNCPROC glad_debug_glWaitSync;
+#undef glWaitSync
+#define glWaitSync glad_debug_glWaitSync
+GLAPI PFNGLGETINTEGER64VPROC glad_debug_glGetInteger64v;
+#undef glGetInteger64v
+#define glGetInteger64v glad_debug_glGetInteger64v
+GLAPI PFNGLGETSYNCIVPROC glad_debug_glGetSynciv;
+#undef glGetSynciv
+#define glGetSynciv glad_debug_glGetSynciv
+GLAPI PFNGLGETINTEGER64I_VPROC glad_debug_glGetInteger64i_v;
+#undef glGetInteger64i_v
+#define glGetInteger64i_v glad_debug_glGetInteger64i_v
+GLAPI PFNGLGETBUFFERPARAMETERI64VPROC glad_debug_glGetBufferParameteri64v;
+#undef glGetBufferParameteri64v
+#define glGetBufferParameteri64v glad_debug_glGetBufferParameteri64v
+GLAPI PFNGLFRAMEBUFFERTEXTUREPROC glad_debug_glFramebufferTexture;
+#undef glFramebufferTexture
+#define glFramebufferTexture glad_debug_glFramebufferTexture
+GLAPI PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_debug_glTexImage2DMultisample;
+#undef glTexImage2DMultisample
+#define glTexImage2DMultisample glad_debug_glTexImage2DMultisample
+GLAPI PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_debug_glTexImage3DMultisample;
+#undef glTexImage3DMultisample
+#define glTexImage3DMultisample glad_debug_glTexImage3DMultisample
+GLAPI PFNGLGETMULTISAMPLEFVPROC glad_debug_glGetMultisamplefv;
+#undef glGetMultisamplefv
+#define glGetMultisamplefv glad_debug_glGetMultisamplefv
+GLAPI PFNGLSAMPLEMASKIPROC glad_debug_glSampleMaski;
+#undef glSampleMaski
+#define glSampleMaski glad_debug_glSampleMaski
+GLAPI PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_debug_glBindFragDataLocationIndexed;
+#undef glBindFragDataLocationIndexed
+#define glBindFragDataLocationIndexed glad_debug_glBindFragDataLocationIndexed
+GLAPI PFNGLGETFRAGDATAINDEXPROC glad_debug_glGetFragDataIndex;
+#undef glGetFragDataIndex
+#define glGetFragDataIndex glad_debug_glGetFragDataIndex
+GLAPI PFNGLGENSAMPLERSPROC glad_debug_glGenSamplers;
+#undef glGenSamplers
+#define glGenSamplers glad_debug_glGenSamplers
+GLAPI PFNGLDELETESAMPLERSPROC glad_debug_glDeleteSamplers;
+#undef glDeleteSamplers
+#define glDeleteSamplers glad_debug_glDeleteSamplers
+GLAPI PFNGLISSAMPLERPROC glad_debug_glIsSampler;
+#undef glIsSampler
+#define glIsSampler glad_debug_glIsSampler
+GLAPI PFNGLBINDSAMPLERPROC glad_debug_glBindSampler;
+#undef glBindSampler
+#define glBindSampler glad_debug_glBindSampler
+GLAPI PFNGLSAMPLERPARAMETERIPROC glad_debug_glSamplerParameteri;
+#undef glSamplerParameteri
+#define glSamplerParameteri glad_debug_glSamplerParameteri
+GLAPI PFNGLSAMPLERPARAMETERIVPROC glad_debug_glSamplerParameteriv;
+#undef glSamplerParameteriv
+#define glSamplerParameteriv glad_debug_glSamplerParameteriv
+GLAPI PFNGLSAMPLERPARAMETERFPROC glad_debug_glSamplerParameterf;
+#undef glSamplerParameterf
+#define glSamplerParameterf glad_debug_glSamplerParameterf
+GLAPI PFNGLSAMPLERPARAMETERFVPROC glad_debug_glSamplerParameterfv;
+#undef glSamplerParameterfv
+#define glSamplerParameterfv glad_debug_glSamplerParameterfv
+GLAPI PFNGLSAMPLERPARAMETERIIVPROC glad_debug_glSamplerParameterIiv;
+#undef glSamplerParameterIiv
+#define glSamplerParameterIiv glad_debug_glSamplerParameterIiv
+GLAPI PFNGLSAMPLERPARAMETERIUIVPROC glad_debug_glSamplerParameterIuiv;
+#undef glSamplerParameterIuiv
+#define glSamplerParameterIuiv glad_debug_glSamplerParameterIuiv
+GLAPI PFNGLGETSAMPLERPARAMETERIVPROC glad_debug_glGetSamplerParameteriv;
+#undef glGetSamplerParameteriv
+#define glGetSamplerParameteriv glad_debug_glGetSamplerParameteriv
+GLAPI PFNGLGETSAMPLERPARAMETERIIVPROC glad_debug_glGetSamplerParameterIiv;
+#undef glGetSamplerParameterIiv
+#define glGetSamplerParameterIiv glad_debug_glGetSamplerParameterIiv
+GLAPI PFNGLGETSAMPLERPARAMETERFVPROC glad_debug_glGetSamplerParameterfv;
+#undef glGetSamplerParameterfv
+#define glGetSamplerParameterfv glad_debug_glGetSamplerParameterfv
+GLAPI PFNGLGETSAMPLERPARAMETERIUIVPROC glad_debug_glGetSamplerParameterIuiv;
+#undef glGetSamplerParameterIuiv
+#define glGetSamplerParameterIuiv glad_debug_glGetSamplerParameterIuiv
+GLAPI PFNGLQUERYCOUNTERPROC glad_debug_glQueryCounter;
+#undef glQueryCounter
+#define glQueryCounter glad_debug_glQueryCounter
+GLAPI PFNGLGETQUERYOBJECTI64VPROC glad_debug_glGetQueryObjecti64v;
+#undef glGetQueryObjecti64v
+#define glGetQueryObjecti64v glad_debug_glGetQueryObjecti64v
+GLAPI PFNGLGETQUERYOBJECTUI64VPROC glad_debug_glGetQueryObjectui64v;
+#undef glGetQueryObjectui64v
+#define glGetQueryObjectui64v glad_debug_glGetQueryObjectui64v
+GLAPI PFNGLVERTEXATTRIBDIVISORPROC glad_debug_glVertexAttribDivisor;
+#undef glVertexAttribDivisor
+#define glVertexAttribDivisor glad_debug_glVertexAttribDivisor
+GLAPI PFNGLVERTEXATTRIBP1UIPROC glad_debug_glVertexAttribP1ui;
+#undef glVertexAttribP1ui
+#define glVertexAttribP1ui glad_debug_glVertexAttribP1ui
+GLAPI PFNGLVERTEXATTRIBP1UIVPROC glad_debug_glVertexAttribP1uiv;
+#undef glVertexAttribP1uiv
+#define glVertexAttribP1uiv glad_debug_glVertexAttribP1uiv
+GLAPI PFNGLVERTEXATTRIBP2UIPROC glad_debug_glVertexAttribP2ui;
+#undef glVertexAttribP2ui
+#define glVertexAttribP2ui glad_debug_glVertexAttribP2ui
+GLAPI PFNGLVERTEXATTRIBP2UIVPROC glad_debug_glVertexAttribP2uiv;
+#undef glVertexAttribP2uiv
+#define glVertexAttribP2uiv glad_debug_glVertexAttribP2uiv
+GLAPI PFNGLVERTEXATTRIBP3UIPROC glad_debug_glVertexAttribP3ui;
+#undef glVertexAttribP3ui
+#define glVertexAttribP3ui glad_debug_glVertexAttribP3ui
+GLAPI PFNGLVERTEXATTRIBP3UIVPROC glad_debug_glVertexAttribP3uiv;
+#undef glVertexAttribP3uiv
+#define glVertexAttribP3uiv glad_debug_glVertexAttribP3uiv
+GLAPI PFNGLVERTEXATTRIBP4UIPROC glad_debug_glVertexAttribP4ui;
+#undef glVertexAttribP4ui
+#define glVertexAttribP4ui glad_debug_glVertexAttribP4ui
+GLAPI PFNGLVERTEXATTRIBP4UIVPROC glad_debug_glVertexAttribP4uiv;
+#undef glVertexAttribP4uiv
+#define glVertexAttribP4uiv glad_debug_glVertexAttribP4uiv
+GLAPI PFNGLVERTEXP2UIPROC glad_debug_glVertexP2ui;
+#undef glVertexP2ui
+#define glVertexP2ui glad_debug_glVertexP2ui
+GLAPI PFNGLVERTEXP2UIVPROC glad_debug_glVertexP2uiv;
+#undef glVertexP2uiv
+#define glVertexP2uiv glad_debug_glVertexP2uiv
+GLAPI PFNGLVERTEXP3UIPROC glad_debug_glVertexP3ui;
+#undef glVertexP3ui
+#define glVertexP3ui glad_debug_glVertexP3ui
+GLAPI PFNGLVERTEXP3UIVPROC glad_debug_glVertexP3uiv;
+#undef glVertexP3uiv
+#define glVertexP3uiv glad_debug_glVertexP3uiv
+GLAPI PFNGLVERTEXP4UIPROC glad_debug_glVertexP4ui;
+#undef glVertexP4ui
+#define glVertexP4ui glad_debug_glVertexP4ui
+GLAPI PFNGLVERTEXP4UIVPROC glad_debug_glVertexP4uiv;
+#undef glVertexP4uiv
+#define glVertexP4uiv glad_debug_glVertexP4uiv
+GLAPI PFNGLTEXCOORDP1UIPROC glad_debug_glTexCoordP1ui;
+#undef glTexCoordP1ui
+#define glTexCoordP1ui glad_debug_glTexCoordP1ui
+GLAPI PFNGLTEXCOORDP1UIVPROC glad_debug_glTexCoordP1uiv;
+#undef glTexCoordP1uiv
+#define glTexCoordP1uiv glad_debug_glTexCoordP1uiv
+GLAPI PFNGLTEXCOORDP2UIPROC glad_debug_glTexCoordP2ui;
+#undef glTexCoordP2ui
+#define glTexCoordP2ui glad_debug_glTexCoordP2ui
+GLAPI PFNGLTEXCOORDP2UIVPROC glad_debug_glTexCoordP2uiv;
+#undef glTexCoordP2uiv
+#define glTexCoordP2uiv glad_debug_glTexCoordP2uiv
+GLAPI PFNGLTEXCOORDP3UIPROC glad_debug_glTexCoordP3ui;
+#undef glTexCoordP3ui
+#define glTexCoordP3ui glad_debug_glTexCoordP3ui
+GLAPI PFNGLTEXCOORDP3UIVPROC glad_debug_glTexCoordP3uiv;
+#undef glTexCoordP3uiv
+#define glTexCoordP3uiv glad_debug_glTexCoordP3uiv
+GLAPI PFNGLTEXCOORDP4UIPROC glad_debug_glTexCoordP4ui;
+#undef glTexCoordP4ui
+#define glTexCoordP4ui glad_debug_glTexCoordP4ui
+GLAPI PFNGLTEXCOORDP4UIVPROC glad_debug_glTexCoordP4uiv;
+#undef glTexCoordP4uiv
+#define glTexCoordP4uiv glad_debug_glTexCoordP4uiv
+GLAPI PFNGLMULTITEXCOORDP1UIPROC glad_debug_glMultiTexCoordP1ui;
+#undef glMultiTexCoordP1ui
+#define glMultiTexCoordP1ui glad_debug_glMultiTexCoordP1ui
+GLAPI PFNGLMULTITEXCOORDP1UIVPROC glad_debug_glMultiTexCoordP1uiv;
+#undef glMultiTexCoordP1uiv
+#define glMultiTexCoordP1uiv glad_debug_glMultiTexCoordP1uiv
+GLAPI PFNGLMULTITEXCOORDP2UIPROC glad_debug_glMultiTexCoordP2ui;
+#undef glMultiTexCoordP2ui
+#define glMultiTexCoordP2ui glad_debug_glMultiTexCoordP2ui
+GLAPI PFNGLMULTITEXCOORDP2UIVPROC glad_debug_glMultiTexCoordP2uiv;
+#undef glMultiTexCoordP2uiv
+#define glMultiTexCoordP2uiv glad_debug_glMultiTexCoordP2uiv
+GLAPI PFNGLMULTITEXCOORDP3UIPROC glad_debug_glMultiTexCoordP3ui;
+#undef glMultiTexCoordP3ui
+#define glMultiTexCoordP3ui glad_debug_glMultiTexCoordP3ui
+GLAPI PFNGLMULTITEXCOORDP3UIVPROC glad_debug_glMultiTexCoordP3uiv;
+#undef glMultiTexCoordP3uiv
+#define glMultiTexCoordP3uiv glad_debug_glMultiTexCoordP3uiv
+GLAPI PFNGLMULTITEXCOORDP4UIPROC glad_debug_glMultiTexCoordP4ui;
+#undef glMultiTexCoordP4ui
+#define glMultiTexCoordP4ui glad_debug_glMultiTexCoordP4ui
+GLAPI PFNGLMULTITEXCOORDP4UIVPROC glad_debug_glMultiTexCoordP4uiv;
+#undef glMultiTexCoordP4uiv
+#define glMultiTexCoordP4uiv glad_debug_glMultiTexCoordP4uiv
+GLAPI PFNGLNORMALP3UIPROC glad_debug_glNormalP3ui;
+#undef glNormalP3ui
+#define glNormalP3ui glad_debug_glNormalP3ui
+GLAPI PFNGLNORMALP3UIVPROC glad_debug_glNormalP3uiv;
+#undef glNormalP3uiv
+#define glNormalP3uiv glad_debug_glNormalP3uiv
+GLAPI PFNGLCOLORP3UIPROC glad_debug_glColorP3ui;
+#undef glColorP3ui
+#define glColorP3ui glad_debug_glColorP3ui
+GLAPI PFNGLCOLORP3UIVPROC glad_debug_glColorP3uiv;
+#undef glColorP3uiv
+#define glColorP3uiv glad_debug_glColorP3uiv
+GLAPI PFNGLCOLORP4UIPROC glad_debug_glColorP4ui;
+#undef glColorP4ui
+#define glColorP4ui glad_debug_glColorP4ui
+GLAPI PFNGLCOLORP4UIVPROC glad_debug_glColorP4uiv;
+#undef glColorP4uiv
+#define glColorP4uiv glad_debug_glColorP4uiv
+GLAPI PFNGLSECONDARYCOLORP3UIPROC glad_debug_glSecondaryColorP3ui;
+#undef glSecondaryColorP3ui
+#define glSecondaryColorP3ui glad_debug_glSecondaryColorP3ui
+GLAPI PFNGLSECONDARYCOLORP3UIVPROC glad_debug_glSecondaryColorP3uiv;
+#undef glSecondaryColorP3uiv
+#define glSecondaryColorP3uiv glad_debug_glSecondaryColorP3uiv
+#endif
+/* End of debug mode */
+
 #ifdef __cplusplus
 }
 #endif
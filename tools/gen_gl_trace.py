@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+"""Generate OpenGlProject/GLTraceFunctions.inl from include/glad/glad.h.
+
+For every function glad loads this emits
+  - a capture wrapper that records the call (and known payloads) and forwards to the real entry point,
+  - a replay case that decodes the record, remaps object names and calls the function again.
+The few calls that need more than that (shader sources, buffer mapping, uniform locations) are routed
+to hand-written hooks in GLTrace.cpp.
+
+Usage (from the repository root): python3 tools/gen_gl_trace.py
+"""
+import os
+import re
+
+from glad_parse import ROOT, load_functions
+
+OUTPUT = os.path.join(ROOT, "OpenGlProject", "GLTraceFunctions.inl")
+
+# Pointer arguments whose contents are recorded: function -> (parameter, byte count expression)
+PAYLOADS = {
+    "glBufferData": ("data", "(size_t)size"),
+    "glBufferSubData": ("data", "(size_t)size"),
+    "glTexImage2D": ("pixels", "traceImageBytes(width, height, format, type)"),
+    "glTexSubImage2D": ("pixels", "traceImageBytes(width, height, format, type)"),
+    "glCompressedTexImage2D": ("data", "(size_t)imageSize"),
+    "glCompressedTexSubImage2D": ("data", "(size_t)imageSize"),
+    "glGetUniformLocation": ("name", "strlen(name) + 1"),
+    "glGetAttribLocation": ("name", "strlen(name) + 1"),
+    "glBindAttribLocation": ("name", "strlen(name) + 1"),
+    "glBindFragDataLocation": ("name", "strlen(name) + 1"),
+    "glGetUniformBlockIndex": ("uniformBlockName", "strlen(uniformBlockName) + 1"),
+    "glDrawBuffers": ("bufs", "(size_t)n * sizeof(GLenum)"),
+    "glClearBufferfv": ("value", "4 * sizeof(GLfloat)"),
+    "glClearBufferiv": ("value", "4 * sizeof(GLint)"),
+    "glClearBufferuiv": ("value", "4 * sizeof(GLuint)"),
+    "glTexParameterfv": ("params", "4 * sizeof(GLfloat)"),
+    "glTexParameteriv": ("params", "4 * sizeof(GLint)"),
+}
+
+# Object namespaces for GLuint parameters, by parameter name
+NAMESPACES = {
+    "buffer": "BUFFER", "texture": "TEXTURE", "array": "VERTEX_ARRAY", "framebuffer": "FRAMEBUFFER",
+    "renderbuffer": "RENDERBUFFER", "program": "PROGRAM", "shader": "SHADER", "sampler": "SAMPLER",
+}
+
+# glGen*/glDelete* suffix -> namespace
+GEN_NAMESPACES = {
+    "Buffers": "BUFFER", "Textures": "TEXTURE", "VertexArrays": "VERTEX_ARRAY", "Framebuffers": "FRAMEBUFFER",
+    "Renderbuffers": "RENDERBUFFER", "Queries": "QUERY", "Samplers": "SAMPLER",
+}
+
+# Functions whose return value is a new object name
+CREATES = {"glCreateShader": "SHADER", "glCreateProgram": "PROGRAM"}
+
+HOOK_BEFORE = {"glShaderSource", "glUnmapBuffer", "glBindBuffer", "glPixelStorei"}  # traceHook_<name>(args) sees the call first
+HOOK_AFTER = {"glMapBufferRange", "glMapBuffer"}  # traceAfter_<name>(args, result) remembers the mapping
+REPLAY_HANDWRITTEN = {"glShaderSource", "glMapBufferRange", "glMapBuffer", "glUnmapBuffer",
+                      "glGetUniformLocation", "glUseProgram", "glDeleteSync"}
+
+
+def payload_for(name):
+    if name in PAYLOADS:
+        return PAYLOADS[name]
+    m = re.match(r"glUniform(\d)(f|i|ui)v$", name)
+    if m:
+        return ("value", "(size_t)count * %s * 4" % m.group(1))
+    m = re.match(r"glUniformMatrix(\d)(?:x(\d))?fv$", name)
+    if m:
+        rows, columns = m.group(1), m.group(2) or m.group(1)
+        return ("value", "(size_t)count * %s * %s * 4" % (rows, columns))
+    return None
+
+
+def gen_namespace(name):
+    m = re.match(r"gl(Gen|Delete)(\w+)$", name)
+    if m and m.group(2) in GEN_NAMESPACES:
+        return m.group(1), GEN_NAMESPACES[m.group(2)]
+    return None, None
+
+
+def replay_argument(function, index, ptype, pname, payload):
+    value = "a[%d]" % index
+    if "*" in ptype:
+        if payload and payload[0] == pname:
+            return "(%s)replayPointer(%s, payload, payloadSize)" % (ptype, value)
+        if pname in ("pointer", "indices"):
+            return "(%s)(uintptr_t)%s" % (ptype, value)  # Offset into the bound buffer
+        return "(%s)replayScratch()" % ptype  # Output parameter
+    if ptype == "GLsync":
+        return "replaySync(%s)" % value
+    if ptype in ("GLfloat", "GLclampf"):
+        return "replayFloat(%s)" % value
+    if ptype in ("GLdouble", "GLclampd"):
+        return "replayDouble(%s)" % value
+    if ptype == "GLuint" and pname in NAMESPACES:
+        return "replayName(TRACE_NS_%s, %s)" % (NAMESPACES[pname], value)
+    if ptype == "GLuint" and pname == "id" and ("Query" in function or "Conditional" in function):
+        return "replayName(TRACE_NS_QUERY, %s)" % value
+    if ptype == "GLint" and pname == "location":
+        return "replayLocation(%s)" % value
+    return "(%s)%s" % (ptype, value)
+
+
+def main():
+    functions = load_functions()
+    out = ["// Generated by tools/gen_gl_trace.py from include/glad/glad.h; do not edit.", ""]
+
+    out.append("enum TraceFunction")
+    out.append("{")
+    out += ["    TRACE_%s," % name for name, _, _, _ in functions]
+    out.append("    TRACE_FUNCTION_COUNT")
+    out.append("};")
+    out.append("")
+    out.append("static const char* traceNames[TRACE_FUNCTION_COUNT] = {")
+    out += ['    "%s",' % name for name, _, _, _ in functions]
+    out.append("};")
+    out.append("")
+    out.append("static void* traceReal[TRACE_FUNCTION_COUNT]; // Entry points the wrappers forward to")
+    out.append("")
+
+    # Capture wrappers
+    for name, result, params, pfn in functions:
+        args = ", ".join(p for _, p in params)
+        signature = ", ".join("%s %s" % (t, p) for t, p in params) or "void"
+        payload = payload_for(name)
+        kind, namespace = gen_namespace(name)
+        out.append("static %s APIENTRY trace_%s(%s)" % (result, name, signature))
+        out.append("{")
+        out.append("    %s real = (%s)traceReal[TRACE_%s];" % (pfn, pfn, name))
+        out.append("    if (!traceActive())")
+        out.append("        return real(%s);" % args)
+        out.append("    traceBegin(TRACE_%s, %d);" % (name, len(params)))
+        for _, p in params:
+            out.append("    traceArg(%s);" % p)
+        if payload:
+            out.append("    tracePayload(%s, %s);" % (payload[0], payload[1]))
+        if kind == "Delete":
+            out.append("    tracePayload(%s, (size_t)%s * sizeof(GLuint));" % (params[1][1], params[0][1]))
+        if name in HOOK_BEFORE:
+            out.append("    traceHook_%s(%s);" % (name, args))
+        call = "real(%s)" % args
+        if result == "void":
+            out.append("    %s;" % call)
+        else:
+            out.append("    %s result = %s;" % (result, call))
+        if kind == "Gen":
+            out.append("    tracePayload(%s, (size_t)%s * sizeof(GLuint));" % (params[1][1], params[0][1]))
+        if name in HOOK_AFTER:
+            out.append("    traceAfter_%s(%s, result);" % (name, args))
+        if result != "void":
+            out.append("    traceResult(result);")
+        out.append("    traceEnd();")
+        if result != "void":
+            out.append("    return result;")
+        out.append("}")
+        out.append("")
+
+    # Install / remove
+    out.append("static void installTraceWrappers()")
+    out.append("{")
+    for name, _, _, pfn in functions:
+        out.append("    if ((traceReal[TRACE_%s] = (void*)glad_%s)) glad_%s = trace_%s;" % (name, name, name, name))
+    out.append("}")
+    out.append("")
+    out.append("static void removeTraceWrappers()")
+    out.append("{")
+    for name, _, _, pfn in functions:
+        out.append("    if (traceReal[TRACE_%s]) glad_%s = (%s)traceReal[TRACE_%s];" % (name, name, pfn, name))
+    out.append("}")
+    out.append("")
+
+    # Replay
+    out.append("static void replayDispatch(int function, const uint64_t* a, const char* payload, uint32_t payloadSize, uint64_t result)")
+    out.append("{")
+    out.append("    switch (function)")
+    out.append("    {")
+    for name, ret, params, _ in functions:
+        payload = payload_for(name)
+        kind, namespace = gen_namespace(name)
+        if name in REPLAY_HANDWRITTEN:
+            body = "replay_%s(a, payload, payloadSize, result);" % name
+        elif kind == "Gen":
+            body = ("{ std::vector<GLuint> names((size_t)std::max<int64_t>(0, (int64_t)a[0])); glad_%s((GLsizei)names.size(), names.data()); "
+                    "replayBindNames(TRACE_NS_%s, payload, payloadSize, names); }" % (name, namespace))
+        elif kind == "Delete":
+            body = ("{ std::vector<GLuint> names = replayNames(TRACE_NS_%s, payload, payloadSize); glad_%s((GLsizei)names.size(), names.data()); }"
+                    % (namespace, name))
+        else:
+            call = "glad_%s(%s)" % (name, ", ".join(replay_argument(name, i, t, p, payload) for i, (t, p) in enumerate(params)))
+            if name in CREATES:
+                body = "replayBindName(TRACE_NS_%s, result, %s);" % (CREATES[name], call)
+            elif name == "glFenceSync":
+                body = "replayBindSync(result, %s);" % call
+            else:
+                body = "%s;" % call
+        out.append("    case TRACE_%s: %s break;" % (name, body))
+    out.append("    }")
+    out.append("}")
+
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(out) + "\n")
+    print("%d functions -> %s" % (len(functions), OUTPUT))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""Add per-context GL function tables ("MX") to include/glad/glad.h and glad.c.
+
+GladGLContext holds every function glad loads plus the context's version; gladLoadGLContext fills one for the
+current context through any getProcAddress, loading only the functions of the core versions that context has.
+gladSetGLContext selects the table the calling thread's gl* calls go through.
+
+With GLAD_MX defined the gl* names check one global flag first: while every table loaded so far matches glad's
+global pointers (one driver, any number of contexts) they call the global pointer directly, as without GLAD_MX.
+Once a table differs (a second driver, such as a window plus an EGL or OSMesa capture), calls go through the
+calling thread's table, or the global pointers if the thread has none. The debug wrappers of
+tools/gen_glad_debug.py forward through the same lookup.
+
+Run it again after regenerating glad; the blocks it added before are replaced. Keep the debug block after this one
+(running this script inserts its header block in front of an existing debug block).
+
+Usage (from the repository root): python3 tools/gen_glad_context.py
+"""
+import os
+import re
+
+from glad_parse import HEADER, ROOT, load_functions, load_pointers_directly, load_version_groups
+
+SOURCE = os.path.join(ROOT, "glad.c")
+
+BEGIN = "/* Per-context function tables: generated by tools/gen_glad_context.py */"
+END = "/* End of per-context function tables */"
+DEBUG_BEGIN = "/* Debug mode: generated by tools/gen_glad_debug.py */"
+
+
+def strip_block(text):
+    """Remove a previously generated block, with the blank line that precedes it."""
+    return re.sub(r"\n" + re.escape(BEGIN) + r".*?" + re.escape(END) + r"\n", "", text, flags=re.S)
+
+
+def member(name):
+    return name[2:]  # glCullFace -> CullFace, as in glad 2
+
+
+def header_block(functions):
+    lines = [BEGIN, "#include <stddef.h>",
+             "typedef struct GladGLContext {",
+             "    struct gladGLversionStruct version;"]
+    for name, _, _, pfn in functions:
+        lines.append("    %s %s;" % (pfn, member(name)))
+    lines += ["} GladGLContext;",
+              "GLAPI int gladLoadGLContext(GladGLContext *context, GLADloadproc load);",
+              "GLAPI void gladSetGLContext(const GladGLContext *context);",
+              "GLAPI const GladGLContext *gladGetGLContext(void);",
+              "GLAPI void *gladGLContextFunction(size_t offset, void *global);",
+              "GLAPI int glad_gl_multiple_tables;",
+              "#ifdef GLAD_MX",
+              "/* Read on every call from every thread while another thread may load a table: a relaxed atomic load,",
+              "   which is a plain load on x86 and ARM */",
+              "#if defined(_MSC_VER)",
+              "#include <intrin.h>",
+              "#define GLAD_GL_MULTIPLE_TABLES() __iso_volatile_load32((const volatile __int32 *)&glad_gl_multiple_tables)",
+              "#else",
+              "#define GLAD_GL_MULTIPLE_TABLES() __atomic_load_n(&glad_gl_multiple_tables, __ATOMIC_RELAXED)",
+              "#endif",
+              "#define GLAD_GL_FUNCTION(type, member, global) (GLAD_GL_MULTIPLE_TABLES() ? "
+              "(type)gladGLContextFunction(offsetof(GladGLContext, member), (void*)(global)) : (global))"]
+    for name, _, _, pfn in functions:
+        lines.append("#undef %s" % name)
+        lines.append("#define %s GLAD_GL_FUNCTION(%s, %s, glad_%s)" % (name, pfn, member(name), name))
+    lines += ["#else",
+              "#define GLAD_GL_FUNCTION(type, member, global) (global)",
+              "#endif",
+              END]
+    return "\n".join(lines) + "\n"
+
+
+def source_block(functions, groups):
+    pfns = {name: pfn for name, _, _, pfn in functions}
+    lines = [BEGIN,
+             "#if defined(_MSC_VER)",
+             "#define GLAD_THREAD_LOCAL __declspec(thread)",
+             "#else",
+             "#define GLAD_THREAD_LOCAL __thread",
+             "#endif",
+             "#if defined(_MSC_VER)",
+             "#include <intrin.h>",
+             "#define GLAD_GL_SET_MULTIPLE_TABLES() _InterlockedExchange((volatile long *)&glad_gl_multiple_tables, 1)",
+             "#else",
+             "#define GLAD_GL_SET_MULTIPLE_TABLES() __atomic_store_n(&glad_gl_multiple_tables, 1, __ATOMIC_RELAXED)",
+             "#endif",
+             "int glad_gl_multiple_tables = 0; /* Only ever goes from 0 to 1, atomically: gl* calls on other threads read it */",
+             "static GLAD_THREAD_LOCAL const GladGLContext *glad_gl_current_table = NULL;",
+             "",
+             "static int glad_gl_table_matches_globals(const GladGLContext *context) {"]
+    comparisons = ["context->%s == glad_%s" % (member(name), name) for name, _, _, _ in functions]
+    lines.append("    return " + "\n        && ".join(comparisons) + ";")
+    lines += ["}",
+              "",
+              "int gladLoadGLContext(GladGLContext *context, GLADloadproc load) {",
+              "    const char *version;",
+              "    int major = 0, minor = 0;",
+              "    memset(context, 0, sizeof(*context));",
+              '    context->GetString = (PFNGLGETSTRINGPROC)load("glGetString");',
+              "    if(context->GetString == NULL) return 0;",
+              "    version = (const char *)context->GetString(GL_VERSION);",
+              "    if(version == NULL) return 0;",
+              "    while(*version && (*version < '0' || *version > '9')) version++; /* \"OpenGL ES \" and similar prefixes */",
+              "#ifdef _MSC_VER",
+              '    sscanf_s(version, "%d.%d", &major, &minor);',
+              "#else",
+              '    sscanf(version, "%d.%d", &major, &minor);',
+              "#endif",
+              "    context->version.major = major; context->version.minor = minor;"]
+    for (group_major, group_minor), names in groups:
+        lines.append("    if(major > %d || (major == %d && minor >= %d)) {" % (group_major, group_major, group_minor))
+        for name in names:
+            lines.append('        context->%s = (%s)load("%s");' % (member(name), pfns[name], name))
+        lines.append("    }")
+    lines += ["    if(!glad_gl_table_matches_globals(context)) GLAD_GL_SET_MULTIPLE_TABLES(); /* Leaves the fast path for good */",
+              "    return major != 0 || minor != 0;",
+              "}",
+              "",
+              "void gladSetGLContext(const GladGLContext *context) {",
+              "    glad_gl_current_table = context;",
+              "}",
+              "",
+              "const GladGLContext *gladGetGLContext(void) {",
+              "    return glad_gl_current_table;",
+              "}",
+              "",
+              "void *gladGLContextFunction(size_t offset, void *global) {",
+              "    const GladGLContext *context = glad_gl_current_table;",
+              "    return context ? *(void * const *)((const char *)context + offset) : global;",
+              "}",
+              END]
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    functions = load_functions()
+
+    with open(HEADER) as f:
+        header = strip_block(f.read())
+    at = header.find("\n" + DEBUG_BEGIN)
+    if at < 0:
+        at = header.rindex("\n#ifdef __cplusplus\n}\n#endif\n\n#endif")
+    header = header[:at] + "\n" + header_block(functions) + header[at:]
+    with open(HEADER, "w") as f:
+        f.write(header)
+
+    with open(SOURCE) as f:
+        source = load_pointers_directly(strip_block(f.read()))
+    groups = load_version_groups(source)
+    source = source.rstrip("\n") + "\n\n" + source_block(functions, groups)
+    with open(SOURCE, "w") as f:
+        f.write(source)
+    print("%d functions in %d version groups -> %s, %s" % (len(functions), len(groups), HEADER, SOURCE))
+
+
+if __name__ == "__main__":
+    main()
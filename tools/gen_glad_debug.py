@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""Add the GLAD_DEBUG build mode to include/glad/glad.h and glad.c, and generate OpenGlProject/GLDebugFunctions.inl.
+
+With GLAD_DEBUG defined, every gl* name maps to a wrapper that calls a pre-call callback, the loaded function and
+a post-call callback, each with the function name, the loaded pointer and the arguments (the same interface as
+glad's own C debug generator). The wrappers call through GLAD_GL_FUNCTION, so with GLAD_MX they use the calling
+thread's function table (tools/gen_glad_context.py, which must have run first). Without GLAD_DEBUG the added
+blocks compile to nothing and gl* stay the raw pointers.
+GLDebugFunctions.inl lists the argument kinds of every function so GLDebug.cpp can print the arguments it gets
+through the callbacks' varargs.
+
+Run it again after regenerating glad; the blocks it added before are replaced.
+
+Usage (from the repository root): python3 tools/gen_glad_debug.py
+"""
+import os
+import re
+
+from glad_parse import HEADER, ROOT, load_functions, load_pointers_directly
+
+SOURCE = os.path.join(ROOT, "glad.c")
+OUTPUT = os.path.join(ROOT, "OpenGlProject", "GLDebugFunctions.inl")
+
+BEGIN = "/* Debug mode: generated by tools/gen_glad_debug.py */"
+END = "/* End of debug mode */"
+
+# Argument kind after default argument promotion, as GLDebug.cpp reads it back with va_arg
+KINDS = {
+    "GLenum": "e", "GLbitfield": "x", "GLboolean": "u", "GLubyte": "u", "GLuint": "u", "GLint": "i", "GLsizei": "i",
+    "GLshort": "i", "GLfloat": "f", "GLdouble": "f", "GLintptr": "z", "GLsizeiptr": "z", "GLint64": "l", "GLuint64": "L",
+    "GLsync": "p",
+}
+
+
+def kind_of(param_type):
+    return "p" if "*" in param_type else KINDS[param_type]
+
+
+def strip_block(text):
+    """Remove a previously generated block, with the blank line that precedes it."""
+    return re.sub(r"\n" + re.escape(BEGIN) + r".*?" + re.escape(END) + r"\n", "", text, flags=re.S)
+
+
+def header_block(functions):
+    lines = [BEGIN, "#ifdef GLAD_DEBUG",
+             "typedef void (* GLADcallback)(const char *name, void *funcptr, int len_args, ...);",
+             "GLAPI void glad_set_pre_callback(GLADcallback cb);",
+             "GLAPI void glad_set_post_callback(GLADcallback cb);"]
+    for name, _, _, pfn in functions:
+        lines.append("GLAPI %s glad_debug_%s;" % (pfn, name))
+        lines.append("#undef %s" % name)
+        lines.append("#define %s glad_debug_%s" % (name, name))
+    lines += ["#endif", END]
+    return "\n".join(lines) + "\n"
+
+
+def source_block(functions):
+    lines = [BEGIN, "#ifdef GLAD_DEBUG",
+             "#ifndef GLAD_GL_FUNCTION",
+             "#define GLAD_GL_FUNCTION(type, member, global) (global)",
+             "#endif",
+             "static void _pre_call_callback_default(const char *name, void *funcptr, int len_args, ...) {",
+             "    (void)name; (void)funcptr; (void)len_args;",
+             "}",
+             "static void _post_call_callback_default(const char *name, void *funcptr, int len_args, ...) {",
+             "    (void)name; (void)funcptr; (void)len_args;",
+             "}",
+             "static GLADcallback _pre_call_callback = _pre_call_callback_default;",
+             "void glad_set_pre_callback(GLADcallback cb) {",
+             "    _pre_call_callback = cb ? cb : _pre_call_callback_default;",
+             "}",
+             "static GLADcallback _post_call_callback = _post_call_callback_default;",
+             "void glad_set_post_callback(GLADcallback cb) {",
+             "    _post_call_callback = cb ? cb : _post_call_callback_default;",
+             "}"]
+    for name, result, params, pfn in functions:
+        declared = ", ".join("%s arg%d" % (t, i) for i, (t, _) in enumerate(params)) or "void"
+        passed = "".join(", arg%d" % i for i in range(len(params)))
+        callback_args = '"%s", (void*)glad_%s, %d%s' % (name, name, len(params), passed)
+        call = "GLAD_GL_FUNCTION(%s, %s, glad_%s)(%s)" % (pfn, name[2:], name, ", ".join("arg%d" % i for i in range(len(params))))
+        lines.append("static %s APIENTRY glad_debug_impl_%s(%s) {" % (result, name, declared))
+        if result != "void":
+            lines.append("    %s ret;" % result)
+        lines.append("    _pre_call_callback(%s);" % callback_args)
+        lines.append("    %s%s;" % ("ret = " if result != "void" else "", call))
+        lines.append("    _post_call_callback(%s);" % callback_args)
+        if result != "void":
+            lines.append("    return ret;")
+        lines.append("}")
+        lines.append("%s glad_debug_%s = glad_debug_impl_%s;" % (pfn, name, name))
+    lines += ["#endif", END]
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    functions = load_functions()
+
+    with open(HEADER) as f:
+        header = strip_block(f.read())
+    closing = "\n#ifdef __cplusplus\n}\n#endif\n\n#endif"
+    at = header.rindex(closing)
+    header = header[:at] + "\n" + header_block(functions) + header[at:]
+    with open(HEADER, "w") as f:
+        f.write(header)
+
+    with open(SOURCE) as f:
+        source = load_pointers_directly(strip_block(f.read()))
+    at = source.index("static void load_GL_VERSION_1_0(")
+    source = source[:at] + "\n" + source_block(functions) + source[at:]
+    with open(SOURCE, "w") as f:
+        f.write(source)
+
+    lines = ["// Generated by tools/gen_glad_debug.py from include/glad/glad.h; do not edit.",
+             "// Argument kinds by function name: e GLenum, x GLbitfield, i int, u unsigned, f float or double,",
+             "// z GLintptr / GLsizeiptr, l GLint64, L GLuint64, p pointer or GLsync.",
+             "",
+             "static const GlDebugSignature glDebugSignatures[] = {"]
+    for name, _, params, _ in sorted(functions):
+        lines.append('    { "%s", "%s" },' % (name, "".join(kind_of(t) for t, _ in params)))
+    lines.append("};")
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(lines) + "\n")
+    print("%d functions -> %s, %s, %s" % (len(functions), HEADER, SOURCE, OUTPUT))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+"""Generate OpenGlProject/NullGLFunctions.inl from include/glad/glad.h.
+
+Every function glad loads gets a stub that counts the call and returns zero.
+NullGL.cpp replaces the stubs that need real behavior (names, mapping, queries).
+
+Usage (from the repository root): python3 tools/gen_null_gl.py
+"""
+import os
+
+from glad_parse import ROOT, load_functions
+
+OUTPUT = os.path.join(ROOT, "OpenGlProject", "NullGLFunctions.inl")
+
+
+def main():
+    functions = [(name, result, ", ".join(t for t, _ in params) or "void")
+                 for name, result, params, _ in load_functions()]
+
+    lines = ["// Generated by tools/gen_null_gl.py from include/glad/glad.h; do not edit.", ""]
+    lines.append("enum NullGlFunction")
+    lines.append("{")
+    for name, _, _ in functions:
+        lines.append("    NULL_GL_%s," % name)
+    lines.append("    NULL_GL_FUNCTION_COUNT")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const char* nullGlNames[NULL_GL_FUNCTION_COUNT] = {")
+    for name, _, _ in functions:
+        lines.append('    "%s",' % name)
+    lines.append("};")
+    lines.append("")
+    for name, result, params in functions:
+        body = "nullGlCount(NULL_GL_%s);" % name
+        if result != "void":
+            body += " return (%s)0;" % result
+        lines.append("static %s APIENTRY nullStub_%s(%s) { %s }" % (result, name, params, body))
+    lines.append("")
+    lines.append("static void* nullGlStubs[NULL_GL_FUNCTION_COUNT] = {")
+    for name, _, _ in functions:
+        lines.append("    (void*)nullStub_%s," % name)
+    lines.append("};")
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(lines) + "\n")
+    print("%d functions -> %s" % (len(functions), OUTPUT))
+
+
+if __name__ == "__main__":
+    main()
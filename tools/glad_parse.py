@@ -0,0 +1,46 @@
+"""Shared parser for the glad header, used by the code generators in this directory."""
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HEADER = os.path.join(ROOT, "include", "glad", "glad.h")
+
+TYPEDEF = re.compile(r"typedef (.+?) \(APIENTRYP (PFNGL\w+PROC)\)\((.*)\);")
+POINTER = re.compile(r"GLAPI (PFNGL\w+PROC) glad_(gl\w+);")
+
+
+def split_parameter(param):
+    """'const void *data' -> ('const void *', 'data')."""
+    name = re.search(r"(\w+)$", param)
+    return param[:name.start()].rstrip(), name.group(1)
+
+
+def load_functions():
+    """Every function glad loads, in header order: (name, result type, [(type, name)], PFN typedef)."""
+    with open(HEADER) as f:
+        text = f.read()
+    typedefs = {m.group(2): (m.group(1), m.group(3)) for m in TYPEDEF.finditer(text)}
+    functions = []
+    for m in POINTER.finditer(text):
+        result, params = typedefs[m.group(1)]
+        parsed = [] if params.strip() == "void" else [split_parameter(p.strip()) for p in params.split(",")]
+        functions.append((m.group(2), result, parsed, m.group(1)))
+    return functions
+
+
+def load_pointers_directly(source):
+    """gladLoadGLLoader sets and tests glGetString through its gl* macro. Point those lines at glad_glGetString so
+    the generators can redefine the gl* names (a debug wrapper or per-context lookup is not an assignable pointer)."""
+    return (source.replace('\tglGetString = (PFNGLGETSTRINGPROC)load("glGetString");',
+                           '\tglad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");')
+                  .replace("\tif(glGetString == NULL) return 0;", "\tif(glad_glGetString == NULL) return 0;")
+                  .replace("\tif(glGetString(GL_VERSION) == NULL) return 0;", "\tif(glad_glGetString(GL_VERSION) == NULL) return 0;"))
+
+
+def load_version_groups(source):
+    """Functions gladLoadGLLoader loads per core version, in order: [((major, minor), [name, ...])]."""
+    groups = []
+    for m in re.finditer(r"static void load_GL_VERSION_(\d+)_(\d+)\(GLADloadproc load\) \{(.*?)\n\}", source, re.S):
+        names = re.findall(r"\tglad_(gl\w+) = ", m.group(3))
+        groups.append(((int(m.group(1)), int(m.group(2))), names))
+    return groups